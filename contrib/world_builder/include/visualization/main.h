@@ -20,6 +20,7 @@
 #ifndef WORLD_BUILDER_VISUALIZATION_MAIN_H_
 #define WORLD_BUILDER_VISUALIZATION_MAIN_H_
 
+#include <array>
 #include <vector>
 #include <string>
 
@@ -32,6 +33,10 @@ void lay_points(double x1, double y1, double z1,
                 std::vector<double> &x, std::vector<double> &y, std::vector<double> &z,
                 std::vector<bool> &hull, size_t level);
 
+std::array<size_t,3> structured_point_indices(size_t point, size_t n_cell_y, size_t n_cell_z, bool compress_size);
+
+void structured_cell_vertices(size_t cell, size_t n_cell_y, size_t n_cell_z, bool compress_size, size_t *vertices);
+
 std::vector<std::string> get_command_line_options_vector(int argc, char **argv);
 
 bool find_command_line_option(char **begin, char **end, const std::string &option);
@@ -122,6 +122,13 @@ namespace WorldBuilder
                    const std::vector<size_t> &entry_in_output,
                    std::vector<double> &output) const override final;
 
+        /**
+         * Computes the bounding box of the surface coordinates of this
+         * feature, outside of which it does not change any property.
+         */
+        bool
+        get_bounding_box_of_influence(BoundingBox<2> &bounding_box) const override final;
+
       private:
         /**
          * A vector containing all the pointers to the temperature models. This vector is
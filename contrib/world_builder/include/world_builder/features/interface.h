@@ -21,6 +21,7 @@
 #define WORLD_BUILDER_FEATURES_INTERFACE_H
 
 
+#include "world_builder/bounding_box.h"
 #include "world_builder/grains.h"
 #include "world_builder/utilities.h"
 #include "world_builder/objects/distance_from_surface.h"
@@ -119,8 +120,29 @@ namespace WorldBuilder
                                   const Objects::NaturalCoordinate &position_in_natural_coordinates,
                                   const double depth) const;
 
+        /**
+         * Computes a bounding box in the natural surface coordinates outside
+         * of which this feature never changes any property, and returns
+         * whether such a bounding box is known for this feature. The world
+         * uses these bounding boxes to skip features that can not contain a
+         * point. The default implementation returns false, which means that
+         * the feature is evaluated at every point.
+         */
+        virtual
+        bool
+        get_bounding_box_of_influence(BoundingBox<2> &bounding_box) const;
+
 
       protected:
+        /**
+         * Returns the bounding box of the surface coordinates of this feature,
+         * slightly enlarged so that it contains every point that
+         * Utilities::polygon_contains_point considers to be inside of the
+         * polygon formed by the coordinates.
+         */
+        BoundingBox<2>
+        get_coordinates_bounding_box() const;
+
         /**
          * A pointer to the world class to retrieve variables.
          */
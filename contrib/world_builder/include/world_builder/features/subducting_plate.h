@@ -137,6 +137,13 @@ namespace WorldBuilder
                    const std::vector<size_t> &entry_in_output,
                    std::vector<double> &output) const override final;
 
+        /**
+         * Returns the surface bounding box of this feature, outside of which
+         * it does not change any property.
+         */
+        bool
+        get_bounding_box_of_influence(BoundingBox<2> &bounding_box) const override final;
+
         /**
         * Returns a PlaneDistances object that has the distance from and along a subducting plate plane,
         * calculated from the coordinates and the depth of the point.
@@ -20,6 +20,7 @@
 #ifndef WORLD_BUILDER_OBJECTS_BEZIER_CURVE_H
 #define WORLD_BUILDER_OBJECTS_BEZIER_CURVE_H
 
+#include "world_builder/kd_tree.h"
 #include "world_builder/objects/closest_point_on_curve.h"
 #include "world_builder/point.h"
 #include <array>
@@ -75,11 +76,37 @@ namespace WorldBuilder
         Point<2> operator()(const size_t i, const double x) const;
 
       private:
+        /**
+         * @brief Returns the squared distance from the point to the bounding box
+         *        of the control polygon of segment i. Because a Bezier curve lies
+         *        within the convex hull of its control points, this is a lower
+         *        bound of the squared distance from the point to the segment.
+         *
+         * @param p
+         * @param i
+         * @return double
+         */
+        double squared_distance_to_bounding_box(const Point<2> &p, const size_t i) const;
+
         std::vector<Point<2> > points;
         std::vector<std::array<Point<2>,2 > > control_points;
         std::vector<double> lengths;
         std::vector<double> angles;
 
+        /**
+         * The lower and upper corner of the bounding box of the control points of
+         * every segment, slightly enlarged to also contain the points just outside
+         * of the segment which are still accepted as closest points.
+         */
+        std::vector<std::array<Point<2>,2 > > bounding_boxes;
+
+        /**
+         * A KD-tree of points sampled along the curve. The index of each node is the
+         * segment the sample belongs to, which allows to directly find a good first
+         * guess for the segment that contains the closest point.
+         */
+        KDTree::KDTree sample_tree;
+
     };
   }
 
@@ -97,6 +97,50 @@ namespace WorldBuilder
        */
       void initialize(std::string &filename, bool has_output_dir = false, const std::string &output_dir = "");
 
+      /**
+       * Initializes the parameter file from the already read content of a
+       * world builder file.
+       * \param file_content A string with the content of the world builder file
+       * \param filename A string with the path to the world builder file, used for error messages
+       * \param has_output_dir A bool indicating whether the world builder may write out information.
+       * \param output_dir A string with the path to the directory where it can output information if allowed by has_output_dir
+       */
+      void initialize_from_content(const std::string &file_content,
+                                   const std::string &filename,
+                                   bool has_output_dir = false,
+                                   const std::string &output_dir = "");
+
+      /**
+       * Returns whether the provided file content is a parameter snapshot
+       * written by write_parameter_snapshot() instead of a world builder
+       * (json) file.
+       */
+      static bool is_parameter_snapshot(const std::string &file_content);
+
+      /**
+       * Write the declarations and the validated parameters into a binary
+       * parameter snapshot file. Only these two json documents are stored,
+       * not any of the objects the World constructs from them. Loading the
+       * snapshot with initialize_from_parameter_snapshot() skips declaring
+       * the entries, parsing the json world builder file and validating it
+       * against the schema, which is the largest part of the startup cost
+       * of simple worlds. The snapshot can only be loaded by
+       * the exact same version of the World Builder on a machine with the
+       * same byte order, which is recorded in the snapshot and checked when
+       * loading it. This function has to be called after
+       * initialize() and before the entries are parsed by the World.
+       * \param filename A string with the path of the snapshot file to write.
+       */
+      void write_parameter_snapshot(const std::string &filename) const;
+
+      /**
+       * Initializes the declarations and parameters from the content of a
+       * parameter snapshot file written by write_parameter_snapshot(). No
+       * documentation or schema files are written when loading a snapshot.
+       * \param snapshot_content A string with the content of the snapshot file.
+       */
+      void initialize_from_parameter_snapshot(const std::string &snapshot_content);
+
       /**
        * A generic get function to retrieve setting from the parameter file.
        * Note that this is dependent on the current path/subsection which you are in.
@@ -20,6 +20,7 @@
 #ifndef WORLD_BUILDER_WORLD_H
 #define WORLD_BUILDER_WORLD_H
 
+#include "world_builder/bounding_box.h"
 #include "world_builder/grains.h"
 #include "world_builder/parameters.h"
 #include "world_builder/utilities.h"
@@ -73,6 +74,24 @@ namespace WorldBuilder
        */
       static void declare_entries(Parameters &prm);
 
+      /**
+       * Read the world builder file @p world_builder_file, validate it and
+       * write its declarations and parameters into the binary parameter
+       * snapshot file @p snapshot_file. The constructor of this class
+       * recognizes parameter snapshots and loads them without declaring the
+       * entries, parsing the json file and validating it against the schema,
+       * which makes setting up a world on many MPI processes considerably
+       * faster. The snapshot does not contain the constructed features,
+       * coordinate system and interpolation data, so these are still built
+       * from the parameters by every process. A snapshot can only
+       * be read by the exact same World Builder version that wrote it, on a
+       * machine with the same byte order. With MPI, only the first process
+       * writes the file. The gwb-dat program calls this function when it is
+       * given the --write-parameter-snapshot option.
+       */
+      static void write_parameter_snapshot(const std::string &world_builder_file,
+                                 const std::string &snapshot_file);
+
       /**
        * read in the world builder file
        */
@@ -138,6 +157,52 @@ namespace WorldBuilder
                                      const double depth,
                                      const std::vector<std::array<unsigned int,3>> &properties) const;
 
+      /**
+       * Returns different values at many 2d Cartesian points in one go. The
+       * result is the same as calling the single point version of this
+       * function for every point, and the output contains the vector of
+       * values for each point in the same order as the points.
+       *
+       * \param points the coordinates of the points in the cartesian geometry.
+       * \param depths the depth of each point. Needs to have the same size as \p points.
+       * \param properties the properties to compute at each point, as described
+       * for the single point version of this function.
+       * \param n_threads the number of threads used to evaluate the points.
+       * Points are only evaluated in parallel if no grains are requested,
+       * because the grain models draw from the random number engine of the
+       * world, which can not be shared between threads and whose results
+       * depend on the order of the points. For the same reason, more than
+       * one thread should not be used for worlds that use the random
+       * composition models.
+       */
+      std::vector<std::vector<double>> properties(const std::vector<std::array<double, 2>> &points,
+                                                  const std::vector<double> &depths,
+                                                  const std::vector<std::array<unsigned int,3>> &properties,
+                                                  const unsigned int n_threads = 1) const;
+
+      /**
+       * Returns different values at many 3d Cartesian points in one go. The
+       * result is the same as calling the single point version of this
+       * function for every point, and the output contains the vector of
+       * values for each point in the same order as the points.
+       *
+       * \param points the coordinates of the points in the cartesian geometry.
+       * \param depths the depth of each point. Needs to have the same size as \p points.
+       * \param properties the properties to compute at each point, as described
+       * for the single point version of this function.
+       * \param n_threads the number of threads used to evaluate the points.
+       * Points are only evaluated in parallel if no grains are requested,
+       * because the grain models draw from the random number engine of the
+       * world, which can not be shared between threads and whose results
+       * depend on the order of the points. For the same reason, more than
+       * one thread should not be used for worlds that use the random
+       * composition models.
+       */
+      std::vector<std::vector<double>> properties(const std::vector<std::array<double, 3>> &points,
+                                                  const std::vector<double> &depths,
+                                                  const std::vector<std::array<unsigned int,3>> &properties,
+                                                  const unsigned int n_threads = 1) const;
+
       /**
        * Returns the temperature based on a 2d Cartesian point, the depth in the
        * model at that point and the gravity norm at that point.
@@ -308,6 +373,63 @@ namespace WorldBuilder
        */
       bool limit_debug_consistency_checks;
 
+      /**
+       * Converts a point in the 2d cross section to a 3d Cartesian point.
+       */
+      std::array<double, 3> cross_section_point_to_cartesian(const std::array<double, 2> &point) const;
+
+      /**
+       * Sorts the bounding boxes of influence of the features into a uniform
+       * grid of bins in the natural surface coordinates. This is used to
+       * quickly find the features that may change the properties at a point.
+       */
+      void build_feature_index();
+
+      /**
+       * Calls \p function with the index of every feature that may change the
+       * properties at the given surface point, in the order in which the
+       * features are listed in the world builder file.
+       */
+      template <class Function>
+      void for_each_feature_at_surface_point(const Point<2> &surface_point,
+                                             const Function &function) const;
+
+      /**
+       * Returns the list of bounded features in the bin of the feature index
+       * that contains the given surface coordinates, or nullptr if the
+       * coordinates are outside of the feature index.
+       */
+      const std::vector<size_t> *get_feature_index_bin(const double x,
+                                                       const double y) const;
+
+      /**
+       * For every feature, whether it has a bounding box of influence, and
+       * that bounding box.
+       */
+      std::vector<bool> feature_has_bounding_box;
+      std::vector<BoundingBox<2> > feature_bounding_boxes;
+
+      /**
+       * The indices of the features without a bounding box of influence,
+       * which have to be evaluated at every point.
+       */
+      std::vector<size_t> unbounded_features;
+
+      /**
+       * The lower corner, size of the bins and number of bins of the uniform
+       * grid in the natural surface coordinates that covers the bounding boxes
+       * of all bounded features.
+       */
+      std::array<double,2> feature_index_lower_corner;
+      std::array<double,2> feature_index_bin_size;
+      std::array<size_t,2> feature_index_n_bins;
+
+      /**
+       * For every bin of the feature index, the sorted indices of the bounded
+       * features whose bounding box overlaps with the bin.
+       */
+      std::vector<std::vector<size_t> > feature_index_bins;
+
 
 
   };
@@ -84,7 +84,36 @@ int main(int argc, char **argv)
       std::cout << "This program allows to use the world builder library directly with a world builder file and a data file. "
                 "The data file will be filled with initial conditions from the world as set by the world builder file." << std::endl
                 << "Besides providing two files, where the first is the world builder file and the second is the data file, the available options are: " << std::endl
-                << "-h or --help to get this help screen." << std::endl;
+                << "-h or --help to get this help screen." << std::endl
+                << "--write-parameter-snapshot to write a binary parameter snapshot of the world builder file to the file given as second argument "
+                "instead of filling a data file. Programs using the World Builder can read the snapshot in place of the world builder file, "
+                "which skips parsing and validating it. The features of the world are still constructed from the stored parameters." << std::endl;
+      return 0;
+    }
+
+  if (find_command_line_option(argv, argv+argc, "--write-parameter-snapshot"))
+    {
+      if (argc != 4 || std::string(argv[3]) != "--write-parameter-snapshot")
+        {
+          std::cout << "Writing a parameter snapshot requires exactly three command line arguments, which should be the world builder file location, "
+                    << "the parameter snapshot file location and --write-parameter-snapshot (in that order), argc = " << argc << std::endl;
+          return 0;
+        }
+
+      int MPI_RANK = 0;
+#ifdef WB_WITH_MPI
+      MPI_Init(&argc,&argv);
+      MPI_Comm_rank(MPI_COMM_WORLD, &MPI_RANK);
+#endif
+
+      WorldBuilder::World::write_parameter_snapshot(argv[1], argv[2]);
+
+      if (MPI_RANK == 0)
+        std::cout << "Wrote the World Builder parameter snapshot." << std::endl;
+
+#ifdef WB_WITH_MPI
+      MPI_Finalize();
+#endif
       return 0;
     }
 
@@ -57,11 +57,13 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 using namespace WorldBuilder;
@@ -262,6 +264,66 @@ void lay_points(double x1, double y1, double z1,
 }
 
 
+/**
+ * Compute the indices in the x (or long), y (or lat) and z (or radius)
+ * direction of point number @p point of a structured 3d grid. The points are
+ * numbered with the z index running fastest. If @p compress_size is false,
+ * every cell has its own 8 points in the vtk vertex order instead.
+ */
+std::array<size_t,3> structured_point_indices(const size_t point,
+                                              const size_t n_cell_y,
+                                              const size_t n_cell_z,
+                                              const bool compress_size)
+{
+  if (compress_size)
+    return {{point / ((n_cell_y + 1) * (n_cell_z + 1)), (point / (n_cell_z + 1)) % (n_cell_y + 1), point % (n_cell_z + 1)}};
+
+  const size_t cell = point / 8;
+  const size_t vertex = point % 8;
+  const std::array<size_t,8> offset_x = {{0,1,1,0,0,1,1,0}};
+  const std::array<size_t,8> offset_y = {{0,0,1,1,0,0,1,1}};
+  const std::array<size_t,8> offset_z = {{0,0,0,0,1,1,1,1}};
+  return {{cell / (n_cell_y * n_cell_z) + offset_x[vertex],
+           (cell / n_cell_z) % n_cell_y + offset_y[vertex],
+           cell % n_cell_z + offset_z[vertex]
+          }};
+}
+
+/**
+ * Compute the point numbers of the 8 vertices of cell number @p cell of a
+ * structured 3d grid, numbered as in structured_point_indices().
+ */
+void structured_cell_vertices(const size_t cell,
+                              const size_t n_cell_y,
+                              const size_t n_cell_z,
+                              const bool compress_size,
+                              size_t *vertices)
+{
+  if (!compress_size)
+    {
+      for (size_t v = 0; v < 8; ++v)
+        vertices[v] = cell * 8 + v;
+      return;
+    }
+
+  const size_t i = cell / (n_cell_y * n_cell_z);
+  const size_t j = (cell / n_cell_z) % n_cell_y;
+  const size_t k = cell % n_cell_z;
+  const auto index = [&] (const size_t ii, const size_t jj, const size_t kk)
+  {
+    return (n_cell_y + 1) * (n_cell_z + 1) * ii + (n_cell_z + 1) * jj + kk;
+  };
+  vertices[0] = index(i    , j    , k);
+  vertices[1] = index(i + 1, j    , k);
+  vertices[2] = index(i + 1, j + 1, k);
+  vertices[3] = index(i    , j + 1, k);
+  vertices[4] = index(i    , j    , k + 1);
+  vertices[5] = index(i + 1, j    , k + 1);
+  vertices[6] = index(i + 1, j + 1, k + 1);
+  vertices[7] = index(i    , j + 1, k + 1);
+}
+
+
 std::vector<std::string> get_command_line_options_vector(int argc, char **argv)
 {
   std::vector<std::string> vector;
@@ -301,6 +363,13 @@ int main(int argc, char **argv)
   bool output_by_tag = false;
   // If set to true, we output a .filtered.vtu file without the background/mantle
   bool output_filtered = false;
+  // If set to true, we output a .pvtu file and a directory with the .vtu
+  // pieces instead of a single .vtu file. This is always done when running
+  // with more than one MPI process, since every process writes its own pieces.
+  bool output_pvtu = false;
+  // The maximum number of cells in a single .vtu piece. Zero means that every
+  // process writes all of its cells into a single piece.
+  size_t max_cells_per_piece = 0;
 
   size_t dim = 3;
   size_t compositions = 0;
@@ -345,12 +414,16 @@ int main(int argc, char **argv)
                     <<  "This program loads a world builder file and generates a visualization on a structured grid "
                     << "based on information specified in a separate .grid configuration file.\n\n"
                     << "Usage:\n"
-                    << argv[0] << " [-j N] [--filtered] [--by-tag] example.wb example.grid\n\n"
+                    << argv[0] << " [-j N] [--filtered] [--by-tag] [--pvtu] [--max-cells-per-piece N] example.wb example.grid\n\n"
                     << "Available options:\n"
                     << "  -j N                  Specify the number of threads the visualizer is allowed to use. Default: " << number_of_threads << ".\n"
                     << "  --filtered            Also produce a .filtered.vtu that removes cells only containing mantle or background.\n"
                     << "  --by-tag              Also produce a sequence of .N.vtu files that only contain cells of a specific tag.\n"
-                    << "  --resolution-limit X  Specify a maximum resolution."
+                    << "  --resolution-limit X  Specify a maximum resolution.\n"
+                    << "  --pvtu                Write a parallel .pvtu file with one .vtu piece per process (or more, see below) instead of a single .vtu file. "
+                    << "This is always done when running with more than one MPI process.\n"
+                    << "  --max-cells-per-piece N  Split the cells of each process into pieces of at most N cells, which are computed and written one after the other "
+                    << "to limit the memory use of each process. Implies --pvtu. Default: one piece per process.\n"
                     << "  -h or --help          To get this help screen.\n"
                     << "  -v or --version       To see version information.\n";
           return 0;
@@ -382,6 +455,23 @@ int main(int argc, char **argv)
               --i;
               continue;
             }
+          if (options_vector[i] == "--pvtu")
+            {
+              output_pvtu = true;
+              options_vector.erase(options_vector.begin()+static_cast<std::vector<std::string>::difference_type>(i));
+              --i;
+              continue;
+            }
+          if (options_vector[i] == "--max-cells-per-piece")
+            {
+              output_pvtu = true;
+              max_cells_per_piece = Utilities::string_to_unsigned_int(options_vector[i+1]);
+              WBAssertThrow(max_cells_per_piece > 0, "The maximum number of cells per piece has to be larger than zero.");
+              options_vector.erase(options_vector.begin()+static_cast<std::vector<std::string>::difference_type>(i));
+              options_vector.erase(options_vector.begin()+static_cast<std::vector<std::string>::difference_type>(i));
+              --i;
+              continue;
+            }
           if (options_vector[i] == "--resolution-limit")
             {
               max_resolution = Utilities::string_to_unsigned_int(options_vector[i+1]);
@@ -418,1252 +508,984 @@ int main(int argc, char **argv)
 
 
   int MPI_RANK = 0;
+  int MPI_SIZE = 1;
 #ifdef WB_WITH_MPI
   MPI_Init(&argc,&argv);
   MPI_Comm_rank(MPI_COMM_WORLD, &MPI_RANK);
+  MPI_Comm_size(MPI_COMM_WORLD, &MPI_SIZE);
 #endif
 
-  std::cout << "[1/6] Parsing file...                         \r";
+  if (MPI_SIZE > 1)
+    output_pvtu = true;
 
-  if (MPI_RANK ==  0)
-    {
-      /**
-       * Try to start the world builder
-       */
-      std::cout << "[2/6] Starting the world builder with " << number_of_threads << " threads...                         \r";
-      std::cout.flush();
-
-      std::unique_ptr<WorldBuilder::World> world;
-      try
-        {
-          world = std::make_unique<WorldBuilder::World>(wb_file);
-        }
-      catch (std::exception &e)
-        {
-          std::cerr << "Could not start the World builder from file '" << wb_file << "', error: " << e.what() << "\n";
+  // Only the first process reports progress.
+  std::ostream progress(MPI_RANK == 0 ? std::cout.rdbuf() : nullptr);
+
+  progress << "[1/6] Parsing file...                         \r";
+
+  {
+    /**
+     * Try to start the world builder
+     */
+    progress << "[2/6] Starting the world builder with " << number_of_threads << " threads...                         \r";
+    progress.flush();
+
+    std::unique_ptr<WorldBuilder::World> world;
+    try
+      {
+        world = std::make_unique<WorldBuilder::World>(wb_file);
+      }
+    catch (std::exception &e)
+      {
+        std::cerr << "Could not start the World builder from file '" << wb_file << "', error: " << e.what() << "\n";
 
 #ifdef WB_WITH_MPI
-          MPI_Finalize();
+        MPI_Finalize();
 #endif
-          return 1;
-        }
-      catch (...)
-        {
-          std::cerr << "Exception of unknown type!\n";
+        return 1;
+      }
+    catch (...)
+      {
+        std::cerr << "Exception of unknown type!\n";
 
 #ifdef WB_WITH_MPI
-          MPI_Finalize();
+        MPI_Finalize();
 #endif
-          return 1;
-        }
-
-      /**
-       * start the thread pool
-       */
-      ThreadPool pool(number_of_threads);
-
-      /**
-       * Read the data from the data files
-       */
-      std::cout << "[3/6] Reading grid file...                        \r";
-      std::cout.flush();
+        return 1;
+      }
 
+    /**
+     * start the thread pool
+     */
+    ThreadPool pool(number_of_threads);
 
-      std::ifstream data_stream(data_file);
+    /**
+     * Read the data from the data files
+     */
+    progress << "[3/6] Reading grid file...                        \r";
+    progress.flush();
 
-      // if config file is available, parse it
-      WBAssertThrow(data_stream.good(),
-                    "Could not find the provided config file at the specified location: " + data_file);
 
+    std::ifstream data_stream(data_file);
 
-      // move the data into a vector of strings
-      std::vector<std::vector<std::string> > data;
-      std::string temp;
+    // if config file is available, parse it
+    WBAssertThrow(data_stream.good(),
+                  "Could not find the provided config file at the specified location: " + data_file);
 
-      while (std::getline(data_stream, temp))
-        {
-          std::istringstream buffer(temp);
-          std::vector<std::string> line((std::istream_iterator<std::string>(buffer)),
-                                        std::istream_iterator<std::string>());
 
-          // remove the comma's in case it is a comma separated file.
-          // TODO: make it split for comma's and/or spaces
-          for (auto &line_i : line)
-            line_i.erase(std::remove(line_i.begin(), line_i.end(), ','), line_i.end());
+    // move the data into a vector of strings
+    std::vector<std::vector<std::string> > data;
+    std::string temp;
 
-          data.push_back(line);
-        }
+    while (std::getline(data_stream, temp))
+      {
+        std::istringstream buffer(temp);
+        std::vector<std::string> line((std::istream_iterator<std::string>(buffer)),
+                                      std::istream_iterator<std::string>());
 
-      std::string vtu_output_format = "RawBinaryCompressed";
-      // Read config from data if present
-      for (auto &line_i : data)
-        {
-          if (line_i.empty())
-            continue;
+        // remove the comma's in case it is a comma separated file.
+        // TODO: make it split for comma's and/or spaces
+        for (auto &line_i : line)
+          line_i.erase(std::remove(line_i.begin(), line_i.end(), ','), line_i.end());
 
-          if (line_i[0] == "#")
-            continue;
+        data.push_back(line);
+      }
 
-          if (line_i[0] == "grid_type" && line_i[1] == "=")
-            {
-              grid_type = line_i[2];
-            }
+    std::string vtu_output_format = "RawBinaryCompressed";
+    // Read config from data if present
+    for (auto &line_i : data)
+      {
+        if (line_i.empty())
+          continue;
 
-          if (line_i[0] == "dim" && line_i[1] == "=")
-            {
-              dim = string_to_unsigned_int(line_i[2]);
-            }
+        if (line_i[0] == "#")
+          continue;
 
-          if (line_i[0] == "vtu_output_format" && line_i[1] == "=")
-            {
-              vtu_output_format = line_i[2];
-            }
+        if (line_i[0] == "grid_type" && line_i[1] == "=")
+          {
+            grid_type = line_i[2];
+          }
 
-          if (line_i[0] == "compositions" && line_i[1] == "=")
-            compositions = string_to_unsigned_int(line_i[2]);
-
-          if (line_i[0] == "x_min" && line_i[1] == "=")
-            x_min = string_to_double(line_i[2]);
-          if (line_i[0] == "x_max" && line_i[1] == "=")
-            x_max = string_to_double(line_i[2]);
-          if (line_i[0] == "y_min" && line_i[1] == "=")
-            y_min = string_to_double(line_i[2]);
-          if (line_i[0] == "y_max" && line_i[1] == "=")
-            y_max = string_to_double(line_i[2]);
-          if (line_i[0] == "z_min" && line_i[1] == "=")
-            z_min = string_to_double(line_i[2]);
-          if (line_i[0] == "z_max" && line_i[1] == "=")
-            z_max = string_to_double(line_i[2]);
-
-          if (line_i[0] == "n_cell_x" && line_i[1] == "=")
-            n_cell_x = std::min(string_to_unsigned_int(line_i[2]),max_resolution);
-          if (line_i[0] == "n_cell_y" && line_i[1] == "=")
-            n_cell_y = std::min(string_to_unsigned_int(line_i[2]),max_resolution);
-          if (line_i[0] == "n_cell_z" && line_i[1] == "=")
-            n_cell_z = std::min(string_to_unsigned_int(line_i[2]),max_resolution);
+        if (line_i[0] == "dim" && line_i[1] == "=")
+          {
+            dim = string_to_unsigned_int(line_i[2]);
+          }
 
-        }
+        if (line_i[0] == "vtu_output_format" && line_i[1] == "=")
+          {
+            vtu_output_format = line_i[2];
+          }
 
-      WBAssertThrow(dim == 2 || dim == 3, "dim should be set in the grid file and can only be 2 or 3.");
+        if (line_i[0] == "compositions" && line_i[1] == "=")
+          compositions = string_to_unsigned_int(line_i[2]);
+
+        if (line_i[0] == "x_min" && line_i[1] == "=")
+          x_min = string_to_double(line_i[2]);
+        if (line_i[0] == "x_max" && line_i[1] == "=")
+          x_max = string_to_double(line_i[2]);
+        if (line_i[0] == "y_min" && line_i[1] == "=")
+          y_min = string_to_double(line_i[2]);
+        if (line_i[0] == "y_max" && line_i[1] == "=")
+          y_max = string_to_double(line_i[2]);
+        if (line_i[0] == "z_min" && line_i[1] == "=")
+          z_min = string_to_double(line_i[2]);
+        if (line_i[0] == "z_max" && line_i[1] == "=")
+          z_max = string_to_double(line_i[2]);
+
+        if (line_i[0] == "n_cell_x" && line_i[1] == "=")
+          n_cell_x = std::min(string_to_unsigned_int(line_i[2]),max_resolution);
+        if (line_i[0] == "n_cell_y" && line_i[1] == "=")
+          n_cell_y = std::min(string_to_unsigned_int(line_i[2]),max_resolution);
+        if (line_i[0] == "n_cell_z" && line_i[1] == "=")
+          n_cell_z = std::min(string_to_unsigned_int(line_i[2]),max_resolution);
 
-      WBAssertThrow(!std::isnan(x_min), "x_min is not a number:" << x_min << ". This value has probably not been provided in the grid file.");
-      WBAssertThrow(!std::isnan(x_max), "x_max is not a number:" << x_max << ". This value has probably not been provided in the grid file.");
-      WBAssertThrow(dim == 2 || !std::isnan(y_min), "y_min is not a number:" << y_min << ". This value has probably not been provided in the grid file.");
-      WBAssertThrow(dim == 2 || !std::isnan(y_max), "y_max is not a number:" << y_max << ". This value has probably not been provided in the grid file.");
-      WBAssertThrow(!std::isnan(z_min), "z_min is not a number:" << z_min << ". This value has probably not been provided in the grid file.");
-      WBAssertThrow(!std::isnan(z_max), "z_max is not a number:" << z_max << ". This value has probably not been provided in the grid file.");
+      }
 
+    WBAssertThrow(dim == 2 || dim == 3, "dim should be set in the grid file and can only be 2 or 3.");
 
-      WBAssertThrow(n_cell_x != 0, "n_cell_z may not be equal to zero: " << n_cell_x << '.');
-      // int's cannot generally be nan's (see https://stackoverflow.com/questions/3949457/can-an-integer-be-nan-in-c),
-      // but visual studio is giving problems over this, so it is taken out for now.
-      //WBAssertThrow(!std::isnan(n_cell_x), "n_cell_z is not a number:" << n_cell_x << '.');
+    WBAssertThrow(!std::isnan(x_min), "x_min is not a number:" << x_min << ". This value has probably not been provided in the grid file.");
+    WBAssertThrow(!std::isnan(x_max), "x_max is not a number:" << x_max << ". This value has probably not been provided in the grid file.");
+    WBAssertThrow(dim == 2 || !std::isnan(y_min), "y_min is not a number:" << y_min << ". This value has probably not been provided in the grid file.");
+    WBAssertThrow(dim == 2 || !std::isnan(y_max), "y_max is not a number:" << y_max << ". This value has probably not been provided in the grid file.");
+    WBAssertThrow(!std::isnan(z_min), "z_min is not a number:" << z_min << ". This value has probably not been provided in the grid file.");
+    WBAssertThrow(!std::isnan(z_max), "z_max is not a number:" << z_max << ". This value has probably not been provided in the grid file.");
 
-      WBAssertThrow(dim == 3 || n_cell_z != 0, "In 3d n_cell_z may not be equal to zero: " << n_cell_y << '.');
-      // int's cannot generally be nan's (see https://stackoverflow.com/questions/3949457/can-an-integer-be-nan-in-c),
-      // but visual studio is giving problems over this, so it is taken out for now.
-      //WBAssertThrow(!std::isnan(n_cell_z), "n_cell_z is not a number:" << n_cell_y << '.');
 
-      WBAssertThrow(n_cell_z != 0, "n_cell_z may not be equal to zero: " << n_cell_z << '.');
-      // int's cannot generally be nan's (see https://stackoverflow.com/questions/3949457/can-an-integer-be-nan-in-c),
-      // but visual studio is giving problems over this, so it is taken out for now.
-      //WBAssertThrow(!std::isnan(n_cell_z), "n_cell_z is not a number:" << n_cell_z << '.');
+    WBAssertThrow(n_cell_x != 0, "n_cell_z may not be equal to zero: " << n_cell_x << '.');
+    // int's cannot generally be nan's (see https://stackoverflow.com/questions/3949457/can-an-integer-be-nan-in-c),
+    // but visual studio is giving problems over this, so it is taken out for now.
+    //WBAssertThrow(!std::isnan(n_cell_x), "n_cell_z is not a number:" << n_cell_x << '.');
 
+    WBAssertThrow(dim == 3 || n_cell_z != 0, "In 3d n_cell_z may not be equal to zero: " << n_cell_y << '.');
+    // int's cannot generally be nan's (see https://stackoverflow.com/questions/3949457/can-an-integer-be-nan-in-c),
+    // but visual studio is giving problems over this, so it is taken out for now.
+    //WBAssertThrow(!std::isnan(n_cell_z), "n_cell_z is not a number:" << n_cell_y << '.');
 
+    WBAssertThrow(n_cell_z != 0, "n_cell_z may not be equal to zero: " << n_cell_z << '.');
+    // int's cannot generally be nan's (see https://stackoverflow.com/questions/3949457/can-an-integer-be-nan-in-c),
+    // but visual studio is giving problems over this, so it is taken out for now.
+    //WBAssertThrow(!std::isnan(n_cell_z), "n_cell_z is not a number:" << n_cell_z << '.');
 
 
 
-      /**
-       * All variables set by the user
-       */
 
-      if (grid_type == "sphere")
-        WBAssert(n_cell_x == n_cell_y, "For the sphere grid the amount of cells in the x (long) and y (lat) direction have to be the same.");
 
-      if (grid_type == "spherical" ||
-          grid_type == "chunk" ||
-          grid_type == "annulus")
-        {
-          x_min *= (Consts::PI/180);
-          x_max *= (Consts::PI/180);
-          y_min *= (Consts::PI/180);
-          y_max *= (Consts::PI/180);
-        }
+    /**
+     * All variables set by the user
+     */
 
+    if (grid_type == "sphere")
+      WBAssert(n_cell_x == n_cell_y, "For the sphere grid the amount of cells in the x (long) and y (lat) direction have to be the same.");
 
+    if (grid_type == "spherical" ||
+        grid_type == "chunk" ||
+        grid_type == "annulus")
+      {
+        x_min *= (Consts::PI/180);
+        x_max *= (Consts::PI/180);
+        y_min *= (Consts::PI/180);
+        y_max *= (Consts::PI/180);
+      }
 
-      /**
-       * All variables needed for the visualization
-       */
-      size_t n_cell = NaN::ISNAN;
-      size_t n_p = NaN::ISNAN;
 
-      std::vector<double> grid_x(0);
-      std::vector<double> grid_y(0);
-      std::vector<double> grid_z(0);
-      std::vector<double> grid_depth(0);
 
-      std::vector<std::vector<size_t> > grid_connectivity(0);
+    /**
+     * All variables needed for the visualization. The grid itself is not
+     * stored. Instead, the position and depth of a point and the points of a
+     * cell are computed from their index when they are needed, so that every
+     * process only computes the part of the grid it writes.
+     */
+    size_t n_cell = NaN::ISNAN;
+    size_t n_p = NaN::ISNAN;
 
+    const size_t pow_2_dim = dim == 2 ? 4 : 8;
 
-      const bool compress_size = true;
+    /**
+     * Compute the position of point number @p point, in the layout of the
+     * vtu points (x, y and z in 3d, and x, z and zero in 2d), and its depth.
+     */
+    std::function<void(const size_t point, double *position, double &depth)> compute_point;
 
+    /**
+     * Compute the point numbers of the pow_2_dim vertices of cell number
+     * @p cell, in the vtk vertex order.
+     */
+    std::function<void(const size_t cell, size_t *vertices)> compute_cell;
 
 
+    const bool compress_size = true;
 
-      /**
-       * Begin making the grid
-       */
-      std::cout << "[4/6] Building the grid...                        \r";
-      std::cout.flush();
-      WBAssertThrow(dim == 2 || dim == 3, "Dimension should be 2d or 3d.");
-      if (grid_type == "cartesian")
-        {
-          n_cell = n_cell_x * n_cell_z * (dim == 3 ? n_cell_y : 1);
-          if (!compress_size && dim == 3)
-            n_p = n_cell * 8 ; // it shouldn't matter for 2d in the output, so just do 3d.
-          else
-            n_p = (n_cell_x + 1) * (n_cell_z + 1) * (dim == 3 ? (n_cell_y + 1) : 1);
 
 
-          const double dx = (x_max - x_min) / static_cast<double>(n_cell_x);
-          const double dy = dim == 2 ? 0 : (y_max - y_min) / static_cast<double>(n_cell_y);
-          const double dz = (z_max - z_min) / static_cast<double>(n_cell_z);
 
+    /**
+     * Begin making the grid
+     */
+    progress << "[4/6] Building the grid...                        \r";
+    progress.flush();
+    WBAssertThrow(dim == 2 || dim == 3, "Dimension should be 2d or 3d.");
+    if (grid_type == "cartesian")
+      {
+        n_cell = n_cell_x * n_cell_z * (dim == 3 ? n_cell_y : 1);
+        if (!compress_size && dim == 3)
+          n_p = n_cell * 8 ; // it shouldn't matter for 2d in the output, so just do 3d.
+        else
+          n_p = (n_cell_x + 1) * (n_cell_z + 1) * (dim == 3 ? (n_cell_y + 1) : 1);
 
-          WBAssertThrow(!std::isnan(dx), "dz is not a number:" << dz << '.');
-          WBAssertThrow(dim == 2 || !std::isnan(dy), "dz is not a number:" << dz << '.');
-          WBAssertThrow(!std::isnan(dz), "dz is not a number:" << dz << '.');
 
-          // todo: determine whether a input variable is desirable for this.
-          const double surface = z_max;
+        const double dx = (x_max - x_min) / static_cast<double>(n_cell_x);
+        const double dy = dim == 2 ? 0 : (y_max - y_min) / static_cast<double>(n_cell_y);
+        const double dz = (z_max - z_min) / static_cast<double>(n_cell_z);
 
-          grid_x.resize(n_p);
-          grid_z.resize(n_p);
 
-          if (dim == 3)
-            grid_y.resize(n_p);
+        WBAssertThrow(!std::isnan(dx), "dz is not a number:" << dz << '.');
+        WBAssertThrow(dim == 2 || !std::isnan(dy), "dz is not a number:" << dz << '.');
+        WBAssertThrow(!std::isnan(dz), "dz is not a number:" << dz << '.');
 
-          grid_depth.resize(n_p);
+        // todo: determine whether a input variable is desirable for this.
+        const double surface = z_max;
 
-          // compute positions
-          size_t counter = 0;
-          if (dim == 2)
+        if (dim == 2)
+          {
+            compute_point = [=] (const size_t point, double *position, double &depth)
             {
-              for (size_t j = 0; j <= n_cell_z; ++j)
-                {
-                  for (size_t i = 0; i <= n_cell_x; ++i)
-                    {
-                      grid_x[counter] = x_min + static_cast<double>(i) * dx;
-                      grid_z[counter] = z_min + static_cast<double>(j) * dz;
-                      grid_depth[counter] = (surface - z_min) - static_cast<double>(j) * dz;
-                      counter++;
-                    }
-                }
-            }
-          else
+              const size_t i = point % (n_cell_x + 1);
+              const size_t j = point / (n_cell_x + 1);
+              position[0] = x_min + static_cast<double>(i) * dx;
+              position[1] = z_min + static_cast<double>(j) * dz;
+              position[2] = 0.;
+              depth = (surface - z_min) - static_cast<double>(j) * dz;
+            };
+
+            compute_cell = [=] (const size_t cell, size_t *vertices)
             {
-              if (compress_size)
-                {
-                  for (size_t i = 0; i <= n_cell_x; ++i)
-                    {
-                      for (size_t j = 0; j <= n_cell_y; ++j)
-                        {
-                          for (size_t k = 0; k <= n_cell_z; ++k)
-                            {
-                              grid_x[counter] = x_min + static_cast<double>(i) * dx;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dy;
-                              grid_z[counter] = z_min + static_cast<double>(k) * dz;
-                              grid_depth[counter] = (surface - z_min) - static_cast<double>(k) * dz;
-                              counter++;
-                            }
-                        }
-                    }
-                }
-              else
-                {
-                  for (size_t i = 0; i < n_cell_x; ++i)
-                    {
-                      for (size_t j = 0; j < n_cell_y; ++j)
-                        {
-                          for (size_t k = 0; k < n_cell_z; ++k)
-                            {
-                              // position is defined by the vtk file format
-                              // position 0 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dx;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dy;
-                              grid_z[counter] = z_min + static_cast<double>(k) * dz;
-                              grid_depth[counter] = (surface - z_min) - static_cast<double>(k) * dz;
-                              counter++;
-                              // position 1 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dx;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dy;
-                              grid_z[counter] = z_min + static_cast<double>(k) * dz;
-                              grid_depth[counter] = (surface - z_min) - static_cast<double>(k) * dz;
-                              counter++;
-                              // position 2 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dx;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dy;
-                              grid_z[counter] = z_min + static_cast<double>(k) * dz;
-                              grid_depth[counter] = (surface - z_min) - static_cast<double>(k) * dz;
-                              counter++;
-                              // position 3 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dx;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dy;
-                              grid_z[counter] = z_min + static_cast<double>(k) * dz;
-                              grid_depth[counter] = (surface - z_min) - static_cast<double>(k) * dz;
-                              counter++;
-                              // position 0 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dx;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dy;
-                              grid_z[counter] = z_min + (static_cast<double>(k) + 1.0) * dz;
-                              grid_depth[counter] = (surface - z_min) - (static_cast<double>(k) + 1.0) * dz;
-                              counter++;
-                              // position 1 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dx;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dy;
-                              grid_z[counter] = z_min + (static_cast<double>(k) + 1.0) * dz;
-                              grid_depth[counter] = (surface - z_min) - (static_cast<double>(k) + 1.0) * dz;
-                              counter++;
-                              // position 2 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dx;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dy;
-                              grid_z[counter] = z_min + (static_cast<double>(k) + 1.0) * dz;
-                              grid_depth[counter] = (surface - z_min) - (static_cast<double>(k) + 1.0) * dz;
-                              counter++;
-                              // position 3 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dx;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dy;
-                              grid_z[counter] = z_min + (static_cast<double>(k) + 1.0) * dz;
-                              grid_depth[counter] = (surface - z_min) - (static_cast<double>(k) + 1.0) * dz;
-                              WBAssert(counter < n_p, "Assert counter smaller then n_P: counter = " << counter << ", n_p = " << n_p);
-                              counter++;
-                            }
-                        }
-                    }
-                }
-            }
-
-          // compute connectivity. Local to global mapping.
-          grid_connectivity.resize(n_cell,std::vector<size_t>((dim-1)*4));
-
-          counter = 0;
-          if (dim == 2)
+              const size_t i = cell % n_cell_x;
+              const size_t j = cell / n_cell_x;
+              vertices[0] = i + j * (n_cell_x + 1);
+              vertices[1] = i + 1 + j * (n_cell_x + 1);
+              vertices[2] = i + 1 + (j + 1) * (n_cell_x + 1);
+              vertices[3] = i + (j + 1) * (n_cell_x + 1);
+            };
+          }
+        else
+          {
+            compute_point = [=] (const size_t point, double *position, double &depth)
             {
-              for (size_t j = 1; j <= n_cell_z; ++j)
-                {
-                  for (size_t i = 1; i <= n_cell_x; ++i)
-                    {
-                      grid_connectivity[counter][0] = i + (j - 1) * (n_cell_x + 1) - 1;
-                      grid_connectivity[counter][1] = i + 1 + (j - 1) * (n_cell_x + 1) - 1;
-                      grid_connectivity[counter][2] = i + 1  + j * (n_cell_x + 1) - 1;
-                      grid_connectivity[counter][3] = i + j * (n_cell_x + 1) - 1;
-                      counter++;
-                    }
-                }
-            }
-          else
+              const std::array<size_t,3> ijk = structured_point_indices(point, n_cell_y, n_cell_z, compress_size);
+              position[0] = x_min + static_cast<double>(ijk[0]) * dx;
+              position[1] = y_min + static_cast<double>(ijk[1]) * dy;
+              position[2] = z_min + static_cast<double>(ijk[2]) * dz;
+              depth = (surface - z_min) - static_cast<double>(ijk[2]) * dz;
+            };
+
+            compute_cell = [=] (const size_t cell, size_t *vertices)
             {
-              if (compress_size)
-                {
-                  for (size_t i = 1; i <= n_cell_x; ++i)
-                    {
-                      for (size_t j = 1; j <= n_cell_y; ++j)
-                        {
-                          for (size_t k = 1; k <= n_cell_z; ++k)
-                            {
-                              grid_connectivity[counter][0] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j - 1) + k - 1;
-                              grid_connectivity[counter][1] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j - 1) + k - 1;
-                              grid_connectivity[counter][2] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j    ) + k - 1;
-                              grid_connectivity[counter][3] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j    ) + k - 1;
-                              grid_connectivity[counter][4] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j - 1) + k;
-                              grid_connectivity[counter][5] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j - 1) + k;
-                              grid_connectivity[counter][6] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j    ) + k;
-                              grid_connectivity[counter][7] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j    ) + k;
-                              counter++;
-                            }
-                        }
-                    }
-                }
-              else
-                {
-                  for (size_t i = 0; i < n_cell; ++i)
-                    {
-                      grid_connectivity[i][0] = counter;
-                      grid_connectivity[i][1] = counter + 1;
-                      grid_connectivity[i][2] = counter + 2;
-                      grid_connectivity[i][3] = counter + 3;
-                      grid_connectivity[i][4] = counter + 4;
-                      grid_connectivity[i][5] = counter + 5;
-                      grid_connectivity[i][6] = counter + 6;
-                      grid_connectivity[i][7] = counter + 7;
-                      counter = counter + 8;
-                    }
-                }
-            }
-        }
-      else if (grid_type == "annulus")
-        {
-          /**
-           * An annulus which is a 2d hollow sphere.
-           * TODO: make it so you can determine your own cross section.
-           */
-          WBAssertThrow(dim == 2, "The annulus only works in 2d.");
+              structured_cell_vertices(cell, n_cell_y, n_cell_z, compress_size, vertices);
+            };
+          }
+      }
+    else if (grid_type == "annulus")
+      {
+        /**
+         * An annulus which is a 2d hollow sphere.
+         * TODO: make it so you can determine your own cross section.
+         */
+        WBAssertThrow(dim == 2, "The annulus only works in 2d.");
 
 
-          const double inner_radius = z_min;
-          const double outer_radius = z_max;
+        const double inner_radius = z_min;
+        const double outer_radius = z_max;
 
-          const double l_outer = 2.0 * Consts::PI * outer_radius;
+        const double l_outer = 2.0 * Consts::PI * outer_radius;
 
-          const double lr = outer_radius - inner_radius;
-          const double dr = lr / static_cast<double>(n_cell_z);
+        const double lr = outer_radius - inner_radius;
+        const double dr = lr / static_cast<double>(n_cell_z);
 
-          const size_t n_cell_t = static_cast<size_t>((2.0 * Consts::PI * outer_radius)/dr);
+        const size_t n_cell_t = static_cast<size_t>((2.0 * Consts::PI * outer_radius)/dr);
 
-          // compute the amount of cells
-          n_cell = n_cell_t *n_cell_z;
-          n_p = n_cell_t *(n_cell_z + 1);  // one less then cartesian because two cells overlap.
+        // compute the amount of cells
+        n_cell = n_cell_t *n_cell_z;
+        n_p = n_cell_t *(n_cell_z + 1);  // one less then cartesian because two cells overlap.
 
-          const double sx = l_outer / static_cast<double>(n_cell_t);
-          const double sz = dr;
+        const double sx = l_outer / static_cast<double>(n_cell_t);
+        const double sz = dr;
 
-          grid_x.resize(n_p);
-          grid_z.resize(n_p);
-          grid_depth.resize(n_p);
+        compute_point = [=] (const size_t point, double *position, double &depth)
+        {
+          const double xi = static_cast<double>(point % n_cell_t) * sx;
+          const double zi = static_cast<double>(point / n_cell_t) * sz;
+          const double theta = xi / l_outer * 2.0 * Consts::PI;
+          position[0] = std::cos(theta) * (inner_radius + zi);
+          position[1] = std::sin(theta) * (inner_radius + zi);
+          position[2] = 0.;
+          depth = outer_radius - std::sqrt(position[0] * position[0] + position[1] * position[1]);
+          depth = (std::fabs(depth) < 1e-8 ? 0 : depth);
+        };
+
+        compute_cell = [=] (const size_t cell, size_t *vertices)
+        {
+          // the last cell of every ring connects to the first point of the ring
+          const size_t next = cell % n_cell_t == n_cell_t - 1 ? cell + 1 - n_cell_t : cell + 1;
+          vertices[0] = next;
+          vertices[1] = cell;
+          vertices[2] = cell + n_cell_t;
+          vertices[3] = next + n_cell_t;
+        };
+      }
+    else if (grid_type == "chunk")
+      {
+        const double inner_radius = z_min;
+        const double outer_radius = z_max;
 
-          size_t counter = 0;
-          for (size_t j = 0; j <= n_cell_z; ++j)
-            {
-              for (size_t i = 1; i <= n_cell_t; ++i)
-                {
-                  grid_x[counter] = (static_cast<double>(i) - 1.0) * sx;
-                  grid_z[counter] = static_cast<double>(j) * sz;
-                  counter++;
-                }
-            }
+        WBAssertThrow(x_min <= x_max, "The minimum longitude must be less than the maximum longitude.");
+        WBAssertThrow(y_min <= y_max, "The minimum latitude must be less than the maximum latitude.");
+        WBAssertThrow(inner_radius < outer_radius, "The inner radius must be less than the outer radius.");
 
-          counter = 0;
-          for (size_t j = 1; j <= n_cell_z+1; ++j)
-            {
-              for (size_t i = 1; i <= n_cell_t; ++i)
-                {
-                  const double xi = grid_x[counter];
-                  const double zi = grid_z[counter];
-                  const double theta = xi / l_outer * 2.0 * Consts::PI;
-                  grid_x[counter] = std::cos(theta) * (inner_radius + zi);
-                  grid_z[counter] = std::sin(theta) * (inner_radius + zi);
-                  grid_depth[counter] = outer_radius - std::sqrt(grid_x[counter] * grid_x[counter] + grid_z[counter] * grid_z [counter]);
-                  grid_depth[counter] = (std::fabs(grid_depth[counter]) < 1e-8 ? 0 : grid_depth[counter]);
-                  counter++;
-                }
-            }
+        WBAssertThrow(x_min - x_max <= 2.0 * Consts::PI, "The difference between the minimum and maximum longitude "
+                      " must be less than or equal to 360 degree.");
+
+        WBAssertThrow(y_min >= - 0.5 * Consts::PI, "The minimum latitude must be larger then or equal to -90 degree.");
+        WBAssertThrow(y_min <= 0.5 * Consts::PI, "The maximum latitude must be smaller then or equal to 90 degree.");
+
+        const double opening_angle_long_rad = (x_max - x_min);
+        const double opening_angle_lat_rad =  (y_max - y_min);
+
+        n_cell = n_cell_x * n_cell_z * (dim == 3 ? n_cell_y : 1);
+        if (!compress_size && dim == 3)
+          n_p = n_cell * 8 ; // it shouldn't matter for 2d in the output, so just do 3d.
+        else
+          n_p = (n_cell_x + 1) * (n_cell_z + 1) * (dim == 3 ? (n_cell_y + 1) : 1);
 
-          grid_connectivity.resize(n_cell,std::vector<size_t>(4));
-          counter = 0;
-          for (size_t j = 1; j <= n_cell_z; ++j)
+        const double dlong = opening_angle_long_rad / static_cast<double>(n_cell_x);
+        const double dlat = dim == 3 ? opening_angle_lat_rad / static_cast<double>(n_cell_y) : 0.;
+        const double lr = outer_radius - inner_radius;
+        const double dr = lr / static_cast<double>(n_cell_z);
+
+        if (dim == 2)
+          {
+            compute_point = [=] (const size_t point, double *position, double &depth)
             {
-              for (size_t i = 1; i <= n_cell_t; ++i)
-                {
-                  std::vector<size_t> cell_connectivity(4);
-                  cell_connectivity[0] = counter + 1;
-                  cell_connectivity[1] = counter + 1 + 1;
-                  cell_connectivity[2] = i + j * n_cell_t + 1;
-                  cell_connectivity[3] = i + j * n_cell_t;
-                  if (i == n_cell_t)
-                    {
-                      cell_connectivity[1] = cell_connectivity[1] - n_cell_t;
-                      cell_connectivity[2] = cell_connectivity[2] - n_cell_t;
-                    }
-                  grid_connectivity[counter][0] = cell_connectivity[1] - 1;
-                  grid_connectivity[counter][1] = cell_connectivity[0] - 1;
-                  grid_connectivity[counter][2] = cell_connectivity[3] - 1;
-                  grid_connectivity[counter][3] = cell_connectivity[2] - 1;
-                  counter++;
-                }
-            }
-        }
-      else if (grid_type == "chunk")
-        {
-          const double inner_radius = z_min;
-          const double outer_radius = z_max;
-
-          WBAssertThrow(x_min <= x_max, "The minimum longitude must be less than the maximum longitude.");
-          WBAssertThrow(y_min <= y_max, "The minimum latitude must be less than the maximum latitude.");
-          WBAssertThrow(inner_radius < outer_radius, "The inner radius must be less than the outer radius.");
-
-          WBAssertThrow(x_min - x_max <= 2.0 * Consts::PI, "The difference between the minimum and maximum longitude "
-                        " must be less than or equal to 360 degree.");
-
-          WBAssertThrow(y_min >= - 0.5 * Consts::PI, "The minimum latitude must be larger then or equal to -90 degree.");
-          WBAssertThrow(y_min <= 0.5 * Consts::PI, "The maximum latitude must be smaller then or equal to 90 degree.");
-
-          const double opening_angle_long_rad = (x_max - x_min);
-          const double opening_angle_lat_rad =  (y_max - y_min);
-
-          n_cell = n_cell_x * n_cell_z * (dim == 3 ? n_cell_y : 1);
-          if (!compress_size && dim == 3)
-            n_p = n_cell * 8 ; // it shouldn't matter for 2d in the output, so just do 3d.
-          else
-            n_p = (n_cell_x + 1) * (n_cell_z + 1) * (dim == 3 ? (n_cell_y + 1) : 1);
-
-          const double dlong = opening_angle_long_rad / static_cast<double>(n_cell_x);
-          const double dlat = dim == 3 ? opening_angle_lat_rad / static_cast<double>(n_cell_y) : 0.;
-          const double lr = outer_radius - inner_radius;
-          const double dr = lr / static_cast<double>(n_cell_z);
-
-          grid_x.resize(n_p);
-          grid_y.resize(dim == 3 ? n_p : 0);
-          grid_z.resize(n_p);
-          grid_depth.resize(n_p);
-
-          std::cout << "[4/6] Building the grid: stage 1 of 3                        \r";
-          std::cout.flush();
-          size_t counter = 0;
-          if (dim == 2)
+              const size_t i = point / (n_cell_z + 1);
+              const size_t j = point % (n_cell_z + 1);
+              const double longitude = x_min + static_cast<double>(i) * dlong;
+              const double radius = inner_radius + static_cast<double>(j) * dr;
+              position[0] = radius * std::cos(longitude);
+              position[1] = radius * std::sin(longitude);
+              position[2] = 0.;
+              depth = lr - static_cast<double>(j) * dr;
+            };
+
+            compute_cell = [=] (const size_t cell, size_t *vertices)
             {
-              for (size_t i = 1; i <= n_cell_x + 1; ++i)
-                for (size_t j = 1; j <= n_cell_z + 1; ++j)
-                  {
-                    grid_x[counter] = x_min + (static_cast<double>(i) - 1.0) * dlong;
-                    grid_z[counter] = inner_radius + (static_cast<double>(j) - 1.0) * dr;
-                    grid_depth[counter] = lr - (static_cast<double>(j) - 1.0) * dr;
-                    counter++;
-                  }
-            }
-          else
+              const size_t i = cell / n_cell_z;
+              const size_t j = cell % n_cell_z;
+              vertices[0] = (n_cell_z + 1) * i + j;
+              vertices[1] = (n_cell_z + 1) * i + j + 1;
+              vertices[2] = (n_cell_z + 1) * (i + 1) + j + 1;
+              vertices[3] = (n_cell_z + 1) * (i + 1) + j;
+            };
+          }
+        else
+          {
+            compute_point = [=] (const size_t point, double *position, double &depth)
             {
-              if (compress_size)
-                {
-                  for (size_t i = 1; i <= n_cell_x + 1; ++i)
-                    for (size_t j = 1; j <= n_cell_y + 1; ++j)
-                      for (size_t k = 1; k <= n_cell_z + 1; ++k)
-                        {
-                          grid_x[counter] = x_min + (static_cast<double>(i) - 1.0) * dlong;
-                          grid_y[counter] = y_min + (static_cast<double>(j) - 1.0) * dlat;
-                          grid_z[counter] = inner_radius + (static_cast<double>(k) - 1.0) * dr;
-                          grid_depth[counter] = lr - (static_cast<double>(k) - 1.0) * dr;
-                          counter++;
-                        }
-                }
-              else
-                {
-                  for (size_t i = 0; i < n_cell_x; ++i)
-                    {
-                      for (size_t j = 0; j < n_cell_y; ++j)
-                        {
-                          for (size_t k = 0; k < n_cell_z; ++k)
-                            {
-                              // position is defined by the vtk file format
-                              // position 0 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dlong;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dlat;
-                              grid_z[counter] = inner_radius + static_cast<double>(k) * dr;
-                              grid_depth[counter] = lr - static_cast<double>(k) * dr;
-                              counter++;
-                              // position 1 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dlong;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dlat;
-                              grid_z[counter] = inner_radius + static_cast<double>(k) * dr;
-                              grid_depth[counter] = lr - static_cast<double>(k) * dr;
-                              counter++;
-                              // position 2 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dlong;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dlat;
-                              grid_z[counter] = inner_radius + static_cast<double>(k) * dr;
-                              grid_depth[counter] = lr - static_cast<double>(k) * dr;
-                              counter++;
-                              // position 3 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dlong;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dlat;
-                              grid_z[counter] = inner_radius + static_cast<double>(k) * dr;
-                              grid_depth[counter] = lr - static_cast<double>(k) * dr;
-                              counter++;
-                              // position 0 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dlong;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dlat;
-                              grid_z[counter] = inner_radius + (static_cast<double>(k) + 1.0) * dr;
-                              grid_depth[counter] = lr - (static_cast<double>(k) + 1.0) * dr;
-                              counter++;
-                              // position 1 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dlong;
-                              grid_y[counter] = y_min + static_cast<double>(j) * dlat;
-                              grid_z[counter] = inner_radius + (static_cast<double>(k) + 1.0) * dr;
-                              grid_depth[counter] = lr - (static_cast<double>(k) + 1.0) * dr;
-                              counter++;
-                              // position 2 of this cell
-                              grid_x[counter] = x_min + (static_cast<double>(i) + 1.0) * dlong;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dlat;
-                              grid_z[counter] = inner_radius + (static_cast<double>(k) + 1.0) * dr;
-                              grid_depth[counter] = lr - (static_cast<double>(k) + 1.0) * dr;
-                              counter++;
-                              // position 3 of this cell
-                              grid_x[counter] = x_min + static_cast<double>(i) * dlong;
-                              grid_y[counter] = y_min + (static_cast<double>(j) + 1.0) * dlat;
-                              grid_z[counter] = inner_radius + (static_cast<double>(k) + 1.0) * dr;
-                              grid_depth[counter] = lr - (static_cast<double>(k) + 1.0) * dr;
-                              WBAssert(counter < n_p, "Assert counter smaller then n_P: counter = " << counter << ", n_p = " << n_p);
-                              counter++;
-                            }
-                        }
-                    }
-                }
-            }
-
-          std::cout << "[4/6] Building the grid: stage 2 of 3                        \r";
-          std::cout.flush();
-          if (dim == 2)
+              const std::array<size_t,3> ijk = structured_point_indices(point, n_cell_y, n_cell_z, compress_size);
+              const double longitude = x_min + static_cast<double>(ijk[0]) * dlong;
+              const double latitude = y_min + static_cast<double>(ijk[1]) * dlat;
+              const double radius = inner_radius + static_cast<double>(ijk[2]) * dr;
+              position[0] = radius * std::cos(latitude) * std::cos(longitude);
+              position[1] = radius * std::cos(latitude) * std::sin(longitude);
+              position[2] = radius * std::sin(latitude);
+              depth = lr - static_cast<double>(ijk[2]) * dr;
+            };
+
+            compute_cell = [=] (const size_t cell, size_t *vertices)
             {
-              for (size_t i = 0; i < n_p; ++i)
-                {
+              structured_cell_vertices(cell, n_cell_y, n_cell_z, compress_size, vertices);
+            };
+          }
+      }
+    else if (grid_type == "sphere")
+      {
 
-                  const double longitude = grid_x[i];
-                  const double radius = grid_z[i];
+        WBAssertThrow(dim == 3, "The sphere only works in 3d.");
 
-                  grid_x[i] = radius * std::cos(longitude);
-                  grid_z[i] = radius * std::sin(longitude);
-                }
-            }
-          else
-            {
-              for (size_t i = 0; i < n_p; ++i)
-                {
 
-                  const double longitude = grid_x[i];
-                  const double latitutde = grid_y[i];
-                  const double radius = grid_z[i];
+        const double inner_radius = z_min;
+        const double outer_radius = z_max;
 
-                  grid_x[i] = radius * std::cos(latitutde) * std::cos(longitude);
-                  grid_y[i] = radius * std::cos(latitutde) * std::sin(longitude);
-                  grid_z[i] = radius * std::sin(latitutde);
-                }
-            }
-          std::cout << "[4/6] Building the grid: stage 3 of 3                        \r";
-          std::cout.flush();
-          // compute connectivity. Local to global mapping.
-          grid_connectivity.resize(n_cell,std::vector<size_t>((dim-1)*4));
+        const size_t n_block = 12;
 
-          counter = 0;
-          if (dim == 2)
-            {
-              for (size_t i = 1; i <= n_cell_x; ++i)
-                {
-                  for (size_t j = 1; j <= n_cell_z; ++j)
-                    {
-                      grid_connectivity[counter][0] = (n_cell_z + 1) * (i - 1) + j - 1;
-                      grid_connectivity[counter][1] = (n_cell_z + 1) * (i - 1) + j;
-                      grid_connectivity[counter][2] = (n_cell_z + 1) * (i    ) + j;
-                      grid_connectivity[counter][3] = (n_cell_z + 1) * (i    ) + j - 1;
-
-                      counter = counter+1;
-                      std::cout << "[4/6] Building the grid: stage 3 of 3 [" << (static_cast<double>(i)/static_cast<double>(n_cell))*100.0 << "%]                       \r";
-                      std::cout.flush();
-                    }
-                }
-            }
-          else
-            {
-              if (compress_size)
-                {
-                  for (size_t i = 1; i <= n_cell_x; ++i)
-                    {
-                      for (size_t j = 1; j <= n_cell_y; ++j)
-                        {
-                          for (size_t k = 1; k <= n_cell_z; ++k)
-                            {
-                              grid_connectivity[counter][0] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j - 1) + k - 1;
-                              grid_connectivity[counter][1] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j - 1) + k - 1;
-                              grid_connectivity[counter][2] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j    ) + k - 1;
-                              grid_connectivity[counter][3] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j    ) + k - 1;
-                              grid_connectivity[counter][4] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j - 1) + k;
-                              grid_connectivity[counter][5] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j - 1) + k;
-                              grid_connectivity[counter][6] = (n_cell_y + 1) * (n_cell_z + 1) * (i    ) + (n_cell_z + 1) * (j    ) + k;
-                              grid_connectivity[counter][7] = (n_cell_y + 1) * (n_cell_z + 1) * (i - 1) + (n_cell_z + 1) * (j    ) + k;
-                              counter++;
-                            }
-                        }
-                    }
-                }
-              else
-                {
-                  for (size_t i = 0; i < n_cell; ++i)
-                    {
-                      grid_connectivity[i][0] = counter;
-                      grid_connectivity[i][1] = counter + 1;
-                      grid_connectivity[i][2] = counter + 2;
-                      grid_connectivity[i][3] = counter + 3;
-                      grid_connectivity[i][4] = counter + 4;
-                      grid_connectivity[i][5] = counter + 5;
-                      grid_connectivity[i][6] = counter + 6;
-                      grid_connectivity[i][7] = counter + 7;
-                      counter = counter + 8;
-                      std::cout << "[4/6] Building the grid: stage 3 of 3 [" << (static_cast<double>(i)/static_cast<double>(n_cell))*100.0 << "%]                       \r";
-                      std::cout.flush();
-                    }
-                }
-            }
-        }
-      else if (grid_type == "sphere")
-        {
+        const size_t block_n_cell = n_cell_x*n_cell_x;
+        const size_t block_n_p = (n_cell_x + 1) * (n_cell_x + 1);
+        const size_t block_n_v = 4;
 
-          WBAssertThrow(dim == 3, "The sphere only works in 3d.");
 
+        std::vector<std::vector<double> > block_grid_x(n_block,std::vector<double>(block_n_p));
+        std::vector<std::vector<double> > block_grid_y(n_block,std::vector<double>(block_n_p));
+        std::vector<std::vector<double> > block_grid_z(n_block,std::vector<double>(block_n_p));
+        std::vector<std::vector<std::vector<size_t> > > block_grid_connectivity(n_block,std::vector<std::vector<size_t> >(block_n_cell,std::vector<size_t>(block_n_v)));
+        std::vector<std::vector<bool> > block_grid_hull(n_block,std::vector<bool>(block_n_p));
 
-          const double inner_radius = z_min;
-          const double outer_radius = z_max;
-
-          const size_t n_block = 12;
+        /**
+         * block node layout
+         */
+        for (size_t i_block = 0; i_block < n_block; ++i_block)
+          {
+            const size_t block_n_cell_x = n_cell_x;
+            const size_t block_n_cell_y = n_cell_x;
+            const double Lx = 1.0;
+            const double Ly = 1.0;
 
-          const size_t block_n_cell = n_cell_x*n_cell_x;
-          const size_t block_n_p = (n_cell_x + 1) * (n_cell_x + 1);
-          const size_t block_n_v = 4;
+            size_t counter = 0;
+            for (size_t j = 0; j <= block_n_cell_y; ++j)
+              {
+                for (size_t i = 0; i <= block_n_cell_y; ++i)
+                  {
+                    block_grid_x[i_block][counter] = static_cast<double>(i) * Lx / static_cast<double>(block_n_cell_x);
+                    block_grid_y[i_block][counter] = static_cast<double>(j) * Ly / static_cast<double>(block_n_cell_y);
+                    block_grid_z[i_block][counter] = 0.0;
+                    counter++;
+                  }
+              }
 
+            counter = 0;
+            // using i=1 and j=1 here because i an j are not used in lookup and storage
+            // so the code can remain very similar to ghost and the cartesian code.
+            for (size_t j = 1; j <= block_n_cell_y; ++j)
+              {
+                for (size_t i = 1; i <= block_n_cell_x; ++i)
+                  {
+                    block_grid_connectivity[i_block][counter][0] = i + (j - 1) * (block_n_cell_x + 1) - 1;
+                    block_grid_connectivity[i_block][counter][1] = i + 1 + (j - 1) * (block_n_cell_x + 1) - 1;
+                    block_grid_connectivity[i_block][counter][2] = i + 1  + j * (block_n_cell_x + 1) - 1;
+                    block_grid_connectivity[i_block][counter][3] = i + j * (block_n_cell_x + 1) - 1;
+                    counter++;
+                  }
+              }
+          }
 
-          std::vector<std::vector<double> > block_grid_x(n_block,std::vector<double>(block_n_p));
-          std::vector<std::vector<double> > block_grid_y(n_block,std::vector<double>(block_n_p));
-          std::vector<std::vector<double> > block_grid_z(n_block,std::vector<double>(block_n_p));
-          std::vector<std::vector<std::vector<size_t> > > block_grid_connectivity(n_block,std::vector<std::vector<size_t> >(block_n_cell,std::vector<size_t>(block_n_v)));
-          std::vector<std::vector<bool> > block_grid_hull(n_block,std::vector<bool>(block_n_p));
+        /**
+         * map blocks
+         */
+        double radius = 1;
+
+        // four corners
+        double xA = -1.0;
+        double yA = 0.0;
+        double zA = -1.0 / std::sqrt(2.0);
+
+        double xB = 1.0;
+        double yB = 0.0;
+        double zB = -1.0 / std::sqrt(2.0);
+
+        double xC = 0.0;
+        double yC = -1.0;
+        double zC = 1.0 / std::sqrt(2.0);
+
+        double xD = 0.0;
+        double yD = 1.0;
+        double zD = 1.0 / std::sqrt(2.0);
+
+        // middles of faces
+        double xM = (xA+xB+xC)/3.0;
+        double yM = (yA+yB+yC)/3.0;
+        double zM = (zA+zB+zC)/3.0;
+
+        double xN = (xA+xD+xC)/3.0;
+        double yN = (yA+yD+yC)/3.0;
+        double zN = (zA+zD+zC)/3.0;
+
+        double xP = (xA+xD+xB)/3.0;
+        double yP = (yA+yD+yB)/3.0;
+        double zP = (zA+zD+zB)/3.0;
+
+        double xQ = (xC+xD+xB)/3.0;
+        double yQ = (yC+yD+yB)/3.0;
+        double zQ = (zC+zD+zB)/3.0;
+
+        // middle of edges
+        double xF = (xB+xC)/2.0;
+        double yF = (yB+yC)/2.0;
+        double zF = (zB+zC)/2.0;
+
+        double xG = (xA+xC)/2.0;
+        double yG = (yA+yC)/2.0;
+        double zG = (zA+zC)/2.0;
+
+        double xE = (xB+xA)/2.0;
+        double yE = (yB+yA)/2.0;
+        double zE = (zB+zA)/2.0;
+
+        double xH = (xD+xC)/2.0;
+        double yH = (yD+yC)/2.0;
+        double zH = (zD+zC)/2.0;
+
+        double xJ = (xD+xA)/2.0;
+        double yJ = (yD+yA)/2.0;
+        double zJ = (zD+zA)/2.0;
+
+        double xK = (xD+xB)/2.0;
+        double yK = (yD+yB)/2.0;
+        double zK = (zD+zB)/2.0;
+
+        // Making sure points A..Q are on a sphere
+        project_on_sphere(radius,xA,yA,zA);
+        project_on_sphere(radius,xB,yB,zB);
+        project_on_sphere(radius,xC,yC,zC);
+        project_on_sphere(radius,xD,yD,zD);
+        project_on_sphere(radius,xE,yE,zE);
+        project_on_sphere(radius,xF,yF,zF);
+        project_on_sphere(radius,xG,yG,zG);
+        project_on_sphere(radius,xH,yH,zH);
+        project_on_sphere(radius,xJ,yJ,zJ);
+        project_on_sphere(radius,xK,yK,zK);
+        project_on_sphere(radius,xM,yM,zM);
+        project_on_sphere(radius,xN,yN,zN);
+        project_on_sphere(radius,xP,yP,zP);
+        project_on_sphere(radius,xQ,yQ,zQ);
+
+        lay_points(xM,yM,zM,xG,yG,zG,xA,yA,zA,xE,yE,zE,block_grid_x[0], block_grid_y[0], block_grid_z[0],block_grid_hull[0], n_cell_x);
+        lay_points(xF,yF,zF,xM,yM,zM,xE,yE,zE,xB,yB,zB,block_grid_x[1], block_grid_y[1], block_grid_z[1],block_grid_hull[1], n_cell_x);
+        lay_points(xC,yC,zC,xG,yG,zG,xM,yM,zM,xF,yF,zF,block_grid_x[2], block_grid_y[2], block_grid_z[2],block_grid_hull[2], n_cell_x);
+        lay_points(xG,yG,zG,xN,yN,zN,xJ,yJ,zJ,xA,yA,zA,block_grid_x[3], block_grid_y[3], block_grid_z[3],block_grid_hull[3], n_cell_x);
+        lay_points(xC,yC,zC,xH,yH,zH,xN,yN,zN,xG,yG,zG,block_grid_x[4], block_grid_y[4], block_grid_z[4],block_grid_hull[4], n_cell_x);
+        lay_points(xH,yH,zH,xD,yD,zD,xJ,yJ,zJ,xN,yN,zN,block_grid_x[5], block_grid_y[5], block_grid_z[5],block_grid_hull[5], n_cell_x);
+        lay_points(xA,yA,zA,xJ,yJ,zJ,xP,yP,zP,xE,yE,zE,block_grid_x[6], block_grid_y[6], block_grid_z[6],block_grid_hull[6], n_cell_x);
+        lay_points(xJ,yJ,zJ,xD,yD,zD,xK,yK,zK,xP,yP,zP,block_grid_x[7], block_grid_y[7], block_grid_z[7],block_grid_hull[7], n_cell_x);
+        lay_points(xP,yP,zP,xK,yK,zK,xB,yB,zB,xE,yE,zE,block_grid_x[8], block_grid_y[8], block_grid_z[8],block_grid_hull[8], n_cell_x);
+        lay_points(xQ,yQ,zQ,xK,yK,zK,xD,yD,zD,xH,yH,zH,block_grid_x[9], block_grid_y[9], block_grid_z[9],block_grid_hull[9], n_cell_x);
+        lay_points(xQ,yQ,zQ,xH,yH,zH,xC,yC,zC,xF,yF,zF,block_grid_x[10], block_grid_y[10], block_grid_z[10],block_grid_hull[10], n_cell_x);
+        lay_points(xQ,yQ,zQ,xF,yF,zF,xB,yB,zB,xK,yK,zK,block_grid_x[11], block_grid_y[11], block_grid_z[11],block_grid_hull[11], n_cell_x);
+
+        // make sure all points end up on a sphere
+        for (size_t i_block = 0; i_block < n_block; ++i_block)
+          {
+            for (size_t i_point = 0; i_point < block_n_p; ++i_point)
+              {
+                project_on_sphere(radius,block_grid_x[i_block][i_point],block_grid_y[i_block][i_point],block_grid_z[i_block][i_point]);
+              }
+          }
 
-          /**
-           * block node layout
-           */
-          for (size_t i_block = 0; i_block < n_block; ++i_block)
-            {
-              const size_t block_n_cell_x = n_cell_x;
-              const size_t block_n_cell_y = n_cell_x;
-              const double Lx = 1.0;
-              const double Ly = 1.0;
+        /**
+         * merge blocks
+         */
+        std::vector<double> temp_x(n_block * block_n_p);
+        std::vector<double> temp_y(n_block * block_n_p);
+        std::vector<double> temp_z(n_block * block_n_p);
+        std::vector<bool> sides(n_block * block_n_p);
 
-              size_t counter = 0;
-              for (size_t j = 0; j <= block_n_cell_y; ++j)
-                {
-                  for (size_t i = 0; i <= block_n_cell_y; ++i)
-                    {
-                      block_grid_x[i_block][counter] = static_cast<double>(i) * Lx / static_cast<double>(block_n_cell_x);
-                      block_grid_y[i_block][counter] = static_cast<double>(j) * Ly / static_cast<double>(block_n_cell_y);
-                      block_grid_z[i_block][counter] = 0.0;
-                      counter++;
-                    }
-                }
+        for (size_t i = 0; i < n_block; ++i)
+          {
+            size_t counter = 0;
+            for (size_t j = i * block_n_p; j < i * block_n_p + block_n_p; ++j)
+              {
+                WBAssert(j < temp_x.size(), "j should be smaller then the size of the array temp_x.");
+                WBAssert(j < temp_y.size(), "j should be smaller then the size of the array temp_y.");
+                WBAssert(j < temp_z.size(), "j should be smaller then the size of the array temp_z.");
+                temp_x[j] = block_grid_x[i][counter];
+                temp_y[j] = block_grid_y[i][counter];
+                temp_z[j] = block_grid_z[i][counter];
+                sides[j] = block_grid_hull[i][counter];
+                counter++;
+              }
+          }
 
-              counter = 0;
-              // using i=1 and j=1 here because i an j are not used in lookup and storage
-              // so the code can remain very similar to ghost and the cartesian code.
-              for (size_t j = 1; j <= block_n_cell_y; ++j)
-                {
-                  for (size_t i = 1; i <= block_n_cell_x; ++i)
-                    {
-                      block_grid_connectivity[i_block][counter][0] = i + (j - 1) * (block_n_cell_x + 1) - 1;
-                      block_grid_connectivity[i_block][counter][1] = i + 1 + (j - 1) * (block_n_cell_x + 1) - 1;
-                      block_grid_connectivity[i_block][counter][2] = i + 1  + j * (block_n_cell_x + 1) - 1;
-                      block_grid_connectivity[i_block][counter][3] = i + j * (block_n_cell_x + 1) - 1;
-                      counter++;
-                    }
-                }
-            }
 
-          /**
-           * map blocks
-           */
-          double radius = 1;
-
-          // four corners
-          double xA = -1.0;
-          double yA = 0.0;
-          double zA = -1.0 / std::sqrt(2.0);
-
-          double xB = 1.0;
-          double yB = 0.0;
-          double zB = -1.0 / std::sqrt(2.0);
-
-          double xC = 0.0;
-          double yC = -1.0;
-          double zC = 1.0 / std::sqrt(2.0);
-
-          double xD = 0.0;
-          double yD = 1.0;
-          double zD = 1.0 / std::sqrt(2.0);
-
-          // middles of faces
-          double xM = (xA+xB+xC)/3.0;
-          double yM = (yA+yB+yC)/3.0;
-          double zM = (zA+zB+zC)/3.0;
-
-          double xN = (xA+xD+xC)/3.0;
-          double yN = (yA+yD+yC)/3.0;
-          double zN = (zA+zD+zC)/3.0;
-
-          double xP = (xA+xD+xB)/3.0;
-          double yP = (yA+yD+yB)/3.0;
-          double zP = (zA+zD+zB)/3.0;
-
-          double xQ = (xC+xD+xB)/3.0;
-          double yQ = (yC+yD+yB)/3.0;
-          double zQ = (zC+zD+zB)/3.0;
-
-          // middle of edges
-          double xF = (xB+xC)/2.0;
-          double yF = (yB+yC)/2.0;
-          double zF = (zB+zC)/2.0;
-
-          double xG = (xA+xC)/2.0;
-          double yG = (yA+yC)/2.0;
-          double zG = (zA+zC)/2.0;
-
-          double xE = (xB+xA)/2.0;
-          double yE = (yB+yA)/2.0;
-          double zE = (zB+zA)/2.0;
-
-          double xH = (xD+xC)/2.0;
-          double yH = (yD+yC)/2.0;
-          double zH = (zD+zC)/2.0;
-
-          double xJ = (xD+xA)/2.0;
-          double yJ = (yD+yA)/2.0;
-          double zJ = (zD+zA)/2.0;
-
-          double xK = (xD+xB)/2.0;
-          double yK = (yD+yB)/2.0;
-          double zK = (zD+zB)/2.0;
-
-          // Making sure points A..Q are on a sphere
-          project_on_sphere(radius,xA,yA,zA);
-          project_on_sphere(radius,xB,yB,zB);
-          project_on_sphere(radius,xC,yC,zC);
-          project_on_sphere(radius,xD,yD,zD);
-          project_on_sphere(radius,xE,yE,zE);
-          project_on_sphere(radius,xF,yF,zF);
-          project_on_sphere(radius,xG,yG,zG);
-          project_on_sphere(radius,xH,yH,zH);
-          project_on_sphere(radius,xJ,yJ,zJ);
-          project_on_sphere(radius,xK,yK,zK);
-          project_on_sphere(radius,xM,yM,zM);
-          project_on_sphere(radius,xN,yN,zN);
-          project_on_sphere(radius,xP,yP,zP);
-          project_on_sphere(radius,xQ,yQ,zQ);
-
-          lay_points(xM,yM,zM,xG,yG,zG,xA,yA,zA,xE,yE,zE,block_grid_x[0], block_grid_y[0], block_grid_z[0],block_grid_hull[0], n_cell_x);
-          lay_points(xF,yF,zF,xM,yM,zM,xE,yE,zE,xB,yB,zB,block_grid_x[1], block_grid_y[1], block_grid_z[1],block_grid_hull[1], n_cell_x);
-          lay_points(xC,yC,zC,xG,yG,zG,xM,yM,zM,xF,yF,zF,block_grid_x[2], block_grid_y[2], block_grid_z[2],block_grid_hull[2], n_cell_x);
-          lay_points(xG,yG,zG,xN,yN,zN,xJ,yJ,zJ,xA,yA,zA,block_grid_x[3], block_grid_y[3], block_grid_z[3],block_grid_hull[3], n_cell_x);
-          lay_points(xC,yC,zC,xH,yH,zH,xN,yN,zN,xG,yG,zG,block_grid_x[4], block_grid_y[4], block_grid_z[4],block_grid_hull[4], n_cell_x);
-          lay_points(xH,yH,zH,xD,yD,zD,xJ,yJ,zJ,xN,yN,zN,block_grid_x[5], block_grid_y[5], block_grid_z[5],block_grid_hull[5], n_cell_x);
-          lay_points(xA,yA,zA,xJ,yJ,zJ,xP,yP,zP,xE,yE,zE,block_grid_x[6], block_grid_y[6], block_grid_z[6],block_grid_hull[6], n_cell_x);
-          lay_points(xJ,yJ,zJ,xD,yD,zD,xK,yK,zK,xP,yP,zP,block_grid_x[7], block_grid_y[7], block_grid_z[7],block_grid_hull[7], n_cell_x);
-          lay_points(xP,yP,zP,xK,yK,zK,xB,yB,zB,xE,yE,zE,block_grid_x[8], block_grid_y[8], block_grid_z[8],block_grid_hull[8], n_cell_x);
-          lay_points(xQ,yQ,zQ,xK,yK,zK,xD,yD,zD,xH,yH,zH,block_grid_x[9], block_grid_y[9], block_grid_z[9],block_grid_hull[9], n_cell_x);
-          lay_points(xQ,yQ,zQ,xH,yH,zH,xC,yC,zC,xF,yF,zF,block_grid_x[10], block_grid_y[10], block_grid_z[10],block_grid_hull[10], n_cell_x);
-          lay_points(xQ,yQ,zQ,xF,yF,zF,xB,yB,zB,xK,yK,zK,block_grid_x[11], block_grid_y[11], block_grid_z[11],block_grid_hull[11], n_cell_x);
-
-          // make sure all points end up on a sphere
-          for (size_t i_block = 0; i_block < n_block; ++i_block)
-            {
-              for (size_t i_point = 0; i_point < block_n_p; ++i_point)
-                {
-                  project_on_sphere(radius,block_grid_x[i_block][i_point],block_grid_y[i_block][i_point],block_grid_z[i_block][i_point]);
-                }
-            }
+        std::vector<bool> double_points(n_block * block_n_p,false);
+        std::vector<size_t> point_to(n_block * block_n_p);
 
-          /**
-           * merge blocks
-           */
-          std::vector<double> temp_x(n_block * block_n_p);
-          std::vector<double> temp_y(n_block * block_n_p);
-          std::vector<double> temp_z(n_block * block_n_p);
-          std::vector<bool> sides(n_block * block_n_p);
+        for (size_t i = 0; i < n_block * block_n_p; ++i)
+          point_to[i] = i;
 
-          for (size_t i = 0; i < n_block; ++i)
-            {
-              size_t counter = 0;
-              for (size_t j = i * block_n_p; j < i * block_n_p + block_n_p; ++j)
-                {
-                  WBAssert(j < temp_x.size(), "j should be smaller then the size of the array temp_x.");
-                  WBAssert(j < temp_y.size(), "j should be smaller then the size of the array temp_y.");
-                  WBAssert(j < temp_z.size(), "j should be smaller then the size of the array temp_z.");
-                  temp_x[j] = block_grid_x[i][counter];
-                  temp_y[j] = block_grid_y[i][counter];
-                  temp_z[j] = block_grid_z[i][counter];
-                  sides[j] = block_grid_hull[i][counter];
-                  counter++;
-                }
-            }
+        // TODO: This becomes problematic with too large values of outer radius. Find a better way, maybe through an epsilon.
+        const double distance = 1e-12*outer_radius;
 
+        size_t counter = 0;
+        size_t amount_of_double_points = 0;
+        for (size_t i = 1; i < n_block * block_n_p; ++i)
+          {
+            if (sides[i])
+              {
+                const double gxip = temp_x[i];
+                const double gyip = temp_y[i];
+                const double gzip = temp_z[i];
+                for (size_t j = 0; j < i-1; ++j)
+                  {
+                    if (sides[j])
+                      {
+                        if (std::fabs(gxip-temp_x[j]) < distance &&
+                            std::fabs(gyip-temp_y[j]) < distance &&
+                            std::fabs(gzip-temp_z[j]) < distance)
+                          {
+                            double_points[i] = true;
+                            point_to[i] = j;
+                            amount_of_double_points++;
+                            break;
+                          }
+                      }
+                  }
+              }
+          }
 
-          std::vector<bool> double_points(n_block * block_n_p,false);
-          std::vector<size_t> point_to(n_block * block_n_p);
 
-          for (size_t i = 0; i < n_block * block_n_p; ++i)
-            point_to[i] = i;
+        const size_t shell_n_p = n_block * block_n_p - amount_of_double_points;
+        const size_t shell_n_cell = n_block * block_n_cell;
+        const size_t shell_n_v = block_n_v;
 
-          // TODO: This becomes problematic with too large values of outer radius. Find a better way, maybe through an epsilon.
-          const double distance = 1e-12*outer_radius;
+        std::vector<double> shell_grid_x(shell_n_p);
+        std::vector<double> shell_grid_y(shell_n_p);
+        std::vector<double> shell_grid_z(shell_n_p);
+        std::vector<size_t> shell_grid_connectivity(shell_n_cell*shell_n_v);
 
-          size_t counter = 0;
-          size_t amount_of_double_points = 0;
-          for (size_t i = 1; i < n_block * block_n_p; ++i)
-            {
-              if (sides[i])
-                {
-                  const double gxip = temp_x[i];
-                  const double gyip = temp_y[i];
-                  const double gzip = temp_z[i];
-                  for (size_t j = 0; j < i-1; ++j)
-                    {
-                      if (sides[j])
-                        {
-                          if (std::fabs(gxip-temp_x[j]) < distance &&
-                              std::fabs(gyip-temp_y[j]) < distance &&
-                              std::fabs(gzip-temp_z[j]) < distance)
-                            {
-                              double_points[i] = true;
-                              point_to[i] = j;
-                              amount_of_double_points++;
-                              break;
-                            }
-                        }
-                    }
-                }
-            }
+        counter = 0;
+        for (size_t i = 0; i < n_block * block_n_p; ++i)
+          {
+            if (!double_points[i])
+              {
+                shell_grid_x[counter] = fabs(temp_x[i]) < 1e-8 ? 0. : temp_x[i];
+                shell_grid_y[counter] = fabs(temp_y[i]) < 1e-8 ? 0. : temp_y[i];
+                shell_grid_z[counter] = fabs(temp_z[i]) < 1e-8 ? 0. : temp_z[i];
 
+                counter++;
+              }
+          }
 
-          const size_t shell_n_p = n_block * block_n_p - amount_of_double_points;
-          const size_t shell_n_cell = n_block * block_n_cell;
-          const size_t shell_n_v = block_n_v;
+        for (size_t i = 0; i < n_block; ++i)
+          {
+            counter = 0;
+            for (size_t j = i * block_n_cell; j < i * block_n_cell + block_n_cell; ++j)
+              {
+                for (size_t k = 0; k < shell_n_v; ++k)
+                  {
+                    shell_grid_connectivity[j*shell_n_v+k] = block_grid_connectivity[i][counter][k] + i * block_n_p;
+                  }
+                counter++;
+              }
+          }
 
-          std::vector<double> shell_grid_x(shell_n_p);
-          std::vector<double> shell_grid_y(shell_n_p);
-          std::vector<double> shell_grid_z(shell_n_p);
-          std::vector<std::vector<size_t> > shell_grid_connectivity(shell_n_cell,std::vector<size_t>(shell_n_v));
+        for (size_t &point : shell_grid_connectivity)
+          point = point_to[point];
 
-          counter = 0;
-          for (size_t i = 0; i < n_block * block_n_p; ++i)
-            {
-              if (!double_points[i])
-                {
-                  shell_grid_x[counter] = fabs(temp_x[i]) < 1e-8 ? 0. : temp_x[i];
-                  shell_grid_y[counter] = fabs(temp_y[i]) < 1e-8 ? 0. : temp_y[i];
-                  shell_grid_z[counter] = fabs(temp_z[i]) < 1e-8 ? 0. : temp_z[i];
+        std::vector<size_t> compact(n_block * block_n_p);
 
-                  counter++;
-                }
-            }
+        counter = 0;
+        for (size_t i = 0; i < n_block * block_n_p; ++i)
+          {
+            if (!double_points[i])
+              {
+                compact[i] = counter;
+                counter++;
+              }
+          }
 
-          for (size_t i = 0; i < n_block; ++i)
-            {
-              counter = 0;
-              for (size_t j = i * block_n_cell; j < i * block_n_cell + block_n_cell; ++j)
-                {
-                  for (size_t k = 0; k < shell_n_v; ++k)
-                    {
-                      shell_grid_connectivity[j][k] = block_grid_connectivity[i][counter][k] + i * block_n_p;
-                    }
-                  counter++;
-                }
-            }
 
-          for (size_t i = 0; i < shell_n_cell; ++i)
-            {
-              for (size_t j = 0; j < shell_n_v; ++j)
-                {
-                  shell_grid_connectivity[i][j] = point_to[shell_grid_connectivity[i][j]];
-                }
-            }
+        for (size_t &point : shell_grid_connectivity)
+          point = compact[point];
 
-          std::vector<size_t> compact(n_block * block_n_p);
 
-          counter = 0;
-          for (size_t i = 0; i < n_block * block_n_p; ++i)
-            {
-              if (!double_points[i])
-                {
-                  compact[i] = counter;
-                  counter++;
-                }
-            }
+        /**
+         * build hollow sphere out of n_cell_z + 1 copies of the shell, which
+         * are projected on the radius of their layer when a point is needed.
+         */
+        n_p = (n_cell_z + 1) * shell_n_p;
+        n_cell = (n_cell_z) * shell_n_cell;
 
+        const double dr = (outer_radius - inner_radius) / static_cast<double>(n_cell_z);
 
-          for (size_t i = 0; i < shell_n_cell; ++i)
+        compute_point = [ =,
+                          shell_grid_x = std::move(shell_grid_x),
+                          shell_grid_y = std::move(shell_grid_y),
+                          shell_grid_z = std::move(shell_grid_z)] (const size_t point, double *position, double &depth)
+        {
+          const size_t layer = point / shell_n_p;
+          const size_t shell_point = point % shell_n_p;
+          position[0] = shell_grid_x[shell_point];
+          position[1] = shell_grid_y[shell_point];
+          position[2] = shell_grid_z[shell_point];
+          project_on_sphere(inner_radius + dr * static_cast<double>(layer), position[0], position[1], position[2]);
+          depth = outer_radius - std::sqrt(position[0] * position[0] + position[1] * position[1] + position[2] * position[2]);
+          depth = (std::fabs(depth) < 1e-8 ? 0 : depth);
+        };
+
+        compute_cell = [ =,
+                         shell_grid_connectivity = std::move(shell_grid_connectivity)] (const size_t cell, size_t *vertices)
+        {
+          const size_t layer = cell / shell_n_cell;
+          const size_t shell_cell = cell % shell_n_cell;
+          for (size_t k = 0; k < shell_n_v; ++k)
             {
-              for (size_t j = 0; j < shell_n_v; ++j)
-                {
-                  shell_grid_connectivity[i][j] = compact[shell_grid_connectivity[i][j]];
-                }
+              vertices[k] = shell_grid_connectivity[shell_cell*shell_n_v+k] + layer * shell_n_p;
+              vertices[k+shell_n_v] = shell_grid_connectivity[shell_cell*shell_n_v+k] + (layer+1) * shell_n_p;
             }
+        };
+      }
+    else
+      {
+        WBAssertThrow(false, "Geometry type '" << grid_type << "' is not a valid geometry type. Valid geometry types are: "
+                      << "'cartesian', 'annulus', 'chunk' and 'sphere'. "
+                      << "Please note that the annulus can only be used in 2d and the sphere can only be used in 3d.");
+      }
 
+    // create paraview file.
+    progress << "[5/6] Preparing to write the paraview file...                                                   \r";
+    progress.flush();
 
-          /**
-           * build hollow sphere
-           */
+    const std::string base_filename = wb_file.substr(wb_file.find_last_of("/\\") + 1);
+    std::string::size_type  const p(base_filename.find_last_of('.'));
+    const std::string file_without_extension = base_filename.substr(0, p);
 
-          std::vector<double> temp_shell_grid_x(shell_n_p);
-          std::vector<double> temp_shell_grid_y(shell_n_p);
-          std::vector<double> temp_shell_grid_z(shell_n_p);
+    const std::stringstream buffer;
+    const std::ofstream myfile;
 
-          const size_t n_v = shell_n_v * 2;
-          n_p = (n_cell_z + 1) * shell_n_p;
-          n_cell = (n_cell_z) * shell_n_cell;
+    // Create tuples with (name, association, number of components) for each data set
+    std::vector<vtu11::DataSetInfo> dataSetInfo
+    {
+      { "Depth", vtu11::DataSetType::PointData, 1 },
+      { "Temperature", vtu11::DataSetType::PointData, 1 },
+      { "Tag", vtu11::DataSetType::PointData, 1 },
+    };
+    for (size_t c = 0; c < compositions; ++c)
+      {
+        dataSetInfo.emplace_back( "Composition "+std::to_string(c), vtu11::DataSetType::PointData, 1 );
+      }
 
-          grid_x.resize(n_p);
-          grid_y.resize(n_p);
-          grid_z.resize(n_p);
-          grid_depth.resize(n_p);
-          grid_connectivity.resize(n_cell,std::vector<size_t>(n_v));
+    std::vector<std::array<unsigned ,3>> properties;
+    properties.push_back({{1,0,0}}); // temperature
 
+    properties.push_back({{4,0,0}}); // tag
 
-          for (size_t i = 0; i < n_cell_z + 1; ++i)
-            {
-              temp_shell_grid_x = shell_grid_x;
-              temp_shell_grid_y = shell_grid_y;
-              temp_shell_grid_z = shell_grid_z;
+    for (unsigned int c = 0; c < compositions; ++c)
+      properties.push_back({{2,c,0}}); // composition c
 
-              // We do not need to copy the shell_grid_connectivity into a
-              // temperorary variable, because we do not change it. We can
-              // directly use it.
+    /**
+     * Compute the temperature, tag and compositions at the grid point with
+     * position @p position (in the layout of the vtu points) and depth
+     * @p depth, and store them at position @p index of the data sets in
+     * @p point_data.
+     */
+    const auto compute_properties = [&] (const double *position, const double depth, std::vector<vtu11::DataSetData> &point_data, const size_t index)
+    {
+      std::vector<double> output;
+      if (dim == 2)
+        output = world->properties(std::array<double,2> {{position[0], position[1]}}, depth, properties);
+      else
+        output = world->properties(std::array<double,3> {{position[0], position[1], position[2]}}, depth, properties);
 
-              radius = inner_radius + ((outer_radius - inner_radius) / static_cast<double>(n_cell_z)) * static_cast<double>(i);
-              for (size_t j = 0; j < shell_n_p; ++j)
-                {
-                  WBAssert(j < temp_shell_grid_x.size(), "ERROR: j = " << j << ", temp_shell_grid_x.size() = " << temp_shell_grid_x.size());
-                  WBAssert(j < temp_shell_grid_y.size(), "ERROR: j = " << j << ", temp_shell_grid_y.size() = " << temp_shell_grid_y.size());
-                  WBAssert(j < temp_shell_grid_z.size(), "ERROR: j = " << j << ", temp_shell_grid_z.size() = " << temp_shell_grid_z.size());
-                  project_on_sphere(radius, temp_shell_grid_x[j], temp_shell_grid_y[j], temp_shell_grid_z[j]);
-                }
+      point_data[1][index] = output[0];
+      point_data[2][index] = output[1];
+      for (size_t c = 0; c < compositions; ++c)
+        {
+          point_data[3+c][index] = output[2+c];
+        }
+    };
 
-              const size_t i_beg =  i * shell_n_p;
-              const size_t i_end = (i+1) * shell_n_p;
-              counter = 0;
-              for (size_t j = i_beg; j < i_end; ++j)
-                {
-                  WBAssert(j < grid_x.size(), "ERROR: j = " << j << ", grid_x.size() = " << grid_x.size());
-                  WBAssert(j < grid_y.size(), "ERROR: j = " << j << ", grid_y.size() = " << grid_y.size());
-                  WBAssert(j < grid_z.size(), "ERROR: j = " << j << ", grid_z.size() = " << grid_z.size());
-                  grid_x[j] = temp_shell_grid_x[counter];
-                  grid_y[j] = temp_shell_grid_y[counter];
-                  grid_z[j] = temp_shell_grid_z[counter];
-                  grid_depth[j] = outer_radius - std::sqrt(grid_x[j] * grid_x[j] + grid_y[j] * grid_y[j] + grid_z[j] * grid_z[j]);
-                  grid_depth[j] = (std::fabs(grid_depth[j]) < 1e-8 ? 0 : grid_depth[j]);
-
-                  counter++;
-                }
-            }
+    /**
+     * Write a mesh either to the file name.vtu, or as piece @p piece of the
+     * parallel file name.pvtu.
+     */
+    const auto write_vtu = [&] (const std::string &name,
+                                vtu11::Vtu11UnstructuredMesh &mesh,
+                                const std::vector<vtu11::DataSetData> &output_data,
+                                const size_t piece)
+    {
+      if (output_pvtu)
+        vtu11::writePartition( ".", name, mesh, dataSetInfo, output_data, piece, vtu_output_format );
+      else
+        vtu11::writeVtu( name + ".vtu", mesh, dataSetInfo, output_data, vtu_output_format );
+    };
+
+    /**
+     * Write a mesh, and if requested the filtered mesh and the mesh of
+     * every tag.
+     */
+    const auto write_outputs = [&] (vtu11::Vtu11UnstructuredMesh &mesh,
+                                    const std::vector<vtu11::DataSetData> &output_data,
+                                    const size_t piece)
+    {
+      write_vtu(file_without_extension, mesh, output_data, piece);
 
-          for (size_t i = 0; i < n_cell_z; ++i)
+      if (output_filtered)
+        {
+          std::vector<bool> include_tag(world->feature_tags.size(), true);
+          for (unsigned int idx = 0; idx<include_tag.size(); ++idx)
             {
-              const size_t i_beg = i * shell_n_cell;
-              const size_t i_end = (i+1) * shell_n_cell;
-              counter = 0;
-              for (size_t j = i_beg; j < i_end; ++j)
-                {
-                  for (size_t k = 0; k < shell_n_v; ++k)
-                    {
-                      grid_connectivity[j][k] = shell_grid_connectivity[counter][k] + i * shell_n_p;
-                    }
-                  counter++;
-                }
+              if (world->feature_tags[idx]=="mantle layer")
+                include_tag[idx] = false;
+            }
+          std::vector<double> filtered_points;
+          std::vector<vtu11::VtkIndexType> filtered_connectivity;
+          std::vector<vtu11::VtkIndexType> filtered_offsets;
+          std::vector<vtu11::VtkCellType> filtered_types;
 
+          vtu11::Vtu11UnstructuredMesh filtered_mesh {filtered_points, filtered_connectivity, filtered_offsets, filtered_types};
+          std::vector<vtu11::DataSetData> filtered_data_set;
 
-              counter = 0;
-              for (size_t j = i_beg; j < i_end; ++j)
-                {
-                  for (size_t k = shell_n_v ; k < 2 * shell_n_v; ++k)
-                    {
-                      WBAssert(k-shell_n_v < shell_grid_connectivity[counter].size(), "k - shell_n_v is larger then shell_grid_connectivity[counter]: k= " << k << ", shell_grid_connectivity[counter].size() = " << shell_grid_connectivity[counter].size());
-                      grid_connectivity[j][k] = shell_grid_connectivity[counter][k-shell_n_v] + (i+1) * shell_n_p;
-                    }
-                  counter++;
-                }
-            }
-        }
-      else
-        {
-          WBAssertThrow(false, "Geometry type '" << grid_type << "' is not a valid geometry type. Valid geometry types are: "
-                        << "'cartesian', 'annulus', 'chunk' and 'sphere'. "
-                        << "Please note that the annulus can only be used in 2d and the sphere can only be used in 3d.");
+          filter_vtu_mesh(static_cast<int>(dim), include_tag, mesh, output_data, filtered_mesh, filtered_data_set);
+          write_vtu(file_without_extension + ".filtered", filtered_mesh, filtered_data_set, piece);
         }
 
-      // create paraview file.
-      std::cout << "[5/6] Preparing to write the paraview file...                                                   \r";
-      std::cout.flush();
+      if (output_by_tag)
+        {
+          for (unsigned int idx = 0; idx<world->feature_tags.size(); ++idx)
+            {
+              if (world->feature_tags[idx]=="mantle layer")
+                continue;
 
-      const std::string base_filename = wb_file.substr(wb_file.find_last_of("/\\") + 1);
-      std::string::size_type  const p(base_filename.find_last_of('.'));
-      const std::string file_without_extension = base_filename.substr(0, p);
+              std::vector<double> filtered_points;
+              std::vector<vtu11::VtkIndexType> filtered_connectivity;
+              std::vector<vtu11::VtkIndexType> filtered_offsets;
+              std::vector<vtu11::VtkCellType> filtered_types;
 
-      const std::stringstream buffer;
-      const std::ofstream myfile;
+              vtu11::Vtu11UnstructuredMesh filtered_mesh {filtered_points, filtered_connectivity, filtered_offsets, filtered_types};
+              std::vector<vtu11::DataSetData> filtered_data_set;
 
-      std::cout << "[5/6] Preparing to write the paraview file: stage 1 of 6, converting the points                              \r";
-      std::cout.flush();
-      std::vector<double> points(grid_x.size()*3, 0.0);
-      if (dim == 2)
-        for (size_t i = 0; i < n_p; ++i)
-          {
-            points[i*3] = grid_x[i];
-            points[i*3+1] = grid_z[i];
-            // third one is zero
-          }
-      else
-        {
-          for (size_t i = 0; i < n_p; ++i)
-            {
-              points[i*3] = grid_x[i];
-              points[i*3+1] = grid_y[i];
-              points[i*3+2] = grid_z[i];
+              std::vector<bool> include_tag(world->feature_tags.size(), false);
+              include_tag[idx]=true;
+              filter_vtu_mesh(static_cast<int>(dim), include_tag, mesh, output_data, filtered_mesh, filtered_data_set);
+              write_vtu(file_without_extension + "." + std::to_string(idx), filtered_mesh, filtered_data_set, piece);
             }
         }
-      std::cout << "[5/6] Preparing to write the paraview file: stage 2 of 6, converting the connectivity                              \r";
-      std::cout.flush();
-      const size_t pow_2_dim = dim == 2 ? 4 : 8;
-      std::vector<vtu11::VtkIndexType> connectivity(n_cell*pow_2_dim);
-      if (dim == 2)
+    };
+
+    if (!output_pvtu)
+      {
+        progress << "[5/6] Preparing to write the paraview file: stage 1 of 4, computing the points                              \r";
+        progress.flush();
+        std::vector<double> points(n_p*3);
+        std::vector<vtu11::DataSetData> data_set(3+compositions, vtu11::DataSetData(n_p));
+        for (size_t i = 0; i < n_p; ++i)
+          compute_point(i, &points[i*3], data_set[0][i]);
+
+        progress << "[5/6] Preparing to write the paraview file: stage 2 of 4, computing the connectivity                              \r";
+        progress.flush();
+        std::vector<size_t> cell_vertices(pow_2_dim);
+        std::vector<vtu11::VtkIndexType> connectivity(n_cell*pow_2_dim);
         for (size_t i = 0; i < n_cell; ++i)
           {
-            connectivity[i*pow_2_dim] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][0]);
-            connectivity[i*pow_2_dim+1] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][1]);
-            connectivity[i*pow_2_dim+2] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][2]);
-            connectivity[i*pow_2_dim+3] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][3]);
+            compute_cell(i, cell_vertices.data());
+            for (size_t v = 0; v < pow_2_dim; ++v)
+              connectivity[i*pow_2_dim+v] = static_cast<vtu11::VtkIndexType>(cell_vertices[v]);
           }
-      else
-        for (size_t i = 0; i < n_cell; ++i)
-          {
 
-            connectivity[i*pow_2_dim] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][0]);
-            connectivity[i*pow_2_dim+1] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][1]);
-            connectivity[i*pow_2_dim+2] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][2]);
-            connectivity[i*pow_2_dim+3] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][3]);
-            connectivity[i*pow_2_dim+4] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][4]);
-            connectivity[i*pow_2_dim+5] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][5]);
-            connectivity[i*pow_2_dim+6] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][6]);
-            connectivity[i*pow_2_dim+7] = static_cast<vtu11::VtkIndexType>(grid_connectivity[i][7]);
-          }
-      std::cout << "[5/6] Preparing to write the paraview file: stage 3 of 6, creating the offsets                              \r";
-      std::cout.flush();
-      std::vector<vtu11::VtkIndexType> offsets(n_cell);
-      if (dim == 2)
-        for (size_t i = 0; i < n_cell; ++i)
-          offsets[i] = static_cast<vtu11::VtkIndexType>((i+1) * 4);
-      else
+        progress << "[5/6] Preparing to write the paraview file: stage 3 of 4, creating the offsets                              \r";
+        progress.flush();
+        std::vector<vtu11::VtkIndexType> offsets(n_cell);
         for (size_t i = 0; i < n_cell; ++i)
-          offsets[i] = static_cast<vtu11::VtkIndexType>((i+1) * 8);
+          offsets[i] = static_cast<vtu11::VtkIndexType>((i+1) * pow_2_dim);
 
-      std::cout << "[5/6] Preparing to write the paraview file: stage 4 of 6, creating the Data set info                              \r";
-      std::cout.flush();
-      std::vector<vtu11::VtkCellType> types(n_cell, dim == 2 ? 9 : 12);
+        std::vector<vtu11::VtkCellType> types(n_cell, dim == 2 ? 9 : 12);
 
-      // Create tuples with (name, association, number of components) for each data set
-      std::vector<vtu11::DataSetInfo> dataSetInfo
-      {
-        { "Depth", vtu11::DataSetType::PointData, 1 },
-        { "Temperature", vtu11::DataSetType::PointData, 1 },
-        { "Tag", vtu11::DataSetType::PointData, 1 },
-      };
-      for (size_t c = 0; c < compositions; ++c)
-        {
-          dataSetInfo.emplace_back( "Composition "+std::to_string(c), vtu11::DataSetType::PointData, 1 );
-        }
+        progress << "[5/6] Preparing to write the paraview file: stage 4 of 4, computing the properties                              \r";
+        progress.flush();
 
-      std::cout << "[5/6] Preparing to write the paraview file: stage 5 of 5, computing the properties                              \r";
-      std::cout.flush();
-
-      std::vector<std::array<unsigned ,3>> properties;
-      properties.push_back({{1,0,0}}); // temperature
+        pool.parallel_for(0, n_p, [&] (size_t i)
+        {
+          compute_properties(&points[i*3], data_set[0][i], data_set, i);
+        });
 
-      properties.push_back({{4,0,0}}); // tag
+        progress << "[6/6] Writing the paraview file                                                                                \r";
+        progress.flush();
 
-      for (unsigned int c = 0; c < compositions; ++c)
-        properties.push_back({{2,c,0}}); // composition c
+        vtu11::Vtu11UnstructuredMesh mesh { points, connectivity, offsets, types };
+        write_outputs(mesh, data_set, 0);
+      }
+    else
+      {
+        /**
+         * Every process takes a contiguous range of cells, which is split
+         * into pieces of at most max_cells_per_piece cells. For every piece
+         * only the cells and points of that piece are computed and
+         * evaluated, and all of its arrays are freed after the piece is
+         * written and before the next one is started. This way the
+         * evaluation is distributed over all processes, and the memory
+         * needed by every process only depends on the size of a piece and
+         * not on the size of the whole grid. Points on the boundary between
+         * two pieces are evaluated and stored in both pieces.
+         */
+        const size_t n_processes = static_cast<size_t>(MPI_SIZE);
+        const size_t cells_per_process = (n_cell + n_processes - 1) / n_processes;
+        const size_t pieces_per_process = max_cells_per_piece == 0
+                                          ?
+                                          1
+                                          :
+                                          std::max(static_cast<size_t>(1), (cells_per_process + max_cells_per_piece - 1) / max_cells_per_piece);
+        const size_t n_pieces = n_processes * pieces_per_process;
+        const size_t cells_per_piece = (n_cell + n_pieces - 1) / n_pieces;
+
+        // The first process writes the .pvtu files, which also creates the
+        // directories that all processes write their pieces into.
+        if (MPI_RANK == 0)
+          {
+            vtu11::writePVtu( ".", file_without_extension, dataSetInfo, n_pieces );
 
+            if (output_filtered)
+              vtu11::writePVtu( ".", file_without_extension + ".filtered", dataSetInfo, n_pieces );
 
-      // compute temperature
-      std::vector<vtu11::DataSetData> data_set(3+compositions);
-      data_set[0] = grid_depth;
-      data_set[1].resize(n_p);
-      data_set[2].resize(n_p);
-      for (size_t c = 0; c < compositions; ++c)
-        data_set[3+c].resize(n_p);
+            if (output_by_tag)
+              for (unsigned int idx = 0; idx<world->feature_tags.size(); ++idx)
+                if (world->feature_tags[idx]!="mantle layer")
+                  vtu11::writePVtu( ".", file_without_extension + "." + std::to_string(idx), dataSetInfo, n_pieces );
+          }
+#ifdef WB_WITH_MPI
+        MPI_Barrier(MPI_COMM_WORLD);
+#endif
 
-      if (dim == 2)
-        {
-          pool.parallel_for(0, n_p, [&] (size_t i)
+        const size_t first_piece = static_cast<size_t>(MPI_RANK) * pieces_per_process;
+        for (size_t piece = first_piece; piece < first_piece + pieces_per_process; ++piece)
           {
-            const std::array<double,2> coords = {{grid_x[i], grid_z[i]}};
-            std::vector<double> output = world->properties(coords, grid_depth[i],properties);
-            data_set[1][i] = output[0];
-            data_set[2][i] = output[1];
-            for (size_t c = 0; c < compositions; ++c)
-              {
-                data_set[3+c][i] = output[2+c];
-              }
-          });
-        }
-      else
-        {
-          pool.parallel_for(0, n_p, [&] (size_t i)
-          {
-            const std::array<double,3> coords = {{grid_x[i], grid_y[i], grid_z[i]}};
-            std::vector<double> output = world->properties(coords, grid_depth[i],properties);
-            data_set[1][i] = output[0];
-            data_set[2][i] = output[1];
-            for (size_t c = 0; c < compositions; ++c)
-              {
-                data_set[3+c][i] = output[2+c];
-              }
-          });
-        }
-      std::cout << "[6/6] Writing the paraview file                                                                                \r";
-      std::cout.flush();
+            progress << "[5/6] Computing and writing piece " << piece - first_piece + 1 << " of " << pieces_per_process
+                     << " on every process                              \r";
+            progress.flush();
+
+            const size_t first_cell = std::min(piece * cells_per_piece, n_cell);
+            const size_t end_cell = std::min(first_cell + cells_per_piece, n_cell);
+            const size_t n_piece_cells = end_cell - first_cell;
+
+            // Compute the cells of this piece and renumber their points in
+            // the order in which they are first used.
+            std::vector<size_t> piece_points;
+            std::vector<vtu11::VtkIndexType> connectivity(n_piece_cells*pow_2_dim);
+            {
+              std::vector<size_t> cell_vertices(n_piece_cells*pow_2_dim);
+              for (size_t cell = first_cell; cell < end_cell; ++cell)
+                compute_cell(cell, &cell_vertices[(cell-first_cell)*pow_2_dim]);
 
-      {
-        vtu11::Vtu11UnstructuredMesh mesh { points, connectivity, offsets, types };
-        vtu11::writeVtu( file_without_extension + ".vtu", mesh, dataSetInfo, data_set, vtu_output_format );
+              std::unordered_map<size_t,size_t> local_point_index;
+              local_point_index.reserve(cell_vertices.size());
+              for (size_t i = 0; i < cell_vertices.size(); ++i)
+                {
+                  const auto inserted = local_point_index.emplace(cell_vertices[i], piece_points.size());
+                  if (inserted.second)
+                    piece_points.push_back(cell_vertices[i]);
+                  connectivity[i] = static_cast<vtu11::VtkIndexType>(inserted.first->second);
+                }
+            }
 
-        if (output_filtered)
-          {
-            std::vector<bool> include_tag(world->feature_tags.size(), true);
-            for (unsigned int idx = 0; idx<include_tag.size(); ++idx)
-              {
-                if (world->feature_tags[idx]=="mantle layer")
-                  include_tag[idx] = false;
-              }
-            std::vector<double> filtered_points;
-            std::vector<vtu11::VtkIndexType> filtered_connectivity;
-            std::vector<vtu11::VtkIndexType> filtered_offsets;
-            std::vector<vtu11::VtkCellType> filtered_types;
+            std::vector<vtu11::VtkIndexType> offsets(n_piece_cells);
+            for (size_t i = 0; i < n_piece_cells; ++i)
+              offsets[i] = static_cast<vtu11::VtkIndexType>((i+1) * pow_2_dim);
 
-            vtu11::Vtu11UnstructuredMesh filtered_mesh {filtered_points, filtered_connectivity, filtered_offsets, filtered_types};
-            std::vector<vtu11::DataSetData> filtered_data_set;
+            std::vector<vtu11::VtkCellType> types(n_piece_cells, dim == 2 ? 9 : 12);
 
-            filter_vtu_mesh(static_cast<int>(dim), include_tag, mesh, data_set, filtered_mesh, filtered_data_set);
-            vtu11::writeVtu( file_without_extension + ".filtered.vtu", filtered_mesh, dataSetInfo, filtered_data_set, vtu_output_format );
-          }
+            const size_t n_piece_points = piece_points.size();
+            std::vector<double> points(n_piece_points*3);
+            std::vector<vtu11::DataSetData> data_set(3+compositions, vtu11::DataSetData(n_piece_points));
+            for (size_t i = 0; i < n_piece_points; ++i)
+              compute_point(piece_points[i], &points[i*3], data_set[0][i]);
 
-        if (output_by_tag)
-          {
-            for (unsigned int idx = 0; idx<world->feature_tags.size(); ++idx)
-              {
-                if (world->feature_tags[idx]=="mantle layer")
-                  continue;
-
-                std::vector<double> filtered_points;
-                std::vector<vtu11::VtkIndexType> filtered_connectivity;
-                std::vector<vtu11::VtkIndexType> filtered_offsets;
-                std::vector<vtu11::VtkCellType> filtered_types;
-
-                vtu11::Vtu11UnstructuredMesh filtered_mesh {filtered_points, filtered_connectivity, filtered_offsets, filtered_types};
-                std::vector<vtu11::DataSetData> filtered_data_set;
-
-                std::vector<bool> include_tag(world->feature_tags.size(), false);
-                include_tag[idx]=true;
-                filter_vtu_mesh(static_cast<int>(dim), include_tag, mesh, data_set, filtered_mesh, filtered_data_set);
-                const std::string filename = file_without_extension + "."+ std::to_string(idx)+".vtu";
-                vtu11::writeVtu( filename, filtered_mesh, dataSetInfo, filtered_data_set, vtu_output_format );
-              }
+            pool.parallel_for(0, n_piece_points, [&] (size_t i)
+            {
+              compute_properties(&points[i*3], data_set[0][i], data_set, i);
+            });
+
+            vtu11::Vtu11UnstructuredMesh mesh { points, connectivity, offsets, types };
+            write_outputs(mesh, data_set, piece);
           }
       }
-      std::cout << "                                                                                                               \r";
-      std::cout.flush();
-    }
+    progress << "                                                                                                               \r";
+    progress.flush();
+  }
 
 #ifdef WB_WITH_MPI
   MPI_Finalize();
@@ -427,6 +427,14 @@ namespace WorldBuilder
     }
 
 
+    bool
+    Fault::get_bounding_box_of_influence(BoundingBox<2> &bounding_box) const
+    {
+      bounding_box = get_surface_bounding_box();
+      return true;
+    }
+
+
     void
     Fault::properties(const Point<3> &position_in_cartesian_coordinates,
                       const Objects::NaturalCoordinate &position_in_natural_coordinates,
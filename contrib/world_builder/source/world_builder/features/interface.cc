@@ -204,6 +204,41 @@ namespace WorldBuilder
       WBAssertThrow(false, "The distance_to_feature_plane is not yet implemented for the desinated object");
     }
 
+
+
+    bool
+    Interface::get_bounding_box_of_influence(BoundingBox<2> & /*unused*/) const
+    {
+      return false;
+    }
+
+
+    BoundingBox<2>
+    Interface::get_coordinates_bounding_box() const
+    {
+      WBAssert(!coordinates.empty(), "Internal error: Can not compute the bounding box of a feature without coordinates.");
+
+      const CoordinateSystem coordinate_system = world->parameters.coordinate_system->natural_coordinate_system();
+      Point<2> min_point(std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), coordinate_system);
+      Point<2> max_point(-std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), coordinate_system);
+      for (const Point<2> &coordinate : coordinates)
+        for (unsigned int d = 0; d < 2; ++d)
+          {
+            min_point[d] = std::min(min_point[d], coordinate[d]);
+            max_point[d] = std::max(max_point[d], coordinate[d]);
+          }
+
+      // The point in polygon test considers points on the boundary of the polygon
+      // to be inside up to a small tolerance, so enlarge the box accordingly.
+      const double max_coordinate = std::max({std::fabs(min_point[0]), std::fabs(min_point[1]),
+                                              std::fabs(max_point[0]), std::fabs(max_point[1])
+                                             });
+      BoundingBox<2> bounding_box(std::make_pair(min_point, max_point));
+      bounding_box.extend(1e-10 * (1. + max_coordinate));
+
+      return bounding_box;
+    }
+
   } // namespace Features
 } // namespace WorldBuilder
 
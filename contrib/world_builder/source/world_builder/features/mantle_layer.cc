@@ -161,6 +161,14 @@ namespace WorldBuilder
     }
 
 
+    bool
+    MantleLayer::get_bounding_box_of_influence(BoundingBox<2> &bounding_box) const
+    {
+      bounding_box = get_coordinates_bounding_box();
+      return true;
+    }
+
+
     void
     MantleLayer::properties(const Point<3> &position_in_cartesian_coordinates,
                             const Objects::NaturalCoordinate &position_in_natural_coordinates,
@@ -452,6 +452,14 @@ namespace WorldBuilder
     }
 
 
+    bool
+    SubductingPlate::get_bounding_box_of_influence(BoundingBox<2> &bounding_box) const
+    {
+      bounding_box = get_surface_bounding_box();
+      return true;
+    }
+
+
     void
     SubductingPlate::properties(const Point<3> &position_in_cartesian_coordinates,
                                 const Objects::NaturalCoordinate &position_in_natural_coordinates,
@@ -163,6 +163,52 @@ namespace WorldBuilder
                 }
             }
         }
+
+      // Store the bounding box of the control points of every segment and add a few
+      // samples of every segment to the KD-tree. Closest points are accepted up to a
+      // parametric distance of 1e-8 outside of the segment, where the curve can
+      // leave the convex hull by at most 3e-8 times the size of the hull, so the
+      // boxes are enlarged by more than that.
+      bounding_boxes.resize(n_points-1, {{p[0],p[0]}});
+      std::vector<KDTree::Node> node_list;
+      const size_t n_samples_per_segment = 4;
+      node_list.reserve((n_points-1)*n_samples_per_segment);
+      for (size_t cp_i = 0; cp_i < n_points-1; ++cp_i)
+        {
+          const std::array<Point<2>,4> hull = {{points[cp_i], control_points[cp_i][0], control_points[cp_i][1], points[cp_i+1]}};
+          Point<2> lower_corner = hull[0];
+          Point<2> upper_corner = hull[0];
+          for (const auto &hull_point : hull)
+            for (size_t d = 0; d < 2; ++d)
+              {
+                lower_corner[d] = std::min(lower_corner[d], hull_point[d]);
+                upper_corner[d] = std::max(upper_corner[d], hull_point[d]);
+              }
+          const double margin = 1e-6*((upper_corner[0]-lower_corner[0])+(upper_corner[1]-lower_corner[1]));
+          for (size_t d = 0; d < 2; ++d)
+            {
+              lower_corner[d] -= margin;
+              upper_corner[d] += margin;
+            }
+          bounding_boxes[cp_i] = {{lower_corner, upper_corner}};
+
+          for (size_t sample_i = 0; sample_i < n_samples_per_segment; ++sample_i)
+            {
+              const Point<2> sample = (*this)(cp_i, (static_cast<double>(sample_i)+0.5)/static_cast<double>(n_samples_per_segment));
+              node_list.emplace_back(cp_i, sample[0], sample[1]);
+            }
+        }
+      sample_tree = KDTree::KDTree(node_list);
+      sample_tree.create_tree(0, node_list.size()-1, false);
+    }
+
+
+    double
+    BezierCurve::squared_distance_to_bounding_box(const Point<2> &p, const size_t i) const
+    {
+      const double dx = std::max(0.,std::max(bounding_boxes[i][0][0]-p[0],p[0]-bounding_boxes[i][1][0]));
+      const double dy = std::max(0.,std::max(bounding_boxes[i][0][1]-p[1],p[1]-bounding_boxes[i][1][1]));
+      return dx*dx+dy*dy;
     }
 
 
@@ -184,8 +230,31 @@ namespace WorldBuilder
       double min_squared_distance = std::numeric_limits<double>::infinity();
       if (check_point.get_coordinate_system() == CoordinateSystem::cartesian)
         {
-          for ( size_t cp_i = 0; cp_i < control_points.size(); ++cp_i)
+          // First find the segment which most likely contains the closest point through the
+          // KD-tree of curve samples, and compute the distance to it (loop_i = 0). All other
+          // segments are then visited in their normal order, but the Newton iteration is
+          // skipped for segments whose bounding box is further away than the closest point
+          // found so far or the candidate point, since they can not contain a closer point.
+          // Segments which could be closer are still visited in order, so the same segment
+          // as without this search is found when several segments are equally close.
+          const size_t n_segments = control_points.size();
+          const size_t candidate_segment = n_segments > 1
+                                           ?
+                                           sample_tree.get_nodes()[sample_tree.find_closest_point(check_point).index].index
+                                           :
+                                           n_segments;
+          double candidate_est = NaN::DSNAN;
+          double candidate_squared_distance = std::numeric_limits<double>::infinity();
+
+          for (size_t loop_i = candidate_segment < n_segments ? 0 : 1; loop_i <= n_segments; ++loop_i)
             {
+              const bool is_candidate_search = loop_i == 0;
+              const size_t cp_i = is_candidate_search ? candidate_segment : loop_i-1;
+
+              if (!is_candidate_search && cp_i != candidate_segment
+                  && squared_distance_to_bounding_box(check_point, cp_i) > std::min(min_squared_distance, candidate_squared_distance))
+                continue;
+
 #ifndef NDEBUG
               std::stringstream output;
 #endif
@@ -202,6 +271,13 @@ namespace WorldBuilder
               double est =  P2P2_dot > 0.0 ? std::min(1.,std::max(0.,(P1Pc*P1P2) / P2P2_dot)) : 1.0; // est=estimate of solution
               bool found = false;
 
+              // the Newton iteration for the candidate segment has already been done
+              if (!is_candidate_search && cp_i == candidate_segment)
+                {
+                  est = candidate_est;
+                  found = true;
+                }
+
               // based on https://stackoverflow.com/questions/2742610/closest-point-on-a-cubic-bezier-curve
               const double a_0 = 3.*control_points[cp_i][0][0]-3.*control_points[cp_i][1][0]+points[cp_i+1][0]-points[cp_i][0];
               const double a_1 = 3.*control_points[cp_i][0][1]-3.*control_points[cp_i][1][1]+points[cp_i+1][1]-points[cp_i][1];
@@ -221,7 +297,7 @@ namespace WorldBuilder
               double min_squared_distance_cartesian_temp_dg = (estimate_point_min_cp_0_dg*estimate_point_min_cp_0_dg)+(estimate_point_min_cp_1_dg*estimate_point_min_cp_1_dg);
 #endif
 
-              for (size_t newton_i = 0; newton_i < 150; newton_i++)
+              for (size_t newton_i = 0; newton_i < 150 && !found; newton_i++)
                 {
 #ifndef NDEBUG
                   output << "  wolfram alpha: (" << a_0 << "*x^3+" << b_0 << "*x^2+"<< c_0 << "*x+" << d_0 << "-" << cp[0] << ")^2+(" << a_1 << "*x^3+" << b_1 << "*x^2+"<< c_1 << "*x+" << d_1 << "-" << cp[1] << ")^2 with x=" << est << std::endl;
@@ -311,6 +387,14 @@ namespace WorldBuilder
               const double est_min_cp_end_0 = a_0*est*est*est+b_0*est*est+c_0*est+d_min_cp_0;
               const double est_min_cp_end_1 = a_1*est*est*est+b_1*est*est+c_1*est+d_min_cp_1;
               const double min_squared_distance_temp = (est_min_cp_end_0*est_min_cp_end_0)+(est_min_cp_end_1*est_min_cp_end_1);
+              if (is_candidate_search)
+                {
+                  candidate_est = est;
+                  if (est >= -1e-8 && static_cast<double>(cp_i)+est > 0 && est-1. <= 1e-8 && est-1. < static_cast<double>(cp_i))
+                    candidate_squared_distance = min_squared_distance_temp;
+                  continue;
+                }
+
               if (min_squared_distance_temp < min_squared_distance)
                 {
                   if (est >= -1e-8 && static_cast<double>(cp_i)+est > 0 && est-1. <= 1e-8 && est-1. < static_cast<double>(cp_i))
@@ -41,7 +41,12 @@
 #include "rapidjson/latexwriter.h"
 #include "rapidjson/mystwriter.h"
 #include "rapidjson/prettywriter.h"
+#include "rapidjson/writer.h"
 
+#include "world_builder/config.h"
+
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <memory>
 
@@ -49,6 +54,45 @@ using namespace rapidjson;
 
 namespace
 {
+  /**
+   * The first bytes of every snapshot file, a mark which reads differently
+   * on machines with a different byte order, and the version of the snapshot
+   * format, which has to be increased whenever the layout changes.
+   */
+  const std::string snapshot_magic = "GWBSNAP";
+  const std::uint32_t snapshot_byte_order_mark = 0x01020304;
+  const std::uint32_t snapshot_format_version = 2;
+
+  /**
+   * A string that identifies the World Builder version that wrote a
+   * snapshot. The declarations stored in a snapshot are only valid for this
+   * exact version.
+   */
+  std::string snapshot_world_builder_version()
+  {
+    return WorldBuilder::Version::MAJOR + "." + WorldBuilder::Version::MINOR + "." + WorldBuilder::Version::PATCH
+           + WorldBuilder::Version::LABEL + " " + WorldBuilder::Version::GIT_SHA1;
+  }
+
+  void write_snapshot_block(std::ofstream &file, const std::string &block)
+  {
+    const std::uint64_t size = block.size();
+    file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    file.write(block.data(), static_cast<std::streamsize>(size));
+  }
+
+  std::string read_snapshot_block(const std::string &content, size_t &position)
+  {
+    std::uint64_t size = 0;
+    WBAssertThrow(position + sizeof(size) <= content.size(), "The World Builder parameter snapshot is truncated.");
+    std::memcpy(&size, content.data() + position, sizeof(size));
+    position += sizeof(size);
+    WBAssertThrow(size <= content.size() - position, "The World Builder parameter snapshot is truncated.");
+    const std::string block = content.substr(position, static_cast<size_t>(size));
+    position += static_cast<size_t>(size);
+    return block;
+  }
+
   void remove_key(rapidjson::Value &value, const char *key)
   {
     if (value.IsObject())
@@ -82,7 +126,14 @@ namespace WorldBuilder
 
   void Parameters::initialize(std::string &filename, bool has_output_dir, const std::string &output_dir)
   {
+    initialize_from_content(WorldBuilder::Utilities::read_and_distribute_file_content(filename), filename, has_output_dir, output_dir);
+  }
 
+  void Parameters::initialize_from_content(const std::string &file_content,
+                                           const std::string &filename,
+                                           bool has_output_dir,
+                                           const std::string &output_dir)
+  {
     if (has_output_dir)
       {
         StringBuffer buffer;
@@ -132,9 +183,9 @@ namespace WorldBuilder
       }
 
     path_level =0;
-    // Now read in the world builder file into a stringstream and
+    // Now put the content of the world builder file into a stringstream and
     // put it into a the rapidjson document
-    std::stringstream json_input_stream(WorldBuilder::Utilities::read_and_distribute_file_content(filename));
+    std::stringstream json_input_stream(file_content);
     rapidjson::IStreamWrapper isw(json_input_stream);
 
     // relaxing syntax by allowing comments () for now, maybe also allow trailing commas and (kParseTrailingCommasFlag) and nan's, inf etc (kParseNanAndInfFlag)?
@@ -188,6 +239,75 @@ namespace WorldBuilder
       }
   }
 
+  bool
+  Parameters::is_parameter_snapshot(const std::string &file_content)
+  {
+    return file_content.compare(0, snapshot_magic.size(), snapshot_magic) == 0;
+  }
+
+  void
+  Parameters::write_parameter_snapshot(const std::string &filename) const
+  {
+    StringBuffer declarations_buffer;
+    Writer<StringBuffer, UTF8<>, UTF8<>, CrtAllocator, kWriteNanAndInfFlag> declarations_writer(declarations_buffer);
+    declarations.Accept(declarations_writer);
+
+    StringBuffer parameters_buffer;
+    Writer<StringBuffer, UTF8<>, UTF8<>, CrtAllocator, kWriteNanAndInfFlag> parameters_writer(parameters_buffer);
+    parameters.Accept(parameters_writer);
+
+    std::ofstream file(filename, std::ios::binary);
+    WBAssertThrow(file.is_open(), "Error: Could not open file '" + filename + "' for writing the World Builder parameter snapshot.");
+
+    file.write(snapshot_magic.data(), static_cast<std::streamsize>(snapshot_magic.size()));
+    file.write(reinterpret_cast<const char *>(&snapshot_byte_order_mark), sizeof(snapshot_byte_order_mark));
+    file.write(reinterpret_cast<const char *>(&snapshot_format_version), sizeof(snapshot_format_version));
+    write_snapshot_block(file, snapshot_world_builder_version());
+    write_snapshot_block(file, std::string(declarations_buffer.GetString(), declarations_buffer.GetSize()));
+    write_snapshot_block(file, std::string(parameters_buffer.GetString(), parameters_buffer.GetSize()));
+
+    WBAssertThrow(file.good(), "Error: Could not write the World Builder parameter snapshot to '" + filename + "'.");
+  }
+
+  void
+  Parameters::initialize_from_parameter_snapshot(const std::string &snapshot_content)
+  {
+    WBAssertThrow(is_parameter_snapshot(snapshot_content), "The provided content is not a World Builder parameter snapshot.");
+
+    size_t position = snapshot_magic.size();
+    std::uint32_t byte_order_mark = 0;
+    WBAssertThrow(position + sizeof(byte_order_mark) <= snapshot_content.size(), "The World Builder parameter snapshot is truncated.");
+    std::memcpy(&byte_order_mark, snapshot_content.data() + position, sizeof(byte_order_mark));
+    position += sizeof(byte_order_mark);
+    WBAssertThrow(byte_order_mark == snapshot_byte_order_mark,
+                  "The World Builder parameter snapshot was written on a machine with a different byte order (endianness) "
+                  "than this one and can not be read here. Please recreate the snapshot from the world builder file.");
+
+    std::uint32_t format_version = 0;
+    WBAssertThrow(position + sizeof(format_version) <= snapshot_content.size(), "The World Builder parameter snapshot is truncated.");
+    std::memcpy(&format_version, snapshot_content.data() + position, sizeof(format_version));
+    position += sizeof(format_version);
+    WBAssertThrow(format_version == snapshot_format_version,
+                  "The World Builder parameter snapshot has format version " << format_version
+                  << ", but this version of the World Builder can only read format version " << snapshot_format_version
+                  << ". Please recreate the snapshot from the world builder file.");
+
+    const std::string version = read_snapshot_block(snapshot_content, position);
+    WBAssertThrow(version == snapshot_world_builder_version(),
+                  "The World Builder parameter snapshot was written by World Builder version \"" << version
+                  << "\", but this is version \"" << snapshot_world_builder_version()
+                  << "\". Please recreate the snapshot from the world builder file.");
+
+    const std::string declarations_json = read_snapshot_block(snapshot_content, position);
+    const std::string parameters_json = read_snapshot_block(snapshot_content, position);
+
+    path_level = 0;
+    WBAssertThrow(!declarations.Parse<kParseNanAndInfFlag>(declarations_json.c_str(), declarations_json.size()).HasParseError(),
+                  "Could not read the declarations from the World Builder parameter snapshot.");
+    WBAssertThrow(!parameters.Parse<kParseNanAndInfFlag>(parameters_json.c_str(), parameters_json.size()).HasParseError(),
+                  "Could not read the parameters from the World Builder parameter snapshot.");
+  }
+
   void
   Parameters::declare_entry(const std::string &name,
                             const Types::Interface &type,
@@ -32,7 +32,10 @@
 #include "world_builder/types/point.h"
 #include "world_builder/types/int.h"
 
+#include <algorithm>
+#include <exception>
 #include <iostream>
+#include <thread>
 #include <world_builder/coordinate_system.h>
 #include <world_builder/objects/distance_from_surface.h>
 
@@ -91,9 +94,20 @@ namespace WorldBuilder
     MPI_SIZE = 1;
 #endif
 
-    WorldBuilder::World::declare_entries(parameters);
+    // The content of the file is read on one process and distributed to
+    // the others. A snapshot already contains the declarations and the
+    // validated parameters, so only the entries need to be parsed.
+    const std::string file_content = Utilities::read_and_distribute_file_content(filename);
+    if (Parameters::is_parameter_snapshot(file_content))
+      {
+        parameters.initialize_from_parameter_snapshot(file_content);
+      }
+    else
+      {
+        WorldBuilder::World::declare_entries(parameters);
 
-    parameters.initialize(filename, has_output_dir, output_dir);
+        parameters.initialize_from_content(file_content, filename, has_output_dir, output_dir);
+      }
 
     this->parse_entries(parameters);
   }
@@ -154,6 +168,32 @@ namespace WorldBuilder
   }
 
 
+  void World::write_parameter_snapshot(const std::string &world_builder_file,
+                             const std::string &snapshot_file)
+  {
+    // Build the world once to make sure that the file does not only satisfy
+    // the schema, but that all features can actually be created from it.
+    World world(world_builder_file);
+
+    // The world modifies its parameters while parsing them, so store the
+    // parameters as they are right after validation.
+    Parameters prm(world);
+    const std::string file_content = Utilities::read_and_distribute_file_content(world_builder_file);
+    if (Parameters::is_parameter_snapshot(file_content))
+      {
+        prm.initialize_from_parameter_snapshot(file_content);
+      }
+    else
+      {
+        declare_entries(prm);
+        prm.initialize_from_content(file_content, world_builder_file);
+      }
+
+    if (world.MPI_RANK == 0)
+      prm.write_parameter_snapshot(snapshot_file);
+  }
+
+
   void World::parse_entries(Parameters &prm)
   {
     using namespace rapidjson;
@@ -265,20 +305,151 @@ namespace WorldBuilder
         }
     }
     prm.leave_subsection();
+
+    build_feature_index();
   }
 
 
 
-  std::vector<double>
-  World::properties(const std::array<double, 2> &point,
-                    const double depth,
-                    const std::vector<std::array<unsigned int,3>> &properties) const
+  void
+  World::build_feature_index()
   {
-    // turn it into a 3d coordinate and call the 3d temperature function
-    WBAssertThrow(dim == 2, "This function can only be called when the cross section "
-                  "variable in the world builder file has been set. Dim is "
-                  << dim << '.');
+    const size_t n_features = parameters.features.size();
+    const CoordinateSystem coordinate_system = this->parameters.coordinate_system->natural_coordinate_system();
+
+    feature_has_bounding_box.assign(n_features, false);
+    feature_bounding_boxes.assign(n_features, BoundingBox<2>());
+    unbounded_features.clear();
+    feature_index_bins.clear();
+
+    std::array<double,2> lower_corner = {{std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()}};
+    std::array<double,2> upper_corner = {{-std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()}};
+    size_t n_bounded_features = 0;
+
+    for (size_t i_feature = 0; i_feature < n_features; ++i_feature)
+      {
+        BoundingBox<2> bounding_box(std::make_pair(Point<2>(0., 0., coordinate_system), Point<2>(0., 0., coordinate_system)));
+        if (parameters.features[i_feature]->get_bounding_box_of_influence(bounding_box))
+          {
+            const std::pair<Point<2>, Point<2> > &boundary_points = bounding_box.get_boundary_points();
+            for (unsigned int d = 0; d < 2; ++d)
+              {
+                lower_corner[d] = std::min(lower_corner[d], boundary_points.first[d]);
+                upper_corner[d] = std::max(upper_corner[d], boundary_points.second[d]);
+              }
+
+            feature_has_bounding_box[i_feature] = true;
+            feature_bounding_boxes[i_feature] = bounding_box;
+            ++n_bounded_features;
+          }
+        else
+          unbounded_features.emplace_back(i_feature);
+      }
+
+    if (n_bounded_features == 0)
+      {
+        feature_index_n_bins = {{0, 0}};
+        return;
+      }
+
+    // Use a few bins per bounded feature in each direction, which keeps the
+    // number of features per bin small without using much memory.
+    const size_t n_bins_per_direction = std::min(static_cast<size_t>(64),
+                                                 2 * static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(n_bounded_features)))));
+    for (unsigned int d = 0; d < 2; ++d)
+      {
+        feature_index_lower_corner[d] = lower_corner[d];
+        feature_index_n_bins[d] = n_bins_per_direction;
+        feature_index_bin_size[d] = (upper_corner[d] - lower_corner[d]) / static_cast<double>(n_bins_per_direction);
+        if (!(feature_index_bin_size[d] > 0.))
+          feature_index_bin_size[d] = 1.;
+      }
+
+    feature_index_bins.resize(feature_index_n_bins[0] * feature_index_n_bins[1]);
+
+    const auto bin_index = [&](const double coordinate, const unsigned int d) -> size_t
+    {
+      const double bin = std::floor((coordinate - feature_index_lower_corner[d]) / feature_index_bin_size[d]);
+      return static_cast<size_t>(std::min(std::max(bin, 0.), static_cast<double>(feature_index_n_bins[d] - 1)));
+    };
+
+    // Features are added in increasing order, so every bin is sorted.
+    for (size_t i_feature = 0; i_feature < n_features; ++i_feature)
+      if (feature_has_bounding_box[i_feature])
+        {
+          const std::pair<Point<2>, Point<2> > &boundary_points = feature_bounding_boxes[i_feature].get_boundary_points();
+          for (size_t i = bin_index(boundary_points.first[0], 0); i <= bin_index(boundary_points.second[0], 0); ++i)
+            for (size_t j = bin_index(boundary_points.first[1], 1); j <= bin_index(boundary_points.second[1], 1); ++j)
+              feature_index_bins[i * feature_index_n_bins[1] + j].emplace_back(i_feature);
+        }
+  }
+
+
+
+  const std::vector<size_t> *
+  World::get_feature_index_bin(const double x,
+                               const double y) const
+  {
+    if (feature_index_bins.empty())
+      return nullptr;
+
+    const double i = std::floor((x - feature_index_lower_corner[0]) / feature_index_bin_size[0]);
+    const double j = std::floor((y - feature_index_lower_corner[1]) / feature_index_bin_size[1]);
+
+    // Points on the upper boundary of the index belong to the last bin.
+    const double max_i = static_cast<double>(feature_index_n_bins[0]);
+    const double max_j = static_cast<double>(feature_index_n_bins[1]);
+    if (!(i >= 0. && j >= 0. && i <= max_i && j <= max_j))
+      return nullptr;
+
+    return &feature_index_bins[static_cast<size_t>(std::min(i, max_i - 1.)) * feature_index_n_bins[1]
+                               + static_cast<size_t>(std::min(j, max_j - 1.))];
+  }
+
+
+
+  template <class Function>
+  void
+  World::for_each_feature_at_surface_point(const Point<2> &surface_point,
+                                           const Function &function) const
+  {
+    // The bounding boxes are tested with the point and, in spherical
+    // coordinates, with the point shifted by 2 pi in longitude, so collect
+    // the candidates from the bins of both.
+    std::array<const std::vector<size_t> *, 3> candidate_lists = {{&unbounded_features, nullptr, nullptr}};
+    candidate_lists[1] = get_feature_index_bin(surface_point[0], surface_point[1]);
+    if (surface_point.get_coordinate_system() == spherical)
+      candidate_lists[2] = get_feature_index_bin(surface_point[0] + (surface_point[0] < 0 ? 2.0 * Consts::PI : -2.0 * Consts::PI),
+                                                 surface_point[1]);
+
+    // Merge the sorted candidate lists, so that the features are visited in
+    // the same order as they are listed in the world builder file.
+    std::array<size_t,3> positions = {{0, 0, 0}};
+    while (true)
+      {
+        size_t next_feature = std::numeric_limits<size_t>::max();
+        for (unsigned int i_list = 0; i_list < 3; ++i_list)
+          if (candidate_lists[i_list] != nullptr && positions[i_list] < candidate_lists[i_list]->size())
+            next_feature = std::min(next_feature, (*candidate_lists[i_list])[positions[i_list]]);
+
+        if (next_feature == std::numeric_limits<size_t>::max())
+          break;
+
+        for (unsigned int i_list = 0; i_list < 3; ++i_list)
+          if (candidate_lists[i_list] != nullptr && positions[i_list] < candidate_lists[i_list]->size()
+              && (*candidate_lists[i_list])[positions[i_list]] == next_feature)
+            ++positions[i_list];
+
+        if (!feature_has_bounding_box[next_feature] || feature_bounding_boxes[next_feature].point_inside(surface_point))
+          function(next_feature);
+      }
+  }
 
+
+
+  std::array<double, 3>
+  World::cross_section_point_to_cartesian(const std::array<double, 2> &point) const
+  {
     const CoordinateSystem coordinate_system = this->parameters.coordinate_system->natural_coordinate_system();
 
     Point<2> point_natural(point[0], point[1],coordinate_system);
@@ -302,8 +473,22 @@ namespace WorldBuilder
         coord_3d[2] = point_natural[1];
       }
 
+    return this->parameters.coordinate_system->natural_to_cartesian_coordinates(coord_3d.get_array());
+  }
+
+
+
+  std::vector<double>
+  World::properties(const std::array<double, 2> &point,
+                    const double depth,
+                    const std::vector<std::array<unsigned int,3>> &properties) const
+  {
+    // turn it into a 3d coordinate and call the 3d temperature function
+    WBAssertThrow(dim == 2, "This function can only be called when the cross section "
+                  "variable in the world builder file has been set. Dim is "
+                  << dim << '.');
 
-    const std::array<double, 3> point_3d_cartesian = this->parameters.coordinate_system->natural_to_cartesian_coordinates(coord_3d.get_array());
+    const std::array<double, 3> point_3d_cartesian = cross_section_point_to_cartesian(point);
 
     return this->properties(point_3d_cartesian, depth, properties);
   }
@@ -379,11 +564,100 @@ namespace WorldBuilder
                             "Provided property number was: " << properties[i_property][0]);
           }
       }
-    for (auto &&it : parameters.features)
+    // Only evaluate the features whose bounding box of influence contains the point.
+    const Point<2> surface_point(natural_coordinate.get_surface_coordinates(),
+                                 this->parameters.coordinate_system->natural_coordinate_system());
+    for_each_feature_at_surface_point(surface_point, [&](const size_t i_feature)
+    {
+      parameters.features[i_feature]->properties(point, natural_coordinate, depth, properties_local, gravity_norm, entry_in_output, output);
+    });
+
+    return output;
+  }
+
+
+
+  std::vector<std::vector<double>>
+  World::properties(const std::vector<std::array<double, 2>> &points,
+                    const std::vector<double> &depths,
+                    const std::vector<std::array<unsigned int,3>> &properties,
+                    const unsigned int n_threads) const
+  {
+    WBAssertThrow(dim == 2, "This function can only be called when the cross section "
+                  "variable in the world builder file has been set. Dim is "
+                  << dim << '.');
+
+    std::vector<std::array<double, 3>> points_3d_cartesian(points.size());
+    for (size_t i_point = 0; i_point < points.size(); ++i_point)
+      points_3d_cartesian[i_point] = cross_section_point_to_cartesian(points[i_point]);
+
+    return this->properties(points_3d_cartesian, depths, properties, n_threads);
+  }
+
+
+
+  std::vector<std::vector<double>>
+  World::properties(const std::vector<std::array<double, 3>> &points,
+                    const std::vector<double> &depths,
+                    const std::vector<std::array<unsigned int,3>> &properties,
+                    const unsigned int n_threads) const
+  {
+    WBAssertThrow(points.size() == depths.size(),
+                  "The number of points (" << points.size() << ") and depths (" << depths.size() << ") have to be the same.");
+
+    std::vector<std::vector<double>> output(points.size());
+
+    const auto evaluate_points = [&](const size_t begin, const size_t end)
+    {
+      for (size_t i_point = begin; i_point < end; ++i_point)
+        output[i_point] = this->properties(points[i_point], depths[i_point], properties);
+    };
+
+    // Grain models use the random number engine, so they have to be
+    // evaluated by a single thread in the order of the points.
+    const bool grains_requested = std::any_of(properties.begin(), properties.end(),
+                                              [](const std::array<unsigned int,3> &property)
+    {
+      return property[0] == 3;
+    });
+
+    const size_t n_used_threads = grains_requested ? 1 : std::max(static_cast<size_t>(1),
+                                                                  std::min(static_cast<size_t>(n_threads), points.size()));
+    if (n_used_threads == 1)
+      {
+        evaluate_points(0, points.size());
+        return output;
+      }
+
+    // Evaluate contiguous blocks of points on separate threads. Exceptions
+    // can not leave a thread, so store them and rethrow them afterwards.
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(n_used_threads);
+    const size_t block_size = points.size() / n_used_threads;
+    for (size_t i_thread = 0; i_thread < n_used_threads; ++i_thread)
       {
-        it->properties(point, natural_coordinate, depth, properties_local, gravity_norm, entry_in_output, output);
+        const size_t begin = i_thread * block_size;
+        const size_t end = (i_thread == n_used_threads - 1) ? points.size() : begin + block_size;
+        threads.emplace_back([&evaluate_points, &exceptions, i_thread, begin, end]()
+        {
+          try
+            {
+              evaluate_points(begin, end);
+            }
+          catch (...)
+            {
+              exceptions[i_thread] = std::current_exception();
+            }
+        });
       }
 
+    for (std::thread &thread : threads)
+      thread.join();
+
+    for (const std::exception_ptr &exception : exceptions)
+      if (exception)
+        std::rethrow_exception(exception);
+
     return output;
   }
 
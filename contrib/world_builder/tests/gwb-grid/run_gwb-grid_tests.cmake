@@ -15,6 +15,10 @@ endif( NOT TEST_REFERENCE )
 # create a directory for the test
 file(MAKE_DIRECTORY ${CMAKE_BINARY_DIR}/gwb-grid/${TEST_NAME})
 
+# create the directory of the output, which is a subdirectory for the pieces of a parallel vtu file
+get_filename_component(TEST_OUTPUT_DIRECTORY ${TEST_OUTPUT} DIRECTORY)
+file(MAKE_DIRECTORY ${TEST_OUTPUT_DIRECTORY})
+
 set(EXECUTE_COMMAND ${TEST_PROGRAM} ${TEST_ARGS})
 
 # run the test program, capture the stdout/stderr and the result var ${TEST_ARGS}
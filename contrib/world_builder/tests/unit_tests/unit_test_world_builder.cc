@@ -60,6 +60,8 @@ extern "C" {
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
@@ -853,14 +855,157 @@ TEST_CASE("WorldBuilder interface")
   const std::string file = WorldBuilder::Data::WORLD_BUILDER_SOURCE_DIR + "/tests/data/continental_plate.wb";
   const WorldBuilder::World world(file);
 
-  CHECK_THROWS_WITH(world.properties({{1,2,3}},1., {{{{0,0,0}}}}),Contains("Unimplemented property provided. Only "));
-  CHECK_THROWS_WITH(world.properties({{1,2,3}},1., {{{{5,0,0}}}}),Contains("Unimplemented property provided. Only "));
+  CHECK_THROWS_WITH(world.properties(std::array<double,3> {{1,2,3}},1., {{{{0,0,0}}}}),Contains("Unimplemented property provided. Only "));
+  CHECK_THROWS_WITH(world.properties(std::array<double,3> {{1,2,3}},1., {{{{5,0,0}}}}),Contains("Unimplemented property provided. Only "));
 
   approval_tests_grains.emplace_back(world.grains(std::array<double,3> {{750e3,250e3,100e3}},10e3,0,3));
   approval_tests_grains.emplace_back(world.grains(std::array<double,2> {{750e3,100e3}},10e3,0,3));
   ApprovalTests::Approvals::verifyAll("TITLE", approval_tests_grains);
 }
 
+TEST_CASE("WorldBuilder World parameter snapshot")
+{
+  const std::vector<std::array<unsigned int,3>> properties = {{{{1,0,0}},{{2,0,0}},{{2,1,0}},{{3,0,3}}}};
+  const std::vector<std::string> file_names = {"/tests/data/continental_plate.wb",
+                                               "/tests/data/subducting_plate_constant_angles_cartesian.wb",
+                                               "/tests/data/fault_constant_angles_cartesian.wb"
+                                              };
+
+  for (const auto &file : file_names)
+    {
+      const std::string file_name = WorldBuilder::Data::WORLD_BUILDER_SOURCE_DIR + file;
+      const std::string snapshot_name = "unit_test_world_builder_snapshot.wbs";
+      WorldBuilder::World::write_parameter_snapshot(file_name, snapshot_name);
+
+      const WorldBuilder::World world(file_name);
+      const WorldBuilder::World world_snapshot(snapshot_name);
+
+      for (unsigned int i = 0; i < 10; ++i)
+        for (unsigned int k = 0; k < 4; ++k)
+          {
+            const std::array<double,3> point = {{i*200e3, i*100e3, 1000e3 - k*150e3}};
+            CHECK(world_snapshot.properties(point, k*150e3, properties) == world.properties(point, k*150e3, properties));
+          }
+
+      // A snapshot of a snapshot is the same snapshot.
+      const std::string snapshot_name_2 = "unit_test_world_builder_snapshot_2.wbs";
+      WorldBuilder::World::write_parameter_snapshot(snapshot_name, snapshot_name_2);
+      std::ifstream snapshot_1(snapshot_name, std::ios::binary);
+      std::ifstream snapshot_2(snapshot_name_2, std::ios::binary);
+      CHECK(std::string(std::istreambuf_iterator<char>(snapshot_1), std::istreambuf_iterator<char>())
+            == std::string(std::istreambuf_iterator<char>(snapshot_2), std::istreambuf_iterator<char>()));
+      snapshot_1.close();
+      snapshot_2.close();
+
+      // A truncated snapshot is rejected.
+      {
+        std::ifstream snapshot(snapshot_name, std::ios::binary);
+        const std::string content((std::istreambuf_iterator<char>(snapshot)), std::istreambuf_iterator<char>());
+        snapshot.close();
+        std::ofstream truncated(snapshot_name, std::ios::binary);
+        truncated << content.substr(0, content.size()/2);
+      }
+      CHECK_THROWS_WITH(WorldBuilder::World(std::string(snapshot_name)), Contains("The World Builder parameter snapshot is truncated."));
+
+      std::remove(snapshot_name.c_str());
+      std::remove(snapshot_name_2.c_str());
+    }
+}
+
+TEST_CASE("WorldBuilder World batched properties")
+{
+  const std::vector<std::array<unsigned int,3>> properties = {{{{1,0,0}},{{2,0,0}},{{2,3,0}},{{4,0,0}}}};
+
+  // Cartesian world with a fault, queried in 3d and in the 2d cross section.
+  {
+    const std::string file_name = WorldBuilder::Data::WORLD_BUILDER_SOURCE_DIR + "/tests/data/fault_constant_angles_cartesian.wb";
+    const WorldBuilder::World world(file_name);
+
+    std::vector<std::array<double,3>> points;
+    std::vector<std::array<double,2>> points_2d;
+    std::vector<double> depths;
+    std::vector<double> depths_2d;
+    for (unsigned int i = 0; i < 11; ++i)
+      for (unsigned int j = 0; j < 11; ++j)
+        for (unsigned int k = 0; k < 6; ++k)
+          {
+            points.emplace_back(std::array<double,3> {{i*150e3, j*150e3, 1000e3 - k*100e3}});
+            depths.emplace_back(k*100e3);
+            if (j == 0)
+              {
+                points_2d.emplace_back(std::array<double,2> {{i*50e3, 1000e3 - k*100e3}});
+                depths_2d.emplace_back(k*100e3);
+              }
+          }
+
+    for (unsigned int n_threads = 1; n_threads <= 4; n_threads += 3)
+      {
+        const std::vector<std::vector<double>> output = world.properties(points, depths, properties, n_threads);
+        REQUIRE(output.size() == points.size());
+        for (size_t i = 0; i < points.size(); ++i)
+          CHECK(output[i] == world.properties(points[i], depths[i], properties));
+
+        const std::vector<std::vector<double>> output_2d = world.properties(points_2d, depths_2d, properties, n_threads);
+        REQUIRE(output_2d.size() == points_2d.size());
+        for (size_t i = 0; i < points_2d.size(); ++i)
+          CHECK(output_2d[i] == world.properties(points_2d[i], depths_2d[i], properties));
+      }
+
+    CHECK_THROWS_WITH(world.properties(points, std::vector<double>(1,0.), properties),
+                      Contains("The number of points (726) and depths (1) have to be the same."));
+  }
+
+  // Spherical world with a subducting plate, where the bounding box of the
+  // feature is tested in longitude and latitude.
+  {
+    const std::string file_name = WorldBuilder::Data::WORLD_BUILDER_SOURCE_DIR + "/tests/data/subducting_plate_different_angles_spherical.wb";
+    const WorldBuilder::World world(file_name);
+
+    std::vector<std::array<double,3>> points;
+    std::vector<double> depths;
+    const double dtr = WorldBuilder::Consts::PI / 180.0;
+    for (int longitude = -40; longitude <= 40; longitude += 4)
+      for (int latitude = -40; latitude <= 20; latitude += 4)
+        for (unsigned int k = 0; k < 5; ++k)
+          {
+            const double radius = 6371000. - k * 100e3;
+            points.emplace_back(std::array<double,3> {{radius *std::cos(latitude *dtr) *std::cos(longitude *dtr),
+                                                        radius *std::cos(latitude *dtr) *std::sin(longitude *dtr),
+                                                        radius *std::sin(latitude *dtr)
+                                                       }
+                                                      });
+            depths.emplace_back(k * 100e3);
+          }
+
+    const std::vector<std::vector<double>> output = world.properties(points, depths, properties, 3);
+    REQUIRE(output.size() == points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+      CHECK(output[i] == world.properties(points[i], depths[i], properties));
+  }
+
+  // Grains use the random number engine, so they are evaluated in order on a
+  // single thread and give the same result as point by point queries.
+  {
+    const std::string file_name = WorldBuilder::Data::WORLD_BUILDER_SOURCE_DIR + "/tests/data/continental_plate.wb";
+    const WorldBuilder::World world1(file_name);
+    const WorldBuilder::World world2(file_name);
+
+    const std::vector<std::array<unsigned int,3>> grain_properties = {{{{1,0,0}},{{3,0,3}}}};
+    std::vector<std::array<double,3>> points;
+    std::vector<double> depths;
+    for (unsigned int i = 0; i < 20; ++i)
+      {
+        points.emplace_back(std::array<double,3> {{i*100e3, 250e3, 100e3}});
+        depths.emplace_back(10e3);
+      }
+
+    const std::vector<std::vector<double>> output = world1.properties(points, depths, grain_properties, 4);
+    REQUIRE(output.size() == points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+      CHECK(output[i] == world2.properties(points[i], depths[i], grain_properties));
+  }
+}
+
 TEST_CASE("Worldbuilder grains")
 {
   // creat a grains object
@@ -4853,6 +4998,35 @@ TEST_CASE("GWB Bezier curve")
 }
 
 
+TEST_CASE("GWB Bezier curve closest point on long curve")
+{
+  // The closest point search on long curves skips segments which are too far
+  // away, so compare it against a dense sampling of the whole curve.
+  std::vector<Point<2> > coordinates;
+  for (size_t i = 0; i < 101; ++i)
+    coordinates.emplace_back(static_cast<double>(i)*10.,50.*std::sin(static_cast<double>(i)*0.1),cartesian);
+
+  const Objects::BezierCurve bezier_curve(coordinates);
+
+  const size_t n_samples = 100;
+  for (size_t i = 0; i < 20; ++i)
+    for (size_t j = 0; j < 5; ++j)
+      {
+        const Point<2> check_point(60.+static_cast<double>(i)*45.,-80.+static_cast<double>(j)*40.,cartesian);
+        const Objects::ClosestPointOnCurve closest_point = bezier_curve.closest_point_on_curve_segment(check_point);
+
+        double min_sampled_distance = std::numeric_limits<double>::infinity();
+        for (size_t cp_i = 0; cp_i < coordinates.size()-1; ++cp_i)
+          for (size_t sample_i = 0; sample_i <= n_samples; ++sample_i)
+            min_sampled_distance = std::min(min_sampled_distance,
+                                            (bezier_curve(cp_i,static_cast<double>(sample_i)/static_cast<double>(n_samples))-check_point).norm());
+
+        CHECK(std::fabs(closest_point.distance) <= min_sampled_distance + 1e-8);
+        CHECK(std::fabs(closest_point.distance) >= min_sampled_distance - 1e-2);
+        CHECK((closest_point.point-check_point).norm() == Approx(std::fabs(closest_point.distance)));
+      }
+}
+
 TEST_CASE("WorldBuilder Utilities function: distance_point_from_curved_planes cartesian part 1")
 {
   std::vector<double> approval_tests;
@@ -64,6 +64,16 @@ namespace aspect
         initial_composition (const Point<dim> &position,
                              const unsigned int n_comp) const override;
 
+        /**
+         * Compute the initial composition given by @p n_comp at all
+         * @p positions at once, which locates every position in the data
+         * grid with a single batched lookup.
+         */
+        void
+        initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                       const unsigned int n_comp,
+                                       std::vector<double> &compositions) const override;
+
         /**
          * Declare the parameters this class takes through input files.
          */
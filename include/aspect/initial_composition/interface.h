@@ -61,6 +61,20 @@ namespace aspect
          */
         virtual
         double initial_composition (const Point<dim> &position, const unsigned int n_comp) const = 0;
+
+        /**
+         * Compute the initial value of the composition given by @p n_comp
+         * for all of the given @p positions and store it in @p compositions,
+         * which needs to have the same size as @p positions. The default
+         * implementation calls the function above for one position after
+         * the other. Plugins for which evaluating the composition at several
+         * points at once is cheaper than evaluating it at each point
+         * separately can override this function.
+         */
+        virtual
+        void initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                            const unsigned int n_comp,
+                                            std::vector<double> &compositions) const;
     };
 
 
@@ -100,6 +114,17 @@ namespace aspect
         initial_composition (const Point<dim> &position,
                              const unsigned int n_comp) const;
 
+        /**
+         * Like the function above, but compute the composition given by
+         * @p n_comp for all of the given @p positions at once and store it in
+         * @p compositions, which needs to have the same size as
+         * @p positions.
+         */
+        void
+        initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                       const unsigned int n_comp,
+                                       std::vector<double> &compositions) const;
+
         /**
          * A function that is used to register initial composition objects in
          * such a way that the Manager can deal with all of them without having
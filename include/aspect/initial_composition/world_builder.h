@@ -27,6 +27,7 @@
 
 #include <aspect/initial_composition/interface.h>
 #include <aspect/simulator_access.h>
+#include <aspect/world_builder_query_cache.h>
 
 namespace WorldBuilder
 {
@@ -66,6 +67,17 @@ namespace aspect
          */
         double initial_composition (const Point<dim> &position, const unsigned int n_comp) const override;
 
+        /**
+         * Compute the initial composition given by @p n_comp at all
+         * @p positions at once. Compositions that are not in the list of
+         * relevant compositions are set to zero without evaluating the
+         * World Builder at all.
+         */
+        void
+        initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                       const unsigned int n_comp,
+                                       std::vector<double> &compositions) const override;
+
         /**
          * Declare the parameters this class takes through input files. The
          * default implementation of this function does not describe any
@@ -97,6 +109,13 @@ namespace aspect
          * that the object doesn't go away while we still need it.
          */
         std::shared_ptr<const ::WorldBuilder::World> world_builder;
+
+        /**
+         * A pointer to the object that stores World Builder results, which is
+         * shared with the other world builder initial condition plugins so
+         * that every point is only evaluated once for all requested fields.
+         */
+        std::shared_ptr<WorldBuilderQueryCache<dim>> world_builder_query_cache;
     };
   }
 }
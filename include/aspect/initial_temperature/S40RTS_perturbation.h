@@ -107,11 +107,28 @@ namespace aspect
         virtual
         double get_Vs (const Point<dim> &position) const;
 
+        /**
+         * Compute the Vs at all @p positions at once and store it in @p vs,
+         * which needs to have the same size as @p positions. The parts of the
+         * computation that do not depend on the position are only done once.
+         */
+        void get_Vs_at_points (const std::vector<Point<dim>> &positions,
+                               std::vector<double> &vs) const;
+
         /**
          * Return the initial temperature as a function of position.
          */
         double initial_temperature (const Point<dim> &position) const override;
 
+        /**
+         * Compute the initial temperature at all @p positions at once. If the
+         * thermal expansion coefficient is taken from the material model, the
+         * material model is evaluated once for all positions.
+         */
+        void
+        initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                       std::vector<double> &temperatures) const override;
+
         /**
          * Declare the parameters this class takes through input files.
          */
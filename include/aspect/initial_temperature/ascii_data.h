@@ -65,6 +65,15 @@ namespace aspect
         double
         initial_temperature (const Point<dim> &position) const override;
 
+        /**
+         * Compute the initial temperature at all @p positions at once, which
+         * locates every position in the data grid with a single batched
+         * lookup.
+         */
+        void
+        initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                       std::vector<double> &temperatures) const override;
+
         /**
          * Declare the parameters this class takes through input files.
          */
@@ -61,6 +61,19 @@ namespace aspect
          */
         virtual
         double initial_temperature (const Point<dim> &position) const = 0;
+
+        /**
+         * Compute the initial temperature for all of the given @p positions
+         * and store it in @p temperatures, which needs to have the same size
+         * as @p positions. The default implementation calls the function
+         * above for one position after the other. Plugins for which
+         * evaluating the temperature at several points at once is
+         * cheaper than evaluating it at each point separately can
+         * override this function.
+         */
+        virtual
+        void initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                            std::vector<double> &temperatures) const;
     };
 
 
@@ -97,6 +110,16 @@ namespace aspect
         double
         initial_temperature (const Point<dim> &position) const;
 
+        /**
+         * Like the function above, but compute the initial temperature for
+         * all of the given @p positions at once and store it in
+         * @p temperatures, which needs to have the same size as
+         * @p positions.
+         */
+        void
+        initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                       std::vector<double> &temperatures) const;
+
         /**
          * A function that is used to register initial temperature objects in such
          * a way that the Manager can deal with all of them without having to
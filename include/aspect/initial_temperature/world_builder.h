@@ -27,6 +27,7 @@
 
 #include <aspect/initial_temperature/interface.h>
 #include <aspect/simulator_access.h>
+#include <aspect/world_builder_query_cache.h>
 
 namespace WorldBuilder
 {
@@ -70,12 +71,26 @@ namespace aspect
          */
         double initial_temperature (const Point<dim> &position) const override;
 
+        /**
+         * Compute the initial temperature at all @p positions at once.
+         */
+        void
+        initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                       std::vector<double> &temperatures) const override;
+
       private:
         /**
          * A pointer to the WorldBuilder object. Keeping this pointer ensures
          * that the object doesn't go away while we still need it.
          */
         std::shared_ptr<const ::WorldBuilder::World> world_builder;
+
+        /**
+         * A pointer to the object that stores World Builder results, which is
+         * shared with the other world builder initial condition plugins so
+         * that every point is only evaluated once for all requested fields.
+         */
+        std::shared_ptr<WorldBuilderQueryCache<dim>> world_builder_query_cache;
     };
   }
 }
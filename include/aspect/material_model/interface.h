@@ -36,6 +36,8 @@
 #include <deal.II/fe/component_mask.h>
 #include <deal.II/numerics/data_postprocessor.h>
 #include <deal.II/base/signaling_nan.h>
+#include <deal.II/base/table.h>
+#include <deal.II/lac/full_matrix.h>
 
 namespace aspect
 {
@@ -732,10 +734,108 @@ namespace aspect
        */
       AveragingOperation parse_averaging_operation_name (const std::string &s);
 
+      /**
+       * A class that stores the parts of the matrices used by the
+       * project_to_Q1 and project_to_Q1_only_viscosity averaging operations
+       * that do not change between evaluations on the same mesh. Without
+       * it, every call to average() has to set up an FEValues object,
+       * assemble the $Q_1$ mass matrix of the cell, and invert it, although
+       * the result only depends on the geometry of the cell.
+       *
+       * The matrix $E$ that evaluates the $Q_1$ shape functions at the
+       * quadrature points is the same on every cell and is stored once.
+       * For every locally owned cell, the object stores the inverse of the
+       * $Q_1$ mass matrix $M^{-1}$ and the values $|J(x_q)| w_q$, from which
+       * the projection matrix $M^{-1}F$ is formed with a single small
+       * matrix-matrix product (see the documentation of
+       * compute_projection_matrix() in the .cc file). Storing these factors
+       * instead of the full projection matrix keeps the memory consumption
+       * at $P^2+N$ instead of $P\times N$ numbers per cell.
+       *
+       * The stored values are only valid as long as neither the mesh nor
+       * the mapping changes. The owner of the object therefore has to call
+       * clear() after every mesh refinement and every mesh deformation, and
+       * reinit() before the next use.
+       */
+      template <int dim>
+      class ProjectionMatrixCache
+      {
+        public:
+          /**
+           * Compute and store the matrices for all locally owned cells of
+           * @p dof_handler, using the quadrature points of
+           * @p quadrature_formula and the geometry described by @p mapping.
+           */
+          void
+          reinit (const DoFHandler<dim> &dof_handler,
+                  const Mapping<dim>    &mapping,
+                  const Quadrature<dim> &quadrature_formula);
+
+          /**
+           * Release all stored matrices. After calling this function,
+           * empty() returns true until reinit() is called again.
+           */
+          void
+          clear ();
+
+          /**
+           * Return whether the object currently stores any matrices.
+           */
+          bool
+          empty () const;
+
+          /**
+           * Return whether the stored matrices can be used for the given
+           * @p cell and @p quadrature_formula, i.e., whether the cell is
+           * locally owned and the quadrature formula is the one this object
+           * was initialized with.
+           */
+          bool
+          is_applicable (const typename DoFHandler<dim>::active_cell_iterator &cell,
+                         const Quadrature<dim> &quadrature_formula) const;
+
+          /**
+           * Form the projection and expansion matrices for @p cell from the
+           * stored values. The output is the same as the one of
+           * compute_projection_matrix() for the same cell.
+           */
+          void
+          get_matrices (const typename DoFHandler<dim>::active_cell_iterator &cell,
+                        FullMatrix<double> &projection_matrix,
+                        FullMatrix<double> &expansion_matrix) const;
+
+        private:
+          /**
+           * The quadrature formula the matrices were computed for.
+           */
+          Quadrature<dim> quadrature;
+
+          /**
+           * The values of the $Q_1$ shape functions at the quadrature
+           * points, which are the same on every cell.
+           */
+          FullMatrix<double> reference_expansion_matrix;
+
+          /**
+           * The entries of the inverse $Q_1$ mass matrix and the values
+           * $|J(x_q)| w_q$ for every cell, indexed by the active cell
+           * index. The rows of cells that are not locally owned are not
+           * used.
+           */
+          Table<2,double> inverse_mass_matrices;
+          Table<2,double> JxW_values;
+      };
+
       /**
        * Given the averaging @p operation, a description of where the
        * quadrature points are located on the given cell, and a mapping,
        * perform this operation on all elements of the @p values structure.
+       *
+       * If @p projection_matrix_cache is not a null pointer and stores the
+       * matrices for the given cell and quadrature formula, the
+       * project_to_Q1 operations use these matrices instead of computing
+       * them. In this case, @p mapping has to be the mapping the cache was
+       * initialized with.
        */
       template <int dim>
       void average (const AveragingOperation operation,
@@ -743,7 +843,8 @@ namespace aspect
                     const Quadrature<dim>         &quadrature_formula,
                     const Mapping<dim>            &mapping,
                     const MaterialProperties::Property &requested_properties,
-                    MaterialModelOutputs<dim>     &values_out);
+                    MaterialModelOutputs<dim>     &values_out,
+                    const ProjectionMatrixCache<dim> *projection_matrix_cache = nullptr);
 
       /**
        * Do the requested averaging operation for one array. The
@@ -23,6 +23,13 @@
 
 #include <aspect/material_model/interface.h>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace aspect
 {
   namespace MaterialModel
@@ -57,6 +64,15 @@ namespace aspect
      * redundant calls to evaluate the material properties;
      * it serves only as a proof of concept.
      *
+     * To reduce the number of calls to PerpleX, the model can store the
+     * computed material properties in a cache. Temperature, pressure and
+     * bulk composition are rounded to a user defined resolution, and
+     * PerpleX is evaluated at the rounded values, so that all points that
+     * round to the same values share one cache entry. If the cache is full,
+     * the least recently used entries are removed. Since the PerpleX library
+     * is not reentrant, all calls to it are serialized, while cached values
+     * can be read by several threads at the same time.
+     *
      * @ingroup MaterialModels
      */
     template <int dim>
@@ -98,6 +114,34 @@ namespace aspect
 
 
       private:
+        /**
+         * The material properties computed by PerpleX for one temperature,
+         * pressure and bulk composition, namely the density, specific heat,
+         * thermal expansivity and compressibility (in this order).
+         */
+        using MaterialProperties = std::array<double,4>;
+
+        /**
+         * Call PerpleX to compute the material properties at the given
+         * temperature, pressure and bulk composition. Calls of this
+         * function from different threads are serialized.
+         */
+        MaterialProperties
+        compute_material_properties (const double temperature,
+                                     const double pressure,
+                                     const std::vector<double> &composition) const;
+
+        /**
+         * Return the material properties at the given temperature, pressure
+         * and bulk composition, either from the cache or, if they are not
+         * stored yet, by calling compute_material_properties() at the rounded
+         * values and storing the result in the cache.
+         */
+        MaterialProperties
+        get_material_properties (const double temperature,
+                                 const double pressure,
+                                 const std::vector<double> &composition) const;
+
         std::string perplex_file_name;
         double eta;
         double k_value;
@@ -105,6 +149,62 @@ namespace aspect
         double max_temperature;
         double min_pressure;
         double max_pressure;
+
+        /**
+         * The maximum number of entries in the cache. A value of zero
+         * disables the cache.
+         */
+        unsigned int max_cache_size;
+
+        /**
+         * The resolution to which temperature, pressure and composition are
+         * rounded to find the cache entry of a point.
+         */
+        double cache_temperature_resolution;
+        double cache_pressure_resolution;
+        double cache_composition_resolution;
+
+        /**
+         * The key of a cache entry: temperature, pressure and the
+         * bulk composition as integer multiples of their resolution.
+         */
+        using CacheKey = std::vector<std::int64_t>;
+
+        /**
+         * A hash function for cache keys.
+         */
+        struct CacheKeyHash
+        {
+          std::size_t operator() (const CacheKey &key) const;
+        };
+
+        /**
+         * A cache entry, consisting of the material properties and
+         * a time stamp of its last use, which is updated without
+         * acquiring exclusive access to the cache.
+         */
+        struct CacheEntry
+        {
+          MaterialProperties properties;
+          mutable std::atomic<std::uint64_t> last_access;
+        };
+
+        /**
+         * The cache of material properties, the mutex that protects it,
+         * and the counter used to create time stamps of cache accesses.
+         * Lookups only need shared access, insertions and removals
+         * require exclusive access.
+         */
+        mutable std::unordered_map<CacheKey,CacheEntry,CacheKeyHash> cache;
+        mutable std::shared_mutex cache_mutex;
+        mutable std::atomic<std::uint64_t> cache_access_counter {0};
+
+        /**
+         * A mutex that serializes all calls to PerpleX, which uses
+         * global state and can not be called from several threads at
+         * the same time.
+         */
+        mutable std::mutex perplex_mutex;
     };
 
   }
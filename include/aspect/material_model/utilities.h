@@ -27,6 +27,7 @@
 #include <deal.II/fe/component_mask.h>
 #include <deal.II/base/signaling_nan.h>
 #include <deal.II/base/parameter_handler.h>
+#include <deal.II/base/table.h>
 
 namespace aspect
 {
@@ -64,6 +65,39 @@ namespace aspect
         class MaterialLookup
         {
           public:
+            /**
+             * The material properties that can be looked up together by a
+             * single call to evaluate(). The value of each property is the
+             * same as the one returned by the member function of the same name.
+             */
+            enum class Property
+            {
+              density,
+              thermal_expansivity,
+              specific_heat,
+              seismic_Vp,
+              seismic_Vs,
+              enthalpy,
+              dHdT,
+              dHdp,
+              dRhodp
+            };
+
+            /**
+             * Look up all properties listed in @p properties at the given
+             * temperature and pressure and store them in @p values, in the same
+             * order. The position of the point in the table and the
+             * interpolation weights are only computed once for all properties,
+             * and all properties of a table entry are stored next to each other
+             * in memory. This makes this function considerably cheaper than
+             * calling the functions for the individual properties if several
+             * properties are needed at the same point.
+             */
+            void
+            evaluate(const double temperature,
+                     const double pressure,
+                     const std::vector<Property> &properties,
+                     std::vector<double> &values) const;
 
             double
             specific_heat(const double temperature,
@@ -200,6 +234,50 @@ namespace aspect
                    const double pressure,
                    const Table<2, unsigned int> &values) const;
 
+            /**
+             * The position of a temperature-pressure point in the data
+             * tables: the indices of the data point with the next
+             * smaller temperature and pressure, and the relative position
+             * between this data point and the next one in temperature
+             * (xi) and pressure (eta) direction.
+             */
+            struct TablePosition
+            {
+              unsigned int inT;
+              unsigned int inp;
+              double xi;
+              double eta;
+            };
+
+            /**
+             * Compute the position of the point with temperature
+             * @p temperature and pressure @p pressure in the data tables.
+             */
+            TablePosition
+            table_position (const double temperature,
+                            const double pressure) const;
+
+            /**
+             * Return the value of the property with index @p property_index
+             * in property_values at the table position @p position. @p interpol
+             * controls whether to perform linear interpolation between the
+             * closest data points, or simply use the closest point value.
+             */
+            double
+            property_value (const TablePosition &position,
+                            const unsigned int property_index,
+                            const bool interpol) const;
+
+            /**
+             * Copy the data from the individual property tables filled by the
+             * derived classes into the interleaved table property_values, and
+             * share all tables between the processes of @p comm that are
+             * located on the same machine. This function needs to be called
+             * by derived classes after reading the data.
+             */
+            void
+            setup_property_table (const MPI_Comm comm);
+
             /**
              * Find the position in a data table given a temperature.
              */
@@ -210,12 +288,35 @@ namespace aspect
              */
             double get_np(const double pressure) const;
 
+            /**
+             * Tables of the individual material properties. These are only
+             * used by the derived classes while reading the data, and are
+             * released by setup_property_table() after their content has been
+             * copied into property_values.
+             */
             dealii::Table<2,double> density_values;
             dealii::Table<2,double> thermal_expansivity_values;
             dealii::Table<2,double> specific_heat_values;
             dealii::Table<2,double> vp_values;
             dealii::Table<2,double> vs_values;
             dealii::Table<2,double> enthalpy_values;
+
+            /**
+             * The number of properties stored in property_values. The
+             * properties are stored in the order of the first entries of
+             * the Property enum, i.e., density, thermal expansivity,
+             * specific heat, seismic Vp, seismic Vs, and enthalpy.
+             */
+            static constexpr unsigned int n_tabulated_properties = 6;
+
+            /**
+             * All tabulated material properties, indexed by temperature,
+             * pressure, and property (in this order), so that all properties
+             * at one table entry are stored next to each other in memory.
+             * The table is shared between all processes on the same machine.
+             */
+            dealii::Table<3,double> property_values;
+
             dealii::Table<2,unsigned int> dominant_phase_indices;
 
             /**
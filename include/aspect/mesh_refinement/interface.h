@@ -25,6 +25,7 @@
 #include <aspect/global.h>
 #include <aspect/plugins.h>
 #include <aspect/simulator_access.h>
+#include <aspect/material_model/interface.h>
 
 #include <memory>
 #include <deal.II/base/table_handler.h>
@@ -48,6 +49,54 @@ namespace aspect
    */
   namespace MeshRefinement
   {
+    /**
+     * A structure that stores the temperature and material model outputs
+     * in the support points of the temperature element on all locally
+     * owned cells. Many mesh refinement criteria compute their indicators
+     * from the gradient of a material property that is interpolated onto
+     * the temperature element. Rather than every one of these criteria
+     * evaluating the material model on all cells, the Manager evaluates
+     * it a single time for all properties that the active criteria request
+     * through Interface::get_required_material_properties(). The criteria
+     * then read the values from this structure, which they can access
+     * through Manager::get_support_point_material_data().
+     *
+     * The value in support point @p i of a cell is stored at position
+     * index(cell,i) of the vectors below. Only the vectors of properties
+     * that were requested are filled, all others are empty.
+     */
+    template <int dim>
+    struct SupportPointMaterialData
+    {
+      /**
+       * Return the position of the values in support point
+       * @p support_point of @p cell in the vectors below.
+       */
+      std::size_t
+      index (const typename DoFHandler<dim>::active_cell_iterator &cell,
+             const unsigned int support_point) const;
+
+      /**
+       * The material properties that were computed.
+       */
+      MaterialModel::MaterialProperties::Property computed_properties = MaterialModel::MaterialProperties::uninitialized;
+
+      /**
+       * The number of support points of the temperature element.
+       */
+      unsigned int n_support_points = 0;
+
+      /**
+       * The temperature, which is always stored, and the density,
+       * viscosity and specific heat computed by the material model.
+       */
+      std::vector<double> temperatures;
+      std::vector<double> densities;
+      std::vector<double> viscosities;
+      std::vector<double> specific_heat;
+    };
+
+
 
     /**
      * This class declares the public interface of mesh refinement plugins.
@@ -100,6 +149,22 @@ namespace aspect
         virtual
         void
         tag_additional_cells () const;
+
+        /**
+         * Return the material properties this criterion needs in the support
+         * points of the temperature element. The Manager evaluates the
+         * material model once for the properties requested by all active
+         * criteria before it calls their execute() functions, and the
+         * criteria can then read the values from
+         * Manager::get_support_point_material_data(). Currently only the
+         * density, the viscosity, and the specific heat are stored. The
+         * default implementation returns
+         * MaterialModel::MaterialProperties::uninitialized, i.e., the
+         * criterion does not need any material properties.
+         */
+        virtual
+        MaterialModel::MaterialProperties::Property
+        get_required_material_properties () const;
     };
 
 
@@ -136,6 +201,15 @@ namespace aspect
         void
         tag_additional_cells () const;
 
+        /**
+         * Return the material model outputs in the support points of the
+         * temperature element that were computed for the criteria that
+         * request them. This function can only be called from within the
+         * execute() functions of these criteria.
+         */
+        const SupportPointMaterialData<dim> &
+        get_support_point_material_data () const;
+
         /**
          * Declare the parameters of all known mesh refinement plugins, as
          * well as of ones this class has itself.
@@ -263,10 +337,36 @@ namespace aspect
          * refinement indicators before merging.
          */
         std::vector<double> scaling_factors;
+
+        /**
+         * Evaluate the material model on all locally owned cells for the
+         * given @p properties and store the results in
+         * support_point_material_data. The cells are processed in parallel
+         * using WorkStream.
+         */
+        void
+        compute_support_point_material_data (const MaterialModel::MaterialProperties::Property properties) const;
+
+        /**
+         * The material model outputs shared between all criteria during a
+         * call to execute().
+         */
+        mutable SupportPointMaterialData<dim> support_point_material_data;
     };
 
 
 
+    template <int dim>
+    inline
+    std::size_t
+    SupportPointMaterialData<dim>::index (const typename DoFHandler<dim>::active_cell_iterator &cell,
+                                          const unsigned int support_point) const
+    {
+      return static_cast<std::size_t>(cell->active_cell_index()) * n_support_points + support_point;
+    }
+
+
+
     template <int dim>
     template <typename MeshRefinementType, typename>
     inline
@@ -52,6 +52,13 @@ namespace aspect
          */
         void
         execute (Vector<float> &error_indicators) const override;
+
+        /**
+         * Request the density and the specific heat in the support points
+         * of the temperature element from the Manager.
+         */
+        MaterialModel::MaterialProperties::Property
+        get_required_material_properties () const override;
     };
   }
 }
@@ -539,6 +539,7 @@ namespace aspect
     bool                           use_operator_splitting;
     std::string                    world_builder_file;
     unsigned int                   n_particle_managers;
+    bool                           advect_particle_systems_together;
 
     /**
      * @}
@@ -581,6 +582,8 @@ namespace aspect
     double                         ARKode_relative_tolerance;
     double                         reaction_time_step;
     unsigned int                   reaction_steps_per_advection_step;
+    unsigned int                   reaction_cells_per_batch;
+    bool                           skip_cells_without_reactions;
 
     // subsection: Diffusion solver parameters
     double                         diffusion_length_scale;
@@ -676,6 +679,8 @@ namespace aspect
     bool                           skip_setup_initial_conditions_on_initial_refinement;
     bool                           run_postprocessors_on_initial_refinement;
     bool                           run_postprocessors_on_nonlinear_iterations;
+    bool                           measure_cell_costs;
+    unsigned int                   measured_cell_cost_weight;
     /**
      * @}
      */
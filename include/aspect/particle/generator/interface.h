@@ -28,10 +28,12 @@
 #include <deal.II/particles/generators.h>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/grid/grid_tools_cache.h>
 
 #include <random>
 
 #include <map>
+#include <mutex>
 
 namespace aspect
 {
@@ -139,11 +141,63 @@ namespace aspect
                                       const types::particle_index id,
                                       Particles::ParticleHandler<dim> &particle_handler) const;
 
+          /**
+           * Insert particles at all of the given @p positions into the
+           * @p particle_handler, if the positions are located in cells that
+           * are owned by this process. The particle at <code>positions[i]</code>
+           * receives the id <code>first_id+i</code>, independent of whether
+           * other positions are inserted or not.
+           *
+           * This function is equivalent to calling insert_particle_at_position()
+           * for every position, but is considerably faster for large numbers of
+           * positions: Positions that can not be in a locally owned cell are
+           * discarded using an R-tree of the bounding boxes of the locally
+           * owned cells, extended by how far curved cells of the current
+           * mapping can reach beyond them. Positions that lie inside one of
+           * these cells, away from its boundary, are assigned to it directly.
+           * The cells around all other positions are searched for using the
+           * spatial indices of a GridTools::Cache. The positions are
+           * processed in parallel, and only the insertion itself happens
+           * sequentially (and in the order of the given positions).
+           *
+           * @param positions Positions of the particles.
+           * @param first_id The id of the particle at the first position.
+           * @param particle_handler The particle handler into which the particles
+           * should be inserted.
+           */
+          void
+          insert_particles_at_positions(const std::vector<Point<dim>> &positions,
+                                        const types::particle_index first_id,
+                                        Particles::ParticleHandler<dim> &particle_handler) const;
+
+          /**
+           * Return a cache of spatial search structures for the current mesh
+           * and mapping. The cache is created on first use and updates itself
+           * automatically when the mesh is refined or deformed. This function
+           * can be called from several threads at the same time.
+           */
+          const GridTools::Cache<dim> &
+          get_grid_cache() const;
+
           /**
            * Random number generator. For reproducibility of tests it is
            * initialized in the constructor with a constant.
            */
           std::mt19937            random_number_generator;
+
+        private:
+          /**
+           * A cache of spatial search structures used to find the cells
+           * around particle positions. See get_grid_cache().
+           */
+          mutable std::unique_ptr<GridTools::Cache<dim>> grid_cache;
+
+          /**
+           * A mutex that makes sure that the grid cache is only created
+           * once, and that its search structures are not marked for an
+           * update while they are built.
+           */
+          mutable std::mutex grid_cache_mutex;
       };
 
       /**
@@ -86,6 +86,33 @@ namespace aspect
            */
           virtual bool new_integration_step();
 
+          /**
+           * Return whether the given particle takes part in the current
+           * integration step. The particle manager only evaluates the
+           * velocity at the location of particles for which this function
+           * returns true, and passes zero velocities for all other particles
+           * to local_integrate_step(). After an integration step, particles
+           * for which this function returns false must not have been moved
+           * in that step. The default implementation returns true for all
+           * particles, which is ok for integrators that move all particles in
+           * every integration step.
+           */
+          virtual
+          bool
+          particle_needs_integration(const typename ParticleHandler<dim>::particle_iterator &particle) const;
+
+          /**
+           * Return whether the integrator chooses its own substeps, and may
+           * therefore leave some particles unmoved in an integration step
+           * (see particle_needs_integration()). The particle manager only
+           * checks which particles have left their cells for such
+           * integrators, and sorts all particles otherwise. The default
+           * implementation returns false.
+           */
+          virtual
+          bool
+          is_adaptive() const;
+
           /**
            * Return data length of the integration related data required for
            * communication in terms of number of bytes. When data about
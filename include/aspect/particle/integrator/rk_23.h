@@ -0,0 +1,213 @@
+/*
+ Copyright (C) 2026 by the authors of the ASPECT code.
+
+ This file is part of ASPECT.
+
+ ASPECT is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2, or (at your option)
+ any later version.
+
+ ASPECT is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with ASPECT; see the file LICENSE.  If not see
+ <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _aspect_particle_integrator_rk_23_h
+#define _aspect_particle_integrator_rk_23_h
+
+#include <aspect/particle/integrator/interface.h>
+
+#include <aspect/simulator_access.h>
+
+
+namespace aspect
+{
+  namespace Particle
+  {
+    namespace Integrator
+    {
+      /**
+       * Adaptive Runge Kutta integrator that uses the embedded
+       * Bogacki-Shampine pair of order 2(3). In contrast to the other
+       * integrators, which advance every particle over the whole time step
+       * with a fixed sequence of stages, this integrator splits the time step
+       * into substeps whose length is chosen individually for every particle
+       * from an estimate of the local truncation error. The velocity at
+       * times between t_n and t_{n+1} is interpolated linearly in time
+       * between the old and current velocity solutions.
+       *
+       * Every call to local_integrate_step() evaluates one stage for every
+       * particle. Particles that need more substeps than others simply
+       * require more stages, and the particle manager keeps requesting new
+       * integration steps until the particles on all processes have reached
+       * the end of the time step. Particles that have already reached the
+       * end of the time step are not moved any more.
+       *
+       * The scheme requires storing the location at the beginning of the
+       * current substep, three intermediate velocities, the fraction of the
+       * time step that has already been integrated, the current substep
+       * length, and the current stage in the particle properties. The
+       * substep length is kept between time steps, so every particle starts
+       * the next time step with the substep length that was successful in
+       * the last one.
+       *
+       * @ingroup ParticleIntegrators
+       */
+      template <int dim>
+      class RK23 : public Interface<dim>, public SimulatorAccess<dim>
+      {
+        public:
+          RK23();
+
+          /**
+           * Look up where the RK23 data is stored. Done once and cached to
+           * avoid repeated lookups.
+           */
+          void
+          initialize () override;
+
+          /**
+           * Perform one stage of the adaptive integration for the particles
+           * of one cell. Depending on the state of each particle this either
+           * evaluates an intermediate stage, or computes the error estimate
+           * of a finished substep and then accepts or rejects it.
+           *
+           * @param [in] begin_particle An iterator to the first particle to be moved.
+           * @param [in] end_particle An iterator to the last particle to be moved.
+           * @param [in] old_velocities The velocities at t_n, i.e. before the
+           * particle movement, for all particles between @p begin_particle
+           * and @p end_particle at their current position.
+           * @param [in] velocities The velocities at the particle positions
+           * at t_{n+1}, i.e. after the particle movement. Note that this is
+           * the velocity at the old positions, but at the new time. It is the
+           * responsibility of this function to compute the new location of
+           * the particles.
+           * @param [in] dt The length of the integration timestep.
+           */
+          void
+          local_integrate_step(const typename ParticleHandler<dim>::particle_iterator &begin_particle,
+                               const typename ParticleHandler<dim>::particle_iterator &end_particle,
+                               const std::vector<Tensor<1,dim>> &old_velocities,
+                               const std::vector<Tensor<1,dim>> &velocities,
+                               const double dt) override;
+
+          /**
+           * This function is called at the end of every integration step.
+           * For the current class it returns true as long as at least one
+           * particle on any process has not yet reached the end of the
+           * time step. Consequently, this function needs to be called on all
+           * processes at the same time.
+           *
+           * @return This function returns true if the integrator requires
+           * another integration step. The particle integration will continue
+           * to start new integration steps until this function returns false.
+           */
+          bool new_integration_step() override;
+
+          /**
+           * Return whether the given particle takes part in the current
+           * integration step. In the first integration step of a time step
+           * this is true for all particles, afterwards only for particles
+           * that have not yet reached the end of the time step.
+           */
+          bool
+          particle_needs_integration(const typename ParticleHandler<dim>::particle_iterator &particle) const override;
+
+          /**
+           * Return true, because this integrator chooses the length of the
+           * substeps for every particle separately.
+           */
+          bool
+          is_adaptive() const override;
+
+          /**
+           * Return a list of boolean values indicating which solution vectors
+           * are required for the integration. The first entry indicates if
+           * the particle integrator requires the solution vector at the old
+           * old time (k-1), the second entry indicates if the particle integrator
+           * requires the solution vector at the old time (k), and the third entry
+           * indicates if the particle integrator requires the solution vector
+           * at the new time (k+1).
+           *
+           * The RK23 integrator requires the solution vector at the
+           * old time (k) for the first integration step, and the solution
+           * vector at both the old and new time for all following steps.
+           */
+          std::array<bool, 3> required_solution_vectors() const override;
+
+          /**
+           * Declare the parameters this class takes through input files.
+           */
+          static
+          void
+          declare_parameters (ParameterHandler &prm);
+
+          /**
+           * Read the parameters this class declares from the parameter file.
+           */
+          void
+          parse_parameters (ParameterHandler &prm) override;
+
+          /**
+           * We need to tell the property manager how many intermediate properties this integrator requires,
+           * so that it can allocate sufficient space for each particle. However, the integrator is not
+           * created at the time the property manager is set up and we can not reverse the order of creation,
+           * because the integrator needs to know where to store its properties, which requires the property manager
+           * to be finished setting up properties. Luckily the number of properties is constant, so we can make it
+           * a static property of this class. Therefore, the property manager can access this variable even
+           * before any object is constructed.
+           *
+           * The RK23 integrator requires 4 tensors with dim components each
+           * (the substep start location and three intermediate velocities),
+           * and three scalars (the integrated fraction of the time step, the
+           * substep length, and the current stage).
+           */
+          static constexpr unsigned int n_integrator_properties = 4*dim+3;
+
+        private:
+          /**
+           * The number of integration steps that were already performed in
+           * the current time step.
+           */
+          unsigned int integrator_substep;
+
+          /**
+           * Whether any of the locally owned particles has not yet reached
+           * the end of the current time step.
+           */
+          bool has_unfinished_particles;
+
+          /**
+           * The location of the RK23 data stored in the particle properties.
+           */
+          unsigned int property_index_start_location;
+          std::array<unsigned int,3> property_indices_velocities;
+          unsigned int property_index_time_fraction;
+          unsigned int property_index_substep_length;
+          unsigned int property_index_stage;
+
+          /**
+           * The tolerance for the estimated error of a substep, relative to
+           * the size of the cell the particle is in.
+           */
+          double error_tolerance;
+
+          /**
+           * The maximum number of substeps per time step. Its inverse is the
+           * shortest substep (as a fraction of the time step) that is
+           * allowed. Substeps of this length are always accepted.
+           */
+          unsigned int maximum_number_of_substeps;
+      };
+    }
+  }
+}
+
+#endif
@@ -52,6 +52,13 @@ namespace aspect
           // avoid -Woverloaded-virtual:
           using Interface<dim>::properties_at_points;
 
+          /**
+           * This interpolator only averages particles in locally owned
+           * cells, so it does not need ghost particles.
+           */
+          bool
+          needs_ghost_particles () const override;
+
           /**
            * @copydoc Interface<dim>::declare_parameters()
            */
@@ -26,6 +26,8 @@
 
 #include <deal.II/grid/grid_tools_cache.h>
 
+#include <mutex>
+
 namespace aspect
 {
   namespace Particle
@@ -62,6 +64,14 @@ namespace aspect
            * do not need to recompute it every time properties_at_points() is called.
            */
           std::unique_ptr<GridTools::Cache<dim>> grid_cache;
+
+          /**
+           * The grid cache computes the information it stores the first
+           * time it is requested after the mesh changed. This mutex makes
+           * sure that this does not happen from several threads that call
+           * properties_at_points() at the same time.
+           */
+          mutable std::mutex grid_cache_mutex;
       };
     }
   }
@@ -74,6 +74,12 @@ namespace aspect
            * This property vector has as many entries as there are particle
            * properties, however entries that have not been selected in
            * @p selected_properties are filled with signalling NaNs.
+           *
+           * This function may be called for different cells from several
+           * threads at the same time, for example when the compositional
+           * fields that are advected by particles are interpolated from the
+           * particles. Implementations therefore must not modify member
+           * variables without synchronization.
            */
           virtual
           std::vector<std::vector<double>>
@@ -81,6 +87,20 @@ namespace aspect
                                const std::vector<Point<dim>> &positions,
                                const ComponentMask &selected_properties,
                                const typename parallel::distributed::Triangulation<dim>::active_cell_iterator &cell) const = 0;
+
+          /**
+           * Return whether this interpolator reads particles in ghost cells,
+           * i.e., whether the particle manager needs to exchange ghost
+           * particles with neighboring processes. Exchanging ghost particles
+           * sends all properties of the particles close to the process
+           * boundaries, which is expensive for particles with many
+           * properties, so interpolators that only access particles in
+           * locally owned cells should override this function and return
+           * false. The default implementation returns true.
+           */
+          virtual
+          bool
+          needs_ghost_particles () const;
       };
 
 
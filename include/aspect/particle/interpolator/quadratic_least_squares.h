@@ -61,6 +61,14 @@ namespace aspect
           // avoid -Woverloaded-virtual:
           using Interface<dim>::properties_at_points;
 
+          /**
+           * Ghost particles are only needed to determine the bounds of
+           * the limiter from the neighboring cells, i.e., if the limiter
+           * is enabled for at least one property.
+           */
+          bool
+          needs_ghost_particles () const override;
+
           /**
            * Declare the parameters this class takes through input files.
            */
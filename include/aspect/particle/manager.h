@@ -207,6 +207,20 @@ namespace aspect
          */
         void advance_timestep();
 
+        /**
+         * Advance the particles of all @p particle_managers by the old
+         * timestep, like advance_timestep() does for a single manager.
+         * Instead of traversing all cells separately for every manager, the
+         * particles of all managers are advected and updated in shared loops
+         * over the cells, which reuse the solution evaluator and the
+         * solution values extracted for each cell. The managers must belong
+         * to the same simulator, and this function has to be called with
+         * the same managers on all processes.
+         */
+        static
+        void
+        advance_timestep(const std::vector<Manager<dim> *> &particle_managers);
+
         /**
          * Return the total number of particles in the simulation. This
          * function is useful for monitoring how many particles have been
@@ -253,6 +267,15 @@ namespace aspect
          */
         void update_particles();
 
+        /**
+         * Update the particle properties of all @p particle_managers in a
+         * single loop over the cells, which reuses the solution evaluator
+         * and the solution values extracted for each cell.
+         */
+        static
+        void
+        update_particles(const std::vector<Manager<dim> *> &particle_managers);
+
         /**
          * Serialize the contents of this class.
          */
@@ -381,6 +404,15 @@ namespace aspect
          */
         unsigned int particle_weight;
 
+        /**
+         * The fraction of locally owned particles whose properties are not
+         * stored directly after the properties of the previous particle (in
+         * the order in which cells and particles are traversed) above which
+         * the particle storage is sorted again by sort_particle_storage().
+         * A value of 1 disables the sorting.
+         */
+        double storage_fragmentation_threshold;
+
         /**
          * Get a map between subdomain id and the neighbor index. In other words
          * the returned map answers the question: Given a subdomain id, which
@@ -399,10 +431,50 @@ namespace aspect
         apply_particle_per_cell_bounds();
 
         /**
-         * Advect the particle positions by one integration step. Needs to be
-         * called until integrator->continue() returns false.
+         * Return whether any particle on any process has left the cell it
+         * was in before the last advection pass, and therefore has to be
+         * sorted into its new cell. For integrators that are not adaptive
+         * (see Integrator::Interface::is_adaptive()) this function returns
+         * true without checking any particle. If an adaptive integrator
+         * only moved some of the particles in the last pass (see
+         * Integrator::Interface::particle_needs_integration()), only these
+         * are checked, and the reference locations of those that are still
+         * in their cell are updated. This is a collective operation for
+         * adaptive integrators.
          */
-        void advect_particles();
+        bool
+        particles_left_their_cells();
+
+        /**
+         * Compute the fraction of locally owned particles whose properties
+         * are not stored in the memory slot directly following the one of
+         * the previous particle, when traversing the particles cell by cell.
+         */
+        double
+        compute_storage_fragmentation() const;
+
+        /**
+         * Sort the memory slots of the property storage of all locally
+         * owned particles in place into the order in which the cells and
+         * their particles are traversed. This makes the property storage
+         * contiguous again and improves cache locality in the loops over
+         * particles in advect_particles() and update_particles(). This is
+         * a collective operation that has to be called on all processes.
+         * Ghost particles need to be exchanged again afterwards.
+         */
+        void
+        sort_particle_storage();
+
+        /**
+         * Advect the particle positions of all @p particle_managers by one
+         * integration step of their respective integrators. All managers
+         * are advected in a single loop over the cells, and the solution
+         * values of each cell are only extracted once. Needs to be called
+         * until integrator->continue() returns false for all managers.
+         */
+        static
+        void
+        advect_particles(const std::vector<Manager<dim> *> &particle_managers);
 
         /**
          * Initialize the particle properties of one cell.
@@ -419,12 +491,15 @@ namespace aspect
          * @param positions The reference positions of the particles in the cell.
          * This function will update these positions for the current cell.
          * @param evaluation_flags The required evaluation flags for each component.
+         * @param solution_values The values of the degrees of freedom of the
+         * current solution on the cell of the particles.
          * @param evaluator The solution evaluator that is used to update the particles.
          */
         void
         local_update_particles(Property::ParticleUpdateInputs<dim> &inputs,
                                small_vector<Point<dim>> &positions,
                                const std::vector<EvaluationFlags::EvaluationFlags> &evaluation_flags,
+                               const small_vector<double> &solution_values,
                                SolutionEvaluator<dim> &evaluator);
 
         /**
@@ -434,11 +509,18 @@ namespace aspect
          * during this advection step are removed from the local multimap and
          * stored in @p particles_out_of_cell for further treatment (sorting
          * them into the new cell).
+         *
+         * @p old_solution_values and @p solution_values are the values of the
+         * degrees of freedom of the old solution and the current linearization
+         * point on @p cell. Only those required by the integrator need to be
+         * filled.
          */
         void
         local_advect_particles(const typename DoFHandler<dim>::active_cell_iterator &cell,
                                const typename ParticleHandler<dim>::particle_iterator &begin_particle,
                                const typename ParticleHandler<dim>::particle_iterator &end_particle,
+                               const small_vector<double> &old_solution_values,
+                               const small_vector<double> &solution_values,
                                SolutionEvaluator<dim> &evaluators);
 
         /**
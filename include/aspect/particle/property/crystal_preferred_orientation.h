@@ -86,6 +86,20 @@ namespace aspect
         spin_tensor, drex_2004
       };
 
+      /**
+       * @brief The layout of the grain data of each mineral in the particle data vector.
+       *
+       * interleaved: the volume fraction and rotation matrix of each grain are stored
+       *  next to each other, followed by the data of the next grain.
+       * grain_contiguous: each quantity (the volume fraction and every component of the
+       *  rotation matrix) is stored contiguously for all grains, which allows the
+       *  computations to be vectorized across grains.
+       */
+      enum class GrainDataLayout
+      {
+        interleaved, grain_contiguous
+      };
+
       /**
        * @brief An enum used to determine how the initial grain sizes and orientations are set for all particles
        *
@@ -119,6 +133,13 @@ namespace aspect
        *
        * Last used data entry is n_minerals * (n_grains * 10 + 2).
        *
+       * The layout above is the default `interleaved' layout. In the `grain contiguous'
+       * layout, each quantity is stored contiguously for all grains of a mineral instead:
+       *    2.2. volume fractions grains    -> N doubles, the one of grain_i at location:
+       *                                      => 2 + grain_i + mineral_i * (n_grains * 10 + 2)
+       *    2.3. rotation matrices grains   -> 9 times N doubles, component i of grain_i at location:
+       *                                      => 2 + (i + 1) * n_grains + grain_i + mineral_i * (n_grains * 10 + 2)
+       *
        * We store the same number of grains for all minerals (e.g. olivine and enstatite
        * grains), although their volume fractions may not be the same. This is because we need a minimum number
        * of grains per particle to perform reliable statistics on it. This minimum should be the same for all
@@ -394,7 +415,7 @@ namespace aspect
                                              const unsigned int mineral_i,
                                              const unsigned int grain_i) const
           {
-            return data[cpo_data_position + 2 + grain_i * 10 + mineral_i * (n_grains * 10 + 2)];
+            return data[cpo_data_position + volume_fraction_grain_index(mineral_i,grain_i)];
           }
 
           /**
@@ -413,7 +434,7 @@ namespace aspect
                                            const unsigned int grain_i,
                                            const double volume_fractions_grains) const
           {
-            data[cpo_data_position + 2 + grain_i * 10 + mineral_i * (n_grains * 10 + 2)] = volume_fractions_grains;
+            data[cpo_data_position + volume_fraction_grain_index(mineral_i,grain_i)] = volume_fractions_grains;
           }
 
           /**
@@ -435,7 +456,7 @@ namespace aspect
             for (unsigned int i = 0; i < Tensor<2,3>::n_independent_components ; ++i)
               {
                 const dealii::TableIndices<2> index = Tensor<2,3>::unrolled_to_component_indices(i);
-                rotation_matrix[index] = data[cpo_data_position + 3 + grain_i * 10 + mineral_i * (n_grains * 10 + 2) + i];
+                rotation_matrix[index] = data[cpo_data_position + rotation_matrix_grain_index(mineral_i,grain_i,i)];
               }
             return rotation_matrix;
           }
@@ -459,12 +480,57 @@ namespace aspect
             for (unsigned int i = 0; i < Tensor<2,3>::n_independent_components ; ++i)
               {
                 const dealii::TableIndices<2> index = Tensor<2,3>::unrolled_to_component_indices(i);
-                data[cpo_data_position + 3 + grain_i * 10 + mineral_i * (n_grains * 10 + 2) + i] = rotation_matrix[index];
+                data[cpo_data_position + rotation_matrix_grain_index(mineral_i,grain_i,i)] = rotation_matrix[index];
               }
           }
 
 
         private:
+          /**
+           * Returns the index of the volume fraction of grain @p grain_i of mineral
+           * @p mineral_i relative to the start of the cpo data in the particle data vector.
+           */
+          inline
+          unsigned int volume_fraction_grain_index(const unsigned int mineral_i,
+                                                   const unsigned int grain_i) const
+          {
+            if (grain_data_layout == GrainDataLayout::grain_contiguous)
+              return 2 + grain_i + mineral_i * (n_grains * 10 + 2);
+
+            return 2 + grain_i * 10 + mineral_i * (n_grains * 10 + 2);
+          }
+
+          /**
+           * Returns the index of the unrolled component @p component_i of the rotation
+           * matrix of grain @p grain_i of mineral @p mineral_i relative to the start of
+           * the cpo data in the particle data vector.
+           */
+          inline
+          unsigned int rotation_matrix_grain_index(const unsigned int mineral_i,
+                                                   const unsigned int grain_i,
+                                                   const unsigned int component_i) const
+          {
+            if (grain_data_layout == GrainDataLayout::grain_contiguous)
+              return 2 + (component_i + 1) * n_grains + grain_i + mineral_i * (n_grains * 10 + 2);
+
+            return 3 + grain_i * 10 + mineral_i * (n_grains * 10 + 2) + component_i;
+          }
+
+          /**
+           * @brief Updates the volume fractions and rotation matrices with a Forward Euler scheme
+           * for the grain contiguous data layout.
+           *
+           * This function computes the same update as advect_forward_euler(), but processes
+           * each quantity for all grains at once, so that the loops over the grains can be
+           * vectorized. It requires the grain contiguous data layout.
+           */
+          double
+          advect_forward_euler_grain_contiguous(const unsigned int cpo_data_position,
+                                                const ArrayView<double> &data,
+                                                const unsigned int mineral_i,
+                                                const double dt,
+                                                const std::pair<std::vector<double>, std::vector<Tensor<2,3>>> &derivatives) const;
+
           /**
            * Computes a random rotation matrix.
            */
@@ -558,6 +624,11 @@ namespace aspect
            */
           AdvectionMethod advection_method;
 
+          /**
+           * The layout of the grain data in the particle data vector.
+           */
+          GrainDataLayout grain_data_layout = GrainDataLayout::interleaved;
+
           /**
            * What algorithm to use to compute the derivatives
            */
@@ -52,10 +52,12 @@ namespace aspect
 
         /**
          * This function returns the input data velocity, (GPlates model or ascii data)
-         * value at a point.  This function is called from execute() function.
+         * values at all @p points in @p data_velocities. This function is called
+         * from execute() function for the quadrature points of one face at a time.
          */
-        Tensor<1,dim>
-        get_data_velocity (const Point<dim> &p) const;
+        void
+        get_data_velocities (const std::vector<Point<dim>> &points,
+                             std::vector<Tensor<1,dim>> &data_velocities) const;
 
         /**
          * Evaluate the solution statistics for some velocity residual at the top boundary.
@@ -0,0 +1,65 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _aspect_postprocess_visualization_cell_cost_h
+#define _aspect_postprocess_visualization_cell_cost_h
+
+#include <aspect/postprocess/visualization.h>
+#include <aspect/simulator_access.h>
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    namespace VisualizationPostprocessors
+    {
+      /**
+       * A class derived from CellDataVectorCreator that takes an output
+       * vector and fills it with the wall time that was measured for each
+       * cell since the last mesh change, if the 'Measure cell costs'
+       * parameter is set.
+       *
+       * The member functions are all implementations of those declared in the
+       * base class. See there for their meaning.
+       */
+      template <int dim>
+      class CellCost
+        : public CellDataVectorCreator<dim>,
+          public SimulatorAccess<dim>
+      {
+        public:
+          /**
+           * Constructor.
+           */
+          CellCost();
+
+          /**
+           * @copydoc CellDataVectorCreator<dim>::execute()
+           */
+          std::pair<std::string, std::unique_ptr<Vector<float>>>
+          execute () const override;
+      };
+    }
+  }
+}
+
+#endif
@@ -874,6 +874,36 @@ namespace aspect
        */
       void interpolate_particle_properties (const std::vector<AdvectionField> &advection_fields);
 
+      /**
+       * Compute the average_measured_cell_cost from the measured_cell_costs
+       * of all processes. This function is connected to the signals of the
+       * triangulation that are triggered before the mesh is refined or
+       * repartitioned if the 'Measure cell costs' parameter is set.
+       *
+       * This function is implemented in
+       * <code>source/simulator/helper_functions.cc</code>.
+       */
+      void compute_average_measured_cell_cost ();
+
+      /**
+       * Return the weight of a cell during repartitioning that corresponds
+       * to its measured cost, relative to the average measured cost of all
+       * cells. This function is connected to the weight signal of the
+       * triangulation if the 'Measure cell costs' parameter is set.
+       *
+       * This function is implemented in
+       * <code>source/simulator/helper_functions.cc</code>.
+       */
+#if DEAL_II_VERSION_GTE(9,6,0)
+      unsigned int
+      measured_cell_weight (const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell,
+                            const CellStatus status) const;
+#else
+      unsigned int
+      measured_cell_weight (const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell,
+                            const typename parallel::distributed::Triangulation<dim>::CellStatus status) const;
+#endif
+
       /**
        * Solve the Stokes linear system.
        *
@@ -1420,6 +1450,17 @@ namespace aspect
        */
       void initialize_current_linearization_point ();
 
+      /**
+       * If one of the "project to Q1" material averaging operations is
+       * selected and the projection_matrix_cache is empty, compute the
+       * projection matrices for the current mesh and mapping. Otherwise do
+       * nothing.
+       *
+       * This function is implemented in
+       * <code>source/simulator/helper_functions.cc</code>.
+       */
+      void update_projection_matrix_cache ();
+
       /**
        * Interpolate material model outputs onto an advection field (temperature
        * or composition). For the field identified by the AdvectionField @p adv_field, this function
@@ -1900,6 +1941,45 @@ namespace aspect
 
       mutable TimerOutput                 computing_timer;
 
+      /**
+       * If the 'Measure cell costs' parameter is set, this vector stores for
+       * every active cell (indexed by its active_cell_index()) the wall time
+       * in seconds that has been spent on this cell since the last change of
+       * the mesh. Like the computing_timer, it is mutable so that plugins
+       * that only have const access to the simulator can add their own
+       * measurements. If costs are not measured, the vector is empty.
+       */
+      mutable std::vector<double>         measured_cell_costs;
+
+      /**
+       * The average of the measured_cell_costs over all locally owned cells
+       * of all processes, computed right before the mesh is refined or
+       * repartitioned by compute_average_measured_cell_cost().
+       */
+      double                              average_measured_cell_cost;
+
+      /**
+       * The mesh refinement indicators last computed through
+       * SimulatorAccess::get_refinement_criteria() while
+       * store_refinement_indicators was true, for example by the
+       * "error indicator" visualization postprocessor. The solution and the
+       * mesh do not change between the postprocessing at the end of a time
+       * step and the mesh refinement that may follow it, so refine_mesh()
+       * uses these values instead of computing the indicators again. The
+       * vector is cleared once the mesh has been refined, or once it is
+       * clear that it will not be refined in this time step; otherwise it
+       * is empty.
+       */
+      mutable Vector<float>               cached_refinement_indicators;
+
+      /**
+       * Whether refinement indicators that are computed through
+       * SimulatorAccess::get_refinement_criteria() describe the
+       * solution and mesh the next call to refine_mesh() will work on, and
+       * should therefore be stored in cached_refinement_indicators.
+       */
+      bool                                store_refinement_indicators;
+
       /**
        * A timer used to track the current wall time since the
        * last snapshot (or since the program started).
@@ -1965,6 +2045,15 @@ namespace aspect
        * to it.
        */
       std::shared_ptr<WorldBuilder::World>                                   world_builder;
+
+      /**
+       * An object that stores the results of queries to the World Builder
+       * so that the world builder initial temperature and composition
+       * plugins can share them. The Simulator object stops caching
+       * and releases this pointer at the same time as the world builder
+       * pointer above.
+       */
+      std::shared_ptr<WorldBuilderQueryCache<dim>>                          world_builder_query_cache;
 #endif
       BoundaryVelocity::Manager<dim>                                         boundary_velocity_manager;
       BoundaryTraction::Manager<dim>                                         boundary_traction_manager;
@@ -2036,6 +2125,15 @@ namespace aspect
 
       DoFHandler<dim>                                           dof_handler;
 
+      /**
+       * The matrices used by the "project to Q1" material averaging
+       * operations on the Stokes quadrature points of every locally owned
+       * cell. The object is cleared whenever the mesh or the mapping
+       * changes, and filled again by update_projection_matrix_cache()
+       * before the next Stokes assembly.
+       */
+      MaterialModel::MaterialAveraging::ProjectionMatrixCache<dim> projection_matrix_cache;
+
       Postprocess::Manager<dim>                                 postprocess_manager;
 
       /**
@@ -44,6 +44,10 @@ namespace aspect
 {
   using namespace dealii;
 
+#ifdef ASPECT_WITH_WORLD_BUILDER
+  template <int dim> class WorldBuilderQueryCache;
+#endif
+
   // forward declarations:
   template <int dim> class Simulator;
   template <int dim> struct SimulatorSignals;
@@ -255,6 +259,19 @@ namespace aspect
       TimerOutput &
       get_computing_timer () const;
 
+      /**
+       * Return a reference to the vector that stores the wall time in seconds
+       * spent on each active cell (indexed by its active_cell_index()) since
+       * the last mesh change. These costs are used to weight cells when the
+       * mesh is repartitioned. The vector is empty unless the 'Measure cell
+       * costs' parameter is set. Like the timer, the vector is mutable in the
+       * Simulator class, which allows plugins to add the time they spend on
+       * individual cells. Different threads may add to the entries of
+       * different cells concurrently.
+       */
+      std::vector<double> &
+      get_measured_cell_costs () const;
+
       /**
        * Return a reference to the stream object that only outputs something
        * on one processor in a parallel program and simply ignores output put
@@ -402,6 +419,11 @@ namespace aspect
        * for mesh refinement. The mesh is not refined when doing so, but the
        * indicators can be used when generating graphical output to check why
        * mesh refinement is proceeding as it is.
+       *
+       * If this function is called during the postprocessing at the end of
+       * a time step, the indicators are stored and reused by a mesh
+       * refinement that directly follows, as well as by further calls of
+       * this function during the same postprocessing step.
        */
       void
       get_refinement_criteria(Vector<float> &estimated_error_per_cell) const;
@@ -821,6 +843,15 @@ namespace aspect
        */
       std::shared_ptr<const WorldBuilder::World>
       get_world_builder_pointer () const;
+
+      /**
+       * Return a shared pointer to the object that stores the results of
+       * World Builder queries during the setup of the initial conditions.
+       * Like get_world_builder_pointer(), this function can only be called
+       * during the first time step.
+       */
+      std::shared_ptr<WorldBuilderQueryCache<dim>>
+      get_world_builder_query_cache_pointer () const;
 #endif
       /**
        * Return a reference to the mesh deformation handler. This function will
@@ -64,7 +64,7 @@ namespace aspect
          * @p solution_values contains the values of the degrees of freedom.
          * @p flags controls which values should be computed.
          */
-        virtual void evaluate(const ArrayView<double> &solution_values,
+        virtual void evaluate(const ArrayView<const double> &solution_values,
                               const EvaluationFlags::EvaluationFlags flags) = 0;
 
         /**
@@ -167,7 +167,7 @@ namespace aspect
        * n_components().
        */
       void
-      evaluate(const ArrayView<double> &solution_values,
+      evaluate(const ArrayView<const double> &solution_values,
                const std::vector<EvaluationFlags::EvaluationFlags> &evaluation_flags);
 
       /**
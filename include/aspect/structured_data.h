@@ -25,7 +25,14 @@
 #include <aspect/global.h>
 #include <aspect/simulator_access.h>
 
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/bounding_box.h>
+#include <deal.II/base/table.h>
+#include <deal.II/fe/component_mask.h>
+
 #include <array>
+#include <exception>
+#include <thread>
 
 namespace aspect
 {
@@ -76,6 +83,12 @@ namespace aspect
          */
         explicit StructuredDataLookup(const double scale_factor);
 
+        /**
+         * Destructor. Waits for a background load started by
+         * start_background_load() to finish.
+         */
+        ~StructuredDataLookup();
+
         /**
          * Replace the data stored in this class by the data given to this function.
          *
@@ -147,7 +160,29 @@ namespace aspect
          * an empty vector is passed, all columns will be loaded.
          */
         void
-        load_netcdf(const std::string &filename, const std::vector<std::string> &data_column_names = {});
+        load_netcdf(const std::string &filename,
+                    const std::vector<std::string> &data_column_names = {},
+                    const MPI_Comm communicator = MPI_COMM_SELF);
+
+        /**
+         * Restrict the data read by subsequent calls to load_netcdf() (or
+         * load_file() with a NetCDF file) to the part of the data grid that
+         * covers @p region, extended by @p n_halo_points data points in
+         * each coordinate direction. Only this part of the data is read
+         * from the file and kept in memory, which allows using large
+         * (e.g., global) datasets for models that only cover a small part of
+         * the dataset. Data requested outside of the loaded region is
+         * extended by a constant value, as for points outside of the full
+         * data grid.
+         *
+         * The coordinates of @p region need to be given in the same
+         * coordinate system as the data. Coordinate directions in which
+         * the region should not be restricted can be given an infinite
+         * extent. Data in ascii files is always loaded completely.
+         */
+        void
+        restrict_to_region(const BoundingBox<dim> &region,
+                           const unsigned int n_halo_points = 2);
 
 
         /**
@@ -168,6 +203,32 @@ namespace aspect
         load_file(const std::string &filename,
                   const MPI_Comm communicator);
 
+        /**
+         * Start loading the data file @p filename in a background thread.
+         * The current data of this object remain unchanged and must not be
+         * accessed until finish_background_load() has been called, which
+         * replaces them by the new data. This allows to overlap reading and
+         * parsing a data file with other work.
+         *
+         * Only the root process of @p communicator reads the file, and it
+         * does so without any communication. NetCDF files are not read in the
+         * background, but only in finish_background_load().
+         */
+        void
+        start_background_load(const std::string &filename,
+                              const MPI_Comm communicator);
+
+        /**
+         * Wait for the data file loading started by start_background_load()
+         * to finish, and distribute the data to all processes of
+         * @p communicator, which needs to be the same communicator that was
+         * passed to start_background_load(). This function needs to be
+         * called on all processes of the communicator. If reading the file
+         * failed, the exception is rethrown on the root process.
+         */
+        void
+        finish_background_load(const MPI_Comm communicator);
+
         /**
          * Returns the computed data (velocity, temperature, etc. - according
          * to the used plugin) in Cartesian coordinates.
@@ -195,6 +256,37 @@ namespace aspect
         get_gradients(const Point<dim> &position,
                       const unsigned int component);
 
+        /**
+         * Batched version of get_data(). Computes the data at all points
+         * in @p positions for all components selected in @p component_mask.
+         * The location of each point in the data grid and the corresponding
+         * interpolation weights are only computed once per point and then
+         * reused for all selected components, which is considerably cheaper
+         * than calling get_data() for each point and component separately.
+         *
+         * @param positions The positions at which to compute the data.
+         * @param component_mask A mask that selects the data columns to
+         * compute. A default-constructed mask selects all columns.
+         * @param values On output, values[c][q] contains the value of
+         * component c at point q. The outer vector is resized to the number
+         * of data columns, and the inner vectors of all selected components
+         * are resized to the number of points. Entries of unselected
+         * components are left untouched.
+         */
+        void
+        get_data(const ArrayView<const Point<dim>> &positions,
+                 const ComponentMask &component_mask,
+                 std::vector<std::vector<double>> &values) const;
+
+        /**
+         * Batched version of get_gradients(). The arguments and the layout
+         * of @p gradients follow the batched get_data() function.
+         */
+        void
+        get_gradients(const ArrayView<const Point<dim>> &positions,
+                      const ComponentMask &component_mask,
+                      std::vector<std::vector<Tensor<1,dim>>> &gradients) const;
+
         /**
          * Returns a vector that contains the names of all data columns in the
          * order of their appearance in the data file (and their order in the
@@ -271,11 +363,36 @@ namespace aspect
         std::vector<std::string> data_component_names;
 
         /**
-         * Interpolation functions to access the data.
-         * Either InterpolatedUniformGridData or InterpolatedTensorProductGridData;
-         * the type is determined from the grid specified in the data file.
+         * The data values, one table for each data component. The values
+         * are interpolated (d-)linearly between the coordinate values; if
+         * the coordinates are equidistant the location of a point in the
+         * grid is computed directly, otherwise it is found by a binary search.
+         * Points outside of the grid are assigned the value at the closest
+         * point of the grid.
          */
-        std::vector<std::unique_ptr<Function<dim>>> data;
+        std::vector<Table<dim,double>> data_values;
+
+        /**
+         * The location of a point in the data grid: the index of the grid
+         * cell that contains the point, the coordinates of the point
+         * relative to this cell (clamped to the unit cell), and the
+         * size of the cell in each coordinate direction.
+         */
+        struct InterpolationWeights
+        {
+          TableIndices<dim> cell_index;
+          Point<dim> unit_position;
+          Tensor<1,dim> cell_size;
+        };
+
+        /**
+         * Compute the location of each point in @p positions within
+         * the data grid and store it in @p weights, which needs to have
+         * the same size as @p positions.
+         */
+        void
+        compute_interpolation_weights(const ArrayView<const Point<dim>> &positions,
+                                      const ArrayView<InterpolationWeights> &weights) const;
 
         /**
          * The coordinate values in each direction as specified in the data file.
@@ -298,12 +415,63 @@ namespace aspect
          */
         const double scale_factor;
 
+        /**
+         * Whether to only load the part of a NetCDF data file that covers
+         * data_region, and the number of additional data points to load
+         * around that region. See restrict_to_region().
+         */
+        bool restrict_data_region;
+        BoundingBox<dim> data_region;
+        unsigned int n_data_region_halo_points;
+
         /**
          * Stores whether the coordinate values are equidistant or not,
          * this determines the type of data function stored.
          */
         bool coordinate_values_are_equidistant;
 
+        /**
+         * The data of a file that is being loaded in the background by
+         * start_background_load(), together with the thread that reads it
+         * and an exception thrown while reading it, if any.
+         */
+        struct BackgroundLoad
+        {
+          std::string filename;
+          std::thread thread;
+          std::exception_ptr exception;
+          std::vector<std::string> column_names;
+          std::vector<std::vector<double>> coordinate_values;
+          std::vector<Table<dim,double>> data_tables;
+        };
+
+        BackgroundLoad background_load;
+
+        /**
+         * Read and parse the ascii data file @p filename on the current
+         * process and store its content in the remaining arguments. This
+         * function does not communicate and, apart from setting the number
+         * of components if it is not yet known, does not modify the data
+         * used by get_data(). It can therefore be called from a background
+         * thread.
+         */
+        void
+        parse_ascii(const std::string &filename,
+                    std::vector<std::string> &column_names,
+                    std::vector<std::vector<double>> &coordinate_values,
+                    std::vector<Table<dim,double>> &data_tables);
+
+        /**
+         * Distribute the data read by parse_ascii() on @p root_process to
+         * all processes of @p comm and replace the current data by it.
+         */
+        void
+        broadcast_and_reinit(std::vector<std::string> &&column_names,
+                             std::vector<std::vector<double>> &&coordinate_values,
+                             std::vector<Table<dim,double>> &&data_tables,
+                             const MPI_Comm comm,
+                             const unsigned int root_process);
+
         /**
          * Computes the table indices given the size @p sizes of the
          * entry with index @p idx.
@@ -403,6 +571,20 @@ namespace aspect
                             const Point<dim>                    &position,
                             const unsigned int                   component) const;
 
+        /**
+         * Batched version of get_data_component(). Computes the data
+         * components selected in @p component_mask at all @p positions,
+         * locating every position in the data grid only once for all
+         * selected components. The layout of @p values is the one of
+         * StructuredDataLookup::get_data(), i.e., values[c][q] is the value
+         * of component c at position q.
+         */
+        void
+        get_data_components (const types::boundary_id             boundary_indicator,
+                             const ArrayView<const Point<dim>>   &positions,
+                             const ComponentMask                 &component_mask,
+                             std::vector<std::vector<double>>    &values) const;
+
         /**
          * Returns the maximum value of the given data component.
          */
@@ -513,6 +695,28 @@ namespace aspect
         std::map<types::boundary_id,
             std::unique_ptr<aspect::Utilities::StructuredDataLookup<dim-1>>> old_lookups;
 
+        /**
+         * Whether to read the data file that will be needed next in a
+         * background thread, while the model continues with the current
+         * time step.
+         */
+        bool read_files_in_background;
+
+        /**
+         * Map between the boundary id and the data objects into which
+         * the data file that will be needed next is read in the
+         * background. Only used if read_files_in_background is set.
+         */
+        std::map<types::boundary_id,
+            std::unique_ptr<aspect::Utilities::StructuredDataLookup<dim-1>>> next_lookups;
+
+        /**
+         * Whether the objects in next_lookups are currently reading a data
+         * file in the background, and the number of that data file.
+         */
+        bool background_read_active;
+        int background_file_number;
+
         /**
          * Handles the update of the data in lookup.
          */
@@ -520,6 +724,27 @@ namespace aspect
         update_data (const types::boundary_id boundary_id,
                      const bool reload_both_files);
 
+        /**
+         * Load the data file @p filename with number @p file_number for
+         * the boundary @p boundary_id as the new current data, and move
+         * the previous current data into old_lookups. If the file was
+         * already read in the background, this only exchanges the
+         * data objects.
+         */
+        void
+        load_data_file (const types::boundary_id boundary_id,
+                        const int file_number,
+                        const std::string &filename);
+
+        /**
+         * Start reading the data files that will be needed at the next
+         * switch of data files in the background. The file number is
+         * predicted from the model time @p model_time and the current time
+         * step size.
+         */
+        void
+        start_background_read (const double model_time);
+
         /**
          * Handles settings and user notification in case the time-dependent
          * part of the boundary condition is over.
@@ -566,6 +791,19 @@ namespace aspect
         get_data_component (const Point<dim> &position,
                             const unsigned int component) const;
 
+        /**
+         * Batched version of get_data_component(). Computes the data
+         * components selected in @p component_mask at all @p positions,
+         * locating every position in the data grid only once for all
+         * selected components. The layout of @p values is the one of
+         * StructuredDataLookup::get_data(), i.e., values[c][q] is the value
+         * of component c at position q.
+         */
+        void
+        get_data_components (const ArrayView<const Point<dim>> &positions,
+                             const ComponentMask               &component_mask,
+                             std::vector<std::vector<double>>  &values) const;
+
         /**
          * Declare the parameters all derived classes take from input files.
          */
@@ -603,6 +841,13 @@ namespace aspect
          */
         bool slice_data;
 
+        /**
+         * Whether to only load the part of the dataset that covers the
+         * horizontal extent of the model domain. This is only supported
+         * for NetCDF files and box and chunk geometries.
+         */
+        bool restrict_data_to_model_domain;
+
         /**
          * The matrix that describes the rotation by which a 2D model
          * needs to be transformed to a plane that contains the origin and
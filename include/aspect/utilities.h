@@ -25,6 +25,7 @@
 #include <aspect/global.h>
 
 #include <array>
+#include <chrono>
 #include <random>
 #include <deal.II/base/point.h>
 #include <deal.II/base/conditional_ostream.h>
@@ -567,6 +568,38 @@ namespace aspect
 
     };
 
+    /**
+     * A scope guard that adds the wall time that elapses between its
+     * construction and its destruction (in seconds) to the number pointed
+     * to by the argument of the constructor. If that pointer is a nullptr,
+     * no time is measured, which makes the class cheap to use in places
+     * where measurements are optional, such as the measurement of
+     * per-cell costs for load balancing.
+     */
+    class ScopedWallTimeAccumulator
+    {
+      public:
+        explicit ScopedWallTimeAccumulator (double *accumulated_time_)
+          :
+          accumulated_time (accumulated_time_),
+          start_time (accumulated_time_ != nullptr
+                      ?
+                      std::chrono::steady_clock::now()
+                      :
+                      std::chrono::steady_clock::time_point())
+        {}
+
+        ~ScopedWallTimeAccumulator ()
+        {
+          if (accumulated_time != nullptr)
+            *accumulated_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        }
+
+      private:
+        double *accumulated_time;
+        const std::chrono::steady_clock::time_point start_time;
+    };
+
     /**
      * Checks whether a file named @p filename exists and is readable.
      *
@@ -604,6 +637,20 @@ namespace aspect
      */
     bool filename_is_url(const std::string &filename);
 
+    /**
+     * Reads the content of the ascii file @p filename on the current process
+     * and returns it as a string. In contrast to
+     * read_and_distribute_file_content() this function does not communicate,
+     * and can therefore also be called from a background thread. The
+     * supported file formats and URLs are the same as for
+     * read_and_distribute_file_content().
+     *
+     * @param [in] filename The name of the ascii file to load.
+     * @return A string which contains the data in @p filename.
+     */
+    std::string
+    read_file_content(const std::string &filename);
+
     /**
      * Reads the content of the ascii file @p filename on process 0 and
      * distributes the content by MPI_Bcast to all processes. The function
@@ -0,0 +1,222 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _aspect_world_builder_query_cache_h
+#define _aspect_world_builder_query_cache_h
+
+#include <aspect/global.h>
+
+#ifdef ASPECT_WITH_WORLD_BUILDER
+
+#include <deal.II/base/point.h>
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+namespace WorldBuilder
+{
+  class World;
+}
+
+
+namespace aspect
+{
+  using namespace dealii;
+
+  /**
+   * A class that stores the results of World Builder queries during the
+   * setup of the initial conditions. Evaluating the World Builder at a point
+   * requires computing the natural coordinates of the point, the distance
+   * to all features, and for faults and subducting plates the distance to
+   * the slab geometry. This work is the same whether the World Builder is
+   * asked for the temperature or for one of the compositions, and
+   * the world builder initial temperature and initial composition plugins
+   * would otherwise ask for the same support point once for the
+   * temperature and once for every compositional field.
+   *
+   * Instead, the plugins announce in their initialize() functions which
+   * values they need, and the first query at a point asks the World Builder
+   * for all of these values at once through WorldBuilder::World::properties().
+   * The result is stored and used for all later queries at exactly the same
+   * point, including the ones in later initial adaptive refinement cycles
+   * on cells that were not changed. The functions that take several points
+   * at once send all points that are not stored yet to the World Builder
+   * in a single query.
+   *
+   * The Simulator class owns an object of this class for as long as it owns
+   * the World Builder object, and calls stop_caching() once the initial
+   * conditions are no longer needed. After that, queries are forwarded to
+   * the World Builder without storing the results, so plugins that keep
+   * using the initial conditions later on do not accumulate memory.
+   *
+   * The stored values are distributed over a number of shards based on a
+   * hash of the point, each protected by its own reader-writer lock, so the
+   * object can be used from several threads at the same time without all
+   * threads waiting for the same lock.
+   */
+  template <int dim>
+  class WorldBuilderQueryCache
+  {
+    public:
+      /**
+       * Constructor. Store a pointer to the World Builder object that
+       * is queried for values that are not yet stored.
+       */
+      explicit WorldBuilderQueryCache (const std::shared_ptr<const ::WorldBuilder::World> &world_builder);
+
+      /**
+       * Announce that the temperature will be queried. This function has to
+       * be called before the first query.
+       */
+      void
+      request_temperature ();
+
+      /**
+       * Announce that the compositional field with index
+       * @p compositional_index will be queried. This function has to be
+       * called before the first query.
+       */
+      void
+      request_composition (const unsigned int compositional_index);
+
+      /**
+       * Return the temperature at @p position, which is located
+       * @p depth below the reference surface.
+       */
+      double
+      temperature (const Point<dim> &position,
+                   const double depth) const;
+
+      /**
+       * Return the value of the compositional field with index
+       * @p compositional_index at @p position, which is located
+       * @p depth below the reference surface.
+       */
+      double
+      composition (const Point<dim> &position,
+                   const double depth,
+                   const unsigned int compositional_index) const;
+
+      /**
+       * Compute the temperature at all of the given @p positions, which are
+       * located @p depths below the reference surface, and store it in
+       * @p temperatures. All positions that are not stored yet are sent to
+       * the World Builder in a single query.
+       */
+      void
+      temperatures (const std::vector<Point<dim>> &positions,
+                    const std::vector<double> &depths,
+                    std::vector<double> &temperatures) const;
+
+      /**
+       * Like the function above, but compute the value of the compositional
+       * field with index @p compositional_index.
+       */
+      void
+      compositions (const std::vector<Point<dim>> &positions,
+                    const std::vector<double> &depths,
+                    const unsigned int compositional_index,
+                    std::vector<double> &compositions) const;
+
+      /**
+       * Release all stored values and answer all future queries directly
+       * from the World Builder.
+       */
+      void
+      stop_caching ();
+
+    private:
+      /**
+       * Return the value with index @p value_index in the list of requested
+       * properties at @p position, either from the stored values or by
+       * querying the World Builder for all requested properties.
+       */
+      double
+      get_value (const Point<dim> &position,
+                 const double depth,
+                 const unsigned int value_index) const;
+
+      /**
+       * Like get_value(), but for all of the given @p positions. The values
+       * at all positions that are not stored yet are computed by a single
+       * call to WorldBuilder::World::properties().
+       */
+      void
+      get_values (const std::vector<Point<dim>> &positions,
+                  const std::vector<double> &depths,
+                  const unsigned int value_index,
+                  std::vector<double> &values) const;
+
+      /**
+       * A pointer to the World Builder object.
+       */
+      std::shared_ptr<const ::WorldBuilder::World> world_builder;
+
+      /**
+       * The list of properties that is requested from the World Builder in
+       * the format of WorldBuilder::World::properties(), and the index of
+       * the temperature and of each compositional field in this list (or
+       * numbers::invalid_unsigned_int if the value was not requested).
+       */
+      std::vector<std::array<unsigned int,3>> requested_properties;
+      unsigned int temperature_index;
+      std::vector<unsigned int> composition_indices;
+
+      /**
+       * Whether new results are still stored, see stop_caching().
+       */
+      std::atomic<bool> caching_enabled;
+
+      /**
+       * One part of the stored values, together with the lock that guards
+       * it. Lookups only need a shared lock, and only the insertion of new
+       * values needs an exclusive one.
+       */
+      struct Shard
+      {
+        std::shared_mutex mutex;
+        std::map<std::array<double,dim>, std::vector<double>> values;
+      };
+
+      /**
+       * The number of shards the stored values are distributed over.
+       */
+      static constexpr unsigned int n_shards = 64;
+
+      /**
+       * Return the shard that the values at @p point are stored in.
+       */
+      Shard &
+      get_shard (const std::array<double,dim> &point) const;
+
+      /**
+       * The stored values for every point that was queried so far.
+       */
+      mutable std::array<Shard,n_shards> shards;
+  };
+}
+
+#endif
+#endif
@@ -69,11 +69,17 @@ namespace aspect
     boundary_velocity (const types::boundary_id ,
                        const Point<dim> &position) const
     {
+      // Look up all velocity components at once, so that the position
+      // is only located in the data grid a single time
+      std::vector<std::vector<double>> data;
+      Utilities::AsciiDataBoundary<dim>::get_data_components(*(boundary_ids.begin()),
+                                                             make_array_view(&position, &position+1),
+                                                             ComponentMask(),
+                                                             data);
+
       Tensor<1,dim> velocity;
       for (unsigned int i = 0; i < dim; ++i)
-        velocity[i] = Utilities::AsciiDataBoundary<dim>::get_data_component(*(boundary_ids.begin()),
-                                                                            position,
-                                                                            i);
+        velocity[i] = data[i][0];
       if (use_spherical_unit_vectors)
         velocity = Utilities::Coordinates::spherical_to_cartesian_vector(velocity, position);
 
@@ -50,6 +50,27 @@ namespace aspect
     }
 
 
+    template <int dim>
+    void
+    AsciiData<dim>::
+    initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                   const unsigned int n_comp,
+                                   std::vector<double> &compositions) const
+    {
+      Assert (compositions.size() == positions.size(),
+              ExcDimensionMismatch(compositions.size(), positions.size()));
+
+      ComponentMask component_mask (this->n_compositional_fields(), false);
+      component_mask.set(n_comp, true);
+
+      std::vector<std::vector<double>> data;
+      ascii_data_initial->get_data_components(make_array_view(positions),
+                                              component_mask,
+                                              data);
+      compositions = data[n_comp];
+    }
+
+
     template <int dim>
     void
     AsciiData<dim>::declare_parameters (ParameterHandler &prm)
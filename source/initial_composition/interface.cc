@@ -33,6 +33,21 @@ namespace aspect
 {
   namespace InitialComposition
   {
+    template <int dim>
+    void
+    Interface<dim>::initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                                   const unsigned int n_comp,
+                                                   std::vector<double> &compositions) const
+    {
+      Assert (compositions.size() == positions.size(),
+              ExcDimensionMismatch(compositions.size(), positions.size()));
+
+      for (unsigned int q=0; q<positions.size(); ++q)
+        compositions[q] = this->initial_composition(positions[q], n_comp);
+    }
+
+
+
     // ------------------------------ Manager -----------------------------
     // ------------------------------ Deal with registering initial composition models and automating
     // ------------------------------ their setup and selection at run time
@@ -143,6 +158,31 @@ namespace aspect
     }
 
 
+
+    template <int dim>
+    void
+    Manager<dim>::initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                                 const unsigned int n_comp,
+                                                 std::vector<double> &compositions) const
+    {
+      Assert (compositions.size() == positions.size(),
+              ExcDimensionMismatch(compositions.size(), positions.size()));
+
+      compositions.assign (positions.size(), 0.0);
+      std::vector<double> plugin_compositions (positions.size());
+      int i = 0;
+
+      for (const auto &initial_composition_object : this->plugin_objects)
+        {
+          initial_composition_object->initial_composition_at_points(positions, n_comp, plugin_compositions);
+
+          for (unsigned int q=0; q<positions.size(); ++q)
+            compositions[q] = model_operators[i](compositions[q], plugin_compositions[q]);
+          ++i;
+        }
+    }
+
+
     template <int dim>
     const std::vector<std::string> &
     Manager<dim>::get_active_initial_composition_names () const
@@ -21,6 +21,7 @@
 #include <aspect/global.h>
 
 #ifdef ASPECT_WITH_WORLD_BUILDER
+#include <world_builder/config.h>
 #include <aspect/initial_composition/world_builder.h>
 #include <aspect/geometry_model/interface.h>
 
@@ -38,6 +39,13 @@ namespace aspect
     {
       CitationInfo::add("GWB");
       world_builder = this->get_world_builder_pointer();
+
+#if WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
+      world_builder_query_cache = this->get_world_builder_query_cache_pointer();
+      for (unsigned int c=0; c<relevant_compositions.size(); ++c)
+        if (relevant_compositions[c] == true)
+          world_builder_query_cache->request_composition(c);
+#endif
     }
 
 
@@ -48,15 +56,53 @@ namespace aspect
     initial_composition (const Point<dim> &position, const unsigned int n_comp) const
     {
       if (relevant_compositions[n_comp] == true)
+#if WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
+        return world_builder_query_cache->composition(position,
+                                                      -this->get_geometry_model().height_above_reference_surface(position),
+                                                      n_comp);
+#else
         return world_builder->composition(Utilities::convert_point_to_array(position),
                                           -this->get_geometry_model().height_above_reference_surface(position),
                                           n_comp);
+#endif
 
       return 0.0;
     }
 
 
 
+    template <int dim>
+    void
+    WorldBuilder<dim>::
+    initial_composition_at_points (const std::vector<Point<dim>> &positions,
+                                   const unsigned int n_comp,
+                                   std::vector<double> &compositions) const
+    {
+      Assert (compositions.size() == positions.size(),
+              ExcDimensionMismatch(compositions.size(), positions.size()));
+
+      if (relevant_compositions[n_comp] == false)
+        {
+          compositions.assign (positions.size(), 0.0);
+          return;
+        }
+
+      std::vector<double> depths (positions.size());
+      for (unsigned int q=0; q<positions.size(); ++q)
+        depths[q] = -this->get_geometry_model().height_above_reference_surface(positions[q]);
+
+#if WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
+      world_builder_query_cache->compositions(positions, depths, n_comp, compositions);
+#else
+      for (unsigned int q=0; q<positions.size(); ++q)
+        compositions[q] = world_builder->composition(Utilities::convert_point_to_array(positions[q]),
+                                                     depths[q],
+                                                     n_comp);
+#endif
+    }
+
+
+
     template <int dim>
     void
     WorldBuilder<dim>::declare_parameters (ParameterHandler &prm)
@@ -178,6 +178,22 @@ namespace aspect
     S40RTSPerturbation<dim>::
     get_Vs (const Point<dim> &position) const
     {
+      std::vector<double> vs(1);
+      get_Vs_at_points(std::vector<Point<dim>>(1, position), vs);
+      return vs[0];
+    }
+
+
+
+    template <int dim>
+    void
+    S40RTSPerturbation<dim>::
+    get_Vs_at_points (const std::vector<Point<dim>> &positions,
+                      std::vector<double> &vs) const
+    {
+      Assert (vs.size() == positions.size(),
+              ExcDimensionMismatch(vs.size(), positions.size()));
+
       // get the max degree from the input data file (20 or 40)
       const unsigned int max_degree_data_file = spherical_harmonics_lookup->maxdegree();
 
@@ -207,82 +223,88 @@ namespace aspect
       for (unsigned int i = 0; i<num_spline_knots; ++i)
         depth_values[i] = rcmb+(rmoho-rcmb)*0.5*(r[i]+1.);
 
-      // convert coordinates from [x,y,z] to [r, phi, theta]
-      std::array<double,dim> scoord = aspect::Utilities::Coordinates::cartesian_to_spherical_coordinates(position);
-
-      // Evaluate the spherical harmonics at this position. Since they are the
-      // same for all depth splines, do it once to avoid multiple evaluations.
-      // NOTE: there is apparently a factor of sqrt(2) difference
-      // between the standard orthonormalized spherical harmonics
-      // and those used for S40RTS (see PR # 966)
+      // Storage for the spherical harmonics and the values at the spline
+      // knots, which is reused for all positions.
       std::vector<std::vector<double>> cosine_components(max_degree_to_use+1, std::vector<double>(max_degree_to_use+1, 0.0));
       std::vector<std::vector<double>> sine_components(max_degree_to_use+1, std::vector<double>(max_degree_to_use+1, 0.0));
+      std::vector<double> spline_values(num_spline_knots, 0.);
+      std::vector<double> spline_values_inv(num_spline_knots,0);
 
-      for (unsigned int degree_l = 0; degree_l < max_degree_to_use+1; ++degree_l)
+      for (unsigned int q=0; q<positions.size(); ++q)
         {
-          for (unsigned int order_m = 0; order_m < degree_l+1; ++order_m)
+          // convert coordinates from [x,y,z] to [r, phi, theta]
+          std::array<double,dim> scoord = aspect::Utilities::Coordinates::cartesian_to_spherical_coordinates(positions[q]);
+
+          // Evaluate the spherical harmonics at this position. Since they are the
+          // same for all depth splines, do it once to avoid multiple evaluations.
+          // NOTE: there is apparently a factor of sqrt(2) difference
+          // between the standard orthonormalized spherical harmonics
+          // and those used for S40RTS (see PR # 966)
+          for (unsigned int degree_l = 0; degree_l < max_degree_to_use+1; ++degree_l)
             {
-              const double phi = scoord[1];
-              const double theta = (dim == 3) ? scoord[2] : numbers::PI_2;
-              const std::pair<double,double> sph_harm_vals =
-                Utilities::real_spherical_harmonic(degree_l, order_m, theta, phi);
+              for (unsigned int order_m = 0; order_m < degree_l+1; ++order_m)
+                {
+                  const double phi = scoord[1];
+                  const double theta = (dim == 3) ? scoord[2] : numbers::PI_2;
+                  const std::pair<double,double> sph_harm_vals =
+                    Utilities::real_spherical_harmonic(degree_l, order_m, theta, phi);
 
-              cosine_components[degree_l][order_m] = sph_harm_vals.first;
-              sine_components[degree_l][order_m] = sph_harm_vals.second;
+                  cosine_components[degree_l][order_m] = sph_harm_vals.first;
+                  sine_components[degree_l][order_m] = sph_harm_vals.second;
+                }
             }
-        }
 
-      // iterate over all degrees and orders at each depth and sum them all up.
-      std::vector<double> spline_values(num_spline_knots, 0.);
-      double prefact;
-      unsigned int ind = 0;
+          // iterate over all degrees and orders at each depth and sum them all up.
+          spline_values.assign (num_spline_knots, 0.);
+          double prefact;
+          unsigned int ind = 0;
 
-      for (unsigned int depth_interp = 0; depth_interp < num_spline_knots; ++depth_interp)
-        {
-          for (unsigned int degree_l = 0; degree_l < max_degree_to_use+1; ++degree_l)
+          for (unsigned int depth_interp = 0; depth_interp < num_spline_knots; ++depth_interp)
             {
-              for (unsigned int order_m = 0; order_m < degree_l+1; ++order_m)
+              for (unsigned int degree_l = 0; degree_l < max_degree_to_use+1; ++degree_l)
                 {
-                  if (degree_l == 0)
-                    prefact = (zero_out_degree_0
-                               ?
-                               0.
-                               :
-                               1.);
-                  else if (order_m != 0)
-                    // this removes the sqrt(2) factor difference in normalization (see PR # 966)
-                    prefact = 1./std::sqrt(2.);
-                  else
-                    prefact = 1.0;
-
-                  spline_values[depth_interp] += prefact * (a_lm[ind] * cosine_components[degree_l][order_m]
-                                                            + b_lm[ind] * sine_components[degree_l][order_m]);
-
-                  ++ind;
+                  for (unsigned int order_m = 0; order_m < degree_l+1; ++order_m)
+                    {
+                      if (degree_l == 0)
+                        prefact = (zero_out_degree_0
+                                   ?
+                                   0.
+                                   :
+                                   1.);
+                      else if (order_m != 0)
+                        // this removes the sqrt(2) factor difference in normalization (see PR # 966)
+                        prefact = 1./std::sqrt(2.);
+                      else
+                        prefact = 1.0;
+
+                      spline_values[depth_interp] += prefact * (a_lm[ind] * cosine_components[degree_l][order_m]
+                                                                + b_lm[ind] * sine_components[degree_l][order_m]);
+
+                      ++ind;
+                    }
                 }
+              // Skip the higher degree spherical harminic coefficients per layer if a lower max degree is used.
+              // The formula below will calculate the total number of the spherical harmonic coefficients from
+              // the degree at max_degree_to_use+1 to the degree at max_degree_data_file.
+              // The formula below will be zero if the spherical harmonics are summed up to the degree at max_degree_data_file.
+              ind += (max_degree_to_use+max_degree_data_file+3)*(max_degree_data_file-max_degree_to_use)/2;
             }
-          // Skip the higher degree spherical harminic coefficients per layer if a lower max degree is used.
-          // The formula below will calculate the total number of the spherical harmonic coefficients from
-          // the degree at max_degree_to_use+1 to the degree at max_degree_data_file.
-          // The formula below will be zero if the spherical harmonics are summed up to the degree at max_degree_data_file.
-          ind += (max_degree_to_use+max_degree_data_file+3)*(max_degree_data_file-max_degree_to_use)/2;
-        }
 
-      // We need to reorder the spline_values because the coefficients are given from
-      // the surface down to the CMB and the interpolation knots range from the CMB up to
-      // the surface.
-      std::vector<double> spline_values_inv(num_spline_knots,0);
-      for (unsigned int i=0; i<num_spline_knots; ++i)
-        spline_values_inv[i] = spline_values[num_spline_knots-1 - i];
+          // We need to reorder the spline_values because the coefficients are given from
+          // the surface down to the CMB and the interpolation knots range from the CMB up to
+          // the surface.
+          for (unsigned int i=0; i<num_spline_knots; ++i)
+            spline_values_inv[i] = spline_values[num_spline_knots-1 - i];
 
-      // The boundary condition for the cubic spline interpolation is that the function is linear
-      // at the boundary (i.e. Moho and CMB). Values outside the range are linearly
-      // extrapolated.
-      aspect::Utilities::tk::spline s;
-      s.set_points(depth_values, spline_values_inv);
+          // The boundary condition for the cubic spline interpolation is that the function is linear
+          // at the boundary (i.e. Moho and CMB). Values outside the range are linearly
+          // extrapolated.
+          aspect::Utilities::tk::spline s;
+          s.set_points(depth_values, spline_values_inv);
 
-      // Return value of Vs perturbation at specific depth
-      return s(scoord[0]);
+          // Value of Vs perturbation at specific depth
+          vs[q] = s(scoord[0]);
+        }
     }
 
 
@@ -291,65 +313,101 @@ namespace aspect
     S40RTSPerturbation<dim>::
     initial_temperature (const Point<dim> &position) const
     {
+      std::vector<double> temperature(1);
+      initial_temperature_at_points(std::vector<Point<dim>>(1, position), temperature);
+      return temperature[0];
+    }
+
+
+
+    template <int dim>
+    void
+    S40RTSPerturbation<dim>::
+    initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                   std::vector<double> &temperatures) const
+    {
+      Assert (temperatures.size() == positions.size(),
+              ExcDimensionMismatch(temperatures.size(), positions.size()));
 
       // use either the user-input reference temperature as background temperature
       // (incompressible model) or the adiabatic temperature profile (compressible model)
-      const double background_temperature = this->get_material_model().is_compressible() ?
-                                            this->get_adiabatic_conditions().temperature(position) :
-                                            reference_temperature;
+      std::vector<double> background_temperatures (positions.size(), reference_temperature);
+      if (this->get_material_model().is_compressible())
+        for (unsigned int q=0; q<positions.size(); ++q)
+          background_temperatures[q] = this->get_adiabatic_conditions().temperature(positions[q]);
 
       //Read in Vs perturbation data using function above
-      const double perturbation = get_Vs (position);
-
-
-      // Get the vs to density conversion
-      const double depth = this->get_geometry_model().depth(position);
+      std::vector<double> perturbations (positions.size());
+      get_Vs_at_points (positions, perturbations);
+
+      // Get the depths and the indices of all positions below the depth
+      // down to which the temperature heterogeneity is removed
+      std::vector<double> depths (positions.size());
+      std::vector<unsigned int> perturbed_points;
+      for (unsigned int q=0; q<positions.size(); ++q)
+        {
+          depths[q] = this->get_geometry_model().depth(positions[q]);
+          if (depths[q] > no_perturbation_depth)
+            perturbed_points.push_back(q);
+        }
 
-      double vs_to_density = 0.0;
-      if (vs_to_density_method == file)
-        vs_to_density = profile.get_data_component(Point<1>(depth), vs_to_density_index);
-      else if (vs_to_density_method == constant)
-        vs_to_density = vs_to_density_constant;
-      else
-        // we shouldn't get here but instead should already have been
-        // kicked out by the assertion in the parse_parameters()
-        // function
-        Assert (false, ExcNotImplemented());
-
-      // scale the perturbation in seismic velocity into a density perturbation
-      // vs_to_density is an input parameter
-      const double density_perturbation = vs_to_density * perturbation;
-
-      double temperature_perturbation;
-      if (depth > no_perturbation_depth)
+      // see if we need to ask material model for the thermal expansion coefficient,
+      // which is done for all perturbed positions at once
+      std::vector<double> thermal_expansion_coefficients (perturbed_points.size(), thermal_alpha);
+      if (use_material_model_thermal_alpha && perturbed_points.size() > 0)
         {
-          // scale the density perturbation into a temperature perturbation
-          // see if we need to ask material model for the thermal expansion coefficient
-          if (use_material_model_thermal_alpha)
+          MaterialModel::MaterialModelInputs<dim> in(perturbed_points.size(), this->n_compositional_fields());
+          MaterialModel::MaterialModelOutputs<dim> out(perturbed_points.size(), this->n_compositional_fields());
+          for (unsigned int i=0; i<perturbed_points.size(); ++i)
             {
-              MaterialModel::MaterialModelInputs<dim> in(1, this->n_compositional_fields());
-              MaterialModel::MaterialModelOutputs<dim> out(1, this->n_compositional_fields());
-              in.position[0] = position;
-              in.temperature[0] = background_temperature;
-              in.pressure[0] = this->get_adiabatic_conditions().pressure(position);
-              in.velocity[0] = Tensor<1,dim> ();
-              for (unsigned int c=0; c<this->n_compositional_fields(); ++c)
-                in.composition[0][c] = this->get_initial_composition_manager().initial_composition(position, c);
-              in.requested_properties = MaterialModel::MaterialProperties::thermal_expansion_coefficient;
-
-              this->get_material_model().evaluate(in, out);
-
-              temperature_perturbation = -1./(out.thermal_expansion_coefficients[0]) * density_perturbation;
+              const unsigned int q = perturbed_points[i];
+              in.position[i] = positions[q];
+              in.temperature[i] = background_temperatures[q];
+              in.pressure[i] = this->get_adiabatic_conditions().pressure(positions[q]);
+              in.velocity[i] = Tensor<1,dim> ();
             }
-          else
-            temperature_perturbation = -1./thermal_alpha * density_perturbation;
+
+          std::vector<double> composition_values (perturbed_points.size());
+          for (unsigned int c=0; c<this->n_compositional_fields(); ++c)
+            {
+              this->get_initial_composition_manager().initial_composition_at_points(in.position, c, composition_values);
+              for (unsigned int i=0; i<perturbed_points.size(); ++i)
+                in.composition[i][c] = composition_values[i];
+            }
+          in.requested_properties = MaterialModel::MaterialProperties::thermal_expansion_coefficient;
+
+          this->get_material_model().evaluate(in, out);
+
+          thermal_expansion_coefficients = out.thermal_expansion_coefficients;
         }
-      else
-        // set heterogeneity to zero down to a specified depth
-        temperature_perturbation = 0.0;
 
-      // add the temperature perturbation to the background temperature
-      return background_temperature + temperature_perturbation;
+      // set heterogeneity to zero down to a specified depth
+      temperatures = background_temperatures;
+
+      for (unsigned int i=0; i<perturbed_points.size(); ++i)
+        {
+          const unsigned int q = perturbed_points[i];
+
+          // Get the vs to density conversion
+          double vs_to_density = 0.0;
+          if (vs_to_density_method == file)
+            vs_to_density = profile.get_data_component(Point<1>(depths[q]), vs_to_density_index);
+          else if (vs_to_density_method == constant)
+            vs_to_density = vs_to_density_constant;
+          else
+            // we shouldn't get here but instead should already have been
+            // kicked out by the assertion in the parse_parameters()
+            // function
+            Assert (false, ExcNotImplemented());
+
+          // scale the perturbation in seismic velocity into a density perturbation
+          // vs_to_density is an input parameter
+          const double density_perturbation = vs_to_density * perturbations[q];
+
+          // scale the density perturbation into a temperature perturbation
+          // and add it to the background temperature
+          temperatures[q] += -1./thermal_expansion_coefficients[i] * density_perturbation;
+        }
     }
 
 
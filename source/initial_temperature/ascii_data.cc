@@ -48,6 +48,23 @@ namespace aspect
     }
 
 
+    template <int dim>
+    void
+    AsciiData<dim>::
+    initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                   std::vector<double> &temperatures) const
+    {
+      Assert (temperatures.size() == positions.size(),
+              ExcDimensionMismatch(temperatures.size(), positions.size()));
+
+      std::vector<std::vector<double>> data;
+      Utilities::AsciiDataInitial<dim>::get_data_components(make_array_view(positions),
+                                                            ComponentMask(),
+                                                            data);
+      temperatures = data[0];
+    }
+
+
     template <int dim>
     void
     AsciiData<dim>::declare_parameters (ParameterHandler &prm)
@@ -32,6 +32,20 @@ namespace aspect
 {
   namespace InitialTemperature
   {
+    template <int dim>
+    void
+    Interface<dim>::initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                                   std::vector<double> &temperatures) const
+    {
+      Assert (temperatures.size() == positions.size(),
+              ExcDimensionMismatch(temperatures.size(), positions.size()));
+
+      for (unsigned int q=0; q<positions.size(); ++q)
+        temperatures[q] = this->initial_temperature(positions[q]);
+    }
+
+
+
     // ------------------------------ Manager -----------------------------
     // -------------------------------- Deal with registering initial_temperature models and automating
     // -------------------------------- their setup and selection at run time
@@ -132,6 +146,30 @@ namespace aspect
     }
 
 
+
+    template <int dim>
+    void
+    Manager<dim>::initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                                 std::vector<double> &temperatures) const
+    {
+      Assert (temperatures.size() == positions.size(),
+              ExcDimensionMismatch(temperatures.size(), positions.size()));
+
+      temperatures.assign (positions.size(), 0.0);
+      std::vector<double> plugin_temperatures (positions.size());
+      int i = 0;
+
+      for (const auto &initial_temperature_object : this->plugin_objects)
+        {
+          initial_temperature_object->initial_temperature_at_points(positions, plugin_temperatures);
+
+          for (unsigned int q=0; q<positions.size(); ++q)
+            temperatures[q] = model_operators[i](temperatures[q], plugin_temperatures[q]);
+          ++i;
+        }
+    }
+
+
     template <int dim>
     const std::vector<std::string> &
     Manager<dim>::get_active_initial_temperature_names () const
@@ -44,6 +44,11 @@ namespace aspect
     {
       CitationInfo::add("GWB");
       world_builder = this->get_world_builder_pointer();
+
+#if WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
+      world_builder_query_cache = this->get_world_builder_query_cache_pointer();
+      world_builder_query_cache->request_temperature();
+#endif
     }
 
 
@@ -53,8 +58,8 @@ namespace aspect
     initial_temperature (const Point<dim> &position) const
     {
 #if WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
-      return world_builder->temperature(Utilities::convert_point_to_array(position),
-                                        -this->get_geometry_model().height_above_reference_surface(position));
+      return world_builder_query_cache->temperature(position,
+                                                    -this->get_geometry_model().height_above_reference_surface(position));
 #else
 
       return world_builder->temperature(Utilities::convert_point_to_array(position),
@@ -63,6 +68,31 @@ namespace aspect
 #endif
     }
 
+
+
+    template <int dim>
+    void
+    WorldBuilder<dim>::
+    initial_temperature_at_points (const std::vector<Point<dim>> &positions,
+                                   std::vector<double> &temperatures) const
+    {
+      Assert (temperatures.size() == positions.size(),
+              ExcDimensionMismatch(temperatures.size(), positions.size()));
+
+      std::vector<double> depths (positions.size());
+      for (unsigned int q=0; q<positions.size(); ++q)
+        depths[q] = -this->get_geometry_model().height_above_reference_surface(positions[q]);
+
+#if WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
+      world_builder_query_cache->temperatures(positions, depths, temperatures);
+#else
+      for (unsigned int q=0; q<positions.size(); ++q)
+        temperatures[q] = world_builder->temperature(Utilities::convert_point_to_array(positions[q]),
+                                                     depths[q],
+                                                     this->get_gravity_model().gravity_vector(positions[q]).norm());
+#endif
+    }
+
   }
 }
 
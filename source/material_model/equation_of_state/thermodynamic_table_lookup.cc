@@ -194,10 +194,15 @@ namespace aspect
                 double invk_reuss = 0.;
                 double invmu_reuss = 0.;
 
+                using Property = MaterialModel::MaterialUtilities::Lookup::MaterialLookup::Property;
+                const std::vector<Property> properties = {Property::density, Property::seismic_Vs, Property::seismic_Vp};
+                std::vector<double> values(properties.size());
+
                 for (unsigned int j = 0; j < material_lookup.size(); ++j)
                   {
-                    const double mu = material_lookup[j]->density(in.temperature[i],in.pressure[i])*Utilities::fixed_power<2>(material_lookup[j]->seismic_Vs(in.temperature[i],in.pressure[i]));
-                    const double k =  material_lookup[j]->density(in.temperature[i],in.pressure[i])*Utilities::fixed_power<2>(material_lookup[j]->seismic_Vp(in.temperature[i],in.pressure[i])) - 4./3.*mu;
+                    material_lookup[j]->evaluate(in.temperature[i], in.pressure[i], properties, values);
+                    const double mu = values[0]*Utilities::fixed_power<2>(values[1]);
+                    const double k =  values[0]*Utilities::fixed_power<2>(values[2]) - 4./3.*mu;
 
                     k_voigt += volume_fractions[i][j] * k;
                     mu_voigt += volume_fractions[i][j] * mu;
@@ -320,6 +325,18 @@ namespace aspect
       evaluate(const MaterialModel::MaterialModelInputs<dim> &in,
                std::vector<MaterialModel::EquationOfStateOutputs<dim>> &eos_outputs) const
       {
+        using Property = MaterialModel::MaterialUtilities::Lookup::MaterialLookup::Property;
+
+        // Only calculate the non-reactive specific heat and
+        // thermal expansivity if latent heat is to be ignored.
+        std::vector<Property> properties = {Property::density, Property::dRhodp};
+        if (!latent_heat)
+          {
+            properties.push_back(Property::thermal_expansivity);
+            properties.push_back(Property::specific_heat);
+          }
+        std::vector<double> values(properties.size());
+
         for (unsigned int i=0; i < in.n_evaluation_points(); ++i)
           {
             const double pressure = in.pressure[i];
@@ -327,15 +344,15 @@ namespace aspect
 
             for (unsigned int j=0; j<eos_outputs[i].densities.size(); ++j)
               {
-                eos_outputs[i].densities[j] = material_lookup[j]->density(temperature, pressure);
-                eos_outputs[i].compressibilities[j] = material_lookup[j]->dRhodp(temperature, pressure)/eos_outputs[i].densities[j];
+                material_lookup[j]->evaluate(temperature, pressure, properties, values);
+
+                eos_outputs[i].densities[j] = values[0];
+                eos_outputs[i].compressibilities[j] = values[1]/eos_outputs[i].densities[j];
 
-                // Only calculate the non-reactive specific heat and
-                // thermal expansivity if latent heat is to be ignored.
                 if (!latent_heat)
                   {
-                    eos_outputs[i].thermal_expansion_coefficients[j] = material_lookup[j]->thermal_expansivity(temperature, pressure);
-                    eos_outputs[i].specific_heat_capacities[j] = material_lookup[j]->specific_heat(temperature, pressure);
+                    eos_outputs[i].thermal_expansion_coefficients[j] = values[2];
+                    eos_outputs[i].specific_heat_capacities[j] = values[3];
                   }
 
                 eos_outputs[i].entropy_derivative_pressure[j] = 0.;
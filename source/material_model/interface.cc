@@ -773,6 +773,129 @@ namespace aspect
       }
 
 
+
+      template <int dim>
+      void
+      ProjectionMatrixCache<dim>::reinit (const DoFHandler<dim> &dof_handler,
+                                          const Mapping<dim>    &mapping,
+                                          const Quadrature<dim> &quadrature_formula)
+      {
+        static const FE_Q<dim> fe(1);
+        FEValues<dim> fe_values (mapping, fe, quadrature_formula,
+                                 update_JxW_values);
+
+        const unsigned int P = fe.dofs_per_cell;
+        const unsigned int N = quadrature_formula.size();
+        const unsigned int n_cells = dof_handler.get_triangulation().n_active_cells();
+
+        quadrature = quadrature_formula;
+
+        // the values of the Q1 shape functions at the quadrature points
+        // do not depend on the cell, so compute the matrix E once
+        reference_expansion_matrix.reinit (N, P);
+        for (unsigned int q=0; q<N; ++q)
+          for (unsigned int i=0; i<P; ++i)
+            reference_expansion_matrix(q,i) = fe.shape_value(i, quadrature_formula.point(q));
+
+        inverse_mass_matrices.reinit (n_cells, P*P);
+        JxW_values.reinit (n_cells, N);
+
+        FullMatrix<double> M (P, P);
+        for (const auto &cell : dof_handler.active_cell_iterators())
+          if (cell->is_locally_owned())
+            {
+              // as in compute_projection_matrix(), we only need the
+              // geometry of the cell
+              fe_values.reinit (typename Triangulation<dim>::active_cell_iterator(cell));
+
+              const unsigned int cell_index = cell->active_cell_index();
+
+              M = 0;
+              for (unsigned int i=0; i<P; ++i)
+                for (unsigned int j=0; j<P; ++j)
+                  for (unsigned int q=0; q<N; ++q)
+                    M(i,j) += reference_expansion_matrix(q,i) *
+                              reference_expansion_matrix(q,j) *
+                              fe_values.JxW(q);
+
+              M.gauss_jordan();
+
+              for (unsigned int i=0; i<P; ++i)
+                for (unsigned int j=0; j<P; ++j)
+                  inverse_mass_matrices(cell_index, i*P+j) = M(i,j);
+
+              for (unsigned int q=0; q<N; ++q)
+                JxW_values(cell_index, q) = fe_values.JxW(q);
+            }
+      }
+
+
+
+      template <int dim>
+      void
+      ProjectionMatrixCache<dim>::clear ()
+      {
+        quadrature = Quadrature<dim>();
+        reference_expansion_matrix.reinit (0, 0);
+        inverse_mass_matrices.reinit (0, 0);
+        JxW_values.reinit (0, 0);
+      }
+
+
+
+      template <int dim>
+      bool
+      ProjectionMatrixCache<dim>::empty () const
+      {
+        return inverse_mass_matrices.empty();
+      }
+
+
+
+      template <int dim>
+      bool
+      ProjectionMatrixCache<dim>::is_applicable (const typename DoFHandler<dim>::active_cell_iterator &cell,
+                                                 const Quadrature<dim> &quadrature_formula) const
+      {
+        return (empty() == false
+                &&
+                cell->is_locally_owned()
+                &&
+                cell->active_cell_index() < inverse_mass_matrices.size(0)
+                &&
+                quadrature_formula == quadrature);
+      }
+
+
+
+      template <int dim>
+      void
+      ProjectionMatrixCache<dim>::get_matrices (const typename DoFHandler<dim>::active_cell_iterator &cell,
+                                                FullMatrix<double> &projection_matrix,
+                                                FullMatrix<double> &expansion_matrix) const
+      {
+        Assert (is_applicable (cell, quadrature), ExcInternalError());
+
+        const unsigned int N = reference_expansion_matrix.m();
+        const unsigned int P = reference_expansion_matrix.n();
+        const unsigned int cell_index = cell->active_cell_index();
+
+        expansion_matrix = reference_expansion_matrix;
+
+        // form M^{-1} F with F_{jq} = E_{qj} |J(x_q)| w_q
+        projection_matrix.reinit (P, N);
+        for (unsigned int i=0; i<P; ++i)
+          for (unsigned int q=0; q<N; ++q)
+            {
+              double sum = 0;
+              for (unsigned int j=0; j<P; ++j)
+                sum += inverse_mass_matrices(cell_index, i*P+j) *
+                       reference_expansion_matrix(q,j);
+              projection_matrix(i,q) = sum * JxW_values(cell_index, q);
+            }
+      }
+
+
       /**
        * Calculate the weight for viscosity derivative, which depends on
        * the material averaging scheme. Currently the newton method is
@@ -821,7 +944,8 @@ namespace aspect
                     const Quadrature<dim>         &quadrature_formula,
                     const Mapping<dim>            &mapping,
                     const MaterialProperties::Property &requested_properties,
-                    MaterialModelOutputs<dim>     &values_out)
+                    MaterialModelOutputs<dim>     &values_out,
+                    const ProjectionMatrixCache<dim> *projection_matrix_cache)
       {
         if (operation == none)
           return;
@@ -839,13 +963,22 @@ namespace aspect
                     ExcMessage("When asking for a Q1-type averaging operation, "
                                "this function requires to know the locations of "
                                "the evaluation points."));
-            projection_matrix.reinit (quadrature_formula.size(),
-                                      quadrature_formula.size());
-            compute_projection_matrix (cell,
-                                       quadrature_formula,
-                                       mapping,
-                                       projection_matrix,
-                                       expansion_matrix);
+            if (projection_matrix_cache != nullptr
+                &&
+                projection_matrix_cache->is_applicable (cell, quadrature_formula))
+              projection_matrix_cache->get_matrices (cell,
+                                                     projection_matrix,
+                                                     expansion_matrix);
+            else
+              {
+                projection_matrix.reinit (quadrature_formula.size(),
+                                          quadrature_formula.size());
+                compute_projection_matrix (cell,
+                                           quadrature_formula,
+                                           mapping,
+                                           projection_matrix,
+                                           expansion_matrix);
+              }
           }
 
         // store the original viscosities if we need to compute the
@@ -1249,13 +1382,16 @@ namespace aspect
   \
   namespace MaterialAveraging \
   { \
+    template class ProjectionMatrixCache<dim>; \
+    \
     template                \
     void average (const AveragingOperation operation, \
                   const DoFHandler<dim>::active_cell_iterator &cell, \
                   const Quadrature<dim>     &quadrature_formula, \
                   const Mapping<dim>        &mapping, \
                   const MaterialProperties::Property &requested_properties, \
-                  MaterialModelOutputs<dim> &values_out); \
+                  MaterialModelOutputs<dim> &values_out, \
+                  const ProjectionMatrixCache<dim> *projection_matrix_cache); \
   }
 
 
@@ -24,9 +24,11 @@
 extern "C" {
 #include <perplex_c.h>
 }
-#include <deal.II/base/multithread_info.h>
 #endif
 
+#include <algorithm>
+#include <cmath>
+
 namespace aspect
 {
   namespace MaterialModel
@@ -37,9 +39,6 @@ namespace aspect
     PerpleXLookup<dim>::initialize()
     {
 #ifdef ASPECT_WITH_PERPLEX
-      AssertThrow(dealii::MultithreadInfo::is_running_single_threaded(),
-                  ExcMessage("The PerpleXLookup MaterialModel only works in single threaded mode (do not use -j)!"));
-
       ini_phaseq(perplex_file_name.c_str()); // this line initializes meemum
 #else
       Assert (false, ExcMessage("ASPECT has not been compiled with the PerpleX libraries"));
@@ -54,6 +53,149 @@ namespace aspect
       return true;
     }
 
+
+
+    template <int dim>
+    std::size_t
+    PerpleXLookup<dim>::CacheKeyHash::operator() (const CacheKey &key) const
+    {
+      std::size_t seed = key.size();
+      for (const std::int64_t k : key)
+        seed ^= std::hash<std::int64_t>()(k) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      return seed;
+    }
+
+
+
+    template <int dim>
+    typename PerpleXLookup<dim>::MaterialProperties
+    PerpleXLookup<dim>::
+    compute_material_properties (const double temperature,
+                                 const double pressure,
+                                 const std::vector<double> &composition) const
+    {
+#ifdef ASPECT_WITH_PERPLEX
+      std::vector<double> wtphases(p_size_phases);
+      std::vector<double> cphases(p_size_phases * p_size_components);
+      std::vector<char> namephases(p_size_phases * p_pname_len);
+      std::vector<double> sysprop(p_size_sysprops);
+
+      int phaseq_dbg = 0;
+
+      // phaseq does not modify the composition, but takes a non-const pointer
+      std::vector<double> comp = composition;
+      const unsigned int n_comp = comp.size();
+
+      // Here is the call to PerpleX/meemum. PerpleX stores its state in
+      // global variables, so only one thread may call it at a time.
+      int nphases;
+      {
+        std::lock_guard<std::mutex> lock(perplex_mutex);
+        phaseq(pressure/1.e5, temperature,
+               n_comp, comp.data(), &nphases, wtphases.data(), cphases.data(),
+               sysprop.data(), namephases.data(), phaseq_dbg);
+      }
+
+      AssertThrow(!isnan(sysprop[9]) && !isnan(sysprop[11]) && !isnan(sysprop[12]) && !isnan(sysprop[13]),
+                  ExcMessage("PerpleX returned NaN for at least one material property at " +
+                             std::to_string(pressure) +" bar, " +
+                             std::to_string(temperature) + " K. Aborting. " +
+                             "Please adjust the P-T bounds in the parameter file or adjust the PerpleX files."));
+
+      return {{
+          sysprop[9],
+          sysprop[11]*(1000./sysprop[16]), // molar Cp * (1000/molar mass) (g)
+          sysprop[12],
+          sysprop[13]*1.e5
+        }
+      };
+#else
+      (void)temperature;
+      (void)pressure;
+      (void)composition;
+      Assert (false, ExcMessage("ASPECT has not been compiled with the PerpleX libraries"));
+      return MaterialProperties();
+#endif
+    }
+
+
+
+    template <int dim>
+    typename PerpleXLookup<dim>::MaterialProperties
+    PerpleXLookup<dim>::
+    get_material_properties (const double temperature,
+                             const double pressure,
+                             const std::vector<double> &composition) const
+    {
+      // Round the inputs to the cache resolution. PerpleX is evaluated at the
+      // rounded values, so that the result does not depend on which point
+      // created the cache entry.
+      CacheKey key(2 + composition.size());
+      key[0] = std::llround(temperature / cache_temperature_resolution);
+      key[1] = std::llround(pressure / cache_pressure_resolution);
+      for (unsigned int c=0; c<composition.size(); ++c)
+        key[2+c] = std::llround(composition[c] / cache_composition_resolution);
+
+      // Cache hits only require shared access to the cache, so they can be
+      // served to several threads at the same time.
+      {
+        std::shared_lock<std::shared_mutex> lock(cache_mutex);
+        const auto entry = cache.find(key);
+        if (entry != cache.end())
+          {
+            entry->second.last_access.store(++cache_access_counter, std::memory_order_relaxed);
+            return entry->second.properties;
+          }
+      }
+
+      const double rounded_temperature = std::min(max_temperature,
+                                                  std::max(min_temperature,
+                                                           key[0] * cache_temperature_resolution));
+      const double rounded_pressure = std::min(max_pressure,
+                                               std::max(min_pressure,
+                                                        key[1] * cache_pressure_resolution));
+      std::vector<double> rounded_composition(composition.size());
+      for (unsigned int c=0; c<composition.size(); ++c)
+        rounded_composition[c] = key[2+c] * cache_composition_resolution;
+
+      const MaterialProperties properties = compute_material_properties(rounded_temperature,
+                                                                        rounded_pressure,
+                                                                        rounded_composition);
+
+      std::unique_lock<std::shared_mutex> lock(cache_mutex);
+
+      // If the cache is full, remove the least recently used quarter
+      // of the entries. Removing several entries at once avoids
+      // having to search for the oldest entry on every insertion.
+      if (cache.size() >= max_cache_size)
+        {
+          std::vector<std::uint64_t> access_times;
+          access_times.reserve(cache.size());
+          for (const auto &entry : cache)
+            access_times.push_back(entry.second.last_access.load(std::memory_order_relaxed));
+
+          const std::size_t n_remove = std::max<std::size_t>(1, cache.size()/4);
+          std::nth_element(access_times.begin(), access_times.begin() + (n_remove-1), access_times.end());
+          const std::uint64_t oldest_kept_access = access_times[n_remove-1];
+
+          for (auto entry = cache.begin(); entry != cache.end();)
+            if (entry->second.last_access.load(std::memory_order_relaxed) <= oldest_kept_access)
+              entry = cache.erase(entry);
+            else
+              ++entry;
+        }
+
+      // Another thread may have inserted the same entry in the meantime,
+      // in which case try_emplace keeps the existing one.
+      CacheEntry &entry = cache.try_emplace(std::move(key)).first->second;
+      entry.properties = properties;
+      entry.last_access.store(++cache_access_counter, std::memory_order_relaxed);
+
+      return properties;
+    }
+
+
+
     template <int dim>
     void
     PerpleXLookup<dim>::
@@ -66,15 +208,6 @@ namespace aspect
        * points, and if the grid is fine, it should be a reasonable
        * approximation
        */
-
-#ifdef ASPECT_WITH_PERPLEX
-      std::vector<double> wtphases(p_size_phases);
-      std::vector<double> cphases(p_size_phases * p_size_components);
-      std::vector<char> namephases(p_size_phases * p_pname_len);
-      std::vector<double> sysprop(p_size_sysprops);
-
-      int phaseq_dbg = 0;
-
       unsigned int n_quad = in.n_evaluation_points(); // number of quadrature points in cell
       unsigned int n_comp = in.composition[0].size(); // number of components in rock
 
@@ -100,34 +233,21 @@ namespace aspect
           comp[c] /= (double)n_quad;
         }
 
-      // Here is the call to PerpleX/meemum
-      int nphases;
-
-      phaseq(average_pressure/1.e5, average_temperature,
-             n_comp, comp.data(), &nphases, wtphases.data(), cphases.data(),
-             sysprop.data(), namephases.data(), phaseq_dbg);
-
-      AssertThrow(!isnan(sysprop[9]) && !isnan(sysprop[11]) && !isnan(sysprop[12]) && !isnan(sysprop[13]),
-                  ExcMessage("PerpleX returned NaN for at least one material property at " +
-                             std::to_string(average_pressure) +" bar, " +
-                             std::to_string(average_temperature) + " K. Aborting. " +
-                             "Please adjust the P-T bounds in the parameter file or adjust the PerpleX files."));
+      const MaterialProperties properties = (max_cache_size > 0
+                                             ?
+                                             get_material_properties(average_temperature, average_pressure, comp)
+                                             :
+                                             compute_material_properties(average_temperature, average_pressure, comp));
 
       for (unsigned int i=0; i<n_quad; ++i)
         {
           out.viscosities[i] = eta;
           out.thermal_conductivities[i] = k_value;
-          out.densities[i] = sysprop[9];
-          out.specific_heat[i] = sysprop[11]*(1000./sysprop[16]); // molar Cp * (1000/molar mass) (g)
-          out.thermal_expansion_coefficients[i] = sysprop[12];
-          out.compressibilities[i] = sysprop[13]*1.e5;
+          out.densities[i] = properties[0];
+          out.specific_heat[i] = properties[1];
+          out.thermal_expansion_coefficients[i] = properties[2];
+          out.compressibilities[i] = properties[3];
         }
-#else
-      (void)in;
-      (void)out;
-      Assert (false, ExcMessage("ASPECT has not been compiled with the PerpleX libraries"));
-#endif
-
     }
 
 
@@ -167,6 +287,32 @@ namespace aspect
                              Patterns::Double (0.),
                              "The value of the maximum pressure used to query PerpleX. "
                              "Units: \\si{\\pascal}.");
+          prm.declare_entry ("Cache size", "0",
+                             Patterns::Integer (0),
+                             "The maximum number of material property evaluations "
+                             "that are stored to avoid calling PerpleX again for "
+                             "similar temperatures, pressures and compositions. "
+                             "If the cache is full, the least recently used "
+                             "entries are removed. A value of zero disables the "
+                             "cache, and PerpleX is called for every evaluation.");
+          prm.declare_entry ("Cache temperature resolution", "1.",
+                             Patterns::Double (0.),
+                             "The resolution to which the temperature is rounded before "
+                             "looking up or storing material properties in the cache. "
+                             "Only used if the cache is enabled. "
+                             "Units: \\si{\\kelvin}.");
+          prm.declare_entry ("Cache pressure resolution", "1.e6",
+                             Patterns::Double (0.),
+                             "The resolution to which the pressure is rounded before "
+                             "looking up or storing material properties in the cache. "
+                             "Only used if the cache is enabled. "
+                             "Units: \\si{\\pascal}.");
+          prm.declare_entry ("Cache composition resolution", "1.e-4",
+                             Patterns::Double (0.),
+                             "The resolution to which the amount of each component of the "
+                             "bulk composition is rounded before looking up or storing "
+                             "material properties in the cache. Only used if the cache "
+                             "is enabled. Units: none.");
 
         }
         prm.leave_subsection();
@@ -191,6 +337,17 @@ namespace aspect
           max_temperature     = prm.get_double ("Maximum material temperature");
           min_pressure        = prm.get_double ("Minimum material pressure");
           max_pressure        = prm.get_double ("Maximum material pressure");
+          max_cache_size      = prm.get_integer ("Cache size");
+          cache_temperature_resolution = prm.get_double ("Cache temperature resolution");
+          cache_pressure_resolution    = prm.get_double ("Cache pressure resolution");
+          cache_composition_resolution = prm.get_double ("Cache composition resolution");
+
+          AssertThrow(max_cache_size == 0 ||
+                      (cache_temperature_resolution > 0. &&
+                       cache_pressure_resolution > 0. &&
+                       cache_composition_resolution > 0.),
+                      ExcMessage("The cache resolutions of the PerpleX lookup model "
+                                 "need to be larger than zero if the cache is enabled."));
         }
         prm.leave_subsection();
       }
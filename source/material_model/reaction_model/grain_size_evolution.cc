@@ -168,6 +168,40 @@ namespace aspect
         || timestep == 0.0)
         return;
 
+        // Precompute all quantities that do not depend on the grain size. They are
+        // constant while solving the ODE, but the right-hand side below is evaluated
+        // for all points in every stage of every ODE step. Storing them in separate
+        // arrays also keeps the loop over all points in the right-hand side short.
+        std::vector<double> partitioning_fractions (n_evaluation_points, 0.0);
+        std::vector<double> adiabatic_temperatures (n_evaluation_points);
+        std::vector<double> grain_growth_arrhenius_factors (n_evaluation_points);
+        std::vector<double> pinned_grain_growth_factors (n_evaluation_points, 1.0);
+        std::vector<double> second_strain_rate_invariants (n_evaluation_points);
+
+        for (unsigned int i=0; i<n_evaluation_points; ++i)
+          {
+            // The partitioning fraction is only used for the pinned_grain_damage formulation.
+            if (grain_size_evolution_formulation == Formulation::pinned_grain_damage)
+              partitioning_fractions[i] = compute_partitioning_fraction(in.temperature[i]);
+
+            adiabatic_temperatures[i] = this->get_adiabatic_conditions().is_initialized()
+                                        ?
+                                        this->get_adiabatic_conditions().temperature(in.position[i])
+                                        :
+                                        in.temperature[i];
+
+            grain_growth_arrhenius_factors[i] = std::exp(- (grain_growth_activation_energy[phase_indices[i]] + pressures[i] * grain_growth_activation_volume[phase_indices[i]])
+                                                         / (constants::gas_constant * in.temperature[i]));
+
+            // in the two-phase damage model grain growth depends on the proportion of the two phases
+            if (grain_size_evolution_formulation == Formulation::pinned_grain_damage)
+              pinned_grain_growth_factors[i] = geometric_constant[phase_indices[i]] * phase_distribution /
+                                               std::pow(roughness_to_grain_size, grain_growth_exponent[phase_indices[i]]);
+
+            const SymmetricTensor<2,dim> shear_strain_rate = in.strain_rate[i] - 1./dim * trace(in.strain_rate[i]) * unit_symmetric_tensor<dim>();
+            second_strain_rate_invariants[i] = std::sqrt(std::max(-second_invariant(shear_strain_rate), 0.));
+          }
+
         SUNDIALS::ARKode<VectorType>::AdditionalData data;
 
         data.initial_time = 0.0;
@@ -193,43 +227,24 @@ namespace aspect
           for (unsigned int i=0; i<n_evaluation_points; ++i)
             {
               const double grain_size = std::max(minimum_grain_size, y[i]);
-
-              // Precompute the partitioning_fraction since it is constant during the evolution.
-              // This is only used for the pinned_grain_damage formulation.
-              const double partitioning_fraction = (grain_size_evolution_formulation == Formulation::pinned_grain_damage)
-                                                   ?
-                                                   compute_partitioning_fraction(in.temperature[i])
-                                                   :
-                                                   0.0;
+              const double partitioning_fraction = partitioning_fractions[i];
+              const double adiabatic_temperature = adiabatic_temperatures[i];
+              const double second_strain_rate_invariant = second_strain_rate_invariants[i];
 
               // We keep the dislocation viscosity of the last iteration as guess
               // for the next one.
               double current_dislocation_viscosity = 0.0;
 
-              const double adiabatic_temperature = this->get_adiabatic_conditions().is_initialized()
-                                                   ?
-                                                   this->get_adiabatic_conditions().temperature(in.position[i])
-                                                   :
-                                                   in.temperature[i];
-
-
-
               // grain size growth due to Ostwald ripening
               const double m = grain_growth_exponent[phase_indices[i]];
 
               double grain_size_growth_rate = grain_growth_rate_constant[phase_indices[i]] / (m * std::pow(grain_size,m-1))
-                                              * std::exp(- (grain_growth_activation_energy[phase_indices[i]] + pressures[i] * grain_growth_activation_volume[phase_indices[i]])
-                                                         / (constants::gas_constant * in.temperature[i]));
+                                              * grain_growth_arrhenius_factors[i];
 
-              // in the two-phase damage model grain growth depends on the proportion of the two phases
               if (grain_size_evolution_formulation == Formulation::pinned_grain_damage)
-                grain_size_growth_rate *= geometric_constant[phase_indices[i]] * phase_distribution /
-                                          std::pow(roughness_to_grain_size, m);
+                grain_size_growth_rate *= pinned_grain_growth_factors[i];
 
               // grain size reduction in dislocation creep regime
-              const SymmetricTensor<2,dim> shear_strain_rate = in.strain_rate[i] - 1./dim * trace(in.strain_rate[i]) * unit_symmetric_tensor<dim>();
-              const double second_strain_rate_invariant = std::sqrt(std::max(-second_invariant(shear_strain_rate), 0.));
-
               const double current_diffusion_viscosity   = diffusion_viscosity(in.temperature[i], adiabatic_temperature, pressures[i], grain_size, second_strain_rate_invariant, phase_indices[i]);
               current_dislocation_viscosity = dislocation_viscosity(in.temperature[i], adiabatic_temperature, pressures[i], in.strain_rate[i], phase_indices[i], current_diffusion_viscosity, current_dislocation_viscosity);
 
@@ -290,16 +305,22 @@ namespace aspect
             // phase transition, if we crossed one.
             int crossed_transition = -1;
 
-            const double gravity_norm = this->get_gravity_model().gravity_vector(in.position[i]).norm();
             Tensor<1,dim> vertical_direction = this->get_gravity_model().gravity_vector(in.position[i]);
+            const double gravity_norm = vertical_direction.norm();
             if (gravity_norm > 0.0)
               vertical_direction /= gravity_norm;
 
+            const double depth = (n_phase_transitions > 0
+                                  ?
+                                  this->get_geometry_model().depth(in.position[i])
+                                  :
+                                  0.0);
+            const double distance_moved = in.velocity[i] * vertical_direction * timestep;
+
             for (unsigned int phase=0; phase<n_phase_transitions; ++phase)
               {
                 // Both distances are positive when they are downward from the transition (since gravity points down)
-                const double distance_from_transition = this->get_geometry_model().depth(in.position[i]) - phase_function->get_transition_depth(phase);
-                const double distance_moved = in.velocity[i] * vertical_direction * timestep;
+                const double distance_from_transition = depth - phase_function->get_transition_depth(phase);
 
                 // To make sure we actually reset the grain size of all the material passing through
                 // the transition, we take 110% of the distance a grain has moved for the check.
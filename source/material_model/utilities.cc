@@ -45,54 +45,126 @@ namespace aspect
     {
       namespace Lookup
       {
+        namespace
+        {
+          /**
+           * The index of each tabulated property in the innermost
+           * dimension of MaterialLookup::property_values.
+           */
+          constexpr unsigned int density_index = 0;
+          constexpr unsigned int thermal_expansivity_index = 1;
+          constexpr unsigned int specific_heat_index = 2;
+          constexpr unsigned int vp_index = 3;
+          constexpr unsigned int vs_index = 4;
+          constexpr unsigned int enthalpy_index = 5;
+        }
+
+
+
+        void
+        MaterialLookup::evaluate(const double temperature,
+                                 const double pressure,
+                                 const std::vector<Property> &properties,
+                                 std::vector<double> &values) const
+        {
+          const TablePosition position = table_position(temperature, pressure);
+
+          values.resize(properties.size());
+          for (unsigned int i=0; i<properties.size(); ++i)
+            switch (properties[i])
+              {
+                case Property::density:
+                  values[i] = property_value(position, density_index, interpolation);
+                  break;
+                case Property::thermal_expansivity:
+                  values[i] = property_value(position, thermal_expansivity_index, interpolation);
+                  break;
+                case Property::specific_heat:
+                  values[i] = property_value(position, specific_heat_index, interpolation);
+                  break;
+                case Property::seismic_Vp:
+                  values[i] = property_value(position, vp_index, false);
+                  break;
+                case Property::seismic_Vs:
+                  values[i] = property_value(position, vs_index, false);
+                  break;
+                case Property::enthalpy:
+                  values[i] = property_value(position, enthalpy_index, true);
+                  break;
+                case Property::dHdT:
+                {
+                  const double h = property_value(position, enthalpy_index, interpolation);
+                  const double dh = property_value(table_position(temperature+delta_temp, pressure), enthalpy_index, interpolation);
+                  values[i] = (dh - h) / delta_temp;
+                  break;
+                }
+                case Property::dHdp:
+                {
+                  const double h = property_value(position, enthalpy_index, interpolation);
+                  const double dh = property_value(table_position(temperature, pressure+delta_press), enthalpy_index, interpolation);
+                  values[i] = (dh - h) / delta_press;
+                  break;
+                }
+                case Property::dRhodp:
+                {
+                  const double rho = property_value(position, density_index, interpolation);
+                  const double drho = property_value(table_position(temperature, pressure+delta_press), density_index, interpolation);
+                  values[i] = (drho - rho) / delta_press;
+                  break;
+                }
+                default:
+                  Assert(false, ExcNotImplemented());
+              }
+        }
+
         double
         MaterialLookup::specific_heat(const double temperature,
                                       const double pressure) const
         {
-          return value(temperature,pressure,specific_heat_values,interpolation);
+          return property_value(table_position(temperature,pressure),specific_heat_index,interpolation);
         }
 
         double
         MaterialLookup::density(const double temperature,
                                 const double pressure) const
         {
-          return value(temperature,pressure,density_values,interpolation);
+          return property_value(table_position(temperature,pressure),density_index,interpolation);
         }
 
         double
         MaterialLookup::thermal_expansivity(const double temperature,
                                             const double pressure) const
         {
-          return value(temperature,pressure,thermal_expansivity_values,interpolation);
+          return property_value(table_position(temperature,pressure),thermal_expansivity_index,interpolation);
         }
 
         double
         MaterialLookup::seismic_Vp(const double temperature,
                                    const double pressure) const
         {
-          return value(temperature,pressure,vp_values,false);
+          return property_value(table_position(temperature,pressure),vp_index,false);
         }
 
         double
         MaterialLookup::seismic_Vs(const double temperature,
                                    const double pressure) const
         {
-          return value(temperature,pressure,vs_values,false);
+          return property_value(table_position(temperature,pressure),vs_index,false);
         }
 
         double
         MaterialLookup::enthalpy(const double temperature,
                                  const double pressure) const
         {
-          return value(temperature,pressure,enthalpy_values,true);
+          return property_value(table_position(temperature,pressure),enthalpy_index,true);
         }
 
         double
         MaterialLookup::dHdT (const double temperature,
                               const double pressure) const
         {
-          const double h = value(temperature,pressure,enthalpy_values,interpolation);
-          const double dh = value(temperature+delta_temp,pressure,enthalpy_values,interpolation);
+          const double h = property_value(table_position(temperature,pressure),enthalpy_index,interpolation);
+          const double dh = property_value(table_position(temperature+delta_temp,pressure),enthalpy_index,interpolation);
           return (dh - h) / delta_temp;
         }
 
@@ -100,8 +172,8 @@ namespace aspect
         MaterialLookup::dHdp (const double temperature,
                               const double pressure) const
         {
-          const double h = value(temperature,pressure,enthalpy_values,interpolation);
-          const double dh = value(temperature,pressure+delta_press,enthalpy_values,interpolation);
+          const double h = property_value(table_position(temperature,pressure),enthalpy_index,interpolation);
+          const double dh = property_value(table_position(temperature,pressure+delta_press),enthalpy_index,interpolation);
           return (dh - h) / delta_press;
         }
 
@@ -182,8 +254,8 @@ namespace aspect
         MaterialLookup::dRhodp (const double temperature,
                                 const double pressure) const
         {
-          const double rho = value(temperature,pressure,density_values,interpolation);
-          const double drho = value(temperature,pressure+delta_press,density_values,interpolation);
+          const double rho = property_value(table_position(temperature,pressure),density_index,interpolation);
+          const double drho = property_value(table_position(temperature,pressure+delta_press),density_index,interpolation);
           return (drho - rho) / delta_press;
         }
 
@@ -275,6 +347,79 @@ namespace aspect
           return values[inT][inp];
         }
 
+        MaterialLookup::TablePosition
+        MaterialLookup::table_position (const double temperature,
+                                        const double pressure) const
+        {
+          const double nT = get_nT(temperature);
+          const double np = get_np(pressure);
+
+          TablePosition position;
+          position.inT = static_cast<unsigned int>(nT);
+          position.inp = static_cast<unsigned int>(np);
+          position.xi = nT-position.inT;
+          position.eta = np-position.inp;
+
+          Assert(position.inT<property_values.size(0), ExcMessage("Attempting to look up a temperature value with index greater than the number of rows."));
+          Assert(position.inp<property_values.size(1), ExcMessage("Attempting to look up a pressure value with index greater than the number of columns."));
+
+          return position;
+        }
+
+        double
+        MaterialLookup::property_value (const TablePosition &position,
+                                        const unsigned int property_index,
+                                        const bool interpol) const
+        {
+          const unsigned int inT = position.inT;
+          const unsigned int inp = position.inp;
+
+          if (!interpol)
+            return property_values[inT][inp][property_index];
+          else
+            {
+              const double xi = position.xi;
+              const double eta = position.eta;
+
+              Assert ((0 <= xi) && (xi <= 1), ExcInternalError());
+              Assert ((0 <= eta) && (eta <= 1), ExcInternalError());
+
+              // use these coordinates for a bilinear interpolation
+              return ((1-xi)*(1-eta)*property_values[inT][inp][property_index] +
+                      xi    *(1-eta)*property_values[inT+1][inp][property_index] +
+                      (1-xi)*eta    *property_values[inT][inp+1][property_index] +
+                      xi    *eta    *property_values[inT+1][inp+1][property_index]);
+            }
+        }
+
+        void
+        MaterialLookup::setup_property_table (const MPI_Comm comm)
+        {
+          const std::array<Table<2,double> *,n_tabulated_properties> property_tables =
+          {{
+              &density_values, &thermal_expansivity_values, &specific_heat_values,
+              &vp_values, &vs_values, &enthalpy_values
+            }
+          };
+
+          property_values.reinit(n_temperature, n_pressure, n_tabulated_properties);
+          for (unsigned int i=0; i<n_temperature; ++i)
+            for (unsigned int j=0; j<n_pressure; ++j)
+              for (unsigned int k=0; k<n_tabulated_properties; ++k)
+                property_values[i][j][k] = (*property_tables[k])[i][j];
+
+          for (Table<2,double> *table : property_tables)
+            *table = Table<2,double>();
+
+          // All processes have read the same data, so only keep one copy
+          // per machine.
+          property_values.replicate_across_communicator(comm, 0);
+          for (auto &phase_volume_fraction : phase_volume_fractions)
+            phase_volume_fraction.replicate_across_communicator(comm, 0);
+          if (dominant_phase_indices.n_elements() > 0)
+            dominant_phase_indices.replicate_across_communicator(comm, 0);
+        }
+
         std::array<double,2>
         MaterialLookup::get_pT_steps() const
         {
@@ -507,6 +652,8 @@ namespace aspect
                   ++i;
                 }
             }
+
+          setup_property_table(comm);
         }
 
         PerplexReader::PerplexReader(const std::string &filename,
@@ -787,6 +934,7 @@ namespace aspect
             }
           AssertThrow(i == n_temperature*n_pressure, ExcMessage("Material table size not consistent with header."));
 
+          setup_property_table(comm);
         }
 
 
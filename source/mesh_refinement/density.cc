@@ -52,28 +52,16 @@ namespace aspect
       LinearAlgebra::BlockVector vec_distributed (this->introspection().index_sets.system_partitioning,
                                                   this->get_mpi_communicator());
 
-      const Quadrature<dim> quadrature(this->get_fe().base_element(this->introspection().base_elements.temperature).get_unit_support_points());
-      std::vector<types::global_dof_index> local_dof_indices (this->get_fe().dofs_per_cell);
-      FEValues<dim> fe_values (this->get_mapping(),
-                               this->get_fe(),
-                               quadrature,
-                               update_quadrature_points | update_values | update_gradients);
+      // the material model has already been evaluated in these points
+      // by the Manager, see get_required_material_properties()
+      const SupportPointMaterialData<dim> &material_data
+        = this->get_mesh_refinement_manager().get_support_point_material_data();
 
-      MaterialModel::MaterialModelInputs<dim> in(quadrature.size(),
-                                                 this->n_compositional_fields());
-      MaterialModel::MaterialModelOutputs<dim> out(quadrature.size(),
-                                                   this->n_compositional_fields());
-      in.requested_properties = MaterialModel::MaterialProperties::density;
+      std::vector<types::global_dof_index> local_dof_indices (this->get_fe().dofs_per_cell);
 
       for (const auto &cell : this->get_dof_handler().active_cell_iterators())
         if (cell->is_locally_owned())
           {
-            fe_values.reinit(cell);
-            // Set use_strain_rates to false since we don't need viscosity
-            in.reinit(fe_values, cell, this->introspection(), this->get_solution());
-
-            this->get_material_model().evaluate(in, out);
-
             cell->get_dof_indices (local_dof_indices);
 
             // for each temperature dof, write into the output
@@ -86,7 +74,7 @@ namespace aspect
                                                              /*dof index within component=*/i);
 
                 vec_distributed(local_dof_indices[system_local_dof])
-                  = out.densities[i];
+                  = material_data.densities[material_data.index(cell,i)];
               }
           }
 
@@ -116,6 +104,15 @@ namespace aspect
         if (cell->is_locally_owned())
           indicators(cell->active_cell_index()) *= std::pow(cell->diameter(), power);
     }
+
+
+
+    template <int dim>
+    MaterialModel::MaterialProperties::Property
+    Density<dim>::get_required_material_properties () const
+    {
+      return MaterialModel::MaterialProperties::density;
+    }
   }
 }
 
@@ -22,6 +22,10 @@
 #include <aspect/mesh_refinement/interface.h>
 #include <aspect/utilities.h>
 
+#include <deal.II/base/work_stream.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/grid/filtered_iterator.h>
+
 #include <typeinfo>
 
 
@@ -29,6 +33,57 @@ namespace aspect
 {
   namespace MeshRefinement
   {
+    namespace
+    {
+      /**
+       * Scratch data used by each thread to evaluate the material model in
+       * the support points of the temperature element in
+       * Manager::compute_support_point_material_data().
+       */
+      template <int dim>
+      struct SupportPointMaterialScratchData
+      {
+        SupportPointMaterialScratchData (const Mapping<dim> &mapping,
+                                         const FiniteElement<dim> &finite_element,
+                                         const Quadrature<dim> &quadrature,
+                                         const unsigned int n_compositional_fields,
+                                         const MaterialModel::MaterialProperties::Property requested_properties)
+          :
+          fe_values (mapping,
+                     finite_element,
+                     quadrature,
+                     update_quadrature_points | update_values | update_gradients),
+          in (quadrature.size(), n_compositional_fields),
+          out (quadrature.size(), n_compositional_fields)
+        {
+          in.requested_properties = requested_properties;
+        }
+
+        SupportPointMaterialScratchData (const SupportPointMaterialScratchData &scratch)
+          :
+          fe_values (scratch.fe_values.get_mapping(),
+                     scratch.fe_values.get_fe(),
+                     scratch.fe_values.get_quadrature(),
+                     scratch.fe_values.get_update_flags()),
+          in (scratch.in),
+          out (scratch.out)
+        {}
+
+        FEValues<dim> fe_values;
+        MaterialModel::MaterialModelInputs<dim> in;
+        MaterialModel::MaterialModelOutputs<dim> out;
+      };
+
+
+
+      /**
+       * Every cell writes its values directly into its own part of the
+       * shared vectors, so there is nothing to copy.
+       */
+      struct SupportPointMaterialCopyData
+      {};
+    }
+
 // ------------------------------ Interface -----------------------------
 
     template <int dim>
@@ -47,6 +102,15 @@ namespace aspect
 
 
 
+    template <int dim>
+    MaterialModel::MaterialProperties::Property
+    Interface<dim>::get_required_material_properties () const
+    {
+      return MaterialModel::MaterialProperties::uninitialized;
+    }
+
+
+
 // ------------------------------ Manager -----------------------------
 
     template <int dim>
@@ -55,6 +119,39 @@ namespace aspect
     {
       Assert (this->plugin_objects.size() > 0, ExcInternalError());
 
+      // first evaluate the material model for all properties any of the
+      // plugins needs, so that every plugin does not have to do this
+      // on its own
+      MaterialModel::MaterialProperties::Property required_properties = MaterialModel::MaterialProperties::uninitialized;
+      for (const auto &p : this->plugin_objects)
+        required_properties = required_properties | p->get_required_material_properties();
+
+      if (required_properties != MaterialModel::MaterialProperties::uninitialized)
+        {
+          try
+            {
+              compute_support_point_material_data (required_properties);
+            }
+          // see below for why we abort the program here
+          catch (std::exception &exc)
+            {
+              std::cerr << std::endl << std::endl
+                        << "----------------------------------------------------"
+                        << std::endl;
+              std::cerr << "Exception on MPI process <"
+                        << Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)
+                        << "> while evaluating the material model for the mesh refinement plugins: "
+                        << std::endl
+                        << exc.what() << std::endl
+                        << "Aborting!" << std::endl
+                        << "----------------------------------------------------"
+                        << std::endl;
+
+              // terminate the program!
+              MPI_Abort (MPI_COMM_WORLD, 1);
+            }
+        }
+
       // call the execute() functions of all plugins we have
       // here in turns. then normalize the output vector and
       // verify that its values are non-negative numbers
@@ -156,6 +253,96 @@ namespace aspect
           default:
             Assert (false, ExcNotImplemented());
         }
+
+      // release the memory of the shared material model outputs
+      support_point_material_data = SupportPointMaterialData<dim>();
+    }
+
+
+
+    template <int dim>
+    const SupportPointMaterialData<dim> &
+    Manager<dim>::get_support_point_material_data () const
+    {
+      Assert (support_point_material_data.computed_properties != MaterialModel::MaterialProperties::uninitialized,
+              ExcMessage ("The material model outputs for the mesh refinement criteria "
+                          "can only be accessed from within the execute() function of a "
+                          "criterion that requests them through get_required_material_properties()."));
+      return support_point_material_data;
+    }
+
+
+
+    template <int dim>
+    void
+    Manager<dim>::compute_support_point_material_data (const MaterialModel::MaterialProperties::Property properties) const
+    {
+      const Introspection<dim> &introspection = this->introspection();
+      const Quadrature<dim> quadrature(this->get_fe().base_element(introspection.base_elements.temperature).get_unit_support_points());
+      const unsigned int n_support_points = quadrature.size();
+
+      const bool store_densities = (properties & MaterialModel::MaterialProperties::density) != 0;
+      const bool store_viscosities = (properties & MaterialModel::MaterialProperties::viscosity) != 0;
+      const bool store_specific_heat = (properties & MaterialModel::MaterialProperties::specific_heat) != 0;
+
+      SupportPointMaterialData<dim> &data = support_point_material_data;
+      data.computed_properties = properties;
+      data.n_support_points = n_support_points;
+
+      const std::size_t n_values = static_cast<std::size_t>(this->get_triangulation().n_active_cells()) * n_support_points;
+      data.temperatures.resize (n_values);
+      if (store_densities)
+        data.densities.resize (n_values);
+      if (store_viscosities)
+        data.viscosities.resize (n_values);
+      if (store_specific_heat)
+        data.specific_heat.resize (n_values);
+
+      // every cell writes into its own part of the output vectors, so
+      // the worker can store the values directly and there is nothing
+      // left to do for the copier
+      auto worker = [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+                        SupportPointMaterialScratchData<dim> &scratch,
+                        SupportPointMaterialCopyData &)
+      {
+        scratch.fe_values.reinit (cell);
+        scratch.in.reinit (scratch.fe_values,
+                           cell,
+                           introspection,
+                           this->get_solution());
+        this->get_material_model().evaluate (scratch.in, scratch.out);
+
+        const std::size_t offset = data.index(cell, 0);
+        for (unsigned int i=0; i<n_support_points; ++i)
+          {
+            data.temperatures[offset+i] = scratch.in.temperature[i];
+            if (store_densities)
+              data.densities[offset+i] = scratch.out.densities[i];
+            if (store_viscosities)
+              data.viscosities[offset+i] = scratch.out.viscosities[i];
+            if (store_specific_heat)
+              data.specific_heat[offset+i] = scratch.out.specific_heat[i];
+          }
+      };
+
+      auto copier = [](const SupportPointMaterialCopyData &)
+      {};
+
+      using CellFilter = FilteredIterator<typename DoFHandler<dim>::active_cell_iterator>;
+
+      WorkStream::
+      run (CellFilter (IteratorFilters::LocallyOwnedCell(),
+                       this->get_dof_handler().begin_active()),
+           CellFilter (IteratorFilters::LocallyOwnedCell(),
+                       this->get_dof_handler().end()),
+           worker,
+           copier,
+           SupportPointMaterialScratchData<dim> (this->get_mapping(),
+                                                 this->get_fe(),
+                                                 quadrature,
+                                                 this->n_compositional_fields(),
+                                                 properties),
+           SupportPointMaterialCopyData());
     }
 
 
@@ -52,31 +52,16 @@ namespace aspect
       LinearAlgebra::BlockVector vec_distributed (this->introspection().index_sets.system_partitioning,
                                                   this->get_mpi_communicator());
 
-      const Quadrature<dim> quadrature(this->get_fe().base_element(this->introspection().base_elements.temperature).get_unit_support_points());
+      // the material model has already been evaluated in these points
+      // by the Manager, see get_required_material_properties()
+      const SupportPointMaterialData<dim> &material_data
+        = this->get_mesh_refinement_manager().get_support_point_material_data();
+
       std::vector<types::global_dof_index> local_dof_indices (this->get_fe().dofs_per_cell);
-      FEValues<dim> fe_values (this->get_mapping(),
-                               this->get_fe(),
-                               quadrature,
-                               update_quadrature_points | update_values | update_gradients);
-
-      // the values of the compositional fields are stored as block vectors for each field
-      // we have to extract them in this structure
-      std::vector<std::vector<double>> prelim_composition_values (this->n_compositional_fields(),
-                                                                   std::vector<double> (quadrature.size()));
-
-      MaterialModel::MaterialModelInputs<dim> in(quadrature.size(),
-                                                 this->n_compositional_fields());
-      MaterialModel::MaterialModelOutputs<dim> out(quadrature.size(),
-                                                   this->n_compositional_fields());
-      in.requested_properties = MaterialModel::MaterialProperties::viscosity;
 
       for (const auto &cell : this->get_dof_handler().active_cell_iterators())
         if (cell->is_locally_owned())
           {
-            fe_values.reinit(cell);
-            in.reinit(fe_values, cell, this->introspection(), this->get_solution());
-            this->get_material_model().evaluate(in, out);
-
             cell->get_dof_indices (local_dof_indices);
 
             // for each temperature dof, write into the output
@@ -89,7 +74,7 @@ namespace aspect
                                                              /*dof index within component=*/i);
 
                 vec_distributed(local_dof_indices[system_local_dof])
-                  = std::log(out.viscosities[i]);
+                  = std::log(material_data.viscosities[material_data.index(cell,i)]);
               }
           }
 
@@ -119,6 +104,15 @@ namespace aspect
         if (cell->is_locally_owned())
           indicators(cell->active_cell_index()) *= std::pow(cell->diameter(), power);
     }
+
+
+
+    template <int dim>
+    MaterialModel::MaterialProperties::Property
+    Viscosity<dim>::get_required_material_properties () const
+    {
+      return MaterialModel::MaterialProperties::viscosity;
+    }
   }
 }
 
@@ -45,14 +45,13 @@ namespace aspect
           }
 
         // Read data lines
-        types::particle_index particle_index = 0;
+        std::vector<Point<dim>> particle_positions;
         Point<dim> particle_position;
 
         while (in >> particle_position)
-          {
-            this->insert_particle_at_position(particle_position, particle_index, particle_handler);
-            ++particle_index;
-          }
+          particle_positions.push_back(particle_position);
+
+        this->insert_particles_at_positions(particle_positions, 0, particle_handler);
         particle_handler.update_cached_numbers();
       }
 
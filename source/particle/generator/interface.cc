@@ -21,7 +21,13 @@
 #include <aspect/particle/generator/interface.h>
 
 #include <tuple>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/mapping_cartesian.h>
+#include <deal.II/fe/mapping_q.h>
 #include <deal.II/grid/grid_tools.h>
+#include <deal.II/numerics/rtree.h>
 
 #include <boost/lexical_cast.hpp>
 
@@ -31,12 +37,80 @@ namespace aspect
   {
     namespace Generator
     {
+      namespace
+      {
+        /**
+         * Return how far a cell described by the given @p mapping can extend
+         * beyond the bounding box of its mapping support points, as a
+         * multiple of the side length of this box in each coordinate
+         * direction. Return a negative number if this is not known for the
+         * given mapping.
+         *
+         * A MappingQ of degree p interpolates the mapping support points,
+         * which are the tensor product of the p+1 Gauss-Lobatto points, with
+         * the tensor product Lagrange polynomials. Each coordinate of the
+         * mapped cell is therefore at most the Lebesgue constant of these
+         * polynomials times half the side length of the box away from its
+         * center. The Lebesgue constant of the tensor product is the dim-th
+         * power of the one of the 1d polynomials, which is computed here by
+         * sampling. Cells of degree one, and the cells of a MappingCartesian,
+         * are contained in the box of their vertices.
+         */
+        template <int dim>
+        double
+        relative_bounding_box_extension (const Mapping<dim> &mapping)
+        {
+          if (dynamic_cast<const MappingCartesian<dim> *>(&mapping) != nullptr)
+            return 0.;
+
+          const MappingQ<dim> *mapping_q = dynamic_cast<const MappingQ<dim> *>(&mapping);
+          if (mapping_q == nullptr)
+            return -1.;
+
+          const unsigned int degree = mapping_q->get_degree();
+          if (degree == 1)
+            return 0.;
+
+          const std::vector<Polynomials::Polynomial<double>> lagrange_polynomials
+            = Polynomials::generate_complete_Lagrange_basis(QGaussLobatto<1>(degree+1).get_points());
+
+          const unsigned int n_samples = 100*degree;
+          double lebesgue_constant = 1.;
+          for (unsigned int i=0; i<=n_samples; ++i)
+            {
+              const double x = static_cast<double>(i)/n_samples;
+              double sum = 0.;
+              for (const auto &polynomial : lagrange_polynomials)
+                sum += std::abs(polynomial.value(x));
+              lebesgue_constant = std::max(lebesgue_constant, sum);
+            }
+
+          // Add a safety margin, since the maximum of the sum is only
+          // sampled.
+          return 0.5 * (1.1 * std::pow(lebesgue_constant, dim) - 1.);
+        }
+      }
+
+
+
       template <int dim>
       void
       Interface<dim>::initialize ()
       {
         const unsigned int my_rank = Utilities::MPI::this_mpi_process(this->get_mpi_communicator());
         random_number_generator.seed(5432+my_rank);
+
+        // The grid cache only notices changes of the triangulation, but not
+        // the displacement of the mesh by the mapping. Rebuild its search
+        // structures the next time they are used after the mesh was deformed.
+        this->get_signals().post_mesh_deformation.connect(
+          [&](const SimulatorAccess<dim> &)
+        {
+          std::lock_guard<std::mutex> lock(grid_cache_mutex);
+          if (grid_cache != nullptr)
+            grid_cache->mark_for_update(GridTools::CacheUpdateFlags::update_all);
+        }
+        );
       }
 
 
@@ -76,7 +150,7 @@ namespace aspect
         // Try to find the cell of the given position.
         const std::pair<const typename parallel::distributed::Triangulation<dim>::active_cell_iterator,
               Point<dim>> it =
-                GridTools::find_active_cell_around_point<> (this->get_mapping(), this->get_triangulation(), position);
+                GridTools::find_active_cell_around_point<> (get_grid_cache(), position);
 
         if (it.first.state() != IteratorState::valid || it.first->is_locally_owned() == false)
           return particle_handler.end();
@@ -86,6 +160,142 @@ namespace aspect
 
 
 
+      template <int dim>
+      void
+      Interface<dim>::insert_particles_at_positions(const std::vector<Point<dim>> &positions,
+                                                    const types::particle_index first_id,
+                                                    Particles::ParticleHandler<dim> &particle_handler) const
+      {
+        const GridTools::Cache<dim> &cache = get_grid_cache();
+
+        // Build all search structures of the cache that
+        // find_active_cell_around_point() uses before the parallel loop
+        // below, since the cache is not thread-safe while it (re)computes
+        // them.
+        {
+          std::lock_guard<std::mutex> lock(grid_cache_mutex);
+          cache.get_used_vertices();
+          cache.get_used_vertices_rtree();
+          cache.get_vertex_to_cell_map();
+          cache.get_vertex_to_cell_centers_directions();
+        }
+
+        using active_cell_iterator = typename parallel::distributed::Triangulation<dim>::active_cell_iterator;
+
+        // Most positions are usually located in cells that are owned by
+        // other processes. Discard them with an R-tree of the bounding boxes
+        // of the locally owned cells. The bounding boxes are computed from
+        // the mapping support points, and curved cells can extend beyond
+        // them, so extend each box by as much as the cell can reach beyond
+        // it for the current mapping. If this is not known, search for every
+        // position.
+        const double relative_extension = relative_bounding_box_extension(this->get_mapping());
+        const bool use_cell_boxes = (relative_extension >= 0.);
+
+        std::vector<std::pair<BoundingBox<dim>, active_cell_iterator>> cell_boxes;
+        if (use_cell_boxes)
+          for (const auto &cell : this->get_triangulation().active_cell_iterators())
+            if (cell->is_locally_owned())
+              {
+                BoundingBox<dim> box = this->get_mapping().get_bounding_box(cell);
+
+                // Also extend the box by a small fraction of its size, so that
+                // positions on its boundary are not lost to roundoff.
+                std::pair<Point<dim>,Point<dim>> &corners = box.get_boundary_points();
+                for (unsigned int d=0; d<dim; ++d)
+                  {
+                    const double extension = (relative_extension + 1e-6) * box.side_length(d);
+                    corners.first[d] -= extension;
+                    corners.second[d] += extension;
+                  }
+
+                cell_boxes.emplace_back(box, cell);
+              }
+        const auto cell_boxes_rtree = pack_rtree(cell_boxes);
+
+        // Positions that are not on the boundary of a locally owned cell
+        // can only lie in this one cell. Only positions closer than this
+        // tolerance (in reference coordinates) to the boundary of a cell are
+        // searched for with find_active_cell_around_point(), which decides
+        // consistently on all processes which cell the position belongs to.
+        const double interior_tolerance = 1e-6;
+
+        std::vector<active_cell_iterator> cells(positions.size());
+        std::vector<Point<dim>> reference_locations(positions.size());
+
+        parallel::apply_to_subranges(std::size_t(0),
+                                     positions.size(),
+                                     [&](const std::size_t begin, const std::size_t end)
+        {
+          std::vector<std::pair<BoundingBox<dim>, active_cell_iterator>> candidates;
+
+          for (std::size_t i = begin; i < end; ++i)
+            {
+              if (use_cell_boxes)
+                {
+                  candidates.clear();
+                  cell_boxes_rtree.query(boost::geometry::index::intersects(positions[i]),
+                                         std::back_inserter(candidates));
+
+                  if (candidates.empty())
+                    continue;
+
+                  bool found_interior_cell = false;
+                  for (const auto &candidate : candidates)
+                    {
+                      try
+                        {
+                          const Point<dim> p_unit = this->get_mapping().transform_real_to_unit_cell(candidate.second, positions[i]);
+                          if (candidate.second->reference_cell().contains_point(p_unit, -interior_tolerance))
+                            {
+                              cells[i] = candidate.second;
+                              reference_locations[i] = p_unit;
+                              found_interior_cell = true;
+                              break;
+                            }
+                        }
+                      catch (typename Mapping<dim>::ExcTransformationFailed &)
+                        {
+                          // The position is not in this cell, try the next one.
+                        }
+                    }
+
+                  if (found_interior_cell)
+                    continue;
+                }
+
+              const std::pair<const active_cell_iterator, Point<dim>> it =
+                GridTools::find_active_cell_around_point<> (cache, positions[i]);
+
+              if (it.first.state() == IteratorState::valid && it.first->is_locally_owned())
+                {
+                  cells[i] = it.first;
+                  reference_locations[i] = it.second;
+                }
+            }
+        },
+        /* grainsize= */ 1000);
+
+        for (std::size_t i = 0; i < positions.size(); ++i)
+          if (cells[i].state() == IteratorState::valid)
+            particle_handler.insert_particle(Particle<dim>(positions[i], reference_locations[i], first_id + i), cells[i]);
+      }
+
+
+
+      template <int dim>
+      const GridTools::Cache<dim> &
+      Interface<dim>::get_grid_cache() const
+      {
+        std::lock_guard<std::mutex> lock(grid_cache_mutex);
+        if (grid_cache == nullptr)
+          grid_cache = std::make_unique<GridTools::Cache<dim>>(this->get_triangulation(), this->get_mapping());
+
+        return *grid_cache;
+      }
+
+
+
       template <int dim>
       std::pair<Particles::internal::LevelInd,Particle<dim>>
       Interface<dim>::generate_particle (const typename parallel::distributed::Triangulation<dim>::active_cell_iterator &cell,
@@ -57,7 +57,12 @@ namespace aspect
             spacing[i] = P_diff[i] / fmax(n_particles_per_direction[i] - 1,1);
           }
 
-        types::particle_index particle_index = 0;
+        std::size_t n_generated_particles = 1;
+        for (unsigned int i = 0; i < dim; ++i)
+          n_generated_particles *= n_particles_per_direction[i];
+
+        std::vector<Point<dim>> particle_positions;
+        particle_positions.reserve(n_generated_particles);
 
         for (unsigned int i = 0; i < n_particles_per_direction[0]; ++i)
           {
@@ -65,21 +70,19 @@ namespace aspect
               {
                 if (dim == 2)
                   {
-                    const Point<dim> particle_position = Point<dim> (P_min[0]+i*spacing[0],P_min[1]+j*spacing[1]);
-                    this->insert_particle_at_position(particle_position, particle_index, particle_handler);
-                    ++particle_index;
+                    particle_positions.emplace_back(Point<dim> (P_min[0]+i*spacing[0],P_min[1]+j*spacing[1]));
                   }
                 else if (dim == 3)
                   for (unsigned int k = 0; k < n_particles_per_direction[2]; ++k)
                     {
-                      const Point<dim> particle_position = Point<dim> (P_min[0]+i*spacing[0],P_min[1]+j*spacing[1],P_min[2]+k*spacing[2]);
-                      this->insert_particle_at_position(particle_position, particle_index, particle_handler);
-                      ++particle_index;
+                      particle_positions.emplace_back(Point<dim> (P_min[0]+i*spacing[0],P_min[1]+j*spacing[1],P_min[2]+k*spacing[2]));
                     }
 
               }
           }
 
+        this->insert_particles_at_positions(particle_positions, 0, particle_handler);
+
         particle_handler.update_cached_numbers();
       }
 
@@ -67,7 +67,7 @@ namespace aspect
 
         // Generate particles
 
-        types::particle_index particle_index = 0;
+        std::vector<Point<dim>> particle_positions;
         std::array<double,dim> spherical_coordinates;
         for (unsigned int i = 0; i < radial_layers; ++i)
           {
@@ -79,9 +79,7 @@ namespace aspect
                 for (unsigned int j = 0; j < particles_per_layer[i]; ++j)
                   {
                     spherical_coordinates[1] = P_min[1] + j * phi_spacing;
-                    const Point<dim> particle_position = Utilities::Coordinates::spherical_to_cartesian_coordinates<dim>(spherical_coordinates) + P_center;
-                    this->insert_particle_at_position(particle_position, particle_index, particle_handler);
-                    ++particle_index;
+                    particle_positions.emplace_back(Utilities::Coordinates::spherical_to_cartesian_coordinates<dim>(spherical_coordinates) + P_center);
                   }
               }
             else if (dim == 3)
@@ -105,14 +103,14 @@ namespace aspect
                     for (unsigned int k = 0; k < adjusted_phi_particles; ++k)
                       {
                         spherical_coordinates[1] = P_min[1] + k * phi_spacing;
-                        const Point<dim> particle_position = Utilities::Coordinates::spherical_to_cartesian_coordinates<dim>(spherical_coordinates) + P_center;
-                        this->insert_particle_at_position(particle_position, particle_index, particle_handler);
-                        ++particle_index;
+                        particle_positions.emplace_back(Utilities::Coordinates::spherical_to_cartesian_coordinates<dim>(spherical_coordinates) + P_center);
                       }
                   }
               }
           }
 
+        this->insert_particles_at_positions(particle_positions, 0, particle_handler);
+
         particle_handler.update_cached_numbers();
       }
 
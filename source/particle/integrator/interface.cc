@@ -38,6 +38,24 @@ namespace aspect
 
 
 
+      template <int dim>
+      bool
+      Interface<dim>::particle_needs_integration(const typename ParticleHandler<dim>::particle_iterator &/*particle*/) const
+      {
+        return true;
+      }
+
+
+
+      template <int dim>
+      bool
+      Interface<dim>::is_adaptive() const
+      {
+        return false;
+      }
+
+
+
       template <int dim>
       std::size_t
       Interface<dim>::get_data_size() const
@@ -0,0 +1,409 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+ This file is part of ASPECT.
+
+ ASPECT is free software; you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation; either version 2, or (at your option)
+ any later version.
+
+ ASPECT is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with ASPECT; see the file LICENSE.  If not see
+ <http://www.gnu.org/licenses/>.
+ */
+
+#include <aspect/particle/integrator/rk_23.h>
+#include <aspect/particle/property/interface.h>
+#include <aspect/particle/manager.h>
+#include <aspect/geometry_model/interface.h>
+
+namespace aspect
+{
+  namespace Particle
+  {
+    namespace Integrator
+    {
+      namespace
+      {
+        /**
+         * The stages of the Bogacki-Shampine scheme that a particle can be
+         * in, stored as a particle property. The first stage is not listed,
+         * because its velocity is either computed at the beginning of the
+         * time step, or reused from the last stage of the previous substep.
+         */
+        namespace Stage
+        {
+          constexpr double second = 1;
+          constexpr double third = 2;
+          constexpr double error_estimate = 3;
+          constexpr double finished = 4;
+        }
+      }
+
+
+
+      template <int dim>
+      RK23<dim>::RK23()
+        :
+        integrator_substep(0),
+        has_unfinished_particles(false)
+      {}
+
+
+
+      template <int dim>
+      void
+      RK23<dim>::initialize ()
+      {
+        const auto &property_information = this->get_particle_manager(this->get_particle_manager_index()).get_property_manager().get_data_info();
+
+        property_index_start_location = property_information.get_position_by_field_name("internal: integrator properties");
+        property_indices_velocities[0] = property_index_start_location + dim;
+        property_indices_velocities[1] = property_indices_velocities[0] + dim;
+        property_indices_velocities[2] = property_indices_velocities[1] + dim;
+        property_index_time_fraction = property_indices_velocities[2] + dim;
+        property_index_substep_length = property_index_time_fraction + 1;
+        property_index_stage = property_index_substep_length + 1;
+      }
+
+
+
+      template <int dim>
+      void
+      RK23<dim>::local_integrate_step(const typename ParticleHandler<dim>::particle_iterator &begin_particle,
+                                      const typename ParticleHandler<dim>::particle_iterator &end_particle,
+                                      const std::vector<Tensor<1,dim>> &old_velocities,
+                                      const std::vector<Tensor<1,dim>> &velocities,
+                                      const double dt)
+      {
+        Assert(static_cast<unsigned int> (std::distance(begin_particle, end_particle)) == old_velocities.size(),
+               ExcMessage("The particle integrator expects the old velocity vector to be of equal size "
+                          "to the number of particles to advect. For some unknown reason they are different, "
+                          "most likely something went wrong in the calling function."));
+
+        if (integrator_substep > 0)
+          Assert(old_velocities.size() == velocities.size(),
+                 ExcMessage("The particle integrator expects the velocity vector to be of equal size "
+                            "to the number of particles to advect. For some unknown reason they are different, "
+                            "most likely something went wrong in the calling function."));
+
+        const auto cell = begin_particle->get_surrounding_cell();
+        bool at_periodic_boundary = false;
+        if (this->get_triangulation().get_periodic_face_map().empty() == false)
+          for (const auto &face_index: cell->face_indices())
+            if (cell->at_boundary(face_index))
+              if (cell->has_periodic_neighbor(face_index))
+                {
+                  at_periodic_boundary = true;
+                  break;
+                }
+
+        // The error of a substep is measured relative to the size of the
+        // cell, i.e. relative to the resolution of the velocity field.
+        const double absolute_tolerance = error_tolerance * cell->minimum_vertex_distance();
+        const double minimum_substep_length = 1.0 / maximum_number_of_substeps;
+
+        typename std::vector<Tensor<1,dim>>::const_iterator old_velocity = old_velocities.begin();
+        typename std::vector<Tensor<1,dim>>::const_iterator velocity = velocities.begin();
+
+        std::array<Tensor<1,dim>,3> k;
+        for (typename ParticleHandler<dim>::particle_iterator it = begin_particle;
+             it != end_particle; ++it, ++old_velocity)
+          {
+            ArrayView<double> properties = it->get_properties();
+
+            // The velocity at the current particle location, interpolated
+            // linearly in time to the given fraction of the time step.
+            const auto velocity_at_time_fraction = [&](const double time_fraction) -> Tensor<1,dim>
+            {
+              return (1.0 - time_fraction) * (*old_velocity) + time_fraction * (*velocity);
+            };
+
+            // Move the particle to a location computed from the substep start
+            // location. If we cross a periodic boundary, the stored start
+            // location and intermediate velocities have to be adjusted in the
+            // same way as the new location.
+            const auto move_particle = [&](Point<dim> start_location,
+                                           Point<dim> new_location,
+                                           const unsigned int n_velocities)
+            {
+              if (at_periodic_boundary)
+                {
+                  this->get_geometry_model().adjust_positions_for_periodicity(new_location,
+                                                                              ArrayView<Point<dim>>(&start_location,1),
+                                                                              ArrayView<Tensor<1,dim>>(k.data(),n_velocities));
+                  for (unsigned int v=0; v<n_velocities; ++v)
+                    for (unsigned int i=0; i<dim; ++i)
+                      properties[property_indices_velocities[v] + i] = k[v][i];
+                }
+
+              for (unsigned int i=0; i<dim; ++i)
+                properties[property_index_start_location + i] = start_location[i];
+
+              it->set_location(new_location);
+            };
+
+            if (integrator_substep == 0)
+              {
+                // Start a new time step with the substep length that was
+                // successful at the end of the last one.
+                double substep_length = properties[property_index_substep_length];
+                if (substep_length <= 0.0 || substep_length > 1.0)
+                  substep_length = 1.0;
+                substep_length = std::max(substep_length, minimum_substep_length);
+
+                const Point<dim> location = it->get_location();
+                k[0] = *old_velocity;
+
+                for (unsigned int i=0; i<dim; ++i)
+                  properties[property_indices_velocities[0] + i] = k[0][i];
+                properties[property_index_time_fraction] = 0.0;
+                properties[property_index_substep_length] = substep_length;
+                properties[property_index_stage] = Stage::second;
+
+                move_particle(location, location + 0.5 * substep_length * dt * k[0], 1);
+                has_unfinished_particles = true;
+              }
+            else
+              {
+                const double stage = properties[property_index_stage];
+                if (stage == Stage::finished)
+                  {
+                    ++velocity;
+                    continue;
+                  }
+
+                const double time_fraction = properties[property_index_time_fraction];
+                double substep_length = properties[property_index_substep_length];
+
+                Point<dim> start_location;
+                for (unsigned int i=0; i<dim; ++i)
+                  start_location[i] = properties[property_index_start_location + i];
+
+                for (unsigned int v=0; v<3; ++v)
+                  for (unsigned int i=0; i<dim; ++i)
+                    k[v][i] = properties[property_indices_velocities[v] + i];
+
+                const double h = substep_length * dt;
+
+                if (stage == Stage::second)
+                  {
+                    k[1] = velocity_at_time_fraction(time_fraction + 0.5 * substep_length);
+                    for (unsigned int i=0; i<dim; ++i)
+                      properties[property_indices_velocities[1] + i] = k[1][i];
+                    properties[property_index_stage] = Stage::third;
+
+                    move_particle(start_location, start_location + 0.75 * h * k[1], 2);
+                  }
+                else if (stage == Stage::third)
+                  {
+                    k[2] = velocity_at_time_fraction(time_fraction + 0.75 * substep_length);
+                    for (unsigned int i=0; i<dim; ++i)
+                      properties[property_indices_velocities[2] + i] = k[2][i];
+                    properties[property_index_stage] = Stage::error_estimate;
+
+                    move_particle(start_location,
+                                  start_location + h * (2./9. * k[0] + 1./3. * k[1] + 4./9. * k[2]),
+                                  3);
+                  }
+                else if (stage == Stage::error_estimate)
+                  {
+                    // The particle is at the third order solution of this
+                    // substep. Compare it to the embedded second order
+                    // solution, which also uses the velocity at the end of
+                    // the substep.
+                    const Tensor<1,dim> k_end = velocity_at_time_fraction(time_fraction + substep_length);
+                    const double error = h * (-5./72. * k[0] + 1./12. * k[1] + 1./9. * k[2] - 1./8. * k_end).norm();
+                    const double relative_error = error / absolute_tolerance;
+
+                    // Standard step size control for a scheme of order 2(3),
+                    // limited to avoid too aggressive changes.
+                    const double step_factor = (relative_error > 0.0)
+                                               ?
+                                               std::min(5.0, std::max(0.2, 0.9 * std::pow(relative_error, -1./3.)))
+                                               :
+                                               5.0;
+
+                    if (relative_error <= 1.0 || substep_length <= minimum_substep_length)
+                      {
+                        // Accept the substep. The velocity at its end is the
+                        // first stage velocity of the next substep.
+                        const double new_time_fraction = time_fraction + substep_length;
+                        const double new_substep_length = std::min(1.0, std::max(minimum_substep_length,
+                                                                                  step_factor * substep_length));
+                        start_location = it->get_location();
+                        k[0] = k_end;
+                        for (unsigned int i=0; i<dim; ++i)
+                          properties[property_indices_velocities[0] + i] = k[0][i];
+                        properties[property_index_time_fraction] = new_time_fraction;
+                        properties[property_index_substep_length] = new_substep_length;
+
+                        if (new_time_fraction >= 1.0 - 1e-12)
+                          {
+                            properties[property_index_stage] = Stage::finished;
+                            ++velocity;
+                            continue;
+                          }
+
+                        substep_length = std::min(new_substep_length, 1.0 - new_time_fraction);
+                        properties[property_index_substep_length] = substep_length;
+                      }
+                    else
+                      {
+                        // Reject the substep and restart it with a shorter
+                        // substep length from the same start location.
+                        substep_length = std::max(minimum_substep_length, step_factor * substep_length);
+                        properties[property_index_substep_length] = substep_length;
+                      }
+
+                    properties[property_index_stage] = Stage::second;
+                    move_particle(start_location, start_location + 0.5 * substep_length * dt * k[0], 1);
+                  }
+                else
+                  {
+                    Assert(false,
+                           ExcMessage("The RK23 integrator found a particle in an unknown integration stage."));
+                  }
+
+                has_unfinished_particles = true;
+                ++velocity;
+              }
+          }
+      }
+
+
+
+      template <int dim>
+      bool
+      RK23<dim>::new_integration_step()
+      {
+        // Particles on other processes may still need more substeps, so all
+        // processes have to agree on whether to continue.
+        const bool continue_integration = (Utilities::MPI::max (has_unfinished_particles ? 1 : 0,
+                                                                this->get_mpi_communicator()) == 1);
+
+        has_unfinished_particles = false;
+
+        if (continue_integration)
+          ++integrator_substep;
+        else
+          integrator_substep = 0;
+
+        return continue_integration;
+      }
+
+
+
+      template <int dim>
+      bool
+      RK23<dim>::particle_needs_integration(const typename ParticleHandler<dim>::particle_iterator &particle) const
+      {
+        if (integrator_substep == 0)
+          return true;
+
+        return particle->get_properties()[property_index_stage] != Stage::finished;
+      }
+
+
+
+      template <int dim>
+      bool
+      RK23<dim>::is_adaptive() const
+      {
+        return true;
+      }
+
+
+
+      template <int dim>
+      std::array<bool, 3>
+      RK23<dim>::required_solution_vectors() const
+      {
+        if (integrator_substep == 0)
+          return {{false, true, false}};
+
+        return {{false, true, true}};
+      }
+
+
+
+      template <int dim>
+      void
+      RK23<dim>::declare_parameters (ParameterHandler &prm)
+      {
+        prm.enter_subsection("Integrator");
+        {
+          prm.enter_subsection("RK23");
+          {
+            prm.declare_entry ("Error tolerance", "1e-3",
+                               Patterns::Double(0.),
+                               "The tolerance for the estimated error of the location of a "
+                               "particle after one substep, relative to the size of the cell "
+                               "the particle is in. Substeps with a larger error are repeated "
+                               "with a shorter substep length.");
+            prm.declare_entry ("Maximum number of substeps", "100",
+                               Patterns::Integer(1),
+                               "The maximum number of substeps a particle can take per time "
+                               "step. The inverse of this number is the shortest allowed "
+                               "substep length as a fraction of the time step. Substeps of "
+                               "this length are accepted independent of their estimated error.");
+          }
+          prm.leave_subsection();
+        }
+        prm.leave_subsection();
+      }
+
+
+
+      template <int dim>
+      void
+      RK23<dim>::parse_parameters (ParameterHandler &prm)
+      {
+        prm.enter_subsection("Integrator");
+        {
+          prm.enter_subsection("RK23");
+          {
+            error_tolerance = prm.get_double("Error tolerance");
+            maximum_number_of_substeps = prm.get_integer("Maximum number of substeps");
+
+            AssertThrow(error_tolerance > 0.0,
+                        ExcMessage("The error tolerance of the RK23 particle integrator has to be positive."));
+          }
+          prm.leave_subsection();
+        }
+        prm.leave_subsection();
+      }
+    }
+  }
+}
+
+
+// explicit instantiations
+namespace aspect
+{
+  namespace Particle
+  {
+    namespace Integrator
+    {
+      ASPECT_REGISTER_PARTICLE_INTEGRATOR(RK23,
+                                          "rk23",
+                                          "Adaptive Runge Kutta integrator that uses the embedded "
+                                          "Bogacki-Shampine pair of order 2(3). Every particle splits "
+                                          "the time step into substeps whose length is chosen based on "
+                                          "the difference between the second and third order solution, "
+                                          "so that particles in regions with complex flow take more "
+                                          "substeps than particles in smooth regions. The velocity "
+                                          "between the old and current time is interpolated linearly "
+                                          "in time. Because the accuracy of the particle paths is "
+                                          "controlled by the given error tolerance rather than by the "
+                                          "time step length, this integrator can be combined with a "
+                                          "larger CFL number than the fixed-step integrators.")
+    }
+  }
+}
@@ -64,6 +64,15 @@ namespace aspect
                                                             selected_properties,
                                                             cell);
 
+        // Only the right-hand sides of the selected properties are stored, so that
+        // the single factorization of A below is reused by one cheap solve for
+        // each interpolated property.
+        std::vector<unsigned int> selected_property_indices;
+        for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+          if (selected_properties[property_index] == true)
+            selected_property_indices.push_back(property_index);
+        const unsigned int n_selected_properties = selected_property_indices.size();
+
         // Noticed that the size of matrix A is n_particles x n_matrix_columns
         // which usually is not a square matrix. Therefore, we find the
         // least squares solution of Ac=r by solving the reduced QR factorization
@@ -71,7 +80,7 @@ namespace aspect
         // A is a std::vector of Vectors(which are it's columns) so that we
         // create what the ImplicitQR class needs.
         std::vector<Vector<double>> A(n_matrix_columns, Vector<double>(n_particles));
-        std::vector<Vector<double>> b(n_particle_properties, Vector<double>(n_particles));
+        std::vector<Vector<double>> b(n_selected_properties, Vector<double>(n_particles));
 
         unsigned int particle_index = 0;
         // The unit cell of deal.II is [0,1]^dim. The limiter needs a 'unit' cell of [-.5,.5]^dim.
@@ -82,16 +91,14 @@ namespace aspect
              particle != particle_range.end(); ++particle, ++particle_index)
           {
             const ArrayView<double> particle_property_value = particle->get_properties();
-            for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+            for (unsigned int i = 0; i < n_selected_properties; ++i)
               {
-                if (selected_properties[property_index] == true)
+                const unsigned int property_index = selected_property_indices[i];
+                b[i][particle_index] = particle_property_value[property_index];
+                if (use_linear_least_squares_limiter[property_index] == true)
                   {
-                    b[property_index][particle_index] = particle_property_value[property_index];
-                    if (use_linear_least_squares_limiter[property_index] == true)
-                      {
-                        property_minimums[property_index] = std::min(property_minimums[property_index], particle_property_value[property_index]);
-                        property_maximums[property_index] = std::max(property_maximums[property_index], particle_property_value[property_index]);
-                      }
+                    property_minimums[property_index] = std::min(property_minimums[property_index], particle_property_value[property_index]);
+                    property_maximums[property_index] = std::max(property_maximums[property_index], particle_property_value[property_index]);
                   }
               }
             Point<dim> relative_particle_position = particle->get_reference_location();
@@ -107,8 +114,8 @@ namespace aspect
           }
 
         // If the limiter is enabled for at least one property then we know that we can access ghost cell
-        // particles to determine the bounds of the properties on the mode (due to the assert of
-        // 'Exchange ghost particles' in parse_parameters). Otherwise we do not need to access those particles
+        // particles to determine the bounds of the properties on the mode (because
+        // needs_ghost_particles() asks the particle manager to exchange them). Otherwise we do not need to access those particles
         if (use_linear_least_squares_limiter.n_selected_components() != 0)
           {
             std::vector<typename parallel::distributed::Triangulation<dim>::active_cell_iterator> active_neighbors;
@@ -117,7 +124,7 @@ namespace aspect
               {
                 if (active_neighbor->is_artificial())
                   continue;
-                const std::vector<double> neighbor_cell_average = fallback_interpolator.properties_at_points(particle_handler, positions, selected_properties, active_neighbor)[0];
+                const std::vector<double> neighbor_cell_average = fallback_interpolator.properties_at_points(particle_handler, {positions[0]}, selected_properties, active_neighbor)[0];
                 for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
                   {
                     if (selected_properties[property_index] == true && use_linear_least_squares_limiter[property_index] == true)
@@ -168,73 +175,73 @@ namespace aspect
                                                             selected_properties,
                                                             cell);
 
-        std::vector<Vector<double>> QTb(n_particle_properties, Vector<double>(n_matrix_columns));
-        std::vector<Vector<double>> c(n_particle_properties, Vector<double>(n_matrix_columns));
-        for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+        // The support points do not depend on the property, so we only
+        // need to invert the mapping once per point.
+        std::vector<Point<dim>> relative_support_point_locations(positions.size());
+        for (unsigned int i = 0; i < positions.size(); ++i)
           {
-            if (selected_properties[property_index] == true)
-              {
-                qr.multiply_with_QT(QTb[property_index], b[property_index]);
-                qr.solve(c[property_index], QTb[property_index]);
-              }
+            relative_support_point_locations[i] = this->get_mapping().transform_real_to_unit_cell(cell, positions[i]);
+            for (unsigned int d = 0; d < dim; ++d)
+              relative_support_point_locations[i][d] -= unit_offset;
           }
+
+        Vector<double> QTb(n_matrix_columns);
+        Vector<double> c(n_matrix_columns);
         const double half_h = .5;
-        for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+        for (unsigned int i = 0; i < n_selected_properties; ++i)
           {
-            if (selected_properties[property_index] == true)
+            const unsigned int property_index = selected_property_indices[i];
+
+            qr.multiply_with_QT(QTb, b[i]);
+            qr.solve(c, QTb);
+
+            if (use_linear_least_squares_limiter[property_index] == true)
               {
-                if (use_linear_least_squares_limiter[property_index] == true)
+                c[0] = std::max(c[0], property_minimums[property_index]);
+                c[0] = std::min(c[0], property_maximums[property_index]);
+
+                const double max_total_slope = std::min(c[0] - property_minimums[property_index],
+                                                        property_maximums[property_index] - c[0])
+                                               / half_h;
+                double current_total_slope = 0.0;
+                for (unsigned int k = 1; k < n_matrix_columns; ++k)
                   {
-                    c[property_index][0] = std::max(c[property_index][0], property_minimums[property_index]);
-                    c[property_index][0] = std::min(c[property_index][0], property_maximums[property_index]);
-
-                    const double max_total_slope = std::min(c[property_index][0] - property_minimums[property_index],
-                                                            property_maximums[property_index] - c[property_index][0])
-                                                   / half_h;
-                    double current_total_slope = 0.0;
-                    for (unsigned int i = 1; i < n_matrix_columns; ++i)
-                      {
-                        current_total_slope += std::abs(c[property_index][i]);
-                      }
-
-                    if (current_total_slope > max_total_slope && current_total_slope > std::numeric_limits<double>::min())
-                      {
-                        double slope_change_ratio = max_total_slope/current_total_slope;
-                        for (unsigned int i = 1; i < n_matrix_columns; ++i)
-                          c[property_index][i] *= slope_change_ratio;
-                      }
+                    current_total_slope += std::abs(c[k]);
                   }
-                std::size_t positions_index = 0;
-                for (typename std::vector<Point<dim>>::const_iterator itr = positions.begin(); itr != positions.end(); ++itr, ++positions_index)
+
+                if (current_total_slope > max_total_slope && current_total_slope > std::numeric_limits<double>::min())
                   {
-                    Point<dim> relative_support_point_location = this->get_mapping().transform_real_to_unit_cell(cell, *itr);
-                    double interpolated_value = c[property_index][0];
-                    for (unsigned int i = 1; i < n_matrix_columns; ++i)
-                      {
-                        relative_support_point_location[i - 1] -= unit_offset;
-                        interpolated_value += c[property_index][i] * relative_support_point_location[i - 1];
-                      }
-                    if (use_linear_least_squares_limiter[property_index] == true)
-                      {
-                        // Assert that the limiter was reasonably effective. We can not expect perfect accuracy
-                        // due to inaccuracies e.g. in the inversion of the mapping.
-                        const double tolerance = std::sqrt(std::numeric_limits<double>::epsilon())
-                                                 * std::max(std::abs(property_minimums[property_index]),
-                                                            std::abs(property_maximums[property_index]));
-                        (void) tolerance;
-                        Assert(interpolated_value >= property_minimums[property_index] - tolerance,
-                               ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
-                                          + " is smaller than the minimum particle property value: " + std::to_string(property_minimums[property_index]) + "."));
-                        Assert(interpolated_value <= property_maximums[property_index] + tolerance,
-                               ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
-                                          + " is larger than the maximum particle property value: " + std::to_string(property_maximums[property_index]) + "."));
-
-                        interpolated_value = std::min(interpolated_value, property_maximums[property_index]);
-                        interpolated_value = std::max(interpolated_value, property_minimums[property_index]);
-                      }
-                    cell_properties[positions_index][property_index] = interpolated_value;
+                    double slope_change_ratio = max_total_slope/current_total_slope;
+                    for (unsigned int k = 1; k < n_matrix_columns; ++k)
+                      c[k] *= slope_change_ratio;
                   }
+              }
+            for (unsigned int positions_index = 0; positions_index < positions.size(); ++positions_index)
+              {
+                const Point<dim> &relative_support_point_location = relative_support_point_locations[positions_index];
+                double interpolated_value = c[0];
+                for (unsigned int k = 1; k < n_matrix_columns; ++k)
+                  interpolated_value += c[k] * relative_support_point_location[k - 1];
 
+                if (use_linear_least_squares_limiter[property_index] == true)
+                  {
+                    // Assert that the limiter was reasonably effective. We can not expect perfect accuracy
+                    // due to inaccuracies e.g. in the inversion of the mapping.
+                    const double tolerance = std::sqrt(std::numeric_limits<double>::epsilon())
+                                             * std::max(std::abs(property_minimums[property_index]),
+                                                        std::abs(property_maximums[property_index]));
+                    (void) tolerance;
+                    Assert(interpolated_value >= property_minimums[property_index] - tolerance,
+                           ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
+                                      + " is smaller than the minimum particle property value: " + std::to_string(property_minimums[property_index]) + "."));
+                    Assert(interpolated_value <= property_maximums[property_index] + tolerance,
+                           ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
+                                      + " is larger than the maximum particle property value: " + std::to_string(property_maximums[property_index]) + "."));
+
+                    interpolated_value = std::min(interpolated_value, property_maximums[property_index]);
+                    interpolated_value = std::max(interpolated_value, property_minimums[property_index]);
+                  }
+                cell_properties[positions_index][property_index] = interpolated_value;
               }
           }
         return cell_properties;
@@ -242,6 +249,15 @@ namespace aspect
 
 
 
+      template <int dim>
+      bool
+      BilinearLeastSquares<dim>::needs_ghost_particles () const
+      {
+        return (use_linear_least_squares_limiter.n_selected_components() != 0);
+      }
+
+
+
       template <int dim>
       void
       BilinearLeastSquares<dim>::declare_parameters (ParameterHandler &prm)
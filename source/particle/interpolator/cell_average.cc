@@ -117,6 +117,15 @@ namespace aspect
 
 
 
+      template <int dim>
+      bool
+      CellAverage<dim>::needs_ghost_particles () const
+      {
+        return false;
+      }
+
+
+
       template <int dim>
       void
       CellAverage<dim>::declare_parameters (ParameterHandler &prm)
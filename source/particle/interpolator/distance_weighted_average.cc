@@ -72,7 +72,11 @@ namespace aspect
 
         std::set<typename Triangulation<dim>::active_cell_iterator> cell_and_neighbors;
 
-        const auto &vertex_to_cell_map = grid_cache->get_vertex_to_cell_map();
+        const auto &vertex_to_cell_map = [&]() -> decltype(auto)
+        {
+          std::lock_guard<std::mutex> lock(grid_cache_mutex);
+          return grid_cache->get_vertex_to_cell_map();
+        }();
 
         for (const auto v : cell->vertex_indices())
           {
@@ -27,6 +27,14 @@ namespace aspect
   {
     namespace Interpolator
     {
+      template <int dim>
+      bool
+      Interface<dim>::needs_ghost_particles () const
+      {
+        return true;
+      }
+
+
 // -------------------------------- Deal with registering models and automating
 // -------------------------------- their setup and selection at run time
 
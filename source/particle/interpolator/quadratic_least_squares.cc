@@ -326,6 +326,15 @@ namespace aspect
         cell)[0];
 
 
+        // Only the right-hand sides of the selected properties are stored, so that
+        // the single factorization of A below is reused by one cheap solve for
+        // each interpolated property.
+        std::vector<unsigned int> selected_property_indices;
+        for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+          if (selected_properties[property_index] == true)
+            selected_property_indices.push_back(property_index);
+        const unsigned int n_selected_properties = selected_property_indices.size();
+
         // Notice that the size of matrix A is n_particles x n_matrix_columns
         // which usually is not a square matrix. Therefore, we find the
         // least squares solution of Ac=r by solving the reduced QR factorization
@@ -333,7 +342,7 @@ namespace aspect
         // A is a std::vector of Vectors(which are it's columns) so that we
         // create what the ImplicitQR class needs.
         std::vector<Vector<double>> A(n_matrix_columns, Vector<double>(n_particles));
-        std::vector<Vector<double>> b(n_particle_properties, Vector<double>(n_particles));
+        std::vector<Vector<double>> b(n_selected_properties, Vector<double>(n_particles));
 
         unsigned int particle_index = 0;
         // The unit cell of deal.II is [0, 1]^dim. The limiter needs a 'unit' cell of [-0.5, 0.5]^dim
@@ -344,14 +353,12 @@ namespace aspect
              particle != particle_range.end(); ++particle, ++particle_index)
           {
             const ArrayView<double> particle_property_value = particle->get_properties();
-            for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+            for (unsigned int i = 0; i < n_selected_properties; ++i)
               {
-                if (selected_properties[property_index] == true)
-                  {
-                    b[property_index][particle_index] = particle_property_value[property_index];
-                    property_minimums[property_index] = std::min(property_minimums[property_index], particle_property_value[property_index]);
-                    property_maximums[property_index] = std::max(property_maximums[property_index], particle_property_value[property_index]);
-                  }
+                const unsigned int property_index = selected_property_indices[i];
+                b[i][particle_index] = particle_property_value[property_index];
+                property_minimums[property_index] = std::min(property_minimums[property_index], particle_property_value[property_index]);
+                property_maximums[property_index] = std::max(property_maximums[property_index], particle_property_value[property_index]);
               }
 
             Point<dim> relative_particle_position = particle->get_reference_location();
@@ -388,8 +395,8 @@ namespace aspect
           }
 
         // If the limiter is enabled for at least one property then we know that we can access ghost cell
-        // particles to determine the bounds of the properties on the model (due to the assert of
-        // 'Exchange ghost particles' in parse_parameters). Otherwise we do not need to access those particles
+        // particles to determine the bounds of the properties on the model (because
+        // needs_ghost_particles() asks the particle manager to exchange them). Otherwise we do not need to access those particles
         if (use_quadratic_least_squares_limiter.n_selected_components(n_particle_properties) != 0)
           {
             std::vector<typename parallel::distributed::Triangulation<dim>::active_cell_iterator> active_neighbors;
@@ -398,7 +405,7 @@ namespace aspect
               {
                 if (active_neighbor->is_artificial())
                   continue;
-                const std::vector<double> neighbor_cell_average = fallback_interpolator.properties_at_points(particle_handler, positions, selected_properties, active_neighbor)[0];
+                const std::vector<double> neighbor_cell_average = fallback_interpolator.properties_at_points(particle_handler, {positions[0]}, selected_properties, active_neighbor)[0];
                 for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
                   {
                     if (selected_properties[property_index] == true && use_quadratic_least_squares_limiter[property_index] == true)
@@ -448,31 +455,29 @@ namespace aspect
                                                             positions,
                                                             selected_properties,
                                                             cell);
-        std::vector<Vector<double>> QTb(n_particle_properties, Vector<double>(n_matrix_columns));
-        std::vector<Vector<double>> c(n_particle_properties, Vector<double>(n_matrix_columns));
-        for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+        Vector<double> QTb(n_matrix_columns);
+        std::vector<Vector<double>> c(n_selected_properties, Vector<double>(n_matrix_columns));
+        for (unsigned int i = 0; i < n_selected_properties; ++i)
           {
-            if (selected_properties[property_index])
+            const unsigned int property_index = selected_property_indices[i];
+            qr.multiply_with_QT(QTb, b[i]);
+            qr.solve(c[i], QTb);
+            if (use_quadratic_least_squares_limiter[property_index])
               {
-                qr.multiply_with_QT(QTb[property_index], b[property_index]);
-                qr.solve(c[property_index], QTb[property_index]);
-                if (use_quadratic_least_squares_limiter[property_index])
-                  {
 
-                    const std::pair<double, double> interpolation_bounds = get_interpolation_bounds(c[property_index]);
-                    const double interpolation_min = interpolation_bounds.first;
-                    const double interpolation_max = interpolation_bounds.second;
-                    if ((interpolation_max - cell_average_values[property_index]) > std::numeric_limits<double>::epsilon() &&
-                        (cell_average_values[property_index] - interpolation_min) > std::numeric_limits<double>::epsilon())
+                const std::pair<double, double> interpolation_bounds = get_interpolation_bounds(c[i]);
+                const double interpolation_min = interpolation_bounds.first;
+                const double interpolation_max = interpolation_bounds.second;
+                if ((interpolation_max - cell_average_values[property_index]) > std::numeric_limits<double>::epsilon() &&
+                    (cell_average_values[property_index] - interpolation_min) > std::numeric_limits<double>::epsilon())
+                  {
+                    const double alpha = std::max(std::min((cell_average_values[property_index] - property_minimums[property_index])/(cell_average_values[property_index] - interpolation_min),
+                                                           (property_maximums[property_index]-cell_average_values[property_index])/(interpolation_max - cell_average_values[property_index])), 0.0);
+                    // If alpha > 1, then using it would make the function grow to meet the bounds.
+                    if (alpha < 1.0)
                       {
-                        const double alpha = std::max(std::min((cell_average_values[property_index] - property_minimums[property_index])/(cell_average_values[property_index] - interpolation_min),
-                                                               (property_maximums[property_index]-cell_average_values[property_index])/(interpolation_max - cell_average_values[property_index])), 0.0);
-                        // If alpha > 1, then using it would make the function grow to meet the bounds.
-                        if (alpha < 1.0)
-                          {
-                            c[property_index] *= alpha;
-                            c[property_index][0] += (1-alpha) * cell_average_values[property_index];
-                          }
+                        c[i] *= alpha;
+                        c[i][0] += (1-alpha) * cell_average_values[property_index];
                       }
                   }
               }
@@ -483,35 +488,32 @@ namespace aspect
             Point<dim> relative_support_point_location = this->get_mapping().transform_real_to_unit_cell(cell, *itr);
             for (unsigned int d = 0; d < dim; ++d)
               relative_support_point_location[d] -= unit_offset;
-            for (unsigned int property_index = 0; property_index < n_particle_properties; ++property_index)
+            for (unsigned int i = 0; i < n_selected_properties; ++i)
               {
-                if (selected_properties[property_index] == true)
+                const unsigned int property_index = selected_property_indices[i];
+                double interpolated_value = evaluate_interpolation_function(c[i], relative_support_point_location);
+                // Overshoot and undershoot correction of interpolated particle property.
+                if (use_quadratic_least_squares_limiter[property_index])
                   {
-                    double interpolated_value = evaluate_interpolation_function(c[property_index], relative_support_point_location);
-                    // Overshoot and undershoot correction of interpolated particle property.
-                    if (use_quadratic_least_squares_limiter[property_index])
-                      {
-                        // Assert that the limiter was reasonably effective. We can not expect perfect accuracy
-                        // due to inaccuracies e.g. in the inversion of the mapping.
-                        const double tolerance = std::sqrt(std::numeric_limits<double>::epsilon())
-                                                 * std::max(std::abs(property_minimums[property_index]),
-                                                            std::abs(property_maximums[property_index]));
-                        (void) tolerance;
-                        Assert(interpolated_value >= property_minimums[property_index] - tolerance,
-                               ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
-                                          + " is smaller than the minimum particle property value: " + std::to_string(property_minimums[property_index]) + "."));
-                        Assert(interpolated_value <= property_maximums[property_index] + tolerance,
-                               ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
-                                          + " is larger than the maximum particle property value: " + std::to_string(property_maximums[property_index]) + "."));
-
-                        // This chopping is done to avoid values that are just outside
-                        // of the limiting bounds.
-                        interpolated_value = std::min(interpolated_value, property_maximums[property_index]);
-                        interpolated_value = std::max(interpolated_value, property_minimums[property_index]);
-                      }
-                    cell_properties[index_positions][property_index] = interpolated_value;
+                    // Assert that the limiter was reasonably effective. We can not expect perfect accuracy
+                    // due to inaccuracies e.g. in the inversion of the mapping.
+                    const double tolerance = std::sqrt(std::numeric_limits<double>::epsilon())
+                                             * std::max(std::abs(property_minimums[property_index]),
+                                                        std::abs(property_maximums[property_index]));
+                    (void) tolerance;
+                    Assert(interpolated_value >= property_minimums[property_index] - tolerance,
+                           ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
+                                      + " is smaller than the minimum particle property value: " + std::to_string(property_minimums[property_index]) + "."));
+                    Assert(interpolated_value <= property_maximums[property_index] + tolerance,
+                           ExcMessage("The particle interpolation limiter did not succeed. Interpolated value: " + std::to_string(interpolated_value)
+                                      + " is larger than the maximum particle property value: " + std::to_string(property_maximums[property_index]) + "."));
+
+                    // This chopping is done to avoid values that are just outside
+                    // of the limiting bounds.
+                    interpolated_value = std::min(interpolated_value, property_maximums[property_index]);
+                    interpolated_value = std::max(interpolated_value, property_minimums[property_index]);
                   }
-
+                cell_properties[index_positions][property_index] = interpolated_value;
               }
           }
         return cell_properties;
@@ -519,6 +521,18 @@ namespace aspect
 
 
 
+      template <int dim>
+      bool
+      QuadraticLeastSquares<dim>::needs_ghost_particles () const
+      {
+        const unsigned int n_particle_properties =
+          this->get_particle_manager(this->get_particle_manager_index()).get_particle_handler().n_properties_per_particle();
+
+        return (use_quadratic_least_squares_limiter.n_selected_components(n_particle_properties) != 0);
+      }
+
+
+
       template <int dim>
       void
       QuadraticLeastSquares<dim>::declare_parameters (ParameterHandler &prm)
@@ -58,7 +58,8 @@ namespace aspect
               particle_load_balancing(other.particle_load_balancing),
               min_particles_per_cell(other.min_particles_per_cell),
               max_particles_per_cell(other.max_particles_per_cell),
-              particle_weight(other.particle_weight)
+              particle_weight(other.particle_weight),
+              storage_fragmentation_threshold(other.storage_fragmentation_threshold)
     {}
 
 
@@ -237,7 +238,10 @@ namespace aspect
           });
         }
 
-      if (dealii::Utilities::MPI::n_mpi_processes(this->get_mpi_communicator()) > 1)
+      // Ghost particles are only needed if the interpolator reads particles
+      // in cells that are not locally owned.
+      if (dealii::Utilities::MPI::n_mpi_processes(this->get_mpi_communicator()) > 1
+          && interpolator->needs_ghost_particles())
         {
           auto do_ghost_exchange = [&] (typename parallel::distributed::Triangulation<dim> &)
           {
@@ -446,6 +450,7 @@ namespace aspect
     Manager<dim>::local_update_particles(Property::ParticleUpdateInputs<dim> &inputs,
                                          small_vector<Point<dim>> &positions,
                                          const std::vector<EvaluationFlags::EvaluationFlags> &evaluation_flags,
+                                         const small_vector<double> &solution_values,
                                          SolutionEvaluator<dim> &evaluator)
     {
       const unsigned int n_particles = particle_handler->n_particles_in_cell(inputs.current_cell);
@@ -460,12 +465,6 @@ namespace aspect
           ++p;
         }
 
-      small_vector<double> solution_values(this->get_fe().dofs_per_cell);
-
-      inputs.current_cell->get_dof_values(this->get_solution(),
-                                          solution_values.begin(),
-                                          solution_values.end());
-
       EvaluationFlags::EvaluationFlags evaluation_flags_union = EvaluationFlags::nothing;
       for (const auto &flag : evaluation_flags)
         evaluation_flags_union |= flag;
@@ -507,14 +506,29 @@ namespace aspect
     Manager<dim>::local_advect_particles(const typename DoFHandler<dim>::active_cell_iterator &cell,
                                          const typename ParticleHandler<dim>::particle_iterator &begin_particle,
                                          const typename ParticleHandler<dim>::particle_iterator &end_particle,
+                                         const small_vector<double> &old_solution_values,
+                                         const small_vector<double> &solution_values,
                                          SolutionEvaluator<dim> &evaluator)
     {
       const unsigned int n_particles_in_cell = particle_handler->n_particles_in_cell(cell);
 
+      // Only evaluate the velocity at the location of particles that still
+      // take part in the current integration step. Adaptive integrators
+      // need additional integration steps only for some of the particles.
       small_vector<Point<dim>> positions;
+      small_vector<unsigned int> evaluated_particles;
       positions.reserve(n_particles_in_cell);
-      for (auto particle = begin_particle; particle!=end_particle; ++particle)
-        positions.push_back(particle->get_reference_location());
+      evaluated_particles.reserve(n_particles_in_cell);
+      unsigned int particle_index = 0;
+      for (auto particle = begin_particle; particle!=end_particle; ++particle, ++particle_index)
+        if (integrator->particle_needs_integration(particle))
+          {
+            positions.push_back(particle->get_reference_location());
+            evaluated_particles.push_back(particle_index);
+          }
+
+      if (positions.size() == 0)
+        return;
 
       const std::array<bool, 3> required_solution_vectors = integrator->required_solution_vectors();
 
@@ -534,31 +548,22 @@ namespace aspect
 
       if (required_solution_vectors[1] == true)
         {
-          small_vector<double> old_solution_values(this->get_fe().dofs_per_cell);
-          cell->get_dof_values(this->get_old_solution(),
-                               old_solution_values.begin(),
-                               old_solution_values.end());
-
           velocity_evaluator.evaluate({old_solution_values.data(),old_solution_values.size()},
                                       EvaluationFlags::values);
 
           old_velocities.resize(n_particles_in_cell);
-          for (unsigned int i=0; i<n_particles_in_cell; ++i)
-            old_velocities[i] = velocity_evaluator.get_value(i);
+          for (unsigned int i=0; i<evaluated_particles.size(); ++i)
+            old_velocities[evaluated_particles[i]] = velocity_evaluator.get_value(i);
         }
 
       if (required_solution_vectors[2] == true)
         {
-          small_vector<double> solution_values(this->get_fe().dofs_per_cell);
-          cell->get_dof_values(this->get_current_linearization_point(),
-                               solution_values.begin(),
-                               solution_values.end());
           velocity_evaluator.evaluate({solution_values.data(),solution_values.size()},
                                       EvaluationFlags::values);
 
           velocities.resize(n_particles_in_cell);
-          for (unsigned int i=0; i<n_particles_in_cell; ++i)
-            velocities[i] = velocity_evaluator.get_value(i);
+          for (unsigned int i=0; i<evaluated_particles.size(); ++i)
+            velocities[evaluated_particles[i]] = velocity_evaluator.get_value(i);
         }
 
       integrator->local_integrate_step(begin_particle,
@@ -611,7 +616,8 @@ namespace aspect
             local_initialize_particles(particle_handler->begin(),
                                        particle_handler->end());
 
-          if (dealii::Utilities::MPI::n_mpi_processes(this->get_mpi_communicator()) > 1)
+          if (dealii::Utilities::MPI::n_mpi_processes(this->get_mpi_communicator()) > 1
+              && interpolator->needs_ghost_particles())
             {
               TimerOutput::Scope timer_section(this->get_computing_timer(), "Particles: Exchange ghosts");
               particle_handler->exchange_ghost_particles();
@@ -624,59 +630,103 @@ namespace aspect
     template <int dim>
     void
     Manager<dim>::update_particles()
+    {
+      update_particles({this});
+    }
+
+
+
+    template <int dim>
+    void
+    Manager<dim>::update_particles(const std::vector<Manager<dim> *> &particle_managers)
     {
       // TODO: Change this loop over all cells to use the WorkStream interface
 
-      if (property_manager->get_n_property_components() > 0)
+      std::vector<Manager<dim> *> managers_with_properties;
+      for (Manager<dim> *particle_manager : particle_managers)
+        if (particle_manager->property_manager->get_n_property_components() > 0)
+          managers_with_properties.push_back(particle_manager);
+
+      if (managers_with_properties.size() > 0)
         {
-          TimerOutput::Scope timer_section(this->get_computing_timer(), "Particles: Update properties");
+          // All managers belong to the same simulator, so we can use the
+          // first one to access the simulator.
+          const Manager<dim> &simulator_access = *managers_with_properties.front();
 
-          Assert(dealii::internal::FEPointEvaluation::is_fast_path_supported(this->get_mapping()) == true,
+          TimerOutput::Scope timer_section(simulator_access.get_computing_timer(), "Particles: Update properties");
+
+          Assert(dealii::internal::FEPointEvaluation::is_fast_path_supported(simulator_access.get_mapping()) == true,
                  ExcMessage("The particle system was optimized for deal.II mappings that support the fast evaluation path "
                             "of the class FEPointEvaluation. The mapping currently in use does not support this path. "
                             "It is safe to uncomment this assertion, but you can expect a performance penalty."));
 
-          const std::vector<UpdateFlags> update_flags = property_manager->get_update_flags();
-
-          // combine all update flags to a single flag, which is the required information
-          // for the mapping inside the solution evaluator
-          UpdateFlags mapping_flags = update_flags[0];
-          for (unsigned int i=1; i<update_flags.size(); ++i)
-            mapping_flags |= update_flags[i];
-
-          std::unique_ptr<SolutionEvaluator<dim>> evaluator = construct_solution_evaluator(*this,
-                                                               mapping_flags);
-
+          // combine all update flags of all managers to a single flag, which
+          // is the required information for the mapping inside the solution evaluator.
           // FEPointEvaluation uses different evaluation flags than the common UpdateFlags.
-          // Translate between the two.
-          std::vector<EvaluationFlags::EvaluationFlags> evaluation_flags (update_flags.size(), EvaluationFlags::nothing);
+          // Translate between the two for every manager.
+          UpdateFlags mapping_flags = update_default;
+          std::vector<std::vector<EvaluationFlags::EvaluationFlags>> evaluation_flags (managers_with_properties.size());
 
-          for (unsigned int i=0; i<update_flags.size(); ++i)
+          for (unsigned int m=0; m<managers_with_properties.size(); ++m)
             {
-              if (update_flags[i] & update_values)
-                evaluation_flags[i] |= EvaluationFlags::values;
+              const std::vector<UpdateFlags> update_flags = managers_with_properties[m]->property_manager->get_update_flags();
+              evaluation_flags[m].resize(update_flags.size(), EvaluationFlags::nothing);
+
+              for (unsigned int i=0; i<update_flags.size(); ++i)
+                {
+                  mapping_flags |= update_flags[i];
+
+                  if (update_flags[i] & update_values)
+                    evaluation_flags[m][i] |= EvaluationFlags::values;
 
-              if (update_flags[i] & update_gradients)
-                evaluation_flags[i] |= EvaluationFlags::gradients;
+                  if (update_flags[i] & update_gradients)
+                    evaluation_flags[m][i] |= EvaluationFlags::gradients;
+                }
             }
 
+          std::unique_ptr<SolutionEvaluator<dim>> evaluator = construct_solution_evaluator(simulator_access,
+                                                               mapping_flags);
+
           Property::ParticleUpdateInputs<dim> inputs;
           small_vector<Point<dim>> positions;
+          small_vector<double> solution_values(simulator_access.get_fe().dofs_per_cell);
 
-          // Loop over all cells and update the particles cell-wise
-          for (const auto &cell : this->get_dof_handler().active_cell_iterators())
+          // Loop over all cells once and update the particles of all managers
+          // cell-wise. The solution values of each cell are only extracted once.
+          for (const auto &cell : simulator_access.get_dof_handler().active_cell_iterators())
             if (cell->is_locally_owned())
               {
-                // Only update particles if there are any in this cell
-                if (particle_handler->n_particles_in_cell(cell) > 0)
+                bool solution_values_extracted = false;
+
+                for (unsigned int m=0; m<managers_with_properties.size(); ++m)
                   {
-                    inputs.current_cell = cell;
-                    local_update_particles(inputs,
-                                           positions,
-                                           evaluation_flags,
-                                           *evaluator);
-                  }
+                    Manager<dim> &particle_manager = *managers_with_properties[m];
 
+                    // Only update particles if there are any in this cell
+                    if (particle_manager.particle_handler->n_particles_in_cell(cell) > 0)
+                      {
+                        Utilities::ScopedWallTimeAccumulator cell_cost_measurement (simulator_access.get_parameters().measure_cell_costs
+                                                                                    ?
+                                                                                    &simulator_access.get_measured_cell_costs()[cell->active_cell_index()]
+                                                                                    :
+                                                                                    nullptr);
+
+                        if (solution_values_extracted == false)
+                          {
+                            cell->get_dof_values(simulator_access.get_solution(),
+                                                 solution_values.begin(),
+                                                 solution_values.end());
+                            solution_values_extracted = true;
+                          }
+
+                        inputs.current_cell = cell;
+                        particle_manager.local_update_particles(inputs,
+                                                                positions,
+                                                                evaluation_flags[m],
+                                                                solution_values,
+                                                                *evaluator);
+                      }
+                  }
               }
         }
     }
@@ -685,73 +735,261 @@ namespace aspect
 
     template <int dim>
     void
-    Manager<dim>::advect_particles()
+    Manager<dim>::advect_particles(const std::vector<Manager<dim> *> &particle_managers)
     {
+      Assert(particle_managers.size() > 0, ExcInternalError());
+
+      // All managers belong to the same simulator, so we can use the
+      // first one to access the simulator.
+      const Manager<dim> &simulator_access = *particle_managers.front();
+
       {
         // TODO: Change this loop over all cells to use the WorkStream interface
-        TimerOutput::Scope timer_section(this->get_computing_timer(), "Particles: Advect");
+        TimerOutput::Scope timer_section(simulator_access.get_computing_timer(), "Particles: Advect");
 
-        Assert(dealii::internal::FEPointEvaluation::is_fast_path_supported(this->get_mapping()) == true,
+        Assert(dealii::internal::FEPointEvaluation::is_fast_path_supported(simulator_access.get_mapping()) == true,
                ExcMessage("The particle system was optimized for deal.II mappings that support the fast evaluation path "
                           "of the class FEPointEvaluation. The mapping currently in use does not support this path. "
                           "It is safe to uncomment this assertion, but you can expect a performance penalty."));
 
-        std::unique_ptr<SolutionEvaluator<dim>> evaluator = construct_solution_evaluator(*this,
+        std::unique_ptr<SolutionEvaluator<dim>> evaluator = construct_solution_evaluator(simulator_access,
                                                              update_values);
 
-        // Loop over all cells and advect the particles cell-wise
-        for (const auto &cell : this->get_dof_handler().active_cell_iterators())
+        small_vector<double> old_solution_values(simulator_access.get_fe().dofs_per_cell);
+        small_vector<double> solution_values(simulator_access.get_fe().dofs_per_cell);
+
+        // Loop over all cells once and advect the particles of all managers
+        // cell-wise. The solution values of each cell are only extracted once,
+        // even if the integrators of several managers require them.
+        for (const auto &cell : simulator_access.get_dof_handler().active_cell_iterators())
           if (cell->is_locally_owned())
             {
-              const typename ParticleHandler<dim>::particle_iterator_range
-              particles_in_cell = particle_handler->particles_in_cell(cell);
+              bool old_solution_values_extracted = false;
+              bool solution_values_extracted = false;
 
-              // Only advect particles, if there are any in this cell
-              if (particles_in_cell.begin() != particles_in_cell.end())
+              for (Manager<dim> *particle_manager : particle_managers)
                 {
-                  local_advect_particles(cell,
-                                         particles_in_cell.begin(),
-                                         particles_in_cell.end(),
-                                         *evaluator);
+                  const typename ParticleHandler<dim>::particle_iterator_range
+                  particles_in_cell = particle_manager->particle_handler->particles_in_cell(cell);
+
+                  // Only advect particles, if there are any in this cell
+                  if (particles_in_cell.begin() != particles_in_cell.end())
+                    {
+                      Utilities::ScopedWallTimeAccumulator cell_cost_measurement (simulator_access.get_parameters().measure_cell_costs
+                                                                                  ?
+                                                                                  &simulator_access.get_measured_cell_costs()[cell->active_cell_index()]
+                                                                                  :
+                                                                                  nullptr);
+
+                      const std::array<bool, 3> required_solution_vectors = particle_manager->integrator->required_solution_vectors();
+
+                      if (required_solution_vectors[1] == true && old_solution_values_extracted == false)
+                        {
+                          cell->get_dof_values(simulator_access.get_old_solution(),
+                                               old_solution_values.begin(),
+                                               old_solution_values.end());
+                          old_solution_values_extracted = true;
+                        }
+
+                      if (required_solution_vectors[2] == true && solution_values_extracted == false)
+                        {
+                          cell->get_dof_values(simulator_access.get_current_linearization_point(),
+                                               solution_values.begin(),
+                                               solution_values.end());
+                          solution_values_extracted = true;
+                        }
+
+                      particle_manager->local_advect_particles(cell,
+                                                               particles_in_cell.begin(),
+                                                               particles_in_cell.end(),
+                                                               old_solution_values,
+                                                               solution_values,
+                                                               *evaluator);
+                    }
                 }
             }
       }
 
       {
-        TimerOutput::Scope timer_section(this->get_computing_timer(), "Particles: Sort");
+        TimerOutput::Scope timer_section(simulator_access.get_computing_timer(), "Particles: Sort");
         // Find the cells that the particles moved to
-        particle_handler->sort_particles_into_subdomains_and_cells();
+        for (Manager<dim> *particle_manager : particle_managers)
+          if (particle_manager->particles_left_their_cells())
+            particle_manager->particle_handler->sort_particles_into_subdomains_and_cells();
       }
     }
 
 
 
+    template <int dim>
+    bool
+    Manager<dim>::particles_left_their_cells()
+    {
+      // Integrators that are not adaptive move all particles in every
+      // integration step, so there is nothing to check. Otherwise, if the
+      // integrator moved all particles, sorting them into their new cells
+      // is cheaper than checking them one by one first.
+      if (integrator->is_adaptive() == false)
+        return true;
+
+      types::particle_index n_unmoved_particles = 0;
+      for (auto particle = particle_handler->begin(); particle != particle_handler->end(); ++particle)
+        if (integrator->particle_needs_integration(particle) == false)
+          ++n_unmoved_particles;
+
+      if (dealii::Utilities::MPI::sum(n_unmoved_particles, this->get_mpi_communicator()) == 0)
+        return true;
+
+      // Otherwise only check the particles that were moved. Those that are
+      // still in their cell only need their reference location updated.
+      bool particle_left_cell = false;
+      for (auto particle = particle_handler->begin(); particle != particle_handler->end(); ++particle)
+        if (integrator->particle_needs_integration(particle))
+          {
+            const typename Triangulation<dim>::active_cell_iterator cell = particle->get_surrounding_cell();
+            try
+              {
+                const Point<dim> reference_location = this->get_mapping().transform_real_to_unit_cell(cell,
+                                                      particle->get_location());
+                if (cell->reference_cell().contains_point(reference_location))
+                  {
+                    particle->set_reference_location(reference_location);
+                    continue;
+                  }
+              }
+            catch (typename Mapping<dim>::ExcTransformationFailed &)
+              {
+                // The particle is too far from its old cell to find its
+                // reference location there.
+              }
+
+            particle_left_cell = true;
+            break;
+          }
+
+      return (dealii::Utilities::MPI::max(particle_left_cell ? 1 : 0, this->get_mpi_communicator()) == 1);
+    }
+
+
+
+    template <int dim>
+    double
+    Manager<dim>::compute_storage_fragmentation() const
+    {
+      const types::particle_index n_particles = particle_handler->n_locally_owned_particles();
+      if (n_particles < 2)
+        return 0.0;
+
+      const unsigned int n_properties = particle_handler->n_properties_per_particle();
+
+      types::particle_index n_non_contiguous_particles = 0;
+      const double *previous_properties = nullptr;
+      for (const auto &particle : *particle_handler)
+        {
+          const double *properties = particle.get_properties().data();
+          if (previous_properties != nullptr
+              && properties != previous_properties + n_properties
+              && properties != previous_properties - n_properties)
+            ++n_non_contiguous_particles;
+
+          previous_properties = properties;
+        }
+
+      return static_cast<double>(n_non_contiguous_particles) / (n_particles - 1);
+    }
+
+
+
+    template <int dim>
+    void
+    Manager<dim>::sort_particle_storage()
+    {
+      TimerOutput::Scope timer_section(this->get_computing_timer(), "Particles: Sort storage");
+
+      // The particle handler does not give access to the property pool
+      // handles of its particles, but after locating all particles in their
+      // cells it reorders the memory slots of the property pool in place
+      // (using PropertyPool::sort_memory_slots()) so that they follow the
+      // order in which the cells and their particles are traversed. The
+      // particles are already in the correct cells, so no particle changes
+      // its owner or cell here.
+      particle_handler->sort_particles_into_subdomains_and_cells();
+    }
+
+
+
     template <int dim>
     void
     Manager<dim>::advance_timestep()
     {
-      this->get_pcout() << "   Advecting particles... " << std::flush;
+      advance_timestep({this});
+    }
+
+
+
+    template <int dim>
+    void
+    Manager<dim>::advance_timestep(const std::vector<Manager<dim> *> &particle_managers)
+    {
+      if (particle_managers.empty())
+        return;
+
+      particle_managers.front()->get_pcout() << "   Advecting particles... " << std::flush;
+
+      // Keep calling the integrators until they indicate they are finished.
+      // Managers whose integrators need fewer integration steps drop out
+      // of the shared advection passes early.
+      std::vector<Manager<dim> *> integrating_managers = particle_managers;
       do
         {
-          advect_particles();
+          advect_particles(integrating_managers);
+
+          std::vector<Manager<dim> *> unfinished_managers;
+          for (Manager<dim> *particle_manager : integrating_managers)
+            if (particle_manager->integrator->new_integration_step())
+              unfinished_managers.push_back(particle_manager);
+
+          integrating_managers = std::move(unfinished_managers);
         }
-      // Keep calling the integrator until it indicates it is finished
-      while (integrator->new_integration_step());
+      while (integrating_managers.size() > 0);
 
-      apply_particle_per_cell_bounds();
+      std::vector<Manager<dim> *> managers_to_update;
+      for (Manager<dim> *particle_manager : particle_managers)
+        {
+          particle_manager->apply_particle_per_cell_bounds();
+
+          if (particle_manager->property_manager->need_update() == Property::update_time_step)
+            managers_to_update.push_back(particle_manager);
+        }
 
       // Update particle properties
-      if (property_manager->need_update() == Property::update_time_step)
-        update_particles();
+      update_particles(managers_to_update);
 
-      // Now that all particle information was updated, exchange the new
-      // ghost particles.
-      if (dealii::Utilities::MPI::n_mpi_processes(this->get_mpi_communicator()) > 1)
+      for (Manager<dim> *particle_manager : particle_managers)
         {
-          TimerOutput::Scope timer_section(this->get_computing_timer(), "Particles: Exchange ghosts");
-          particle_handler->exchange_ghost_particles();
+          // Advection and the exchange of particles between processes scatter
+          // the properties of neighboring particles in memory. If this has
+          // progressed far enough, restore a contiguous storage order.
+          // Sorting the storage is a collective operation, so all processes
+          // have to agree on whether it is necessary.
+          if (particle_manager->storage_fragmentation_threshold < 1.0
+              && particle_manager->property_manager->get_n_property_components() > 0
+              && dealii::Utilities::MPI::max(particle_manager->compute_storage_fragmentation(),
+                                             particle_manager->get_mpi_communicator())
+              > particle_manager->storage_fragmentation_threshold)
+            particle_manager->sort_particle_storage();
+
+          // Now that all particle information was updated, exchange the new
+          // ghost particles, unless the interpolator does not need them.
+          if (dealii::Utilities::MPI::n_mpi_processes(particle_manager->get_mpi_communicator()) > 1
+              && particle_manager->interpolator->needs_ghost_particles())
+            {
+              TimerOutput::Scope timer_section(particle_manager->get_computing_timer(), "Particles: Exchange ghosts");
+              particle_manager->particle_handler->exchange_ghost_particles();
+            }
         }
-      this->get_pcout() << " done." << std::endl;
+
+      particle_managers.front()->get_pcout() << " done." << std::endl;
     }
 
 
@@ -833,7 +1071,25 @@ namespace aspect
                                "expensive integrator and more expensive properties a larger "
                                "particle weight is recommended. Before adding the weights "
                                "of particles, each cell already carries a weight of 1000 to "
-                               "account for the cost of field-based computations.");
+                               "account for the cost of field-based computations, unless "
+                               "'Mesh refinement/Measure cell costs' is set, in which case "
+                               "the measured weight of the cell is used instead.");
+            prm.declare_entry ("Storage fragmentation threshold", "1",
+                               Patterns::Double (0., 1.),
+                               "Advecting particles and exchanging them between processes "
+                               "scatters the properties of particles that are close to each "
+                               "other in space across memory, which makes loops over the "
+                               "particles of a cell less cache efficient. This is noticeable "
+                               "for particles that carry many properties, such as crystal "
+                               "preferred orientations or elastic tensors. If the fraction "
+                               "of locally owned particles whose properties are not stored "
+                               "directly next to those of the previous particle exceeds this "
+                               "threshold on any process at the end of a time step, the "
+                               "property storage of all particles is sorted in place into the "
+                               "order in which the cells and their particles are traversed, "
+                               "which makes it contiguous again. A value of 1 disables this "
+                               "sorting. "
+                               "Units: None.");
             prm.declare_entry ("Update ghost particles", "true",
                                Patterns::Bool (),
                                "Some particle interpolation algorithms require knowledge "
@@ -841,8 +1097,10 @@ namespace aspect
                                "particles in ghost cells need to be exchanged between the "
                                "processes neighboring this cell. This parameter determines "
                                "whether this transport is happening. This parameter is "
-                               "deprecated and will be removed in the future. Ghost particle "
-                               "updates are always performed. Please set the parameter to `true'.");
+                               "deprecated and will be removed in the future. Ghost particles "
+                               "are now exchanged automatically whenever the selected "
+                               "interpolation scheme needs them, and are not exchanged "
+                               "otherwise. Please set the parameter to `true'.");
 
             Generator::declare_parameters<dim>(prm);
             Integrator::declare_parameters<dim>(prm);
@@ -893,11 +1151,13 @@ namespace aspect
                                "that is smaller than or equal to the 'Maximum particles per cell' parameter."));
 
         particle_weight = prm.get_integer("Particle weight");
+        storage_fragmentation_threshold = prm.get_double("Storage fragmentation threshold");
 
         const bool update_ghost_particles = prm.get_bool("Update ghost particles");
         AssertThrow(update_ghost_particles == true,
                     ExcMessage("The 'Update ghost particles' parameter is deprecated and will be removed in the future. "
-                               "Ghost particle updates are always performed. Please set the parameter to `true'."));
+                               "Ghost particles are exchanged automatically whenever the selected "
+                               "interpolation scheme needs them. Please set the parameter to `true'."));
 
         const std::vector<std::string> strategies = Utilities::split_string_list(prm.get ("Load balancing strategy"));
         AssertThrow(Utilities::has_unique_entries(strategies),
@@ -945,8 +1205,14 @@ namespace aspect
 #endif
           {
             // Only add the base weight of cells in particle manager 0, because all weights will be summed
-            // across all particle managers.
-            return (particle_manager == 0) ? 1000 + this->cell_weight(cell, status) : this->cell_weight(cell, status);
+            // across all particle managers. If the cost of each cell is measured, the measured weight
+            // already contains the work that does not depend on the particles, so do not add the
+            // base weight at all.
+            return (particle_manager == 0 && !this->get_parameters().measure_cell_costs)
+                   ?
+                   1000 + this->cell_weight(cell, status)
+                   :
+                   this->cell_weight(cell, status);
           });
 
 
@@ -22,6 +22,8 @@
 #include <aspect/geometry_model/interface.h>
 #include <aspect/utilities.h>
 
+#include <deal.II/base/vectorization.h>
+
 #include <world_builder/grains.h>
 #include <world_builder/world.h>
 
@@ -207,13 +209,29 @@ namespace aspect
           {
             data.emplace_back(deformation_type[mineral_i]);
             data.emplace_back(volume_fractions_minerals[mineral_i]);
-            for (unsigned int grain_i = 0; grain_i < n_grains ; ++grain_i)
+
+            if (grain_data_layout == GrainDataLayout::grain_contiguous)
               {
-                data.emplace_back(volume_fractions_grains[mineral_i][grain_i]);
+                for (unsigned int grain_i = 0; grain_i < n_grains ; ++grain_i)
+                  data.emplace_back(volume_fractions_grains[mineral_i][grain_i]);
+
                 for (unsigned int i = 0; i < Tensor<2,3>::n_independent_components ; ++i)
                   {
                     const dealii::TableIndices<2> index = Tensor<2,3>::unrolled_to_component_indices(i);
-                    data.emplace_back(rotation_matrices_grains[mineral_i][grain_i][index]);
+                    for (unsigned int grain_i = 0; grain_i < n_grains ; ++grain_i)
+                      data.emplace_back(rotation_matrices_grains[mineral_i][grain_i][index]);
+                  }
+              }
+            else
+              {
+                for (unsigned int grain_i = 0; grain_i < n_grains ; ++grain_i)
+                  {
+                    data.emplace_back(volume_fractions_grains[mineral_i][grain_i]);
+                    for (unsigned int i = 0; i < Tensor<2,3>::n_independent_components ; ++i)
+                      {
+                        const dealii::TableIndices<2> index = Tensor<2,3>::unrolled_to_component_indices(i);
+                        data.emplace_back(rotation_matrices_grains[mineral_i][grain_i][index]);
+                      }
                   }
               }
           }
@@ -448,13 +466,25 @@ namespace aspect
             property_information.emplace_back("cpo mineral " + std::to_string(mineral_i) + " type",1);
             property_information.emplace_back("cpo mineral " + std::to_string(mineral_i) + " volume fraction",1);
 
-            for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
+            if (grain_data_layout == GrainDataLayout::grain_contiguous)
               {
-                property_information.emplace_back("cpo mineral " + std::to_string(mineral_i) + " grain " + std::to_string(grain_i) + " volume fraction",1);
+                for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
+                  property_information.emplace_back("cpo mineral " + std::to_string(mineral_i) + " grain " + std::to_string(grain_i) + " volume fraction",1);
 
                 for (unsigned int index = 0; index < Tensor<2,3>::n_independent_components; ++index)
-                  {
+                  for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
                     property_information.emplace_back("cpo mineral " + std::to_string(mineral_i) + " grain " + std::to_string(grain_i) + " rotation_matrix " + std::to_string(index),1);
+              }
+            else
+              {
+                for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
+                  {
+                    property_information.emplace_back("cpo mineral " + std::to_string(mineral_i) + " grain " + std::to_string(grain_i) + " volume fraction",1);
+
+                    for (unsigned int index = 0; index < Tensor<2,3>::n_independent_components; ++index)
+                      {
+                        property_information.emplace_back("cpo mineral " + std::to_string(mineral_i) + " grain " + std::to_string(grain_i) + " rotation_matrix " + std::to_string(index),1);
+                      }
                   }
               }
           }
@@ -472,6 +502,9 @@ namespace aspect
                                                              const double dt,
                                                              const std::pair<std::vector<double>, std::vector<Tensor<2,3>>> &derivatives) const
       {
+        if (grain_data_layout == GrainDataLayout::grain_contiguous)
+          return advect_forward_euler_grain_contiguous(cpo_index, data, mineral_i, dt, derivatives);
+
         double sum_volume_fractions = 0;
         Tensor<2,3> rotation_matrix;
         for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
@@ -499,6 +532,65 @@ namespace aspect
 
 
 
+      template <int dim>
+      double
+      CrystalPreferredOrientation<dim>::advect_forward_euler_grain_contiguous(const unsigned int cpo_index,
+                                                                              const ArrayView<double> &data,
+                                                                              const unsigned int mineral_i,
+                                                                              const double dt,
+                                                                              const std::pair<std::vector<double>, std::vector<Tensor<2,3>>> &derivatives) const
+      {
+        Assert(grain_data_layout == GrainDataLayout::grain_contiguous, ExcInternalError());
+
+        // In the grain contiguous layout each quantity is stored in one array for all grains,
+        // so we can update the grains without any indirection and the loops over the
+        // grains can be vectorized. The operations are the same as in advect_forward_euler().
+        double *const volume_fractions = &data[cpo_index + volume_fraction_grain_index(mineral_i,0)];
+        const std::vector<double> &volume_fraction_derivatives = derivatives.first;
+
+        for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
+          volume_fractions[grain_i] = volume_fractions[grain_i] + dt * volume_fractions[grain_i] * volume_fraction_derivatives[grain_i];
+
+        double sum_volume_fractions = 0;
+        for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
+          {
+            Assert(std::isfinite(volume_fractions[grain_i]),ExcMessage("volume_fractions[grain_i] is not finite. grain_i = "
+                                                                       + std::to_string(grain_i) + ", volume_fractions[grain_i] = " + std::to_string(volume_fractions[grain_i])
+                                                                       + ", derivatives.first[grain_i] = " + std::to_string(derivatives.first[grain_i])));
+            sum_volume_fractions += volume_fractions[grain_i];
+          }
+
+        // The components of the rotation matrices for all grains. The unrolled index of
+        // component (i,j) of a Tensor<2,3> is 3*i+j.
+        std::array<double *,Tensor<2,3>::n_independent_components> rotation_matrices;
+        for (unsigned int i = 0; i < Tensor<2,3>::n_independent_components; ++i)
+          rotation_matrices[i] = &data[cpo_index + rotation_matrix_grain_index(mineral_i,0,i)];
+
+        const std::vector<Tensor<2,3>> &rotation_derivatives = derivatives.second;
+        for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
+          {
+            // rotation_matrix += dt * rotation_matrix * derivative
+            double new_rotation_matrix[3][3];
+            for (unsigned int i = 0; i < 3; ++i)
+              for (unsigned int j = 0; j < 3; ++j)
+                {
+                  double increment = dt * rotation_matrices[3*i][grain_i] * rotation_derivatives[grain_i][0][j];
+                  for (unsigned int k = 1; k < 3; ++k)
+                    increment += dt * rotation_matrices[3*i+k][grain_i] * rotation_derivatives[grain_i][k][j];
+                  new_rotation_matrix[i][j] = rotation_matrices[3*i+j][grain_i] + increment;
+                }
+
+            for (unsigned int i = 0; i < 3; ++i)
+              for (unsigned int j = 0; j < 3; ++j)
+                rotation_matrices[3*i+j][grain_i] = new_rotation_matrix[i][j];
+          }
+
+        Assert(sum_volume_fractions != 0, ExcMessage("The sum of all grain volume fractions of a mineral is equal to zero. This should not happen."));
+        return sum_volume_fractions;
+      }
+
+
+
       template <int dim>
       double
       CrystalPreferredOrientation<dim>::advect_backward_euler(const unsigned int cpo_index,
@@ -672,6 +764,57 @@ namespace aspect
         std::vector<double> strain_energy(n_grains);
         double mean_strain_energy = 0;
 
+        const std::array<Tensor<1,3>,4> slip_normal_reference {{Tensor<1,3>({0,1,0}),Tensor<1,3>({0,0,1}),Tensor<1,3>({0,1,0}),Tensor<1,3>({1,0,0})}};
+        const std::array<Tensor<1,3>,4> slip_direction_reference {{Tensor<1,3>({1,0,0}),Tensor<1,3>({1,0,0}),Tensor<1,3>({0,0,1}),Tensor<1,3>({0,0,1})}};
+
+        // Compute the resolved strain rate (bigI) on all slip systems of all grains first.
+        // This part of the computation is the same for all grains, so we do it for
+        // several grains at once with vectorized arithmetic, where each lane performs
+        // exactly the same operations as the scalar version.
+        std::array<std::vector<double>,4> resolved_strain_rates;
+        for (auto &resolved_strain_rate : resolved_strain_rates)
+          resolved_strain_rate.resize(n_grains);
+
+        {
+          using VectorizedDouble = VectorizedArray<double>;
+          constexpr unsigned int n_lanes = VectorizedDouble::size();
+
+          const Tensor<2,3,VectorizedDouble> strain_rate_nondimensional_vectorized(strain_rate_nondimensional);
+          std::array<Tensor<1,3,VectorizedDouble>,4> slip_normal_reference_vectorized;
+          std::array<Tensor<1,3,VectorizedDouble>,4> slip_direction_reference_vectorized;
+          for (unsigned int slip_system_i = 0; slip_system_i < 4; ++slip_system_i)
+            {
+              slip_normal_reference_vectorized[slip_system_i] = slip_normal_reference[slip_system_i];
+              slip_direction_reference_vectorized[slip_system_i] = slip_direction_reference[slip_system_i];
+            }
+
+          for (unsigned int first_grain = 0; first_grain < n_grains; first_grain += n_lanes)
+            {
+              const unsigned int n_filled_lanes = std::min(n_lanes, n_grains - first_grain);
+
+              // Unused lanes keep a zero matrix, their results are ignored.
+              Tensor<2,3,VectorizedDouble> rotation_matrix_transposed;
+              for (unsigned int lane = 0; lane < n_filled_lanes; ++lane)
+                {
+                  const Tensor<2,3> rotation_matrix = get_rotation_matrix_grains(cpo_index,data,mineral_i,first_grain+lane);
+                  for (unsigned int i = 0; i < 3; ++i)
+                    for (unsigned int j = 0; j < 3; ++j)
+                      rotation_matrix_transposed[i][j][lane] = rotation_matrix[j][i];
+                }
+
+              for (unsigned int slip_system_i = 0; slip_system_i < 4; ++slip_system_i)
+                {
+                  const Tensor<1,3,VectorizedDouble> slip_normal_global = rotation_matrix_transposed*slip_normal_reference_vectorized[slip_system_i];
+                  const Tensor<1,3,VectorizedDouble> slip_direction_global = rotation_matrix_transposed*slip_direction_reference_vectorized[slip_system_i];
+                  const Tensor<2,3,VectorizedDouble> slip_cross_product = outer_product(slip_direction_global,slip_normal_global);
+                  const VectorizedDouble bigI = scalar_product(slip_cross_product,strain_rate_nondimensional_vectorized);
+
+                  for (unsigned int lane = 0; lane < n_filled_lanes; ++lane)
+                    resolved_strain_rates[slip_system_i][first_grain+lane] = bigI[lane];
+                }
+            }
+        }
+
         for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
           {
             // Compute the Schmidt tensor for this grain (nu), s is the slip system.
@@ -680,8 +823,6 @@ namespace aspect
             Tensor<2,3> G;
             Tensor<1,3> w;
             Tensor<1,4> beta({1.0, 1.0, 1.0, 1.0});
-            std::array<Tensor<1,3>,4> slip_normal_reference {{Tensor<1,3>({0,1,0}),Tensor<1,3>({0,0,1}),Tensor<1,3>({0,1,0}),Tensor<1,3>({1,0,0})}};
-            std::array<Tensor<1,3>,4> slip_direction_reference {{Tensor<1,3>({1,0,0}),Tensor<1,3>({1,0,0}),Tensor<1,3>({0,0,1}),Tensor<1,3>({0,0,1})}};
 
             // these are variables we only need for olivine, but we need them for both
             // within this if block and the next ones
@@ -693,12 +834,7 @@ namespace aspect
             const Tensor<2,3> rotation_matrix = get_rotation_matrix_grains(cpo_index,data,mineral_i,grain_i);
             const Tensor<2,3> rotation_matrix_transposed = transpose(rotation_matrix);
             for (unsigned int slip_system_i = 0; slip_system_i < 4; ++slip_system_i)
-              {
-                const Tensor<1,3> slip_normal_global = rotation_matrix_transposed*slip_normal_reference[slip_system_i];
-                const Tensor<1,3> slip_direction_global = rotation_matrix_transposed*slip_direction_reference[slip_system_i];
-                const Tensor<2,3> slip_cross_product = outer_product(slip_direction_global,slip_normal_global);
-                bigI[slip_system_i] = scalar_product(slip_cross_product,strain_rate_nondimensional);
-              }
+              bigI[slip_system_i] = resolved_strain_rates[slip_system_i][grain_i];
 
             if (bigI.norm() < 1e-10)
               {
@@ -1052,6 +1188,16 @@ namespace aspect
                              "This option allows for setting the maximum number of iterations. Note that when the iteration "
                              "is ended by the max iteration amount an assert is thrown.");
 
+          prm.declare_entry ("Grain data layout", "interleaved",
+                             Patterns::Selection ("interleaved|grain contiguous"),
+                             "How the data of the grains is stored on the particles. With "
+                             "`interleaved', the volume fraction and rotation matrix of each grain "
+                             "are stored together. With `grain contiguous', the volume fractions of "
+                             "all grains of a mineral are stored next to each other, followed by each "
+                             "component of the rotation matrices of all grains. The second layout "
+                             "allows vectorizing the computations across grains and is therefore "
+                             "faster for large numbers of grains. Note that the layout determines "
+                             "the order of the particle properties in the output.");
           prm.declare_entry ("CPO derivatives algorithm", "Spin tensor",
                              Patterns::List(Patterns::Anything()),
                              "Options: Spin tensor");
@@ -1153,6 +1299,11 @@ namespace aspect
                                      "Spin tensor, D-Rex 2004."));
             }
 
+          if (prm.get("Grain data layout") == "grain contiguous")
+            grain_data_layout = GrainDataLayout::grain_contiguous;
+          else
+            grain_data_layout = GrainDataLayout::interleaved;
+
           const std::string temp_advection_method = prm.get("Property advection method");
           if (temp_advection_method == "Forward Euler")
             {
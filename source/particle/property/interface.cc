@@ -24,6 +24,7 @@
 #include <aspect/particle/integrator/euler.h>
 #include <aspect/particle/integrator/rk_2.h>
 #include <aspect/particle/integrator/rk_4.h>
+#include <aspect/particle/integrator/rk_23.h>
 
 
 #include <aspect/boundary_composition/interface.h>
@@ -382,6 +383,8 @@ namespace aspect
           n_integrator_properties = Particle::Integrator::RK2<dim>::n_integrator_properties;
         else if (name == "rk4")
           n_integrator_properties = Particle::Integrator::RK4<dim>::n_integrator_properties;
+        else if (name == "rk23")
+          n_integrator_properties = Particle::Integrator::RK23<dim>::n_integrator_properties;
         else if (name == "euler")
           n_integrator_properties = Particle::Integrator::Euler<dim>::n_integrator_properties;
         else
@@ -60,34 +60,46 @@ namespace aspect
 
 
     template <int dim>
-    Tensor<1,dim>
-    BoundaryVelocityResidualStatistics<dim>::get_data_velocity (const Point<dim> &p) const
+    void
+    BoundaryVelocityResidualStatistics<dim>::get_data_velocities (const std::vector<Point<dim>> &points,
+                                                                  std::vector<Tensor<1,dim>> &data_velocities) const
     {
-      Tensor<1,dim> data_velocity;
+      data_velocities.resize(points.size());
+
       if (use_ascii_data)
         {
-          Point<dim> internal_position = p;
+          std::vector<Point<dim>> internal_positions = points;
 
           if (this->get_geometry_model().natural_coordinate_system() == Utilities::Coordinates::spherical)
+            for (unsigned int q = 0; q < points.size(); ++q)
+              {
+                const std::array<double,dim> spherical_position = this->get_geometry_model().
+                                                                  cartesian_to_natural_coordinates(points[q]);
+
+                for (unsigned int d = 0; d < dim; ++d)
+                  internal_positions[q][d] = spherical_position[d];
+              }
+
+          // Look up all velocity components at all points at once, so that
+          // the location of each point in the data grid is only computed once.
+          std::vector<std::vector<double>> data_values;
+          data_lookup->get_data(make_array_view(internal_positions),
+                                ComponentMask(),
+                                data_values);
+
+          for (unsigned int q = 0; q < points.size(); ++q)
             {
-              const std::array<double,dim> spherical_position = this->get_geometry_model().
-                                                                cartesian_to_natural_coordinates(p);
-
               for (unsigned int d = 0; d < dim; ++d)
-                internal_position[d] = spherical_position[d];
+                data_velocities[q][d] = data_values[d][q];
+              if (use_spherical_unit_vectors == true)
+                data_velocities[q] = Utilities::Coordinates::spherical_to_cartesian_vector(data_velocities[q], points[q]);
             }
-
-          for (unsigned int d = 0; d < dim; ++d)
-            data_velocity[d] = data_lookup->get_data(internal_position, d);
-          if (use_spherical_unit_vectors == true)
-            data_velocity = Utilities::Coordinates::spherical_to_cartesian_vector(data_velocity, p);
         }
       else
         {
-          data_velocity =  gplates_lookup->surface_velocity(p);
+          for (unsigned int q = 0; q < points.size(); ++q)
+            data_velocities[q] = gplates_lookup->surface_velocity(points[q]);
         }
-
-      return data_velocity;
     }
 
 
@@ -107,6 +119,7 @@ namespace aspect
                                         update_quadrature_points);
 
       std::vector<Tensor<1,dim>> velocities (fe_face_values.n_quadrature_points);
+      std::vector<Tensor<1,dim>> data_velocities (fe_face_values.n_quadrature_points);
 
       std::map<types::boundary_id, double> local_max_vel;
       std::map<types::boundary_id, double> local_min_vel;
@@ -141,6 +154,8 @@ namespace aspect
 
                   fe_face_values[this->introspection().extractors.velocities].get_function_values (this->get_solution(),
                       velocities);
+                  get_data_velocities (fe_face_values.get_quadrature_points(),
+                                       data_velocities);
 
                   // determine the max, min, and squared velocity residual on the face
                   // also determine the face area
@@ -150,9 +165,8 @@ namespace aspect
                   double local_fe_face_area = 0.0;
                   for (unsigned int q=0; q<fe_face_values.n_quadrature_points; ++q)
                     {
-                      const Point<dim> point_at_surface = fe_face_values.quadrature_point(q);
                       // Extract data velocity.
-                      Tensor<1,dim> data_velocity = get_data_velocity(point_at_surface);
+                      Tensor<1,dim> data_velocity = data_velocities[q];
 
                       if (this->convert_output_to_years() == true)
                         data_velocity = data_velocity/year_in_seconds;
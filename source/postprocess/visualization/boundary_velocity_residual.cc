@@ -79,12 +79,15 @@ namespace aspect
             cell_at_top_boundary = true;
 
         if (cell_at_top_boundary)
-          for (unsigned int q=0; q<computed_quantities.size(); ++q)
-            {
-              const Tensor<1,dim> data_velocity = boundary_velocity_residual_statistics.get_data_velocity(input_data.evaluation_points[q]);
+          {
+            std::vector<Tensor<1,dim>> data_velocities;
+            boundary_velocity_residual_statistics.get_data_velocities(input_data.evaluation_points,
+                                                                      data_velocities);
+
+            for (unsigned int q=0; q<computed_quantities.size(); ++q)
               for (unsigned int d = 0; d < dim; ++d)
-                computed_quantities[q](d) = data_velocity[d] - input_data.solution_values[q][d] * velocity_scaling_factor;
-            }
+                computed_quantities[q](d) = data_velocities[q][d] - input_data.solution_values[q][d] * velocity_scaling_factor;
+          }
 
       }
 
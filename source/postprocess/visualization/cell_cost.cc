@@ -0,0 +1,92 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <aspect/postprocess/visualization/cell_cost.h>
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    namespace VisualizationPostprocessors
+    {
+      template <int dim>
+      CellCost<dim>::
+      CellCost ()
+        :
+        CellDataVectorCreator<dim>("s")
+      {}
+
+
+
+      template <int dim>
+      std::pair<std::string, std::unique_ptr<Vector<float>>>
+      CellCost<dim>::execute() const
+      {
+        AssertThrow (this->get_parameters().measure_cell_costs == true,
+                     ExcMessage ("The 'cell cost' visualization postprocessor requires "
+                                 "that the parameter 'Mesh refinement/Measure cell costs' "
+                                 "is set to true."));
+
+        std::pair<std::string, std::unique_ptr<Vector<float>>>
+        return_value ("cell_cost",
+                      std::make_unique<Vector<float>>(this->get_triangulation().n_active_cells()));
+
+        const std::vector<double> &measured_cell_costs = this->get_measured_cell_costs();
+        Assert (measured_cell_costs.size() == this->get_triangulation().n_active_cells(),
+                ExcInternalError());
+
+        for (const auto &cell : this->get_triangulation().active_cell_iterators())
+          if (cell->is_locally_owned())
+            (*return_value.second)(cell->active_cell_index())
+              = static_cast<float>(measured_cell_costs[cell->active_cell_index()]);
+
+        return return_value;
+      }
+    }
+  }
+}
+
+
+// explicit instantiations
+namespace aspect
+{
+  namespace Postprocess
+  {
+    namespace VisualizationPostprocessors
+    {
+      ASPECT_REGISTER_VISUALIZATION_POSTPROCESSOR(CellCost,
+                                                  "cell cost",
+                                                  "A visualization output object that generates output "
+                                                  "for the wall time that was spent on each cell since "
+                                                  "the last change of the mesh, as measured if the "
+                                                  "parameter 'Mesh refinement/Measure cell costs' is set. "
+                                                  "The measurement includes the assembly of the Stokes "
+                                                  "and advection systems, the evaluation of the "
+                                                  "material model during assembly, and the advection "
+                                                  "and update of particles. These are the costs that "
+                                                  "are used to weight cells when the mesh is "
+                                                  "repartitioned between processes."
+                                                  "\n\n"
+                                                  "Physical units: \\si{\\second}.")
+    }
+  }
+}
@@ -50,10 +50,14 @@ namespace aspect
     AsciiData<dim>::
     stokes_solution (const Point<dim> &position, Vector<double> &value) const
     {
-      value(0) = Utilities::AsciiDataInitial<dim>::get_data_component(position,0);
-      value(1) = Utilities::AsciiDataInitial<dim>::get_data_component(position,1);
-      if (dim == 3)
-        value(2) = Utilities::AsciiDataInitial<dim>::get_data_component(position,2);
+      // Look up all velocity components at once, so that the position
+      // is only located in the data grid a single time
+      std::vector<std::vector<double>> data;
+      Utilities::AsciiDataInitial<dim>::get_data_components(make_array_view(&position, &position+1),
+                                                            ComponentMask(),
+                                                            data);
+      for (unsigned int d=0; d<dim; ++d)
+        value(d) = data[d][0];
       value(dim) = 0;  // makes pressure 0, must set pressure
     }
 
@@ -326,7 +326,8 @@ namespace aspect
                                                scratch.finite_element_values.get_quadrature(),
                                                scratch.finite_element_values.get_mapping(),
                                                scratch.material_model_inputs.requested_properties,
-                                               scratch.material_model_outputs);
+                                               scratch.material_model_outputs,
+                                               &projection_matrix_cache);
 
     for (unsigned int i=0; i<assemblers->stokes_preconditioner.size(); ++i)
       assemblers->stokes_preconditioner[i]->execute(scratch,data);
@@ -355,6 +356,8 @@ namespace aspect
     if (stokes_matrix_free)
       return;
 
+    update_projection_matrix_cache();
+
     system_preconditioner_matrix = 0;
 
     const Quadrature<dim> &quadrature_formula = introspection.quadratures.velocities;
@@ -552,6 +555,14 @@ namespace aspect
                                 internal::Assembly::Scratch::StokesSystem<dim> &scratch,
                                 internal::Assembly::CopyData::StokesSystem<dim> &data)
   {
+    // If requested, measure the time spent on this cell, including the
+    // evaluation of the material model.
+    Utilities::ScopedWallTimeAccumulator cell_cost_measurement (parameters.measure_cell_costs
+                                                                ?
+                                                                &measured_cell_costs[cell->active_cell_index()]
+                                                                :
+                                                                nullptr);
+
     // First get all dof indices of the current cell, then extract those
     // that correspond to the Stokes system we are interested in.
     // Note that assemblers below can modify this list of dofs, if they in fact
@@ -596,7 +607,8 @@ namespace aspect
                                                scratch.finite_element_values.get_quadrature(),
                                                scratch.finite_element_values.get_mapping(),
                                                scratch.material_model_inputs.requested_properties,
-                                               scratch.material_model_outputs);
+                                               scratch.material_model_outputs,
+                                               &projection_matrix_cache);
 
     scratch.finite_element_values[introspection.extractors.velocities].get_function_values(current_linearization_point,
         scratch.velocity_values);
@@ -742,6 +754,8 @@ namespace aspect
       Assert(rebuild_stokes_matrix || boundary_velocity_manager.get_active_boundary_velocity_conditions().size()==0,
              ExcInternalError("If we have inhomogeneous constraints, we must re-assemble the system matrix."));
 
+    update_projection_matrix_cache();
+
     system_rhs = 0;
     if (do_pressure_rhs_compatibility_modification)
       pressure_shape_function_integrals = 0;
@@ -877,6 +891,14 @@ namespace aspect
                                    internal::Assembly::Scratch::AdvectionSystem<dim> &scratch,
                                    internal::Assembly::CopyData::AdvectionSystem<dim> &data)
   {
+    // If requested, measure the time spent on this cell, including the
+    // evaluation of the material model.
+    Utilities::ScopedWallTimeAccumulator cell_cost_measurement (parameters.measure_cell_costs
+                                                                ?
+                                                                &measured_cell_costs[cell->active_cell_index()]
+                                                                :
+                                                                nullptr);
+
     // also have the number of dofs that correspond just to the element for
     // the system we are currently trying to assemble
     const unsigned int advection_dofs_per_cell = data.local_dof_indices.size();
@@ -979,7 +1001,8 @@ namespace aspect
                                                scratch.finite_element_values.get_quadrature(),
                                                scratch.finite_element_values.get_mapping(),
                                                scratch.material_model_inputs.requested_properties,
-                                               scratch.material_model_outputs);
+                                               scratch.material_model_outputs,
+                                               &projection_matrix_cache);
 
     heating_model_manager.evaluate(scratch.material_model_inputs,
                                    scratch.material_model_outputs,
@@ -24,6 +24,10 @@
 #include <aspect/mesh_deformation/interface.h>
 #include <aspect/melt.h>
 
+#ifdef ASPECT_WITH_WORLD_BUILDER
+#include <aspect/world_builder_query_cache.h>
+#endif
+
 #include <deal.II/base/mpi.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/distributed/solution_transfer.h>
@@ -461,6 +465,9 @@ namespace aspect
 #ifdef ASPECT_WITH_WORLD_BUILDER
     // The same applies to the world builder object:
     world_builder.reset();
+    if (world_builder_query_cache != nullptr)
+      world_builder_query_cache->stop_caching();
+    world_builder_query_cache.reset();
 #endif
 
     // Then start with the actual deserialization.
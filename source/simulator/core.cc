@@ -30,6 +30,7 @@
 #include <aspect/postprocess/particles.h>
 
 #ifdef ASPECT_WITH_WORLD_BUILDER
+#include <aspect/world_builder_query_cache.h>
 #include <world_builder/world.h>
 #endif
 
@@ -187,6 +188,9 @@ namespace aspect
     world_builder (parameters.world_builder_file != "" ?
                    std::make_shared<WorldBuilder::World>(parameters.world_builder_file) :
                    nullptr),
+    world_builder_query_cache (world_builder != nullptr ?
+                               std::make_shared<WorldBuilderQueryCache<dim>>(world_builder) :
+                               nullptr),
 #endif
     boundary_heat_flux (BoundaryHeatFlux::create_boundary_heat_flux<dim>(prm)),
     time (numbers::signaling_nan<double>()),
@@ -466,6 +470,38 @@ namespace aspect
           }
       }
 
+    // If requested, weight cells by their measured cost when the mesh is
+    // repartitioned. The average cost is computed collectively right before
+    // the triangulation asks for the weights of individual cells.
+    average_measured_cell_cost = 0;
+    store_refinement_indicators = false;
+    if (parameters.measure_cell_costs)
+      {
+        triangulation.signals.pre_distributed_refinement.connect(
+          [&]()
+        {
+          this->compute_average_measured_cell_cost();
+        });
+        triangulation.signals.pre_distributed_repartition.connect(
+          [&]()
+        {
+          this->compute_average_measured_cell_cost();
+        });
+        triangulation.signals.weight.connect(
+#if DEAL_II_VERSION_GTE(9,6,0)
+          [&] (const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell,
+               const CellStatus status)
+          -> unsigned int
+#else
+          [&] (const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell,
+               const typename parallel::distributed::Triangulation<dim>::CellStatus status)
+          -> unsigned int
+#endif
+        {
+          return this->measured_cell_weight(cell, status);
+        });
+      }
+
     mesh_refinement_manager.initialize_simulator (*this);
     mesh_refinement_manager.parse_parameters (prm);
 
@@ -1448,6 +1484,11 @@ namespace aspect
 
     dof_handler.distribute_dofs(finite_element);
 
+    // Start a new measurement of cell costs, since the old one
+    // referred to the cells of the previous mesh.
+    if (parameters.measure_cell_costs)
+      measured_cell_costs.assign(triangulation.n_active_cells(), 0.);
+
     // Renumber the DoFs hierarchical so that we get the
     // same numbering if we resume the computation. This
     // is because the numbering depends on the order the
@@ -1507,6 +1548,10 @@ namespace aspect
     if (parameters.mesh_deformation_enabled)
       mesh_deformation->setup_dofs();
 
+    // The mesh and possibly the mapping have changed, so the matrices
+    // for the material averaging have to be computed anew
+    projection_matrix_cache.clear();
+
 
     // Reconstruct the constraint-matrix:
 #if DEAL_II_VERSION_GTE(9,6,0)
@@ -1672,8 +1717,14 @@ namespace aspect
     {
       TimerOutput::Scope timer (computing_timer, "Refine mesh structure, part 1");
 
+      // Reuse the indicators if they were already computed for the
+      // current solution during postprocessing
       Vector<float> estimated_error_per_cell (triangulation.n_active_cells());
-      mesh_refinement_manager.execute (estimated_error_per_cell);
+      if (cached_refinement_indicators.size() == triangulation.n_active_cells())
+        estimated_error_per_cell = cached_refinement_indicators;
+      else
+        mesh_refinement_manager.execute (estimated_error_per_cell);
+      cached_refinement_indicators.reinit (0);
 
       if (parameters.adapt_by_fraction_of_cells)
         parallel::distributed::GridRefinement::
@@ -1887,6 +1938,7 @@ namespace aspect
     if (parameters.mesh_deformation_enabled)
       {
         mesh_deformation->execute ();
+        projection_matrix_cache.clear();
 
         // calculate global volume after deforming mesh
         global_volume = GridTools::volume (triangulation, *mapping);
@@ -2148,8 +2200,12 @@ namespace aspect
         initial_temperature_manager.reset();
         initial_composition_manager.reset();
 #ifdef ASPECT_WITH_WORLD_BUILDER
-        // The same applies to the world builder object:
+        // The same applies to the world builder object. Plugins that
+        // still use the query cache afterwards get uncached values:
         world_builder.reset();
+        if (world_builder_query_cache != nullptr)
+          world_builder_query_cache->stop_caching();
+        world_builder_query_cache.reset();
 #endif
         // Prepare the next time step:
         time_stepping_manager.update();
@@ -2160,7 +2216,14 @@ namespace aspect
         // solve_timestep () in the individual solver schemes
         if (!time_stepping_manager.should_repeat_time_step()
             && !parameters.run_postprocessors_on_nonlinear_iterations)
-          postprocess ();
+          {
+            // The solution and mesh do not change between the postprocessing
+            // and the mesh refinement below, so refinement indicators that
+            // postprocessors compute can be used for the refinement.
+            store_refinement_indicators = true;
+            postprocess ();
+            store_refinement_indicators = false;
+          }
 
         if (time_stepping_manager.should_refine_mesh())
           {
@@ -2170,6 +2233,10 @@ namespace aspect
         else
           maybe_refine_mesh(new_time_step_size, max_refinement_level);
 
+        // If the mesh was not refined, the stored indicators are outdated
+        // as soon as the next time step starts
+        cached_refinement_indicators.reinit (0);
+
         if (time_stepping_manager.should_repeat_time_step())
           {
             pcout << "Repeating the current time step based on the time stepping manager ..." << std::endl;
@@ -41,6 +41,7 @@
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/signaling_nan.h>
+#include <deal.II/base/work_stream.h>
 #include <deal.II/lac/block_sparsity_pattern.h>
 #include <deal.II/grid/grid_tools.h>
 
@@ -62,6 +63,94 @@
 
 namespace aspect
 {
+  namespace
+  {
+    /**
+     * Scratch data used by each thread to solve the reactions on a
+     * batch of cells in Simulator::compute_reactions(). Each thread has
+     * its own ARKode object, and one set of material and heating model
+     * inputs and outputs for each cell of the batch.
+     */
+    template <int dim>
+    struct ReactionScratchData
+    {
+      ReactionScratchData (const Mapping<dim> &mapping,
+                           const FiniteElement<dim> &finite_element,
+                           const Quadrature<dim> &quadrature,
+                           const unsigned int n_compositional_fields,
+                           const unsigned int max_cells_per_batch,
+                           const SUNDIALS::ARKode<Vector<double>>::AdditionalData &additional_data)
+        :
+        fe_values (mapping,
+                   finite_element,
+                   quadrature,
+                   update_quadrature_points | update_values | update_gradients),
+        local_dof_indices (finite_element.dofs_per_cell),
+        material_model_inputs (max_cells_per_batch,
+                               MaterialModel::MaterialModelInputs<dim>(quadrature.size(), n_compositional_fields)),
+        material_model_outputs (max_cells_per_batch,
+                                MaterialModel::MaterialModelOutputs<dim>(quadrature.size(), n_compositional_fields)),
+        heating_model_outputs (max_cells_per_batch,
+                               HeatingModel::HeatingModelOutputs(quadrature.size(), n_compositional_fields)),
+        ode_data (additional_data),
+        ode (additional_data)
+      {}
+
+      ReactionScratchData (const ReactionScratchData &scratch)
+        :
+        fe_values (scratch.fe_values.get_mapping(),
+                   scratch.fe_values.get_fe(),
+                   scratch.fe_values.get_quadrature(),
+                   scratch.fe_values.get_update_flags()),
+        local_dof_indices (scratch.local_dof_indices),
+        material_model_inputs (scratch.material_model_inputs),
+        material_model_outputs (scratch.material_model_outputs),
+        heating_model_outputs (scratch.heating_model_outputs),
+        ode_data (scratch.ode_data),
+        ode (scratch.ode_data)
+      {}
+
+      FEValues<dim> fe_values;
+      std::vector<types::global_dof_index> local_dof_indices;
+
+      std::vector<MaterialModel::MaterialModelInputs<dim>> material_model_inputs;
+      std::vector<MaterialModel::MaterialModelOutputs<dim>> material_model_outputs;
+      std::vector<HeatingModel::HeatingModelOutputs> heating_model_outputs;
+
+      const SUNDIALS::ARKode<Vector<double>>::AdditionalData ode_data;
+      SUNDIALS::ARKode<Vector<double>> ode;
+
+      /**
+       * The indices (within the batch) of the cells whose reactions
+       * need to be solved, and the values, initial values, rates, and
+       * accumulated changes of all fields in the support points of
+       * these cells.
+       */
+      std::vector<unsigned int> reacting_cells;
+      Vector<double> fields;
+      Vector<double> initial_fields;
+      Vector<double> rates;
+      Vector<double> accumulated_reactions;
+    };
+
+
+
+    /**
+     * The new values and reaction increments of the locally owned
+     * temperature and compositional degrees of freedom on a batch of cells,
+     * together with the statistics of the reaction solver.
+     */
+    struct ReactionCopyData
+    {
+      std::vector<types::global_dof_index> dof_indices;
+      std::vector<double> values;
+      std::vector<double> reactions;
+      unsigned int iteration_count;
+      unsigned int n_solves;
+    };
+  }
+
+
 
   template <int dim>
   Simulator<dim>::AdvectionField::
@@ -610,6 +699,92 @@ namespace aspect
 
 
 
+
+  template <int dim>
+  void Simulator<dim>::compute_average_measured_cell_cost ()
+  {
+    // The costs are only valid if they have been measured on the
+    // current mesh. Otherwise all cells get the same weight.
+    double local_cost = 0;
+    if (measured_cell_costs.size() == triangulation.n_active_cells())
+      for (const auto &cell : triangulation.active_cell_iterators())
+        if (cell->is_locally_owned())
+          local_cost += measured_cell_costs[cell->active_cell_index()];
+
+    average_measured_cell_cost = Utilities::MPI::sum(local_cost, mpi_communicator)
+                                 / triangulation.n_global_active_cells();
+  }
+
+
+
+  template <int dim>
+  unsigned int
+  Simulator<dim>::measured_cell_weight (const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell,
+#if DEAL_II_VERSION_GTE(9,6,0)
+                                        const CellStatus status
+#else
+                                        const typename parallel::distributed::Triangulation<dim>::CellStatus status
+#endif
+                                       ) const
+  {
+    if (cell->is_active() && !cell->is_locally_owned())
+      return 0;
+
+    if (measured_cell_costs.size() != triangulation.n_active_cells()
+        || !(average_measured_cell_cost > 0))
+      return parameters.measured_cell_cost_weight;
+
+    double cell_cost = 0;
+    switch (status)
+      {
+#if DEAL_II_VERSION_GTE(9,6,0)
+        case CellStatus::cell_will_persist:
+          cell_cost = measured_cell_costs[cell->active_cell_index()];
+          break;
+
+        // The weight of a cell that will be refined is used for each of
+        // its children, so split the measured cost between them.
+        case CellStatus::cell_will_be_refined:
+          cell_cost = measured_cell_costs[cell->active_cell_index()] / cell->reference_cell().n_isotropic_children();
+          break;
+
+        case CellStatus::cell_invalid:
+          break;
+
+        case CellStatus::children_will_be_coarsened:
+          for (const auto &child : cell->child_iterators())
+            cell_cost += measured_cell_costs[child->active_cell_index()];
+          break;
+#else
+        case parallel::distributed::Triangulation<dim>::CELL_PERSIST:
+          cell_cost = measured_cell_costs[cell->active_cell_index()];
+          break;
+
+        // The weight of a cell that will be refined is used for each of
+        // its children, so split the measured cost between them.
+        case parallel::distributed::Triangulation<dim>::CELL_REFINE:
+          cell_cost = measured_cell_costs[cell->active_cell_index()] / cell->reference_cell().n_isotropic_children();
+          break;
+
+        case parallel::distributed::Triangulation<dim>::CELL_INVALID:
+          break;
+
+        case parallel::distributed::Triangulation<dim>::CELL_COARSEN:
+          for (const auto &child : cell->child_iterators())
+            cell_cost += measured_cell_costs[child->active_cell_index()];
+          break;
+#endif
+        default:
+          Assert(false, ExcInternalError());
+          break;
+      }
+
+    return static_cast<unsigned int>(std::round(parameters.measured_cell_cost_weight
+                                                * cell_cost / average_measured_cell_cost));
+  }
+
+
+
   template <int dim>
   void Simulator<dim>::maybe_refine_mesh (const double new_time_step,
                                           unsigned int &max_refinement_level)
@@ -1782,31 +1957,20 @@ namespace aspect
     }
 
     const Quadrature<dim> combined_support_points(unique_support_points);
-    FEValues<dim> fe_values (*mapping,
-                             dof_handler.get_fe(),
-                             combined_support_points,
-                             update_quadrature_points | update_values | update_gradients);
-
     const unsigned int n_q_points = combined_support_points.size();
-    std::vector<types::global_dof_index> local_dof_indices (dof_handler.get_fe().dofs_per_cell);
-    MaterialModel::MaterialModelInputs<dim> in(n_q_points, introspection.n_compositional_fields);
-    MaterialModel::MaterialModelOutputs<dim> out(n_q_points, introspection.n_compositional_fields);
-    HeatingModel::HeatingModelOutputs heating_model_outputs(n_q_points, introspection.n_compositional_fields);
 
-    // add reaction rate outputs
-    material_model->create_additional_named_outputs(out);
-
-    MaterialModel::ReactionRateOutputs<dim> *reaction_rate_outputs
-      = out.template get_additional_output<MaterialModel::ReactionRateOutputs<dim>>();
+    {
+      MaterialModel::MaterialModelOutputs<dim> out(n_q_points, introspection.n_compositional_fields);
 
-    AssertThrow(reaction_rate_outputs != nullptr,
-                ExcMessage("You are trying to use the operator splitting solver scheme, "
-                           "but the material model you use does not support operator splitting "
-                           "(it does not create ReactionRateOutputs, which are required for this "
-                           "solver scheme)."));
+      // add reaction rate outputs
+      material_model->create_additional_named_outputs(out);
 
-    // some heating models require the additional outputs
-    heating_model_manager.create_additional_material_model_inputs_and_outputs(in, out);
+      AssertThrow(out.template get_additional_output<MaterialModel::ReactionRateOutputs<dim>>() != nullptr,
+                  ExcMessage("You are trying to use the operator splitting solver scheme, "
+                             "but the material model you use does not support operator splitting "
+                             "(it does not create ReactionRateOutputs, which are required for this "
+                             "solver scheme)."));
+    }
 
     // We use SUNDIALs ARKode to compute the reactions. Set up the required parameters.
     // TODO: Should we change some of these based on the Reaction time step input parameter?
@@ -1823,155 +1987,218 @@ namespace aspect
     data.relative_tolerance = 1e-6;
     data.absolute_tolerance = 1e-10;
 
-    SUNDIALS::ARKode<VectorType> ode(data);
-
-    std::vector<std::vector<double>> initial_values_C (n_q_points, std::vector<double> (introspection.n_compositional_fields));
-    std::vector<double> initial_values_T (n_q_points);
-
-    // We have to store all values of the temperature and composition fields in one long vector.
-    // Create the vector and functions for transferring values between this vector and the material model inputs object.
-    VectorType fields (n_q_points * n_fields);
-
+    // We have to store all values of the temperature and composition fields of all
+    // cells we solve together in one long vector. Create the functions for transferring
+    // values between this vector and the material model inputs objects. 'offset' is
+    // the position of the first value of the cell in the vector.
     auto copy_fields_into_one_vector = [n_q_points,n_fields](const MaterialModel::MaterialModelInputs<dim> &in,
+                                                             const unsigned int offset,
                                                              VectorType &fields)
     {
       for (unsigned int j=0; j<n_q_points; ++j)
         for (unsigned int f=0; f<n_fields; ++f)
           if (f==0)
-            fields[j*n_fields+f] = in.temperature[j];
+            fields[offset+j*n_fields+f] = in.temperature[j];
           else
-            fields[j*n_fields+f] = in.composition[j][f-1];
+            fields[offset+j*n_fields+f] = in.composition[j][f-1];
       return;
     };
 
     auto copy_fields_into_material_model_inputs = [n_q_points,n_fields](const VectorType &fields,
+                                                                        const unsigned int offset,
                                                                         MaterialModel::MaterialModelInputs<dim> &in)
     {
       for (unsigned int j=0; j<n_q_points; ++j)
         for (unsigned int f=0; f<n_fields; ++f)
           if (f==0)
-            in.temperature[j]      = fields[j*n_fields+f];
+            in.temperature[j]      = fields[offset+j*n_fields+f];
           else
-            in.composition[j][f-1] = fields[j*n_fields+f];
+            in.composition[j][f-1] = fields[offset+j*n_fields+f];
       return;
     };
 
     auto copy_rates_into_one_vector = [n_q_points,n_fields](const MaterialModel::ReactionRateOutputs<dim> *reaction_out,
                                                             const HeatingModel::HeatingModelOutputs &heating_out,
+                                                            const unsigned int offset,
                                                             VectorType &rates)
     {
       for (unsigned int j=0; j<n_q_points; ++j)
         for (unsigned int f=0; f<n_fields; ++f)
           if (f==0)
-            rates[j*n_fields+f] = heating_out.rates_of_temperature_change[j];
+            rates[offset+j*n_fields+f] = heating_out.rates_of_temperature_change[j];
           else
-            rates[j*n_fields+f] = reaction_out->reaction_rates[j][f-1];
+            rates[offset+j*n_fields+f] = reaction_out->reaction_rates[j][f-1];
       return;
     };
 
-    unsigned int total_iteration_count = 0;
-    unsigned int number_of_solves = 0;
-
-    // Make a loop first over all cells, than over all reaction time steps, and then over
-    // all degrees of freedom in each element to compute the reactions. This is possible
-    // because the reactions only depend on the temperature and composition values at a given
-    // degree of freedom (and are independent of the solution in other points).
-
-    // Note that the values for some degrees of freedom are set more than once in the loop
-    // below where we assign the new values to distributed_vector (if they are located on the
-    // interface between cells), as we loop over all cells, and then over all degrees of freedom
-    // on each cell. Although this means we do some additional work, the results are still
-    // correct, as we never read from distributed_vector inside the loop over all cells.
-    // We initialize the material model inputs object in using the solution vector
-    // on every cell, compute the update, and then on every cell put the result into the
-    // distributed_vector vector. Only after the loop over all cells do we copy distributed_vector
-    // back onto the solution vector.
-    // So even though we touch some DoF more than once, we always start from the same value, compute the
-    // same value, and then overwrite the same value in distributed_vector.
-    // TODO: make this even more efficient.
+    // The reactions only depend on the temperature and composition values at a given
+    // degree of freedom (and are independent of the solution in other points). We can
+    // therefore solve them independently on every cell, or on batches of cells that are
+    // solved together as one (block-diagonal) system using a common step size.
+    // Each batch is handled by one thread.
+    //
+    // Note that the values for some degrees of freedom are computed more than once
+    // (if they are located on the interface between cells), as we loop over all cells,
+    // and then over all degrees of freedom on each cell. Although this means we do some
+    // additional work, the results are still correct, as we always start from the values
+    // in the solution vector, compute the same value, and then overwrite the same value
+    // in distributed_vector. Only after the loop over all cells do we copy
+    // distributed_vector back onto the solution vector.
+    using active_cell_iterator = typename DoFHandler<dim>::active_cell_iterator;
+    const unsigned int cells_per_batch = parameters.reaction_cells_per_batch;
+
+    std::vector<std::vector<active_cell_iterator>> cell_batches;
     for (const auto &cell : dof_handler.active_cell_iterators())
       if (cell->is_locally_owned())
         {
-          fe_values.reinit (cell);
-          in.reinit(fe_values, cell, introspection, solution);
+          if (cell_batches.empty() || cell_batches.back().size() == cells_per_batch)
+            {
+              cell_batches.emplace_back();
+              cell_batches.back().reserve(cells_per_batch);
+            }
+          cell_batches.back().push_back(cell);
+        }
 
-          std::vector<std::vector<double>> accumulated_reactions_C (n_q_points, std::vector<double> (introspection.n_compositional_fields));
-          std::vector<double> accumulated_reactions_T (n_q_points);
+    auto worker = [&](const typename std::vector<std::vector<active_cell_iterator>>::const_iterator &batch,
+                      ReactionScratchData<dim> &scratch,
+                      ReactionCopyData &copy_data)
+    {
+      const std::vector<active_cell_iterator> &cells = *batch;
+      const unsigned int n_values_per_cell = n_q_points * n_fields;
 
-          copy_fields_into_one_vector (in, fields);
+      // FEValues is reinitialized lazily, since the ODE right hand side
+      // is evaluated cell by cell.
+      unsigned int fe_values_cell = numbers::invalid_unsigned_int;
+      auto reinit_fe_values = [&](const unsigned int cell_index)
+      {
+        if (fe_values_cell != cell_index)
+          {
+            scratch.fe_values.reinit(cells[cell_index]);
+            fe_values_cell = cell_index;
+          }
+      };
+
+      // Evaluate the rates of all fields in all points of the cell with index
+      // cell_index (within the batch), given the field values 'y' of this cell,
+      // starting at position 'offset'.
+      auto compute_rates = [&](const unsigned int cell_index,
+                               const VectorType &y,
+                               VectorType &ydot,
+                               const unsigned int offset)
+      {
+        MaterialModel::MaterialModelInputs<dim> &in = scratch.material_model_inputs[cell_index];
+        MaterialModel::MaterialModelOutputs<dim> &out = scratch.material_model_outputs[cell_index];
+
+        reinit_fe_values(cell_index);
+        copy_fields_into_material_model_inputs (y, offset, in);
+        material_model->fill_additional_material_model_inputs(in, solution, scratch.fe_values, introspection);
+        material_model->evaluate(in, out);
+        heating_model_manager.evaluate(in, out, scratch.heating_model_outputs[cell_index]);
+        copy_rates_into_one_vector (out.template get_additional_output<MaterialModel::ReactionRateOutputs<dim>>(),
+                                    scratch.heating_model_outputs[cell_index],
+                                    offset,
+                                    ydot);
+      };
+
+      scratch.reacting_cells.clear();
+      for (unsigned int k=0; k<cells.size(); ++k)
+        {
+          MaterialModel::MaterialModelInputs<dim> &in = scratch.material_model_inputs[k];
+          MaterialModel::MaterialModelOutputs<dim> &out = scratch.material_model_outputs[k];
 
-          initial_values_C = in.composition;
-          initial_values_T = in.temperature;
+          // add reaction rate outputs, and some heating models require the additional outputs
+          material_model->create_additional_named_outputs(out);
+          heating_model_manager.create_additional_material_model_inputs_and_outputs(in, out);
 
-          if (parameters.reaction_solver_type == Parameters<dim>::ReactionSolverType::ARKode)
+          reinit_fe_values(k);
+          in.reinit(scratch.fe_values, cells[k], introspection, solution);
+
+          // If all rates on a cell are exactly zero at the beginning of the
+          // reaction step, the values on this cell do not change during
+          // the reaction step, and we do not need to solve for them.
+          if (parameters.skip_cells_without_reactions)
             {
+              scratch.rates.reinit(n_values_per_cell);
+              scratch.fields.reinit(n_values_per_cell);
+              copy_fields_into_one_vector (in, 0, scratch.fields);
+              compute_rates(k, scratch.fields, scratch.rates, 0);
+              if (scratch.rates.linfty_norm() == 0.)
+                continue;
+            }
+
+          scratch.reacting_cells.push_back(k);
+        }
+
+      const unsigned int n_reacting_cells = scratch.reacting_cells.size();
+      scratch.fields.reinit(n_reacting_cells * n_values_per_cell);
+      scratch.rates.reinit(n_reacting_cells * n_values_per_cell);
+      scratch.accumulated_reactions.reinit(n_reacting_cells * n_values_per_cell);
+      for (unsigned int i=0; i<n_reacting_cells; ++i)
+        copy_fields_into_one_vector (scratch.material_model_inputs[scratch.reacting_cells[i]],
+                                     i*n_values_per_cell,
+                                     scratch.fields);
+      scratch.initial_fields = scratch.fields;
 
-              ode.explicit_function = [&] (const double /*time*/,
-                                           const VectorType &y,
-                                           VectorType &ydot)
+      copy_data.iteration_count = 0;
+      copy_data.n_solves = 0;
+
+      if (n_reacting_cells > 0)
+        {
+          if (parameters.reaction_solver_type == Parameters<dim>::ReactionSolverType::ARKode)
+            {
+              scratch.ode.explicit_function = [&] (const double /*time*/,
+                                                   const VectorType &y,
+                                                   VectorType &ydot)
               {
-                copy_fields_into_material_model_inputs (y, in);
-                material_model->fill_additional_material_model_inputs(in, solution, fe_values, introspection);
-                material_model->evaluate(in, out);
-                heating_model_manager.evaluate(in, out, heating_model_outputs);
-                copy_rates_into_one_vector (reaction_rate_outputs, heating_model_outputs, ydot);
+                for (unsigned int i=0; i<n_reacting_cells; ++i)
+                  compute_rates(scratch.reacting_cells[i], y, ydot, i*n_values_per_cell);
               };
 
               // Make the reaction time steps: We have to update the values of compositional fields and the temperature.
-              // We can reuse the same material model inputs and outputs structure for each reaction time step.
               // We store the computed updates to temperature and composition in a separate (accumulated_reactions) vector,
               // so that we can later copy it over to the solution vector.
-              const unsigned int iteration_count = ode.solve_ode(fields);
+              copy_data.iteration_count = scratch.ode.solve_ode(scratch.fields);
+              copy_data.n_solves = 1;
 
-              total_iteration_count += iteration_count;
-              number_of_solves += 1;
-
-              for (unsigned int j=0; j<n_q_points; ++j)
-                for (unsigned int f=0; f<n_fields; ++f)
-                  {
-                    if (f==0)
-                      {
-                        in.temperature[j]          = fields[j*n_fields+f];
-                        accumulated_reactions_T[j] = in.temperature[j] - initial_values_T[j];
-                      }
-                    else
-                      {
-                        in.composition[j][f-1]          = fields[j*n_fields+f];
-                        accumulated_reactions_C[j][f-1] = in.composition[j][f-1] - initial_values_C[j][f-1];
-                      }
-                  }
+              for (unsigned int i=0; i<scratch.fields.size(); ++i)
+                scratch.accumulated_reactions[i] = scratch.fields[i] - scratch.initial_fields[i];
             }
-
           else if (parameters.reaction_solver_type == Parameters<dim>::ReactionSolverType::fixed_step)
             {
-              for (unsigned int i=0; i<number_of_reaction_steps; ++i)
+              for (unsigned int step=0; step<number_of_reaction_steps; ++step)
                 {
-                  // Loop over composition element
-                  material_model->fill_additional_material_model_inputs(in, solution, fe_values, introspection);
+                  for (unsigned int i=0; i<n_reacting_cells; ++i)
+                    compute_rates(scratch.reacting_cells[i], scratch.fields, scratch.rates, i*n_values_per_cell);
 
-                  material_model->evaluate(in, out);
-                  heating_model_manager.evaluate(in, out, heating_model_outputs);
-
-                  for (unsigned int j=0; j<n_q_points; ++j)
+                  // simple forward euler
+                  for (unsigned int i=0; i<scratch.fields.size(); ++i)
                     {
-                      for (unsigned int c=0; c<introspection.n_compositional_fields; ++c)
-                        {
-                          // simple forward euler
-                          in.composition[j][c] = in.composition[j][c]
-                                                 + reaction_time_step_size * reaction_rate_outputs->reaction_rates[j][c];
-                          accumulated_reactions_C[j][c] += reaction_time_step_size * reaction_rate_outputs->reaction_rates[j][c];
-                        }
-                      in.temperature[j] = in.temperature[j]
-                                          + reaction_time_step_size * heating_model_outputs.rates_of_temperature_change[j];
-                      accumulated_reactions_T[j] += reaction_time_step_size * heating_model_outputs.rates_of_temperature_change[j];
+                      scratch.fields[i] = scratch.fields[i] + reaction_time_step_size * scratch.rates[i];
+                      scratch.accumulated_reactions[i] += reaction_time_step_size * scratch.rates[i];
                     }
                 }
             }
+        }
 
-          cell->get_dof_indices (local_dof_indices);
-          const unsigned int component_idx_T = introspection.component_indices.temperature;
+      // Now collect the new values and the reaction increments of all locally
+      // owned temperature and composition degrees of freedom of the batch.
+      copy_data.dof_indices.clear();
+      copy_data.values.clear();
+      copy_data.reactions.clear();
+
+      const unsigned int component_idx_T = introspection.component_indices.temperature;
+      unsigned int reacting_cell_index = 0;
+
+      for (unsigned int k=0; k<cells.size(); ++k)
+        {
+          const bool is_reacting = (reacting_cell_index < n_reacting_cells
+                                    && scratch.reacting_cells[reacting_cell_index] == k);
+          const unsigned int offset = reacting_cell_index * n_values_per_cell;
+          const MaterialModel::MaterialModelInputs<dim> &in = scratch.material_model_inputs[k];
+
+          cells[k]->get_dof_indices (scratch.local_dof_indices);
 
-          for (unsigned int dof_idx = 0; dof_idx < local_dof_indices.size(); ++dof_idx)
+          for (unsigned int dof_idx = 0; dof_idx < scratch.local_dof_indices.size(); ++dof_idx)
             {
               const auto comp_pair = dof_handler.get_fe().system_to_component_index(dof_idx);
               const unsigned int component_idx = comp_pair.first;
@@ -1991,25 +2218,61 @@ namespace aspect
 
                   // The final step is grabbing the value from the reaction computation and write it into
                   // the global vector (if we own it, of course):
-                  if (dof_handler.locally_owned_dofs().is_element(local_dof_indices[dof_idx]))
+                  if (dof_handler.locally_owned_dofs().is_element(scratch.local_dof_indices[dof_idx]))
                     {
-                      // temperatures and compositions are stored differently:
-                      if (component_idx == component_idx_T)
+                      copy_data.dof_indices.push_back(scratch.local_dof_indices[dof_idx]);
+
+                      if (is_reacting)
                         {
-                          distributed_vector(local_dof_indices[dof_idx]) = in.temperature[point_idx];
-                          distributed_reaction_vector(local_dof_indices[dof_idx]) = accumulated_reactions_T[point_idx];
+                          copy_data.values.push_back(scratch.fields[offset+point_idx*n_fields+field_index]);
+                          copy_data.reactions.push_back(scratch.accumulated_reactions[offset+point_idx*n_fields+field_index]);
                         }
                       else
                         {
-                          const unsigned int composition = field_index-1; // 0 is temperature...
-                          distributed_vector(local_dof_indices[dof_idx]) = in.composition[point_idx][composition];
-                          distributed_reaction_vector(local_dof_indices[dof_idx]) = accumulated_reactions_C[point_idx][composition];
+                          // temperatures and compositions are stored differently:
+                          if (component_idx == component_idx_T)
+                            copy_data.values.push_back(in.temperature[point_idx]);
+                          else
+                            copy_data.values.push_back(in.composition[point_idx][field_index-1]);
+                          copy_data.reactions.push_back(0.);
                         }
                     }
                 }
             }
+
+          if (is_reacting)
+            ++reacting_cell_index;
+        }
+    };
+
+    unsigned int total_iteration_count = 0;
+    unsigned int number_of_solves = 0;
+
+    auto copier = [&](const ReactionCopyData &copy_data)
+    {
+      for (unsigned int i=0; i<copy_data.dof_indices.size(); ++i)
+        {
+          distributed_vector(copy_data.dof_indices[i]) = copy_data.values[i];
+          distributed_reaction_vector(copy_data.dof_indices[i]) = copy_data.reactions[i];
         }
 
+      total_iteration_count += copy_data.iteration_count;
+      number_of_solves += copy_data.n_solves;
+    };
+
+    WorkStream::
+    run (cell_batches.cbegin(),
+         cell_batches.cend(),
+         worker,
+         copier,
+         ReactionScratchData<dim> (*mapping,
+                                   dof_handler.get_fe(),
+                                   combined_support_points,
+                                   introspection.n_compositional_fields,
+                                   cells_per_batch,
+                                   data),
+         ReactionCopyData());
+
     distributed_vector.compress(VectorOperation::insert);
     distributed_reaction_vector.compress(VectorOperation::insert);
 
@@ -2067,6 +2330,21 @@ namespace aspect
 
 
 
+  template <int dim>
+  void Simulator<dim>::update_projection_matrix_cache ()
+  {
+    if ((parameters.material_averaging == MaterialModel::MaterialAveraging::project_to_Q1
+         ||
+         parameters.material_averaging == MaterialModel::MaterialAveraging::project_to_Q1_only_viscosity)
+        &&
+        projection_matrix_cache.empty())
+      projection_matrix_cache.reinit (dof_handler,
+                                      *mapping,
+                                      introspection.quadratures.velocities);
+  }
+
+
+
   template <int dim>
   void Simulator<dim>::interpolate_material_output_into_advection_field (const AdvectionField &adv_field)
   {
@@ -2771,6 +3049,7 @@ namespace aspect
   template bool Simulator<dim>::maybe_write_checkpoint (const time_t, const bool); \
   template bool Simulator<dim>::maybe_do_initial_refinement (const unsigned int max_refinement_level); \
   template void Simulator<dim>::exchange_refinement_flags (); \
+  template void Simulator<dim>::compute_average_measured_cell_cost (); \
   template void Simulator<dim>::maybe_refine_mesh (const double new_time_step, unsigned int &max_refinement_level); \
   template void Simulator<dim>::advance_time (const double step_size); \
   template void Simulator<dim>::make_pressure_rhs_compatible(LinearAlgebra::BlockVector &vector); \
@@ -2783,6 +3062,7 @@ namespace aspect
   template void Simulator<dim>::apply_limiter_to_dg_solutions(const AdvectionField &advection_field); \
   template void Simulator<dim>::compute_reactions(); \
   template void Simulator<dim>::initialize_current_linearization_point (); \
+  template void Simulator<dim>::update_projection_matrix_cache (); \
   template void Simulator<dim>::interpolate_material_output_into_advection_field(const AdvectionField &adv_field); \
   template void Simulator<dim>::check_consistency_of_formulation(); \
   template void Simulator<dim>::replace_outflow_boundary_ids(const unsigned int boundary_id_offset); \
@@ -2800,5 +3080,19 @@ namespace aspect
 
   ASPECT_INSTANTIATE(INSTANTIATE)
 
+#undef INSTANTIATE
+
+#if DEAL_II_VERSION_GTE(9,6,0)
+#define INSTANTIATE(dim) \
+  template unsigned int Simulator<dim>::measured_cell_weight (const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell, \
+                                                              const CellStatus status) const;
+#else
+#define INSTANTIATE(dim) \
+  template unsigned int Simulator<dim>::measured_cell_weight (const typename parallel::distributed::Triangulation<dim>::cell_iterator &cell, \
+                                                              const typename parallel::distributed::Triangulation<dim>::CellStatus status) const;
+#endif
+
+  ASPECT_INSTANTIATE(INSTANTIATE)
+
 #undef INSTANTIATE
 }
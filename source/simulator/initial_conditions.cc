@@ -27,9 +27,11 @@
 
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/function.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/grid/tria_iterator.h>
+#include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/dofs/dof_accessor.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/numerics/vector_tools.h>
@@ -37,6 +39,83 @@
 
 namespace aspect
 {
+  namespace
+  {
+    /**
+     * Scratch data used by each thread to evaluate the initial temperature
+     * or composition in the support points of one cell in
+     * Simulator::set_initial_temperature_and_compositional_fields(), or
+     * to interpolate particle properties to these support points in
+     * Simulator::interpolate_particle_properties().
+     */
+    template <int dim>
+    struct InitialConditionScratchData
+    {
+      InitialConditionScratchData (const Mapping<dim> &mapping,
+                                   const FiniteElement<dim> &finite_element,
+                                   const Quadrature<dim> &support_points)
+        :
+        fe_values (mapping,
+                   finite_element,
+                   support_points,
+                   update_quadrature_points),
+        local_dof_indices (finite_element.dofs_per_cell),
+        values (support_points.size()),
+        composition_sums (support_points.size())
+      {}
+
+      InitialConditionScratchData (const InitialConditionScratchData &scratch)
+        :
+        fe_values (scratch.fe_values.get_mapping(),
+                   scratch.fe_values.get_fe(),
+                   scratch.fe_values.get_quadrature(),
+                   scratch.fe_values.get_update_flags()),
+        local_dof_indices (scratch.local_dof_indices),
+        values (scratch.values),
+        composition_sums (scratch.composition_sums)
+      {}
+
+      FEValues<dim> fe_values;
+      std::vector<types::global_dof_index> local_dof_indices;
+      std::vector<double> values;
+
+      /**
+       * The sum of the compositional fields that are normalized, in every
+       * support point.
+       */
+      std::vector<double> composition_sums;
+    };
+
+
+
+    /**
+     * The values of the temperature or composition degrees of freedom of
+     * one cell, either for a single field or, when interpolating particle
+     * properties, for all fields that are interpolated at the same time.
+     */
+    struct InitialConditionCopyData
+    {
+      explicit InitialConditionCopyData (const unsigned int dofs_per_cell)
+        :
+        dof_indices (dofs_per_cell),
+        values (dofs_per_cell),
+        normalize_composition (false),
+        max_sum_comp (0.0)
+      {}
+
+      std::vector<types::global_dof_index> dof_indices;
+      std::vector<double> values;
+
+      /**
+       * Whether the sum of the normalized compositional fields exceeds one
+       * in any support point of the cell, and the largest such sum.
+       */
+      bool normalize_composition;
+      double max_sum_comp;
+    };
+  }
+
+
 
   template <int dim>
   void Simulator<dim>::set_initial_temperature_and_compositional_fields ()
@@ -66,8 +145,16 @@ namespace aspect
     //
     // to work around this problem, the following code is essentially
     // a (simplified) copy of the code in VectorTools::interpolate
-    // that only works on the temperature component
+    // that only works on the temperature component. in contrast to
+    // VectorTools::interpolate, it asks the initial conditions for the
+    // values in all support points of a cell at once, and it works on
+    // the cells in parallel using WorkStream. the initial conditions
+    // therefore need to be safe to evaluate from several threads at
+    // the same time, like all other plugins that are used during the
+    // assembly.
     //
+    using CellFilter = FilteredIterator<typename DoFHandler<dim>::active_cell_iterator>;
+
     // TODO: it would be great if we had a cleaner way than iterating to 1+n_fields.
     // Additionally, the n==1 logic for normalization at the bottom is not pretty.
     for (unsigned int n=0; n<1+introspection.n_compositional_fields; ++n)
@@ -83,47 +170,113 @@ namespace aspect
         Assert (support_points.size() != 0,
                 ExcInternalError());
 
-        // create an FEValues object with just the temperature/composition element
-        FEValues<dim> fe_values (*mapping, finite_element,
-                                 support_points,
-                                 update_quadrature_points);
+        const unsigned int component = advf.component_index(introspection);
+        const unsigned int n_dofs_per_cell = finite_element.base_element(base_element).dofs_per_cell;
 
-        std::vector<types::global_dof_index> local_dof_indices (finite_element.dofs_per_cell);
+        // if it is specified in the parameter file that the sum of all compositional fields
+        // must not exceed one, this is checked together with the first compositional field
+        const bool check_normalization = (parameters.normalized_fields.size()>0 && n==1);
 
-        const VectorFunctionFromScalarFunctionObject<dim, double> &advf_init_function
-          =
-            (advf.is_temperature()
-             ?
-             VectorFunctionFromScalarFunctionObject<dim, double>(
-               [&](const Point<dim> &p) -> double
+        auto worker = [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+                          InitialConditionScratchData<dim> &scratch,
+                          InitialConditionCopyData &copy_data)
         {
-          return initial_temperature_manager->initial_temperature(p);
-        },
-        introspection.component_indices.temperature,
-        introspection.n_components)
-        :
-        VectorFunctionFromScalarFunctionObject<dim, double>(
-          [&](const Point<dim> &p) -> double
+          scratch.fe_values.reinit (cell);
+
+          if (advf.is_temperature())
+            initial_temperature_manager->initial_temperature_at_points(scratch.fe_values.get_quadrature_points(),
+                                                                       scratch.values);
+          else
+            initial_composition_manager->initial_composition_at_points(scratch.fe_values.get_quadrature_points(),
+                                                                       n-1,
+                                                                       scratch.values);
+
+          cell->get_dof_indices (scratch.local_dof_indices);
+          for (unsigned int i=0; i<n_dofs_per_cell; ++i)
+            {
+              const unsigned int system_local_dof
+                = finite_element.component_to_system_index(component,
+                                                           /*dof index within component=*/i);
+
+              copy_data.dof_indices[i] = scratch.local_dof_indices[system_local_dof];
+              copy_data.values[i] = scratch.values[i];
+            }
+
+          copy_data.normalize_composition = false;
+          copy_data.max_sum_comp = 0.0;
+          if (check_normalization)
+            {
+              std::fill (scratch.composition_sums.begin(), scratch.composition_sums.end(), 0.0);
+              for (const unsigned int normalized_field : parameters.normalized_fields)
+                {
+                  initial_composition_manager->initial_composition_at_points(scratch.fe_values.get_quadrature_points(),
+                                                                             normalized_field,
+                                                                             scratch.values);
+                  for (unsigned int i=0; i<n_dofs_per_cell; ++i)
+                    scratch.composition_sums[i] += scratch.values[i];
+                }
+
+              for (const double sum : scratch.composition_sums)
+                if (std::abs(sum) > 1.0+std::numeric_limits<double>::epsilon())
+                  {
+                    copy_data.max_sum_comp = std::max(sum, copy_data.max_sum_comp);
+                    copy_data.normalize_composition = true;
+                  }
+            }
+        };
+
+        auto copier = [&](const InitialConditionCopyData &copy_data)
         {
-          return initial_composition_manager->initial_composition(p, n-1);
-        },
-        introspection.component_indices.compositional_fields[n-1],
-        introspection.n_components));
+          for (unsigned int i=0; i<copy_data.dof_indices.size(); ++i)
+            initial_solution(copy_data.dof_indices[i]) = copy_data.values[i];
 
-        const ComponentMask advf_mask =
-          (advf.is_temperature()
-           ?
-           introspection.component_masks.temperature
-           :
-           introspection.component_masks.compositional_fields[n-1]);
+          if (copy_data.normalize_composition)
+            {
+              max_sum_comp = std::max(copy_data.max_sum_comp, max_sum_comp);
+              normalize_composition = true;
+            }
+        };
+
+        // The World Builder must not be evaluated from several threads at
+        // once: its random composition models and its grain models draw from
+        // a single random number engine, and the values they return depend
+        // on the order of the queries. If a World Builder file is used, work
+        // on one cell after the other so that the initial conditions stay
+        // reproducible.
+        bool use_threads = true;
+#ifdef ASPECT_WITH_WORLD_BUILDER
+        if (world_builder != nullptr)
+          use_threads = false;
+#endif
 
         try
           {
-            VectorTools::interpolate(*mapping,
-                                     dof_handler,
-                                     advf_init_function,
-                                     initial_solution,
-                                     advf_mask);
+            if (use_threads)
+              WorkStream::
+              run (CellFilter (IteratorFilters::LocallyOwnedCell(),
+                               dof_handler.begin_active()),
+                   CellFilter (IteratorFilters::LocallyOwnedCell(),
+                               dof_handler.end()),
+                   worker,
+                   copier,
+                   InitialConditionScratchData<dim> (*mapping,
+                                                     finite_element,
+                                                     Quadrature<dim>(support_points)),
+                   InitialConditionCopyData (n_dofs_per_cell));
+            else
+              {
+                InitialConditionScratchData<dim> scratch (*mapping,
+                                                          finite_element,
+                                                          Quadrature<dim>(support_points));
+                InitialConditionCopyData copy_data (n_dofs_per_cell);
+
+                for (const auto &cell : dof_handler.active_cell_iterators())
+                  if (cell->is_locally_owned())
+                    {
+                      worker (cell, scratch, copy_data);
+                      copier (copy_data);
+                    }
+              }
           }
         // initial conditions that throw exceptions usually do not result in
         // anything good because they result in an unwinding of the stack
@@ -180,30 +333,6 @@ namespace aspect
             MPI_Abort (MPI_COMM_WORLD, 1);
           }
 
-        if (parameters.normalized_fields.size()>0 && n==1)
-          for (const auto &cell : dof_handler.active_cell_iterators())
-            if (cell->is_locally_owned())
-              {
-                fe_values.reinit (cell);
-
-                // Go through the support points for each dof
-                for (unsigned int i=0; i<finite_element.base_element(base_element).dofs_per_cell; ++i)
-                  {
-                    // if it is specified in the parameter file that the sum of all compositional fields
-                    // must not exceed one, this should be checked
-                    double sum = 0;
-                    for (unsigned int m=0; m<parameters.normalized_fields.size(); ++m)
-                      sum += initial_composition_manager->initial_composition(fe_values.quadrature_point(i),
-                                                                              parameters.normalized_fields[m]);
-
-                    if (std::abs(sum) > 1.0+std::numeric_limits<double>::epsilon())
-                      {
-                        max_sum_comp = std::max(sum, max_sum_comp);
-                        normalize_composition = true;
-                      }
-                  }
-              }
-
         initial_solution.compress(VectorOperation::insert);
 
         // if at least one processor decides that it needs
@@ -359,70 +488,103 @@ namespace aspect
     Assert (support_points.size() != 0,
             ExcInternalError());
 
-    // create an FEValues object with just the temperature/composition element
-    FEValues<dim> fe_values (*mapping, finite_element,
-                             support_points,
-                             update_quadrature_points);
-
-    std::vector<types::global_dof_index> local_dof_indices (finite_element.dofs_per_cell);
-
-    for (const auto &cell : dof_handler.active_cell_iterators())
-      if (cell->is_locally_owned())
+    const unsigned int n_dofs_per_cell = finite_element.base_element(base_element_index).dofs_per_cell;
+
+    // every cell stores one value per support point for every field that
+    // is mapped to a particle property of one of the particle managers
+    unsigned int n_mapped_properties = 0;
+    for (const auto &indices : particle_property_indices)
+      n_mapped_properties += indices.size();
+
+    // Interpolate all fields of all particle managers in a single loop over
+    // the cells. The particle handlers and interpolators are only read from,
+    // so the cells can be worked on in parallel. Every cell writes the
+    // values of all fields into its copy data, and the copier enters them
+    // into the global vector in the order of the cells, which results in
+    // the same values as a serial loop for continuous elements whose
+    // support points are shared between cells.
+    auto worker = [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+                      InitialConditionScratchData<dim> &scratch,
+                      InitialConditionCopyData &copy_data)
+    {
+      scratch.fe_values.reinit (cell);
+      cell->get_dof_indices (scratch.local_dof_indices);
+
+      unsigned int entry = 0;
+      for (unsigned int particle_manager = 0; particle_manager < particle_managers.size(); ++particle_manager)
         {
-          fe_values.reinit (cell);
-          const std::vector<Point<dim>> quadrature_points = fe_values.get_quadrature_points();
-
           std::vector<std::vector<double>> particle_properties;
-          for (unsigned int particle_manager = 0; particle_manager < particle_managers.size(); ++particle_manager)
+          try
             {
-              try
-                {
-                  particle_properties =
-                    particle_managers[particle_manager].get_interpolator().properties_at_points(particle_managers[particle_manager].get_particle_handler(),
-                                                                                                quadrature_points,
-                                                                                                property_mask[particle_manager],
-                                                                                                cell);
-                }
-              // interpolators that throw exceptions usually do not result in
-              // anything good, because they result in an unwinding of the stack
-              // and, if only one processor triggers an exception, the
-              // destruction of objects often causes a deadlock or completely
-              // unrelated MPI error messages. Thus, if an exception is
-              // generated, catch it, print an error message, and abort the program.
-              catch (std::exception &exc)
-                {
-                  std::cerr << std::endl << std::endl
-                            << "----------------------------------------------------"
-                            << std::endl;
-                  std::cerr << "Exception on MPI process <"
-                            << Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)
-                            << "> while interpolating particle properties: "
-                            << std::endl
-                            << exc.what() << std::endl
-                            << "Aborting!" << std::endl
-                            << "----------------------------------------------------"
-                            << std::endl;
-
-                  // terminate the program!
-                  MPI_Abort (MPI_COMM_WORLD, 1);
-                }
+              particle_properties =
+                particle_managers[particle_manager].get_interpolator().properties_at_points(particle_managers[particle_manager].get_particle_handler(),
+                                                                                            scratch.fe_values.get_quadrature_points(),
+                                                                                            property_mask[particle_manager],
+                                                                                            cell);
+            }
+          // interpolators that throw exceptions usually do not result in
+          // anything good, because they result in an unwinding of the stack
+          // and, if only one processor triggers an exception, the
+          // destruction of objects often causes a deadlock or completely
+          // unrelated MPI error messages. Thus, if an exception is
+          // generated, catch it, print an error message, and abort the program.
+          catch (std::exception &exc)
+            {
+              std::cerr << std::endl << std::endl
+                        << "----------------------------------------------------"
+                        << std::endl;
+              std::cerr << "Exception on MPI process <"
+                        << Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)
+                        << "> while interpolating particle properties: "
+                        << std::endl
+                        << exc.what() << std::endl
+                        << "Aborting!" << std::endl
+                        << "----------------------------------------------------"
+                        << std::endl;
+
+              // terminate the program!
+              MPI_Abort (MPI_COMM_WORLD, 1);
+            }
 
-              // go through the composition dofs and set their global values
-              // to the particle field interpolated at these points
-              cell->get_dof_indices (local_dof_indices);
-              const unsigned int n_dofs_per_cell = finite_element.base_element(base_element_index).dofs_per_cell;
-              for (const std::pair<unsigned int, unsigned int> &field_and_particle_property: particle_property_indices[particle_manager])
-                for (unsigned int i=0; i<n_dofs_per_cell; ++i)
-                  {
-                    const unsigned int system_local_dof
-                      = finite_element.component_to_system_index(advection_fields[field_and_particle_property.first].component_index(introspection),
-                                                                 /*dof index within component=*/i);
+          // go through the composition dofs and store their global indices
+          // together with the particle field interpolated at these points
+          for (const std::pair<unsigned int, unsigned int> &field_and_particle_property: particle_property_indices[particle_manager])
+            for (unsigned int i=0; i<n_dofs_per_cell; ++i)
+              {
+                const unsigned int system_local_dof
+                  = finite_element.component_to_system_index(advection_fields[field_and_particle_property.first].component_index(introspection),
+                                                             /*dof index within component=*/i);
 
-                    particle_solution(local_dof_indices[system_local_dof]) = particle_properties[i][field_and_particle_property.second];
-                  }
-            }
+                copy_data.dof_indices[entry] = scratch.local_dof_indices[system_local_dof];
+                copy_data.values[entry] = particle_properties[i][field_and_particle_property.second];
+                ++entry;
+              }
         }
 
+      Assert (entry == copy_data.dof_indices.size(),
+              ExcDimensionMismatch(entry, copy_data.dof_indices.size()));
+    };
+
+    auto copier = [&](const InitialConditionCopyData &copy_data)
+    {
+      for (unsigned int i=0; i<copy_data.dof_indices.size(); ++i)
+        particle_solution(copy_data.dof_indices[i]) = copy_data.values[i];
+    };
+
+    using CellFilter = FilteredIterator<typename DoFHandler<dim>::active_cell_iterator>;
+
+    WorkStream::
+    run (CellFilter (IteratorFilters::LocallyOwnedCell(),
+                     dof_handler.begin_active()),
+         CellFilter (IteratorFilters::LocallyOwnedCell(),
+                     dof_handler.end()),
+         worker,
+         copier,
+         InitialConditionScratchData<dim> (*mapping,
+                                           finite_element,
+                                           Quadrature<dim>(support_points)),
+         InitialConditionCopyData (n_mapped_properties * n_dofs_per_cell));
+
     particle_solution.compress(VectorOperation::insert);
 
     // overwrite the relevant composition blocks only
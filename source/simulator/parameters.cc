@@ -374,7 +374,14 @@ namespace aspect
 
     prm.declare_entry ("World builder file", "",
                        Patterns::FileName(),
-                       "Name of the world builder file. If empty, the world builder is not initialized.");
+                       "Name of the world builder file. If empty, the world builder is not initialized. "
+                       "This can also be a binary parameter snapshot of a world builder file written by "
+                       "`gwb-dat <world builder file> <snapshot file> --write-parameter-snapshot', which is loaded "
+                       "considerably faster because it does not need to be parsed and validated again. "
+                       "The snapshot only stores the validated parameters, so the features of the world "
+                       "are still constructed from them on every process. "
+                       "A snapshot can only be read by the same World Builder version that wrote it, "
+                       "on a machine with the same byte order.");
 
     prm.enter_subsection ("Particles");
     {
@@ -382,6 +389,15 @@ namespace aspect
                          Patterns::Integer(0, ASPECT_MAX_NUM_PARTICLE_SYSTEMS),
                          "The number of particle systems to be created. The maximum number of particle systems "
                          "is set by the CMake variable `ASPECT_MAX_NUM_PARTICLE_SYSTEMS` and is by default 2.");
+      prm.declare_entry ("Advect particle systems together", "false",
+                         Patterns::Bool(),
+                         "Whether to advect and update the particles of all particle systems in "
+                         "shared loops over all cells instead of one loop per particle system. "
+                         "This evaluates the solution on each cell only once for all particle "
+                         "systems, which reduces the cost of models with several particle "
+                         "systems, for example a dense set of tracers and a sparse set of "
+                         "particles that track the crystal preferred orientation. "
+                         "This parameter has no effect if there is only one particle system.");
     }
     prm.leave_subsection();
 
@@ -658,6 +674,28 @@ namespace aspect
                            "this criterion and the ``Reaction time step'', whichever yields the "
                            "smaller time step. "
                            "Units: none.");
+
+        prm.declare_entry ("Reaction cells per batch", "1",
+                           Patterns::Integer (1),
+                           "The number of cells whose reactions are solved together as one "
+                           "system of ordinary differential equations. The reactions in different "
+                           "points are independent of each other, but solving the points of several "
+                           "cells together means that the reaction solver only needs to select "
+                           "one step size for all of them, which reduces the overhead of the solver "
+                           "if the reactions are similar in all cells. The batches of cells are "
+                           "solved in parallel if several threads are used. "
+                           "Units: none.");
+
+        prm.declare_entry ("Skip cells without reactions", "false",
+                           Patterns::Bool (),
+                           "Whether to check if all reaction rates and rates of temperature change "
+                           "on a cell are exactly zero at the beginning of the reaction step, and "
+                           "to skip solving for the reactions on this cell in this case. Since the "
+                           "values of the fields can not change on such a cell, this does not change "
+                           "the solution, but it requires one additional evaluation of the material "
+                           "and heating models on the cells that do have reactions. Note that the "
+                           "number of reaction substeps written to the screen only accounts for "
+                           "the cells where the reactions are solved.");
       }
       prm.leave_subsection ();
       prm.enter_subsection ("Diffusion solver parameters");
@@ -923,6 +961,34 @@ namespace aspect
                          "Whether or not the initial conditions should be set up during the "
                          "adaptive refinement cycles that are run at the start of the "
                          "simulation.");
+      prm.declare_entry ("Measure cell costs", "false",
+                         Patterns::Bool (),
+                         "Whether to measure the wall time spent on each cell in the "
+                         "assembly of the Stokes and advection systems (which includes "
+                         "the evaluation of the material model) and in advecting and "
+                         "updating particles. The measured costs are accumulated "
+                         "between mesh changes and are used to weight cells when the "
+                         "mesh is repartitioned between processes, so that every process "
+                         "receives a similar amount of work even if the cost per cell "
+                         "varies strongly, for example because of expensive particle "
+                         "properties or rheologies. The measured costs can be "
+                         "visualized using the `cell cost' visualization postprocessor. "
+                         "Measuring adds a small overhead for every cell. If particles "
+                         "also use the `repartition' load balancing strategy, the "
+                         "constant base weight of 1000 that this strategy otherwise "
+                         "assigns to every cell is replaced by the measured weight, "
+                         "but the weights of the particles in each cell "
+                         "are still added to it. Since the measured costs already "
+                         "include the time spent on particles, you will usually "
+                         "want to set the 'Particle weight' to zero in that case.");
+      prm.declare_entry ("Measured cell cost weight", "1000",
+                         Patterns::Integer (1),
+                         "The weight that is assigned during repartitioning to a cell "
+                         "whose measured cost equals the average measured cost of all "
+                         "cells, if 'Measure cell costs' is set. The weights of all "
+                         "other cells are scaled proportionally to their measured cost. "
+                         "Cells for which no cost has been measured yet, for example "
+                         "before the first time step, all receive this weight.");
     }
     prm.leave_subsection();
 
@@ -1472,6 +1538,7 @@ namespace aspect
     prm.enter_subsection("Particles");
     {
       n_particle_managers       = prm.get_integer("Number of particle systems");
+      advect_particle_systems_together = prm.get_bool("Advect particle systems together");
       Assert(n_particle_managers <= ASPECT_MAX_NUM_PARTICLE_SYSTEMS,
              ExcMessage("You have specified more particle managers (" + Utilities::int_to_string(n_particle_managers) +
                         ") than the maximum amount of particle managers set in CMake (" + Utilities::int_to_string(ASPECT_MAX_NUM_PARTICLE_SYSTEMS) + ")."));
@@ -1571,6 +1638,8 @@ namespace aspect
         if (convert_to_years == true)
           reaction_time_step *= year_in_seconds;
         reaction_steps_per_advection_step = prm.get_integer ("Reaction time steps per advection step");
+        reaction_cells_per_batch = prm.get_integer ("Reaction cells per batch");
+        skip_cells_without_reactions = prm.get_bool ("Skip cells without reactions");
       }
       prm.leave_subsection ();
       prm.enter_subsection ("Diffusion solver parameters");
@@ -1697,6 +1766,9 @@ namespace aspect
 
       run_postprocessors_on_initial_refinement = prm.get_bool("Run postprocessors on initial refinement");
 
+      measure_cell_costs = prm.get_bool("Measure cell costs");
+      measured_cell_cost_weight = prm.get_integer("Measured cell cost weight");
+
       if (skip_setup_initial_conditions_on_initial_refinement == true && run_postprocessors_on_initial_refinement == true)
         AssertThrow(false, ExcMessage("Cannot run postprocessors if no initial conditions are set up. "
                                       "You must set run_postprocessors_on_initial_refinement to false."));
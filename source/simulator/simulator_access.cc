@@ -106,6 +106,15 @@ namespace aspect
 
 
 
+  template <int dim>
+  std::vector<double> &
+  SimulatorAccess<dim>::get_measured_cell_costs () const
+  {
+    return simulator->measured_cell_costs;
+  }
+
+
+
   template <int dim>
   const ConditionalOStream &
   SimulatorAccess<dim>::get_pcout () const
@@ -294,7 +303,18 @@ namespace aspect
   void
   SimulatorAccess<dim>::get_refinement_criteria (Vector<float> &estimated_error_per_cell) const
   {
+    if (simulator->store_refinement_indicators
+        &&
+        simulator->cached_refinement_indicators.size() == estimated_error_per_cell.size())
+      {
+        estimated_error_per_cell = simulator->cached_refinement_indicators;
+        return;
+      }
+
     simulator->mesh_refinement_manager.execute (estimated_error_per_cell);
+
+    if (simulator->store_refinement_indicators)
+      simulator->cached_refinement_indicators = estimated_error_per_cell;
   }
 
 
@@ -730,6 +750,21 @@ namespace aspect
                         "keeps track of it."));
     return simulator->world_builder;
   }
+
+
+
+  template <int dim>
+  std::shared_ptr<WorldBuilderQueryCache<dim>>
+  SimulatorAccess<dim>::get_world_builder_query_cache_pointer () const
+  {
+    Assert (simulator->world_builder_query_cache.get() != nullptr,
+            ExcMessage ("You are trying to access the world builder query cache, "
+                        "but the Simulator object is not currently storing "
+                        "a valid pointer to such an object. This is likely "
+                        "because the initial time has passed, see the "
+                        "documentation of get_world_builder_pointer()."));
+    return simulator->world_builder_query_cache;
+  }
 #endif
 
 
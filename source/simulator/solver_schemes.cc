@@ -226,18 +226,38 @@ namespace aspect
   {
     // Advect the particles before they are potentially used to
     // set up the compositional fields.
-    for (auto &particle_manager : particle_managers)
+    // Do not advect the particles in the initial refinement stage
+    const bool in_initial_refinement = (timestep_number == 0)
+                                       && (pre_refinement_step < parameters.initial_adaptive_refinement);
+
+    if (parameters.advect_particle_systems_together && particle_managers.size() > 1)
       {
-        // Do not advect the particles in the initial refinement stage
-        const bool in_initial_refinement = (timestep_number == 0)
-                                           && (pre_refinement_step < parameters.initial_adaptive_refinement);
+        // Advance and update the particles of all managers in shared
+        // loops over the cells.
+        std::vector<Particle::Manager<dim> *> all_particle_managers;
+        std::vector<Particle::Manager<dim> *> particle_managers_to_update;
+        for (auto &particle_manager : particle_managers)
+          {
+            all_particle_managers.push_back(&particle_manager);
+            if (particle_manager.get_property_manager().need_update() == Particle::Property::update_output_step)
+              particle_managers_to_update.push_back(&particle_manager);
+          }
+
         if (!in_initial_refinement)
-          // Advance the particles in the manager to the current time
-          particle_manager.advance_timestep();
+          Particle::Manager<dim>::advance_timestep(all_particle_managers);
 
-        if (particle_manager.get_property_manager().need_update() == Particle::Property::update_output_step)
-          particle_manager.update_particles();
+        Particle::Manager<dim>::update_particles(particle_managers_to_update);
       }
+    else
+      for (auto &particle_manager : particle_managers)
+        {
+          if (!in_initial_refinement)
+            // Advance the particles in the manager to the current time
+            particle_manager.advance_timestep();
+
+          if (particle_manager.get_property_manager().need_update() == Particle::Property::update_output_step)
+            particle_manager.update_particles();
+        }
 
     std::vector<double> current_residual(introspection.n_compositional_fields,0.0);
 
@@ -1102,6 +1102,8 @@ namespace aspect
 
     const Quadrature<dim> &quadrature_formula = sim.introspection.quadratures.velocities;
 
+    sim.update_projection_matrix_cache();
+
     double minimum_viscosity_local = std::numeric_limits<double>::max();
     double maximum_viscosity_local = std::numeric_limits<double>::lowest();
 
@@ -1152,7 +1154,8 @@ namespace aspect
           quadrature_formula,
           *sim.mapping,
           in.requested_properties,
-          out);
+          out,
+          &sim.projection_matrix_cache);
 
         for (unsigned int i=0; i<values.size(); ++i)
           {
@@ -1405,7 +1408,8 @@ namespace aspect
                                                             fe_values.get_quadrature(),
                                                             *sim.mapping,
                                                             in.requested_properties,
-                                                            out);
+                                                            out,
+                                                            &sim.projection_matrix_cache);
 
                   Assert(std::isfinite(in.strain_rate[0].norm()),
                          ExcMessage("Invalid strain_rate in the MaterialModelInputs. This is likely because it was "
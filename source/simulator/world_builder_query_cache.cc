@@ -0,0 +1,319 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <aspect/global.h>
+
+#ifdef ASPECT_WITH_WORLD_BUILDER
+#include <world_builder/config.h>
+#include <aspect/world_builder_query_cache.h>
+#include <aspect/utilities.h>
+
+#include <world_builder/world.h>
+
+#include <algorithm>
+#include <functional>
+
+
+namespace aspect
+{
+  template <int dim>
+  WorldBuilderQueryCache<dim>::WorldBuilderQueryCache (const std::shared_ptr<const ::WorldBuilder::World> &world_builder)
+    :
+    world_builder (world_builder),
+    temperature_index (numbers::invalid_unsigned_int),
+    caching_enabled (true)
+  {}
+
+
+
+  template <int dim>
+  void
+  WorldBuilderQueryCache<dim>::request_temperature ()
+  {
+    Assert (std::all_of(shards.begin(), shards.end(),
+                        [](const Shard &shard)
+    {
+      return shard.values.empty();
+    }),
+    ExcMessage ("All values need to be requested from the world builder "
+                "query cache before the first query."));
+
+    if (temperature_index == numbers::invalid_unsigned_int)
+      {
+        temperature_index = requested_properties.size();
+        requested_properties.push_back({{1,0,0}});
+      }
+  }
+
+
+
+  template <int dim>
+  void
+  WorldBuilderQueryCache<dim>::request_composition (const unsigned int compositional_index)
+  {
+    Assert (std::all_of(shards.begin(), shards.end(),
+                        [](const Shard &shard)
+    {
+      return shard.values.empty();
+    }),
+    ExcMessage ("All values need to be requested from the world builder "
+                "query cache before the first query."));
+
+    if (compositional_index >= composition_indices.size())
+      composition_indices.resize(compositional_index+1, numbers::invalid_unsigned_int);
+
+    if (composition_indices[compositional_index] == numbers::invalid_unsigned_int)
+      {
+        composition_indices[compositional_index] = requested_properties.size();
+        requested_properties.push_back({{2,compositional_index,0}});
+      }
+  }
+
+
+
+  template <int dim>
+  double
+  WorldBuilderQueryCache<dim>::temperature (const Point<dim> &position,
+                                            const double depth) const
+  {
+    AssertThrow (temperature_index != numbers::invalid_unsigned_int,
+                 ExcMessage ("The temperature was queried from the world builder query "
+                             "cache, but it was not requested before."));
+
+    return get_value(position, depth, temperature_index);
+  }
+
+
+
+  template <int dim>
+  double
+  WorldBuilderQueryCache<dim>::composition (const Point<dim> &position,
+                                            const double depth,
+                                            const unsigned int compositional_index) const
+  {
+    AssertThrow (compositional_index < composition_indices.size()
+                 &&
+                 composition_indices[compositional_index] != numbers::invalid_unsigned_int,
+                 ExcMessage ("The compositional field with index " + std::to_string(compositional_index)
+                             + " was queried from the world builder query cache, but it "
+                             "was not requested before."));
+
+    return get_value(position, depth, composition_indices[compositional_index]);
+  }
+
+
+
+  template <int dim>
+  void
+  WorldBuilderQueryCache<dim>::temperatures (const std::vector<Point<dim>> &positions,
+                                             const std::vector<double> &depths,
+                                             std::vector<double> &temperatures) const
+  {
+    AssertThrow (temperature_index != numbers::invalid_unsigned_int,
+                 ExcMessage ("The temperature was queried from the world builder query "
+                             "cache, but it was not requested before."));
+
+    get_values(positions, depths, temperature_index, temperatures);
+  }
+
+
+
+  template <int dim>
+  void
+  WorldBuilderQueryCache<dim>::compositions (const std::vector<Point<dim>> &positions,
+                                             const std::vector<double> &depths,
+                                             const unsigned int compositional_index,
+                                             std::vector<double> &compositions) const
+  {
+    AssertThrow (compositional_index < composition_indices.size()
+                 &&
+                 composition_indices[compositional_index] != numbers::invalid_unsigned_int,
+                 ExcMessage ("The compositional field with index " + std::to_string(compositional_index)
+                             + " was queried from the world builder query cache, but it "
+                             "was not requested before."));
+
+    get_values(positions, depths, composition_indices[compositional_index], compositions);
+  }
+
+
+
+  template <int dim>
+  void
+  WorldBuilderQueryCache<dim>::stop_caching ()
+  {
+    caching_enabled = false;
+    for (Shard &shard : shards)
+      {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.values.clear();
+      }
+  }
+
+
+
+  template <int dim>
+  typename WorldBuilderQueryCache<dim>::Shard &
+  WorldBuilderQueryCache<dim>::get_shard (const std::array<double,dim> &point) const
+  {
+    std::size_t hash = 0;
+    for (const double coordinate : point)
+      hash ^= std::hash<double>()(coordinate) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    return shards[hash % n_shards];
+  }
+
+
+
+  template <int dim>
+  double
+  WorldBuilderQueryCache<dim>::get_value (const Point<dim> &position,
+                                          const double depth,
+                                          const unsigned int value_index) const
+  {
+    const std::array<double,dim> point = Utilities::convert_point_to_array(position);
+
+    Shard &shard = get_shard(point);
+
+    if (caching_enabled)
+      {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const auto value = shard.values.find(point);
+        if (value != shard.values.end())
+          return value->second[value_index];
+      }
+
+#if WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
+    // Ask for all requested values at once, so that the World Builder only
+    // needs to compute the location of the point relative to its features
+    // a single time. Do this without holding the lock so that other threads
+    // can continue to use the shard in the meantime.
+    std::vector<double> values = world_builder->properties(point, depth, requested_properties);
+#else
+    std::vector<double> values;
+    AssertThrow (false,
+                 ExcMessage ("The world builder query cache requires World Builder "
+                             "version 0.5.0 or newer."));
+#endif
+
+    const double value = values[value_index];
+
+    // Check again while holding the lock, so that no values are stored
+    // after stop_caching() has cleared this shard.
+    {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      if (caching_enabled)
+        shard.values.emplace(point, std::move(values));
+    }
+
+    return value;
+  }
+
+
+
+  template <int dim>
+  void
+  WorldBuilderQueryCache<dim>::get_values (const std::vector<Point<dim>> &positions,
+                                           const std::vector<double> &depths,
+                                           const unsigned int value_index,
+                                           std::vector<double> &values) const
+  {
+    Assert (depths.size() == positions.size(),
+            ExcDimensionMismatch(depths.size(), positions.size()));
+    Assert (values.size() == positions.size(),
+            ExcDimensionMismatch(values.size(), positions.size()));
+
+    // First take all values that are already stored, and collect the
+    // positions whose values still need to be computed.
+    std::vector<std::array<double,dim>> missing_points;
+    std::vector<double> missing_depths;
+    std::vector<unsigned int> missing_indices;
+    for (unsigned int q=0; q<positions.size(); ++q)
+      {
+        const std::array<double,dim> point = Utilities::convert_point_to_array(positions[q]);
+
+        if (caching_enabled)
+          {
+            Shard &shard = get_shard(point);
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            const auto value = shard.values.find(point);
+            if (value != shard.values.end())
+              {
+                values[q] = value->second[value_index];
+                continue;
+              }
+          }
+
+        missing_points.push_back(point);
+        missing_depths.push_back(depths[q]);
+        missing_indices.push_back(q);
+      }
+
+    if (missing_points.empty())
+      return;
+
+#ifdef WORLD_BUILDER_HAS_BATCHED_PROPERTIES
+    // Ask for all requested values at all missing positions at once, so that
+    // the World Builder can look up the features that affect each point
+    // in one pass. As in get_value(), do this without holding any lock.
+    std::vector<std::vector<double>> missing_values = world_builder->properties(missing_points,
+                                                                               missing_depths,
+                                                                               requested_properties);
+#elif WORLD_BUILDER_VERSION_MAJOR > 0 || WORLD_BUILDER_VERSION_MINOR >= 5
+    std::vector<std::vector<double>> missing_values;
+    missing_values.reserve(missing_points.size());
+    for (unsigned int i=0; i<missing_points.size(); ++i)
+      missing_values.emplace_back(world_builder->properties(missing_points[i],
+                                                            missing_depths[i],
+                                                            requested_properties));
+#else
+    std::vector<std::vector<double>> missing_values(missing_points.size(),
+                                                    std::vector<double>(requested_properties.size()));
+    AssertThrow (false,
+                 ExcMessage ("The world builder query cache requires World Builder "
+                             "version 0.5.0 or newer."));
+#endif
+
+    for (unsigned int i=0; i<missing_points.size(); ++i)
+      {
+        values[missing_indices[i]] = missing_values[i][value_index];
+
+        // Check again while holding the lock, so that no values are stored
+        // after stop_caching() has cleared this shard.
+        Shard &shard = get_shard(missing_points[i]);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        if (caching_enabled)
+          shard.values.emplace(missing_points[i], std::move(missing_values[i]));
+      }
+  }
+}
+
+
+// explicit instantiations
+namespace aspect
+{
+#define INSTANTIATE(dim) \
+  template class WorldBuilderQueryCache<dim>;
+
+  ASPECT_INSTANTIATE(INSTANTIATE)
+
+#undef INSTANTIATE
+}
+#endif
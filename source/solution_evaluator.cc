@@ -87,7 +87,7 @@ namespace aspect
             evaluation(mapping, fe, first_selected_component)
         {}
 
-        void evaluate(const ArrayView<double> &solution_values,
+        void evaluate(const ArrayView<const double> &solution_values,
                       const EvaluationFlags::EvaluationFlags flags) override
         {
           evaluation.evaluate(solution_values, flags);
@@ -306,7 +306,7 @@ namespace aspect
 
   template <int dim>
   void
-  SolutionEvaluator<dim>::evaluate(const ArrayView<double> &solution_values,
+  SolutionEvaluator<dim>::evaluate(const ArrayView<const double> &solution_values,
                                    const std::vector<EvaluationFlags::EvaluationFlags> &evaluation_flags)
   {
     const auto &component_indices = simulator_access.introspection().component_indices;
@@ -60,9 +60,11 @@ namespace aspect
                                                     const double scale_factor)
       :
       n_components(n_components),
-      data(n_components),
+      data_values(n_components),
       maximum_component_value(n_components),
       scale_factor(scale_factor),
+      restrict_data_region(false),
+      n_data_region_halo_points(0),
       coordinate_values_are_equidistant(false)
     {}
 
@@ -72,14 +74,27 @@ namespace aspect
     StructuredDataLookup<dim>::StructuredDataLookup(const double scale_factor)
       :
       n_components(numbers::invalid_unsigned_int),
-      data(),
+      data_values(),
       maximum_component_value(),
       scale_factor(scale_factor),
+      restrict_data_region(false),
+      n_data_region_halo_points(0),
       coordinate_values_are_equidistant(false)
     {}
 
 
 
+    template <int dim>
+    StructuredDataLookup<dim>::~StructuredDataLookup()
+    {
+      // Make sure a background load that is still running does not
+      // outlive the object it writes into.
+      if (background_load.thread.joinable())
+        background_load.thread.join();
+    }
+
+
+
     template <int dim>
     std::vector<std::string>
     StructuredDataLookup<dim>::get_column_names() const
@@ -285,282 +300,250 @@ namespace aspect
                ExcMessage("Error: One of the data tables has an incorrect size."));
 
 
-      // For each data component, set up a GridData,
-      // its type depending on the read-in grid.
-      data.resize(n_components);
-      for (unsigned int c = 0; c < n_components; ++c)
+      for (unsigned int d=0; d<dim; ++d)
         {
-          if (coordinate_values_are_equidistant)
-            {
-              std::array<unsigned int,dim> table_intervals;
-              for (unsigned int d=0; d<dim; ++d)
-                table_intervals[d] = table_points[d]-1;
-
-              // The min and max of the coordinates in the data file.
-              std::array<std::pair<double,double>,dim> grid_extent;
-              for (unsigned int d=0; d<dim; ++d)
-                {
-                  grid_extent[d].first = coordinate_values[d][0];
-                  grid_extent[d].second = coordinate_values[d][table_points[d]-1];
-
-                  Assert(table_intervals[d] >= 1,
-                         ExcMessage("There needs to be at least one subinterval in each "
-                                    "coordinate direction."));
-                  Assert(grid_extent[d].first <
-                         grid_extent[d].second,
-                         ExcMessage("The interval in each coordinate direction needs "
-                                    "to have positive size"));
-                }
-
-              data[c]
-                = std::make_unique<Functions::InterpolatedUniformGridData<dim>> (std::move(grid_extent),
-                                                                                  std::move(table_intervals),
-                                                                                  std::move(data_table[c]));
-            }
-          else
-            // Create the object and move the big objects. Due to an old design flaw,
-            // the current class stores a copy of the 'coordinate_values' and some
-            // plugins actually use it too, i.e., we can't move the data out of
-            // this object. In another design flaw, the deal.II classes
-            // do not make the coordinate values accessible, so we have to continue
-            // storing a copy. In other words, we can't just move stuff --
-            // we have to make a copy of 'coordinate_values' and then move
-            // that copy.
-            //
-            // (The call to std::move on the first argument is unnecessary: We
-            // create a temporary object, and that's an rvalue that the constructor
-            // we call would bind to. But never a bad idea to be explicit.)
-            data[c]
-              = std::make_unique<Functions::InterpolatedTensorProductGridData<dim>>
-                (std::move(std::array<std::vector<double>,dim>(this->coordinate_values)),
-                 std::move(data_table[c]));
+          Assert(table_points[d] >= 2,
+                 ExcMessage("There needs to be at least one subinterval in each "
+                            "coordinate direction."));
+          Assert(coordinate_values[d][0] < coordinate_values[d][table_points[d]-1],
+                 ExcMessage("The interval in each coordinate direction needs "
+                            "to have positive size"));
         }
+
+      // Move the data tables into place. If the tables are shared between
+      // processes, this only moves the handle to the shared memory window.
+      data_values = std::move(data_table);
     }
 
 
 
     template <int dim>
     void
-    StructuredDataLookup<dim>::load_ascii(const std::string &filename,
-                                          const MPI_Comm comm)
+    StructuredDataLookup<dim>::parse_ascii(const std::string &filename,
+                                           std::vector<std::string> &column_names,
+                                           std::vector<std::vector<double>> &coordinate_values,
+                                           std::vector<Table<dim,double>> &data_tables)
     {
-      const unsigned int root_process = 0;
+      column_names.clear();
+      data_tables.clear();
+      coordinate_values.assign(dim, std::vector<double>());
+
+      // Grab the values already stored in this class (if they exist), this way we can
+      // check if somebody changes the size of the table over time and error out (see below)
+      TableIndices<dim> new_table_points = this->table_points;
+
+      // We do not need to distribute the contents as we are using shared data
+      // to place it later. Therefore, just read the file on the current
+      // process without any communication, which also allows calling
+      // this function from a background thread.
+      std::stringstream in(read_file_content(filename));
+
+      // Read header lines and table size
+      while (in.peek() == '#')
+        {
+          std::string line;
+          std::getline(in,line);
+          std::stringstream linestream(line);
+          std::string word;
+          while (linestream >> word)
+            if (word == "POINTS:")
+              for (unsigned int i = 0; i < dim; ++i)
+                {
+                  unsigned int temp_index;
+                  linestream >> temp_index;
 
-      std::vector<std::string> column_names;
-      std::vector<Table<dim,double>> data_tables;
-      std::vector<std::vector<double>> coordinate_values(dim);
+                  if (new_table_points[i] == 0)
+                    new_table_points[i] = temp_index;
+                  else
+                    AssertThrow (new_table_points[i] == temp_index,
+                                 ExcMessage("The file grid must not change over model runtime. "
+                                            "Either you prescribed a conflicting number of points in "
+                                            "the input file, or the POINTS comment in your data files "
+                                            "is changing between following files."));
+                }
+        }
 
-      // If this is the root process, set up the various member variables we need to compute
-      // from the input data
-      if (Utilities::MPI::this_mpi_process(comm) == root_process)
+      for (unsigned int i = 0; i < dim; ++i)
         {
-          // Grab the values already stored in this class (if they exist), this way we can
-          // check if somebody changes the size of the table over time and error out (see below)
-          TableIndices<dim> new_table_points = this->table_points;
-
-          // We do not need to distribute the contents as we are using shared data
-          // to place it later. Therefore, just pass MPI_COMM_SELF (i.e.,
-          // a communicator with just a single MPI process) and no distribution
-          // will happen.
-          std::stringstream in(read_and_distribute_file_content(filename,
-                                                                MPI_COMM_SELF));
-
-          // Read header lines and table size
-          while (in.peek() == '#')
-            {
-              std::string line;
-              std::getline(in,line);
-              std::stringstream linestream(line);
-              std::string word;
-              while (linestream >> word)
-                if (word == "POINTS:")
-                  for (unsigned int i = 0; i < dim; ++i)
-                    {
-                      unsigned int temp_index;
-                      linestream >> temp_index;
+          AssertThrow(new_table_points[i] != 0,
+                      ExcMessage("Could not successfully read in the file header of the "
+                                 "ascii data file <" + filename + ">. One header line has to "
+                                 "be of the format: '#POINTS: N1 [N2] [N3]', where N1 and "
+                                 "potentially N2 and N3 have to be the number of data points "
+                                 "in their respective dimension. Check for typos in this line "
+                                 "(e.g. a missing space character)."));
+        }
 
-                      if (new_table_points[i] == 0)
-                        new_table_points[i] = temp_index;
-                      else
-                        AssertThrow (new_table_points[i] == temp_index,
-                                     ExcMessage("The file grid must not change over model runtime. "
-                                                "Either you prescribed a conflicting number of points in "
-                                                "the input file, or the POINTS comment in your data files "
-                                                "is changing between following files."));
-                    }
-            }
+      // Read column lines if present
+      unsigned int name_column_index = 0;
+      double temp_data;
 
-          for (unsigned int i = 0; i < dim; ++i)
+      while (true)
+        {
+          AssertThrow (name_column_index < 100,
+                       ExcMessage("The program found more than 100 columns in the first line of the data file. "
+                                  "This is unlikely intentional. Check your data file and make sure the data can be "
+                                  "interpreted as floating point numbers. If you do want to read a data file with more "
+                                  "than 100 columns, please remove this assertion."));
+
+          std::string column_name_or_data;
+          in >> column_name_or_data;
+          try
             {
-              AssertThrow(new_table_points[i] != 0,
-                          ExcMessage("Could not successfully read in the file header of the "
-                                     "ascii data file <" + filename + ">. One header line has to "
-                                     "be of the format: '#POINTS: N1 [N2] [N3]', where N1 and "
-                                     "potentially N2 and N3 have to be the number of data points "
-                                     "in their respective dimension. Check for typos in this line "
-                                     "(e.g. a missing space character)."));
+              // If the data field contains a name this will throw an exception
+              temp_data = boost::lexical_cast<double>(column_name_or_data);
+
+              // If there was no exception we have left the line containing names
+              // and have read the first data field. Save number of n_components, and
+              // make sure there is no contradiction if the n_components were already given to
+              // the constructor of this class.
+              if (n_components == numbers::invalid_unsigned_int)
+                n_components = name_column_index - dim;
+              else if (name_column_index != 0)
+                AssertThrow (n_components+dim == name_column_index,
+                             ExcMessage("The number of expected data columns and the "
+                                        "list of column names at the beginning of the data file "
+                                        + filename + " do not match. The file should contain "
+                                        + Utilities::int_to_string(name_column_index) + " column "
+                                        "names (one for each dimension and one per data column), "
+                                        "but it only has " + Utilities::int_to_string(n_components+dim) +
+                                        " column names."));
+              break;
             }
-
-          // Read column lines if present
-          unsigned int name_column_index = 0;
-          double temp_data;
-
-          while (true)
+          catch (const boost::bad_lexical_cast &e)
             {
-              AssertThrow (name_column_index < 100,
-                           ExcMessage("The program found more than 100 columns in the first line of the data file. "
-                                      "This is unlikely intentional. Check your data file and make sure the data can be "
-                                      "interpreted as floating point numbers. If you do want to read a data file with more "
-                                      "than 100 columns, please remove this assertion."));
-
-              std::string column_name_or_data;
-              in >> column_name_or_data;
-              try
-                {
-                  // If the data field contains a name this will throw an exception
-                  temp_data = boost::lexical_cast<double>(column_name_or_data);
-
-                  // If there was no exception we have left the line containing names
-                  // and have read the first data field. Save number of n_components, and
-                  // make sure there is no contradiction if the n_components were already given to
-                  // the constructor of this class.
-                  if (n_components == numbers::invalid_unsigned_int)
-                    n_components = name_column_index - dim;
-                  else if (name_column_index != 0)
-                    AssertThrow (n_components+dim == name_column_index,
-                                 ExcMessage("The number of expected data columns and the "
-                                            "list of column names at the beginning of the data file "
-                                            + filename + " do not match. The file should contain "
-                                            + Utilities::int_to_string(name_column_index) + " column "
-                                            "names (one for each dimension and one per data column), "
-                                            "but it only has " + Utilities::int_to_string(n_components+dim) +
-                                            " column names."));
-                  break;
-                }
-              catch (const boost::bad_lexical_cast &e)
+              // The first dim columns are coordinates and contain no data
+              if (name_column_index >= dim)
                 {
-                  // The first dim columns are coordinates and contain no data
-                  if (name_column_index >= dim)
-                    {
-                      // Transform name to lower case to prevent confusion with capital letters
-                      // Note: only ASCII characters allowed
-                      std::transform(column_name_or_data.begin(), column_name_or_data.end(), column_name_or_data.begin(), ::tolower);
+                  // Transform name to lower case to prevent confusion with capital letters
+                  // Note: only ASCII characters allowed
+                  std::transform(column_name_or_data.begin(), column_name_or_data.end(), column_name_or_data.begin(), ::tolower);
 
-                      AssertThrow(std::find(column_names.begin(),column_names.end(),column_name_or_data)
-                                  == column_names.end(),
-                                  ExcMessage("There are multiple fields named " + column_name_or_data +
-                                             " in the data file " + filename + ". Please remove duplication to "
-                                             "allow for unique association between column and name."));
+                  AssertThrow(std::find(column_names.begin(),column_names.end(),column_name_or_data)
+                              == column_names.end(),
+                              ExcMessage("There are multiple fields named " + column_name_or_data +
+                                         " in the data file " + filename + ". Please remove duplication to "
+                                         "allow for unique association between column and name."));
 
-                      column_names.push_back(column_name_or_data);
-                    }
-                  ++name_column_index;
+                  column_names.push_back(column_name_or_data);
                 }
+              ++name_column_index;
             }
+        }
 
-          // Create table for the data. This peculiar reinit is necessary, because
-          // there is no constructor for Table, which takes TableIndices as
-          // argument.
-          Table<dim,double> data_table;
-          data_table.TableBase<dim,double>::reinit(new_table_points);
-          AssertThrow (n_components != numbers::invalid_unsigned_int,
-                       ExcMessage("ERROR: number of n_components in " + filename + " could not be "
-                                  "determined automatically. Either add a header with column "
-                                  "names or pass the number of columns in the StructuredData "
-                                  "constructor."));
-          data_tables.resize(n_components, data_table);
+      // Create table for the data. This peculiar reinit is necessary, because
+      // there is no constructor for Table, which takes TableIndices as
+      // argument.
+      Table<dim,double> data_table;
+      data_table.TableBase<dim,double>::reinit(new_table_points);
+      AssertThrow (n_components != numbers::invalid_unsigned_int,
+                   ExcMessage("ERROR: number of n_components in " + filename + " could not be "
+                              "determined automatically. Either add a header with column "
+                              "names or pass the number of columns in the StructuredData "
+                              "constructor."));
+      data_tables.resize(n_components, data_table);
+
+      for (unsigned int d=0; d<dim; ++d)
+        coordinate_values[d].resize(new_table_points[d]);
+
+      if (column_names.size()==0)
+        {
+          // set default column names:
+          for (unsigned int c=0; c<n_components; ++c)
+            column_names.push_back("column " + Utilities::int_to_string(c,2));
+        }
 
-          for (unsigned int d=0; d<dim; ++d)
-            coordinate_values[d].resize(new_table_points[d]);
+      // Make sure the data file actually has as many columns as we think it has
+      // (either based on the header, or based on what was passed to the constructor).
+      const std::streampos position = in.tellg();
+      std::string first_data_row;
+      std::getline(in, first_data_row);
+      std::stringstream linestream(first_data_row);
+      std::string column_entry;
+
+      // We have already read in the first data entry above in the try/catch block,
+      // so there's one more column in the file than in the line we just read in.
+      unsigned int number_of_entries = 1;
+      while (linestream >> column_entry)
+        number_of_entries += 1;
+
+      AssertThrow ((number_of_entries) == column_names.size()+dim,
+                   ExcMessage("ERROR: The number of columns in the data file " + filename +
+                              " is incorrect. It needs to have " + Utilities::int_to_string(column_names.size()+dim) +
+                              " columns, but the first row has " + Utilities::int_to_string(number_of_entries) +
+                              " columns."));
+
+      // Go back to the position in the file where we started the check for the column numbers.
+      in.seekg (position);
+
+      // Finally read data lines:
+      std::size_t read_data_entries = 0;
+      do
+        {
+          // what row and column of the file are we in?
+          const std::size_t column_num = read_data_entries%(n_components+dim);
+          const std::size_t row_num = read_data_entries/(n_components+dim);
+          const TableIndices<dim> idx = compute_table_indices(new_table_points, row_num);
 
-          if (column_names.size()==0)
+          if (column_num < dim)
             {
-              // set default column names:
-              for (unsigned int c=0; c<n_components; ++c)
-                column_names.push_back("column " + Utilities::int_to_string(c,2));
+              // This is a coordinate. Store (and check that they are consistent)
+              const double old_value = coordinate_values[column_num][idx[column_num]];
+
+              AssertThrow(old_value == 0. ||
+                          (std::abs(old_value-temp_data) < 1e-8*std::abs(old_value)),
+                          ExcMessage("Invalid coordinate in column "
+                                     + Utilities::int_to_string(column_num) + " in row "
+                                     + Utilities::int_to_string(row_num)
+                                     + " in file " + filename +
+                                     "\nThis class expects the coordinates to be structured, meaning "
+                                     "the coordinate values in each coordinate direction repeat exactly "
+                                     "each time. This also means each row in the data file has to have "
+                                     "the same number of columns as the first row containing data."));
+
+              coordinate_values[column_num][idx[column_num]] = temp_data;
             }
-
-          // Make sure the data file actually has as many columns as we think it has
-          // (either based on the header, or based on what was passed to the constructor).
-          const std::streampos position = in.tellg();
-          std::string first_data_row;
-          std::getline(in, first_data_row);
-          std::stringstream linestream(first_data_row);
-          std::string column_entry;
-
-          // We have already read in the first data entry above in the try/catch block,
-          // so there's one more column in the file than in the line we just read in.
-          unsigned int number_of_entries = 1;
-          while (linestream >> column_entry)
-            number_of_entries += 1;
-
-          AssertThrow ((number_of_entries) == column_names.size()+dim,
-                       ExcMessage("ERROR: The number of columns in the data file " + filename +
-                                  " is incorrect. It needs to have " + Utilities::int_to_string(column_names.size()+dim) +
-                                  " columns, but the first row has " + Utilities::int_to_string(number_of_entries) +
-                                  " columns."));
-
-          // Go back to the position in the file where we started the check for the column numbers.
-          in.seekg (position);
-
-          // Finally read data lines:
-          std::size_t read_data_entries = 0;
-          do
+          else
             {
-              // what row and column of the file are we in?
-              const std::size_t column_num = read_data_entries%(n_components+dim);
-              const std::size_t row_num = read_data_entries/(n_components+dim);
-              const TableIndices<dim> idx = compute_table_indices(new_table_points, row_num);
-
-              if (column_num < dim)
-                {
-                  // This is a coordinate. Store (and check that they are consistent)
-                  const double old_value = coordinate_values[column_num][idx[column_num]];
-
-                  AssertThrow(old_value == 0. ||
-                              (std::abs(old_value-temp_data) < 1e-8*std::abs(old_value)),
-                              ExcMessage("Invalid coordinate in column "
-                                         + Utilities::int_to_string(column_num) + " in row "
-                                         + Utilities::int_to_string(row_num)
-                                         + " in file " + filename +
-                                         "\nThis class expects the coordinates to be structured, meaning "
-                                         "the coordinate values in each coordinate direction repeat exactly "
-                                         "each time. This also means each row in the data file has to have "
-                                         "the same number of columns as the first row containing data."));
-
-                  coordinate_values[column_num][idx[column_num]] = temp_data;
-                }
-              else
-                {
-                  // This is a data value, so scale and store:
-                  const unsigned int component = column_num - dim;
-                  data_tables[component](idx) = temp_data * scale_factor;
-                }
-
-              ++read_data_entries;
+              // This is a data value, so scale and store:
+              const unsigned int component = column_num - dim;
+              data_tables[component](idx) = temp_data * scale_factor;
             }
-          while (in >> temp_data);
-
-          AssertThrow(in.eof(),
-                      ExcMessage ("While reading the data file '" + filename + "' the ascii data "
-                                  "plugin has encountered an error before the end of the file. "
-                                  "Please check for malformed data values (e.g. NaN) or superfluous "
-                                  "lines at the end of the data file."));
-
-          const std::size_t n_expected_data_entries = (n_components + dim) * data_table.n_elements();
-          AssertThrow(read_data_entries == n_expected_data_entries,
-                      ExcMessage ("While reading the data file '" + filename + "' the ascii data "
-                                  "plugin has reached the end of the file, but has not found the "
-                                  "expected number of data values considering the spatial dimension, "
-                                  "data columns, and number of lines prescribed by the POINTS header "
-                                  "of the file. Please check the number of data "
-                                  "lines against the POINTS header in the file."));
+
+          ++read_data_entries;
         }
+      while (in >> temp_data);
+
+      AssertThrow(in.eof(),
+                  ExcMessage ("While reading the data file '" + filename + "' the ascii data "
+                              "plugin has encountered an error before the end of the file. "
+                              "Please check for malformed data values (e.g. NaN) or superfluous "
+                              "lines at the end of the data file."));
+
+      const std::size_t n_expected_data_entries = (n_components + dim) * data_table.n_elements();
+      AssertThrow(read_data_entries == n_expected_data_entries,
+                  ExcMessage ("While reading the data file '" + filename + "' the ascii data "
+                              "plugin has reached the end of the file, but has not found the "
+                              "expected number of data values considering the spatial dimension, "
+                              "data columns, and number of lines prescribed by the POINTS header "
+                              "of the file. Please check the number of data "
+                              "lines against the POINTS header in the file."));
+    }
+
 
+
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::broadcast_and_reinit(std::vector<std::string> &&column_names,
+                                                    std::vector<std::vector<double>> &&coordinate_values,
+                                                    std::vector<Table<dim,double>> &&data_tables,
+                                                    const MPI_Comm comm,
+                                                    const unsigned int root_process)
+    {
       // deal.II supports sharing data (since 9.4), so we have to
       // set up member variables on the root process, but not on any of
       // the other processes. So broadcast the data to the remaining
-      // processes -- the code above really only wrote into one
+      // processes -- parse_ascii() really only wrote into one
       // member variable ('n_components'), so that is the only one we
       // have to broadcast.
       //
@@ -599,112 +582,83 @@ namespace aspect
 
     template <int dim>
     void
-    StructuredDataLookup<dim>::load_netcdf(const std::string &filename, const std::vector<std::string> &data_column_names_)
+    StructuredDataLookup<dim>::load_ascii(const std::string &filename,
+                                          const MPI_Comm comm)
+    {
+      const unsigned int root_process = 0;
+
+      std::vector<std::string> column_names;
+      std::vector<Table<dim,double>> data_tables;
+      std::vector<std::vector<double>> coordinate_values(dim);
+
+      // If this is the root process, read the file and set up the data we need
+      // to compute from the input data
+      if (Utilities::MPI::this_mpi_process(comm) == root_process)
+        parse_ascii(filename, column_names, coordinate_values, data_tables);
+
+      broadcast_and_reinit(std::move(column_names),
+                           std::move(coordinate_values),
+                           std::move(data_tables),
+                           comm,
+                           root_process);
+    }
+
+
+
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::load_netcdf(const std::string &filename,
+                                           const std::vector<std::string> &data_column_names_,
+                                           const MPI_Comm communicator)
     {
 #ifndef ASPECT_WITH_NETCDF
       (void)filename;
       (void)data_column_names_;
+      (void)communicator;
       AssertThrow(false, ExcMessage("Loading NetCDF files is only supported if ASPECT is configured with the NetCDF library!"));
 #else
-      TableIndices<dim> new_table_points;
-      std::vector<std::string> coordinate_column_names(dim);
-      std::vector<Table<dim,double>> data_tables;
+      const unsigned int root_process = 0;
+
       std::vector<std::string> data_column_names = data_column_names_;
       std::vector<std::vector<double>> coordinate_values(dim);
+      std::vector<Table<dim,double>> data_tables;
 
-      int ncid;
-      int status;
-
-      status = nc_open(filename.c_str(), NC_NOWRITE, &ncid);
-      AssertThrowNetCDF(status);
-
-      int ndims, nvars, ngatts, unlimdimid;
-      status = nc_inq(ncid, &ndims, &nvars, &ngatts, &unlimdimid);
-      AssertThrowNetCDF(status);
-
-      // The number of dimensions ndims in the netcdf file can be
-      // different than dim. In fact, each variable (data column in
-      // our notation) has a subset of those dimensions associated
-      // with it. That also means that variables can have a different
-      // number of dimensions and/or a different subset. We can only
-      // use variables with dim dimensions (our template argument) and
-      // only those that all use the same dimids inside the netcdf
-      // file.
-      int dimids_to_use[dim] = {}; // dimids of the coordinate columns to use
-      std::vector<int> varids_to_use; // all netCDF varids of the data columns
-
-      if (data_column_names.empty())
+      // Only read the file on the root process, the data is then shared
+      // with (or broadcast to) all other processes.
+      if (Utilities::MPI::this_mpi_process(communicator) == root_process)
         {
-          // The user did not ask for a specific list of data
-          // columns. Let's find all columns we can possible load. We
-          // find the first data column with the correct number of
-          // dims. This one will determine the dimids of the
-          // coordinates to use. Following that, we pick all other
-          // data columns with the same coordinates.
-
-          for (int varid=0; varid<nvars; ++varid)
-            {
-              // Each netCDF dimension also has an associated variable that stores the
-              // coordinate data. We are looking for data columns, so skip them:
-              if (varid < ndims)
-                continue;
-
-              char  var_name[NC_MAX_NAME];
-              nc_type xtype;
-              int var_ndims;
-              int var_dimids[NC_MAX_VAR_DIMS];
-              int var_natts;
-
-              status = nc_inq_var (ncid, varid, var_name, &xtype, &var_ndims, var_dimids,
-                                   &var_natts);
-              AssertThrowNetCDF(status);
+          TableIndices<dim> new_table_points;
+          std::vector<std::string> coordinate_column_names(dim);
 
-              // only consider data that has dim variables:
-              if (var_ndims == dim)
-                {
-                  bool use = true;
-                  if (varids_to_use.size()>0)
-                    {
-                      // This is not the first data column, so we can only use it if
-                      // it uses the same dim variables as the first data column we
-                      // found.
-                      for (int i=0; i<dim; ++i)
-                        if (dimids_to_use[i]!=var_dimids[i])
-                          {
-                            use=false;
-                            break;
-                          }
-                    }
-                  else
-                    {
-                      // This is the first data column we found, so grab the ids of
-                      // the dimensions to use and store in dimids_to_use:
-                      for (int i=0; i<dim; ++i)
-                        {
-                          size_t length;
-                          status = nc_inq_dim(ncid, var_dimids[i], nullptr, &length);
-                          dimids_to_use[i] = var_dimids[i];
-                          // dimensions are specified in reverse order in the nc file:
-                          new_table_points[dim-1-i] = length;
-                        }
-                    }
+          int ncid;
+          int status;
 
-                  if (use)
-                    {
-                      varids_to_use.push_back(varid);
-                      data_column_names.push_back(var_name);
-                    }
-                }
-            }
+          status = nc_open(filename.c_str(), NC_NOWRITE, &ncid);
+          AssertThrowNetCDF(status);
 
-        }
-      else
-        {
-          // The user wants a specific list of columns, so lets find them.
+          int ndims, nvars, ngatts, unlimdimid;
+          status = nc_inq(ncid, &ndims, &nvars, &ngatts, &unlimdimid);
+          AssertThrowNetCDF(status);
 
-          for (const auto &cur_name: data_column_names)
+          // The number of dimensions ndims in the netcdf file can be
+          // different than dim. In fact, each variable (data column in
+          // our notation) has a subset of those dimensions associated
+          // with it. That also means that variables can have a different
+          // number of dimensions and/or a different subset. We can only
+          // use variables with dim dimensions (our template argument) and
+          // only those that all use the same dimids inside the netcdf
+          // file.
+          int dimids_to_use[dim] = {}; // dimids of the coordinate columns to use
+          std::vector<int> varids_to_use; // all netCDF varids of the data columns
+
+          if (data_column_names.empty())
             {
-              bool found = false;
+              // The user did not ask for a specific list of data
+              // columns. Let's find all columns we can possible load. We
+              // find the first data column with the correct number of
+              // dims. This one will determine the dimids of the
+              // coordinates to use. Following that, we pick all other
+              // data columns with the same coordinates.
 
               for (int varid=0; varid<nvars; ++varid)
                 {
@@ -722,16 +676,16 @@ namespace aspect
                   status = nc_inq_var (ncid, varid, var_name, &xtype, &var_ndims, var_dimids,
                                        &var_natts);
                   AssertThrowNetCDF(status);
-                  if (cur_name != var_name)
-                    continue;
-
-                  found = true;
 
+                  // only consider data that has dim variables:
                   if (var_ndims == dim)
                     {
                       bool use = true;
                       if (varids_to_use.size()>0)
                         {
+                          // This is not the first data column, so we can only use it if
+                          // it uses the same dim variables as the first data column we
+                          // found.
                           for (int i=0; i<dim; ++i)
                             if (dimids_to_use[i]!=var_dimids[i])
                               {
@@ -741,6 +695,8 @@ namespace aspect
                         }
                       else
                         {
+                          // This is the first data column we found, so grab the ids of
+                          // the dimensions to use and store in dimids_to_use:
                           for (int i=0; i<dim; ++i)
                             {
                               size_t length;
@@ -751,102 +707,321 @@ namespace aspect
                             }
                         }
 
-                      AssertThrow(use, ExcMessage(
-                                    "You asked to include column '" + cur_name + "', but it unfortunately has different dimensions than the first column you chose."
-                                  ));
+                      if (use)
+                        {
+                          varids_to_use.push_back(varid);
+                          data_column_names.push_back(var_name);
+                        }
+                    }
+                }
+
+            }
+          else
+            {
+              // The user wants a specific list of columns, so lets find them.
 
+              for (const auto &cur_name: data_column_names)
+                {
+                  bool found = false;
+
+                  for (int varid=0; varid<nvars; ++varid)
+                    {
+                      // Each netCDF dimension also has an associated variable that stores the
+                      // coordinate data. We are looking for data columns, so skip them:
+                      if (varid < ndims)
+                        continue;
+
+                      char  var_name[NC_MAX_NAME];
+                      nc_type xtype;
+                      int var_ndims;
+                      int var_dimids[NC_MAX_VAR_DIMS];
+                      int var_natts;
+
+                      status = nc_inq_var (ncid, varid, var_name, &xtype, &var_ndims, var_dimids,
+                                           &var_natts);
+                      AssertThrowNetCDF(status);
+                      if (cur_name != var_name)
+                        continue;
+
+                      found = true;
+
+                      if (var_ndims == dim)
+                        {
+                          bool use = true;
+                          if (varids_to_use.size()>0)
+                            {
+                              for (int i=0; i<dim; ++i)
+                                if (dimids_to_use[i]!=var_dimids[i])
+                                  {
+                                    use=false;
+                                    break;
+                                  }
+                            }
+                          else
+                            {
+                              for (int i=0; i<dim; ++i)
+                                {
+                                  size_t length;
+                                  status = nc_inq_dim(ncid, var_dimids[i], nullptr, &length);
+                                  dimids_to_use[i] = var_dimids[i];
+                                  // dimensions are specified in reverse order in the nc file:
+                                  new_table_points[dim-1-i] = length;
+                                }
+                            }
+
+                          AssertThrow(use, ExcMessage(
+                                        "You asked to include column '" + cur_name + "', but it unfortunately has different dimensions than the first column you chose."
+                                      ));
+
+
+                          varids_to_use.push_back(varid);
+                        }
+                      else
+                        AssertThrow(false, ExcMessage(
+                                      "You asked to include column '" + cur_name + "', but it unfortunately has an incorrect number of dimensions."
+                                    ));
 
-                      varids_to_use.push_back(varid);
                     }
-                  else
-                    AssertThrow(false, ExcMessage(
-                                  "You asked to include column '" + cur_name + "', but it unfortunately has an incorrect number of dimensions."
-                                ));
+                  AssertThrow(found, ExcMessage(
+                                "You asked to include column '" + cur_name + "', but it was not found!"
+                              ));
 
                 }
-              AssertThrow(found, ExcMessage(
-                            "You asked to include column '" + cur_name + "', but it was not found!"
-                          ));
-
             }
-        }
-
 
-      // Extract names of the coordinates
-      for (int idx=0; idx<dim; ++idx)
-        {
-          char  name[NC_MAX_NAME];
-          size_t length;
-          status = nc_inq_dim(ncid, dimids_to_use[idx], name, &length);
-          AssertThrowNetCDF(status);
-          coordinate_column_names[idx] = name;
-        }
 
-      {
-        // Now load coordinate data
+          // Extract names of the coordinates
+          for (int idx=0; idx<dim; ++idx)
+            {
+              char  name[NC_MAX_NAME];
+              size_t length;
+              status = nc_inq_dim(ncid, dimids_to_use[idx], name, &length);
+              AssertThrowNetCDF(status);
+              coordinate_column_names[idx] = name;
+            }
 
-        for (int d=0; d<dim; ++d)
           {
-            // dimensions are specified in reverse order in the nc file:
-            int varid = dimids_to_use[dim-1-d];
+            // Now load coordinate data
 
-            nc_type xtype;
-            int ndims;
-            int dimids[NC_MAX_VAR_DIMS];
-            char  name[NC_MAX_NAME];
-            int natts;
+            for (int d=0; d<dim; ++d)
+              {
+                // dimensions are specified in reverse order in the nc file:
+                int varid = dimids_to_use[dim-1-d];
+
+                nc_type xtype;
+                int ndims;
+                int dimids[NC_MAX_VAR_DIMS];
+                char  name[NC_MAX_NAME];
+                int natts;
 
-            status = nc_inq_var (ncid, varid, name, &xtype, &ndims, dimids,
-                                 &natts);
-            AssertThrow(ndims == 1, ExcMessage("A variable of a dimension should have only one dimension."));
+                status = nc_inq_var (ncid, varid, name, &xtype, &ndims, dimids,
+                                     &natts);
+                AssertThrow(ndims == 1, ExcMessage("A variable of a dimension should have only one dimension."));
 
-            AssertThrow(xtype == NC_DOUBLE || xtype == NC_FLOAT, ExcMessage("We only support float or double data."));
+                AssertThrow(xtype == NC_DOUBLE || xtype == NC_FLOAT, ExcMessage("We only support float or double data."));
 
-            coordinate_values[d].resize(new_table_points[d]);
-            status = nc_get_var_double(ncid, varid, coordinate_values[d].data());
-            AssertThrowNetCDF(status);
+                coordinate_values[d].resize(new_table_points[d]);
+                status = nc_get_var_double(ncid, varid, coordinate_values[d].data());
+                AssertThrowNetCDF(status);
+              }
           }
-      }
 
-      {
-        // Finally load the data for each column
-        data_tables.resize(varids_to_use.size());
-        std::vector<double> raw_data;
+          // If requested, only load the part of the data grid that covers the
+          // data region plus the halo. Determine the range of data points to
+          // load in each coordinate direction and cut the coordinates to it.
+          std::array<std::size_t,dim> first_index;
+          first_index.fill(0);
+          if (restrict_data_region)
+            for (unsigned int d=0; d<dim; ++d)
+              {
+                const std::vector<double> &coordinates = coordinate_values[d];
+
+                // The last data point not larger than the lower end of the
+                // region, and the first data point not smaller than the upper end.
+                std::size_t first = std::upper_bound(coordinates.begin(), coordinates.end(),
+                                                     data_region.lower_bound(d)) - coordinates.begin();
+                first = (first > 0 ? first - 1 : 0);
+                std::size_t last = std::lower_bound(coordinates.begin(), coordinates.end(),
+                                                    data_region.upper_bound(d)) - coordinates.begin();
+                last = std::min(last, coordinates.size() - 1);
+
+                first = (first > n_data_region_halo_points ? first - n_data_region_halo_points : 0);
+                last = std::min(last + n_data_region_halo_points, coordinates.size() - 1);
+
+                // We need at least two data points in each direction, even
+                // if the region lies completely outside of the data.
+                if (last == first)
+                  {
+                    if (last + 1 < coordinates.size())
+                      ++last;
+                    else
+                      --first;
+                  }
+
+                first_index[d] = first;
+                new_table_points[d] = last - first + 1;
+                coordinate_values[d] = std::vector<double>(coordinates.begin() + first,
+                                                           coordinates.begin() + last + 1);
+              }
 
-        for (unsigned int var = 0; var<varids_to_use.size(); ++var)
           {
-            // Allocate space
-            data_tables[var].TableBase<dim,double>::reinit(new_table_points);
-            const std::size_t n_elements = data_tables[var].n_elements();
-            raw_data.resize(n_elements);
-
-            // Load the data
-            status = nc_get_var_double(ncid, varids_to_use[var], raw_data.data());
-            AssertThrowNetCDF(status);
+            // Finally load the data for each column
+            data_tables.resize(varids_to_use.size());
+            std::vector<double> raw_data;
 
-            // .. and copy it over:
-            for (std::size_t n = 0; n < n_elements; ++n)
+            for (unsigned int var = 0; var<varids_to_use.size(); ++var)
               {
-                TableIndices<dim> ind = compute_table_indices(new_table_points, n);
-                TableIndices<dim> ind_to_use;
-                for (int i=0; i<dim; ++i)
-                  ind_to_use[i] = ind[dimids_to_use[i]];
-
-                data_tables[var](ind) = scale_factor * raw_data[n];
+                // Allocate space
+                data_tables[var].TableBase<dim,double>::reinit(new_table_points);
+                const std::size_t n_elements = data_tables[var].n_elements();
+                raw_data.resize(n_elements);
+
+                // Load the data. Dimensions are specified in reverse order
+                // in the nc file:
+                std::size_t start[dim];
+                std::size_t count[dim];
+                for (unsigned int i=0; i<dim; ++i)
+                  {
+                    start[i] = first_index[dim-1-i];
+                    count[i] = new_table_points[dim-1-i];
+                  }
+                status = nc_get_vara_double(ncid, varids_to_use[var], start, count, raw_data.data());
+                AssertThrowNetCDF(status);
+
+                // .. and copy it over:
+                for (std::size_t n = 0; n < n_elements; ++n)
+                  {
+                    TableIndices<dim> ind = compute_table_indices(new_table_points, n);
+                    TableIndices<dim> ind_to_use;
+                    for (int i=0; i<dim; ++i)
+                      ind_to_use[i] = ind[dimids_to_use[i]];
+
+                    data_tables[var](ind) = scale_factor * raw_data[n];
+                  }
               }
+
           }
 
-      }
 
+          status = nc_close(ncid);
+          AssertThrowNetCDF(status);
 
-      status = nc_close(ncid);
-      AssertThrowNetCDF(status);
+          n_components = data_column_names.size();
+        }
 
       // ready to go:
-      this->reinit(data_column_names, std::move(coordinate_values),std::move(data_tables));
+      broadcast_and_reinit(std::move(data_column_names),
+                           std::move(coordinate_values),
+                           std::move(data_tables),
+                           communicator,
+                           root_process);
 #endif
     }
 
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::start_background_load(const std::string &filename,
+                                                     const MPI_Comm communicator)
+    {
+      const unsigned int root_process = 0;
+
+      AssertThrow(background_load.filename.empty(),
+                  ExcMessage("Cannot start loading the file <" + filename + "> in the "
+                             "background while the file <" + background_load.filename
+                             + "> is still being loaded."));
+      background_load.filename = filename;
+
+      // NetCDF files are read on the root process by load_netcdf(), which
+      // broadcasts the data to the other processes and can therefore not
+      // run on a separate thread. The NetCDF library is not thread-safe
+      // either, so these files are read when the load is finished.
+      const bool is_netcdf_filename = std::regex_search(filename, std::regex("\\.(nc|NC)$"));
+      if (is_netcdf_filename)
+        return;
+
+      // Only the root process reads and parses the file. This does not
+      // involve any communication, so it is safe to do on a separate thread
+      // while the main thread continues with the model. Exceptions are
+      // stored and rethrown when the load is finished.
+      if (Utilities::MPI::this_mpi_process(communicator) == root_process)
+        background_load.thread = std::thread([this]()
+        {
+          try
+            {
+              parse_ascii(background_load.filename,
+                          background_load.column_names,
+                          background_load.coordinate_values,
+                          background_load.data_tables);
+            }
+          catch (...)
+            {
+              background_load.exception = std::current_exception();
+            }
+        });
+    }
+
+
+
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::finish_background_load(const MPI_Comm communicator)
+    {
+      const unsigned int root_process = 0;
+
+      AssertThrow(!background_load.filename.empty(),
+                  ExcMessage("There is no data file being loaded in the background."));
+
+      const std::string filename = std::move(background_load.filename);
+      background_load.filename.clear();
+
+      const bool is_netcdf_filename = std::regex_search(filename, std::regex("\\.(nc|NC)$"));
+      if (is_netcdf_filename)
+        {
+          load_netcdf(filename, {}, communicator);
+          return;
+        }
+
+      if (background_load.thread.joinable())
+        background_load.thread.join();
+
+      // Let all processes know whether reading the file succeeded, so that they
+      // do not wait for data that is never sent.
+      const bool load_failed = Utilities::MPI::broadcast (communicator,
+                                                          background_load.exception != nullptr,
+                                                          root_process);
+      if (load_failed)
+        {
+          if (Utilities::MPI::this_mpi_process(communicator) == root_process)
+            {
+              const std::exception_ptr exception = background_load.exception;
+              background_load.exception = nullptr;
+              std::rethrow_exception(exception);
+            }
+          else
+            throw QuietException();
+        }
+
+      broadcast_and_reinit(std::move(background_load.column_names),
+                           std::move(background_load.coordinate_values),
+                           std::move(background_load.data_tables),
+                           communicator,
+                           root_process);
+    }
+
+
+
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::restrict_to_region(const BoundingBox<dim> &region,
+                                                  const unsigned int n_halo_points)
+    {
+      restrict_data_region = true;
+      data_region = region;
+      n_data_region_halo_points = n_halo_points;
+    }
+
+
+
     template <int dim>
     void
     StructuredDataLookup<dim>::load_file(const std::string &filename,
@@ -854,26 +1029,291 @@ namespace aspect
     {
       const bool is_netcdf_filename = std::regex_search(filename, std::regex("\\.(nc|NC)$"));
       if (is_netcdf_filename)
-        load_netcdf(filename);
+        load_netcdf(filename, {}, communicator);
       else
         load_ascii(filename, communicator);
     }
 
+    namespace
+    {
+      /**
+       * Interpolate the data in @p data_values (d-)linearly within the
+       * cell with index @p ix at the position @p xi given in the unit
+       * coordinates of the cell. The order of operations follows
+       * the deal.II class Functions::InterpolatedTensorProductGridData,
+       * which was used for the interpolation before.
+       */
+      double
+      interpolate (const Table<1,double> &data_values,
+                   const TableIndices<1> &ix,
+                   const Point<1>        &xi)
+      {
+        return ((1-xi[0])*data_values[ix[0]]
+                +
+                xi[0]*data_values[ix[0]+1]);
+      }
+
+
+
+      double
+      interpolate (const Table<2,double> &data_values,
+                   const TableIndices<2> &ix,
+                   const Point<2>        &xi)
+      {
+        return (((1-xi[0])*data_values[ix[0]][ix[1]]
+                 +
+                 xi[0]*data_values[ix[0]+1][ix[1]])*(1-xi[1])
+                +
+                ((1-xi[0])*data_values[ix[0]][ix[1]+1]
+                 +
+                 xi[0]*data_values[ix[0]+1][ix[1]+1])*xi[1]);
+      }
+
+
+
+      double
+      interpolate (const Table<3,double> &data_values,
+                   const TableIndices<3> &ix,
+                   const Point<3>        &xi)
+      {
+        return ((((1-xi[0])*data_values[ix[0]][ix[1]][ix[2]]
+                  +
+                  xi[0]*data_values[ix[0]+1][ix[1]][ix[2]])*(1-xi[1])
+                 +
+                 ((1-xi[0])*data_values[ix[0]][ix[1]+1][ix[2]]
+                  +
+                  xi[0]*data_values[ix[0]+1][ix[1]+1][ix[2]])*xi[1])*(1-xi[2])
+                +
+                (((1-xi[0])*data_values[ix[0]][ix[1]][ix[2]+1]
+                  +
+                  xi[0]*data_values[ix[0]+1][ix[1]][ix[2]+1])*(1-xi[1])
+                 +
+                 ((1-xi[0])*data_values[ix[0]][ix[1]+1][ix[2]+1]
+                  +
+                  xi[0]*data_values[ix[0]+1][ix[1]+1][ix[2]+1])*xi[1])*xi[2]);
+      }
+
+
+
+      /**
+       * Compute the gradient of the (d-)linear interpolant of @p data_values
+       * within the cell with index @p ix and size @p dx at the position
+       * @p xi given in the unit coordinates of the cell.
+       */
+      Tensor<1,1>
+      gradient_interpolate (const Table<1,double> &data_values,
+                            const TableIndices<1> &ix,
+                            const Point<1>        &xi,
+                            const Tensor<1,1>     &dx)
+      {
+        (void)xi;
+        Tensor<1,1> grad;
+        grad[0] = (data_values[ix[0]+1] - data_values[ix[0]]) / dx[0];
+        return grad;
+      }
+
+
+
+      Tensor<1,2>
+      gradient_interpolate (const Table<2,double> &data_values,
+                            const TableIndices<2> &ix,
+                            const Point<2>        &xi,
+                            const Tensor<1,2>     &dx)
+      {
+        Tensor<1,2> grad;
+        const double
+        u00 = data_values[ix[0]][ix[1]],
+        u01 = data_values[ix[0]+1][ix[1]],
+        u10 = data_values[ix[0]][ix[1]+1],
+        u11 = data_values[ix[0]+1][ix[1]+1];
+
+        grad[0] = ((1-xi[1])*(u01-u00) + xi[1]*(u11-u10))/dx[0];
+        grad[1] = ((1-xi[0])*(u10-u00) + xi[0]*(u11-u01))/dx[1];
+        return grad;
+      }
+
+
+
+      Tensor<1,3>
+      gradient_interpolate (const Table<3,double> &data_values,
+                            const TableIndices<3> &ix,
+                            const Point<3>        &xi,
+                            const Tensor<1,3>     &dx)
+      {
+        Tensor<1,3> grad;
+        const double
+        u000 = data_values[ix[0]][ix[1]][ix[2]],
+        u001 = data_values[ix[0]+1][ix[1]][ix[2]],
+        u010 = data_values[ix[0]][ix[1]+1][ix[2]],
+        u100 = data_values[ix[0]][ix[1]][ix[2]+1],
+        u011 = data_values[ix[0]+1][ix[1]+1][ix[2]],
+        u101 = data_values[ix[0]+1][ix[1]][ix[2]+1],
+        u110 = data_values[ix[0]][ix[1]+1][ix[2]+1],
+        u111 = data_values[ix[0]+1][ix[1]+1][ix[2]+1];
+
+        grad[0] = ((1-xi[2])*((1-xi[1])*(u001-u000) + xi[1]*(u011-u010))
+                   + xi[2]*((1-xi[1])*(u101-u100) + xi[1]*(u111-u110)))/dx[0];
+        grad[1] = ((1-xi[2])*((1-xi[0])*(u010-u000) + xi[0]*(u011-u001))
+                   + xi[2]*((1-xi[0])*(u110-u100) + xi[0]*(u111-u101)))/dx[1];
+        grad[2] = ((1-xi[1])*((1-xi[0])*(u100-u000) + xi[0]*(u101-u001))
+                   + xi[1]*((1-xi[0])*(u110-u010) + xi[0]*(u111-u011)))/dx[2];
+        return grad;
+      }
+    }
+
+
+
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::compute_interpolation_weights(const ArrayView<const Point<dim>> &positions,
+                                                             const ArrayView<InterpolationWeights> &weights) const
+    {
+      Assert(weights.size() == positions.size(),
+             ExcDimensionMismatch(weights.size(), positions.size()));
+
+      if (coordinate_values_are_equidistant)
+        {
+          // For equidistant coordinates the cell containing a point follows
+          // directly from its distance to the first coordinate, so we do not
+          // need to search. Precompute the grid parameters once, so that
+          // the loop over all points below only contains arithmetic
+          // and can be vectorized by the compiler.
+          std::array<double,dim> grid_start;
+          std::array<double,dim> grid_end;
+          std::array<double,dim> grid_spacing;
+          std::array<unsigned int,dim> n_intervals;
+          for (unsigned int d=0; d<dim; ++d)
+            {
+              n_intervals[d] = table_points[d] - 1;
+              grid_start[d] = coordinate_values[d][0];
+              grid_end[d] = coordinate_values[d][n_intervals[d]];
+              grid_spacing[d] = (grid_end[d] - grid_start[d]) / n_intervals[d];
+            }
+
+          for (unsigned int q=0; q<positions.size(); ++q)
+            for (unsigned int d=0; d<dim; ++d)
+              {
+                const double x = positions[q][d];
+                const unsigned int ix = (x <= grid_start[d]
+                                         ?
+                                         0
+                                         :
+                                         (x >= grid_end[d] - grid_spacing[d]
+                                          ?
+                                          n_intervals[d] - 1
+                                          :
+                                          static_cast<unsigned int>((x - grid_start[d]) / grid_spacing[d])));
+
+                weights[q].cell_index[d] = ix;
+                weights[q].cell_size[d] = grid_spacing[d];
+                weights[q].unit_position[d] = std::max(std::min((x - grid_start[d] - ix * grid_spacing[d]) / grid_spacing[d], 1.), 0.);
+              }
+        }
+      else
+        {
+          for (unsigned int q=0; q<positions.size(); ++q)
+            for (unsigned int d=0; d<dim; ++d)
+              {
+                const std::vector<double> &coordinates = coordinate_values[d];
+                const double x = positions[q][d];
+
+                // Find the first coordinate that is larger than x. The cell
+                // we want is the one to the left of it, unless the point lies
+                // outside of the grid, in which case we use the first or last
+                // cell and extend the data by a constant value. Like in
+                // deal.II, a point on an interior grid node belongs to the
+                // cell to its right, which is also what the equidistant
+                // branch above does.
+                const unsigned int first_larger = std::upper_bound(coordinates.begin(), coordinates.end(), x) - coordinates.begin();
+                const unsigned int ix = std::min(first_larger > 0 ? first_larger - 1 : 0,
+                                                 static_cast<unsigned int>(coordinates.size()) - 2);
+
+                weights[q].cell_index[d] = ix;
+                weights[q].cell_size[d] = coordinates[ix+1] - coordinates[ix];
+                weights[q].unit_position[d] = std::max(std::min((x - coordinates[ix]) / weights[q].cell_size[d], 1.), 0.);
+              }
+        }
+    }
+
+
+
     template <int dim>
     double
     StructuredDataLookup<dim>::get_data(const Point<dim> &position,
                                         const unsigned int component) const
     {
       Assert(component<n_components, ExcMessage("Invalid component index"));
-      return data[component]->value(position);
+
+      InterpolationWeights weights;
+      compute_interpolation_weights(make_array_view(&position, &position+1),
+                                    make_array_view(&weights, &weights+1));
+
+      return interpolate(data_values[component], weights.cell_index, weights.unit_position);
     }
 
+
+
     template <int dim>
     Tensor<1,dim>
     StructuredDataLookup<dim>::get_gradients(const Point<dim> &position,
                                              const unsigned int component)
     {
-      return data[component]->gradient(position,0);
+      Assert(component<n_components, ExcMessage("Invalid component index"));
+
+      InterpolationWeights weights;
+      compute_interpolation_weights(make_array_view(&position, &position+1),
+                                    make_array_view(&weights, &weights+1));
+
+      return gradient_interpolate(data_values[component], weights.cell_index, weights.unit_position, weights.cell_size);
+    }
+
+
+
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::get_data(const ArrayView<const Point<dim>> &positions,
+                                        const ComponentMask &component_mask,
+                                        std::vector<std::vector<double>> &values) const
+    {
+      Assert(component_mask.represents_n_components(n_components),
+             ExcMessage("The component mask does not match the number of data columns."));
+
+      std::vector<InterpolationWeights> weights(positions.size());
+      compute_interpolation_weights(positions, make_array_view(weights));
+
+      values.resize(n_components);
+      for (unsigned int c=0; c<n_components; ++c)
+        if (component_mask[c])
+          {
+            values[c].resize(positions.size());
+            for (unsigned int q=0; q<positions.size(); ++q)
+              values[c][q] = interpolate(data_values[c], weights[q].cell_index, weights[q].unit_position);
+          }
+    }
+
+
+
+    template <int dim>
+    void
+    StructuredDataLookup<dim>::get_gradients(const ArrayView<const Point<dim>> &positions,
+                                             const ComponentMask &component_mask,
+                                             std::vector<std::vector<Tensor<1,dim>>> &gradients) const
+    {
+      Assert(component_mask.represents_n_components(n_components),
+             ExcMessage("The component mask does not match the number of data columns."));
+
+      std::vector<InterpolationWeights> weights(positions.size());
+      compute_interpolation_weights(positions, make_array_view(weights));
+
+      gradients.resize(n_components);
+      for (unsigned int c=0; c<n_components; ++c)
+        if (component_mask[c])
+          {
+            gradients[c].resize(positions.size());
+            for (unsigned int q=0; q<positions.size(); ++q)
+              gradients[c][q] = gradient_interpolate(data_values[c], weights[q].cell_index,
+                                                     weights[q].unit_position, weights[q].cell_size);
+          }
     }
 
 
@@ -980,7 +1420,11 @@ namespace aspect
       time_weight(numbers::signaling_nan<double>()),
       time_dependent(false),
       lookups(),
-      old_lookups()
+      old_lookups(),
+      read_files_in_background(false),
+      next_lookups(),
+      background_read_active(false),
+      background_file_number(0)
     {}
 
 
@@ -1023,6 +1467,12 @@ namespace aspect
                                                 (n_components,
                                                  this->scale_factor)));
 
+              if (read_files_in_background)
+                next_lookups.insert(std::make_pair(boundary_id,
+                                                   std::make_unique<Utilities::StructuredDataLookup<dim-1>>
+                                                   (n_components,
+                                                    this->scale_factor)));
+
               const int next_file_number =
                 (decreasing_file_order) ?
                 current_file_number - 1
@@ -1168,8 +1618,17 @@ namespace aspect
 
               const bool load_both_files = std::abs(current_file_number - old_file_number) >= 1;
 
+              // If we have read a file in the background, wait for it to be
+              // available. update_data() will use it if it is one of the files
+              // we need, otherwise it is discarded.
+              if (background_read_active)
+                for (const auto &boundary_id : next_lookups)
+                  boundary_id.second->finish_background_load(this->get_mpi_communicator());
+
               for (const auto &boundary_id : lookups)
                 update_data(boundary_id.first, load_both_files);
+
+              background_read_active = false;
             }
 
           time_weight = time_steps_since_start
@@ -1178,7 +1637,67 @@ namespace aspect
           Assert ((0 <= time_weight) && (time_weight <= 1),
                   ExcMessage (
                     "Error in set_current_time. Time_weight has to be in [0,1]"));
+
+          if (read_files_in_background && time_dependent && !background_read_active)
+            start_background_read(model_time);
+        }
+    }
+
+
+
+    template <int dim>
+    void
+    AsciiDataBoundary<dim>::start_background_read (const double model_time)
+    {
+      // At the next switch of data files, the current file number will have
+      // advanced by at least one. If the current time step is large, it
+      // may advance by more than one, which we can predict from the model
+      // time at the end of the current time step. The file we need to read
+      // is the one after the new current file.
+      const int file_steps_at_next_switch =
+        std::max (static_cast<int> ((model_time + this->get_timestep()) / data_file_time_step),
+                  std::abs(current_file_number - first_data_file_number) + 1);
+
+      const int file_number =
+        (decreasing_file_order) ?
+        first_data_file_number - file_steps_at_next_switch - 1
+        :
+        first_data_file_number + file_steps_at_next_switch + 1;
+
+      // Only start reading if the file exists for all boundaries, otherwise
+      // update_data() will take care of ending the time dependence.
+      std::map<types::boundary_id, std::string> filenames;
+      for (const auto &boundary_id : next_lookups)
+        {
+          const std::string filename (create_filename (file_number, boundary_id.first));
+          if (!Utilities::fexists(filename, this->get_mpi_communicator()))
+            return;
+
+          filenames[boundary_id.first] = filename;
         }
+
+      for (const auto &boundary_id : next_lookups)
+        boundary_id.second->start_background_load(filenames[boundary_id.first],
+                                                  this->get_mpi_communicator());
+
+      background_read_active = true;
+      background_file_number = file_number;
+    }
+
+
+
+    template <int dim>
+    void
+    AsciiDataBoundary<dim>::load_data_file (const types::boundary_id boundary_id,
+                                            const int file_number,
+                                            const std::string &filename)
+    {
+      lookups.find(boundary_id)->second.swap(old_lookups.find(boundary_id)->second);
+
+      if (background_read_active && background_file_number == file_number)
+        lookups.find(boundary_id)->second.swap(next_lookups.find(boundary_id)->second);
+      else
+        lookups.find(boundary_id)->second->load_file(filename,this->get_mpi_communicator());
     }
 
     template <int dim>
@@ -1195,10 +1714,7 @@ namespace aspect
           this->get_pcout() << std::endl << "   Loading Ascii data boundary file "
                             << filename << '.' << std::endl << std::endl;
           if (Utilities::fexists(filename, this->get_mpi_communicator()))
-            {
-              lookups.find(boundary_id)->second.swap(old_lookups.find(boundary_id)->second);
-              lookups.find(boundary_id)->second->load_file(filename,this->get_mpi_communicator());
-            }
+            load_data_file(boundary_id, current_file_number, filename);
 
           // If loading current_time_step failed, end time dependent part with old_file_number.
           else
@@ -1216,10 +1732,7 @@ namespace aspect
       this->get_pcout() << std::endl << "   Loading Ascii data boundary file "
                         << filename << '.' << std::endl << std::endl;
       if (Utilities::fexists(filename, this->get_mpi_communicator()))
-        {
-          lookups.find(boundary_id)->second.swap(old_lookups.find(boundary_id)->second);
-          lookups.find(boundary_id)->second->load_file(filename,this->get_mpi_communicator());
-        }
+        load_data_file(boundary_id, next_file_number, filename);
 
       // If next file does not exist, end time dependent part with current_time_step and issue warning.
       else
@@ -1397,6 +1910,43 @@ namespace aspect
     }
 
 
+
+    template <int dim>
+    void
+    AsciiDataBoundary<dim>::
+    get_data_components (const types::boundary_id             boundary_indicator,
+                         const ArrayView<const Point<dim>>   &positions,
+                         const ComponentMask                 &component_mask,
+                         std::vector<std::vector<double>>    &values) const
+    {
+      std::vector<Point<dim-1>> boundary_coordinates (positions.size());
+      for (unsigned int q=0; q<positions.size(); ++q)
+        {
+          const Point<dim> data_coordinates = data_coordinates_from_position(positions[q], this->get_geometry_model());
+          boundary_coordinates[q] = boundary_coordinates_from_data_coordinates(data_coordinates, boundary_indicator);
+        }
+
+      Assert (lookups.find(boundary_indicator) != lookups.end(),
+              ExcInternalError());
+      lookups.find(boundary_indicator)->second->get_data(make_array_view(boundary_coordinates),
+                                                         component_mask,
+                                                         values);
+
+      if (!time_dependent)
+        return;
+
+      std::vector<std::vector<double>> old_values;
+      old_lookups.find(boundary_indicator)->second->get_data(make_array_view(boundary_coordinates),
+                                                             component_mask,
+                                                             old_values);
+
+      for (unsigned int c=0; c<values.size(); ++c)
+        if (component_mask[c])
+          for (unsigned int q=0; q<positions.size(); ++q)
+            values[c][q] = time_weight * values[c][q] + (1 - time_weight) * old_values[c][q];
+    }
+
+
     template <int dim>
     Tensor<1,dim-1>
     AsciiDataBoundary<dim>::vector_gradient (const types::boundary_id             boundary_indicator,
@@ -1473,6 +2023,15 @@ namespace aspect
                                "`True' the plugin will first load the file with the number "
                                "`First data file number' and decrease the file number during "
                                "the model run.");
+            prm.declare_entry ("Read data files in background", "false",
+                               Patterns::Bool (),
+                               "Whether to read the data file that will be needed next "
+                               "in a background thread while the model continues. The "
+                               "file is chosen based on the current model time and time "
+                               "step size, so that when the model time reaches the next "
+                               "data file, the data are usually already available and "
+                               "loading them does not stall the computation. This "
+                               "requires memory for one additional data file per boundary.");
           }
         else
           {
@@ -1513,6 +2072,7 @@ namespace aspect
 
             first_data_file_number          = prm.get_integer("First data file number");
             decreasing_file_order           = prm.get_bool   ("Decreasing file order");
+            read_files_in_background        = prm.get_bool   ("Read data files in background");
 
             if (this->convert_output_to_years() == true)
               {
@@ -1694,11 +2254,81 @@ namespace aspect
     template <int dim>
     AsciiDataInitial<dim>::AsciiDataInitial ()
       : slice_data(false),
+        restrict_data_to_model_domain(false),
         rotation_matrix()
     {}
 
 
 
+    namespace
+    {
+      /**
+       * Compute the bounding box of the domain described by @p geometry_model
+       * in the coordinates used by data_coordinates_from_position(), and store
+       * it in @p bounding_box. The box is only restricted in the horizontal
+       * coordinate directions, and extends infinitely in the vertical
+       * direction so that it also contains points displaced by topography.
+       * Return whether the bounding box could be computed, which is only
+       * the case for box and chunk geometries.
+       */
+      template <int dim>
+      bool
+      horizontal_data_coordinates_bounding_box (const GeometryModel::Interface<dim> &geometry_model,
+                                                BoundingBox<dim>                    &bounding_box)
+      {
+        Point<dim> lower_corner;
+        Point<dim> upper_corner;
+
+        if (Plugins::plugin_type_matches<const GeometryModel::Box<dim>> (geometry_model))
+          {
+            const auto &box = Plugins::get_plugin_as_type<const GeometryModel::Box<dim>> (geometry_model);
+            lower_corner = box.get_origin();
+            upper_corner = box.get_origin() + box.get_extents();
+
+            lower_corner[dim-1] = -std::numeric_limits<double>::infinity();
+            upper_corner[dim-1] = std::numeric_limits<double>::infinity();
+          }
+        else if (Plugins::plugin_type_matches<const GeometryModel::Chunk<dim>> (geometry_model))
+          {
+            const auto &chunk = Plugins::get_plugin_as_type<const GeometryModel::Chunk<dim>> (geometry_model);
+
+            // The radius is the vertical coordinate.
+            lower_corner[0] = -std::numeric_limits<double>::infinity();
+            upper_corner[0] = std::numeric_limits<double>::infinity();
+
+            // Data coordinates use longitudes in the range 0...2*pi. If
+            // the chunk crosses the zero meridian, its longitudes are not
+            // contiguous in this range, and we need to load all of them.
+            const double west = (chunk.west_longitude() < 0 ? chunk.west_longitude() + 2*numbers::PI : chunk.west_longitude());
+            const double east = (chunk.east_longitude() < 0 ? chunk.east_longitude() + 2*numbers::PI : chunk.east_longitude());
+            if (west <= east)
+              {
+                lower_corner[1] = west;
+                upper_corner[1] = east;
+              }
+            else
+              {
+                lower_corner[1] = -std::numeric_limits<double>::infinity();
+                upper_corner[1] = std::numeric_limits<double>::infinity();
+              }
+
+            // Data coordinates use colatitude instead of latitude.
+            if (dim == 3)
+              {
+                lower_corner[dim-1] = numbers::PI/2. - chunk.north_latitude();
+                upper_corner[dim-1] = numbers::PI/2. - chunk.south_latitude();
+              }
+          }
+        else
+          return false;
+
+        bounding_box = BoundingBox<dim>(std::make_pair(lower_corner, upper_corner));
+        return true;
+      }
+    }
+
+
+
     template <int dim>
     void
     AsciiDataInitial<dim>::initialize (const unsigned int n_components)
@@ -1726,6 +2356,12 @@ namespace aspect
         {
           lookup = std::make_unique<Utilities::StructuredDataLookup<dim>> (n_components,
                                                                             this->scale_factor);
+
+          BoundingBox<dim> model_domain;
+          if (restrict_data_to_model_domain &&
+              horizontal_data_coordinates_bounding_box(this->get_geometry_model(), model_domain))
+            lookup->restrict_to_region(model_domain);
+
           lookup->load_file(filename, this->get_mpi_communicator());
         }
     }
@@ -1762,6 +2398,42 @@ namespace aspect
 
 
 
+    template <int dim>
+    void
+    AsciiDataInitial<dim>::
+    get_data_components (const ArrayView<const Point<dim>> &positions,
+                         const ComponentMask               &component_mask,
+                         std::vector<std::vector<double>>  &values) const
+    {
+      // Handle the special case of slicing through data first, see
+      // get_data_component()
+      if (slice_data == true)
+        {
+          std::vector<Point<3>> data_coordinates (positions.size());
+          for (unsigned int q=0; q<positions.size(); ++q)
+            {
+              const Tensor<1,3> position_tensor({positions[q][0], positions[q][1], 0.0});
+              const Point<3> rotated_position (rotation_matrix * position_tensor);
+
+              const std::array<double,3> spherical_position =
+                Utilities::Coordinates::cartesian_to_spherical_coordinates(rotated_position);
+
+              data_coordinates[q] = Point<3>(Tensor<1,3>(ArrayView<const double>(spherical_position)));
+            }
+
+          slice_lookup->get_data(make_array_view(data_coordinates), component_mask, values);
+          return;
+        }
+
+      std::vector<Point<dim>> data_coordinates (positions.size());
+      for (unsigned int q=0; q<positions.size(); ++q)
+        data_coordinates[q] = data_coordinates_from_position(positions[q], this->get_geometry_model());
+
+      lookup->get_data(make_array_view(data_coordinates), component_mask, values);
+    }
+
+
+
     template <int dim>
     void
     AsciiDataInitial<dim>::declare_parameters (ParameterHandler  &prm,
@@ -1776,6 +2448,17 @@ namespace aspect
 
       prm.enter_subsection (subsection_name);
       {
+        prm.declare_entry("Restrict data to model domain", "false",
+                          Patterns::Bool (),
+                          "Whether to only load the part of the data file that "
+                          "covers the horizontal extent of the model domain (plus "
+                          "a halo of two data points in each direction), instead "
+                          "of the whole data file. This reduces the time to load the "
+                          "data and the memory required to store it if a model only covers "
+                          "a small part of a large (e.g., global) dataset. This option "
+                          "is only supported for data in NetCDF files, and for box and "
+                          "chunk geometries. For other geometries or file formats, "
+                          "the whole data file is loaded.");
         prm.declare_entry("Slice dataset in 2D plane", "false",
                           Patterns::Bool (),
                           "Whether to use a 2d data slice of a 3d data file "
@@ -1814,6 +2497,7 @@ namespace aspect
 
       prm.enter_subsection(subsection_name);
       {
+        restrict_data_to_model_domain = prm.get_bool ("Restrict data to model domain");
         slice_data = prm.get_bool ("Slice dataset in 2D plane");
         if (slice_data == true)
           {
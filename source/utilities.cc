@@ -1393,61 +1393,47 @@ namespace aspect
 
 
     std::string
-    read_and_distribute_file_content(const std::string &filename,
-                                     const MPI_Comm comm)
+    read_file_content(const std::string &filename)
     {
       std::string data_string;
 
-      if (Utilities::MPI::this_mpi_process(comm) == 0)
+      // Check to see if the prm file will be reading data from disk or
+      // from a provided URL
+      if (filename_is_url(filename))
         {
-          std::size_t filesize;
-
-          // Check to see if the prm file will be reading data from disk or
-          // from a provided URL
-          if (filename_is_url(filename))
-            {
 #ifdef ASPECT_WITH_LIBDAP
-              std::unique_ptr<libdap::Connect> url
-                = std::make_unique<libdap::Connect>(filename);
-              libdap::BaseTypeFactory factory;
-              libdap::DataDDS dds(&factory);
-              libdap::DAS das;
+          std::unique_ptr<libdap::Connect> url
+            = std::make_unique<libdap::Connect>(filename);
+          libdap::BaseTypeFactory factory;
+          libdap::DataDDS dds(&factory);
+          libdap::DAS das;
 
-              url->request_data(dds, "");
-              url->request_das(das);
+          url->request_data(dds, "");
+          url->request_das(das);
 
 
-              // Temporary vector that will hold the different arrays stored in urlArray
-              std::vector<libdap::dods_float32> tmp;
-              // Vector that will hold the arrays (columns) and the values within those arrays
-              std::vector<std::vector<libdap::dods_float32>> columns;
+          // Temporary vector that will hold the different arrays stored in urlArray
+          std::vector<libdap::dods_float32> tmp;
+          // Vector that will hold the arrays (columns) and the values within those arrays
+          std::vector<std::vector<libdap::dods_float32>> columns;
 
-              // Check dds values to make sure the arrays are of the same length and of type string
-              for (libdap::DDS::Vars_iter i = dds.var_begin(); i != dds.var_end(); ++i)
+          // Check dds values to make sure the arrays are of the same length and of type string
+          for (libdap::DDS::Vars_iter i = dds.var_begin(); i != dds.var_end(); ++i)
+            {
+              libdap::BaseType *btp = *i;
+              if ((*i)->type() == libdap::dods_array_c)
                 {
-                  libdap::BaseType *btp = *i;
-                  if ((*i)->type() == libdap::dods_array_c)
+                  // Array to store the url data
+                  libdap::Array *urlArray;
+                  urlArray = static_cast <libdap::Array *>(btp);
+                  if (urlArray->var() != nullptr && urlArray->var()->type() == libdap::dods_float32_c)
                     {
-                      // Array to store the url data
-                      libdap::Array *urlArray;
-                      urlArray = static_cast <libdap::Array *>(btp);
-                      if (urlArray->var() != nullptr && urlArray->var()->type() == libdap::dods_float32_c)
-                        {
-                          tmp.resize(urlArray->length());
-
-                          // The url Array contains a separate array for each column of data.
-                          // This will put each of these individual arrays into its own vector.
-                          urlArray->value(&tmp[0]);
-                          columns.push_back(tmp);
-                        }
-                      else
-                        {
-                          AssertThrow (false,
-                                       ExcMessage (std::string("Error when reading from url: ") + filename +
-                                                   " Check your connection to the server and make sure the server "
-                                                   "delivers correct data."));
-                        }
+                      tmp.resize(urlArray->length());
 
+                      // The url Array contains a separate array for each column of data.
+                      // This will put each of these individual arrays into its own vector.
+                      urlArray->value(&tmp[0]);
+                      columns.push_back(tmp);
                     }
                   else
                     {
@@ -1456,109 +1442,127 @@ namespace aspect
                                                " Check your connection to the server and make sure the server "
                                                "delivers correct data."));
                     }
-                }
 
-              // Add the POINTS data that is required and found at the top of the data file.
-              // The POINTS values are set as attributes inside a table.
-              // Loop through the Attribute table to locate the points values within
-              std::vector<std::string> points;
-              for (libdap::AttrTable::Attr_iter i = das.var_begin(); i != das.var_end(); ++i)
+                }
+              else
                 {
-                  libdap::AttrTable *table = das.get_table(i);
-                  if (table->get_attr("POINTS") != "")
-                    points.push_back(table->get_attr("POINTS"));
-                  if (table->get_attr("points") != "")
-                    points.push_back(table->get_attr("points"));
+                  AssertThrow (false,
+                               ExcMessage (std::string("Error when reading from url: ") + filename +
+                                           " Check your connection to the server and make sure the server "
+                                           "delivers correct data."));
                 }
+            }
 
-              std::stringstream urlString;
+          // Add the POINTS data that is required and found at the top of the data file.
+          // The POINTS values are set as attributes inside a table.
+          // Loop through the Attribute table to locate the points values within
+          std::vector<std::string> points;
+          for (libdap::AttrTable::Attr_iter i = das.var_begin(); i != das.var_end(); ++i)
+            {
+              libdap::AttrTable *table = das.get_table(i);
+              if (table->get_attr("POINTS") != "")
+                points.push_back(table->get_attr("POINTS"));
+              if (table->get_attr("points") != "")
+                points.push_back(table->get_attr("points"));
+            }
 
-              // Append the gathered POINTS in the proper format:
-              // "# POINTS: <val1> <val2> <val3>"
-              urlString << "# POINTS:";
-              for (unsigned int i = 0; i < points.size(); ++i)
-                {
-                  urlString << ' ' << points[i];
-                }
-              urlString << "\n";
+          std::stringstream urlString;
 
-              // Add the values from the arrays into the stringstream. The values are passed in
-              // per row with a character return added at the end of each row.
-              // TODO: Add a check to make sure that each column is the same size before writing
-              //     to the stringstream
-              for (unsigned int i = 0; i < tmp.size(); ++i)
+          // Append the gathered POINTS in the proper format:
+          // "# POINTS: <val1> <val2> <val3>"
+          urlString << "# POINTS:";
+          for (unsigned int i = 0; i < points.size(); ++i)
+            {
+              urlString << ' ' << points[i];
+            }
+          urlString << "\n";
+
+          // Add the values from the arrays into the stringstream. The values are passed in
+          // per row with a character return added at the end of each row.
+          // TODO: Add a check to make sure that each column is the same size before writing
+          //     to the stringstream
+          for (unsigned int i = 0; i < tmp.size(); ++i)
+            {
+              for (unsigned int j = 0; j < columns.size(); ++j)
                 {
-                  for (unsigned int j = 0; j < columns.size(); ++j)
-                    {
-                      urlString << columns[j][i];
-                      urlString << ' ';
-                    }
-                  urlString << "\n";
+                  urlString << columns[j][i];
+                  urlString << ' ';
                 }
+              urlString << "\n";
+            }
 
-              data_string = urlString.str();
-              filesize = data_string.size();
+          data_string = urlString.str();
 
 #else // ASPECT_WITH_LIBDAP
 
-              // Broadcast failure state, then throw. We signal the failure by
-              // setting the file size to an invalid size, then trigger an assert.
-              {
-                std::size_t invalid_filesize = numbers::invalid_size_type;
-                const int ierr = MPI_Bcast(&invalid_filesize, 1, Utilities::internal::MPI::mpi_type_id(&filesize), 0, comm);
-                AssertThrowMPI(ierr);
-              }
-              AssertThrow(false,
-                          ExcMessage(std::string("Reading of file ") + filename + " failed. " +
-                                     "Make sure you have the dependencies for reading a url " +
-                                     "(run cmake with -DASPECT_WITH_LIBDAP=ON)"));
+          AssertThrow(false,
+                      ExcMessage(std::string("Reading of file ") + filename + " failed. " +
+                                 "Make sure you have the dependencies for reading a url " +
+                                 "(run cmake with -DASPECT_WITH_LIBDAP=ON)"));
 
 #endif // ASPECT_WITH_LIBDAP
-            }
+        }
+      else
+        {
+          std::ifstream filestream;
+          const bool filename_ends_in_gz = std::regex_search(filename, std::regex("\\.gz$"));
+          if (filename_ends_in_gz == true)
+            filestream.open(filename, std::ios_base::in | std::ios_base::binary);
           else
+            filestream.open(filename);
+
+          AssertThrow (filestream,
+                       ExcMessage (std::string("Could not open file <") + filename + ">."));
+
+          // Read data from disk
+          std::stringstream datastream;
+
+          try
             {
-              std::ifstream filestream;
-              const bool filename_ends_in_gz = std::regex_search(filename, std::regex("\\.gz$"));
+              boost::iostreams::filtering_istreambuf in;
               if (filename_ends_in_gz == true)
-                filestream.open(filename, std::ios_base::in | std::ios_base::binary);
-              else
-                filestream.open(filename);
+                in.push(boost::iostreams::gzip_decompressor());
 
-              if (!filestream)
-                {
-                  // broadcast failure state, then throw
-                  std::size_t invalid_filesize = numbers::invalid_size_type;
-                  const int ierr = MPI_Bcast(&invalid_filesize, 1, Utilities::internal::MPI::mpi_type_id(&filesize), 0, comm);
-                  AssertThrowMPI(ierr);
-                  AssertThrow (false,
-                               ExcMessage (std::string("Could not open file <") + filename + ">."));
-                }
+              in.push(filestream);
+              boost::iostreams::copy(in, datastream);
+            }
+          catch (const std::ios::failure &)
+            {
+              AssertThrow (false,
+                           ExcMessage (std::string("Could not read file content from <") + filename + ">."));
+            }
 
-              // Read data from disk
-              std::stringstream datastream;
+          data_string = datastream.str();
+        }
 
-              try
-                {
-                  boost::iostreams::filtering_istreambuf in;
-                  if (filename_ends_in_gz == true)
-                    in.push(boost::iostreams::gzip_decompressor());
+      return data_string;
+    }
 
-                  in.push(filestream);
-                  boost::iostreams::copy(in, datastream);
-                }
-              catch (const std::ios::failure &)
-                {
-                  // broadcast failure state, then throw
-                  std::size_t invalid_filesize = numbers::invalid_size_type;
-                  const int ierr = MPI_Bcast(&invalid_filesize, 1, Utilities::internal::MPI::mpi_type_id(&filesize), 0, comm);
-                  AssertThrowMPI(ierr);
-                  AssertThrow (false,
-                               ExcMessage (std::string("Could not read file content from <") + filename + ">."));
-                }
 
-              data_string = datastream.str();
-              filesize = data_string.size();
+
+    std::string
+    read_and_distribute_file_content(const std::string &filename,
+                                     const MPI_Comm comm)
+    {
+      std::string data_string;
+
+      if (Utilities::MPI::this_mpi_process(comm) == 0)
+        {
+          try
+            {
+              data_string = read_file_content(filename);
             }
+          catch (...)
+            {
+              // broadcast failure state, then rethrow. We signal the failure by
+              // setting the file size to an invalid size.
+              std::size_t invalid_filesize = numbers::invalid_size_type;
+              const int ierr = MPI_Bcast(&invalid_filesize, 1, Utilities::internal::MPI::mpi_type_id(&invalid_filesize), 0, comm);
+              AssertThrowMPI(ierr);
+              throw;
+            }
+
+          std::size_t filesize = data_string.size();
 
           // Distribute data_size and data across processes
           int ierr = MPI_Bcast(&filesize, 1, Utilities::internal::MPI::mpi_type_id(&filesize), 0, comm);
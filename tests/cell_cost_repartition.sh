@@ -0,0 +1,18 @@
+#!/usr/bin/env perl
+
+# Only keep the lines of the screen output that do not depend on the
+# partition of the mesh, which is based on measured wall times.
+
+$filename=$ARGV[0];
+while(<STDIN>)
+{
+    if ($filename eq "screen-output")
+    {
+	next unless (m/^Number of active cells/
+		     || m/^Number of degrees of freedom/
+		     || m/^\*\*\* Timestep/
+		     || m/Number of advected particles/
+		     || m/^Termination requested/);
+    }
+    print $_;
+}
@@ -0,0 +1,138 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include <aspect/postprocess/interface.h>
+#include <aspect/simulator_access.h>
+#include <aspect/particle/manager.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <map>
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    /**
+     * Compare the grain volume fractions and rotation matrices of the
+     * first particle system, which uses the interleaved grain data layout,
+     * with those of the second particle system, which uses the grain
+     * contiguous layout. Both systems contain the same particles.
+     */
+    template <int dim>
+    class CompareGrainDataLayouts : public Interface<dim>, public ::aspect::SimulatorAccess<dim>
+    {
+      public:
+        std::pair<std::string,std::string>
+        execute (TableHandler &) override;
+
+      private:
+        /**
+         * Return the grain data of all particles of the given particle
+         * system, ordered by the names of the grain properties.
+         */
+        std::map<types::particle_index, std::vector<double>>
+        get_grain_data (const unsigned int particle_manager_index) const;
+    };
+  }
+}
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    template <int dim>
+    std::map<types::particle_index, std::vector<double>>
+    CompareGrainDataLayouts<dim>::get_grain_data (const unsigned int particle_manager_index) const
+    {
+      const unsigned int n_minerals = 2;
+      const unsigned int n_grains = 5;
+
+      const Particle::Manager<dim> &particle_manager = this->get_particle_manager(particle_manager_index);
+      const auto &data_info = particle_manager.get_property_manager().get_data_info();
+
+      std::vector<unsigned int> grain_data_positions;
+      for (unsigned int mineral_i = 0; mineral_i < n_minerals; ++mineral_i)
+        for (unsigned int grain_i = 0; grain_i < n_grains; ++grain_i)
+          {
+            const std::string grain_name = "cpo mineral " + std::to_string(mineral_i) + " grain " + std::to_string(grain_i);
+            grain_data_positions.push_back(data_info.get_position_by_field_name(grain_name + " volume fraction"));
+            for (unsigned int index = 0; index < Tensor<2,3>::n_independent_components; ++index)
+              grain_data_positions.push_back(data_info.get_position_by_field_name(grain_name + " rotation_matrix " + std::to_string(index)));
+          }
+
+      std::map<types::particle_index, std::vector<double>> grain_data;
+      for (const auto &particle : particle_manager.get_particle_handler())
+        {
+          std::vector<double> &values = grain_data[particle.get_id()];
+          for (const unsigned int position : grain_data_positions)
+            values.push_back(particle.get_properties()[position]);
+        }
+
+      return grain_data;
+    }
+
+
+
+    template <int dim>
+    std::pair<std::string,std::string>
+    CompareGrainDataLayouts<dim>::execute (TableHandler &)
+    {
+      const std::map<types::particle_index, std::vector<double>> interleaved = get_grain_data(0);
+      const std::map<types::particle_index, std::vector<double>> grain_contiguous = get_grain_data(1);
+
+      bool data_agrees = (interleaved.size() == grain_contiguous.size());
+      for (const auto &particle : interleaved)
+        {
+          const auto other_particle = grain_contiguous.find(particle.first);
+          if (other_particle == grain_contiguous.end())
+            {
+              data_agrees = false;
+              break;
+            }
+
+          for (unsigned int i = 0; i < particle.second.size(); ++i)
+            if (std::abs(particle.second[i] - other_particle->second[i]) > 1e-10)
+              data_agrees = false;
+        }
+
+      data_agrees = (Utilities::MPI::min(data_agrees ? 1 : 0, this->get_mpi_communicator()) == 1);
+
+      return std::make_pair("Grain data of both layouts agrees within 1e-10:",
+                            data_agrees ? "yes" : "no");
+    }
+  }
+}
+
+
+// explicit instantiations
+namespace aspect
+{
+  namespace Postprocess
+  {
+    ASPECT_REGISTER_POSTPROCESSOR(CompareGrainDataLayouts,
+                                  "compare grain data layouts",
+                                  "A postprocessor that checks that the crystal "
+                                  "preferred orientation of two particle systems "
+                                  "with different grain data layouts agrees.")
+  }
+}
@@ -0,0 +1,18 @@
+#!/usr/bin/env perl
+
+# Only keep the result of the comparison of the two grain data layouts,
+# and only print it again if it changes from one time step to the next.
+
+$filename=$ARGV[0];
+$last_line="";
+while(<STDIN>)
+{
+    if ($filename eq "screen-output")
+    {
+	next unless (m/Grain data of both layouts/
+		     || m/^Termination requested/);
+	next if ($_ eq $last_line);
+	$last_line=$_;
+    }
+    print $_;
+}
@@ -0,0 +1,96 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include <aspect/postprocess/interface.h>
+#include <aspect/simulator_access.h>
+#include <aspect/particle/manager.h>
+
+#include <deal.II/base/mpi.h>
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    /**
+     * Compare the location of every particle with its exact location
+     * for a rigid rotation around (0.5,0.5) with an angular velocity
+     * of 1, starting from the position stored in the 'initial position'
+     * property.
+     */
+    template <int dim>
+    class RotationParticleError : public Interface<dim>, public ::aspect::SimulatorAccess<dim>
+    {
+      public:
+        std::pair<std::string,std::string>
+        execute (TableHandler &) override;
+    };
+  }
+}
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    template <int dim>
+    std::pair<std::string,std::string>
+    RotationParticleError<dim>::execute(TableHandler &)
+    {
+      const Particle::Manager<dim> &particle_manager = this->get_particle_manager(0);
+      const unsigned int initial_position_index =
+        particle_manager.get_property_manager().get_data_info().get_position_by_field_name("initial position");
+
+      const double angle = this->get_time();
+
+      double max_error = 0.;
+      for (const auto &particle : particle_manager.get_particle_handler())
+        {
+          const ArrayView<const double> properties = particle.get_properties();
+          const double x = properties[initial_position_index] - 0.5;
+          const double y = properties[initial_position_index+1] - 0.5;
+
+          Point<dim> exact_location = particle.get_location();
+          exact_location[0] = 0.5 + std::cos(angle) * x - std::sin(angle) * y;
+          exact_location[1] = 0.5 + std::sin(angle) * x + std::cos(angle) * y;
+
+          max_error = std::max(max_error, particle.get_location().distance(exact_location));
+        }
+
+      max_error = Utilities::MPI::max(max_error, this->get_mpi_communicator());
+
+      return std::make_pair("Particle position error below 5e-4:",
+                            max_error < 5e-4 ? "yes" : "no");
+    }
+  }
+}
+
+
+// explicit instantiations
+namespace aspect
+{
+  namespace Postprocess
+  {
+    ASPECT_REGISTER_POSTPROCESSOR(RotationParticleError,
+                                  "rotation particle error",
+                                  "A postprocessor that checks that the particles "
+                                  "follow the exact paths of a rigid rotation.")
+  }
+}
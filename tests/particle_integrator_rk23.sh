@@ -0,0 +1,18 @@
+#!/usr/bin/env perl
+
+# Only keep the lines of the screen output that report the time steps
+# and the comparison with the exact particle paths.
+
+$filename=$ARGV[0];
+while(<STDIN>)
+{
+    if ($filename eq "screen-output")
+    {
+	next unless (m/^Number of active cells/
+		     || m/^Number of degrees of freedom/
+		     || m/^\*\*\* Timestep/
+		     || m/Particle position error/
+		     || m/^Termination requested/);
+    }
+    print $_;
+}
@@ -0,0 +1,78 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include <aspect/postprocess/interface.h>
+#include <aspect/simulator_access.h>
+#include <aspect/particle/manager.h>
+
+#include <deal.II/base/mpi.h>
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    /**
+     * Report whether any process stores ghost particles.
+     */
+    template <int dim>
+    class GhostParticles : public Interface<dim>, public ::aspect::SimulatorAccess<dim>
+    {
+      public:
+        std::pair<std::string,std::string>
+        execute (TableHandler &) override;
+    };
+  }
+}
+
+
+namespace aspect
+{
+  namespace Postprocess
+  {
+    template <int dim>
+    std::pair<std::string,std::string>
+    GhostParticles<dim>::execute (TableHandler &)
+    {
+      const auto &particle_handler = this->get_particle_manager(0).get_particle_handler();
+
+      const std::size_t n_ghost_particles =
+        Utilities::MPI::sum(static_cast<std::size_t>(std::distance(particle_handler.begin_ghost(),
+                                                                   particle_handler.end_ghost())),
+                            this->get_mpi_communicator());
+
+      return std::make_pair("Ghost particles exist on any process:",
+                            n_ghost_particles > 0 ? "yes" : "no");
+    }
+  }
+}
+
+
+// explicit instantiations
+namespace aspect
+{
+  namespace Postprocess
+  {
+    ASPECT_REGISTER_POSTPROCESSOR(GhostParticles,
+                                  "ghost particles",
+                                  "A postprocessor that reports whether any process "
+                                  "stores ghost particles.")
+  }
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env perl
+
+# Only keep the result of the ghost particle check, and only print it
+# again if it changes from one time step to the next. The padding after
+# the name of the check depends on the names of the other postprocessors,
+# so it is reduced to a single space.
+
+$filename=$ARGV[0];
+$last_line="";
+while(<STDIN>)
+{
+    if ($filename eq "screen-output")
+    {
+	next unless (m/Ghost particles exist/
+		     || m/^Termination requested/);
+	s/:\s+(yes|no)$/: $1/;
+	next if ($_ eq $last_line);
+	$last_line=$_;
+    }
+    print $_;
+}
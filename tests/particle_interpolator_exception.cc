@@ -0,0 +1,68 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include <aspect/particle/interpolator/cell_average.h>
+
+
+namespace aspect
+{
+  namespace Particle
+  {
+    namespace Interpolator
+    {
+      /**
+       * An interpolator that fails for every cell.
+       */
+      template <int dim>
+      class AlwaysFails : public CellAverage<dim>
+      {
+        public:
+          std::vector<std::vector<double>>
+          properties_at_points(const ParticleHandler<dim> &,
+                               const std::vector<Point<dim>> &,
+                               const ComponentMask &,
+                               const typename parallel::distributed::Triangulation<dim>::active_cell_iterator &) const override
+          {
+            AssertThrow(false, ExcMessage("The test interpolator always fails."));
+            return {};
+          }
+
+          // avoid -Woverloaded-virtual:
+          using Interface<dim>::properties_at_points;
+      };
+    }
+  }
+}
+
+
+// explicit instantiations
+namespace aspect
+{
+  namespace Particle
+  {
+    namespace Interpolator
+    {
+      ASPECT_REGISTER_PARTICLE_INTERPOLATOR(AlwaysFails,
+                                            "always fails",
+                                            "An interpolator that throws an exception "
+                                            "for every cell.")
+    }
+  }
+}
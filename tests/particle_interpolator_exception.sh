@@ -0,0 +1,19 @@
+#!/usr/bin/env perl
+
+# Only keep the error message of the interpolator and the lines around it
+# that are printed before the program is aborted. The message that the
+# MPI library prints when it aborts the program differs between MPI
+# implementations.
+
+$filename=$ARGV[0];
+while(<STDIN>)
+{
+    if ($filename eq "screen-output")
+    {
+	next unless (m/^Exception on MPI process/
+		     || m/The test interpolator always fails/
+		     || m/^Aborting!/);
+	s/\s+$/\n/;
+    }
+    print $_;
+}
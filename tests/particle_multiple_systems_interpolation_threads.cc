@@ -0,0 +1,37 @@
+/*
+  Copyright (C) 2026 by the authors of the ASPECT code.
+
+  This file is part of ASPECT.
+
+  ASPECT is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2, or (at your option)
+  any later version.
+
+  ASPECT is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with ASPECT; see the file LICENSE.  If not see
+  <http://www.gnu.org/licenses/>.
+*/
+
+#include <aspect/simulator_signals.h>
+
+#include <deal.II/base/multithread_info.h>
+
+
+// The test suite runs ASPECT without the '-j' flag, which limits it to a
+// single thread. Allow two threads instead, so that the cells are
+// distributed to several threads when the particle properties are
+// interpolated onto the compositional fields.
+template <int dim>
+void signal_connector (aspect::SimulatorSignals<dim> &)
+{
+  dealii::MultithreadInfo::set_thread_limit(2);
+}
+
+ASPECT_REGISTER_SIGNALS_CONNECTOR(signal_connector<2>,
+                                  signal_connector<3>)
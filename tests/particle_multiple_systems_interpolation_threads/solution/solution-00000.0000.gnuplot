@@ -0,0 +1,59 @@
+# This file was generated by the deal.II library.
+# Date =  2024/10/4
+# Time =  11:32:46
+#
+# For a description of the GNUPLOT format see the GNUPLOT manual.
+#
+# <x> <y> <velocity> <velocity> <p> <T> <anomaly> <function> 
+0 0 0 0 10065.9 0 0.22855 0.499914 
+0.22855 0 0 0 10057.2 0 0.22855 0.499914 
+0.4571 0 0 0 10048.5 0 0.68565 0.498829 
+
+0 0.25 0 -0.00289142 7545.58 0 0.22855 0.499914 
+0.22855 0.25 0.0038007 -0.00233646 7541.23 0 0.22855 0.499914 
+0.4571 0.25 0.00402964 0.00129196 7536.89 0 0.68565 0.498829 
+
+0 0.5 0 -0.00505316 5025.24 0 0.22855 0 
+0.22855 0.5 5.18286e-18 -0.00338219 5025.24 0 0.22855 0 
+0.4571 0.5 3.26626e-19 0.00167668 5025.24 0 0.68565 0 
+
+
+0.4571 0 0 0 10048.5 0 0.68565 0.498829 
+0.68565 0 0 0 10043.7 0 0.68565 0.498829 
+0.9142 0 0 0 10038.9 0 0.68565 0.498829 
+
+0.4571 0.25 0.00402964 0.00129196 7536.89 0 0.68565 0.498829 
+0.68565 0.25 0.00252913 0.00207449 7534.49 0 0.68565 0.498829 
+0.9142 0.25 0 0.00135537 7532.09 0 0.68565 0.498829 
+
+0.4571 0.5 3.26626e-19 0.00167668 5025.24 0 0.68565 0 
+0.68565 0.5 -6.3755e-19 0.00314919 5025.24 0 0.68565 0 
+0.9142 0.5 0 0.00263181 5025.24 0 0.68565 0 
+
+
+0 0.5 0 -0.00505316 5025.24 0 0.22855 0 
+0.22855 0.5 5.18286e-18 -0.00338219 5025.24 0 0.22855 0 
+0.4571 0.5 3.26626e-19 0.00167668 5025.24 0 0.68565 0 
+
+0 0.75 0 -0.00289142 2504.9 0 0.22855 0 
+0.22855 0.75 -0.0038007 -0.00233646 2509.25 0 0.22855 0 
+0.4571 0.75 -0.00402964 0.00129196 2513.59 0 0.68565 0 
+
+0 1 0 0 -15.4369 0 0.22855 0 
+0.22855 1 0 0 -6.745 0 0.22855 0 
+0.4571 1 0 0 1.94688 0 0.68565 0 
+
+
+0.4571 0.5 3.26626e-19 0.00167668 5025.24 0 0.68565 0 
+0.68565 0.5 -6.3755e-19 0.00314919 5025.24 0 0.68565 0 
+0.9142 0.5 0 0.00263181 5025.24 0 0.68565 0 
+
+0.4571 0.75 -0.00402964 0.00129196 2513.59 0 0.68565 0 
+0.68565 0.75 -0.00252913 0.00207449 2515.99 0 0.68565 0 
+0.9142 0.75 0 0.00135537 2518.39 0 0.68565 0 
+
+0.4571 1 0 0 1.94688 0 0.68565 0 
+0.68565 1 0 0 6.745 0 0.68565 0 
+0.9142 1 0 0 11.5431 0 0.68565 0 
+
+
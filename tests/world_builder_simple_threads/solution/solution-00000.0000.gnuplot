@@ -0,0 +1,7175 @@
+# This file was generated by the deal.II library.
+
+
+#
+# For a description of the GNUPLOT format see the GNUPLOT manual.
+#
+# <x> <y> <velocity> <velocity> <p> <T> <C_1> <adiabatic_temperature> <adiabatic_pressure> <adiabatic_density> <adiabatic_density_derivative> 
+0 0 0 0 6.6847e+08 1640.89 0 1613 6.6e+08 3300 0 
+46875 0 -1.09326e-12 0 6.68471e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+0 6250 0 1.27015e-13 6.47856e+08 1638.45 0 1613 6.39375e+08 3300 0 
+46875 6250 -1.08571e-12 1.78114e-13 6.47856e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+46875 0 -1.09326e-12 0 6.68471e+08 1640.89 0 1613 6.6e+08 3300 0 
+93750 0 -2.75522e-12 0 6.6848e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+46875 6250 -1.08571e-12 1.78114e-13 6.47856e+08 1638.45 0 1613 6.39375e+08 3300 0 
+93750 6250 -2.74407e-12 2.59185e-13 6.47866e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+0 6250 0 1.27015e-13 6.47856e+08 1638.45 0 1613 6.39375e+08 3300 0 
+46875 6250 -1.08571e-12 1.78114e-13 6.47856e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+0 12500 0 2.51724e-13 6.27241e+08 1636.02 0 1613 6.1875e+08 3300 0 
+46875 12500 -1.06307e-12 3.54701e-13 6.27241e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+46875 6250 -1.08571e-12 1.78114e-13 6.47856e+08 1638.45 0 1613 6.39375e+08 3300 0 
+93750 6250 -2.74407e-12 2.59185e-13 6.47866e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+46875 12500 -1.06307e-12 3.54701e-13 6.27241e+08 1636.02 0 1613 6.1875e+08 3300 0 
+93750 12500 -2.71064e-12 5.17868e-13 6.2725e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+93750 0 -2.75522e-12 0 6.6848e+08 1640.89 0 1613 6.6e+08 3300 0 
+140625 0 -4.77137e-12 0 6.68508e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+93750 6250 -2.74407e-12 2.59185e-13 6.47866e+08 1638.45 0 1613 6.39375e+08 3300 0 
+140625 6250 -4.75861e-12 2.61372e-13 6.47894e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+140625 0 -4.77137e-12 0 6.68508e+08 1640.89 0 1613 6.6e+08 3300 0 
+187500 0 -6.43947e-12 0 6.68556e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+140625 6250 -4.75861e-12 2.61372e-13 6.47894e+08 1638.45 0 1613 6.39375e+08 3300 0 
+187500 6250 -6.42409e-12 1.72777e-13 6.47942e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+93750 6250 -2.74407e-12 2.59185e-13 6.47866e+08 1638.45 0 1613 6.39375e+08 3300 0 
+140625 6250 -4.75861e-12 2.61372e-13 6.47894e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+93750 12500 -2.71064e-12 5.17868e-13 6.2725e+08 1636.02 0 1613 6.1875e+08 3300 0 
+140625 12500 -4.72031e-12 5.22242e-13 6.27278e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+140625 6250 -4.75861e-12 2.61372e-13 6.47894e+08 1638.45 0 1613 6.39375e+08 3300 0 
+187500 6250 -6.42409e-12 1.72777e-13 6.47942e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+140625 12500 -4.72031e-12 5.22242e-13 6.27278e+08 1636.02 0 1613 6.1875e+08 3300 0 
+187500 12500 -6.3779e-12 3.44696e-13 6.27327e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+0 12500 0 2.51724e-13 6.27241e+08 1636.02 0 1613 6.1875e+08 3300 0 
+46875 12500 -1.06307e-12 3.54701e-13 6.27241e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+0 18750 0 3.71815e-13 6.06625e+08 1633.58 0 1613 5.98125e+08 3300 0 
+46875 18750 -1.02534e-12 5.28238e-13 6.06625e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+46875 12500 -1.06307e-12 3.54701e-13 6.27241e+08 1636.02 0 1613 6.1875e+08 3300 0 
+93750 12500 -2.71064e-12 5.17868e-13 6.2725e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+46875 18750 -1.02534e-12 5.28238e-13 6.06625e+08 1633.58 0 1613 5.98125e+08 3300 0 
+93750 18750 -2.65498e-12 7.75548e-13 6.06633e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+0 18750 0 3.71815e-13 6.06625e+08 1633.58 0 1613 5.98125e+08 3300 0 
+46875 18750 -1.02534e-12 5.28238e-13 6.06625e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+0 25000 0 4.84973e-13 5.86007e+08 1631.15 0 1613 5.775e+08 3300 0 
+46875 25000 -9.72544e-13 6.97211e-13 5.86007e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+46875 18750 -1.02534e-12 5.28238e-13 6.06625e+08 1633.58 0 1613 5.98125e+08 3300 0 
+93750 18750 -2.65498e-12 7.75548e-13 6.06633e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+46875 25000 -9.72544e-13 6.97211e-13 5.86007e+08 1631.15 0 1613 5.775e+08 3300 0 
+93750 25000 -2.57717e-12 1.03173e-12 5.86015e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+93750 12500 -2.71064e-12 5.17868e-13 6.2725e+08 1636.02 0 1613 6.1875e+08 3300 0 
+140625 12500 -4.72031e-12 5.22242e-13 6.27278e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+93750 18750 -2.65498e-12 7.75548e-13 6.06633e+08 1633.58 0 1613 5.98125e+08 3300 0 
+140625 18750 -4.65644e-12 7.82095e-13 6.06662e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+140625 12500 -4.72031e-12 5.22242e-13 6.27278e+08 1636.02 0 1613 6.1875e+08 3300 0 
+187500 12500 -6.3779e-12 3.44696e-13 6.27327e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+140625 18750 -4.65644e-12 7.82095e-13 6.06662e+08 1633.58 0 1613 5.98125e+08 3300 0 
+187500 18750 -6.30069e-12 5.14886e-13 6.06711e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+93750 18750 -2.65498e-12 7.75548e-13 6.06633e+08 1633.58 0 1613 5.98125e+08 3300 0 
+140625 18750 -4.65644e-12 7.82095e-13 6.06662e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+93750 25000 -2.57717e-12 1.03173e-12 5.86015e+08 1631.15 0 1613 5.775e+08 3300 0 
+140625 25000 -4.56698e-12 1.04039e-12 5.86043e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+140625 18750 -4.65644e-12 7.82095e-13 6.06662e+08 1633.58 0 1613 5.98125e+08 3300 0 
+187500 18750 -6.30069e-12 5.14886e-13 6.06711e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+140625 25000 -4.56698e-12 1.04039e-12 5.86043e+08 1631.15 0 1613 5.775e+08 3300 0 
+187500 25000 -6.19215e-12 6.82451e-13 5.86093e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+187500 0 -6.43947e-12 0 6.68556e+08 1640.89 0 1613 6.6e+08 3300 0 
+234375 0 -7.29156e-12 0 6.68617e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+187500 6250 -6.42409e-12 1.72777e-13 6.47942e+08 1638.45 0 1613 6.39375e+08 3300 0 
+234375 6250 -7.27304e-12 5.46129e-14 6.48003e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+234375 0 -7.29156e-12 0 6.68617e+08 1640.89 0 1613 6.6e+08 3300 0 
+281250 0 -7.32141e-12 0 6.6868e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+234375 6250 -7.27304e-12 5.46129e-14 6.48003e+08 1638.45 0 1613 6.39375e+08 3300 0 
+281250 6250 -7.30105e-12 -4.09699e-14 6.48066e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+187500 6250 -6.42409e-12 1.72777e-13 6.47942e+08 1638.45 0 1613 6.39375e+08 3300 0 
+234375 6250 -7.27304e-12 5.46129e-14 6.48003e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+187500 12500 -6.3779e-12 3.44696e-13 6.27327e+08 1636.02 0 1613 6.1875e+08 3300 0 
+234375 12500 -7.21741e-12 1.08495e-13 6.27388e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+234375 6250 -7.27304e-12 5.46129e-14 6.48003e+08 1638.45 0 1613 6.39375e+08 3300 0 
+281250 6250 -7.30105e-12 -4.09699e-14 6.48066e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+234375 12500 -7.21741e-12 1.08495e-13 6.27388e+08 1636.02 0 1613 6.1875e+08 3300 0 
+281250 12500 -7.23989e-12 -8.21721e-14 6.27451e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+281250 0 -7.32141e-12 0 6.6868e+08 1640.89 0 1613 6.6e+08 3300 0 
+328125 0 -6.77801e-12 0 6.68738e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+281250 6250 -7.30105e-12 -4.09699e-14 6.48066e+08 1638.45 0 1613 6.39375e+08 3300 0 
+328125 6250 -6.75773e-12 -9.77597e-14 6.48124e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+328125 0 -6.77801e-12 0 6.68738e+08 1640.89 0 1613 6.6e+08 3300 0 
+375000 0 -5.93931e-12 0 6.68789e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+328125 6250 -6.75773e-12 -9.77597e-14 6.48124e+08 1638.45 0 1613 6.39375e+08 3300 0 
+375000 6250 -5.9206e-12 -1.21257e-13 6.48175e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+281250 6250 -7.30105e-12 -4.09699e-14 6.48066e+08 1638.45 0 1613 6.39375e+08 3300 0 
+328125 6250 -6.75773e-12 -9.77597e-14 6.48124e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+281250 12500 -7.23989e-12 -8.21721e-14 6.27451e+08 1636.02 0 1613 6.1875e+08 3300 0 
+328125 12500 -6.69683e-12 -1.95267e-13 6.2751e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+328125 6250 -6.75773e-12 -9.77597e-14 6.48124e+08 1638.45 0 1613 6.39375e+08 3300 0 
+375000 6250 -5.9206e-12 -1.21257e-13 6.48175e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+328125 12500 -6.69683e-12 -1.95267e-13 6.2751e+08 1636.02 0 1613 6.1875e+08 3300 0 
+375000 12500 -5.86445e-12 -2.41958e-13 6.2756e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+187500 12500 -6.3779e-12 3.44696e-13 6.27327e+08 1636.02 0 1613 6.1875e+08 3300 0 
+234375 12500 -7.21741e-12 1.08495e-13 6.27388e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+187500 18750 -6.30069e-12 5.14886e-13 6.06711e+08 1633.58 0 1613 5.98125e+08 3300 0 
+234375 18750 -7.1244e-12 1.60915e-13 6.06772e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+234375 12500 -7.21741e-12 1.08495e-13 6.27388e+08 1636.02 0 1613 6.1875e+08 3300 0 
+281250 12500 -7.23989e-12 -8.21721e-14 6.27451e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+234375 18750 -7.1244e-12 1.60915e-13 6.06772e+08 1633.58 0 1613 5.98125e+08 3300 0 
+281250 18750 -7.13771e-12 -1.23831e-13 6.06835e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+187500 18750 -6.30069e-12 5.14886e-13 6.06711e+08 1633.58 0 1613 5.98125e+08 3300 0 
+234375 18750 -7.1244e-12 1.60915e-13 6.06772e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+187500 25000 -6.19215e-12 6.82451e-13 5.86093e+08 1631.15 0 1613 5.775e+08 3300 0 
+234375 25000 -6.99354e-12 2.11141e-13 5.86155e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+234375 18750 -7.1244e-12 1.60915e-13 6.06772e+08 1633.58 0 1613 5.98125e+08 3300 0 
+281250 18750 -7.13771e-12 -1.23831e-13 6.06835e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+234375 25000 -6.99354e-12 2.11141e-13 5.86155e+08 1631.15 0 1613 5.775e+08 3300 0 
+281250 25000 -6.99415e-12 -1.66154e-13 5.86218e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+281250 12500 -7.23989e-12 -8.21721e-14 6.27451e+08 1636.02 0 1613 6.1875e+08 3300 0 
+328125 12500 -6.69683e-12 -1.95267e-13 6.2751e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+281250 18750 -7.13771e-12 -1.23831e-13 6.06835e+08 1633.58 0 1613 5.98125e+08 3300 0 
+328125 18750 -6.59521e-12 -2.9226e-13 6.06894e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+328125 12500 -6.69683e-12 -1.95267e-13 6.2751e+08 1636.02 0 1613 6.1875e+08 3300 0 
+375000 12500 -5.86445e-12 -2.41958e-13 6.2756e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+328125 18750 -6.59521e-12 -2.9226e-13 6.06894e+08 1633.58 0 1613 5.98125e+08 3300 0 
+375000 18750 -5.77082e-12 -3.61544e-13 6.06945e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+281250 18750 -7.13771e-12 -1.23831e-13 6.06835e+08 1633.58 0 1613 5.98125e+08 3300 0 
+328125 18750 -6.59521e-12 -2.9226e-13 6.06894e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+281250 25000 -6.99415e-12 -1.66154e-13 5.86218e+08 1631.15 0 1613 5.775e+08 3300 0 
+328125 25000 -6.45266e-12 -3.88461e-13 5.86277e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+328125 18750 -6.59521e-12 -2.9226e-13 6.06894e+08 1633.58 0 1613 5.98125e+08 3300 0 
+375000 18750 -5.77082e-12 -3.61544e-13 6.06945e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+328125 25000 -6.45266e-12 -3.88461e-13 5.86277e+08 1631.15 0 1613 5.775e+08 3300 0 
+375000 25000 -5.63964e-12 -4.79441e-13 5.86328e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+0 25000 0 4.84973e-13 5.86007e+08 1631.15 0 1613 5.775e+08 3300 0 
+46875 25000 -9.72544e-13 6.97211e-13 5.86007e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+0 31250 0 5.88874e-13 5.6539e+08 1628.72 0 1613 5.56875e+08 3300 0 
+46875 31250 -9.04719e-13 8.60122e-13 5.65389e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+46875 25000 -9.72544e-13 6.97211e-13 5.86007e+08 1631.15 0 1613 5.775e+08 3300 0 
+93750 25000 -2.57717e-12 1.03173e-12 5.86015e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+46875 31250 -9.04719e-13 8.60122e-13 5.65389e+08 1628.72 0 1613 5.56875e+08 3300 0 
+93750 31250 -2.47737e-12 1.28591e-12 5.65395e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+0 31250 0 5.88874e-13 5.6539e+08 1628.72 0 1613 5.56875e+08 3300 0 
+46875 31250 -9.04719e-13 8.60122e-13 5.65389e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+0 37500 0 6.81188e-13 5.44771e+08 1626.28 0 1613 5.3625e+08 3300 0 
+46875 37500 -8.21946e-13 1.01549e-12 5.44769e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+46875 31250 -9.04719e-13 8.60122e-13 5.65389e+08 1628.72 0 1613 5.56875e+08 3300 0 
+93750 31250 -2.47737e-12 1.28591e-12 5.65395e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+46875 37500 -8.21946e-13 1.01549e-12 5.44769e+08 1626.28 0 1613 5.3625e+08 3300 0 
+93750 37500 -2.35576e-12 1.53759e-12 5.44774e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+93750 25000 -2.57717e-12 1.03173e-12 5.86015e+08 1631.15 0 1613 5.775e+08 3300 0 
+140625 25000 -4.56698e-12 1.04039e-12 5.86043e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+93750 31250 -2.47737e-12 1.28591e-12 5.65395e+08 1628.72 0 1613 5.56875e+08 3300 0 
+140625 31250 -4.45185e-12 1.29655e-12 5.65423e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+140625 25000 -4.56698e-12 1.04039e-12 5.86043e+08 1631.15 0 1613 5.775e+08 3300 0 
+187500 25000 -6.19215e-12 6.82451e-13 5.86093e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+140625 31250 -4.45185e-12 1.29655e-12 5.65423e+08 1628.72 0 1613 5.56875e+08 3300 0 
+187500 31250 -6.05181e-12 8.46451e-13 5.65474e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+93750 31250 -2.47737e-12 1.28591e-12 5.65395e+08 1628.72 0 1613 5.56875e+08 3300 0 
+140625 31250 -4.45185e-12 1.29655e-12 5.65423e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+93750 37500 -2.35576e-12 1.53759e-12 5.44774e+08 1626.28 0 1613 5.3625e+08 3300 0 
+140625 37500 -4.31097e-12 1.54991e-12 5.44802e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+140625 31250 -4.45185e-12 1.29655e-12 5.65423e+08 1628.72 0 1613 5.56875e+08 3300 0 
+187500 31250 -6.05181e-12 8.46451e-13 5.65474e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+140625 37500 -4.31097e-12 1.54991e-12 5.44802e+08 1626.28 0 1613 5.3625e+08 3300 0 
+187500 37500 -5.87904e-12 1.0059e-12 5.44854e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+0 37500 0 6.81188e-13 5.44771e+08 1626.28 0 1613 5.3625e+08 3300 0 
+46875 37500 -8.21946e-13 1.01549e-12 5.44769e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+0 43750 0 7.5958e-13 5.24151e+08 1623.85 0 1613 5.15625e+08 3300 0 
+46875 43750 -7.24369e-13 1.16187e-12 5.24148e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+46875 37500 -8.21946e-13 1.01549e-12 5.44769e+08 1626.28 0 1613 5.3625e+08 3300 0 
+93750 37500 -2.35576e-12 1.53759e-12 5.44774e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+46875 43750 -7.24369e-13 1.16187e-12 5.24148e+08 1623.85 0 1613 5.15625e+08 3300 0 
+93750 43750 -2.21263e-12 1.78627e-12 5.24152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+0 43750 0 7.5958e-13 5.24151e+08 1623.85 0 1613 5.15625e+08 3300 0 
+46875 43750 -7.24369e-13 1.16187e-12 5.24148e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+0 50000 0 8.21718e-13 5.0353e+08 1621.42 0 1613 4.95e+08 3300 0 
+46875 50000 -6.12221e-13 1.29786e-12 5.03526e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+46875 43750 -7.24369e-13 1.16187e-12 5.24148e+08 1623.85 0 1613 5.15625e+08 3300 0 
+93750 43750 -2.21263e-12 1.78627e-12 5.24152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+46875 50000 -6.12221e-13 1.29786e-12 5.03526e+08 1621.42 0 1613 4.95e+08 3300 0 
+93750 50000 -2.04836e-12 2.03144e-12 5.03528e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+93750 37500 -2.35576e-12 1.53759e-12 5.44774e+08 1626.28 0 1613 5.3625e+08 3300 0 
+140625 37500 -4.31097e-12 1.54991e-12 5.44802e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+93750 43750 -2.21263e-12 1.78627e-12 5.24152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+140625 43750 -4.14423e-12 1.79978e-12 5.2418e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+140625 37500 -4.31097e-12 1.54991e-12 5.44802e+08 1626.28 0 1613 5.3625e+08 3300 0 
+187500 37500 -5.87904e-12 1.0059e-12 5.44854e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+140625 43750 -4.14423e-12 1.79978e-12 5.2418e+08 1623.85 0 1613 5.15625e+08 3300 0 
+187500 43750 -5.67305e-12 1.15972e-12 5.24232e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+93750 43750 -2.21263e-12 1.78627e-12 5.24152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+140625 43750 -4.14423e-12 1.79978e-12 5.2418e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+93750 50000 -2.04836e-12 2.03144e-12 5.03528e+08 1621.42 0 1613 4.95e+08 3300 0 
+140625 50000 -3.95149e-12 2.04531e-12 5.03556e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+140625 43750 -4.14423e-12 1.79978e-12 5.2418e+08 1623.85 0 1613 5.15625e+08 3300 0 
+187500 43750 -5.67305e-12 1.15972e-12 5.24232e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+140625 50000 -3.95149e-12 2.04531e-12 5.03556e+08 1621.42 0 1613 4.95e+08 3300 0 
+187500 50000 -5.43286e-12 1.30679e-12 5.03609e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+187500 25000 -6.19215e-12 6.82451e-13 5.86093e+08 1631.15 0 1613 5.775e+08 3300 0 
+234375 25000 -6.99354e-12 2.11141e-13 5.86155e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+187500 31250 -6.05181e-12 8.46451e-13 5.65474e+08 1628.72 0 1613 5.56875e+08 3300 0 
+234375 31250 -6.82421e-12 2.58444e-13 5.65536e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+234375 25000 -6.99354e-12 2.11141e-13 5.86155e+08 1631.15 0 1613 5.775e+08 3300 0 
+281250 25000 -6.99415e-12 -1.66154e-13 5.86218e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+234375 31250 -6.82421e-12 2.58444e-13 5.65536e+08 1628.72 0 1613 5.56875e+08 3300 0 
+281250 31250 -6.80871e-12 -2.09325e-13 5.65601e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+187500 31250 -6.05181e-12 8.46451e-13 5.65474e+08 1628.72 0 1613 5.56875e+08 3300 0 
+234375 31250 -6.82421e-12 2.58444e-13 5.65536e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+187500 37500 -5.87904e-12 1.0059e-12 5.44854e+08 1626.28 0 1613 5.3625e+08 3300 0 
+234375 37500 -6.61555e-12 3.02095e-13 5.44917e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+234375 31250 -6.82421e-12 2.58444e-13 5.65536e+08 1628.72 0 1613 5.56875e+08 3300 0 
+281250 31250 -6.80871e-12 -2.09325e-13 5.65601e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+234375 37500 -6.61555e-12 3.02095e-13 5.44917e+08 1626.28 0 1613 5.3625e+08 3300 0 
+281250 37500 -6.58073e-12 -2.53495e-13 5.44982e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+281250 25000 -6.99415e-12 -1.66154e-13 5.86218e+08 1631.15 0 1613 5.775e+08 3300 0 
+328125 25000 -6.45266e-12 -3.88461e-13 5.86277e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+281250 31250 -6.80871e-12 -2.09325e-13 5.65601e+08 1628.72 0 1613 5.56875e+08 3300 0 
+328125 31250 -6.2689e-12 -4.83568e-13 5.6566e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+328125 25000 -6.45266e-12 -3.88461e-13 5.86277e+08 1631.15 0 1613 5.775e+08 3300 0 
+375000 25000 -5.63964e-12 -4.79441e-13 5.86328e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+328125 31250 -6.2689e-12 -4.83568e-13 5.6566e+08 1628.72 0 1613 5.56875e+08 3300 0 
+375000 31250 -5.47083e-12 -5.9506e-13 5.65711e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+281250 31250 -6.80871e-12 -2.09325e-13 5.65601e+08 1628.72 0 1613 5.56875e+08 3300 0 
+328125 31250 -6.2689e-12 -4.83568e-13 5.6566e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+281250 37500 -6.58073e-12 -2.53495e-13 5.44982e+08 1626.28 0 1613 5.3625e+08 3300 0 
+328125 37500 -6.04358e-12 -5.77244e-13 5.45042e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+328125 31250 -6.2689e-12 -4.83568e-13 5.6566e+08 1628.72 0 1613 5.56875e+08 3300 0 
+375000 31250 -5.47083e-12 -5.9506e-13 5.65711e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+328125 37500 -6.04358e-12 -5.77244e-13 5.45042e+08 1626.28 0 1613 5.3625e+08 3300 0 
+375000 37500 -5.26427e-12 -7.07789e-13 5.45093e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+187500 37500 -5.87904e-12 1.0059e-12 5.44854e+08 1626.28 0 1613 5.3625e+08 3300 0 
+234375 37500 -6.61555e-12 3.02095e-13 5.44917e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+187500 43750 -5.67305e-12 1.15972e-12 5.24232e+08 1623.85 0 1613 5.15625e+08 3300 0 
+234375 43750 -6.36654e-12 3.4137e-13 5.24297e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+234375 37500 -6.61555e-12 3.02095e-13 5.44917e+08 1626.28 0 1613 5.3625e+08 3300 0 
+281250 37500 -6.58073e-12 -2.53495e-13 5.44982e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+234375 43750 -6.36654e-12 3.4137e-13 5.24297e+08 1623.85 0 1613 5.15625e+08 3300 0 
+281250 43750 -6.30941e-12 -2.9877e-13 5.24363e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+187500 43750 -5.67305e-12 1.15972e-12 5.24232e+08 1623.85 0 1613 5.15625e+08 3300 0 
+234375 43750 -6.36654e-12 3.4137e-13 5.24297e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+187500 50000 -5.43286e-12 1.30679e-12 5.03609e+08 1621.42 0 1613 4.95e+08 3300 0 
+234375 50000 -6.0759e-12 3.75555e-13 5.03676e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+234375 43750 -6.36654e-12 3.4137e-13 5.24297e+08 1623.85 0 1613 5.15625e+08 3300 0 
+281250 43750 -6.30941e-12 -2.9877e-13 5.24363e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+234375 50000 -6.0759e-12 3.75555e-13 5.03676e+08 1621.42 0 1613 4.95e+08 3300 0 
+281250 50000 -5.99381e-12 -3.45202e-13 5.03743e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+281250 37500 -6.58073e-12 -2.53495e-13 5.44982e+08 1626.28 0 1613 5.3625e+08 3300 0 
+328125 37500 -6.04358e-12 -5.77244e-13 5.45042e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+281250 43750 -6.30941e-12 -2.9877e-13 5.24363e+08 1623.85 0 1613 5.15625e+08 3300 0 
+328125 43750 -5.77627e-12 -6.6911e-13 5.24423e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+328125 37500 -6.04358e-12 -5.77244e-13 5.45042e+08 1626.28 0 1613 5.3625e+08 3300 0 
+375000 37500 -5.26427e-12 -7.07789e-13 5.45093e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+328125 43750 -5.77627e-12 -6.6911e-13 5.24423e+08 1623.85 0 1613 5.15625e+08 3300 0 
+375000 43750 -5.01983e-12 -8.16986e-13 5.24474e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+281250 43750 -6.30941e-12 -2.9877e-13 5.24363e+08 1623.85 0 1613 5.15625e+08 3300 0 
+328125 43750 -5.77627e-12 -6.6911e-13 5.24423e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+281250 50000 -5.99381e-12 -3.45202e-13 5.03743e+08 1621.42 0 1613 4.95e+08 3300 0 
+328125 50000 -5.46648e-12 -7.58735e-13 5.03803e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+328125 43750 -5.77627e-12 -6.6911e-13 5.24423e+08 1623.85 0 1613 5.15625e+08 3300 0 
+375000 43750 -5.01983e-12 -8.16986e-13 5.24474e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+328125 50000 -5.46648e-12 -7.58735e-13 5.03803e+08 1621.42 0 1613 4.95e+08 3300 0 
+375000 50000 -4.73735e-12 -9.21978e-13 5.03854e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+375000 0 -5.93931e-12 0 6.68789e+08 1640.89 0 1613 6.6e+08 3300 0 
+421875 0 -5.01312e-12 0 6.68832e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+375000 6250 -5.9206e-12 -1.21257e-13 6.48175e+08 1638.45 0 1613 6.39375e+08 3300 0 
+421875 6250 -4.99677e-12 -1.22851e-13 6.48218e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+421875 0 -5.01312e-12 0 6.68832e+08 1640.89 0 1613 6.6e+08 3300 0 
+468750 0 -4.12476e-12 0 6.68866e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+421875 6250 -4.99677e-12 -1.22851e-13 6.48218e+08 1638.45 0 1613 6.39375e+08 3300 0 
+468750 6250 -4.11098e-12 -1.12509e-13 6.48252e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+375000 6250 -5.9206e-12 -1.21257e-13 6.48175e+08 1638.45 0 1613 6.39375e+08 3300 0 
+421875 6250 -4.99677e-12 -1.22851e-13 6.48218e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+375000 12500 -5.86445e-12 -2.41958e-13 6.2756e+08 1636.02 0 1613 6.1875e+08 3300 0 
+421875 12500 -4.9477e-12 -2.45024e-13 6.27603e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+421875 6250 -4.99677e-12 -1.22851e-13 6.48218e+08 1638.45 0 1613 6.39375e+08 3300 0 
+468750 6250 -4.11098e-12 -1.12509e-13 6.48252e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+421875 12500 -4.9477e-12 -2.45024e-13 6.27603e+08 1636.02 0 1613 6.1875e+08 3300 0 
+468750 12500 -4.06966e-12 -2.24337e-13 6.27637e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+468750 0 -4.12476e-12 0 6.68866e+08 1640.89 0 1613 6.6e+08 3300 0 
+515625 0 -3.33665e-12 0 6.68894e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+468750 6250 -4.11098e-12 -1.12509e-13 6.48252e+08 1638.45 0 1613 6.39375e+08 3300 0 
+515625 6250 -3.32532e-12 -9.69676e-14 6.4828e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+515625 0 -3.33665e-12 0 6.68894e+08 1640.89 0 1613 6.6e+08 3300 0 
+562500 0 -2.67193e-12 0 6.68915e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+515625 6250 -3.32532e-12 -9.69676e-14 6.4828e+08 1638.45 0 1613 6.39375e+08 3300 0 
+562500 6250 -2.66275e-12 -8.00637e-14 6.48301e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+468750 6250 -4.11098e-12 -1.12509e-13 6.48252e+08 1638.45 0 1613 6.39375e+08 3300 0 
+515625 6250 -3.32532e-12 -9.69676e-14 6.4828e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+468750 12500 -4.06966e-12 -2.24337e-13 6.27637e+08 1636.02 0 1613 6.1875e+08 3300 0 
+515625 12500 -3.29135e-12 -1.93318e-13 6.27665e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+515625 6250 -3.32532e-12 -9.69676e-14 6.4828e+08 1638.45 0 1613 6.39375e+08 3300 0 
+562500 6250 -2.66275e-12 -8.00637e-14 6.48301e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+515625 12500 -3.29135e-12 -1.93318e-13 6.27665e+08 1636.02 0 1613 6.1875e+08 3300 0 
+562500 12500 -2.63522e-12 -1.59603e-13 6.27686e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+375000 12500 -5.86445e-12 -2.41958e-13 6.2756e+08 1636.02 0 1613 6.1875e+08 3300 0 
+421875 12500 -4.9477e-12 -2.45024e-13 6.27603e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+375000 18750 -5.77082e-12 -3.61544e-13 6.06945e+08 1633.58 0 1613 5.98125e+08 3300 0 
+421875 18750 -4.86594e-12 -3.65835e-13 6.06987e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+421875 12500 -4.9477e-12 -2.45024e-13 6.27603e+08 1636.02 0 1613 6.1875e+08 3300 0 
+468750 12500 -4.06966e-12 -2.24337e-13 6.27637e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+421875 18750 -4.86594e-12 -3.65835e-13 6.06987e+08 1633.58 0 1613 5.98125e+08 3300 0 
+468750 18750 -4.00082e-12 -3.348e-13 6.07022e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+375000 18750 -5.77082e-12 -3.61544e-13 6.06945e+08 1633.58 0 1613 5.98125e+08 3300 0 
+421875 18750 -4.86594e-12 -3.65835e-13 6.06987e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+375000 25000 -5.63964e-12 -4.79441e-13 5.86328e+08 1631.15 0 1613 5.775e+08 3300 0 
+421875 25000 -4.7515e-12 -4.84599e-13 5.86371e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+421875 18750 -4.86594e-12 -3.65835e-13 6.06987e+08 1633.58 0 1613 5.98125e+08 3300 0 
+468750 18750 -4.00082e-12 -3.348e-13 6.07022e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+421875 25000 -4.7515e-12 -4.84599e-13 5.86371e+08 1631.15 0 1613 5.775e+08 3300 0 
+468750 25000 -3.90453e-12 -4.43214e-13 5.86405e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+468750 12500 -4.06966e-12 -2.24337e-13 6.27637e+08 1636.02 0 1613 6.1875e+08 3300 0 
+515625 12500 -3.29135e-12 -1.93318e-13 6.27665e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+468750 18750 -4.00082e-12 -3.348e-13 6.07022e+08 1633.58 0 1613 5.98125e+08 3300 0 
+515625 18750 -3.23477e-12 -2.88431e-13 6.07049e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+515625 12500 -3.29135e-12 -1.93318e-13 6.27665e+08 1636.02 0 1613 6.1875e+08 3300 0 
+562500 12500 -2.63522e-12 -1.59603e-13 6.27686e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+515625 18750 -3.23477e-12 -2.88431e-13 6.07049e+08 1633.58 0 1613 5.98125e+08 3300 0 
+562500 18750 -2.58938e-12 -2.38094e-13 6.07071e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+468750 18750 -4.00082e-12 -3.348e-13 6.07022e+08 1633.58 0 1613 5.98125e+08 3300 0 
+515625 18750 -3.23477e-12 -2.88431e-13 6.07049e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+468750 25000 -3.90453e-12 -4.43214e-13 5.86405e+08 1631.15 0 1613 5.775e+08 3300 0 
+515625 25000 -3.15567e-12 -3.8169e-13 5.86432e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+515625 18750 -3.23477e-12 -2.88431e-13 6.07049e+08 1633.58 0 1613 5.98125e+08 3300 0 
+562500 18750 -2.58938e-12 -2.38094e-13 6.07071e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+515625 25000 -3.15567e-12 -3.8169e-13 5.86432e+08 1631.15 0 1613 5.775e+08 3300 0 
+562500 25000 -2.5253e-12 -3.15013e-13 5.86454e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+562500 0 -2.67193e-12 0 6.68915e+08 1640.89 0 1613 6.6e+08 3300 0 
+609375 0 -2.13332e-12 0 6.68932e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+562500 6250 -2.66275e-12 -8.00637e-14 6.48301e+08 1638.45 0 1613 6.39375e+08 3300 0 
+609375 6250 -2.12591e-12 -6.35197e-14 6.48318e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+609375 0 -2.13332e-12 0 6.68932e+08 1640.89 0 1613 6.6e+08 3300 0 
+656250 0 -1.71646e-12 0 6.68946e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+609375 6250 -2.12591e-12 -6.35197e-14 6.48318e+08 1638.45 0 1613 6.39375e+08 3300 0 
+656250 6250 -1.71042e-12 -4.75671e-14 6.48332e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+562500 6250 -2.66275e-12 -8.00637e-14 6.48301e+08 1638.45 0 1613 6.39375e+08 3300 0 
+609375 6250 -2.12591e-12 -6.35197e-14 6.48318e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+562500 12500 -2.63522e-12 -1.59603e-13 6.27686e+08 1636.02 0 1613 6.1875e+08 3300 0 
+609375 12500 -2.10369e-12 -1.2662e-13 6.27703e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+609375 6250 -2.12591e-12 -6.35197e-14 6.48318e+08 1638.45 0 1613 6.39375e+08 3300 0 
+656250 6250 -1.71042e-12 -4.75671e-14 6.48332e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+609375 12500 -2.10369e-12 -1.2662e-13 6.27703e+08 1636.02 0 1613 6.1875e+08 3300 0 
+656250 12500 -1.6923e-12 -9.48255e-14 6.27717e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+656250 0 -1.71646e-12 0 6.68946e+08 1640.89 0 1613 6.6e+08 3300 0 
+703125 0 -1.41987e-12 0 6.68956e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+656250 6250 -1.71042e-12 -4.75671e-14 6.48332e+08 1638.45 0 1613 6.39375e+08 3300 0 
+703125 6250 -1.41476e-12 -3.12267e-14 6.48342e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+703125 0 -1.41987e-12 0 6.68956e+08 1640.89 0 1613 6.6e+08 3300 0 
+750000 0 -1.25421e-12 0 6.68965e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+703125 6250 -1.41476e-12 -3.12267e-14 6.48342e+08 1638.45 0 1613 6.39375e+08 3300 0 
+750000 6250 -1.24951e-12 -1.21911e-14 6.48351e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+656250 6250 -1.71042e-12 -4.75671e-14 6.48332e+08 1638.45 0 1613 6.39375e+08 3300 0 
+703125 6250 -1.41476e-12 -3.12267e-14 6.48342e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+656250 12500 -1.6923e-12 -9.48255e-14 6.27717e+08 1636.02 0 1613 6.1875e+08 3300 0 
+703125 12500 -1.39944e-12 -6.22688e-14 6.27727e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+703125 6250 -1.41476e-12 -3.12267e-14 6.48342e+08 1638.45 0 1613 6.39375e+08 3300 0 
+750000 6250 -1.24951e-12 -1.21911e-14 6.48351e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+703125 12500 -1.39944e-12 -6.22688e-14 6.27727e+08 1636.02 0 1613 6.1875e+08 3300 0 
+750000 12500 -1.23543e-12 -2.43547e-14 6.27736e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+562500 12500 -2.63522e-12 -1.59603e-13 6.27686e+08 1636.02 0 1613 6.1875e+08 3300 0 
+609375 12500 -2.10369e-12 -1.2662e-13 6.27703e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+562500 18750 -2.58938e-12 -2.38094e-13 6.07071e+08 1633.58 0 1613 5.98125e+08 3300 0 
+609375 18750 -2.06671e-12 -1.88881e-13 6.07088e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+609375 12500 -2.10369e-12 -1.2662e-13 6.27703e+08 1636.02 0 1613 6.1875e+08 3300 0 
+656250 12500 -1.6923e-12 -9.48255e-14 6.27717e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+609375 18750 -2.06671e-12 -1.88881e-13 6.07088e+08 1633.58 0 1613 5.98125e+08 3300 0 
+656250 18750 -1.66216e-12 -1.41466e-13 6.07101e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+562500 18750 -2.58938e-12 -2.38094e-13 6.07071e+08 1633.58 0 1613 5.98125e+08 3300 0 
+609375 18750 -2.06671e-12 -1.88881e-13 6.07088e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+562500 25000 -2.5253e-12 -3.15013e-13 5.86454e+08 1631.15 0 1613 5.775e+08 3300 0 
+609375 25000 -2.01503e-12 -2.49884e-13 5.86471e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+609375 18750 -2.06671e-12 -1.88881e-13 6.07088e+08 1633.58 0 1613 5.98125e+08 3300 0 
+656250 18750 -1.66216e-12 -1.41466e-13 6.07101e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+609375 25000 -2.01503e-12 -2.49884e-13 5.86471e+08 1631.15 0 1613 5.775e+08 3300 0 
+656250 25000 -1.62005e-12 -1.87181e-13 5.86484e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+656250 12500 -1.6923e-12 -9.48255e-14 6.27717e+08 1636.02 0 1613 6.1875e+08 3300 0 
+703125 12500 -1.39944e-12 -6.22688e-14 6.27727e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+656250 18750 -1.66216e-12 -1.41466e-13 6.07101e+08 1633.58 0 1613 5.98125e+08 3300 0 
+703125 18750 -1.37396e-12 -9.29407e-14 6.07112e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+703125 12500 -1.39944e-12 -6.22688e-14 6.27727e+08 1636.02 0 1613 6.1875e+08 3300 0 
+750000 12500 -1.23543e-12 -2.43547e-14 6.27736e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+703125 18750 -1.37396e-12 -9.29407e-14 6.07112e+08 1633.58 0 1613 5.98125e+08 3300 0 
+750000 18750 -1.21203e-12 -3.64615e-14 6.0712e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+656250 18750 -1.66216e-12 -1.41466e-13 6.07101e+08 1633.58 0 1613 5.98125e+08 3300 0 
+703125 18750 -1.37396e-12 -9.29407e-14 6.07112e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+656250 25000 -1.62005e-12 -1.87181e-13 5.86484e+08 1631.15 0 1613 5.775e+08 3300 0 
+703125 25000 -1.33838e-12 -1.23056e-13 5.86495e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+703125 18750 -1.37396e-12 -9.29407e-14 6.07112e+08 1633.58 0 1613 5.98125e+08 3300 0 
+750000 18750 -1.21203e-12 -3.64615e-14 6.0712e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+703125 25000 -1.33838e-12 -1.23056e-13 5.86495e+08 1631.15 0 1613 5.775e+08 3300 0 
+750000 25000 -1.1794e-12 -4.84796e-14 5.86503e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+375000 25000 -5.63964e-12 -4.79441e-13 5.86328e+08 1631.15 0 1613 5.775e+08 3300 0 
+421875 25000 -4.7515e-12 -4.84599e-13 5.86371e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+375000 31250 -5.47083e-12 -5.9506e-13 5.65711e+08 1628.72 0 1613 5.56875e+08 3300 0 
+421875 31250 -4.6044e-12 -6.00615e-13 5.65753e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+421875 25000 -4.7515e-12 -4.84599e-13 5.86371e+08 1631.15 0 1613 5.775e+08 3300 0 
+468750 25000 -3.90453e-12 -4.43214e-13 5.86405e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+421875 31250 -4.6044e-12 -6.00615e-13 5.65753e+08 1628.72 0 1613 5.56875e+08 3300 0 
+468750 31250 -3.78086e-12 -5.48889e-13 5.65787e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+375000 31250 -5.47083e-12 -5.9506e-13 5.65711e+08 1628.72 0 1613 5.56875e+08 3300 0 
+421875 31250 -4.6044e-12 -6.00615e-13 5.65753e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+375000 37500 -5.26427e-12 -7.07789e-13 5.45093e+08 1626.28 0 1613 5.3625e+08 3300 0 
+421875 37500 -4.42467e-12 -7.13176e-13 5.45135e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+421875 31250 -4.6044e-12 -6.00615e-13 5.65753e+08 1628.72 0 1613 5.56875e+08 3300 0 
+468750 31250 -3.78086e-12 -5.48889e-13 5.65787e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+421875 37500 -4.42467e-12 -7.13176e-13 5.45135e+08 1626.28 0 1613 5.3625e+08 3300 0 
+468750 37500 -3.62992e-12 -6.51129e-13 5.45169e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+468750 25000 -3.90453e-12 -4.43214e-13 5.86405e+08 1631.15 0 1613 5.775e+08 3300 0 
+515625 25000 -3.15567e-12 -3.8169e-13 5.86432e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+468750 31250 -3.78086e-12 -5.48889e-13 5.65787e+08 1628.72 0 1613 5.56875e+08 3300 0 
+515625 31250 -3.05413e-12 -4.72474e-13 5.65815e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+515625 25000 -3.15567e-12 -3.8169e-13 5.86432e+08 1631.15 0 1613 5.775e+08 3300 0 
+562500 25000 -2.5253e-12 -3.15013e-13 5.86454e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+515625 31250 -3.05413e-12 -4.72474e-13 5.65815e+08 1628.72 0 1613 5.56875e+08 3300 0 
+562500 31250 -2.4431e-12 -3.89835e-13 5.65836e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+468750 31250 -3.78086e-12 -5.48889e-13 5.65787e+08 1628.72 0 1613 5.56875e+08 3300 0 
+515625 31250 -3.05413e-12 -4.72474e-13 5.65815e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+468750 37500 -3.62992e-12 -6.51129e-13 5.45169e+08 1626.28 0 1613 5.3625e+08 3300 0 
+515625 37500 -2.93029e-12 -5.60163e-13 5.45196e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+515625 31250 -3.05413e-12 -4.72474e-13 5.65815e+08 1628.72 0 1613 5.56875e+08 3300 0 
+562500 31250 -2.4431e-12 -3.89835e-13 5.65836e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+515625 37500 -2.93029e-12 -5.60163e-13 5.45196e+08 1626.28 0 1613 5.3625e+08 3300 0 
+562500 37500 -2.34288e-12 -4.62038e-13 5.45218e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+375000 37500 -5.26427e-12 -7.07789e-13 5.45093e+08 1626.28 0 1613 5.3625e+08 3300 0 
+421875 37500 -4.42467e-12 -7.13176e-13 5.45135e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+375000 43750 -5.01983e-12 -8.16986e-13 5.24474e+08 1623.85 0 1613 5.15625e+08 3300 0 
+421875 43750 -4.21235e-12 -8.21555e-13 5.24516e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+421875 37500 -4.42467e-12 -7.13176e-13 5.45135e+08 1626.28 0 1613 5.3625e+08 3300 0 
+468750 37500 -3.62992e-12 -6.51129e-13 5.45169e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+421875 43750 -4.21235e-12 -8.21555e-13 5.24516e+08 1623.85 0 1613 5.15625e+08 3300 0 
+468750 43750 -3.45183e-12 -7.49234e-13 5.2455e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+375000 43750 -5.01983e-12 -8.16986e-13 5.24474e+08 1623.85 0 1613 5.15625e+08 3300 0 
+421875 43750 -4.21235e-12 -8.21555e-13 5.24516e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+375000 50000 -4.73735e-12 -9.21978e-13 5.03854e+08 1621.42 0 1613 4.95e+08 3300 0 
+421875 50000 -3.96751e-12 -9.2501e-13 5.03896e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+421875 43750 -4.21235e-12 -8.21555e-13 5.24516e+08 1623.85 0 1613 5.15625e+08 3300 0 
+468750 43750 -3.45183e-12 -7.49234e-13 5.2455e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+421875 50000 -3.96751e-12 -9.2501e-13 5.03896e+08 1621.42 0 1613 4.95e+08 3300 0 
+468750 50000 -3.24676e-12 -8.42495e-13 5.0393e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+468750 37500 -3.62992e-12 -6.51129e-13 5.45169e+08 1626.28 0 1613 5.3625e+08 3300 0 
+515625 37500 -2.93029e-12 -5.60163e-13 5.45196e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+468750 43750 -3.45183e-12 -7.49234e-13 5.2455e+08 1623.85 0 1613 5.15625e+08 3300 0 
+515625 43750 -2.7843e-12 -6.44132e-13 5.24577e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+515625 37500 -2.93029e-12 -5.60163e-13 5.45196e+08 1626.28 0 1613 5.3625e+08 3300 0 
+562500 37500 -2.34288e-12 -4.62038e-13 5.45218e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+515625 43750 -2.7843e-12 -6.44132e-13 5.24577e+08 1623.85 0 1613 5.15625e+08 3300 0 
+562500 43750 -2.22483e-12 -5.31099e-13 5.24598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+468750 43750 -3.45183e-12 -7.49234e-13 5.2455e+08 1623.85 0 1613 5.15625e+08 3300 0 
+515625 43750 -2.7843e-12 -6.44132e-13 5.24577e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+468750 50000 -3.24676e-12 -8.42495e-13 5.0393e+08 1621.42 0 1613 4.95e+08 3300 0 
+515625 50000 -2.61637e-12 -7.23758e-13 5.03957e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+515625 43750 -2.7843e-12 -6.44132e-13 5.24577e+08 1623.85 0 1613 5.15625e+08 3300 0 
+562500 43750 -2.22483e-12 -5.31099e-13 5.24598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+515625 50000 -2.61637e-12 -7.23758e-13 5.03957e+08 1621.42 0 1613 4.95e+08 3300 0 
+562500 50000 -2.08913e-12 -5.96497e-13 5.03978e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+562500 25000 -2.5253e-12 -3.15013e-13 5.86454e+08 1631.15 0 1613 5.775e+08 3300 0 
+609375 25000 -2.01503e-12 -2.49884e-13 5.86471e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+562500 31250 -2.4431e-12 -3.89835e-13 5.65836e+08 1628.72 0 1613 5.56875e+08 3300 0 
+609375 31250 -1.94874e-12 -3.0921e-13 5.65853e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+609375 25000 -2.01503e-12 -2.49884e-13 5.86471e+08 1631.15 0 1613 5.775e+08 3300 0 
+656250 25000 -1.62005e-12 -1.87181e-13 5.86484e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+609375 31250 -1.94874e-12 -3.0921e-13 5.65853e+08 1628.72 0 1613 5.56875e+08 3300 0 
+656250 31250 -1.56607e-12 -2.3166e-13 5.65866e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+562500 31250 -2.4431e-12 -3.89835e-13 5.65836e+08 1628.72 0 1613 5.56875e+08 3300 0 
+609375 31250 -1.94874e-12 -3.0921e-13 5.65853e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+562500 37500 -2.34288e-12 -4.62038e-13 5.45218e+08 1626.28 0 1613 5.3625e+08 3300 0 
+609375 37500 -1.86799e-12 -3.66442e-13 5.45234e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+609375 31250 -1.94874e-12 -3.0921e-13 5.65853e+08 1628.72 0 1613 5.56875e+08 3300 0 
+656250 31250 -1.56607e-12 -2.3166e-13 5.65866e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+609375 37500 -1.86799e-12 -3.66442e-13 5.45234e+08 1626.28 0 1613 5.3625e+08 3300 0 
+656250 37500 -1.50034e-12 -2.74595e-13 5.45248e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+656250 25000 -1.62005e-12 -1.87181e-13 5.86484e+08 1631.15 0 1613 5.775e+08 3300 0 
+703125 25000 -1.33838e-12 -1.23056e-13 5.86495e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+656250 31250 -1.56607e-12 -2.3166e-13 5.65866e+08 1628.72 0 1613 5.56875e+08 3300 0 
+703125 31250 -1.29282e-12 -1.52427e-13 5.65877e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+703125 25000 -1.33838e-12 -1.23056e-13 5.86495e+08 1631.15 0 1613 5.775e+08 3300 0 
+750000 25000 -1.1794e-12 -4.84796e-14 5.86503e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+703125 31250 -1.29282e-12 -1.52427e-13 5.65877e+08 1628.72 0 1613 5.56875e+08 3300 0 
+750000 31250 -1.13765e-12 -6.0372e-14 5.65885e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+656250 31250 -1.56607e-12 -2.3166e-13 5.65866e+08 1628.72 0 1613 5.56875e+08 3300 0 
+703125 31250 -1.29282e-12 -1.52427e-13 5.65877e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+656250 37500 -1.50034e-12 -2.74595e-13 5.45248e+08 1626.28 0 1613 5.3625e+08 3300 0 
+703125 37500 -1.23739e-12 -1.80863e-13 5.45258e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+703125 31250 -1.29282e-12 -1.52427e-13 5.65877e+08 1628.72 0 1613 5.56875e+08 3300 0 
+750000 31250 -1.13765e-12 -6.0372e-14 5.65885e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+703125 37500 -1.23739e-12 -1.80863e-13 5.45258e+08 1626.28 0 1613 5.3625e+08 3300 0 
+750000 37500 -1.08696e-12 -7.20961e-14 5.45266e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+562500 37500 -2.34288e-12 -4.62038e-13 5.45218e+08 1626.28 0 1613 5.3625e+08 3300 0 
+609375 37500 -1.86799e-12 -3.66442e-13 5.45234e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+562500 43750 -2.22483e-12 -5.31099e-13 5.24598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+609375 43750 -1.77291e-12 -4.21163e-13 5.24615e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+609375 37500 -1.86799e-12 -3.66442e-13 5.45234e+08 1626.28 0 1613 5.3625e+08 3300 0 
+656250 37500 -1.50034e-12 -2.74595e-13 5.45248e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+609375 43750 -1.77291e-12 -4.21163e-13 5.24615e+08 1623.85 0 1613 5.15625e+08 3300 0 
+656250 43750 -1.42301e-12 -3.15676e-13 5.24628e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+562500 43750 -2.22483e-12 -5.31099e-13 5.24598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+609375 43750 -1.77291e-12 -4.21163e-13 5.24615e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+562500 50000 -2.08913e-12 -5.96497e-13 5.03978e+08 1621.42 0 1613 4.95e+08 3300 0 
+609375 50000 -1.66369e-12 -4.72956e-13 5.03994e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+609375 43750 -1.77291e-12 -4.21163e-13 5.24615e+08 1623.85 0 1613 5.15625e+08 3300 0 
+656250 43750 -1.42301e-12 -3.15676e-13 5.24628e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+609375 50000 -1.66369e-12 -4.72956e-13 5.03994e+08 1621.42 0 1613 4.95e+08 3300 0 
+656250 50000 -1.33425e-12 -3.54595e-13 5.04007e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+656250 37500 -1.50034e-12 -2.74595e-13 5.45248e+08 1626.28 0 1613 5.3625e+08 3300 0 
+703125 37500 -1.23739e-12 -1.80863e-13 5.45258e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+656250 43750 -1.42301e-12 -3.15676e-13 5.24628e+08 1623.85 0 1613 5.15625e+08 3300 0 
+703125 43750 -1.17225e-12 -2.08171e-13 5.24638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+703125 37500 -1.23739e-12 -1.80863e-13 5.45258e+08 1626.28 0 1613 5.3625e+08 3300 0 
+750000 37500 -1.08696e-12 -7.20961e-14 5.45266e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+703125 43750 -1.17225e-12 -2.08171e-13 5.24638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+750000 43750 -1.02752e-12 -8.36018e-14 5.24646e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+656250 43750 -1.42301e-12 -3.15676e-13 5.24628e+08 1623.85 0 1613 5.15625e+08 3300 0 
+703125 43750 -1.17225e-12 -2.08171e-13 5.24638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+656250 50000 -1.33425e-12 -3.54595e-13 5.04007e+08 1621.42 0 1613 4.95e+08 3300 0 
+703125 50000 -1.09759e-12 -2.34156e-13 5.04017e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+703125 43750 -1.17225e-12 -2.08171e-13 5.24638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+750000 43750 -1.02752e-12 -8.36018e-14 5.24646e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+703125 50000 -1.09759e-12 -2.34156e-13 5.04017e+08 1621.42 0 1613 4.95e+08 3300 0 
+750000 50000 -9.59555e-13 -9.48304e-14 5.04026e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+0 50000 0 8.21718e-13 5.0353e+08 1621.42 0 1613 4.95e+08 3300 0 
+46875 50000 -6.12221e-13 1.29786e-12 5.03526e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+0 56250 0 8.65287e-13 4.82909e+08 1618.98 0 1613 4.74375e+08 3300 0 
+46875 56250 -4.85876e-13 1.4221e-12 4.82903e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+46875 50000 -6.12221e-13 1.29786e-12 5.03526e+08 1621.42 0 1613 4.95e+08 3300 0 
+93750 50000 -2.04836e-12 2.03144e-12 5.03528e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+46875 56250 -4.85876e-13 1.4221e-12 4.82903e+08 1618.98 0 1613 4.74375e+08 3300 0 
+93750 56250 -1.86345e-12 2.27256e-12 4.82902e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+0 56250 0 8.65287e-13 4.82909e+08 1618.98 0 1613 4.74375e+08 3300 0 
+46875 56250 -4.85876e-13 1.4221e-12 4.82903e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+0 62500 0 8.88006e-13 4.62287e+08 1616.55 0 1613 4.5375e+08 3300 0 
+46875 62500 -3.45893e-13 1.53329e-12 4.62279e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+46875 56250 -4.85876e-13 1.4221e-12 4.82903e+08 1618.98 0 1613 4.74375e+08 3300 0 
+93750 56250 -1.86345e-12 2.27256e-12 4.82902e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+46875 62500 -3.45893e-13 1.53329e-12 4.62279e+08 1616.55 0 1613 4.5375e+08 3300 0 
+93750 62500 -1.65858e-12 2.50906e-12 4.62275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+93750 50000 -2.04836e-12 2.03144e-12 5.03528e+08 1621.42 0 1613 4.95e+08 3300 0 
+140625 50000 -3.95149e-12 2.04531e-12 5.03556e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+93750 56250 -1.86345e-12 2.27256e-12 4.82902e+08 1618.98 0 1613 4.74375e+08 3300 0 
+140625 56250 -3.73257e-12 2.28557e-12 4.8293e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+140625 50000 -3.95149e-12 2.04531e-12 5.03556e+08 1621.42 0 1613 4.95e+08 3300 0 
+187500 50000 -5.43286e-12 1.30679e-12 5.03609e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+140625 56250 -3.73257e-12 2.28557e-12 4.8293e+08 1618.98 0 1613 4.74375e+08 3300 0 
+187500 56250 -5.15726e-12 1.44586e-12 4.82985e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+93750 56250 -1.86345e-12 2.27256e-12 4.82902e+08 1618.98 0 1613 4.74375e+08 3300 0 
+140625 56250 -3.73257e-12 2.28557e-12 4.8293e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+93750 62500 -1.65858e-12 2.50906e-12 4.62275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+140625 62500 -3.48722e-12 2.51944e-12 4.62303e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+140625 56250 -3.73257e-12 2.28557e-12 4.8293e+08 1618.98 0 1613 4.74375e+08 3300 0 
+187500 56250 -5.15726e-12 1.44586e-12 4.82985e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+140625 62500 -3.48722e-12 2.51944e-12 4.62303e+08 1616.55 0 1613 4.5375e+08 3300 0 
+187500 62500 -4.84479e-12 1.57558e-12 4.6236e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+0 62500 0 8.88006e-13 4.62287e+08 1616.55 0 1613 4.5375e+08 3300 0 
+46875 62500 -3.45893e-13 1.53329e-12 4.62279e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+0 68750 0 8.87662e-13 4.41664e+08 1614.11 0 1613 4.33125e+08 3300 0 
+46875 68750 -1.93094e-13 1.63024e-12 4.41653e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+46875 62500 -3.45893e-13 1.53329e-12 4.62279e+08 1616.55 0 1613 4.5375e+08 3300 0 
+93750 62500 -1.65858e-12 2.50906e-12 4.62275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+46875 68750 -1.93094e-13 1.63024e-12 4.41653e+08 1614.11 0 1613 4.33125e+08 3300 0 
+93750 68750 -1.43459e-12 2.74031e-12 4.41647e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+0 68750 0 8.87662e-13 4.41664e+08 1614.11 0 1613 4.33125e+08 3300 0 
+46875 68750 -1.93094e-13 1.63024e-12 4.41653e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+0 75000 0 8.62156e-13 4.2104e+08 1611.68 0 1613 4.125e+08 3300 0 
+46875 75000 -2.86564e-14 1.71185e-12 4.21027e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+46875 68750 -1.93094e-13 1.63024e-12 4.41653e+08 1614.11 0 1613 4.33125e+08 3300 0 
+93750 68750 -1.43459e-12 2.74031e-12 4.41647e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+46875 75000 -2.86564e-14 1.71185e-12 4.21027e+08 1611.68 0 1613 4.125e+08 3300 0 
+93750 75000 -1.19259e-12 2.96558e-12 4.21017e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+93750 62500 -1.65858e-12 2.50906e-12 4.62275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+140625 62500 -3.48722e-12 2.51944e-12 4.62303e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+93750 68750 -1.43459e-12 2.74031e-12 4.41647e+08 1614.11 0 1613 4.33125e+08 3300 0 
+140625 68750 -3.21512e-12 2.74563e-12 4.41674e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+140625 62500 -3.48722e-12 2.51944e-12 4.62303e+08 1616.55 0 1613 4.5375e+08 3300 0 
+187500 62500 -4.84479e-12 1.57558e-12 4.6236e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+140625 68750 -3.21512e-12 2.74563e-12 4.41674e+08 1614.11 0 1613 4.33125e+08 3300 0 
+187500 68750 -4.49373e-12 1.69447e-12 4.41734e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+93750 68750 -1.43459e-12 2.74031e-12 4.41647e+08 1614.11 0 1613 4.33125e+08 3300 0 
+140625 68750 -3.21512e-12 2.74563e-12 4.41674e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+93750 75000 -1.19259e-12 2.96558e-12 4.21017e+08 1611.68 0 1613 4.125e+08 3300 0 
+140625 75000 -2.91584e-12 2.96259e-12 4.21044e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+140625 68750 -3.21512e-12 2.74563e-12 4.41674e+08 1614.11 0 1613 4.33125e+08 3300 0 
+187500 68750 -4.49373e-12 1.69447e-12 4.41734e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+140625 75000 -2.91584e-12 2.96259e-12 4.21044e+08 1611.68 0 1613 4.125e+08 3300 0 
+187500 75000 -4.10199e-12 1.80093e-12 4.21106e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+187500 50000 -5.43286e-12 1.30679e-12 5.03609e+08 1621.42 0 1613 4.95e+08 3300 0 
+234375 50000 -6.0759e-12 3.75555e-13 5.03676e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+187500 56250 -5.15726e-12 1.44586e-12 4.82985e+08 1618.98 0 1613 4.74375e+08 3300 0 
+234375 56250 -5.74214e-12 4.03954e-13 4.83054e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+234375 50000 -6.0759e-12 3.75555e-13 5.03676e+08 1621.42 0 1613 4.95e+08 3300 0 
+281250 50000 -5.99381e-12 -3.45202e-13 5.03743e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+234375 56250 -5.74214e-12 4.03954e-13 4.83054e+08 1618.98 0 1613 4.74375e+08 3300 0 
+281250 56250 -5.63282e-12 -3.92777e-13 4.83121e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+187500 56250 -5.15726e-12 1.44586e-12 4.82985e+08 1618.98 0 1613 4.74375e+08 3300 0 
+234375 56250 -5.74214e-12 4.03954e-13 4.83054e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+187500 62500 -4.84479e-12 1.57558e-12 4.6236e+08 1616.55 0 1613 4.5375e+08 3300 0 
+234375 62500 -5.36353e-12 4.25896e-13 4.6243e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+234375 56250 -5.74214e-12 4.03954e-13 4.83054e+08 1618.98 0 1613 4.74375e+08 3300 0 
+281250 56250 -5.63282e-12 -3.92777e-13 4.83121e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+234375 62500 -5.36353e-12 4.25896e-13 4.6243e+08 1616.55 0 1613 4.5375e+08 3300 0 
+281250 62500 -5.22522e-12 -4.41403e-13 4.62499e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+281250 50000 -5.99381e-12 -3.45202e-13 5.03743e+08 1621.42 0 1613 4.95e+08 3300 0 
+328125 50000 -5.46648e-12 -7.58735e-13 5.03803e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+281250 56250 -5.63282e-12 -3.92777e-13 4.83121e+08 1618.98 0 1613 4.74375e+08 3300 0 
+328125 56250 -5.11365e-12 -8.4563e-13 4.83182e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+328125 50000 -5.46648e-12 -7.58735e-13 5.03803e+08 1621.42 0 1613 4.95e+08 3300 0 
+375000 50000 -4.73735e-12 -9.21978e-13 5.03854e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+328125 56250 -5.11365e-12 -8.4563e-13 4.83182e+08 1618.98 0 1613 4.74375e+08 3300 0 
+375000 56250 -4.41669e-12 -1.02205e-12 4.83233e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+281250 56250 -5.63282e-12 -3.92777e-13 4.83121e+08 1618.98 0 1613 4.74375e+08 3300 0 
+328125 56250 -5.11365e-12 -8.4563e-13 4.83182e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+281250 62500 -5.22522e-12 -4.41403e-13 4.62499e+08 1616.55 0 1613 4.5375e+08 3300 0 
+328125 62500 -4.71715e-12 -9.29232e-13 4.6256e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+328125 56250 -5.11365e-12 -8.4563e-13 4.83182e+08 1618.98 0 1613 4.74375e+08 3300 0 
+375000 56250 -4.41669e-12 -1.02205e-12 4.83233e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+328125 62500 -4.71715e-12 -9.29232e-13 4.6256e+08 1616.55 0 1613 4.5375e+08 3300 0 
+375000 62500 -4.05767e-12 -1.11644e-12 4.62612e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+187500 62500 -4.84479e-12 1.57558e-12 4.6236e+08 1616.55 0 1613 4.5375e+08 3300 0 
+234375 62500 -5.36353e-12 4.25896e-13 4.6243e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+187500 68750 -4.49373e-12 1.69447e-12 4.41734e+08 1614.11 0 1613 4.33125e+08 3300 0 
+234375 68750 -4.93805e-12 4.40746e-13 4.41806e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+234375 62500 -5.36353e-12 4.25896e-13 4.6243e+08 1616.55 0 1613 4.5375e+08 3300 0 
+281250 62500 -5.22522e-12 -4.41403e-13 4.62499e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+234375 68750 -4.93805e-12 4.40746e-13 4.41806e+08 1614.11 0 1613 4.33125e+08 3300 0 
+281250 68750 -4.76961e-12 -4.90892e-13 4.41876e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+187500 68750 -4.49373e-12 1.69447e-12 4.41734e+08 1614.11 0 1613 4.33125e+08 3300 0 
+234375 68750 -4.93805e-12 4.40746e-13 4.41806e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+187500 75000 -4.10199e-12 1.80093e-12 4.21106e+08 1611.68 0 1613 4.125e+08 3300 0 
+234375 75000 -4.46343e-12 4.47928e-13 4.21181e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+234375 68750 -4.93805e-12 4.40746e-13 4.41806e+08 1614.11 0 1613 4.33125e+08 3300 0 
+281250 68750 -4.76961e-12 -4.90892e-13 4.41876e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+234375 75000 -4.46343e-12 4.47928e-13 4.21181e+08 1611.68 0 1613 4.125e+08 3300 0 
+281250 75000 -4.26447e-12 -5.40951e-13 4.21253e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+281250 62500 -5.22522e-12 -4.41403e-13 4.62499e+08 1616.55 0 1613 4.5375e+08 3300 0 
+328125 62500 -4.71715e-12 -9.29232e-13 4.6256e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+281250 68750 -4.76961e-12 -4.90892e-13 4.41876e+08 1614.11 0 1613 4.33125e+08 3300 0 
+328125 68750 -4.27632e-12 -1.0089e-12 4.41938e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+328125 62500 -4.71715e-12 -9.29232e-13 4.6256e+08 1616.55 0 1613 4.5375e+08 3300 0 
+375000 62500 -4.05767e-12 -1.11644e-12 4.62612e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+328125 68750 -4.27632e-12 -1.0089e-12 4.41938e+08 1614.11 0 1613 4.33125e+08 3300 0 
+375000 68750 -3.66013e-12 -1.20435e-12 4.41989e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+281250 68750 -4.76961e-12 -4.90892e-13 4.41876e+08 1614.11 0 1613 4.33125e+08 3300 0 
+328125 68750 -4.27632e-12 -1.0089e-12 4.41938e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+281250 75000 -4.26447e-12 -5.40951e-13 4.21253e+08 1611.68 0 1613 4.125e+08 3300 0 
+328125 75000 -3.79044e-12 -1.08392e-12 4.21315e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+328125 68750 -4.27632e-12 -1.0089e-12 4.41938e+08 1614.11 0 1613 4.33125e+08 3300 0 
+375000 68750 -3.66013e-12 -1.20435e-12 4.41989e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+328125 75000 -3.79044e-12 -1.08392e-12 4.21315e+08 1611.68 0 1613 4.125e+08 3300 0 
+375000 75000 -3.2239e-12 -1.28492e-12 4.21366e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+0 75000 0 8.62156e-13 4.2104e+08 1611.68 0 1613 4.125e+08 3300 0 
+46875 75000 -2.86564e-14 1.71185e-12 4.21027e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+0 81250 0 8.0957e-13 4.00417e+08 1609.25 0 1613 3.91875e+08 3300 0 
+46875 81250 1.45769e-13 1.77712e-12 4.004e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+46875 75000 -2.86564e-14 1.71185e-12 4.21027e+08 1611.68 0 1613 4.125e+08 3300 0 
+93750 75000 -1.19259e-12 2.96558e-12 4.21017e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+46875 81250 1.45769e-13 1.77712e-12 4.004e+08 1609.25 0 1613 3.91875e+08 3300 0 
+93750 81250 -9.33957e-13 3.18402e-12 4.00384e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+0 81250 0 8.0957e-13 4.00417e+08 1609.25 0 1613 3.91875e+08 3300 0 
+46875 81250 1.45769e-13 1.77712e-12 4.004e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+0 87500 0 7.28262e-13 3.79793e+08 1606.81 0 1613 3.7125e+08 3300 0 
+46875 87500 3.27898e-13 1.82521e-12 3.79771e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+46875 81250 1.45769e-13 1.77712e-12 4.004e+08 1609.25 0 1613 3.91875e+08 3300 0 
+93750 81250 -9.33957e-13 3.18402e-12 4.00384e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+46875 87500 3.27898e-13 1.82521e-12 3.79771e+08 1606.81 0 1613 3.7125e+08 3300 0 
+93750 87500 -6.60384e-13 3.39458e-12 3.79751e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+93750 75000 -1.19259e-12 2.96558e-12 4.21017e+08 1611.68 0 1613 4.125e+08 3300 0 
+140625 75000 -2.91584e-12 2.96259e-12 4.21044e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+93750 81250 -9.33957e-13 3.18402e-12 4.00384e+08 1609.25 0 1613 3.91875e+08 3300 0 
+140625 81250 -2.58884e-12 3.16847e-12 4.00412e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+140625 75000 -2.91584e-12 2.96259e-12 4.21044e+08 1611.68 0 1613 4.125e+08 3300 0 
+187500 75000 -4.10199e-12 1.80093e-12 4.21106e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+140625 81250 -2.58884e-12 3.16847e-12 4.00412e+08 1609.25 0 1613 3.91875e+08 3300 0 
+187500 81250 -3.66711e-12 1.89317e-12 4.00478e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+93750 81250 -9.33957e-13 3.18402e-12 4.00384e+08 1609.25 0 1613 3.91875e+08 3300 0 
+140625 81250 -2.58884e-12 3.16847e-12 4.00412e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+93750 87500 -6.60384e-13 3.39458e-12 3.79751e+08 1606.81 0 1613 3.7125e+08 3300 0 
+140625 87500 -2.23336e-12 3.3611e-12 3.79779e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+140625 81250 -2.58884e-12 3.16847e-12 4.00412e+08 1609.25 0 1613 3.91875e+08 3300 0 
+187500 81250 -3.66711e-12 1.89317e-12 4.00478e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+140625 87500 -2.23336e-12 3.3611e-12 3.79779e+08 1606.81 0 1613 3.7125e+08 3300 0 
+187500 87500 -3.18617e-12 1.96929e-12 3.79848e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+0 87500 0 7.28262e-13 3.79793e+08 1606.81 0 1613 3.7125e+08 3300 0 
+46875 87500 3.27898e-13 1.82521e-12 3.79771e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+0 93750 0 6.17021e-13 3.59169e+08 1604.38 0 1613 3.50625e+08 3300 0 
+46875 93750 5.14618e-13 1.85539e-12 3.59142e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+46875 87500 3.27898e-13 1.82521e-12 3.79771e+08 1606.81 0 1613 3.7125e+08 3300 0 
+93750 87500 -6.60384e-13 3.39458e-12 3.79751e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+46875 93750 5.14618e-13 1.85539e-12 3.59142e+08 1604.38 0 1613 3.50625e+08 3300 0 
+93750 93750 -3.73964e-13 3.59597e-12 3.59115e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+0 93750 0 6.17021e-13 3.59169e+08 1604.38 0 1613 3.50625e+08 3300 0 
+46875 93750 5.14618e-13 1.85539e-12 3.59142e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+0 100000 0 4.75256e-13 3.38545e+08 1601.95 0 1613 3.3e+08 3300 0 
+46875 100000 7.01738e-13 1.86702e-12 3.38511e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+46875 93750 5.14618e-13 1.85539e-12 3.59142e+08 1604.38 0 1613 3.50625e+08 3300 0 
+93750 93750 -3.73964e-13 3.59597e-12 3.59115e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+46875 100000 7.01738e-13 1.86702e-12 3.38511e+08 1601.95 0 1613 3.3e+08 3300 0 
+93750 100000 -7.72208e-14 3.78653e-12 3.38477e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+93750 87500 -6.60384e-13 3.39458e-12 3.79751e+08 1606.81 0 1613 3.7125e+08 3300 0 
+140625 87500 -2.23336e-12 3.3611e-12 3.79779e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+93750 93750 -3.73964e-13 3.59597e-12 3.59115e+08 1604.38 0 1613 3.50625e+08 3300 0 
+140625 93750 -1.8484e-12 3.53783e-12 3.59143e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+140625 87500 -2.23336e-12 3.3611e-12 3.79779e+08 1606.81 0 1613 3.7125e+08 3300 0 
+187500 87500 -3.18617e-12 1.96929e-12 3.79848e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+140625 93750 -1.8484e-12 3.53783e-12 3.59143e+08 1604.38 0 1613 3.50625e+08 3300 0 
+187500 93750 -2.65574e-12 2.02719e-12 3.59217e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+93750 93750 -3.73964e-13 3.59597e-12 3.59115e+08 1604.38 0 1613 3.50625e+08 3300 0 
+140625 93750 -1.8484e-12 3.53783e-12 3.59143e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+93750 100000 -7.72208e-14 3.78653e-12 3.38477e+08 1601.95 0 1613 3.3e+08 3300 0 
+140625 100000 -1.43262e-12 3.6955e-12 3.38506e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+140625 93750 -1.8484e-12 3.53783e-12 3.59143e+08 1604.38 0 1613 3.50625e+08 3300 0 
+187500 93750 -2.65574e-12 2.02719e-12 3.59217e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+140625 100000 -1.43262e-12 3.6955e-12 3.38506e+08 1601.95 0 1613 3.3e+08 3300 0 
+187500 100000 -2.07174e-12 2.0646e-12 3.38584e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+187500 75000 -4.10199e-12 1.80093e-12 4.21106e+08 1611.68 0 1613 4.125e+08 3300 0 
+234375 75000 -4.46343e-12 4.47928e-13 4.21181e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+187500 81250 -3.66711e-12 1.89317e-12 4.00478e+08 1609.25 0 1613 3.91875e+08 3300 0 
+234375 81250 -3.93707e-12 4.46939e-13 4.00555e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+234375 75000 -4.46343e-12 4.47928e-13 4.21181e+08 1611.68 0 1613 4.125e+08 3300 0 
+281250 75000 -4.26447e-12 -5.40951e-13 4.21253e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+234375 81250 -3.93707e-12 4.46939e-13 4.00555e+08 1609.25 0 1613 3.91875e+08 3300 0 
+281250 81250 -3.70814e-12 -5.91153e-13 4.00628e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+187500 81250 -3.66711e-12 1.89317e-12 4.00478e+08 1609.25 0 1613 3.91875e+08 3300 0 
+234375 81250 -3.93707e-12 4.46939e-13 4.00555e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+187500 87500 -3.18617e-12 1.96929e-12 3.79848e+08 1606.81 0 1613 3.7125e+08 3300 0 
+234375 87500 -3.35607e-12 4.37379e-13 3.79928e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+234375 81250 -3.93707e-12 4.46939e-13 4.00555e+08 1609.25 0 1613 3.91875e+08 3300 0 
+281250 81250 -3.70814e-12 -5.91153e-13 4.00628e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+234375 87500 -3.35607e-12 4.37379e-13 3.79928e+08 1606.81 0 1613 3.7125e+08 3300 0 
+281250 87500 -3.09883e-12 -6.40932e-13 3.80003e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+281250 75000 -4.26447e-12 -5.40951e-13 4.21253e+08 1611.68 0 1613 4.125e+08 3300 0 
+328125 75000 -3.79044e-12 -1.08392e-12 4.21315e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+281250 81250 -3.70814e-12 -5.91153e-13 4.00628e+08 1609.25 0 1613 3.91875e+08 3300 0 
+328125 81250 -3.25875e-12 -1.15344e-12 4.00691e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+328125 75000 -3.79044e-12 -1.08392e-12 4.21315e+08 1611.68 0 1613 4.125e+08 3300 0 
+375000 75000 -3.2239e-12 -1.28492e-12 4.21366e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+328125 81250 -3.25875e-12 -1.15344e-12 4.00691e+08 1609.25 0 1613 3.91875e+08 3300 0 
+375000 81250 -2.74884e-12 -1.35721e-12 4.00742e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+281250 81250 -3.70814e-12 -5.91153e-13 4.00628e+08 1609.25 0 1613 3.91875e+08 3300 0 
+328125 81250 -3.25875e-12 -1.15344e-12 4.00691e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+281250 87500 -3.09883e-12 -6.40932e-13 3.80003e+08 1606.81 0 1613 3.7125e+08 3300 0 
+328125 87500 -2.68049e-12 -1.21655e-12 3.80066e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+328125 81250 -3.25875e-12 -1.15344e-12 4.00691e+08 1609.25 0 1613 3.91875e+08 3300 0 
+375000 81250 -2.74884e-12 -1.35721e-12 4.00742e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+328125 87500 -2.68049e-12 -1.21655e-12 3.80066e+08 1606.81 0 1613 3.7125e+08 3300 0 
+375000 87500 -2.23482e-12 -1.42025e-12 3.80117e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+187500 87500 -3.18617e-12 1.96929e-12 3.79848e+08 1606.81 0 1613 3.7125e+08 3300 0 
+234375 87500 -3.35607e-12 4.37379e-13 3.79928e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+187500 93750 -2.65574e-12 2.02719e-12 3.59217e+08 1604.38 0 1613 3.50625e+08 3300 0 
+234375 93750 -2.71719e-12 4.18988e-13 3.593e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+234375 87500 -3.35607e-12 4.37379e-13 3.79928e+08 1606.81 0 1613 3.7125e+08 3300 0 
+281250 87500 -3.09883e-12 -6.40932e-13 3.80003e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+234375 93750 -2.71719e-12 4.18988e-13 3.593e+08 1604.38 0 1613 3.50625e+08 3300 0 
+281250 93750 -2.43463e-12 -6.89537e-13 3.59376e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+187500 93750 -2.65574e-12 2.02719e-12 3.59217e+08 1604.38 0 1613 3.50625e+08 3300 0 
+234375 93750 -2.71719e-12 4.18988e-13 3.593e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+187500 100000 -2.07174e-12 2.0646e-12 3.38584e+08 1601.95 0 1613 3.3e+08 3300 0 
+234375 100000 -2.01687e-12 3.91643e-13 3.38671e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+234375 93750 -2.71719e-12 4.18988e-13 3.593e+08 1604.38 0 1613 3.50625e+08 3300 0 
+281250 93750 -2.43463e-12 -6.89537e-13 3.59376e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+234375 100000 -2.01687e-12 3.91643e-13 3.38671e+08 1601.95 0 1613 3.3e+08 3300 0 
+281250 100000 -1.71353e-12 -7.36091e-13 3.38749e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+281250 87500 -3.09883e-12 -6.40932e-13 3.80003e+08 1606.81 0 1613 3.7125e+08 3300 0 
+328125 87500 -2.68049e-12 -1.21655e-12 3.80066e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+281250 93750 -2.43463e-12 -6.89537e-13 3.59376e+08 1604.38 0 1613 3.50625e+08 3300 0 
+328125 93750 -2.05484e-12 -1.27216e-12 3.5944e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+328125 87500 -2.68049e-12 -1.21655e-12 3.80066e+08 1606.81 0 1613 3.7125e+08 3300 0 
+375000 87500 -2.23482e-12 -1.42025e-12 3.80117e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+328125 93750 -2.05484e-12 -1.27216e-12 3.5944e+08 1604.38 0 1613 3.50625e+08 3300 0 
+375000 93750 -1.68175e-12 -1.47296e-12 3.59492e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+281250 93750 -2.43463e-12 -6.89537e-13 3.59376e+08 1604.38 0 1613 3.50625e+08 3300 0 
+328125 93750 -2.05484e-12 -1.27216e-12 3.5944e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+281250 100000 -1.71353e-12 -7.36091e-13 3.38749e+08 1601.95 0 1613 3.3e+08 3300 0 
+328125 100000 -1.38104e-12 -1.31916e-12 3.38814e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+328125 93750 -2.05484e-12 -1.27216e-12 3.5944e+08 1604.38 0 1613 3.50625e+08 3300 0 
+375000 93750 -1.68175e-12 -1.47296e-12 3.59492e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+328125 100000 -1.38104e-12 -1.31916e-12 3.38814e+08 1601.95 0 1613 3.3e+08 3300 0 
+375000 100000 -1.08955e-12 -1.51432e-12 3.38865e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+375000 50000 -4.73735e-12 -9.21978e-13 5.03854e+08 1621.42 0 1613 4.95e+08 3300 0 
+421875 50000 -3.96751e-12 -9.2501e-13 5.03896e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+375000 56250 -4.41669e-12 -1.02205e-12 4.83233e+08 1618.98 0 1613 4.74375e+08 3300 0 
+421875 56250 -3.69022e-12 -1.02278e-12 4.83275e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+421875 50000 -3.96751e-12 -9.2501e-13 5.03896e+08 1621.42 0 1613 4.95e+08 3300 0 
+468750 50000 -3.24676e-12 -8.42495e-13 5.0393e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+421875 56250 -3.69022e-12 -1.02278e-12 4.83275e+08 1618.98 0 1613 4.74375e+08 3300 0 
+468750 56250 -3.01488e-12 -9.30195e-13 4.83309e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+375000 56250 -4.41669e-12 -1.02205e-12 4.83233e+08 1618.98 0 1613 4.74375e+08 3300 0 
+421875 56250 -3.69022e-12 -1.02278e-12 4.83275e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+375000 62500 -4.05767e-12 -1.11644e-12 4.62612e+08 1616.55 0 1613 4.5375e+08 3300 0 
+421875 62500 -3.38057e-12 -1.11407e-12 4.62654e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+421875 56250 -3.69022e-12 -1.02278e-12 4.83275e+08 1618.98 0 1613 4.74375e+08 3300 0 
+468750 56250 -3.01488e-12 -9.30195e-13 4.83309e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+421875 62500 -3.38057e-12 -1.11407e-12 4.62654e+08 1616.55 0 1613 4.5375e+08 3300 0 
+468750 62500 -2.75641e-12 -1.01161e-12 4.62687e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+468750 50000 -3.24676e-12 -8.42495e-13 5.0393e+08 1621.42 0 1613 4.95e+08 3300 0 
+515625 50000 -2.61637e-12 -7.23758e-13 5.03957e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+468750 56250 -3.01488e-12 -9.30195e-13 4.83309e+08 1618.98 0 1613 4.74375e+08 3300 0 
+515625 56250 -2.42669e-12 -7.98415e-13 4.83335e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+515625 50000 -2.61637e-12 -7.23758e-13 5.03957e+08 1621.42 0 1613 4.95e+08 3300 0 
+562500 50000 -2.08913e-12 -5.96497e-13 5.03978e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+515625 56250 -2.42669e-12 -7.98415e-13 4.83335e+08 1618.98 0 1613 4.74375e+08 3300 0 
+562500 56250 -1.93599e-12 -6.5771e-13 4.83356e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+468750 56250 -3.01488e-12 -9.30195e-13 4.83309e+08 1618.98 0 1613 4.74375e+08 3300 0 
+515625 56250 -2.42669e-12 -7.98415e-13 4.83335e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+468750 62500 -2.75641e-12 -1.01161e-12 4.62687e+08 1616.55 0 1613 4.5375e+08 3300 0 
+515625 62500 -2.21554e-12 -8.67475e-13 4.62713e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+515625 56250 -2.42669e-12 -7.98415e-13 4.83335e+08 1618.98 0 1613 4.74375e+08 3300 0 
+562500 56250 -1.93599e-12 -6.5771e-13 4.83356e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+515625 62500 -2.21554e-12 -8.67475e-13 4.62713e+08 1616.55 0 1613 4.5375e+08 3300 0 
+562500 62500 -1.76567e-12 -7.1422e-13 4.62734e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+375000 62500 -4.05767e-12 -1.11644e-12 4.62612e+08 1616.55 0 1613 4.5375e+08 3300 0 
+421875 62500 -3.38057e-12 -1.11407e-12 4.62654e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+375000 68750 -3.66013e-12 -1.20435e-12 4.41989e+08 1614.11 0 1613 4.33125e+08 3300 0 
+421875 68750 -3.03868e-12 -1.19807e-12 4.42031e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+421875 62500 -3.38057e-12 -1.11407e-12 4.62654e+08 1616.55 0 1613 4.5375e+08 3300 0 
+468750 62500 -2.75641e-12 -1.01161e-12 4.62687e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+421875 68750 -3.03868e-12 -1.19807e-12 4.42031e+08 1614.11 0 1613 4.33125e+08 3300 0 
+468750 68750 -2.47159e-12 -1.086e-12 4.42064e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+375000 68750 -3.66013e-12 -1.20435e-12 4.41989e+08 1614.11 0 1613 4.33125e+08 3300 0 
+421875 68750 -3.03868e-12 -1.19807e-12 4.42031e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+375000 75000 -3.2239e-12 -1.28492e-12 4.21366e+08 1611.68 0 1613 4.125e+08 3300 0 
+421875 75000 -2.6647e-12 -1.27396e-12 4.21408e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+421875 68750 -3.03868e-12 -1.19807e-12 4.42031e+08 1614.11 0 1613 4.33125e+08 3300 0 
+468750 68750 -2.47159e-12 -1.086e-12 4.42064e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+421875 75000 -2.6647e-12 -1.27396e-12 4.21408e+08 1611.68 0 1613 4.125e+08 3300 0 
+468750 75000 -2.16071e-12 -1.15262e-12 4.21441e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+468750 62500 -2.75641e-12 -1.01161e-12 4.62687e+08 1616.55 0 1613 4.5375e+08 3300 0 
+515625 62500 -2.21554e-12 -8.67475e-13 4.62713e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+468750 68750 -2.47159e-12 -1.086e-12 4.42064e+08 1614.11 0 1613 4.33125e+08 3300 0 
+515625 68750 -1.98318e-12 -9.30309e-13 4.4209e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+515625 62500 -2.21554e-12 -8.67475e-13 4.62713e+08 1616.55 0 1613 4.5375e+08 3300 0 
+562500 62500 -1.76567e-12 -7.1422e-13 4.62734e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+515625 68750 -1.98318e-12 -9.30309e-13 4.4209e+08 1614.11 0 1613 4.33125e+08 3300 0 
+562500 68750 -1.57845e-12 -7.6551e-13 4.42111e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+468750 68750 -2.47159e-12 -1.086e-12 4.42064e+08 1614.11 0 1613 4.33125e+08 3300 0 
+515625 68750 -1.98318e-12 -9.30309e-13 4.4209e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+468750 75000 -2.16071e-12 -1.15262e-12 4.21441e+08 1611.68 0 1613 4.125e+08 3300 0 
+515625 75000 -1.72995e-12 -9.86285e-13 4.21467e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+515625 68750 -1.98318e-12 -9.30309e-13 4.4209e+08 1614.11 0 1613 4.33125e+08 3300 0 
+562500 68750 -1.57845e-12 -7.6551e-13 4.42111e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+515625 75000 -1.72995e-12 -9.86285e-13 4.21467e+08 1611.68 0 1613 4.125e+08 3300 0 
+562500 75000 -1.37464e-12 -8.11065e-13 4.21487e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+562500 50000 -2.08913e-12 -5.96497e-13 5.03978e+08 1621.42 0 1613 4.95e+08 3300 0 
+609375 50000 -1.66369e-12 -4.72956e-13 5.03994e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+562500 56250 -1.93599e-12 -6.5771e-13 4.83356e+08 1618.98 0 1613 4.74375e+08 3300 0 
+609375 56250 -1.54053e-12 -5.2141e-13 4.83373e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+609375 50000 -1.66369e-12 -4.72956e-13 5.03994e+08 1621.42 0 1613 4.95e+08 3300 0 
+656250 50000 -1.33425e-12 -3.54595e-13 5.04007e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+609375 56250 -1.54053e-12 -5.2141e-13 4.83373e+08 1618.98 0 1613 4.74375e+08 3300 0 
+656250 56250 -1.23426e-12 -3.91042e-13 4.83386e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+562500 56250 -1.93599e-12 -6.5771e-13 4.83356e+08 1618.98 0 1613 4.74375e+08 3300 0 
+609375 56250 -1.54053e-12 -5.2141e-13 4.83373e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+562500 62500 -1.76567e-12 -7.1422e-13 4.62734e+08 1616.55 0 1613 4.5375e+08 3300 0 
+609375 62500 -1.40367e-12 -5.6611e-13 4.6275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+609375 56250 -1.54053e-12 -5.2141e-13 4.83373e+08 1618.98 0 1613 4.74375e+08 3300 0 
+656250 56250 -1.23426e-12 -3.91042e-13 4.83386e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+609375 62500 -1.40367e-12 -5.6611e-13 4.6275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+656250 62500 -1.12326e-12 -4.2471e-13 4.62763e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+656250 50000 -1.33425e-12 -3.54595e-13 5.04007e+08 1621.42 0 1613 4.95e+08 3300 0 
+703125 50000 -1.09759e-12 -2.34156e-13 5.04017e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+656250 56250 -1.23426e-12 -3.91042e-13 4.83386e+08 1618.98 0 1613 4.74375e+08 3300 0 
+703125 56250 -1.01362e-12 -2.58618e-13 4.83396e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+703125 50000 -1.09759e-12 -2.34156e-13 5.04017e+08 1621.42 0 1613 4.95e+08 3300 0 
+750000 50000 -9.59555e-13 -9.48304e-14 5.04026e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+703125 56250 -1.01362e-12 -2.58618e-13 4.83396e+08 1618.98 0 1613 4.74375e+08 3300 0 
+750000 56250 -8.83324e-13 -1.05714e-13 4.83404e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+656250 56250 -1.23426e-12 -3.91042e-13 4.83386e+08 1618.98 0 1613 4.74375e+08 3300 0 
+703125 56250 -1.01362e-12 -2.58618e-13 4.83396e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+656250 62500 -1.12326e-12 -4.2471e-13 4.62763e+08 1616.55 0 1613 4.5375e+08 3300 0 
+703125 62500 -9.2057e-13 -2.81356e-13 4.62773e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+703125 56250 -1.01362e-12 -2.58618e-13 4.83396e+08 1618.98 0 1613 4.74375e+08 3300 0 
+750000 56250 -8.83324e-13 -1.05714e-13 4.83404e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+703125 62500 -9.2057e-13 -2.81356e-13 4.62773e+08 1616.55 0 1613 4.5375e+08 3300 0 
+750000 62500 -7.99116e-13 -1.16172e-13 4.62781e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+562500 62500 -1.76567e-12 -7.1422e-13 4.62734e+08 1616.55 0 1613 4.5375e+08 3300 0 
+609375 62500 -1.40367e-12 -5.6611e-13 4.6275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+562500 68750 -1.57845e-12 -7.6551e-13 4.42111e+08 1614.11 0 1613 4.33125e+08 3300 0 
+609375 68750 -1.25336e-12 -6.06648e-13 4.42127e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+609375 62500 -1.40367e-12 -5.6611e-13 4.6275e+08 1616.55 0 1613 4.5375e+08 3300 0 
+656250 62500 -1.12326e-12 -4.2471e-13 4.62763e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+609375 68750 -1.25336e-12 -6.06648e-13 4.42127e+08 1614.11 0 1613 4.33125e+08 3300 0 
+656250 68750 -1.0015e-12 -4.55288e-13 4.4214e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+562500 68750 -1.57845e-12 -7.6551e-13 4.42111e+08 1614.11 0 1613 4.33125e+08 3300 0 
+609375 68750 -1.25336e-12 -6.06648e-13 4.42127e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+562500 75000 -1.37464e-12 -8.11065e-13 4.21487e+08 1611.68 0 1613 4.125e+08 3300 0 
+609375 75000 -1.08991e-12 -6.42616e-13 4.21503e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+609375 68750 -1.25336e-12 -6.06648e-13 4.42127e+08 1614.11 0 1613 4.33125e+08 3300 0 
+656250 68750 -1.0015e-12 -4.55288e-13 4.4214e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+609375 75000 -1.08991e-12 -6.42616e-13 4.21503e+08 1611.68 0 1613 4.125e+08 3300 0 
+656250 75000 -8.6926e-13 -4.82471e-13 4.21515e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+656250 62500 -1.12326e-12 -4.2471e-13 4.62763e+08 1616.55 0 1613 4.5375e+08 3300 0 
+703125 62500 -9.2057e-13 -2.81356e-13 4.62773e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+656250 68750 -1.0015e-12 -4.55288e-13 4.4214e+08 1614.11 0 1613 4.33125e+08 3300 0 
+703125 68750 -8.18698e-13 -3.02161e-13 4.42149e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+703125 62500 -9.2057e-13 -2.81356e-13 4.62773e+08 1616.55 0 1613 4.5375e+08 3300 0 
+750000 62500 -7.99116e-13 -1.16172e-13 4.62781e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+703125 68750 -8.18698e-13 -3.02161e-13 4.42149e+08 1614.11 0 1613 4.33125e+08 3300 0 
+750000 68750 -7.07246e-13 -1.26114e-13 4.42157e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+656250 68750 -1.0015e-12 -4.55288e-13 4.4214e+08 1614.11 0 1613 4.33125e+08 3300 0 
+703125 68750 -8.18698e-13 -3.02161e-13 4.42149e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+656250 75000 -8.6926e-13 -4.82471e-13 4.21515e+08 1611.68 0 1613 4.125e+08 3300 0 
+703125 75000 -7.08287e-13 -3.20824e-13 4.21525e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+703125 68750 -8.18698e-13 -3.02161e-13 4.42149e+08 1614.11 0 1613 4.33125e+08 3300 0 
+750000 68750 -7.07246e-13 -1.26114e-13 4.42157e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+703125 75000 -7.08287e-13 -3.20824e-13 4.21525e+08 1611.68 0 1613 4.125e+08 3300 0 
+750000 75000 -6.08057e-13 -1.35437e-13 4.21532e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+375000 75000 -3.2239e-12 -1.28492e-12 4.21366e+08 1611.68 0 1613 4.125e+08 3300 0 
+421875 75000 -2.6647e-12 -1.27396e-12 4.21408e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+375000 81250 -2.74884e-12 -1.35721e-12 4.00742e+08 1609.25 0 1613 3.91875e+08 3300 0 
+421875 81250 -2.25879e-12 -1.34084e-12 4.00783e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+421875 75000 -2.6647e-12 -1.27396e-12 4.21408e+08 1611.68 0 1613 4.125e+08 3300 0 
+468750 75000 -2.16071e-12 -1.15262e-12 4.21441e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+421875 81250 -2.25879e-12 -1.34084e-12 4.00783e+08 1609.25 0 1613 3.91875e+08 3300 0 
+468750 81250 -1.82409e-12 -1.21071e-12 4.00816e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+375000 81250 -2.74884e-12 -1.35721e-12 4.00742e+08 1609.25 0 1613 3.91875e+08 3300 0 
+421875 81250 -2.25879e-12 -1.34084e-12 4.00783e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+375000 87500 -2.23482e-12 -1.42025e-12 3.80117e+08 1606.81 0 1613 3.7125e+08 3300 0 
+421875 87500 -1.82118e-12 -1.39784e-12 3.80158e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+421875 81250 -2.25879e-12 -1.34084e-12 4.00783e+08 1609.25 0 1613 3.91875e+08 3300 0 
+468750 81250 -1.82409e-12 -1.21071e-12 4.00816e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+421875 87500 -1.82118e-12 -1.39784e-12 3.80158e+08 1606.81 0 1613 3.7125e+08 3300 0 
+468750 87500 -1.46207e-12 -1.25951e-12 3.80191e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+468750 75000 -2.16071e-12 -1.15262e-12 4.21441e+08 1611.68 0 1613 4.125e+08 3300 0 
+515625 75000 -1.72995e-12 -9.86285e-13 4.21467e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+468750 81250 -1.82409e-12 -1.21071e-12 4.00816e+08 1609.25 0 1613 3.91875e+08 3300 0 
+515625 81250 -1.4562e-12 -1.03477e-12 4.00842e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+515625 75000 -1.72995e-12 -9.86285e-13 4.21467e+08 1611.68 0 1613 4.125e+08 3300 0 
+562500 75000 -1.37464e-12 -8.11065e-13 4.21487e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+515625 81250 -1.4562e-12 -1.03477e-12 4.00842e+08 1609.25 0 1613 3.91875e+08 3300 0 
+562500 81250 -1.15457e-12 -8.50369e-13 4.00862e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+468750 81250 -1.82409e-12 -1.21071e-12 4.00816e+08 1609.25 0 1613 3.91875e+08 3300 0 
+515625 81250 -1.4562e-12 -1.03477e-12 4.00842e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+468750 87500 -1.46207e-12 -1.25951e-12 3.80191e+08 1606.81 0 1613 3.7125e+08 3300 0 
+515625 87500 -1.16231e-12 -1.07513e-12 3.80216e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+515625 81250 -1.4562e-12 -1.03477e-12 4.00842e+08 1609.25 0 1613 3.91875e+08 3300 0 
+562500 81250 -1.15457e-12 -8.50369e-13 4.00862e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+515625 87500 -1.16231e-12 -1.07513e-12 3.80216e+08 1606.81 0 1613 3.7125e+08 3300 0 
+562500 87500 -9.1863e-13 -8.82923e-13 3.80236e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+375000 87500 -2.23482e-12 -1.42025e-12 3.80117e+08 1606.81 0 1613 3.7125e+08 3300 0 
+421875 87500 -1.82118e-12 -1.39784e-12 3.80158e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+375000 93750 -1.68175e-12 -1.47296e-12 3.59492e+08 1604.38 0 1613 3.50625e+08 3300 0 
+421875 93750 -1.35211e-12 -1.44399e-12 3.59532e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+421875 87500 -1.82118e-12 -1.39784e-12 3.80158e+08 1606.81 0 1613 3.7125e+08 3300 0 
+468750 87500 -1.46207e-12 -1.25951e-12 3.80191e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+421875 93750 -1.35211e-12 -1.44399e-12 3.59532e+08 1604.38 0 1613 3.50625e+08 3300 0 
+468750 93750 -1.07505e-12 -1.2982e-12 3.59565e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+375000 93750 -1.68175e-12 -1.47296e-12 3.59492e+08 1604.38 0 1613 3.50625e+08 3300 0 
+421875 93750 -1.35211e-12 -1.44399e-12 3.59532e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+375000 100000 -1.08955e-12 -1.51432e-12 3.38865e+08 1601.95 0 1613 3.3e+08 3300 0 
+421875 100000 -8.5189e-13 -1.47843e-12 3.38906e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+421875 93750 -1.35211e-12 -1.44399e-12 3.59532e+08 1604.38 0 1613 3.50625e+08 3300 0 
+468750 93750 -1.07505e-12 -1.2982e-12 3.59565e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+421875 100000 -8.5189e-13 -1.47843e-12 3.38906e+08 1601.95 0 1613 3.3e+08 3300 0 
+468750 100000 -6.63488e-13 -1.32612e-12 3.38937e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+468750 87500 -1.46207e-12 -1.25951e-12 3.80191e+08 1606.81 0 1613 3.7125e+08 3300 0 
+515625 87500 -1.16231e-12 -1.07513e-12 3.80216e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+468750 93750 -1.07505e-12 -1.2982e-12 3.59565e+08 1604.38 0 1613 3.50625e+08 3300 0 
+515625 93750 -8.48705e-13 -1.10671e-12 3.5959e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+515625 87500 -1.16231e-12 -1.07513e-12 3.80216e+08 1606.81 0 1613 3.7125e+08 3300 0 
+562500 87500 -9.1863e-13 -8.82923e-13 3.80236e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+515625 93750 -8.48705e-13 -1.10671e-12 3.5959e+08 1604.38 0 1613 3.50625e+08 3300 0 
+562500 93750 -6.67215e-13 -9.08176e-13 3.59609e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+468750 93750 -1.07505e-12 -1.2982e-12 3.59565e+08 1604.38 0 1613 3.50625e+08 3300 0 
+515625 93750 -8.48705e-13 -1.10671e-12 3.5959e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+468750 100000 -6.63488e-13 -1.32612e-12 3.38937e+08 1601.95 0 1613 3.3e+08 3300 0 
+515625 100000 -5.15859e-13 -1.12899e-12 3.38962e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+515625 93750 -8.48705e-13 -1.10671e-12 3.5959e+08 1604.38 0 1613 3.50625e+08 3300 0 
+562500 93750 -6.67215e-13 -9.08176e-13 3.59609e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+515625 100000 -5.15859e-13 -1.12899e-12 3.38962e+08 1601.95 0 1613 3.3e+08 3300 0 
+562500 100000 -4.00761e-13 -9.25781e-13 3.38981e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+562500 75000 -1.37464e-12 -8.11065e-13 4.21487e+08 1611.68 0 1613 4.125e+08 3300 0 
+609375 75000 -1.08991e-12 -6.42616e-13 4.21503e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+562500 81250 -1.15457e-12 -8.50369e-13 4.00862e+08 1609.25 0 1613 3.91875e+08 3300 0 
+609375 81250 -9.1361e-13 -6.73608e-13 4.00877e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+609375 75000 -1.08991e-12 -6.42616e-13 4.21503e+08 1611.68 0 1613 4.125e+08 3300 0 
+656250 75000 -8.6926e-13 -4.82471e-13 4.21515e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+609375 81250 -9.1361e-13 -6.73608e-13 4.00877e+08 1609.25 0 1613 3.91875e+08 3300 0 
+656250 81250 -7.26825e-13 -5.05949e-13 4.0089e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+562500 81250 -1.15457e-12 -8.50369e-13 4.00862e+08 1609.25 0 1613 3.91875e+08 3300 0 
+609375 81250 -9.1361e-13 -6.73608e-13 4.00877e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+562500 87500 -9.1863e-13 -8.82923e-13 3.80236e+08 1606.81 0 1613 3.7125e+08 3300 0 
+609375 87500 -7.24816e-13 -6.99233e-13 3.80251e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+609375 81250 -9.1361e-13 -6.73608e-13 4.00877e+08 1609.25 0 1613 3.91875e+08 3300 0 
+656250 81250 -7.26825e-13 -5.05949e-13 4.0089e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+609375 87500 -7.24816e-13 -6.99233e-13 3.80251e+08 1606.81 0 1613 3.7125e+08 3300 0 
+656250 87500 -5.74516e-13 -5.25427e-13 3.80263e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+656250 75000 -8.6926e-13 -4.82471e-13 4.21515e+08 1611.68 0 1613 4.125e+08 3300 0 
+703125 75000 -7.08287e-13 -3.20824e-13 4.21525e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+656250 81250 -7.26825e-13 -5.05949e-13 4.0089e+08 1609.25 0 1613 3.91875e+08 3300 0 
+703125 81250 -5.89641e-13 -3.37127e-13 4.00899e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+703125 75000 -7.08287e-13 -3.20824e-13 4.21525e+08 1611.68 0 1613 4.125e+08 3300 0 
+750000 75000 -6.08057e-13 -1.35437e-13 4.21532e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+703125 81250 -5.89641e-13 -3.37127e-13 4.00899e+08 1609.25 0 1613 3.91875e+08 3300 0 
+750000 81250 -5.01912e-13 -1.44021e-13 4.00907e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+656250 81250 -7.26825e-13 -5.05949e-13 4.0089e+08 1609.25 0 1613 3.91875e+08 3300 0 
+703125 81250 -5.89641e-13 -3.37127e-13 4.00899e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+656250 87500 -5.74516e-13 -5.25427e-13 3.80263e+08 1606.81 0 1613 3.7125e+08 3300 0 
+703125 87500 -4.63085e-13 -3.50864e-13 3.80273e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+703125 81250 -5.89641e-13 -3.37127e-13 4.00899e+08 1609.25 0 1613 3.91875e+08 3300 0 
+750000 81250 -5.01912e-13 -1.44021e-13 4.00907e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+703125 87500 -4.63085e-13 -3.50864e-13 3.80273e+08 1606.81 0 1613 3.7125e+08 3300 0 
+750000 87500 -3.89199e-13 -1.51747e-13 3.8028e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+562500 87500 -9.1863e-13 -8.82923e-13 3.80236e+08 1606.81 0 1613 3.7125e+08 3300 0 
+609375 87500 -7.24816e-13 -6.99233e-13 3.80251e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+562500 93750 -6.67215e-13 -9.08176e-13 3.59609e+08 1604.38 0 1613 3.50625e+08 3300 0 
+609375 93750 -5.23891e-13 -7.19049e-13 3.59624e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+609375 87500 -7.24816e-13 -6.99233e-13 3.80251e+08 1606.81 0 1613 3.7125e+08 3300 0 
+656250 87500 -5.74516e-13 -5.25427e-13 3.80263e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+609375 93750 -5.23891e-13 -7.19049e-13 3.59624e+08 1604.38 0 1613 3.50625e+08 3300 0 
+656250 93750 -4.12674e-13 -5.40553e-13 3.59636e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+562500 93750 -6.67215e-13 -9.08176e-13 3.59609e+08 1604.38 0 1613 3.50625e+08 3300 0 
+609375 93750 -5.23891e-13 -7.19049e-13 3.59624e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+562500 100000 -4.00761e-13 -9.25781e-13 3.38981e+08 1601.95 0 1613 3.3e+08 3300 0 
+609375 100000 -3.11228e-13 -7.32825e-13 3.38996e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+609375 93750 -5.23891e-13 -7.19049e-13 3.59624e+08 1604.38 0 1613 3.50625e+08 3300 0 
+656250 93750 -4.12674e-13 -5.40553e-13 3.59636e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+609375 100000 -3.11228e-13 -7.32825e-13 3.38996e+08 1601.95 0 1613 3.3e+08 3300 0 
+656250 100000 -2.41658e-13 -5.51194e-13 3.39008e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+656250 87500 -5.74516e-13 -5.25427e-13 3.80263e+08 1606.81 0 1613 3.7125e+08 3300 0 
+703125 87500 -4.63085e-13 -3.50864e-13 3.80273e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+656250 93750 -4.12674e-13 -5.40553e-13 3.59636e+08 1604.38 0 1613 3.50625e+08 3300 0 
+703125 93750 -3.28961e-13 -3.61763e-13 3.59645e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+703125 87500 -4.63085e-13 -3.50864e-13 3.80273e+08 1606.81 0 1613 3.7125e+08 3300 0 
+750000 87500 -3.89199e-13 -1.51747e-13 3.8028e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+703125 93750 -3.28961e-13 -3.61763e-13 3.59645e+08 1604.38 0 1613 3.50625e+08 3300 0 
+750000 93750 -2.70325e-13 -1.58422e-13 3.59652e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+656250 93750 -4.12674e-13 -5.40553e-13 3.59636e+08 1604.38 0 1613 3.50625e+08 3300 0 
+703125 93750 -3.28961e-13 -3.61763e-13 3.59645e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+656250 100000 -2.41658e-13 -5.51194e-13 3.39008e+08 1601.95 0 1613 3.3e+08 3300 0 
+703125 100000 -1.87631e-13 -3.6977e-13 3.39017e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+703125 93750 -3.28961e-13 -3.61763e-13 3.59645e+08 1604.38 0 1613 3.50625e+08 3300 0 
+750000 93750 -2.70325e-13 -1.58422e-13 3.59652e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+703125 100000 -1.87631e-13 -3.6977e-13 3.39017e+08 1601.95 0 1613 3.3e+08 3300 0 
+750000 100000 -1.45711e-13 -1.64066e-13 3.39023e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+750000 0 -1.25421e-12 0 6.68965e+08 1640.89 0 1613 6.6e+08 3300 0 
+796875 0 -1.25408e-12 0 6.68972e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+750000 6250 -1.24951e-12 -1.21911e-14 6.48351e+08 1638.45 0 1613 6.39375e+08 3300 0 
+796875 6250 -1.24909e-12 1.37451e-14 6.48358e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+796875 0 -1.25408e-12 0 6.68972e+08 1640.89 0 1613 6.6e+08 3300 0 
+843750 0 -1.49622e-12 0 6.68979e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+796875 6250 -1.24909e-12 1.37451e-14 6.48358e+08 1638.45 0 1613 6.39375e+08 3300 0 
+843750 6250 -1.48984e-12 5.38321e-14 6.48365e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+750000 6250 -1.24951e-12 -1.21911e-14 6.48351e+08 1638.45 0 1613 6.39375e+08 3300 0 
+796875 6250 -1.24909e-12 1.37451e-14 6.48358e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+750000 12500 -1.23543e-12 -2.43547e-14 6.27736e+08 1636.02 0 1613 6.1875e+08 3300 0 
+796875 12500 -1.23413e-12 2.72888e-14 6.27743e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+796875 6250 -1.24909e-12 1.37451e-14 6.48358e+08 1638.45 0 1613 6.39375e+08 3300 0 
+843750 6250 -1.48984e-12 5.38321e-14 6.48365e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+796875 12500 -1.23413e-12 2.72888e-14 6.27743e+08 1636.02 0 1613 6.1875e+08 3300 0 
+843750 12500 -1.47073e-12 1.07096e-13 6.2775e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+843750 0 -1.49622e-12 0 6.68979e+08 1640.89 0 1613 6.6e+08 3300 0 
+890625 0 -2.12865e-12 0 6.68987e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+843750 6250 -1.48984e-12 5.38321e-14 6.48365e+08 1638.45 0 1613 6.39375e+08 3300 0 
+890625 6250 -2.11907e-12 1.20123e-13 6.48373e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+890625 0 -2.12865e-12 0 6.68987e+08 1640.89 0 1613 6.6e+08 3300 0 
+937500 0 -3.41478e-12 0 6.68998e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+890625 6250 -2.11907e-12 1.20123e-13 6.48373e+08 1638.45 0 1613 6.39375e+08 3300 0 
+937500 6250 -3.39899e-12 2.31614e-13 6.48384e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+843750 6250 -1.48984e-12 5.38321e-14 6.48365e+08 1638.45 0 1613 6.39375e+08 3300 0 
+890625 6250 -2.11907e-12 1.20123e-13 6.48373e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+843750 12500 -1.47073e-12 1.07096e-13 6.2775e+08 1636.02 0 1613 6.1875e+08 3300 0 
+890625 12500 -2.09041e-12 2.39062e-13 6.27758e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+890625 6250 -2.11907e-12 1.20123e-13 6.48373e+08 1638.45 0 1613 6.39375e+08 3300 0 
+937500 6250 -3.39899e-12 2.31614e-13 6.48384e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+890625 12500 -2.09041e-12 2.39062e-13 6.27758e+08 1636.02 0 1613 6.1875e+08 3300 0 
+937500 12500 -3.35174e-12 4.61022e-13 6.27769e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+750000 12500 -1.23543e-12 -2.43547e-14 6.27736e+08 1636.02 0 1613 6.1875e+08 3300 0 
+796875 12500 -1.23413e-12 2.72888e-14 6.27743e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+750000 18750 -1.21203e-12 -3.64615e-14 6.0712e+08 1633.58 0 1613 5.98125e+08 3300 0 
+796875 18750 -1.20928e-12 4.04334e-14 6.07127e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+796875 12500 -1.23413e-12 2.72888e-14 6.27743e+08 1636.02 0 1613 6.1875e+08 3300 0 
+843750 12500 -1.47073e-12 1.07096e-13 6.2775e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+796875 18750 -1.20928e-12 4.04334e-14 6.07127e+08 1633.58 0 1613 5.98125e+08 3300 0 
+843750 18750 -1.43902e-12 1.59228e-13 6.07134e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+750000 18750 -1.21203e-12 -3.64615e-14 6.0712e+08 1633.58 0 1613 5.98125e+08 3300 0 
+796875 18750 -1.20928e-12 4.04334e-14 6.07127e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+750000 25000 -1.1794e-12 -4.84796e-14 5.86503e+08 1631.15 0 1613 5.775e+08 3300 0 
+796875 25000 -1.17469e-12 5.29874e-14 5.8651e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+796875 18750 -1.20928e-12 4.04334e-14 6.07127e+08 1633.58 0 1613 5.98125e+08 3300 0 
+843750 18750 -1.43902e-12 1.59228e-13 6.07134e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+796875 25000 -1.17469e-12 5.29874e-14 5.8651e+08 1631.15 0 1613 5.775e+08 3300 0 
+843750 25000 -1.39495e-12 2.0968e-13 5.86517e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+843750 12500 -1.47073e-12 1.07096e-13 6.2775e+08 1636.02 0 1613 6.1875e+08 3300 0 
+890625 12500 -2.09041e-12 2.39062e-13 6.27758e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+843750 18750 -1.43902e-12 1.59228e-13 6.07134e+08 1633.58 0 1613 5.98125e+08 3300 0 
+890625 18750 -2.0429e-12 3.55644e-13 6.07142e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+890625 12500 -2.09041e-12 2.39062e-13 6.27758e+08 1636.02 0 1613 6.1875e+08 3300 0 
+937500 12500 -3.35174e-12 4.61022e-13 6.27769e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+890625 18750 -2.0429e-12 3.55644e-13 6.07142e+08 1633.58 0 1613 5.98125e+08 3300 0 
+937500 18750 -3.27345e-12 6.86031e-13 6.07153e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+843750 18750 -1.43902e-12 1.59228e-13 6.07134e+08 1633.58 0 1613 5.98125e+08 3300 0 
+890625 18750 -2.0429e-12 3.55644e-13 6.07142e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+843750 25000 -1.39495e-12 2.0968e-13 5.86517e+08 1631.15 0 1613 5.775e+08 3300 0 
+890625 25000 -1.97693e-12 4.68723e-13 5.86524e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+890625 18750 -2.0429e-12 3.55644e-13 6.07142e+08 1633.58 0 1613 5.98125e+08 3300 0 
+937500 18750 -3.27345e-12 6.86031e-13 6.07153e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+890625 25000 -1.97693e-12 4.68723e-13 5.86524e+08 1631.15 0 1613 5.775e+08 3300 0 
+937500 25000 -3.16479e-12 9.04491e-13 5.86535e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+937500 0 -3.41478e-12 0 6.68998e+08 1640.89 0 1613 6.6e+08 3300 0 
+984375 0 -5.79073e-12 0 6.69018e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+937500 6250 -3.39899e-12 2.31614e-13 6.48384e+08 1638.45 0 1613 6.39375e+08 3300 0 
+984375 6250 -5.7638e-12 4.15081e-13 6.48404e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+984375 0 -5.79073e-12 0 6.69018e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.03125e+06 0 -9.90952e-12 0 6.69056e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+984375 6250 -5.7638e-12 4.15081e-13 6.48404e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.03125e+06 6250 -9.8641e-12 6.99615e-13 6.48442e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+937500 6250 -3.39899e-12 2.31614e-13 6.48384e+08 1638.45 0 1613 6.39375e+08 3300 0 
+984375 6250 -5.7638e-12 4.15081e-13 6.48404e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+937500 12500 -3.35174e-12 4.61022e-13 6.27769e+08 1636.02 0 1613 6.1875e+08 3300 0 
+984375 12500 -5.68323e-12 8.26325e-13 6.27789e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+984375 6250 -5.7638e-12 4.15081e-13 6.48404e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.03125e+06 6250 -9.8641e-12 6.99615e-13 6.48442e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+984375 12500 -5.68323e-12 8.26325e-13 6.27789e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.03125e+06 12500 -9.7282e-12 1.39313e-12 6.27826e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+1.03125e+06 0 -9.90952e-12 0 6.69056e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.07812e+06 0 -1.65817e-11 0 6.69131e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+1.03125e+06 6250 -9.8641e-12 6.99615e-13 6.48442e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.07812e+06 6250 -1.65083e-11 1.09082e-12 6.48517e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.07812e+06 0 -1.65817e-11 0 6.69131e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.125e+06 0 -2.63841e-11 0 6.69279e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+1.07812e+06 6250 -1.65083e-11 1.09082e-12 6.48517e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.125e+06 6250 -2.62746e-11 1.5088e-12 6.48664e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.03125e+06 6250 -9.8641e-12 6.99615e-13 6.48442e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.07812e+06 6250 -1.65083e-11 1.09082e-12 6.48517e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.03125e+06 12500 -9.7282e-12 1.39313e-12 6.27826e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.07812e+06 12500 -1.62886e-11 2.17284e-12 6.279e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+1.07812e+06 6250 -1.65083e-11 1.09082e-12 6.48517e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.125e+06 6250 -2.62746e-11 1.5088e-12 6.48664e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.07812e+06 12500 -1.62886e-11 2.17284e-12 6.279e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.125e+06 12500 -2.59468e-11 3.00749e-12 6.28045e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+937500 12500 -3.35174e-12 4.61022e-13 6.27769e+08 1636.02 0 1613 6.1875e+08 3300 0 
+984375 12500 -5.68323e-12 8.26325e-13 6.27789e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+937500 18750 -3.27345e-12 6.86031e-13 6.07153e+08 1633.58 0 1613 5.98125e+08 3300 0 
+984375 18750 -5.54972e-12 1.22994e-12 6.07172e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+984375 12500 -5.68323e-12 8.26325e-13 6.27789e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.03125e+06 12500 -9.7282e-12 1.39313e-12 6.27826e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+984375 18750 -5.54972e-12 1.22994e-12 6.07172e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.03125e+06 18750 -9.50289e-12 2.0744e-12 6.07208e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+937500 18750 -3.27345e-12 6.86031e-13 6.07153e+08 1633.58 0 1613 5.98125e+08 3300 0 
+984375 18750 -5.54972e-12 1.22994e-12 6.07172e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+937500 25000 -3.16479e-12 9.04491e-13 5.86535e+08 1631.15 0 1613 5.775e+08 3300 0 
+984375 25000 -5.36442e-12 1.6222e-12 5.86554e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+984375 18750 -5.54972e-12 1.22994e-12 6.07172e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.03125e+06 18750 -9.50289e-12 2.0744e-12 6.07208e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+984375 25000 -5.36442e-12 1.6222e-12 5.86554e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.03125e+06 25000 -9.18995e-12 2.73739e-12 5.86589e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+1.03125e+06 12500 -9.7282e-12 1.39313e-12 6.27826e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.07812e+06 12500 -1.62886e-11 2.17284e-12 6.279e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+1.03125e+06 18750 -9.50289e-12 2.0744e-12 6.07208e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.07812e+06 18750 -1.59241e-11 3.23753e-12 6.07281e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+1.07812e+06 12500 -1.62886e-11 2.17284e-12 6.279e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.125e+06 12500 -2.59468e-11 3.00749e-12 6.28045e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+1.07812e+06 18750 -1.59241e-11 3.23753e-12 6.07281e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.125e+06 18750 -2.54023e-11 4.48504e-12 6.07423e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+1.03125e+06 18750 -9.50289e-12 2.0744e-12 6.07208e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.07812e+06 18750 -1.59241e-11 3.23753e-12 6.07281e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+1.03125e+06 25000 -9.18995e-12 2.73739e-12 5.86589e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.07812e+06 25000 -1.54174e-11 4.27642e-12 5.8666e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+1.07812e+06 18750 -1.59241e-11 3.23753e-12 6.07281e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.125e+06 18750 -2.54023e-11 4.48504e-12 6.07423e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+1.07812e+06 25000 -1.54174e-11 4.27642e-12 5.8666e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.125e+06 25000 -2.46437e-11 5.93049e-12 5.86798e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+750000 25000 -1.1794e-12 -4.84796e-14 5.86503e+08 1631.15 0 1613 5.775e+08 3300 0 
+796875 25000 -1.17469e-12 5.29874e-14 5.8651e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+750000 31250 -1.13765e-12 -6.0372e-14 5.65885e+08 1628.72 0 1613 5.56875e+08 3300 0 
+796875 31250 -1.13054e-12 6.47695e-14 5.65892e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+796875 25000 -1.17469e-12 5.29874e-14 5.8651e+08 1631.15 0 1613 5.775e+08 3300 0 
+843750 25000 -1.39495e-12 2.0968e-13 5.86517e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+796875 31250 -1.13054e-12 6.47695e-14 5.65892e+08 1628.72 0 1613 5.56875e+08 3300 0 
+843750 31250 -1.33881e-12 2.5792e-13 5.65899e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+750000 31250 -1.13765e-12 -6.0372e-14 5.65885e+08 1628.72 0 1613 5.56875e+08 3300 0 
+796875 31250 -1.13054e-12 6.47695e-14 5.65892e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+750000 37500 -1.08696e-12 -7.20961e-14 5.45266e+08 1626.28 0 1613 5.3625e+08 3300 0 
+796875 37500 -1.07706e-12 7.56107e-14 5.45273e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+796875 31250 -1.13054e-12 6.47695e-14 5.65892e+08 1628.72 0 1613 5.56875e+08 3300 0 
+843750 31250 -1.33881e-12 2.5792e-13 5.65899e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+796875 37500 -1.07706e-12 7.56107e-14 5.45273e+08 1626.28 0 1613 5.3625e+08 3300 0 
+843750 37500 -1.271e-12 3.03444e-13 5.4528e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+843750 25000 -1.39495e-12 2.0968e-13 5.86517e+08 1631.15 0 1613 5.775e+08 3300 0 
+890625 25000 -1.97693e-12 4.68723e-13 5.86524e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+843750 31250 -1.33881e-12 2.5792e-13 5.65899e+08 1628.72 0 1613 5.56875e+08 3300 0 
+890625 31250 -1.89303e-12 5.77182e-13 5.65906e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+890625 25000 -1.97693e-12 4.68723e-13 5.86524e+08 1631.15 0 1613 5.775e+08 3300 0 
+937500 25000 -3.16479e-12 9.04491e-13 5.86535e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+890625 31250 -1.89303e-12 5.77182e-13 5.65906e+08 1628.72 0 1613 5.56875e+08 3300 0 
+937500 31250 -3.02669e-12 1.11432e-12 5.65917e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+843750 31250 -1.33881e-12 2.5792e-13 5.65899e+08 1628.72 0 1613 5.56875e+08 3300 0 
+890625 31250 -1.89303e-12 5.77182e-13 5.65906e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+843750 37500 -1.271e-12 3.03444e-13 5.4528e+08 1626.28 0 1613 5.3625e+08 3300 0 
+890625 37500 -1.79189e-12 6.79953e-13 5.45287e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+890625 31250 -1.89303e-12 5.77182e-13 5.65906e+08 1628.72 0 1613 5.56875e+08 3300 0 
+937500 31250 -3.02669e-12 1.11432e-12 5.65917e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+890625 37500 -1.79189e-12 6.79953e-13 5.45287e+08 1626.28 0 1613 5.3625e+08 3300 0 
+937500 37500 -2.86036e-12 1.31349e-12 5.45297e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+750000 37500 -1.08696e-12 -7.20961e-14 5.45266e+08 1626.28 0 1613 5.3625e+08 3300 0 
+796875 37500 -1.07706e-12 7.56107e-14 5.45273e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+750000 43750 -1.02752e-12 -8.36018e-14 5.24646e+08 1623.85 0 1613 5.15625e+08 3300 0 
+796875 43750 -1.01454e-12 8.53584e-14 5.24653e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+796875 37500 -1.07706e-12 7.56107e-14 5.45273e+08 1626.28 0 1613 5.3625e+08 3300 0 
+843750 37500 -1.271e-12 3.03444e-13 5.4528e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+796875 43750 -1.01454e-12 8.53584e-14 5.24653e+08 1623.85 0 1613 5.15625e+08 3300 0 
+843750 43750 -1.192e-12 3.45777e-13 5.2466e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+750000 43750 -1.02752e-12 -8.36018e-14 5.24646e+08 1623.85 0 1613 5.15625e+08 3300 0 
+796875 43750 -1.01454e-12 8.53584e-14 5.24653e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+750000 50000 -9.59555e-13 -9.48304e-14 5.04026e+08 1621.42 0 1613 4.95e+08 3300 0 
+796875 50000 -9.43322e-13 9.38785e-14 5.04032e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+796875 43750 -1.01454e-12 8.53584e-14 5.24653e+08 1623.85 0 1613 5.15625e+08 3300 0 
+843750 43750 -1.192e-12 3.45777e-13 5.2466e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+796875 50000 -9.43322e-13 9.38785e-14 5.04032e+08 1621.42 0 1613 4.95e+08 3300 0 
+843750 50000 -1.10235e-12 3.84481e-13 5.04038e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+843750 37500 -1.271e-12 3.03444e-13 5.4528e+08 1626.28 0 1613 5.3625e+08 3300 0 
+890625 37500 -1.79189e-12 6.79953e-13 5.45287e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+843750 43750 -1.192e-12 3.45777e-13 5.2466e+08 1623.85 0 1613 5.15625e+08 3300 0 
+890625 43750 -1.67433e-12 7.76025e-13 5.24666e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+890625 37500 -1.79189e-12 6.79953e-13 5.45287e+08 1626.28 0 1613 5.3625e+08 3300 0 
+937500 37500 -2.86036e-12 1.31349e-12 5.45297e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+890625 43750 -1.67433e-12 7.76025e-13 5.24666e+08 1623.85 0 1613 5.15625e+08 3300 0 
+937500 43750 -2.66722e-12 1.50011e-12 5.24676e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+843750 43750 -1.192e-12 3.45777e-13 5.2466e+08 1623.85 0 1613 5.15625e+08 3300 0 
+890625 43750 -1.67433e-12 7.76025e-13 5.24666e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+843750 50000 -1.10235e-12 3.84481e-13 5.04038e+08 1621.42 0 1613 4.95e+08 3300 0 
+890625 50000 -1.54131e-12 8.64454e-13 5.04045e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+890625 43750 -1.67433e-12 7.76025e-13 5.24666e+08 1623.85 0 1613 5.15625e+08 3300 0 
+937500 43750 -2.66722e-12 1.50011e-12 5.24676e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+890625 50000 -1.54131e-12 8.64454e-13 5.04045e+08 1621.42 0 1613 4.95e+08 3300 0 
+937500 50000 -2.44896e-12 1.67236e-12 5.04054e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+937500 25000 -3.16479e-12 9.04491e-13 5.86535e+08 1631.15 0 1613 5.775e+08 3300 0 
+984375 25000 -5.36442e-12 1.6222e-12 5.86554e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+937500 31250 -3.02669e-12 1.11432e-12 5.65917e+08 1628.72 0 1613 5.56875e+08 3300 0 
+984375 31250 -5.12892e-12 1.99944e-12 5.65934e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+984375 25000 -5.36442e-12 1.6222e-12 5.86554e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.03125e+06 25000 -9.18995e-12 2.73739e-12 5.86589e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+984375 31250 -5.12892e-12 1.99944e-12 5.65934e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.03125e+06 31250 -8.79186e-12 3.37622e-12 5.65968e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+937500 31250 -3.02669e-12 1.11432e-12 5.65917e+08 1628.72 0 1613 5.56875e+08 3300 0 
+984375 31250 -5.12892e-12 1.99944e-12 5.65934e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+937500 37500 -2.86036e-12 1.31349e-12 5.45297e+08 1626.28 0 1613 5.3625e+08 3300 0 
+984375 37500 -4.84525e-12 2.35813e-12 5.45314e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+984375 31250 -5.12892e-12 1.99944e-12 5.65934e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.03125e+06 31250 -8.79186e-12 3.37622e-12 5.65968e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+984375 37500 -4.84525e-12 2.35813e-12 5.45314e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.03125e+06 37500 -8.31183e-12 3.98519e-12 5.45346e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+1.03125e+06 25000 -9.18995e-12 2.73739e-12 5.86589e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.07812e+06 25000 -1.54174e-11 4.27642e-12 5.8666e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+1.03125e+06 31250 -8.79186e-12 3.37622e-12 5.65968e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.07812e+06 31250 -1.4772e-11 5.28083e-12 5.66036e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+1.07812e+06 25000 -1.54174e-11 4.27642e-12 5.8666e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.125e+06 25000 -2.46437e-11 5.93049e-12 5.86798e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+1.07812e+06 31250 -1.4772e-11 5.28083e-12 5.66036e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.125e+06 31250 -2.36746e-11 7.33395e-12 5.6617e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+1.03125e+06 31250 -8.79186e-12 3.37622e-12 5.65968e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.07812e+06 31250 -1.4772e-11 5.28083e-12 5.66036e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+1.03125e+06 37500 -8.31183e-12 3.98519e-12 5.45346e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.07812e+06 37500 -1.39923e-11 6.24222e-12 5.45411e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+1.07812e+06 31250 -1.4772e-11 5.28083e-12 5.66036e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.125e+06 31250 -2.36746e-11 7.33395e-12 5.6617e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+1.07812e+06 37500 -1.39923e-11 6.24222e-12 5.45411e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.125e+06 37500 -2.25001e-11 8.6856e-12 5.45538e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+937500 37500 -2.86036e-12 1.31349e-12 5.45297e+08 1626.28 0 1613 5.3625e+08 3300 0 
+984375 37500 -4.84525e-12 2.35813e-12 5.45314e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+937500 43750 -2.66722e-12 1.50011e-12 5.24676e+08 1623.85 0 1613 5.15625e+08 3300 0 
+984375 43750 -4.51587e-12 2.6949e-12 5.24692e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+984375 37500 -4.84525e-12 2.35813e-12 5.45314e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.03125e+06 37500 -8.31183e-12 3.98519e-12 5.45346e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+984375 43750 -4.51587e-12 2.6949e-12 5.24692e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.03125e+06 43750 -7.75374e-12 4.55869e-12 5.24722e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+937500 43750 -2.66722e-12 1.50011e-12 5.24676e+08 1623.85 0 1613 5.15625e+08 3300 0 
+984375 43750 -4.51587e-12 2.6949e-12 5.24692e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+937500 50000 -2.44896e-12 1.67236e-12 5.04054e+08 1621.42 0 1613 4.95e+08 3300 0 
+984375 50000 -4.14366e-12 3.00658e-12 5.04069e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+984375 43750 -4.51587e-12 2.6949e-12 5.24692e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.03125e+06 43750 -7.75374e-12 4.55869e-12 5.24722e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+984375 50000 -4.14366e-12 3.00658e-12 5.04069e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.03125e+06 50000 -7.12213e-12 5.09132e-12 5.04096e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.03125e+06 37500 -8.31183e-12 3.98519e-12 5.45346e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.07812e+06 37500 -1.39923e-11 6.24222e-12 5.45411e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+1.03125e+06 43750 -7.75374e-12 4.55869e-12 5.24722e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.07812e+06 43750 -1.30838e-11 7.15255e-12 5.24783e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+1.07812e+06 37500 -1.39923e-11 6.24222e-12 5.45411e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.125e+06 37500 -2.25001e-11 8.6856e-12 5.45538e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+1.07812e+06 43750 -1.30838e-11 7.15255e-12 5.24783e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.125e+06 43750 -2.11264e-11 9.97437e-12 5.24903e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+1.03125e+06 43750 -7.75374e-12 4.55869e-12 5.24722e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.07812e+06 43750 -1.30838e-11 7.15255e-12 5.24783e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+1.03125e+06 50000 -7.12213e-12 5.09132e-12 5.04096e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.07812e+06 50000 -1.20532e-11 8.00402e-12 5.04153e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.07812e+06 43750 -1.30838e-11 7.15255e-12 5.24783e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.125e+06 43750 -2.11264e-11 9.97437e-12 5.24903e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+1.07812e+06 50000 -1.20532e-11 8.00402e-12 5.04153e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.125e+06 50000 -1.95606e-11 1.11891e-11 5.04265e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.125e+06 0 -2.63841e-11 0 6.69279e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.17188e+06 0 -3.86921e-11 0 6.69551e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+1.125e+06 6250 -2.62746e-11 1.5088e-12 6.48664e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.17188e+06 6250 -3.85408e-11 1.6977e-12 6.48935e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.17188e+06 0 -3.86921e-11 0 6.69551e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.21875e+06 0 -5.03458e-11 0 6.70038e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+1.17188e+06 6250 -3.85408e-11 1.6977e-12 6.48935e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.21875e+06 6250 -5.01525e-11 1.27934e-12 6.49422e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.125e+06 6250 -2.62746e-11 1.5088e-12 6.48664e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.17188e+06 6250 -3.85408e-11 1.6977e-12 6.48935e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.125e+06 12500 -2.59468e-11 3.00749e-12 6.28045e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.17188e+06 12500 -3.80875e-11 3.38287e-12 6.28315e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+1.17188e+06 6250 -3.85408e-11 1.6977e-12 6.48935e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.21875e+06 6250 -5.01525e-11 1.27934e-12 6.49422e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.17188e+06 12500 -3.80875e-11 3.38287e-12 6.28315e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.21875e+06 12500 -4.95736e-11 2.55e-12 6.28799e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+1.21875e+06 0 -5.03458e-11 0 6.70038e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.26562e+06 0 -5.54816e-11 0 6.70757e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+1.21875e+06 6250 -5.01525e-11 1.27934e-12 6.49422e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.26562e+06 6250 -5.52036e-11 -1.20588e-13 6.50136e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.26562e+06 0 -5.54816e-11 0 6.70757e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.3125e+06 0 -4.64125e-11 0 6.72024e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+1.26562e+06 6250 -5.52036e-11 -1.20588e-13 6.50136e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.3125e+06 6250 -4.6023e-11 -2.32833e-12 6.5142e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.21875e+06 6250 -5.01525e-11 1.27934e-12 6.49422e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.26562e+06 6250 -5.52036e-11 -1.20588e-13 6.50136e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.21875e+06 12500 -4.95736e-11 2.55e-12 6.28799e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.26562e+06 12500 -5.43763e-11 -2.84338e-13 6.29514e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+1.26562e+06 6250 -5.52036e-11 -1.20588e-13 6.50136e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.3125e+06 6250 -4.6023e-11 -2.32833e-12 6.5142e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.26562e+06 12500 -5.43763e-11 -2.84338e-13 6.29514e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.3125e+06 12500 -4.48937e-11 -4.66288e-12 6.30776e+08 1562.66 0 1613 6.1875e+08 3300 0 
+
+
+1.125e+06 12500 -2.59468e-11 3.00749e-12 6.28045e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.17188e+06 12500 -3.80875e-11 3.38287e-12 6.28315e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+1.125e+06 18750 -2.54023e-11 4.48504e-12 6.07423e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.17188e+06 18750 -3.73345e-11 5.04636e-12 6.07692e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+1.17188e+06 12500 -3.80875e-11 3.38287e-12 6.28315e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.21875e+06 12500 -4.95736e-11 2.55e-12 6.28799e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+1.17188e+06 18750 -3.73345e-11 5.04636e-12 6.07692e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.21875e+06 18750 -4.8611e-11 3.79059e-12 6.08163e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+1.125e+06 18750 -2.54023e-11 4.48504e-12 6.07423e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.17188e+06 18750 -3.73345e-11 5.04636e-12 6.07692e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+1.125e+06 25000 -2.46437e-11 5.93049e-12 5.86798e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.17188e+06 25000 -3.62857e-11 6.67892e-12 5.87065e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+1.17188e+06 18750 -3.73345e-11 5.04636e-12 6.07692e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.21875e+06 18750 -4.8611e-11 3.79059e-12 6.08163e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+1.17188e+06 25000 -3.62857e-11 6.67892e-12 5.87065e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.21875e+06 25000 -4.72664e-11 4.98039e-12 5.87521e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+1.21875e+06 12500 -4.95736e-11 2.55e-12 6.28799e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.26562e+06 12500 -5.43763e-11 -2.84338e-13 6.29514e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+1.21875e+06 18750 -4.8611e-11 3.79059e-12 6.08163e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.26562e+06 18750 -5.30131e-11 -4.87065e-13 6.08909e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+1.26562e+06 12500 -5.43763e-11 -2.84338e-13 6.29514e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.3125e+06 12500 -4.48937e-11 -4.66288e-12 6.30776e+08 1562.66 0 1613 6.1875e+08 3300 0 
+
+1.26562e+06 18750 -5.30131e-11 -4.87065e-13 6.08909e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.3125e+06 18750 -4.30736e-11 -7.10431e-12 6.10036e+08 1502.39 0 1613 5.98125e+08 3300 0 
+
+
+1.21875e+06 18750 -4.8611e-11 3.79059e-12 6.08163e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.26562e+06 18750 -5.30131e-11 -4.87065e-13 6.08909e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+1.21875e+06 25000 -4.72664e-11 4.98039e-12 5.87521e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.26562e+06 25000 -5.11347e-11 -7.25832e-13 5.88298e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+1.26562e+06 18750 -5.30131e-11 -4.87065e-13 6.08909e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.3125e+06 18750 -4.30736e-11 -7.10431e-12 6.10036e+08 1502.39 0 1613 5.98125e+08 3300 0 
+
+1.26562e+06 25000 -5.11347e-11 -7.25832e-13 5.88298e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.3125e+06 25000 -4.0597e-11 -9.73424e-12 5.89279e+08 1442.39 0 1613 5.775e+08 3300 0 
+
+
+1.3125e+06 0 -4.64125e-11 0 6.72024e+08 1640.89 0 1613 6.6e+08 3300 0 
+1.35938e+06 0 -2.05331e-11 0 6.73274e+08 1258.72 0 1613 6.6e+08 3300 0 
+
+1.3125e+06 6250 -4.6023e-11 -2.32833e-12 6.5142e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.35938e+06 6250 -2.00313e-11 -4.70403e-12 6.52446e+08 1210.72 0 1613 6.39375e+08 3300 0 
+
+
+1.35938e+06 0 -2.05331e-11 0 6.73274e+08 1258.72 0 1613 6.6e+08 3300 0 
+1.40625e+06 0 1.19909e-11 0 6.75289e+08 1132.61 0 1613 6.6e+08 3300 0 
+
+1.35938e+06 6250 -2.00313e-11 -4.70403e-12 6.52446e+08 1210.72 0 1613 6.39375e+08 3300 0 
+1.40625e+06 6250 1.2525e-11 -3.29651e-12 6.54585e+08 1153.56 0 1613 6.39375e+08 3300 0 
+
+
+1.3125e+06 6250 -4.6023e-11 -2.32833e-12 6.5142e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.35938e+06 6250 -2.00313e-11 -4.70403e-12 6.52446e+08 1210.72 0 1613 6.39375e+08 3300 0 
+
+1.3125e+06 12500 -4.48937e-11 -4.66288e-12 6.30776e+08 1562.66 0 1613 6.1875e+08 3300 0 
+1.35938e+06 12500 -1.85482e-11 -9.58413e-12 6.31667e+08 1167.12 0 1613 6.1875e+08 3300 0 
+
+
+1.35938e+06 6250 -2.00313e-11 -4.70403e-12 6.52446e+08 1210.72 0 1613 6.39375e+08 3300 0 
+1.40625e+06 6250 1.2525e-11 -3.29651e-12 6.54585e+08 1153.56 0 1613 6.39375e+08 3300 0 
+
+1.35938e+06 12500 -1.85482e-11 -9.58413e-12 6.31667e+08 1167.12 0 1613 6.1875e+08 3300 0 
+1.40625e+06 12500 1.44415e-11 -5.96867e-12 6.33638e+08 1186.72 0 1613 6.1875e+08 3300 0 
+
+
+1.40625e+06 0 1.19909e-11 0 6.75289e+08 1132.61 0 1613 6.6e+08 3300 0 
+1.45312e+06 0 2.79411e-11 0 6.73719e+08 1571.14 1 1613 6.6e+08 3300 0 
+
+1.40625e+06 6250 1.2525e-11 -3.29651e-12 6.54585e+08 1153.56 0 1613 6.39375e+08 3300 0 
+1.45312e+06 6250 2.71929e-11 4.30305e-12 6.53022e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.45312e+06 0 2.79411e-11 0 6.73719e+08 1571.14 1 1613 6.6e+08 3300 0 
+1.5e+06 0 0 0 6.71643e+08 1640.89 0 1613 6.6e+08 3300 0 
+
+1.45312e+06 6250 2.71929e-11 4.30305e-12 6.53022e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.5e+06 6250 0 0 6.50947e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+
+1.40625e+06 6250 1.2525e-11 -3.29651e-12 6.54585e+08 1153.56 0 1613 6.39375e+08 3300 0 
+1.45312e+06 6250 2.71929e-11 4.30305e-12 6.53022e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.40625e+06 12500 1.44415e-11 -5.96867e-12 6.33638e+08 1186.72 0 1613 6.1875e+08 3300 0 
+1.45312e+06 12500 2.47704e-11 9.43903e-12 6.32231e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+1.45312e+06 6250 2.71929e-11 4.30305e-12 6.53022e+08 1638.45 0 1613 6.39375e+08 3300 0 
+1.5e+06 6250 0 0 6.50947e+08 1638.45 0 1613 6.39375e+08 3300 0 
+
+1.45312e+06 12500 2.47704e-11 9.43903e-12 6.32231e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.5e+06 12500 0 0 6.3011e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+
+1.3125e+06 12500 -4.48937e-11 -4.66288e-12 6.30776e+08 1562.66 0 1613 6.1875e+08 3300 0 
+1.35938e+06 12500 -1.85482e-11 -9.58413e-12 6.31667e+08 1167.12 0 1613 6.1875e+08 3300 0 
+
+1.3125e+06 18750 -4.30736e-11 -7.10431e-12 6.10036e+08 1502.39 0 1613 5.98125e+08 3300 0 
+1.35938e+06 18750 -1.61622e-11 -1.42199e-11 6.11146e+08 1129.08 0 1613 5.98125e+08 3300 0 
+
+
+1.35938e+06 12500 -1.85482e-11 -9.58413e-12 6.31667e+08 1167.12 0 1613 6.1875e+08 3300 0 
+1.40625e+06 12500 1.44415e-11 -5.96867e-12 6.33638e+08 1186.72 0 1613 6.1875e+08 3300 0 
+
+1.35938e+06 18750 -1.61622e-11 -1.42199e-11 6.11146e+08 1129.08 0 1613 5.98125e+08 3300 0 
+1.40625e+06 18750 1.78026e-11 -9.34284e-12 6.11688e+08 1232.18 0 1613 5.98125e+08 3300 0 
+
+
+1.3125e+06 18750 -4.30736e-11 -7.10431e-12 6.10036e+08 1502.39 0 1613 5.98125e+08 3300 0 
+1.35938e+06 18750 -1.61622e-11 -1.42199e-11 6.11146e+08 1129.08 0 1613 5.98125e+08 3300 0 
+
+1.3125e+06 25000 -4.0597e-11 -9.73424e-12 5.89279e+08 1442.39 0 1613 5.775e+08 3300 0 
+1.35938e+06 25000 -1.314e-11 -1.82562e-11 5.90607e+08 1097.91 0 1613 5.775e+08 3300 0 
+
+
+1.35938e+06 18750 -1.61622e-11 -1.42199e-11 6.11146e+08 1129.08 0 1613 5.98125e+08 3300 0 
+1.40625e+06 18750 1.78026e-11 -9.34284e-12 6.11688e+08 1232.18 0 1613 5.98125e+08 3300 0 
+
+1.35938e+06 25000 -1.314e-11 -1.82562e-11 5.90607e+08 1097.91 0 1613 5.775e+08 3300 0 
+1.40625e+06 25000 2.12337e-11 -1.47291e-11 5.89805e+08 1289.57 0 1613 5.775e+08 3300 0 
+
+
+1.40625e+06 12500 1.44415e-11 -5.96867e-12 6.33638e+08 1186.72 0 1613 6.1875e+08 3300 0 
+1.45312e+06 12500 2.47704e-11 9.43903e-12 6.32231e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+1.40625e+06 18750 1.78026e-11 -9.34284e-12 6.11688e+08 1232.18 0 1613 5.98125e+08 3300 0 
+1.45312e+06 18750 2.07596e-11 1.37836e-11 6.10028e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+1.45312e+06 12500 2.47704e-11 9.43903e-12 6.32231e+08 1636.02 0 1613 6.1875e+08 3300 0 
+1.5e+06 12500 0 0 6.3011e+08 1636.02 0 1613 6.1875e+08 3300 0 
+
+1.45312e+06 18750 2.07596e-11 1.37836e-11 6.10028e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.5e+06 18750 0 0 6.10193e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+
+1.40625e+06 18750 1.78026e-11 -9.34284e-12 6.11688e+08 1232.18 0 1613 5.98125e+08 3300 0 
+1.45312e+06 18750 2.07596e-11 1.37836e-11 6.10028e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+1.40625e+06 25000 2.12337e-11 -1.47291e-11 5.89805e+08 1289.57 0 1613 5.775e+08 3300 0 
+1.45312e+06 25000 1.64207e-11 1.54839e-11 5.87807e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+1.45312e+06 18750 2.07596e-11 1.37836e-11 6.10028e+08 1633.58 0 1613 5.98125e+08 3300 0 
+1.5e+06 18750 0 0 6.10193e+08 1633.58 0 1613 5.98125e+08 3300 0 
+
+1.45312e+06 25000 1.64207e-11 1.54839e-11 5.87807e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.5e+06 25000 0 0 5.90188e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+
+1.125e+06 25000 -2.46437e-11 5.93049e-12 5.86798e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.17188e+06 25000 -3.62857e-11 6.67892e-12 5.87065e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+1.125e+06 31250 -2.36746e-11 7.33395e-12 5.6617e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.17188e+06 31250 -3.49468e-11 8.2676e-12 5.66431e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+1.17188e+06 25000 -3.62857e-11 6.67892e-12 5.87065e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.21875e+06 25000 -4.72664e-11 4.98039e-12 5.87521e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+1.17188e+06 31250 -3.49468e-11 8.2676e-12 5.66431e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.21875e+06 31250 -4.55422e-11 6.11319e-12 5.66878e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+1.125e+06 31250 -2.36746e-11 7.33395e-12 5.6617e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.17188e+06 31250 -3.49468e-11 8.2676e-12 5.66431e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+1.125e+06 37500 -2.25001e-11 8.6856e-12 5.45538e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.17188e+06 37500 -3.33241e-11 9.79941e-12 5.45793e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+1.17188e+06 31250 -3.49468e-11 8.2676e-12 5.66431e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.21875e+06 31250 -4.55422e-11 6.11319e-12 5.66878e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+1.17188e+06 37500 -3.33241e-11 9.79941e-12 5.45793e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.21875e+06 37500 -4.34436e-11 7.18435e-12 5.4623e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+1.21875e+06 25000 -4.72664e-11 4.98039e-12 5.87521e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.26562e+06 25000 -5.11347e-11 -7.25832e-13 5.88298e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+1.21875e+06 31250 -4.55422e-11 6.11319e-12 5.66878e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.26562e+06 31250 -4.87626e-11 -1.04952e-12 5.67661e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+1.26562e+06 25000 -5.11347e-11 -7.25832e-13 5.88298e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.3125e+06 25000 -4.0597e-11 -9.73424e-12 5.89279e+08 1442.39 0 1613 5.775e+08 3300 0 
+
+1.26562e+06 31250 -4.87626e-11 -1.04952e-12 5.67661e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.3125e+06 31250 -3.74982e-11 -1.24234e-11 5.68593e+08 1382.99 0 1613 5.56875e+08 3300 0 
+
+
+1.21875e+06 31250 -4.55422e-11 6.11319e-12 5.66878e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.26562e+06 31250 -4.87626e-11 -1.04952e-12 5.67661e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+1.21875e+06 37500 -4.34436e-11 7.18435e-12 5.4623e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.26562e+06 37500 -4.5913e-11 -1.50928e-12 5.47012e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+1.26562e+06 31250 -4.87626e-11 -1.04952e-12 5.67661e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.3125e+06 31250 -3.74982e-11 -1.24234e-11 5.68593e+08 1382.99 0 1613 5.56875e+08 3300 0 
+
+1.26562e+06 37500 -4.5913e-11 -1.50928e-12 5.47012e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.3125e+06 37500 -3.38463e-11 -1.507e-11 5.47889e+08 1324.55 0 1613 5.3625e+08 3300 0 
+
+
+1.125e+06 37500 -2.25001e-11 8.6856e-12 5.45538e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.17188e+06 37500 -3.33241e-11 9.79941e-12 5.45793e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+1.125e+06 43750 -2.11264e-11 9.97437e-12 5.24903e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.17188e+06 43750 -3.14254e-11 1.12666e-11 5.25152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+1.17188e+06 37500 -3.33241e-11 9.79941e-12 5.45793e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.21875e+06 37500 -4.34436e-11 7.18435e-12 5.4623e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+1.17188e+06 43750 -3.14254e-11 1.12666e-11 5.25152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.21875e+06 43750 -4.09775e-11 8.17252e-12 5.2557e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+1.125e+06 43750 -2.11264e-11 9.97437e-12 5.24903e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.17188e+06 43750 -3.14254e-11 1.12666e-11 5.25152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+1.125e+06 50000 -1.95606e-11 1.11891e-11 5.04265e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.17188e+06 50000 -2.92598e-11 1.26621e-11 5.04506e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.17188e+06 43750 -3.14254e-11 1.12666e-11 5.25152e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.21875e+06 43750 -4.09775e-11 8.17252e-12 5.2557e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+1.17188e+06 50000 -2.92598e-11 1.26621e-11 5.04506e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.21875e+06 50000 -3.81506e-11 9.05454e-12 5.04905e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.21875e+06 37500 -4.34436e-11 7.18435e-12 5.4623e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.26562e+06 37500 -4.5913e-11 -1.50928e-12 5.47012e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+1.21875e+06 43750 -4.09775e-11 8.17252e-12 5.2557e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.26562e+06 43750 -4.26159e-11 -2.08362e-12 5.2638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+1.26562e+06 37500 -4.5913e-11 -1.50928e-12 5.47012e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.3125e+06 37500 -3.38463e-11 -1.507e-11 5.47889e+08 1324.55 0 1613 5.3625e+08 3300 0 
+
+1.26562e+06 43750 -4.26159e-11 -2.08362e-12 5.2638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.3125e+06 43750 -2.97361e-11 -1.7844e-11 5.27053e+08 1267.52 0 1613 5.15625e+08 3300 0 
+
+
+1.21875e+06 43750 -4.09775e-11 8.17252e-12 5.2557e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.26562e+06 43750 -4.26159e-11 -2.08362e-12 5.2638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+1.21875e+06 50000 -3.81506e-11 9.05454e-12 5.04905e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.26562e+06 50000 -3.89136e-11 -2.74461e-12 5.05735e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.26562e+06 43750 -4.26159e-11 -2.08362e-12 5.2638e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.3125e+06 43750 -2.97361e-11 -1.7844e-11 5.27053e+08 1267.52 0 1613 5.15625e+08 3300 0 
+
+1.26562e+06 50000 -3.89136e-11 -2.74461e-12 5.05735e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.3125e+06 50000 -2.51982e-11 -2.09203e-11 5.06209e+08 1212.52 0 1613 4.95e+08 3300 0 
+
+
+1.3125e+06 25000 -4.0597e-11 -9.73424e-12 5.89279e+08 1442.39 0 1613 5.775e+08 3300 0 
+1.35938e+06 25000 -1.314e-11 -1.82562e-11 5.90607e+08 1097.91 0 1613 5.775e+08 3300 0 
+
+1.3125e+06 31250 -3.74982e-11 -1.24234e-11 5.68593e+08 1382.99 0 1613 5.56875e+08 3300 0 
+1.35938e+06 31250 -9.73978e-12 -2.2239e-11 5.69736e+08 1075.08 0 1613 5.56875e+08 3300 0 
+
+
+1.35938e+06 25000 -1.314e-11 -1.82562e-11 5.90607e+08 1097.91 0 1613 5.775e+08 3300 0 
+1.40625e+06 25000 2.12337e-11 -1.47291e-11 5.89805e+08 1289.57 0 1613 5.775e+08 3300 0 
+
+1.35938e+06 31250 -9.73978e-12 -2.2239e-11 5.69736e+08 1075.08 0 1613 5.56875e+08 3300 0 
+1.40625e+06 31250 2.33709e-11 -2.06445e-11 5.69235e+08 1357.96 0 1613 5.56875e+08 3300 0 
+
+
+1.3125e+06 31250 -3.74982e-11 -1.24234e-11 5.68593e+08 1382.99 0 1613 5.56875e+08 3300 0 
+1.35938e+06 31250 -9.73978e-12 -2.2239e-11 5.69736e+08 1075.08 0 1613 5.56875e+08 3300 0 
+
+1.3125e+06 37500 -3.38463e-11 -1.507e-11 5.47889e+08 1324.55 0 1613 5.3625e+08 3300 0 
+1.35938e+06 37500 -6.08888e-12 -2.67933e-11 5.4884e+08 1062.15 0 1613 5.3625e+08 3300 0 
+
+
+1.35938e+06 31250 -9.73978e-12 -2.2239e-11 5.69736e+08 1075.08 0 1613 5.56875e+08 3300 0 
+1.40625e+06 31250 2.33709e-11 -2.06445e-11 5.69235e+08 1357.96 0 1613 5.56875e+08 3300 0 
+
+1.35938e+06 37500 -6.08888e-12 -2.67933e-11 5.4884e+08 1062.15 0 1613 5.3625e+08 3300 0 
+1.40625e+06 37500 2.43132e-11 -2.5866e-11 5.4872e+08 1435.85 1 1613 5.3625e+08 3300 0 
+
+
+1.40625e+06 25000 2.12337e-11 -1.47291e-11 5.89805e+08 1289.57 0 1613 5.775e+08 3300 0 
+1.45312e+06 25000 1.64207e-11 1.54839e-11 5.87807e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+1.40625e+06 31250 2.33709e-11 -2.06445e-11 5.69235e+08 1357.96 0 1613 5.56875e+08 3300 0 
+1.45312e+06 31250 1.29477e-11 1.62131e-11 5.6684e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+1.45312e+06 25000 1.64207e-11 1.54839e-11 5.87807e+08 1631.15 0 1613 5.775e+08 3300 0 
+1.5e+06 25000 0 0 5.90188e+08 1631.15 0 1613 5.775e+08 3300 0 
+
+1.45312e+06 31250 1.29477e-11 1.62131e-11 5.6684e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.5e+06 31250 0 0 5.69179e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+
+1.40625e+06 31250 2.33709e-11 -2.06445e-11 5.69235e+08 1357.96 0 1613 5.56875e+08 3300 0 
+1.45312e+06 31250 1.29477e-11 1.62131e-11 5.6684e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+1.40625e+06 37500 2.43132e-11 -2.5866e-11 5.4872e+08 1435.85 1 1613 5.3625e+08 3300 0 
+1.45312e+06 37500 1.0285e-11 1.74978e-11 5.46129e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+1.45312e+06 31250 1.29477e-11 1.62131e-11 5.6684e+08 1628.72 0 1613 5.56875e+08 3300 0 
+1.5e+06 31250 0 0 5.69179e+08 1628.72 0 1613 5.56875e+08 3300 0 
+
+1.45312e+06 37500 1.0285e-11 1.74978e-11 5.46129e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.5e+06 37500 0 0 5.47988e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+
+1.3125e+06 37500 -3.38463e-11 -1.507e-11 5.47889e+08 1324.55 0 1613 5.3625e+08 3300 0 
+1.35938e+06 37500 -6.08888e-12 -2.67933e-11 5.4884e+08 1062.15 0 1613 5.3625e+08 3300 0 
+
+1.3125e+06 43750 -2.97361e-11 -1.7844e-11 5.27053e+08 1267.52 0 1613 5.15625e+08 3300 0 
+1.35938e+06 43750 -2.33025e-12 -3.12114e-11 5.28329e+08 1060.73 0 1613 5.15625e+08 3300 0 
+
+
+1.35938e+06 37500 -6.08888e-12 -2.67933e-11 5.4884e+08 1062.15 0 1613 5.3625e+08 3300 0 
+1.40625e+06 37500 2.43132e-11 -2.5866e-11 5.4872e+08 1435.85 1 1613 5.3625e+08 3300 0 
+
+1.35938e+06 43750 -2.33025e-12 -3.12114e-11 5.28329e+08 1060.73 0 1613 5.15625e+08 3300 0 
+1.40625e+06 43750 2.4446e-11 -2.75883e-11 5.2652e+08 1521.16 1 1613 5.15625e+08 3300 0 
+
+
+1.3125e+06 43750 -2.97361e-11 -1.7844e-11 5.27053e+08 1267.52 0 1613 5.15625e+08 3300 0 
+1.35938e+06 43750 -2.33025e-12 -3.12114e-11 5.28329e+08 1060.73 0 1613 5.15625e+08 3300 0 
+
+1.3125e+06 50000 -2.51982e-11 -2.09203e-11 5.06209e+08 1212.52 0 1613 4.95e+08 3300 0 
+1.35938e+06 50000 1.66431e-12 -3.47459e-11 5.07744e+08 1072.31 0 1613 4.95e+08 3300 0 
+
+
+1.35938e+06 43750 -2.33025e-12 -3.12114e-11 5.28329e+08 1060.73 0 1613 5.15625e+08 3300 0 
+1.40625e+06 43750 2.4446e-11 -2.75883e-11 5.2652e+08 1521.16 1 1613 5.15625e+08 3300 0 
+
+1.35938e+06 50000 1.66431e-12 -3.47459e-11 5.07744e+08 1072.31 0 1613 4.95e+08 3300 0 
+1.40625e+06 50000 2.37754e-11 -2.47427e-11 5.04825e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.40625e+06 37500 2.43132e-11 -2.5866e-11 5.4872e+08 1435.85 1 1613 5.3625e+08 3300 0 
+1.45312e+06 37500 1.0285e-11 1.74978e-11 5.46129e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+1.40625e+06 43750 2.4446e-11 -2.75883e-11 5.2652e+08 1521.16 1 1613 5.15625e+08 3300 0 
+1.45312e+06 43750 8.07514e-12 1.94051e-11 5.25598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+1.45312e+06 37500 1.0285e-11 1.74978e-11 5.46129e+08 1626.28 0 1613 5.3625e+08 3300 0 
+1.5e+06 37500 0 0 5.47988e+08 1626.28 0 1613 5.3625e+08 3300 0 
+
+1.45312e+06 43750 8.07514e-12 1.94051e-11 5.25598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.5e+06 43750 0 0 5.26713e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+
+1.40625e+06 43750 2.4446e-11 -2.75883e-11 5.2652e+08 1521.16 1 1613 5.15625e+08 3300 0 
+1.45312e+06 43750 8.07514e-12 1.94051e-11 5.25598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+1.40625e+06 50000 2.37754e-11 -2.47427e-11 5.04825e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.45312e+06 50000 6.02591e-12 2.16692e-11 5.04923e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+1.45312e+06 43750 8.07514e-12 1.94051e-11 5.25598e+08 1623.85 0 1613 5.15625e+08 3300 0 
+1.5e+06 43750 0 0 5.26713e+08 1623.85 0 1613 5.15625e+08 3300 0 
+
+1.45312e+06 50000 6.02591e-12 2.16692e-11 5.04923e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.5e+06 50000 0 0 5.05583e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+
+750000 50000 -9.59555e-13 -9.48304e-14 5.04026e+08 1621.42 0 1613 4.95e+08 3300 0 
+796875 50000 -9.43322e-13 9.38785e-14 5.04032e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+750000 56250 -8.83324e-13 -1.05714e-13 4.83404e+08 1618.98 0 1613 4.74375e+08 3300 0 
+796875 56250 -8.63774e-13 1.01058e-13 4.8341e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+796875 50000 -9.43322e-13 9.38785e-14 5.04032e+08 1621.42 0 1613 4.95e+08 3300 0 
+843750 50000 -1.10235e-12 3.84481e-13 5.04038e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+796875 56250 -8.63774e-13 1.01058e-13 4.8341e+08 1618.98 0 1613 4.74375e+08 3300 0 
+843750 56250 -1.00266e-12 4.19159e-13 4.83416e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+750000 56250 -8.83324e-13 -1.05714e-13 4.83404e+08 1618.98 0 1613 4.74375e+08 3300 0 
+796875 56250 -8.63774e-13 1.01058e-13 4.8341e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+750000 62500 -7.99116e-13 -1.16172e-13 4.62781e+08 1616.55 0 1613 4.5375e+08 3300 0 
+796875 62500 -7.76317e-13 1.06809e-13 4.62787e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+796875 56250 -8.63774e-13 1.01058e-13 4.8341e+08 1618.98 0 1613 4.74375e+08 3300 0 
+843750 56250 -1.00266e-12 4.19159e-13 4.83416e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+796875 62500 -7.76317e-13 1.06809e-13 4.62787e+08 1616.55 0 1613 4.5375e+08 3300 0 
+843750 62500 -8.93641e-13 4.49463e-13 4.62793e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+843750 50000 -1.10235e-12 3.84481e-13 5.04038e+08 1621.42 0 1613 4.95e+08 3300 0 
+890625 50000 -1.54131e-12 8.64454e-13 5.04045e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+843750 56250 -1.00266e-12 4.19159e-13 4.83416e+08 1618.98 0 1613 4.74375e+08 3300 0 
+890625 56250 -1.3939e-12 9.44372e-13 4.83423e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+890625 50000 -1.54131e-12 8.64454e-13 5.04045e+08 1621.42 0 1613 4.95e+08 3300 0 
+937500 50000 -2.44896e-12 1.67236e-12 5.04054e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+890625 56250 -1.3939e-12 9.44372e-13 4.83423e+08 1618.98 0 1613 4.74375e+08 3300 0 
+937500 56250 -2.20747e-12 1.82857e-12 4.83431e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+843750 56250 -1.00266e-12 4.19159e-13 4.83416e+08 1618.98 0 1613 4.74375e+08 3300 0 
+890625 56250 -1.3939e-12 9.44372e-13 4.83423e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+843750 62500 -8.93641e-13 4.49463e-13 4.62793e+08 1616.55 0 1613 4.5375e+08 3300 0 
+890625 62500 -1.2333e-12 1.01499e-12 4.62799e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+890625 56250 -1.3939e-12 9.44372e-13 4.83423e+08 1618.98 0 1613 4.74375e+08 3300 0 
+937500 56250 -2.20747e-12 1.82857e-12 4.83431e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+890625 62500 -1.2333e-12 1.01499e-12 4.62799e+08 1616.55 0 1613 4.5375e+08 3300 0 
+937500 62500 -1.94484e-12 1.96723e-12 4.62807e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+750000 62500 -7.99116e-13 -1.16172e-13 4.62781e+08 1616.55 0 1613 4.5375e+08 3300 0 
+796875 62500 -7.76317e-13 1.06809e-13 4.62787e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+750000 68750 -7.07246e-13 -1.26114e-13 4.42157e+08 1614.11 0 1613 4.33125e+08 3300 0 
+796875 68750 -6.81409e-13 1.11066e-13 4.42163e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+796875 62500 -7.76317e-13 1.06809e-13 4.62787e+08 1616.55 0 1613 4.5375e+08 3300 0 
+843750 62500 -8.93641e-13 4.49463e-13 4.62793e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+796875 68750 -6.81409e-13 1.11066e-13 4.42163e+08 1614.11 0 1613 4.33125e+08 3300 0 
+843750 68750 -7.76023e-13 4.75094e-13 4.42169e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+750000 68750 -7.07246e-13 -1.26114e-13 4.42157e+08 1614.11 0 1613 4.33125e+08 3300 0 
+796875 68750 -6.81409e-13 1.11066e-13 4.42163e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+750000 75000 -6.08057e-13 -1.35437e-13 4.21532e+08 1611.68 0 1613 4.125e+08 3300 0 
+796875 75000 -5.7954e-13 1.13794e-13 4.21539e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+796875 68750 -6.81409e-13 1.11066e-13 4.42163e+08 1614.11 0 1613 4.33125e+08 3300 0 
+843750 68750 -7.76023e-13 4.75094e-13 4.42169e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+796875 75000 -5.7954e-13 1.13794e-13 4.21539e+08 1611.68 0 1613 4.125e+08 3300 0 
+843750 75000 -6.50613e-13 4.95808e-13 4.21544e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+843750 62500 -8.93641e-13 4.49463e-13 4.62793e+08 1616.55 0 1613 4.5375e+08 3300 0 
+890625 62500 -1.2333e-12 1.01499e-12 4.62799e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+843750 68750 -7.76023e-13 4.75094e-13 4.42169e+08 1614.11 0 1613 4.33125e+08 3300 0 
+890625 68750 -1.06081e-12 1.07563e-12 4.42174e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+890625 62500 -1.2333e-12 1.01499e-12 4.62799e+08 1616.55 0 1613 4.5375e+08 3300 0 
+937500 62500 -1.94484e-12 1.96723e-12 4.62807e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+890625 68750 -1.06081e-12 1.07563e-12 4.42174e+08 1614.11 0 1613 4.33125e+08 3300 0 
+937500 68750 -1.66337e-12 2.08701e-12 4.42181e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+843750 68750 -7.76023e-13 4.75094e-13 4.42169e+08 1614.11 0 1613 4.33125e+08 3300 0 
+890625 68750 -1.06081e-12 1.07563e-12 4.42174e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+843750 75000 -6.50613e-13 4.95808e-13 4.21544e+08 1611.68 0 1613 4.125e+08 3300 0 
+890625 75000 -8.77811e-13 1.12568e-12 4.21549e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+890625 68750 -1.06081e-12 1.07563e-12 4.42174e+08 1614.11 0 1613 4.33125e+08 3300 0 
+937500 68750 -1.66337e-12 2.08701e-12 4.42181e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+890625 75000 -8.77811e-13 1.12568e-12 4.21549e+08 1611.68 0 1613 4.125e+08 3300 0 
+937500 75000 -1.36553e-12 2.18672e-12 4.21555e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+937500 50000 -2.44896e-12 1.67236e-12 5.04054e+08 1621.42 0 1613 4.95e+08 3300 0 
+984375 50000 -4.14366e-12 3.00658e-12 5.04069e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+937500 56250 -2.20747e-12 1.82857e-12 4.83431e+08 1618.98 0 1613 4.74375e+08 3300 0 
+984375 56250 -3.73185e-12 3.29018e-12 4.83444e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+984375 50000 -4.14366e-12 3.00658e-12 5.04069e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.03125e+06 50000 -7.12213e-12 5.09132e-12 5.04096e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+984375 56250 -3.73185e-12 3.29018e-12 4.83444e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.03125e+06 56250 -6.42222e-12 5.57803e-12 4.8347e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+937500 56250 -2.20747e-12 1.82857e-12 4.83431e+08 1618.98 0 1613 4.74375e+08 3300 0 
+984375 56250 -3.73185e-12 3.29018e-12 4.83444e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+937500 62500 -1.94484e-12 1.96723e-12 4.62807e+08 1616.55 0 1613 4.5375e+08 3300 0 
+984375 62500 -3.28407e-12 3.54292e-12 4.62819e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+984375 56250 -3.73185e-12 3.29018e-12 4.83444e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.03125e+06 56250 -6.42222e-12 5.57803e-12 4.8347e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+984375 62500 -3.28407e-12 3.54292e-12 4.62819e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.03125e+06 62500 -5.65988e-12 6.0142e-12 4.62841e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+1.03125e+06 50000 -7.12213e-12 5.09132e-12 5.04096e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.07812e+06 50000 -1.20532e-11 8.00402e-12 5.04153e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.03125e+06 56250 -6.42222e-12 5.57803e-12 4.8347e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.07812e+06 56250 -1.09079e-11 8.78897e-12 4.83522e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+1.07812e+06 50000 -1.20532e-11 8.00402e-12 5.04153e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.125e+06 50000 -1.95606e-11 1.11891e-11 5.04265e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.07812e+06 56250 -1.09079e-11 8.78897e-12 4.83522e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.125e+06 56250 -1.78112e-11 1.23192e-11 4.83625e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+1.03125e+06 56250 -6.42222e-12 5.57803e-12 4.8347e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.07812e+06 56250 -1.09079e-11 8.78897e-12 4.83522e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+1.03125e+06 62500 -5.65988e-12 6.0142e-12 4.62841e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.07812e+06 62500 -9.65645e-12 9.49944e-12 4.62887e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+1.07812e+06 56250 -1.09079e-11 8.78897e-12 4.83522e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.125e+06 56250 -1.78112e-11 1.23192e-11 4.83625e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+1.07812e+06 62500 -9.65645e-12 9.49944e-12 4.62887e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.125e+06 62500 -1.58885e-11 1.33562e-11 4.62982e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+937500 62500 -1.94484e-12 1.96723e-12 4.62807e+08 1616.55 0 1613 4.5375e+08 3300 0 
+984375 62500 -3.28407e-12 3.54292e-12 4.62819e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+937500 68750 -1.66337e-12 2.08701e-12 4.42181e+08 1614.11 0 1613 4.33125e+08 3300 0 
+984375 68750 -2.80427e-12 3.76227e-12 4.42192e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+984375 62500 -3.28407e-12 3.54292e-12 4.62819e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.03125e+06 62500 -5.65988e-12 6.0142e-12 4.62841e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+984375 68750 -2.80427e-12 3.76227e-12 4.42192e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.03125e+06 68750 -4.84161e-12 6.39568e-12 4.42212e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+937500 68750 -1.66337e-12 2.08701e-12 4.42181e+08 1614.11 0 1613 4.33125e+08 3300 0 
+984375 68750 -2.80427e-12 3.76227e-12 4.42192e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+937500 75000 -1.36553e-12 2.18672e-12 4.21555e+08 1611.68 0 1613 4.125e+08 3300 0 
+984375 75000 -2.29667e-12 3.94602e-12 4.21564e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+984375 68750 -2.80427e-12 3.76227e-12 4.42192e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.03125e+06 68750 -4.84161e-12 6.39568e-12 4.42212e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+984375 75000 -2.29667e-12 3.94602e-12 4.21564e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.03125e+06 75000 -3.97453e-12 6.71854e-12 4.21581e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+1.03125e+06 62500 -5.65988e-12 6.0142e-12 4.62841e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.07812e+06 62500 -9.65645e-12 9.49944e-12 4.62887e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+1.03125e+06 68750 -4.84161e-12 6.39568e-12 4.42212e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.07812e+06 68750 -8.30814e-12 1.01276e-11 4.42251e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+1.07812e+06 62500 -9.65645e-12 9.49944e-12 4.62887e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.125e+06 62500 -1.58885e-11 1.33562e-11 4.62982e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+1.07812e+06 68750 -8.30814e-12 1.01276e-11 4.42251e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.125e+06 68750 -1.38044e-11 1.42925e-11 4.42338e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+1.03125e+06 68750 -4.84161e-12 6.39568e-12 4.42212e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.07812e+06 68750 -8.30814e-12 1.01276e-11 4.42251e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+1.03125e+06 75000 -3.97453e-12 6.71854e-12 4.21581e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.07812e+06 75000 -6.87327e-12 1.06666e-11 4.21613e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+1.07812e+06 68750 -8.30814e-12 1.01276e-11 4.42251e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.125e+06 68750 -1.38044e-11 1.42925e-11 4.42338e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+1.07812e+06 75000 -6.87327e-12 1.06666e-11 4.21613e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.125e+06 75000 -1.15729e-11 1.51189e-11 4.21691e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+750000 75000 -6.08057e-13 -1.35437e-13 4.21532e+08 1611.68 0 1613 4.125e+08 3300 0 
+796875 75000 -5.7954e-13 1.13794e-13 4.21539e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+750000 81250 -5.01912e-13 -1.44021e-13 4.00907e+08 1609.25 0 1613 3.91875e+08 3300 0 
+796875 81250 -4.71234e-13 1.14992e-13 4.00913e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+796875 75000 -5.7954e-13 1.13794e-13 4.21539e+08 1611.68 0 1613 4.125e+08 3300 0 
+843750 75000 -6.50613e-13 4.95808e-13 4.21544e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+796875 81250 -4.71234e-13 1.14992e-13 4.00913e+08 1609.25 0 1613 3.91875e+08 3300 0 
+843750 81250 -5.1826e-13 5.11421e-13 4.00918e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+750000 81250 -5.01912e-13 -1.44021e-13 4.00907e+08 1609.25 0 1613 3.91875e+08 3300 0 
+796875 81250 -4.71234e-13 1.14992e-13 4.00913e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+750000 87500 -3.89199e-13 -1.51747e-13 3.8028e+08 1606.81 0 1613 3.7125e+08 3300 0 
+796875 87500 -3.57039e-13 1.14671e-13 3.80286e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+796875 81250 -4.71234e-13 1.14992e-13 4.00913e+08 1609.25 0 1613 3.91875e+08 3300 0 
+843750 81250 -5.1826e-13 5.11421e-13 4.00918e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+796875 87500 -3.57039e-13 1.14671e-13 3.80286e+08 1606.81 0 1613 3.7125e+08 3300 0 
+843750 87500 -3.79853e-13 5.21798e-13 3.8029e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+843750 75000 -6.50613e-13 4.95808e-13 4.21544e+08 1611.68 0 1613 4.125e+08 3300 0 
+890625 75000 -8.77811e-13 1.12568e-12 4.21549e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+843750 81250 -5.1826e-13 5.11421e-13 4.00918e+08 1609.25 0 1613 3.91875e+08 3300 0 
+890625 81250 -6.85785e-13 1.16469e-12 4.00922e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+890625 75000 -8.77811e-13 1.12568e-12 4.21549e+08 1611.68 0 1613 4.125e+08 3300 0 
+937500 75000 -1.36553e-12 2.18672e-12 4.21555e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+890625 81250 -6.85785e-13 1.16469e-12 4.00922e+08 1609.25 0 1613 3.91875e+08 3300 0 
+937500 81250 -1.05391e-12 2.26538e-12 4.00928e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+843750 81250 -5.1826e-13 5.11421e-13 4.00918e+08 1609.25 0 1613 3.91875e+08 3300 0 
+890625 81250 -6.85785e-13 1.16469e-12 4.00922e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+843750 87500 -3.79853e-13 5.21798e-13 3.8029e+08 1606.81 0 1613 3.7125e+08 3300 0 
+890625 87500 -4.8627e-13 1.19227e-12 3.80295e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+890625 81250 -6.85785e-13 1.16469e-12 4.00922e+08 1609.25 0 1613 3.91875e+08 3300 0 
+937500 81250 -1.05391e-12 2.26538e-12 4.00928e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+890625 87500 -4.8627e-13 1.19227e-12 3.80295e+08 1606.81 0 1613 3.7125e+08 3300 0 
+937500 87500 -7.3126e-13 2.32218e-12 3.80299e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+750000 87500 -3.89199e-13 -1.51747e-13 3.8028e+08 1606.81 0 1613 3.7125e+08 3300 0 
+796875 87500 -3.57039e-13 1.14671e-13 3.80286e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+750000 93750 -2.70325e-13 -1.58422e-13 3.59652e+08 1604.38 0 1613 3.50625e+08 3300 0 
+796875 93750 -2.37527e-13 1.12937e-13 3.59658e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+796875 87500 -3.57039e-13 1.14671e-13 3.80286e+08 1606.81 0 1613 3.7125e+08 3300 0 
+843750 87500 -3.79853e-13 5.21798e-13 3.8029e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+796875 93750 -2.37527e-13 1.12937e-13 3.59658e+08 1604.38 0 1613 3.50625e+08 3300 0 
+843750 93750 -2.36313e-13 5.26927e-13 3.59662e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+750000 93750 -2.70325e-13 -1.58422e-13 3.59652e+08 1604.38 0 1613 3.50625e+08 3300 0 
+796875 93750 -2.37527e-13 1.12937e-13 3.59658e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+750000 100000 -1.45711e-13 -1.64066e-13 3.39023e+08 1601.95 0 1613 3.3e+08 3300 0 
+796875 100000 -1.13287e-13 1.09699e-13 3.39029e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+796875 93750 -2.37527e-13 1.12937e-13 3.59658e+08 1604.38 0 1613 3.50625e+08 3300 0 
+843750 93750 -2.36313e-13 5.26927e-13 3.59662e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+796875 100000 -1.13287e-13 1.09699e-13 3.39029e+08 1601.95 0 1613 3.3e+08 3300 0 
+843750 100000 -8.85867e-14 5.26627e-13 3.39033e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+843750 87500 -3.79853e-13 5.21798e-13 3.8029e+08 1606.81 0 1613 3.7125e+08 3300 0 
+890625 87500 -4.8627e-13 1.19227e-12 3.80295e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+843750 93750 -2.36313e-13 5.26927e-13 3.59662e+08 1604.38 0 1613 3.50625e+08 3300 0 
+890625 93750 -2.80858e-13 1.20822e-12 3.59666e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+890625 87500 -4.8627e-13 1.19227e-12 3.80295e+08 1606.81 0 1613 3.7125e+08 3300 0 
+937500 87500 -7.3126e-13 2.32218e-12 3.80299e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+890625 93750 -2.80858e-13 1.20822e-12 3.59666e+08 1604.38 0 1613 3.50625e+08 3300 0 
+937500 93750 -4.00402e-13 2.35662e-12 3.5967e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+843750 93750 -2.36313e-13 5.26927e-13 3.59662e+08 1604.38 0 1613 3.50625e+08 3300 0 
+890625 93750 -2.80858e-13 1.20822e-12 3.59666e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+843750 100000 -8.85867e-14 5.26627e-13 3.39033e+08 1601.95 0 1613 3.3e+08 3300 0 
+890625 100000 -7.11857e-14 1.21224e-12 3.39036e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+890625 93750 -2.80858e-13 1.20822e-12 3.59666e+08 1604.38 0 1613 3.50625e+08 3300 0 
+937500 93750 -4.00402e-13 2.35662e-12 3.5967e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+890625 100000 -7.11857e-14 1.21224e-12 3.39036e+08 1601.95 0 1613 3.3e+08 3300 0 
+937500 100000 -6.4245e-14 2.36817e-12 3.39039e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+937500 75000 -1.36553e-12 2.18672e-12 4.21555e+08 1611.68 0 1613 4.125e+08 3300 0 
+984375 75000 -2.29667e-12 3.94602e-12 4.21564e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+937500 81250 -1.05391e-12 2.26538e-12 4.00928e+08 1609.25 0 1613 3.91875e+08 3300 0 
+984375 81250 -1.76581e-12 4.09234e-12 4.00935e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+984375 75000 -2.29667e-12 3.94602e-12 4.21564e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.03125e+06 75000 -3.97453e-12 6.71854e-12 4.21581e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+984375 81250 -1.76581e-12 4.09234e-12 4.00935e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.03125e+06 81250 -3.06626e-12 6.9791e-12 4.00948e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+937500 81250 -1.05391e-12 2.26538e-12 4.00928e+08 1609.25 0 1613 3.91875e+08 3300 0 
+984375 81250 -1.76581e-12 4.09234e-12 4.00935e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+937500 87500 -7.3126e-13 2.32218e-12 3.80299e+08 1606.81 0 1613 3.7125e+08 3300 0 
+984375 87500 -1.21646e-12 4.19968e-12 3.80305e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+984375 81250 -1.76581e-12 4.09234e-12 4.00935e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.03125e+06 81250 -3.06626e-12 6.9791e-12 4.00948e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+984375 87500 -1.21646e-12 4.19968e-12 3.80305e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.03125e+06 87500 -2.12489e-12 7.17437e-12 3.80315e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+1.03125e+06 75000 -3.97453e-12 6.71854e-12 4.21581e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.07812e+06 75000 -6.87327e-12 1.06666e-11 4.21613e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+1.03125e+06 81250 -3.06626e-12 6.9791e-12 4.00948e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.07812e+06 81250 -5.36312e-12 1.1111e-11 4.00974e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+1.07812e+06 75000 -6.87327e-12 1.06666e-11 4.21613e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.125e+06 75000 -1.15729e-11 1.51189e-11 4.21691e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+1.07812e+06 81250 -5.36312e-12 1.1111e-11 4.00974e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.125e+06 81250 -9.20914e-12 1.58226e-11 4.01039e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+1.03125e+06 81250 -3.06626e-12 6.9791e-12 4.00948e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.07812e+06 81250 -5.36312e-12 1.1111e-11 4.00974e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+1.03125e+06 87500 -2.12489e-12 7.17437e-12 3.80315e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.07812e+06 87500 -3.7901e-12 1.14551e-11 3.80334e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+1.07812e+06 81250 -5.36312e-12 1.1111e-11 4.00974e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.125e+06 81250 -9.20914e-12 1.58226e-11 4.01039e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+1.07812e+06 87500 -3.7901e-12 1.14551e-11 3.80334e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.125e+06 87500 -6.72978e-12 1.63944e-11 3.80386e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+937500 87500 -7.3126e-13 2.32218e-12 3.80299e+08 1606.81 0 1613 3.7125e+08 3300 0 
+984375 87500 -1.21646e-12 4.19968e-12 3.80305e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+937500 93750 -4.00402e-13 2.35662e-12 3.5967e+08 1604.38 0 1613 3.50625e+08 3300 0 
+984375 93750 -6.53593e-13 4.26683e-12 3.59673e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+984375 87500 -1.21646e-12 4.19968e-12 3.80305e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.03125e+06 87500 -2.12489e-12 7.17437e-12 3.80315e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+984375 93750 -6.53593e-13 4.26683e-12 3.59673e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.03125e+06 93750 -1.15896e-12 7.30223e-12 3.5968e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+937500 93750 -4.00402e-13 2.35662e-12 3.5967e+08 1604.38 0 1613 3.50625e+08 3300 0 
+984375 93750 -6.53593e-13 4.26683e-12 3.59673e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+937500 100000 -6.4245e-14 2.36817e-12 3.39039e+08 1601.95 0 1613 3.3e+08 3300 0 
+984375 100000 -8.23374e-14 4.29284e-12 3.39041e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+984375 93750 -6.53593e-13 4.26683e-12 3.59673e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.03125e+06 93750 -1.15896e-12 7.30223e-12 3.5968e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+984375 100000 -8.23374e-14 4.29284e-12 3.39041e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.03125e+06 100000 -1.77332e-13 7.36052e-12 3.39044e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+1.03125e+06 87500 -2.12489e-12 7.17437e-12 3.80315e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.07812e+06 87500 -3.7901e-12 1.14551e-11 3.80334e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+1.03125e+06 93750 -1.15896e-12 7.30223e-12 3.5968e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.07812e+06 93750 -2.16748e-12 1.16931e-11 3.59691e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+1.07812e+06 87500 -3.7901e-12 1.14551e-11 3.80334e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.125e+06 87500 -6.72978e-12 1.63944e-11 3.80386e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+1.07812e+06 93750 -2.16748e-12 1.16931e-11 3.59691e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.125e+06 93750 -4.15324e-12 1.68288e-11 3.5973e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+1.03125e+06 93750 -1.15896e-12 7.30223e-12 3.5968e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.07812e+06 93750 -2.16748e-12 1.16931e-11 3.59691e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+1.03125e+06 100000 -1.77332e-13 7.36052e-12 3.39044e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.07812e+06 100000 -5.09486e-13 1.18211e-11 3.39048e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+1.07812e+06 93750 -2.16748e-12 1.16931e-11 3.59691e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.125e+06 93750 -4.15324e-12 1.68288e-11 3.5973e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+1.07812e+06 100000 -5.09486e-13 1.18211e-11 3.39048e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.125e+06 100000 -1.49961e-12 1.71151e-11 3.3907e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+1.125e+06 50000 -1.95606e-11 1.11891e-11 5.04265e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.17188e+06 50000 -2.92598e-11 1.26621e-11 5.04506e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.125e+06 56250 -1.78112e-11 1.23192e-11 4.83625e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.17188e+06 56250 -2.68377e-11 1.39773e-11 4.83855e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+1.17188e+06 50000 -2.92598e-11 1.26621e-11 5.04506e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.21875e+06 50000 -3.81506e-11 9.05454e-12 5.04905e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.17188e+06 56250 -2.68377e-11 1.39773e-11 4.83855e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.21875e+06 56250 -3.49722e-11 9.81328e-12 4.84235e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+1.125e+06 56250 -1.78112e-11 1.23192e-11 4.83625e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.17188e+06 56250 -2.68377e-11 1.39773e-11 4.83855e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+1.125e+06 62500 -1.58885e-11 1.33562e-11 4.62982e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.17188e+06 62500 -2.41699e-11 1.51958e-11 4.63193e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+1.17188e+06 56250 -2.68377e-11 1.39773e-11 4.83855e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.21875e+06 56250 -3.49722e-11 9.81328e-12 4.84235e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+1.17188e+06 62500 -2.41699e-11 1.51958e-11 4.63193e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.21875e+06 62500 -3.14573e-11 1.04606e-11 4.63583e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+1.21875e+06 50000 -3.81506e-11 9.05454e-12 5.04905e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.26562e+06 50000 -3.89136e-11 -2.74461e-12 5.05735e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.21875e+06 56250 -3.49722e-11 9.81328e-12 4.84235e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.26562e+06 56250 -3.48585e-11 -3.49372e-12 4.85078e+08 1592.67 0 1613 4.74375e+08 3300 0 
+
+
+1.26562e+06 50000 -3.89136e-11 -2.74461e-12 5.05735e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.3125e+06 50000 -2.51982e-11 -2.09203e-11 5.06209e+08 1212.52 0 1613 4.95e+08 3300 0 
+
+1.26562e+06 56250 -3.48585e-11 -3.49372e-12 4.85078e+08 1592.67 0 1613 4.74375e+08 3300 0 
+1.3125e+06 56250 -2.02603e-11 -2.43614e-11 4.85357e+08 1160.33 0 1613 4.74375e+08 3300 0 
+
+
+1.21875e+06 56250 -3.49722e-11 9.81328e-12 4.84235e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.26562e+06 56250 -3.48585e-11 -3.49372e-12 4.85078e+08 1592.67 0 1613 4.74375e+08 3300 0 
+
+1.21875e+06 62500 -3.14573e-11 1.04606e-11 4.63583e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.26562e+06 62500 -3.04955e-11 -4.39659e-12 4.64326e+08 1531.19 0 1613 4.5375e+08 3300 0 
+
+
+1.26562e+06 56250 -3.48585e-11 -3.49372e-12 4.85078e+08 1592.67 0 1613 4.74375e+08 3300 0 
+1.3125e+06 56250 -2.02603e-11 -2.43614e-11 4.85357e+08 1160.33 0 1613 4.74375e+08 3300 0 
+
+1.26562e+06 62500 -3.04955e-11 -4.39659e-12 4.64326e+08 1531.19 0 1613 4.5375e+08 3300 0 
+1.3125e+06 62500 -1.49504e-11 -2.7801e-11 4.64765e+08 1111.96 0 1613 4.5375e+08 3300 0 
+
+
+1.125e+06 62500 -1.58885e-11 1.33562e-11 4.62982e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.17188e+06 62500 -2.41699e-11 1.51958e-11 4.63193e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+1.125e+06 68750 -1.38044e-11 1.42925e-11 4.42338e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.17188e+06 68750 -2.12659e-11 1.6298e-11 4.42525e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+1.17188e+06 62500 -2.41699e-11 1.51958e-11 4.63193e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.21875e+06 62500 -3.14573e-11 1.04606e-11 4.63583e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+1.17188e+06 68750 -2.12659e-11 1.6298e-11 4.42525e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.21875e+06 68750 -2.76271e-11 1.10206e-11 4.42933e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+1.125e+06 68750 -1.38044e-11 1.42925e-11 4.42338e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.17188e+06 68750 -2.12659e-11 1.6298e-11 4.42525e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+1.125e+06 75000 -1.15729e-11 1.51189e-11 4.21691e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.17188e+06 75000 -1.81352e-11 1.7272e-11 4.21852e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+1.17188e+06 68750 -2.12659e-11 1.6298e-11 4.42525e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.21875e+06 68750 -2.76271e-11 1.10206e-11 4.42933e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+1.17188e+06 75000 -1.81352e-11 1.7272e-11 4.21852e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.21875e+06 75000 -2.3504e-11 1.14877e-11 4.22275e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+1.21875e+06 62500 -3.14573e-11 1.04606e-11 4.63583e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.26562e+06 62500 -3.04955e-11 -4.39659e-12 4.64326e+08 1531.19 0 1613 4.5375e+08 3300 0 
+
+1.21875e+06 68750 -2.76271e-11 1.10206e-11 4.42933e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.26562e+06 68750 -2.58486e-11 -5.51991e-12 4.43539e+08 1468.58 0 1613 4.33125e+08 3300 0 
+
+
+1.26562e+06 62500 -3.04955e-11 -4.39659e-12 4.64326e+08 1531.19 0 1613 4.5375e+08 3300 0 
+1.3125e+06 62500 -1.49504e-11 -2.7801e-11 4.64765e+08 1111.96 0 1613 4.5375e+08 3300 0 
+
+1.26562e+06 68750 -2.58486e-11 -5.51991e-12 4.43539e+08 1468.58 0 1613 4.33125e+08 3300 0 
+1.3125e+06 68750 -9.44493e-12 -3.07424e-11 4.44225e+08 1068.71 0 1613 4.33125e+08 3300 0 
+
+
+1.21875e+06 68750 -2.76271e-11 1.10206e-11 4.42933e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.26562e+06 68750 -2.58486e-11 -5.51991e-12 4.43539e+08 1468.58 0 1613 4.33125e+08 3300 0 
+
+1.21875e+06 75000 -2.3504e-11 1.14877e-11 4.22275e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.26562e+06 75000 -2.09299e-11 -6.8112e-12 4.22762e+08 1404.58 0 1613 4.125e+08 3300 0 
+
+
+1.26562e+06 68750 -2.58486e-11 -5.51991e-12 4.43539e+08 1468.58 0 1613 4.33125e+08 3300 0 
+1.3125e+06 68750 -9.44493e-12 -3.07424e-11 4.44225e+08 1068.71 0 1613 4.33125e+08 3300 0 
+
+1.26562e+06 75000 -2.09299e-11 -6.8112e-12 4.22762e+08 1404.58 0 1613 4.125e+08 3300 0 
+1.3125e+06 75000 -3.96414e-12 -3.32448e-11 4.23578e+08 1032.17 0 1613 4.125e+08 3300 0 
+
+
+1.3125e+06 50000 -2.51982e-11 -2.09203e-11 5.06209e+08 1212.52 0 1613 4.95e+08 3300 0 
+1.35938e+06 50000 1.66431e-12 -3.47459e-11 5.07744e+08 1072.31 0 1613 4.95e+08 3300 0 
+
+1.3125e+06 56250 -2.02603e-11 -2.43614e-11 4.85357e+08 1160.33 0 1613 4.74375e+08 3300 0 
+1.35938e+06 56250 6.20109e-12 -3.73177e-11 4.87094e+08 1098.21 0 1613 4.74375e+08 3300 0 
+
+
+1.35938e+06 50000 1.66431e-12 -3.47459e-11 5.07744e+08 1072.31 0 1613 4.95e+08 3300 0 
+1.40625e+06 50000 2.37754e-11 -2.47427e-11 5.04825e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.35938e+06 56250 6.20109e-12 -3.73177e-11 4.87094e+08 1098.21 0 1613 4.74375e+08 3300 0 
+1.40625e+06 56250 2.1954e-11 -1.98805e-11 4.84794e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+1.3125e+06 56250 -2.02603e-11 -2.43614e-11 4.85357e+08 1160.33 0 1613 4.74375e+08 3300 0 
+1.35938e+06 56250 6.20109e-12 -3.73177e-11 4.87094e+08 1098.21 0 1613 4.74375e+08 3300 0 
+
+1.3125e+06 62500 -1.49504e-11 -2.7801e-11 4.64765e+08 1111.96 0 1613 4.5375e+08 3300 0 
+1.35938e+06 62500 1.16372e-11 -3.99229e-11 4.65393e+08 1139.33 0 1613 4.5375e+08 3300 0 
+
+
+1.35938e+06 56250 6.20109e-12 -3.73177e-11 4.87094e+08 1098.21 0 1613 4.74375e+08 3300 0 
+1.40625e+06 56250 2.1954e-11 -1.98805e-11 4.84794e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+1.35938e+06 62500 1.16372e-11 -3.99229e-11 4.65393e+08 1139.33 0 1613 4.5375e+08 3300 0 
+1.40625e+06 62500 1.83779e-11 -1.4848e-11 4.63274e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+1.40625e+06 50000 2.37754e-11 -2.47427e-11 5.04825e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.45312e+06 50000 6.02591e-12 2.16692e-11 5.04923e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.40625e+06 56250 2.1954e-11 -1.98805e-11 4.84794e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.45312e+06 56250 4.00286e-12 2.30704e-11 4.83835e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+1.45312e+06 50000 6.02591e-12 2.16692e-11 5.04923e+08 1621.42 0 1613 4.95e+08 3300 0 
+1.5e+06 50000 0 0 5.05583e+08 1621.42 0 1613 4.95e+08 3300 0 
+
+1.45312e+06 56250 4.00286e-12 2.30704e-11 4.83835e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.5e+06 56250 0 0 4.84797e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+
+1.40625e+06 56250 2.1954e-11 -1.98805e-11 4.84794e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.45312e+06 56250 4.00286e-12 2.30704e-11 4.83835e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+1.40625e+06 62500 1.83779e-11 -1.4848e-11 4.63274e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.45312e+06 62500 1.99361e-12 2.36485e-11 4.63178e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+1.45312e+06 56250 4.00286e-12 2.30704e-11 4.83835e+08 1618.98 0 1613 4.74375e+08 3300 0 
+1.5e+06 56250 0 0 4.84797e+08 1618.98 0 1613 4.74375e+08 3300 0 
+
+1.45312e+06 62500 1.99361e-12 2.36485e-11 4.63178e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.5e+06 62500 0 0 4.63721e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+
+1.3125e+06 62500 -1.49504e-11 -2.7801e-11 4.64765e+08 1111.96 0 1613 4.5375e+08 3300 0 
+1.35938e+06 62500 1.16372e-11 -3.99229e-11 4.65393e+08 1139.33 0 1613 4.5375e+08 3300 0 
+
+1.3125e+06 68750 -9.44493e-12 -3.07424e-11 4.44225e+08 1068.71 0 1613 4.33125e+08 3300 0 
+1.35938e+06 68750 1.71543e-11 -4.39621e-11 4.43467e+08 1196.05 0 1613 4.33125e+08 3300 0 
+
+
+1.35938e+06 62500 1.16372e-11 -3.99229e-11 4.65393e+08 1139.33 0 1613 4.5375e+08 3300 0 
+1.40625e+06 62500 1.83779e-11 -1.4848e-11 4.63274e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+1.35938e+06 68750 1.71543e-11 -4.39621e-11 4.43467e+08 1196.05 0 1613 4.33125e+08 3300 0 
+1.40625e+06 68750 1.37826e-11 -1.15526e-11 4.41378e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+1.3125e+06 68750 -9.44493e-12 -3.07424e-11 4.44225e+08 1068.71 0 1613 4.33125e+08 3300 0 
+1.35938e+06 68750 1.71543e-11 -4.39621e-11 4.43467e+08 1196.05 0 1613 4.33125e+08 3300 0 
+
+1.3125e+06 75000 -3.96414e-12 -3.32448e-11 4.23578e+08 1032.17 0 1613 4.125e+08 3300 0 
+1.35938e+06 75000 2.14398e-11 -4.94329e-11 4.21946e+08 1268.01 0 1613 4.125e+08 3300 0 
+
+
+1.35938e+06 68750 1.71543e-11 -4.39621e-11 4.43467e+08 1196.05 0 1613 4.33125e+08 3300 0 
+1.40625e+06 68750 1.37826e-11 -1.15526e-11 4.41378e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+1.35938e+06 75000 2.14398e-11 -4.94329e-11 4.21946e+08 1268.01 0 1613 4.125e+08 3300 0 
+1.40625e+06 75000 9.44673e-12 -9.99545e-12 4.19739e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+1.40625e+06 62500 1.83779e-11 -1.4848e-11 4.63274e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.45312e+06 62500 1.99361e-12 2.36485e-11 4.63178e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+1.40625e+06 68750 1.37826e-11 -1.15526e-11 4.41378e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.45312e+06 68750 9.71956e-14 2.43775e-11 4.4263e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+1.45312e+06 62500 1.99361e-12 2.36485e-11 4.63178e+08 1616.55 0 1613 4.5375e+08 3300 0 
+1.5e+06 62500 0 0 4.63721e+08 1616.55 0 1613 4.5375e+08 3300 0 
+
+1.45312e+06 68750 9.71956e-14 2.43775e-11 4.4263e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.5e+06 68750 0 0 4.42587e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+
+1.40625e+06 68750 1.37826e-11 -1.15526e-11 4.41378e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.45312e+06 68750 9.71956e-14 2.43775e-11 4.4263e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+1.40625e+06 75000 9.44673e-12 -9.99545e-12 4.19739e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.45312e+06 75000 -1.55107e-12 2.53693e-11 4.22014e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+1.45312e+06 68750 9.71956e-14 2.43775e-11 4.4263e+08 1614.11 0 1613 4.33125e+08 3300 0 
+1.5e+06 68750 0 0 4.42587e+08 1614.11 0 1613 4.33125e+08 3300 0 
+
+1.45312e+06 75000 -1.55107e-12 2.53693e-11 4.22014e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.5e+06 75000 0 0 4.21523e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+
+1.125e+06 75000 -1.15729e-11 1.51189e-11 4.21691e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.17188e+06 75000 -1.81352e-11 1.7272e-11 4.21852e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+1.125e+06 81250 -9.20914e-12 1.58226e-11 4.01039e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.17188e+06 81250 -1.47882e-11 1.81179e-11 4.01182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+1.17188e+06 75000 -1.81352e-11 1.7272e-11 4.21852e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.21875e+06 75000 -2.3504e-11 1.14877e-11 4.22275e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+1.17188e+06 81250 -1.47882e-11 1.81179e-11 4.01182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.21875e+06 81250 -1.91056e-11 1.1811e-11 4.01583e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+1.125e+06 81250 -9.20914e-12 1.58226e-11 4.01039e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.17188e+06 81250 -1.47882e-11 1.81179e-11 4.01182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+1.125e+06 87500 -6.72978e-12 1.63944e-11 3.80386e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.17188e+06 87500 -1.12391e-11 1.8825e-11 3.80502e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+1.17188e+06 81250 -1.47882e-11 1.81179e-11 4.01182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.21875e+06 81250 -1.91056e-11 1.1811e-11 4.01583e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+1.17188e+06 87500 -1.12391e-11 1.8825e-11 3.80502e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.21875e+06 87500 -1.44559e-11 1.19794e-11 3.80905e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+1.21875e+06 75000 -2.3504e-11 1.14877e-11 4.22275e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.26562e+06 75000 -2.09299e-11 -6.8112e-12 4.22762e+08 1404.58 0 1613 4.125e+08 3300 0 
+
+1.21875e+06 81250 -1.91056e-11 1.1811e-11 4.01583e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.26562e+06 81250 -1.57765e-11 -8.08662e-12 4.02062e+08 1339.47 0 1613 3.91875e+08 3300 0 
+
+
+1.26562e+06 75000 -2.09299e-11 -6.8112e-12 4.22762e+08 1404.58 0 1613 4.125e+08 3300 0 
+1.3125e+06 75000 -3.96414e-12 -3.32448e-11 4.23578e+08 1032.17 0 1613 4.125e+08 3300 0 
+
+1.26562e+06 81250 -1.57765e-11 -8.08662e-12 4.02062e+08 1339.47 0 1613 3.91875e+08 3300 0 
+1.3125e+06 81250 1.29696e-12 -3.60746e-11 4.02553e+08 1004.26 0 1613 3.91875e+08 3300 0 
+
+
+1.21875e+06 81250 -1.91056e-11 1.1811e-11 4.01583e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.26562e+06 81250 -1.57765e-11 -8.08662e-12 4.02062e+08 1339.47 0 1613 3.91875e+08 3300 0 
+
+1.21875e+06 87500 -1.44559e-11 1.19794e-11 3.80905e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.26562e+06 87500 -1.04725e-11 -9.36279e-12 3.81235e+08 1273.55 0 1613 3.7125e+08 3300 0 
+
+
+1.26562e+06 81250 -1.57765e-11 -8.08662e-12 4.02062e+08 1339.47 0 1613 3.91875e+08 3300 0 
+1.3125e+06 81250 1.29696e-12 -3.60746e-11 4.02553e+08 1004.26 0 1613 3.91875e+08 3300 0 
+
+1.26562e+06 87500 -1.04725e-11 -9.36279e-12 3.81235e+08 1273.55 0 1613 3.7125e+08 3300 0 
+1.3125e+06 87500 6.2089e-12 -3.92434e-11 3.8188e+08 987.175 0 1613 3.7125e+08 3300 0 
+
+
+1.125e+06 87500 -6.72978e-12 1.63944e-11 3.80386e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.17188e+06 87500 -1.12391e-11 1.8825e-11 3.80502e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+1.125e+06 93750 -4.15324e-12 1.68288e-11 3.5973e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.17188e+06 93750 -7.50306e-12 1.93681e-11 3.59817e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+1.17188e+06 87500 -1.12391e-11 1.8825e-11 3.80502e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.21875e+06 87500 -1.44559e-11 1.19794e-11 3.80905e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+1.17188e+06 93750 -7.50306e-12 1.93681e-11 3.59817e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.21875e+06 93750 -9.59358e-12 1.20419e-11 3.60221e+08 1545.51 0 1613 3.50625e+08 3300 0 
+
+
+1.125e+06 93750 -4.15324e-12 1.68288e-11 3.5973e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.17188e+06 93750 -7.50306e-12 1.93681e-11 3.59817e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+1.125e+06 100000 -1.49961e-12 1.71151e-11 3.3907e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.17188e+06 100000 -3.5973e-12 1.97384e-11 3.39136e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+1.17188e+06 93750 -7.50306e-12 1.93681e-11 3.59817e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.21875e+06 93750 -9.59358e-12 1.20419e-11 3.60221e+08 1545.51 0 1613 3.50625e+08 3300 0 
+
+1.17188e+06 100000 -3.5973e-12 1.97384e-11 3.39136e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.21875e+06 100000 -4.57349e-12 1.20321e-11 3.395e+08 1466.02 0 1613 3.3e+08 3300 0 
+
+
+1.21875e+06 87500 -1.44559e-11 1.19794e-11 3.80905e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.26562e+06 87500 -1.04725e-11 -9.36279e-12 3.81235e+08 1273.55 0 1613 3.7125e+08 3300 0 
+
+1.21875e+06 93750 -9.59358e-12 1.20419e-11 3.60221e+08 1545.51 0 1613 3.50625e+08 3300 0 
+1.26562e+06 93750 -5.05405e-12 -1.08387e-11 3.60346e+08 1207.3 0 1613 3.50625e+08 3300 0 
+
+
+1.26562e+06 87500 -1.04725e-11 -9.36279e-12 3.81235e+08 1273.55 0 1613 3.7125e+08 3300 0 
+1.3125e+06 87500 6.2089e-12 -3.92434e-11 3.8188e+08 987.175 0 1613 3.7125e+08 3300 0 
+
+1.26562e+06 93750 -5.05405e-12 -1.08387e-11 3.60346e+08 1207.3 0 1613 3.50625e+08 3300 0 
+1.3125e+06 93750 1.0817e-11 -4.1728e-11 3.61323e+08 983.335 0 1613 3.50625e+08 3300 0 
+
+
+1.21875e+06 93750 -9.59358e-12 1.20419e-11 3.60221e+08 1545.51 0 1613 3.50625e+08 3300 0 
+1.26562e+06 93750 -5.05405e-12 -1.08387e-11 3.60346e+08 1207.3 0 1613 3.50625e+08 3300 0 
+
+1.21875e+06 100000 -4.57349e-12 1.20321e-11 3.395e+08 1466.02 0 1613 3.3e+08 3300 0 
+1.26562e+06 100000 4.71955e-13 -1.25636e-11 3.39471e+08 1141.42 0 1613 3.3e+08 3300 0 
+
+
+1.26562e+06 93750 -5.05405e-12 -1.08387e-11 3.60346e+08 1207.3 0 1613 3.50625e+08 3300 0 
+1.3125e+06 93750 1.0817e-11 -4.1728e-11 3.61323e+08 983.335 0 1613 3.50625e+08 3300 0 
+
+1.26562e+06 100000 4.71955e-13 -1.25636e-11 3.39471e+08 1141.42 0 1613 3.3e+08 3300 0 
+1.3125e+06 100000 1.536e-11 -4.33481e-11 3.406e+08 995.24 0 1613 3.3e+08 3300 0 
+
+
+1.3125e+06 75000 -3.96414e-12 -3.32448e-11 4.23578e+08 1032.17 0 1613 4.125e+08 3300 0 
+1.35938e+06 75000 2.14398e-11 -4.94329e-11 4.21946e+08 1268.01 0 1613 4.125e+08 3300 0 
+
+1.3125e+06 81250 1.29696e-12 -3.60746e-11 4.02553e+08 1004.26 0 1613 3.91875e+08 3300 0 
+1.35938e+06 81250 2.37435e-11 -5.44727e-11 4.01916e+08 1353.99 0 1613 3.91875e+08 3300 0 
+
+
+1.35938e+06 75000 2.14398e-11 -4.94329e-11 4.21946e+08 1268.01 0 1613 4.125e+08 3300 0 
+1.40625e+06 75000 9.44673e-12 -9.99545e-12 4.19739e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+1.35938e+06 81250 2.37435e-11 -5.44727e-11 4.01916e+08 1353.99 0 1613 3.91875e+08 3300 0 
+1.40625e+06 81250 6.12817e-12 -8.7598e-12 3.99182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+1.3125e+06 81250 1.29696e-12 -3.60746e-11 4.02553e+08 1004.26 0 1613 3.91875e+08 3300 0 
+1.35938e+06 81250 2.37435e-11 -5.44727e-11 4.01916e+08 1353.99 0 1613 3.91875e+08 3300 0 
+
+1.3125e+06 87500 6.2089e-12 -3.92434e-11 3.8188e+08 987.175 0 1613 3.7125e+08 3300 0 
+1.35938e+06 87500 2.46393e-11 -5.72882e-11 3.80267e+08 1451.81 1 1613 3.7125e+08 3300 0 
+
+
+1.35938e+06 81250 2.37435e-11 -5.44727e-11 4.01916e+08 1353.99 0 1613 3.91875e+08 3300 0 
+1.40625e+06 81250 6.12817e-12 -8.7598e-12 3.99182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+1.35938e+06 87500 2.46393e-11 -5.72882e-11 3.80267e+08 1451.81 1 1613 3.7125e+08 3300 0 
+1.40625e+06 87500 3.38639e-12 -6.85462e-12 3.78688e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+1.40625e+06 75000 9.44673e-12 -9.99545e-12 4.19739e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.45312e+06 75000 -1.55107e-12 2.53693e-11 4.22014e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+1.40625e+06 81250 6.12817e-12 -8.7598e-12 3.99182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.45312e+06 81250 -2.86438e-12 2.60768e-11 4.01087e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+1.45312e+06 75000 -1.55107e-12 2.53693e-11 4.22014e+08 1611.68 0 1613 4.125e+08 3300 0 
+1.5e+06 75000 0 0 4.21523e+08 1611.68 0 1613 4.125e+08 3300 0 
+
+1.45312e+06 81250 -2.86438e-12 2.60768e-11 4.01087e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.5e+06 81250 0 0 4.00707e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+
+1.40625e+06 81250 6.12817e-12 -8.7598e-12 3.99182e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.45312e+06 81250 -2.86438e-12 2.60768e-11 4.01087e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+1.40625e+06 87500 3.38639e-12 -6.85462e-12 3.78688e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.45312e+06 87500 -3.92225e-12 2.61207e-11 3.80163e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+1.45312e+06 81250 -2.86438e-12 2.60768e-11 4.01087e+08 1609.25 0 1613 3.91875e+08 3300 0 
+1.5e+06 81250 0 0 4.00707e+08 1609.25 0 1613 3.91875e+08 3300 0 
+
+1.45312e+06 87500 -3.92225e-12 2.61207e-11 3.80163e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.5e+06 87500 0 0 3.79905e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+
+1.3125e+06 87500 6.2089e-12 -3.92434e-11 3.8188e+08 987.175 0 1613 3.7125e+08 3300 0 
+1.35938e+06 87500 2.46393e-11 -5.72882e-11 3.80267e+08 1451.81 1 1613 3.7125e+08 3300 0 
+
+1.3125e+06 93750 1.0817e-11 -4.1728e-11 3.61323e+08 983.335 0 1613 3.50625e+08 3300 0 
+1.35938e+06 93750 2.44556e-11 -5.53986e-11 3.58164e+08 1558.39 1 1613 3.50625e+08 3300 0 
+
+
+1.35938e+06 87500 2.46393e-11 -5.72882e-11 3.80267e+08 1451.81 1 1613 3.7125e+08 3300 0 
+1.40625e+06 87500 3.38639e-12 -6.85462e-12 3.78688e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+1.35938e+06 93750 2.44556e-11 -5.53986e-11 3.58164e+08 1558.39 1 1613 3.50625e+08 3300 0 
+1.40625e+06 93750 8.31099e-13 -4.37997e-12 3.58263e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+1.3125e+06 93750 1.0817e-11 -4.1728e-11 3.61323e+08 983.335 0 1613 3.50625e+08 3300 0 
+1.35938e+06 93750 2.44556e-11 -5.53986e-11 3.58164e+08 1558.39 1 1613 3.50625e+08 3300 0 
+
+1.3125e+06 100000 1.536e-11 -4.33481e-11 3.406e+08 995.24 0 1613 3.3e+08 3300 0 
+1.35938e+06 100000 2.31645e-11 -4.99526e-11 3.37782e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+1.35938e+06 93750 2.44556e-11 -5.53986e-11 3.58164e+08 1558.39 1 1613 3.50625e+08 3300 0 
+1.40625e+06 93750 8.31099e-13 -4.37997e-12 3.58263e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+1.35938e+06 100000 2.31645e-11 -4.99526e-11 3.37782e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.40625e+06 100000 -1.75774e-12 -2.09137e-12 3.37445e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+1.40625e+06 87500 3.38639e-12 -6.85462e-12 3.78688e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.45312e+06 87500 -3.92225e-12 2.61207e-11 3.80163e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+1.40625e+06 93750 8.31099e-13 -4.37997e-12 3.58263e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.45312e+06 93750 -4.79049e-12 2.56334e-11 3.59238e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+1.45312e+06 87500 -3.92225e-12 2.61207e-11 3.80163e+08 1606.81 0 1613 3.7125e+08 3300 0 
+1.5e+06 87500 0 0 3.79905e+08 1606.81 0 1613 3.7125e+08 3300 0 
+
+1.45312e+06 93750 -4.79049e-12 2.56334e-11 3.59238e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.5e+06 93750 0 0 3.59126e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+
+1.40625e+06 93750 8.31099e-13 -4.37997e-12 3.58263e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.45312e+06 93750 -4.79049e-12 2.56334e-11 3.59238e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+1.40625e+06 100000 -1.75774e-12 -2.09137e-12 3.37445e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.45312e+06 100000 -5.52784e-12 2.48735e-11 3.3845e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+1.45312e+06 93750 -4.79049e-12 2.56334e-11 3.59238e+08 1604.38 0 1613 3.50625e+08 3300 0 
+1.5e+06 93750 0 0 3.59126e+08 1604.38 0 1613 3.50625e+08 3300 0 
+
+1.45312e+06 100000 -5.52784e-12 2.48735e-11 3.3845e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.5e+06 100000 0 0 3.3826e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+
+0 100000 0 4.75256e-13 3.38545e+08 1601.95 0 1613 3.3e+08 3300 0 
+46875 100000 7.01738e-13 1.86702e-12 3.38511e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+0 106250 0 3.03389e-13 3.17922e+08 1598.76 0 1613 3.09375e+08 3300 0 
+46875 106250 8.83702e-13 1.85945e-12 3.17879e+08 1599.84 0 1613 3.09375e+08 3300 0 
+
+
+46875 100000 7.01738e-13 1.86702e-12 3.38511e+08 1601.95 0 1613 3.3e+08 3300 0 
+93750 100000 -7.72208e-14 3.78653e-12 3.38477e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+46875 106250 8.83702e-13 1.85945e-12 3.17879e+08 1599.84 0 1613 3.09375e+08 3300 0 
+93750 106250 2.2683e-13 3.9641e-12 3.17836e+08 1600 0 1613 3.09375e+08 3300 0 
+
+
+0 106250 0 3.03389e-13 3.17922e+08 1598.76 0 1613 3.09375e+08 3300 0 
+46875 106250 8.83702e-13 1.85945e-12 3.17879e+08 1599.84 0 1613 3.09375e+08 3300 0 
+
+0 112500 0 1.03332e-13 2.97299e+08 1592.21 0 1613 2.8875e+08 3300 0 
+46875 112500 1.05335e-12 1.83207e-12 2.97247e+08 1598.93 0 1613 2.8875e+08 3300 0 
+
+
+46875 106250 8.83702e-13 1.85945e-12 3.17879e+08 1599.84 0 1613 3.09375e+08 3300 0 
+93750 106250 2.2683e-13 3.9641e-12 3.17836e+08 1600 0 1613 3.09375e+08 3300 0 
+
+46875 112500 1.05335e-12 1.83207e-12 2.97247e+08 1598.93 0 1613 2.8875e+08 3300 0 
+93750 112500 5.34637e-13 4.12604e-12 2.97194e+08 1599.99 0 1613 2.8875e+08 3300 0 
+
+
+93750 100000 -7.72208e-14 3.78653e-12 3.38477e+08 1601.95 0 1613 3.3e+08 3300 0 
+140625 100000 -1.43262e-12 3.6955e-12 3.38506e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+93750 106250 2.2683e-13 3.9641e-12 3.17836e+08 1600 0 1613 3.09375e+08 3300 0 
+140625 106250 -9.84242e-13 3.83023e-12 3.17867e+08 1599.93 0 1613 3.09375e+08 3300 0 
+
+
+140625 100000 -1.43262e-12 3.6955e-12 3.38506e+08 1601.95 0 1613 3.3e+08 3300 0 
+187500 100000 -2.07174e-12 2.0646e-12 3.38584e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+140625 106250 -9.84242e-13 3.83023e-12 3.17867e+08 1599.93 0 1613 3.09375e+08 3300 0 
+187500 106250 -1.42941e-12 2.07908e-12 3.17951e+08 1599.17 0 1613 3.09375e+08 3300 0 
+
+
+93750 106250 2.2683e-13 3.9641e-12 3.17836e+08 1600 0 1613 3.09375e+08 3300 0 
+140625 106250 -9.84242e-13 3.83023e-12 3.17867e+08 1599.93 0 1613 3.09375e+08 3300 0 
+
+93750 112500 5.34637e-13 4.12604e-12 2.97194e+08 1599.99 0 1613 2.8875e+08 3300 0 
+140625 112500 -5.00917e-13 3.93753e-12 2.97227e+08 1599.55 0 1613 2.8875e+08 3300 0 
+
+
+140625 106250 -9.84242e-13 3.83023e-12 3.17867e+08 1599.93 0 1613 3.09375e+08 3300 0 
+187500 106250 -1.42941e-12 2.07908e-12 3.17951e+08 1599.17 0 1613 3.09375e+08 3300 0 
+
+140625 112500 -5.00917e-13 3.93753e-12 2.97227e+08 1599.55 0 1613 2.8875e+08 3300 0 
+187500 112500 -7.2339e-13 2.06813e-12 2.97316e+08 1594.74 0 1613 2.8875e+08 3300 0 
+
+
+0 112500 0 1.03332e-13 2.97299e+08 1592.21 0 1613 2.8875e+08 3300 0 
+46875 112500 1.05335e-12 1.83207e-12 2.97247e+08 1598.93 0 1613 2.8875e+08 3300 0 
+
+0 118750 0 -1.20387e-13 2.76676e+08 1584.06 0 1613 2.68125e+08 3300 0 
+46875 118750 1.20191e-12 1.7841e-12 2.76614e+08 1597.62 0 1613 2.68125e+08 3300 0 
+
+
+46875 112500 1.05335e-12 1.83207e-12 2.97247e+08 1598.93 0 1613 2.8875e+08 3300 0 
+93750 112500 5.34637e-13 4.12604e-12 2.97194e+08 1599.99 0 1613 2.8875e+08 3300 0 
+
+46875 118750 1.20191e-12 1.7841e-12 2.76614e+08 1597.62 0 1613 2.68125e+08 3300 0 
+93750 118750 8.42091e-13 4.26872e-12 2.7655e+08 1599.99 0 1613 2.68125e+08 3300 0 
+
+
+0 118750 0 -1.20387e-13 2.76676e+08 1584.06 0 1613 2.68125e+08 3300 0 
+46875 118750 1.20191e-12 1.7841e-12 2.76614e+08 1597.62 0 1613 2.68125e+08 3300 0 
+
+0 125000 0 -3.6102e-13 2.56053e+08 1572.76 0 1613 2.475e+08 3300 0 
+46875 125000 1.31902e-12 1.71473e-12 2.55981e+08 1595.42 0 1613 2.475e+08 3300 0 
+
+
+46875 118750 1.20191e-12 1.7841e-12 2.76614e+08 1597.62 0 1613 2.68125e+08 3300 0 
+93750 118750 8.42091e-13 4.26872e-12 2.7655e+08 1599.99 0 1613 2.68125e+08 3300 0 
+
+46875 125000 1.31902e-12 1.71473e-12 2.55981e+08 1595.42 0 1613 2.475e+08 3300 0 
+93750 125000 1.14451e-12 4.38763e-12 2.55905e+08 1599.97 0 1613 2.475e+08 3300 0 
+
+
+93750 112500 5.34637e-13 4.12604e-12 2.97194e+08 1599.99 0 1613 2.8875e+08 3300 0 
+140625 112500 -5.00917e-13 3.93753e-12 2.97227e+08 1599.55 0 1613 2.8875e+08 3300 0 
+
+93750 118750 8.42091e-13 4.26872e-12 2.7655e+08 1599.99 0 1613 2.68125e+08 3300 0 
+140625 118750 2.01204e-14 4.01199e-12 2.76585e+08 1598.97 0 1613 2.68125e+08 3300 0 
+
+
+140625 112500 -5.00917e-13 3.93753e-12 2.97227e+08 1599.55 0 1613 2.8875e+08 3300 0 
+187500 112500 -7.2339e-13 2.06813e-12 2.97316e+08 1594.74 0 1613 2.8875e+08 3300 0 
+
+140625 118750 2.01204e-14 4.01199e-12 2.76585e+08 1598.97 0 1613 2.68125e+08 3300 0 
+187500 118750 5.11066e-14 2.02973e-12 2.7668e+08 1589.02 0 1613 2.68125e+08 3300 0 
+
+
+93750 118750 8.42091e-13 4.26872e-12 2.7655e+08 1599.99 0 1613 2.68125e+08 3300 0 
+140625 118750 2.01204e-14 4.01199e-12 2.76585e+08 1598.97 0 1613 2.68125e+08 3300 0 
+
+93750 125000 1.14451e-12 4.38763e-12 2.55905e+08 1599.97 0 1613 2.475e+08 3300 0 
+140625 125000 5.82027e-13 4.04747e-12 2.55943e+08 1597.94 0 1613 2.475e+08 3300 0 
+
+
+140625 118750 2.01204e-14 4.01199e-12 2.76585e+08 1598.97 0 1613 2.68125e+08 3300 0 
+187500 118750 5.11066e-14 2.02973e-12 2.7668e+08 1589.02 0 1613 2.68125e+08 3300 0 
+
+140625 125000 5.82027e-13 4.04747e-12 2.55943e+08 1597.94 0 1613 2.475e+08 3300 0 
+187500 125000 8.97318e-13 1.96222e-12 2.56041e+08 1580.74 0 1613 2.475e+08 3300 0 
+
+
+187500 100000 -2.07174e-12 2.0646e-12 3.38584e+08 1601.95 0 1613 3.3e+08 3300 0 
+234375 100000 -2.01687e-12 3.91643e-13 3.38671e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+187500 106250 -1.42941e-12 2.07908e-12 3.17951e+08 1599.17 0 1613 3.09375e+08 3300 0 
+234375 106250 -1.25116e-12 3.55622e-13 3.18042e+08 1597.28 0 1613 3.09375e+08 3300 0 
+
+
+234375 100000 -2.01687e-12 3.91643e-13 3.38671e+08 1601.95 0 1613 3.3e+08 3300 0 
+281250 100000 -1.71353e-12 -7.36091e-13 3.38749e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+234375 106250 -1.25116e-12 3.55622e-13 3.18042e+08 1597.28 0 1613 3.09375e+08 3300 0 
+281250 106250 -9.33431e-13 -7.79088e-13 3.18122e+08 1594.85 0 1613 3.09375e+08 3300 0 
+
+
+187500 106250 -1.42941e-12 2.07908e-12 3.17951e+08 1599.17 0 1613 3.09375e+08 3300 0 
+234375 106250 -1.25116e-12 3.55622e-13 3.18042e+08 1597.28 0 1613 3.09375e+08 3300 0 
+
+187500 112500 -7.2339e-13 2.06813e-12 2.97316e+08 1594.74 0 1613 2.8875e+08 3300 0 
+234375 112500 -4.16176e-13 3.1096e-13 2.97409e+08 1583.15 0 1613 2.8875e+08 3300 0 
+
+
+234375 106250 -1.25116e-12 3.55622e-13 3.18042e+08 1597.28 0 1613 3.09375e+08 3300 0 
+281250 106250 -9.33431e-13 -7.79088e-13 3.18122e+08 1594.85 0 1613 3.09375e+08 3300 0 
+
+234375 112500 -4.16176e-13 3.1096e-13 2.97409e+08 1583.15 0 1613 2.8875e+08 3300 0 
+281250 112500 -9.25663e-14 -8.18031e-13 2.97487e+08 1568.52 0 1613 2.8875e+08 3300 0 
+
+
+281250 100000 -1.71353e-12 -7.36091e-13 3.38749e+08 1601.95 0 1613 3.3e+08 3300 0 
+328125 100000 -1.38104e-12 -1.31916e-12 3.38814e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+281250 106250 -9.33431e-13 -7.79088e-13 3.18122e+08 1594.85 0 1613 3.09375e+08 3300 0 
+328125 106250 -6.58297e-13 -1.35566e-12 3.18187e+08 1592.49 0 1613 3.09375e+08 3300 0 
+
+
+328125 100000 -1.38104e-12 -1.31916e-12 3.38814e+08 1601.95 0 1613 3.3e+08 3300 0 
+375000 100000 -1.08955e-12 -1.51432e-12 3.38865e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+328125 106250 -6.58297e-13 -1.35566e-12 3.18187e+08 1592.49 0 1613 3.09375e+08 3300 0 
+375000 106250 -4.58218e-13 -1.5424e-12 3.18238e+08 1590.45 0 1613 3.09375e+08 3300 0 
+
+
+281250 106250 -9.33431e-13 -7.79088e-13 3.18122e+08 1594.85 0 1613 3.09375e+08 3300 0 
+328125 106250 -6.58297e-13 -1.35566e-12 3.18187e+08 1592.49 0 1613 3.09375e+08 3300 0 
+
+281250 112500 -9.25663e-14 -8.18031e-13 2.97487e+08 1568.52 0 1613 2.8875e+08 3300 0 
+328125 112500 1.13766e-13 -1.38155e-12 2.97549e+08 1554.41 0 1613 2.8875e+08 3300 0 
+
+
+328125 106250 -6.58297e-13 -1.35566e-12 3.18187e+08 1592.49 0 1613 3.09375e+08 3300 0 
+375000 106250 -4.58218e-13 -1.5424e-12 3.18238e+08 1590.45 0 1613 3.09375e+08 3300 0 
+
+328125 112500 1.13766e-13 -1.38155e-12 2.97549e+08 1554.41 0 1613 2.8875e+08 3300 0 
+375000 112500 2.11904e-13 -1.55767e-12 2.97598e+08 1542.29 0 1613 2.8875e+08 3300 0 
+
+
+187500 112500 -7.2339e-13 2.06813e-12 2.97316e+08 1594.74 0 1613 2.8875e+08 3300 0 
+234375 112500 -4.16176e-13 3.1096e-13 2.97409e+08 1583.15 0 1613 2.8875e+08 3300 0 
+
+187500 118750 5.11066e-14 2.02973e-12 2.7668e+08 1589.02 0 1613 2.68125e+08 3300 0 
+234375 118750 4.89834e-13 2.59061e-13 2.76769e+08 1566.78 0 1613 2.68125e+08 3300 0 
+
+
+234375 112500 -4.16176e-13 3.1096e-13 2.97409e+08 1583.15 0 1613 2.8875e+08 3300 0 
+281250 112500 -9.25663e-14 -8.18031e-13 2.97487e+08 1568.52 0 1613 2.8875e+08 3300 0 
+
+234375 118750 4.89834e-13 2.59061e-13 2.76769e+08 1566.78 0 1613 2.68125e+08 3300 0 
+281250 118750 8.08213e-13 -8.50325e-13 2.76841e+08 1539.75 0 1613 2.68125e+08 3300 0 
+
+
+187500 118750 5.11066e-14 2.02973e-12 2.7668e+08 1589.02 0 1613 2.68125e+08 3300 0 
+234375 118750 4.89834e-13 2.59061e-13 2.76769e+08 1566.78 0 1613 2.68125e+08 3300 0 
+
+187500 125000 8.97318e-13 1.96222e-12 2.56041e+08 1580.74 0 1613 2.475e+08 3300 0 
+234375 125000 1.46497e-12 2.01159e-13 2.56123e+08 1546.21 0 1613 2.475e+08 3300 0 
+
+
+234375 118750 4.89834e-13 2.59061e-13 2.76769e+08 1566.78 0 1613 2.68125e+08 3300 0 
+281250 118750 8.08213e-13 -8.50325e-13 2.76841e+08 1539.75 0 1613 2.68125e+08 3300 0 
+
+234375 125000 1.46497e-12 2.01159e-13 2.56123e+08 1546.21 0 1613 2.475e+08 3300 0 
+281250 125000 1.76397e-12 -8.7462e-13 2.56182e+08 1506.52 0 1613 2.475e+08 3300 0 
+
+
+281250 112500 -9.25663e-14 -8.18031e-13 2.97487e+08 1568.52 0 1613 2.8875e+08 3300 0 
+328125 112500 1.13766e-13 -1.38155e-12 2.97549e+08 1554.41 0 1613 2.8875e+08 3300 0 
+
+281250 118750 8.08213e-13 -8.50325e-13 2.76841e+08 1539.75 0 1613 2.68125e+08 3300 0 
+328125 118750 9.33096e-13 -1.3938e-12 2.76895e+08 1514.12 0 1613 2.68125e+08 3300 0 
+
+
+328125 112500 1.13766e-13 -1.38155e-12 2.97549e+08 1554.41 0 1613 2.8875e+08 3300 0 
+375000 112500 2.11904e-13 -1.55767e-12 2.97598e+08 1542.29 0 1613 2.8875e+08 3300 0 
+
+328125 118750 9.33096e-13 -1.3938e-12 2.76895e+08 1514.12 0 1613 2.68125e+08 3300 0 
+375000 118750 9.18423e-13 -1.55699e-12 2.76936e+08 1492.3 0 1613 2.68125e+08 3300 0 
+
+
+281250 118750 8.08213e-13 -8.50325e-13 2.76841e+08 1539.75 0 1613 2.68125e+08 3300 0 
+328125 118750 9.33096e-13 -1.3938e-12 2.76895e+08 1514.12 0 1613 2.68125e+08 3300 0 
+
+281250 125000 1.76397e-12 -8.7462e-13 2.56182e+08 1506.52 0 1613 2.475e+08 3300 0 
+328125 125000 1.79394e-12 -1.39159e-12 2.56224e+08 1469.86 0 1613 2.475e+08 3300 0 
+
+
+328125 118750 9.33096e-13 -1.3938e-12 2.76895e+08 1514.12 0 1613 2.68125e+08 3300 0 
+375000 118750 9.18423e-13 -1.55699e-12 2.76936e+08 1492.3 0 1613 2.68125e+08 3300 0 
+
+328125 125000 1.79394e-12 -1.39159e-12 2.56224e+08 1469.86 0 1613 2.475e+08 3300 0 
+375000 125000 1.65587e-12 -1.54009e-12 2.56254e+08 1438.99 0 1613 2.475e+08 3300 0 
+
+
+0 125000 0 -3.6102e-13 2.56053e+08 1572.76 0 1613 2.475e+08 3300 0 
+46875 125000 1.31902e-12 1.71473e-12 2.55981e+08 1595.42 0 1613 2.475e+08 3300 0 
+
+0 131250 0 -6.08989e-13 2.35427e+08 1556.41 0 1613 2.26875e+08 3300 0 
+46875 131250 1.39263e-12 1.623e-12 2.35346e+08 1591.57 0 1613 2.26875e+08 3300 0 
+
+
+46875 125000 1.31902e-12 1.71473e-12 2.55981e+08 1595.42 0 1613 2.475e+08 3300 0 
+93750 125000 1.14451e-12 4.38763e-12 2.55905e+08 1599.97 0 1613 2.475e+08 3300 0 
+
+46875 131250 1.39263e-12 1.623e-12 2.35346e+08 1591.57 0 1613 2.26875e+08 3300 0 
+93750 131250 1.43661e-12 4.47695e-12 2.35257e+08 1599.93 0 1613 2.26875e+08 3300 0 
+
+
+0 131250 0 -6.08989e-13 2.35427e+08 1556.41 0 1613 2.26875e+08 3300 0 
+46875 131250 1.39263e-12 1.623e-12 2.35346e+08 1591.57 0 1613 2.26875e+08 3300 0 
+
+0 137500 0 -8.51674e-13 2.14797e+08 1532.65 0 1613 2.0625e+08 3300 0 
+46875 137500 1.40922e-12 1.50811e-12 2.1471e+08 1584.77 0 1613 2.0625e+08 3300 0 
+
+
+46875 131250 1.39263e-12 1.623e-12 2.35346e+08 1591.57 0 1613 2.26875e+08 3300 0 
+93750 131250 1.43661e-12 4.47695e-12 2.35257e+08 1599.93 0 1613 2.26875e+08 3300 0 
+
+46875 137500 1.40922e-12 1.50811e-12 2.1471e+08 1584.77 0 1613 2.0625e+08 3300 0 
+93750 137500 1.71257e-12 4.52927e-12 2.14607e+08 1599.86 0 1613 2.0625e+08 3300 0 
+
+
+93750 125000 1.14451e-12 4.38763e-12 2.55905e+08 1599.97 0 1613 2.475e+08 3300 0 
+140625 125000 5.82027e-13 4.04747e-12 2.55943e+08 1597.94 0 1613 2.475e+08 3300 0 
+
+93750 131250 1.43661e-12 4.47695e-12 2.35257e+08 1599.93 0 1613 2.26875e+08 3300 0 
+140625 131250 1.18839e-12 4.03693e-12 2.35299e+08 1596.04 0 1613 2.26875e+08 3300 0 
+
+
+140625 125000 5.82027e-13 4.04747e-12 2.55943e+08 1597.94 0 1613 2.475e+08 3300 0 
+187500 125000 8.97318e-13 1.96222e-12 2.56041e+08 1580.74 0 1613 2.475e+08 3300 0 
+
+140625 131250 1.18839e-12 4.03693e-12 2.35299e+08 1596.04 0 1613 2.26875e+08 3300 0 
+187500 131250 1.81638e-12 1.86494e-12 2.35398e+08 1568.2 0 1613 2.26875e+08 3300 0 
+
+
+93750 131250 1.43661e-12 4.47695e-12 2.35257e+08 1599.93 0 1613 2.26875e+08 3300 0 
+140625 131250 1.18839e-12 4.03693e-12 2.35299e+08 1596.04 0 1613 2.26875e+08 3300 0 
+
+93750 137500 1.71257e-12 4.52927e-12 2.14607e+08 1599.86 0 1613 2.0625e+08 3300 0 
+140625 137500 1.84314e-12 3.97267e-12 2.14653e+08 1592.48 0 1613 2.0625e+08 3300 0 
+
+
+140625 131250 1.18839e-12 4.03693e-12 2.35299e+08 1596.04 0 1613 2.26875e+08 3300 0 
+187500 131250 1.81638e-12 1.86494e-12 2.35398e+08 1568.2 0 1613 2.26875e+08 3300 0 
+
+140625 137500 1.84314e-12 3.97267e-12 2.14653e+08 1592.48 0 1613 2.0625e+08 3300 0 
+187500 137500 2.80643e-12 1.7387e-12 2.1475e+08 1549.17 0 1613 2.0625e+08 3300 0 
+
+
+0 137500 0 -8.51674e-13 2.14797e+08 1532.65 0 1613 2.0625e+08 3300 0 
+46875 137500 1.40922e-12 1.50811e-12 2.1471e+08 1584.77 0 1613 2.0625e+08 3300 0 
+
+0 143750 0 -1.0735e-12 1.94159e+08 1498.55 0 1613 1.85625e+08 3300 0 
+46875 143750 1.35453e-12 1.36969e-12 1.9407e+08 1572.94 0 1613 1.85625e+08 3300 0 
+
+
+46875 137500 1.40922e-12 1.50811e-12 2.1471e+08 1584.77 0 1613 2.0625e+08 3300 0 
+93750 137500 1.71257e-12 4.52927e-12 2.14607e+08 1599.86 0 1613 2.0625e+08 3300 0 
+
+46875 143750 1.35453e-12 1.36969e-12 1.9407e+08 1572.94 0 1613 1.85625e+08 3300 0 
+93750 143750 1.96602e-12 4.53526e-12 1.93953e+08 1599.71 0 1613 1.85625e+08 3300 0 
+
+
+0 143750 0 -1.0735e-12 1.94159e+08 1498.55 0 1613 1.85625e+08 3300 0 
+46875 143750 1.35453e-12 1.36969e-12 1.9407e+08 1572.94 0 1613 1.85625e+08 3300 0 
+
+0 150000 0 -1.25643e-12 1.73507e+08 1450.71 0 1613 1.65e+08 3300 0 
+46875 150000 1.21497e-12 1.20875e-12 1.73426e+08 1552.7 0 1613 1.65e+08 3300 0 
+
+
+46875 143750 1.35453e-12 1.36969e-12 1.9407e+08 1572.94 0 1613 1.85625e+08 3300 0 
+93750 143750 1.96602e-12 4.53526e-12 1.93953e+08 1599.71 0 1613 1.85625e+08 3300 0 
+
+46875 150000 1.21497e-12 1.20875e-12 1.73426e+08 1552.7 0 1613 1.65e+08 3300 0 
+93750 150000 2.19018e-12 4.48366e-12 1.73298e+08 1599.37 0 1613 1.65e+08 3300 0 
+
+
+93750 137500 1.71257e-12 4.52927e-12 2.14607e+08 1599.86 0 1613 2.0625e+08 3300 0 
+140625 137500 1.84314e-12 3.97267e-12 2.14653e+08 1592.48 0 1613 2.0625e+08 3300 0 
+
+93750 143750 1.96602e-12 4.53526e-12 1.93953e+08 1599.71 0 1613 1.85625e+08 3300 0 
+140625 143750 2.55019e-12 3.84659e-12 1.94005e+08 1585.83 0 1613 1.85625e+08 3300 0 
+
+
+140625 137500 1.84314e-12 3.97267e-12 2.14653e+08 1592.48 0 1613 2.0625e+08 3300 0 
+187500 137500 2.80643e-12 1.7387e-12 2.1475e+08 1549.17 0 1613 2.0625e+08 3300 0 
+
+140625 143750 2.55019e-12 3.84659e-12 1.94005e+08 1585.83 0 1613 1.85625e+08 3300 0 
+187500 143750 3.86127e-12 1.58622e-12 1.94094e+08 1520.69 0 1613 1.85625e+08 3300 0 
+
+
+93750 143750 1.96602e-12 4.53526e-12 1.93953e+08 1599.71 0 1613 1.85625e+08 3300 0 
+140625 143750 2.55019e-12 3.84659e-12 1.94005e+08 1585.83 0 1613 1.85625e+08 3300 0 
+
+93750 150000 2.19018e-12 4.48366e-12 1.73298e+08 1599.37 0 1613 1.65e+08 3300 0 
+140625 150000 3.31256e-12 3.65104e-12 1.73354e+08 1573.59 0 1613 1.65e+08 3300 0 
+
+
+140625 143750 2.55019e-12 3.84659e-12 1.94005e+08 1585.83 0 1613 1.85625e+08 3300 0 
+187500 143750 3.86127e-12 1.58622e-12 1.94094e+08 1520.69 0 1613 1.85625e+08 3300 0 
+
+140625 150000 3.31256e-12 3.65104e-12 1.73354e+08 1573.59 0 1613 1.65e+08 3300 0 
+187500 150000 4.96878e-12 1.41268e-12 1.73424e+08 1479.05 0 1613 1.65e+08 3300 0 
+
+
+187500 125000 8.97318e-13 1.96222e-12 2.56041e+08 1580.74 0 1613 2.475e+08 3300 0 
+234375 125000 1.46497e-12 2.01159e-13 2.56123e+08 1546.21 0 1613 2.475e+08 3300 0 
+
+187500 131250 1.81638e-12 1.86494e-12 2.35398e+08 1568.2 0 1613 2.26875e+08 3300 0 
+234375 131250 2.50322e-12 1.3938e-13 2.35467e+08 1519.29 0 1613 2.26875e+08 3300 0 
+
+
+234375 125000 1.46497e-12 2.01159e-13 2.56123e+08 1546.21 0 1613 2.475e+08 3300 0 
+281250 125000 1.76397e-12 -8.7462e-13 2.56182e+08 1506.52 0 1613 2.475e+08 3300 0 
+
+234375 131250 2.50322e-12 1.3938e-13 2.35467e+08 1519.29 0 1613 2.26875e+08 3300 0 
+281250 131250 2.76554e-12 -8.88728e-13 2.35509e+08 1466.83 0 1613 2.26875e+08 3300 0 
+
+
+187500 131250 1.81638e-12 1.86494e-12 2.35398e+08 1568.2 0 1613 2.26875e+08 3300 0 
+234375 131250 2.50322e-12 1.3938e-13 2.35467e+08 1519.29 0 1613 2.26875e+08 3300 0 
+
+187500 137500 2.80643e-12 1.7387e-12 2.1475e+08 1549.17 0 1613 2.0625e+08 3300 0 
+234375 137500 3.59394e-12 7.64019e-14 2.14799e+08 1483.69 0 1613 2.0625e+08 3300 0 
+
+
+234375 131250 2.50322e-12 1.3938e-13 2.35467e+08 1519.29 0 1613 2.26875e+08 3300 0 
+281250 131250 2.76554e-12 -8.88728e-13 2.35509e+08 1466.83 0 1613 2.26875e+08 3300 0 
+
+234375 137500 3.59394e-12 7.64019e-14 2.14799e+08 1483.69 0 1613 2.0625e+08 3300 0 
+281250 137500 3.79959e-12 -8.90504e-13 2.14818e+08 1418.75 0 1613 2.0625e+08 3300 0 
+
+
+281250 125000 1.76397e-12 -8.7462e-13 2.56182e+08 1506.52 0 1613 2.475e+08 3300 0 
+328125 125000 1.79394e-12 -1.39159e-12 2.56224e+08 1469.86 0 1613 2.475e+08 3300 0 
+
+281250 131250 2.76554e-12 -8.88728e-13 2.35509e+08 1466.83 0 1613 2.26875e+08 3300 0 
+328125 131250 2.68687e-12 -1.37315e-12 2.35534e+08 1419.92 0 1613 2.26875e+08 3300 0 
+
+
+328125 125000 1.79394e-12 -1.39159e-12 2.56224e+08 1469.86 0 1613 2.475e+08 3300 0 
+375000 125000 1.65587e-12 -1.54009e-12 2.56254e+08 1438.99 0 1613 2.475e+08 3300 0 
+
+328125 131250 2.68687e-12 -1.37315e-12 2.35534e+08 1419.92 0 1613 2.26875e+08 3300 0 
+375000 131250 2.41578e-12 -1.50562e-12 2.35549e+08 1381.03 0 1613 2.26875e+08 3300 0 
+
+
+281250 131250 2.76554e-12 -8.88728e-13 2.35509e+08 1466.83 0 1613 2.26875e+08 3300 0 
+328125 131250 2.68687e-12 -1.37315e-12 2.35534e+08 1419.92 0 1613 2.26875e+08 3300 0 
+
+281250 137500 3.79959e-12 -8.90504e-13 2.14818e+08 1418.75 0 1613 2.0625e+08 3300 0 
+328125 137500 3.59905e-12 -1.33709e-12 2.14821e+08 1362.8 0 1613 2.0625e+08 3300 0 
+
+
+328125 131250 2.68687e-12 -1.37315e-12 2.35534e+08 1419.92 0 1613 2.26875e+08 3300 0 
+375000 131250 2.41578e-12 -1.50562e-12 2.35549e+08 1381.03 0 1613 2.26875e+08 3300 0 
+
+328125 137500 3.59905e-12 -1.33709e-12 2.14821e+08 1362.8 0 1613 2.0625e+08 3300 0 
+375000 137500 3.187e-12 -1.45273e-12 2.14819e+08 1317.22 0 1613 2.0625e+08 3300 0 
+
+
+187500 137500 2.80643e-12 1.7387e-12 2.1475e+08 1549.17 0 1613 2.0625e+08 3300 0 
+234375 137500 3.59394e-12 7.64019e-14 2.14799e+08 1483.69 0 1613 2.0625e+08 3300 0 
+
+187500 143750 3.86127e-12 1.58622e-12 1.94094e+08 1520.69 0 1613 1.85625e+08 3300 0 
+234375 143750 4.72142e-12 1.54009e-14 1.94114e+08 1436.96 0 1613 1.85625e+08 3300 0 
+
+
+234375 137500 3.59394e-12 7.64019e-14 2.14799e+08 1483.69 0 1613 2.0625e+08 3300 0 
+281250 137500 3.79959e-12 -8.90504e-13 2.14818e+08 1418.75 0 1613 2.0625e+08 3300 0 
+
+234375 143750 4.72142e-12 1.54009e-14 1.94114e+08 1436.96 0 1613 1.85625e+08 3300 0 
+281250 143750 4.84875e-12 -8.77797e-13 1.94105e+08 1360.5 0 1613 1.85625e+08 3300 0 
+
+
+187500 143750 3.86127e-12 1.58622e-12 1.94094e+08 1520.69 0 1613 1.85625e+08 3300 0 
+234375 143750 4.72142e-12 1.54009e-14 1.94114e+08 1436.96 0 1613 1.85625e+08 3300 0 
+
+187500 150000 4.96878e-12 1.41268e-12 1.73424e+08 1479.05 0 1613 1.65e+08 3300 0 
+234375 150000 5.86445e-12 -3.99705e-14 1.73408e+08 1376.6 0 1613 1.65e+08 3300 0 
+
+
+234375 143750 4.72142e-12 1.54009e-14 1.94114e+08 1436.96 0 1613 1.85625e+08 3300 0 
+281250 143750 4.84875e-12 -8.77797e-13 1.94105e+08 1360.5 0 1613 1.85625e+08 3300 0 
+
+234375 150000 5.86445e-12 -3.99705e-14 1.73408e+08 1376.6 0 1613 1.65e+08 3300 0 
+281250 150000 5.89193e-12 -8.48458e-13 1.73366e+08 1290.53 0 1613 1.65e+08 3300 0 
+
+
+281250 137500 3.79959e-12 -8.90504e-13 2.14818e+08 1418.75 0 1613 2.0625e+08 3300 0 
+328125 137500 3.59905e-12 -1.33709e-12 2.14821e+08 1362.8 0 1613 2.0625e+08 3300 0 
+
+281250 143750 4.84875e-12 -8.77797e-13 1.94105e+08 1360.5 0 1613 1.85625e+08 3300 0 
+328125 143750 4.51458e-12 -1.28224e-12 1.94084e+08 1297.19 0 1613 1.85625e+08 3300 0 
+
+
+328125 137500 3.59905e-12 -1.33709e-12 2.14821e+08 1362.8 0 1613 2.0625e+08 3300 0 
+375000 137500 3.187e-12 -1.45273e-12 2.14819e+08 1317.22 0 1613 2.0625e+08 3300 0 
+
+328125 143750 4.51458e-12 -1.28224e-12 1.94084e+08 1297.19 0 1613 1.85625e+08 3300 0 
+375000 143750 3.95608e-12 -1.38082e-12 1.94061e+08 1246.59 0 1613 1.85625e+08 3300 0 
+
+
+281250 143750 4.84875e-12 -8.77797e-13 1.94105e+08 1360.5 0 1613 1.85625e+08 3300 0 
+328125 143750 4.51458e-12 -1.28224e-12 1.94084e+08 1297.19 0 1613 1.85625e+08 3300 0 
+
+281250 150000 5.89193e-12 -8.48458e-13 1.73366e+08 1290.53 0 1613 1.65e+08 3300 0 
+328125 150000 5.415e-12 -1.20766e-12 1.73317e+08 1222.07 0 1613 1.65e+08 3300 0 
+
+
+328125 143750 4.51458e-12 -1.28224e-12 1.94084e+08 1297.19 0 1613 1.85625e+08 3300 0 
+375000 143750 3.95608e-12 -1.38082e-12 1.94061e+08 1246.59 0 1613 1.85625e+08 3300 0 
+
+328125 150000 5.415e-12 -1.20766e-12 1.73317e+08 1222.07 0 1613 1.65e+08 3300 0 
+375000 150000 4.70772e-12 -1.28951e-12 1.73272e+08 1168.42 0 1613 1.65e+08 3300 0 
+
+
+375000 100000 -1.08955e-12 -1.51432e-12 3.38865e+08 1601.95 0 1613 3.3e+08 3300 0 
+421875 100000 -8.5189e-13 -1.47843e-12 3.38906e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+375000 106250 -4.58218e-13 -1.5424e-12 3.18238e+08 1590.45 0 1613 3.09375e+08 3300 0 
+421875 106250 -3.20866e-13 -1.49933e-12 3.18279e+08 1588.8 0 1613 3.09375e+08 3300 0 
+
+
+421875 100000 -8.5189e-13 -1.47843e-12 3.38906e+08 1601.95 0 1613 3.3e+08 3300 0 
+468750 100000 -6.63488e-13 -1.32612e-12 3.38937e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+421875 106250 -3.20866e-13 -1.49933e-12 3.18279e+08 1588.8 0 1613 3.09375e+08 3300 0 
+468750 106250 -2.27852e-13 -1.34154e-12 3.1831e+08 1587.48 0 1613 3.09375e+08 3300 0 
+
+
+375000 106250 -4.58218e-13 -1.5424e-12 3.18238e+08 1590.45 0 1613 3.09375e+08 3300 0 
+421875 106250 -3.20866e-13 -1.49933e-12 3.18279e+08 1588.8 0 1613 3.09375e+08 3300 0 
+
+375000 112500 2.11904e-13 -1.55767e-12 2.97598e+08 1542.29 0 1613 2.8875e+08 3300 0 
+421875 112500 2.40312e-13 -1.50773e-12 2.97635e+08 1532.42 0 1613 2.8875e+08 3300 0 
+
+
+421875 106250 -3.20866e-13 -1.49933e-12 3.18279e+08 1588.8 0 1613 3.09375e+08 3300 0 
+468750 106250 -2.27852e-13 -1.34154e-12 3.1831e+08 1587.48 0 1613 3.09375e+08 3300 0 
+
+421875 112500 2.40312e-13 -1.50773e-12 2.97635e+08 1532.42 0 1613 2.8875e+08 3300 0 
+468750 112500 2.3113e-13 -1.34596e-12 2.97664e+08 1524.58 0 1613 2.8875e+08 3300 0 
+
+
+468750 100000 -6.63488e-13 -1.32612e-12 3.38937e+08 1601.95 0 1613 3.3e+08 3300 0 
+515625 100000 -5.15859e-13 -1.12899e-12 3.38962e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+468750 106250 -2.27852e-13 -1.34154e-12 3.1831e+08 1587.48 0 1613 3.09375e+08 3300 0 
+515625 106250 -1.64269e-13 -1.14036e-12 3.18334e+08 1586.44 0 1613 3.09375e+08 3300 0 
+
+
+515625 100000 -5.15859e-13 -1.12899e-12 3.38962e+08 1601.95 0 1613 3.3e+08 3300 0 
+562500 100000 -4.00761e-13 -9.25781e-13 3.38981e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+515625 106250 -1.64269e-13 -1.14036e-12 3.18334e+08 1586.44 0 1613 3.09375e+08 3300 0 
+562500 106250 -1.19733e-13 -9.3418e-13 3.18353e+08 1585.63 0 1613 3.09375e+08 3300 0 
+
+
+468750 106250 -2.27852e-13 -1.34154e-12 3.1831e+08 1587.48 0 1613 3.09375e+08 3300 0 
+515625 106250 -1.64269e-13 -1.14036e-12 3.18334e+08 1586.44 0 1613 3.09375e+08 3300 0 
+
+468750 112500 2.3113e-13 -1.34596e-12 2.97664e+08 1524.58 0 1613 2.8875e+08 3300 0 
+515625 112500 2.05376e-13 -1.14268e-12 2.97687e+08 1518.42 0 1613 2.8875e+08 3300 0 
+
+
+515625 106250 -1.64269e-13 -1.14036e-12 3.18334e+08 1586.44 0 1613 3.09375e+08 3300 0 
+562500 106250 -1.19733e-13 -9.3418e-13 3.18353e+08 1585.63 0 1613 3.09375e+08 3300 0 
+
+515625 112500 2.05376e-13 -1.14268e-12 2.97687e+08 1518.42 0 1613 2.8875e+08 3300 0 
+562500 112500 1.75256e-13 -9.35553e-13 2.97704e+08 1513.61 0 1613 2.8875e+08 3300 0 
+
+
+375000 112500 2.11904e-13 -1.55767e-12 2.97598e+08 1542.29 0 1613 2.8875e+08 3300 0 
+421875 112500 2.40312e-13 -1.50773e-12 2.97635e+08 1532.42 0 1613 2.8875e+08 3300 0 
+
+375000 118750 9.18423e-13 -1.55699e-12 2.76936e+08 1492.3 0 1613 2.68125e+08 3300 0 
+421875 118750 8.29345e-13 -1.50038e-12 2.76968e+08 1474.58 0 1613 2.68125e+08 3300 0 
+
+
+421875 112500 2.40312e-13 -1.50773e-12 2.97635e+08 1532.42 0 1613 2.8875e+08 3300 0 
+468750 112500 2.3113e-13 -1.34596e-12 2.97664e+08 1524.58 0 1613 2.8875e+08 3300 0 
+
+421875 118750 8.29345e-13 -1.50038e-12 2.76968e+08 1474.58 0 1613 2.68125e+08 3300 0 
+468750 118750 7.11426e-13 -1.33608e-12 2.76992e+08 1460.52 0 1613 2.68125e+08 3300 0 
+
+
+375000 118750 9.18423e-13 -1.55699e-12 2.76936e+08 1492.3 0 1613 2.68125e+08 3300 0 
+421875 118750 8.29345e-13 -1.50038e-12 2.76968e+08 1474.58 0 1613 2.68125e+08 3300 0 
+
+375000 125000 1.65587e-12 -1.54009e-12 2.56254e+08 1438.99 0 1613 2.475e+08 3300 0 
+421875 125000 1.44146e-12 -1.47753e-12 2.56276e+08 1414.08 0 1613 2.475e+08 3300 0 
+
+
+421875 118750 8.29345e-13 -1.50038e-12 2.76968e+08 1474.58 0 1613 2.68125e+08 3300 0 
+468750 118750 7.11426e-13 -1.33608e-12 2.76992e+08 1460.52 0 1613 2.68125e+08 3300 0 
+
+421875 125000 1.44146e-12 -1.47753e-12 2.56276e+08 1414.08 0 1613 2.475e+08 3300 0 
+468750 125000 1.20906e-12 -1.31254e-12 2.56293e+08 1394.36 0 1613 2.475e+08 3300 0 
+
+
+468750 112500 2.3113e-13 -1.34596e-12 2.97664e+08 1524.58 0 1613 2.8875e+08 3300 0 
+515625 112500 2.05376e-13 -1.14268e-12 2.97687e+08 1518.42 0 1613 2.8875e+08 3300 0 
+
+468750 118750 7.11426e-13 -1.33608e-12 2.76992e+08 1460.52 0 1613 2.68125e+08 3300 0 
+515625 118750 5.91364e-13 -1.13263e-12 2.7701e+08 1449.48 0 1613 2.68125e+08 3300 0 
+
+
+515625 112500 2.05376e-13 -1.14268e-12 2.97687e+08 1518.42 0 1613 2.8875e+08 3300 0 
+562500 112500 1.75256e-13 -9.35553e-13 2.97704e+08 1513.61 0 1613 2.8875e+08 3300 0 
+
+515625 118750 5.91364e-13 -1.13263e-12 2.7701e+08 1449.48 0 1613 2.68125e+08 3300 0 
+562500 118750 4.82798e-13 -9.26519e-13 2.77025e+08 1440.87 0 1613 2.68125e+08 3300 0 
+
+
+468750 118750 7.11426e-13 -1.33608e-12 2.76992e+08 1460.52 0 1613 2.68125e+08 3300 0 
+515625 118750 5.91364e-13 -1.13263e-12 2.7701e+08 1449.48 0 1613 2.68125e+08 3300 0 
+
+468750 125000 1.20906e-12 -1.31254e-12 2.56293e+08 1394.36 0 1613 2.475e+08 3300 0 
+515625 125000 9.90464e-13 -1.1111e-12 2.56305e+08 1378.91 0 1613 2.475e+08 3300 0 
+
+
+515625 118750 5.91364e-13 -1.13263e-12 2.7701e+08 1449.48 0 1613 2.68125e+08 3300 0 
+562500 118750 4.82798e-13 -9.26519e-13 2.77025e+08 1440.87 0 1613 2.68125e+08 3300 0 
+
+515625 125000 9.90464e-13 -1.1111e-12 2.56305e+08 1378.91 0 1613 2.475e+08 3300 0 
+562500 125000 8.003e-13 -9.08202e-13 2.56315e+08 1366.86 0 1613 2.475e+08 3300 0 
+
+
+562500 100000 -4.00761e-13 -9.25781e-13 3.38981e+08 1601.95 0 1613 3.3e+08 3300 0 
+609375 100000 -3.11228e-13 -7.32825e-13 3.38996e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+562500 106250 -1.19733e-13 -9.3418e-13 3.18353e+08 1585.63 0 1613 3.09375e+08 3300 0 
+609375 106250 -8.72421e-14 -7.39069e-13 3.18368e+08 1585 0 1613 3.09375e+08 3300 0 
+
+
+609375 100000 -3.11228e-13 -7.32825e-13 3.38996e+08 1601.95 0 1613 3.3e+08 3300 0 
+656250 100000 -2.41658e-13 -5.51194e-13 3.39008e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+609375 106250 -8.72421e-14 -7.39069e-13 3.18368e+08 1585 0 1613 3.09375e+08 3300 0 
+656250 106250 -6.18481e-14 -5.55911e-13 3.18379e+08 1584.51 0 1613 3.09375e+08 3300 0 
+
+
+562500 106250 -1.19733e-13 -9.3418e-13 3.18353e+08 1585.63 0 1613 3.09375e+08 3300 0 
+609375 106250 -8.72421e-14 -7.39069e-13 3.18368e+08 1585 0 1613 3.09375e+08 3300 0 
+
+562500 112500 1.75256e-13 -9.35553e-13 2.97704e+08 1513.61 0 1613 2.8875e+08 3300 0 
+609375 112500 1.47535e-13 -7.40195e-13 2.97718e+08 1509.86 0 1613 2.8875e+08 3300 0 
+
+
+609375 106250 -8.72421e-14 -7.39069e-13 3.18368e+08 1585 0 1613 3.09375e+08 3300 0 
+656250 106250 -6.18481e-14 -5.55911e-13 3.18379e+08 1584.51 0 1613 3.09375e+08 3300 0 
+
+609375 112500 1.47535e-13 -7.40195e-13 2.97718e+08 1509.86 0 1613 2.8875e+08 3300 0 
+656250 112500 1.26285e-13 -5.57295e-13 2.97728e+08 1506.95 0 1613 2.8875e+08 3300 0 
+
+
+656250 100000 -2.41658e-13 -5.51194e-13 3.39008e+08 1601.95 0 1613 3.3e+08 3300 0 
+703125 100000 -1.87631e-13 -3.6977e-13 3.39017e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+656250 106250 -6.18481e-14 -5.55911e-13 3.18379e+08 1584.51 0 1613 3.09375e+08 3300 0 
+703125 106250 -3.94737e-14 -3.73492e-13 3.18388e+08 1584.13 0 1613 3.09375e+08 3300 0 
+
+
+703125 100000 -1.87631e-13 -3.6977e-13 3.39017e+08 1601.95 0 1613 3.3e+08 3300 0 
+750000 100000 -1.45711e-13 -1.64066e-13 3.39023e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+703125 106250 -3.94737e-14 -3.73492e-13 3.18388e+08 1584.13 0 1613 3.09375e+08 3300 0 
+750000 106250 -1.57948e-14 -1.6732e-13 3.18395e+08 1583.83 0 1613 3.09375e+08 3300 0 
+
+
+656250 106250 -6.18481e-14 -5.55911e-13 3.18379e+08 1584.51 0 1613 3.09375e+08 3300 0 
+703125 106250 -3.94737e-14 -3.73492e-13 3.18388e+08 1584.13 0 1613 3.09375e+08 3300 0 
+
+656250 112500 1.26285e-13 -5.57295e-13 2.97728e+08 1506.95 0 1613 2.8875e+08 3300 0 
+703125 112500 1.15065e-13 -3.75656e-13 2.97736e+08 1504.69 0 1613 2.8875e+08 3300 0 
+
+
+703125 106250 -3.94737e-14 -3.73492e-13 3.18388e+08 1584.13 0 1613 3.09375e+08 3300 0 
+750000 106250 -1.57948e-14 -1.6732e-13 3.18395e+08 1583.83 0 1613 3.09375e+08 3300 0 
+
+703125 112500 1.15065e-13 -3.75656e-13 2.97736e+08 1504.69 0 1613 2.8875e+08 3300 0 
+750000 112500 1.18934e-13 -1.71017e-13 2.97743e+08 1502.93 0 1613 2.8875e+08 3300 0 
+
+
+562500 112500 1.75256e-13 -9.35553e-13 2.97704e+08 1513.61 0 1613 2.8875e+08 3300 0 
+609375 112500 1.47535e-13 -7.40195e-13 2.97718e+08 1509.86 0 1613 2.8875e+08 3300 0 
+
+562500 118750 4.82798e-13 -9.26519e-13 2.77025e+08 1440.87 0 1613 2.68125e+08 3300 0 
+609375 118750 3.91954e-13 -7.32783e-13 2.77036e+08 1434.17 0 1613 2.68125e+08 3300 0 
+
+
+609375 112500 1.47535e-13 -7.40195e-13 2.97718e+08 1509.86 0 1613 2.8875e+08 3300 0 
+656250 112500 1.26285e-13 -5.57295e-13 2.97728e+08 1506.95 0 1613 2.8875e+08 3300 0 
+
+609375 118750 3.91954e-13 -7.32783e-13 2.77036e+08 1434.17 0 1613 2.68125e+08 3300 0 
+656250 118750 3.21793e-13 -5.51899e-13 2.77044e+08 1428.96 0 1613 2.68125e+08 3300 0 
+
+
+562500 118750 4.82798e-13 -9.26519e-13 2.77025e+08 1440.87 0 1613 2.68125e+08 3300 0 
+609375 118750 3.91954e-13 -7.32783e-13 2.77036e+08 1434.17 0 1613 2.68125e+08 3300 0 
+
+562500 125000 8.003e-13 -9.08202e-13 2.56315e+08 1366.86 0 1613 2.475e+08 3300 0 
+609375 125000 6.43943e-13 -7.18117e-13 2.56322e+08 1357.48 0 1613 2.475e+08 3300 0 
+
+
+609375 118750 3.91954e-13 -7.32783e-13 2.77036e+08 1434.17 0 1613 2.68125e+08 3300 0 
+656250 118750 3.21793e-13 -5.51899e-13 2.77044e+08 1428.96 0 1613 2.68125e+08 3300 0 
+
+609375 125000 6.43943e-13 -7.18117e-13 2.56322e+08 1357.48 0 1613 2.475e+08 3300 0 
+656250 125000 5.23011e-13 -5.41118e-13 2.56328e+08 1350.2 0 1613 2.475e+08 3300 0 
+
+
+656250 112500 1.26285e-13 -5.57295e-13 2.97728e+08 1506.95 0 1613 2.8875e+08 3300 0 
+703125 112500 1.15065e-13 -3.75656e-13 2.97736e+08 1504.69 0 1613 2.8875e+08 3300 0 
+
+656250 118750 3.21793e-13 -5.51899e-13 2.77044e+08 1428.96 0 1613 2.68125e+08 3300 0 
+703125 118750 2.75166e-13 -3.72785e-13 2.77051e+08 1424.91 0 1613 2.68125e+08 3300 0 
+
+
+703125 112500 1.15065e-13 -3.75656e-13 2.97736e+08 1504.69 0 1613 2.8875e+08 3300 0 
+750000 112500 1.18934e-13 -1.71017e-13 2.97743e+08 1502.93 0 1613 2.8875e+08 3300 0 
+
+703125 118750 2.75166e-13 -3.72785e-13 2.77051e+08 1424.91 0 1613 2.68125e+08 3300 0 
+750000 118750 2.57698e-13 -1.71647e-13 2.77056e+08 1421.76 0 1613 2.68125e+08 3300 0 
+
+
+656250 118750 3.21793e-13 -5.51899e-13 2.77044e+08 1428.96 0 1613 2.68125e+08 3300 0 
+703125 118750 2.75166e-13 -3.72785e-13 2.77051e+08 1424.91 0 1613 2.68125e+08 3300 0 
+
+656250 125000 5.23011e-13 -5.41118e-13 2.56328e+08 1350.2 0 1613 2.475e+08 3300 0 
+703125 125000 4.39457e-13 -3.66355e-13 2.56332e+08 1344.53 0 1613 2.475e+08 3300 0 
+
+
+703125 118750 2.75166e-13 -3.72785e-13 2.77051e+08 1424.91 0 1613 2.68125e+08 3300 0 
+750000 118750 2.57698e-13 -1.71647e-13 2.77056e+08 1421.76 0 1613 2.68125e+08 3300 0 
+
+703125 125000 4.39457e-13 -3.66355e-13 2.56332e+08 1344.53 0 1613 2.475e+08 3300 0 
+750000 125000 3.99291e-13 -1.70735e-13 2.56335e+08 1340.14 0 1613 2.475e+08 3300 0 
+
+
+375000 125000 1.65587e-12 -1.54009e-12 2.56254e+08 1438.99 0 1613 2.475e+08 3300 0 
+421875 125000 1.44146e-12 -1.47753e-12 2.56276e+08 1414.08 0 1613 2.475e+08 3300 0 
+
+375000 131250 2.41578e-12 -1.50562e-12 2.35549e+08 1381.03 0 1613 2.26875e+08 3300 0 
+421875 131250 2.06953e-12 -1.4381e-12 2.35559e+08 1349.86 0 1613 2.26875e+08 3300 0 
+
+
+421875 125000 1.44146e-12 -1.47753e-12 2.56276e+08 1414.08 0 1613 2.475e+08 3300 0 
+468750 125000 1.20906e-12 -1.31254e-12 2.56293e+08 1394.36 0 1613 2.475e+08 3300 0 
+
+421875 131250 2.06953e-12 -1.4381e-12 2.35559e+08 1349.86 0 1613 2.26875e+08 3300 0 
+468750 131250 1.71822e-12 -1.27444e-12 2.35566e+08 1325.28 0 1613 2.26875e+08 3300 0 
+
+
+375000 131250 2.41578e-12 -1.50562e-12 2.35549e+08 1381.03 0 1613 2.26875e+08 3300 0 
+421875 131250 2.06953e-12 -1.4381e-12 2.35559e+08 1349.86 0 1613 2.26875e+08 3300 0 
+
+375000 137500 3.187e-12 -1.45273e-12 2.14819e+08 1317.22 0 1613 2.0625e+08 3300 0 
+421875 137500 2.70432e-12 -1.38159e-12 2.14814e+08 1281 0 1613 2.0625e+08 3300 0 
+
+
+421875 131250 2.06953e-12 -1.4381e-12 2.35559e+08 1349.86 0 1613 2.26875e+08 3300 0 
+468750 131250 1.71822e-12 -1.27444e-12 2.35566e+08 1325.28 0 1613 2.26875e+08 3300 0 
+
+421875 137500 2.70432e-12 -1.38159e-12 2.14814e+08 1281 0 1613 2.0625e+08 3300 0 
+468750 137500 2.23142e-12 -1.22148e-12 2.1481e+08 1252.56 0 1613 2.0625e+08 3300 0 
+
+
+468750 125000 1.20906e-12 -1.31254e-12 2.56293e+08 1394.36 0 1613 2.475e+08 3300 0 
+515625 125000 9.90464e-13 -1.1111e-12 2.56305e+08 1378.91 0 1613 2.475e+08 3300 0 
+
+468750 131250 1.71822e-12 -1.27444e-12 2.35566e+08 1325.28 0 1613 2.26875e+08 3300 0 
+515625 131250 1.398e-12 -1.07733e-12 2.35571e+08 1306.06 0 1613 2.26875e+08 3300 0 
+
+
+515625 125000 9.90464e-13 -1.1111e-12 2.56305e+08 1378.91 0 1613 2.475e+08 3300 0 
+562500 125000 8.003e-13 -9.08202e-13 2.56315e+08 1366.86 0 1613 2.475e+08 3300 0 
+
+515625 131250 1.398e-12 -1.07733e-12 2.35571e+08 1306.06 0 1613 2.26875e+08 3300 0 
+562500 131250 1.12405e-12 -8.79905e-13 2.35574e+08 1291.07 0 1613 2.26875e+08 3300 0 
+
+
+468750 131250 1.71822e-12 -1.27444e-12 2.35566e+08 1325.28 0 1613 2.26875e+08 3300 0 
+515625 131250 1.398e-12 -1.07733e-12 2.35571e+08 1306.06 0 1613 2.26875e+08 3300 0 
+
+468750 137500 2.23142e-12 -1.22148e-12 2.1481e+08 1252.56 0 1613 2.0625e+08 3300 0 
+515625 137500 1.80803e-12 -1.03116e-12 2.14806e+08 1230.35 0 1613 2.0625e+08 3300 0 
+
+
+515625 131250 1.398e-12 -1.07733e-12 2.35571e+08 1306.06 0 1613 2.26875e+08 3300 0 
+562500 131250 1.12405e-12 -8.79905e-13 2.35574e+08 1291.07 0 1613 2.26875e+08 3300 0 
+
+515625 137500 1.80803e-12 -1.03116e-12 2.14806e+08 1230.35 0 1613 2.0625e+08 3300 0 
+562500 137500 1.44935e-12 -8.41559e-13 2.14802e+08 1213.06 0 1613 2.0625e+08 3300 0 
+
+
+375000 137500 3.187e-12 -1.45273e-12 2.14819e+08 1317.22 0 1613 2.0625e+08 3300 0 
+421875 137500 2.70432e-12 -1.38159e-12 2.14814e+08 1281 0 1613 2.0625e+08 3300 0 
+
+375000 143750 3.95608e-12 -1.38082e-12 1.94061e+08 1246.59 0 1613 1.85625e+08 3300 0 
+421875 143750 3.33482e-12 -1.30771e-12 1.9404e+08 1206.75 0 1613 1.85625e+08 3300 0 
+
+
+421875 137500 2.70432e-12 -1.38159e-12 2.14814e+08 1281 0 1613 2.0625e+08 3300 0 
+468750 137500 2.23142e-12 -1.22148e-12 2.1481e+08 1252.56 0 1613 2.0625e+08 3300 0 
+
+421875 143750 3.33482e-12 -1.30771e-12 1.9404e+08 1206.75 0 1613 1.85625e+08 3300 0 
+468750 143750 2.73987e-12 -1.15356e-12 1.94023e+08 1175.62 0 1613 1.85625e+08 3300 0 
+
+
+375000 143750 3.95608e-12 -1.38082e-12 1.94061e+08 1246.59 0 1613 1.85625e+08 3300 0 
+421875 143750 3.33482e-12 -1.30771e-12 1.9404e+08 1206.75 0 1613 1.85625e+08 3300 0 
+
+375000 150000 4.70772e-12 -1.28951e-12 1.73272e+08 1168.42 0 1613 1.65e+08 3300 0 
+421875 150000 3.94871e-12 -1.21639e-12 1.73234e+08 1126.6 0 1613 1.65e+08 3300 0 
+
+
+421875 143750 3.33482e-12 -1.30771e-12 1.9404e+08 1206.75 0 1613 1.85625e+08 3300 0 
+468750 143750 2.73987e-12 -1.15356e-12 1.94023e+08 1175.62 0 1613 1.85625e+08 3300 0 
+
+421875 150000 3.94871e-12 -1.21639e-12 1.73234e+08 1126.6 0 1613 1.65e+08 3300 0 
+468750 150000 3.23375e-12 -1.0707e-12 1.73203e+08 1094.07 0 1613 1.65e+08 3300 0 
+
+
+468750 137500 2.23142e-12 -1.22148e-12 2.1481e+08 1252.56 0 1613 2.0625e+08 3300 0 
+515625 137500 1.80803e-12 -1.03116e-12 2.14806e+08 1230.35 0 1613 2.0625e+08 3300 0 
+
+468750 143750 2.73987e-12 -1.15356e-12 1.94023e+08 1175.62 0 1613 1.85625e+08 3300 0 
+515625 143750 2.21358e-12 -9.72557e-13 1.94008e+08 1151.36 0 1613 1.85625e+08 3300 0 
+
+
+515625 137500 1.80803e-12 -1.03116e-12 2.14806e+08 1230.35 0 1613 2.0625e+08 3300 0 
+562500 137500 1.44935e-12 -8.41559e-13 2.14802e+08 1213.06 0 1613 2.0625e+08 3300 0 
+
+515625 143750 2.21358e-12 -9.72557e-13 1.94008e+08 1151.36 0 1613 1.85625e+08 3300 0 
+562500 143750 1.7707e-12 -7.93164e-13 1.93997e+08 1132.5 0 1613 1.85625e+08 3300 0 
+
+
+468750 143750 2.73987e-12 -1.15356e-12 1.94023e+08 1175.62 0 1613 1.85625e+08 3300 0 
+515625 143750 2.21358e-12 -9.72557e-13 1.94008e+08 1151.36 0 1613 1.85625e+08 3300 0 
+
+468750 150000 3.23375e-12 -1.0707e-12 1.73203e+08 1094.07 0 1613 1.65e+08 3300 0 
+515625 150000 2.6069e-12 -9.01585e-13 1.73178e+08 1068.78 0 1613 1.65e+08 3300 0 
+
+
+515625 143750 2.21358e-12 -9.72557e-13 1.94008e+08 1151.36 0 1613 1.85625e+08 3300 0 
+562500 143750 1.7707e-12 -7.93164e-13 1.93997e+08 1132.5 0 1613 1.85625e+08 3300 0 
+
+515625 150000 2.6069e-12 -9.01585e-13 1.73178e+08 1068.78 0 1613 1.65e+08 3300 0 
+562500 150000 2.08202e-12 -7.3477e-13 1.73158e+08 1049.15 0 1613 1.65e+08 3300 0 
+
+
+562500 125000 8.003e-13 -9.08202e-13 2.56315e+08 1366.86 0 1613 2.475e+08 3300 0 
+609375 125000 6.43943e-13 -7.18117e-13 2.56322e+08 1357.48 0 1613 2.475e+08 3300 0 
+
+562500 131250 1.12405e-12 -8.79905e-13 2.35574e+08 1291.07 0 1613 2.26875e+08 3300 0 
+609375 131250 9.00563e-13 -6.9555e-13 2.35577e+08 1279.42 0 1613 2.26875e+08 3300 0 
+
+
+609375 125000 6.43943e-13 -7.18117e-13 2.56322e+08 1357.48 0 1613 2.475e+08 3300 0 
+656250 125000 5.23011e-13 -5.41118e-13 2.56328e+08 1350.2 0 1613 2.475e+08 3300 0 
+
+609375 131250 9.00563e-13 -6.9555e-13 2.35577e+08 1279.42 0 1613 2.26875e+08 3300 0 
+656250 131250 7.276e-13 -5.24337e-13 2.35579e+08 1270.36 0 1613 2.26875e+08 3300 0 
+
+
+562500 131250 1.12405e-12 -8.79905e-13 2.35574e+08 1291.07 0 1613 2.26875e+08 3300 0 
+609375 131250 9.00563e-13 -6.9555e-13 2.35577e+08 1279.42 0 1613 2.26875e+08 3300 0 
+
+562500 137500 1.44935e-12 -8.41559e-13 2.14802e+08 1213.06 0 1613 2.0625e+08 3300 0 
+609375 137500 1.15811e-12 -6.65063e-13 2.14799e+08 1199.62 0 1613 2.0625e+08 3300 0 
+
+
+609375 131250 9.00563e-13 -6.9555e-13 2.35577e+08 1279.42 0 1613 2.26875e+08 3300 0 
+656250 131250 7.276e-13 -5.24337e-13 2.35579e+08 1270.36 0 1613 2.26875e+08 3300 0 
+
+609375 137500 1.15811e-12 -6.65063e-13 2.14799e+08 1199.62 0 1613 2.0625e+08 3300 0 
+656250 137500 9.32635e-13 -5.01561e-13 2.14797e+08 1189.18 0 1613 2.0625e+08 3300 0 
+
+
+656250 125000 5.23011e-13 -5.41118e-13 2.56328e+08 1350.2 0 1613 2.475e+08 3300 0 
+703125 125000 4.39457e-13 -3.66355e-13 2.56332e+08 1344.53 0 1613 2.475e+08 3300 0 
+
+656250 131250 7.276e-13 -5.24337e-13 2.35579e+08 1270.36 0 1613 2.26875e+08 3300 0 
+703125 131250 6.06043e-13 -3.55761e-13 2.3558e+08 1263.32 0 1613 2.26875e+08 3300 0 
+
+
+703125 125000 4.39457e-13 -3.66355e-13 2.56332e+08 1344.53 0 1613 2.475e+08 3300 0 
+750000 125000 3.99291e-13 -1.70735e-13 2.56335e+08 1340.14 0 1613 2.475e+08 3300 0 
+
+703125 131250 6.06043e-13 -3.55761e-13 2.3558e+08 1263.32 0 1613 2.26875e+08 3300 0 
+750000 131250 5.42107e-13 -1.67663e-13 2.35581e+08 1257.86 0 1613 2.26875e+08 3300 0 
+
+
+656250 131250 7.276e-13 -5.24337e-13 2.35579e+08 1270.36 0 1613 2.26875e+08 3300 0 
+703125 131250 6.06043e-13 -3.55761e-13 2.3558e+08 1263.32 0 1613 2.26875e+08 3300 0 
+
+656250 137500 9.32635e-13 -5.01561e-13 2.14797e+08 1189.18 0 1613 2.0625e+08 3300 0 
+703125 137500 7.72578e-13 -3.41011e-13 2.14795e+08 1181.07 0 1613 2.0625e+08 3300 0 
+
+
+703125 131250 6.06043e-13 -3.55761e-13 2.3558e+08 1263.32 0 1613 2.26875e+08 3300 0 
+750000 131250 5.42107e-13 -1.67663e-13 2.35581e+08 1257.86 0 1613 2.26875e+08 3300 0 
+
+703125 137500 7.72578e-13 -3.41011e-13 2.14795e+08 1181.07 0 1613 2.0625e+08 3300 0 
+750000 137500 6.84194e-13 -1.62415e-13 2.14793e+08 1174.78 0 1613 2.0625e+08 3300 0 
+
+
+562500 137500 1.44935e-12 -8.41559e-13 2.14802e+08 1213.06 0 1613 2.0625e+08 3300 0 
+609375 137500 1.15811e-12 -6.65063e-13 2.14799e+08 1199.62 0 1613 2.0625e+08 3300 0 
+
+562500 143750 1.7707e-12 -7.93164e-13 1.93997e+08 1132.5 0 1613 1.85625e+08 3300 0 
+609375 143750 1.41227e-12 -6.26664e-13 1.93988e+08 1117.84 0 1613 1.85625e+08 3300 0 
+
+
+609375 137500 1.15811e-12 -6.65063e-13 2.14799e+08 1199.62 0 1613 2.0625e+08 3300 0 
+656250 137500 9.32635e-13 -5.01561e-13 2.14797e+08 1189.18 0 1613 2.0625e+08 3300 0 
+
+609375 143750 1.41227e-12 -6.26664e-13 1.93988e+08 1117.84 0 1613 1.85625e+08 3300 0 
+656250 143750 1.13471e-12 -4.72788e-13 1.93981e+08 1106.46 0 1613 1.85625e+08 3300 0 
+
+
+562500 143750 1.7707e-12 -7.93164e-13 1.93997e+08 1132.5 0 1613 1.85625e+08 3300 0 
+609375 143750 1.41227e-12 -6.26664e-13 1.93988e+08 1117.84 0 1613 1.85625e+08 3300 0 
+
+562500 150000 2.08202e-12 -7.3477e-13 1.73158e+08 1049.15 0 1613 1.65e+08 3300 0 
+609375 150000 1.65826e-12 -5.80371e-13 1.73143e+08 1033.9 0 1613 1.65e+08 3300 0 
+
+
+609375 143750 1.41227e-12 -6.26664e-13 1.93988e+08 1117.84 0 1613 1.85625e+08 3300 0 
+656250 143750 1.13471e-12 -4.72788e-13 1.93981e+08 1106.46 0 1613 1.85625e+08 3300 0 
+
+609375 150000 1.65826e-12 -5.80371e-13 1.73143e+08 1033.9 0 1613 1.65e+08 3300 0 
+656250 150000 1.33008e-12 -4.37996e-13 1.73131e+08 1022.06 0 1613 1.65e+08 3300 0 
+
+
+656250 137500 9.32635e-13 -5.01561e-13 2.14797e+08 1189.18 0 1613 2.0625e+08 3300 0 
+703125 137500 7.72578e-13 -3.41011e-13 2.14795e+08 1181.07 0 1613 2.0625e+08 3300 0 
+
+656250 143750 1.13471e-12 -4.72788e-13 1.93981e+08 1106.46 0 1613 1.85625e+08 3300 0 
+703125 143750 9.36345e-13 -3.22076e-13 1.93975e+08 1097.62 0 1613 1.85625e+08 3300 0 
+
+
+703125 137500 7.72578e-13 -3.41011e-13 2.14795e+08 1181.07 0 1613 2.0625e+08 3300 0 
+750000 137500 6.84194e-13 -1.62415e-13 2.14793e+08 1174.78 0 1613 2.0625e+08 3300 0 
+
+703125 143750 9.36345e-13 -3.22076e-13 1.93975e+08 1097.62 0 1613 1.85625e+08 3300 0 
+750000 143750 8.2332e-13 -1.5491e-13 1.93971e+08 1090.76 0 1613 1.85625e+08 3300 0 
+
+
+656250 143750 1.13471e-12 -4.72788e-13 1.93981e+08 1106.46 0 1613 1.85625e+08 3300 0 
+703125 143750 9.36345e-13 -3.22076e-13 1.93975e+08 1097.62 0 1613 1.85625e+08 3300 0 
+
+656250 150000 1.33008e-12 -4.37996e-13 1.73131e+08 1022.06 0 1613 1.65e+08 3300 0 
+703125 150000 1.09437e-12 -2.98878e-13 1.73121e+08 1012.87 0 1613 1.65e+08 3300 0 
+
+
+703125 143750 9.36345e-13 -3.22076e-13 1.93975e+08 1097.62 0 1613 1.85625e+08 3300 0 
+750000 143750 8.2332e-13 -1.5491e-13 1.93971e+08 1090.76 0 1613 1.85625e+08 3300 0 
+
+703125 150000 1.09437e-12 -2.98878e-13 1.73121e+08 1012.87 0 1613 1.65e+08 3300 0 
+750000 150000 9.57058e-13 -1.44989e-13 1.73113e+08 1005.73 0 1613 1.65e+08 3300 0 
+
+
+0 150000 0 -1.25643e-12 1.73507e+08 1450.71 0 1613 1.65e+08 3300 0 
+46875 150000 1.21497e-12 1.20875e-12 1.73426e+08 1552.7 0 1613 1.65e+08 3300 0 
+
+0 156250 0 -1.38241e-12 1.52834e+08 1385.38 0 1613 1.44375e+08 3300 0 
+46875 156250 9.80102e-13 1.02797e-12 1.52772e+08 1518.97 0 1613 1.44375e+08 3300 0 
+
+
+46875 150000 1.21497e-12 1.20875e-12 1.73426e+08 1552.7 0 1613 1.65e+08 3300 0 
+93750 150000 2.19018e-12 4.48366e-12 1.73298e+08 1599.37 0 1613 1.65e+08 3300 0 
+
+46875 156250 9.80102e-13 1.02797e-12 1.52772e+08 1518.97 0 1613 1.44375e+08 3300 0 
+93750 156250 2.37807e-12 4.36044e-12 1.52638e+08 1598.6 0 1613 1.44375e+08 3300 0 
+
+
+0 156250 0 -1.38241e-12 1.52834e+08 1385.38 0 1613 1.44375e+08 3300 0 
+46875 156250 9.80102e-13 1.02797e-12 1.52772e+08 1518.97 0 1613 1.44375e+08 3300 0 
+
+0 162500 0 -1.43296e-12 1.32132e+08 1298.9 0 1613 1.2375e+08 3300 0 
+46875 162500 6.46432e-13 8.36155e-13 1.32104e+08 1464.54 0 1613 1.2375e+08 3300 0 
+
+
+46875 156250 9.80102e-13 1.02797e-12 1.52772e+08 1518.97 0 1613 1.44375e+08 3300 0 
+93750 156250 2.37807e-12 4.36044e-12 1.52638e+08 1598.6 0 1613 1.44375e+08 3300 0 
+
+46875 162500 6.46432e-13 8.36155e-13 1.32104e+08 1464.54 0 1613 1.2375e+08 3300 0 
+93750 162500 2.52286e-12 4.15218e-12 1.31978e+08 1596.85 0 1613 1.2375e+08 3300 0 
+
+
+93750 150000 2.19018e-12 4.48366e-12 1.73298e+08 1599.37 0 1613 1.65e+08 3300 0 
+140625 150000 3.31256e-12 3.65104e-12 1.73354e+08 1573.59 0 1613 1.65e+08 3300 0 
+
+93750 156250 2.37807e-12 4.36044e-12 1.52638e+08 1598.6 0 1613 1.44375e+08 3300 0 
+140625 156250 4.13082e-12 3.37908e-12 1.52696e+08 1551.45 0 1613 1.44375e+08 3300 0 
+
+
+140625 150000 3.31256e-12 3.65104e-12 1.73354e+08 1573.59 0 1613 1.65e+08 3300 0 
+187500 150000 4.96878e-12 1.41268e-12 1.73424e+08 1479.05 0 1613 1.65e+08 3300 0 
+
+140625 156250 4.13082e-12 3.37908e-12 1.52696e+08 1551.45 0 1613 1.44375e+08 3300 0 
+187500 156250 6.10905e-12 1.22472e-12 1.52735e+08 1419.93 0 1613 1.44375e+08 3300 0 
+
+
+93750 156250 2.37807e-12 4.36044e-12 1.52638e+08 1598.6 0 1613 1.44375e+08 3300 0 
+140625 156250 4.13082e-12 3.37908e-12 1.52696e+08 1551.45 0 1613 1.44375e+08 3300 0 
+
+93750 162500 2.52286e-12 4.15218e-12 1.31978e+08 1596.85 0 1613 1.2375e+08 3300 0 
+140625 162500 5.0002e-12 3.02944e-12 1.32031e+08 1512.36 0 1613 1.2375e+08 3300 0 
+
+
+140625 156250 4.13082e-12 3.37908e-12 1.52696e+08 1551.45 0 1613 1.44375e+08 3300 0 
+187500 156250 6.10905e-12 1.22472e-12 1.52735e+08 1419.93 0 1613 1.44375e+08 3300 0 
+
+140625 162500 5.0002e-12 3.02944e-12 1.32031e+08 1512.36 0 1613 1.2375e+08 3300 0 
+187500 162500 7.25282e-12 1.03275e-12 1.32019e+08 1338.7 0 1613 1.2375e+08 3300 0 
+
+
+0 162500 0 -1.43296e-12 1.32132e+08 1298.9 0 1613 1.2375e+08 3300 0 
+46875 162500 6.46432e-13 8.36155e-13 1.32104e+08 1464.54 0 1613 1.2375e+08 3300 0 
+
+0 168750 0 -1.40371e-12 1.11381e+08 1188.24 0 1613 1.03125e+08 3300 0 
+46875 168750 2.22618e-13 6.37997e-13 1.11405e+08 1380.13 0 1613 1.03125e+08 3300 0 
+
+
+46875 162500 6.46432e-13 8.36155e-13 1.32104e+08 1464.54 0 1613 1.2375e+08 3300 0 
+93750 162500 2.52286e-12 4.15218e-12 1.31978e+08 1596.85 0 1613 1.2375e+08 3300 0 
+
+46875 168750 2.22618e-13 6.37997e-13 1.11405e+08 1380.13 0 1613 1.03125e+08 3300 0 
+93750 168750 2.61875e-12 3.8353e-12 1.11307e+08 1592.67 0 1613 1.03125e+08 3300 0 
+
+
+0 168750 0 -1.40371e-12 1.11381e+08 1188.24 0 1613 1.03125e+08 3300 0 
+46875 168750 2.22618e-13 6.37997e-13 1.11405e+08 1380.13 0 1613 1.03125e+08 3300 0 
+
+0 175000 0 -1.26429e-12 9.05992e+07 1051.72 0 1613 8.25e+07 3300 0 
+46875 175000 -2.64531e-13 4.76126e-13 9.06883e+07 1255.52 0 1613 8.25e+07 3300 0 
+
+
+46875 168750 2.22618e-13 6.37997e-13 1.11405e+08 1380.13 0 1613 1.03125e+08 3300 0 
+93750 168750 2.61875e-12 3.8353e-12 1.11307e+08 1592.67 0 1613 1.03125e+08 3300 0 
+
+46875 175000 -2.64531e-13 4.76126e-13 9.06883e+07 1255.52 0 1613 8.25e+07 3300 0 
+93750 175000 2.66264e-12 3.41909e-12 9.06548e+07 1582.24 0 1613 8.25e+07 3300 0 
+
+
+93750 162500 2.52286e-12 4.15218e-12 1.31978e+08 1596.85 0 1613 1.2375e+08 3300 0 
+140625 162500 5.0002e-12 3.02944e-12 1.32031e+08 1512.36 0 1613 1.2375e+08 3300 0 
+
+93750 168750 2.61875e-12 3.8353e-12 1.11307e+08 1592.67 0 1613 1.03125e+08 3300 0 
+140625 168750 5.90609e-12 2.5979e-12 1.11342e+08 1445.65 0 1613 1.03125e+08 3300 0 
+
+
+140625 162500 5.0002e-12 3.02944e-12 1.32031e+08 1512.36 0 1613 1.2375e+08 3300 0 
+187500 162500 7.25282e-12 1.03275e-12 1.32019e+08 1338.7 0 1613 1.2375e+08 3300 0 
+
+140625 168750 5.90609e-12 2.5979e-12 1.11342e+08 1445.65 0 1613 1.03125e+08 3300 0 
+187500 168750 8.3607e-12 8.3783e-13 1.11257e+08 1231.11 0 1613 1.03125e+08 3300 0 
+
+
+93750 168750 2.61875e-12 3.8353e-12 1.11307e+08 1592.67 0 1613 1.03125e+08 3300 0 
+140625 168750 5.90609e-12 2.5979e-12 1.11342e+08 1445.65 0 1613 1.03125e+08 3300 0 
+
+93750 175000 2.66264e-12 3.41909e-12 9.06548e+07 1582.24 0 1613 8.25e+07 3300 0 
+140625 175000 6.81751e-12 2.12357e-12 9.06464e+07 1336.95 0 1613 8.25e+07 3300 0 
+
+
+140625 168750 5.90609e-12 2.5979e-12 1.11342e+08 1445.65 0 1613 1.03125e+08 3300 0 
+187500 168750 8.3607e-12 8.3783e-13 1.11257e+08 1231.11 0 1613 1.03125e+08 3300 0 
+
+140625 175000 6.81751e-12 2.12357e-12 9.06464e+07 1336.95 0 1613 8.25e+07 3300 0 
+187500 175000 9.38385e-12 6.71952e-13 9.0466e+07 1094.24 0 1613 8.25e+07 3300 0 
+
+
+187500 150000 4.96878e-12 1.41268e-12 1.73424e+08 1479.05 0 1613 1.65e+08 3300 0 
+234375 150000 5.86445e-12 -3.99705e-14 1.73408e+08 1376.6 0 1613 1.65e+08 3300 0 
+
+187500 156250 6.10905e-12 1.22472e-12 1.52735e+08 1419.93 0 1613 1.44375e+08 3300 0 
+234375 156250 6.99631e-12 -8.66995e-14 1.52673e+08 1300.32 0 1613 1.44375e+08 3300 0 
+
+
+234375 150000 5.86445e-12 -3.99705e-14 1.73408e+08 1376.6 0 1613 1.65e+08 3300 0 
+281250 150000 5.89193e-12 -8.48458e-13 1.73366e+08 1290.53 0 1613 1.65e+08 3300 0 
+
+234375 156250 6.99631e-12 -8.66995e-14 1.52673e+08 1300.32 0 1613 1.44375e+08 3300 0 
+281250 156250 6.90488e-12 -8.01345e-13 1.52595e+08 1207.66 0 1613 1.44375e+08 3300 0 
+
+
+187500 156250 6.10905e-12 1.22472e-12 1.52735e+08 1419.93 0 1613 1.44375e+08 3300 0 
+234375 156250 6.99631e-12 -8.66995e-14 1.52673e+08 1300.32 0 1613 1.44375e+08 3300 0 
+
+187500 162500 7.25282e-12 1.03275e-12 1.32019e+08 1338.7 0 1613 1.2375e+08 3300 0 
+234375 162500 8.08528e-12 -1.1968e-13 1.31905e+08 1206.26 0 1613 1.2375e+08 3300 0 
+
+
+234375 156250 6.99631e-12 -8.66995e-14 1.52673e+08 1300.32 0 1613 1.44375e+08 3300 0 
+281250 156250 6.90488e-12 -8.01345e-13 1.52595e+08 1207.66 0 1613 1.44375e+08 3300 0 
+
+234375 162500 8.08528e-12 -1.1968e-13 1.31905e+08 1206.26 0 1613 1.2375e+08 3300 0 
+281250 162500 7.86108e-12 -7.33515e-13 1.31789e+08 1111.19 0 1613 1.2375e+08 3300 0 
+
+
+281250 150000 5.89193e-12 -8.48458e-13 1.73366e+08 1290.53 0 1613 1.65e+08 3300 0 
+328125 150000 5.415e-12 -1.20766e-12 1.73317e+08 1222.07 0 1613 1.65e+08 3300 0 
+
+281250 156250 6.90488e-12 -8.01345e-13 1.52595e+08 1207.66 0 1613 1.44375e+08 3300 0 
+328125 156250 6.27993e-12 -1.11353e-12 1.52517e+08 1136.79 0 1613 1.44375e+08 3300 0 
+
+
+328125 150000 5.415e-12 -1.20766e-12 1.73317e+08 1222.07 0 1613 1.65e+08 3300 0 
+375000 150000 4.70772e-12 -1.28951e-12 1.73272e+08 1168.42 0 1613 1.65e+08 3300 0 
+
+328125 156250 6.27993e-12 -1.11353e-12 1.52517e+08 1136.79 0 1613 1.44375e+08 3300 0 
+375000 156250 5.42544e-12 -1.17954e-12 1.5245e+08 1082.32 0 1613 1.44375e+08 3300 0 
+
+
+281250 156250 6.90488e-12 -8.01345e-13 1.52595e+08 1207.66 0 1613 1.44375e+08 3300 0 
+328125 156250 6.27993e-12 -1.11353e-12 1.52517e+08 1136.79 0 1613 1.44375e+08 3300 0 
+
+281250 162500 7.86108e-12 -7.33515e-13 1.31789e+08 1111.19 0 1613 1.2375e+08 3300 0 
+328125 162500 7.08792e-12 -9.98232e-13 1.31681e+08 1041.08 0 1613 1.2375e+08 3300 0 
+
+
+328125 156250 6.27993e-12 -1.11353e-12 1.52517e+08 1136.79 0 1613 1.44375e+08 3300 0 
+375000 156250 5.42544e-12 -1.17954e-12 1.5245e+08 1082.32 0 1613 1.44375e+08 3300 0 
+
+328125 162500 7.08792e-12 -9.98232e-13 1.31681e+08 1041.08 0 1613 1.2375e+08 3300 0 
+375000 162500 6.09218e-12 -1.0497e-12 1.31591e+08 988.183 0 1613 1.2375e+08 3300 0 
+
+
+187500 162500 7.25282e-12 1.03275e-12 1.32019e+08 1338.7 0 1613 1.2375e+08 3300 0 
+234375 162500 8.08528e-12 -1.1968e-13 1.31905e+08 1206.26 0 1613 1.2375e+08 3300 0 
+
+187500 168750 8.3607e-12 8.3783e-13 1.11257e+08 1231.11 0 1613 1.03125e+08 3300 0 
+234375 168750 9.09578e-12 -1.43402e-13 1.11088e+08 1093.36 0 1613 1.03125e+08 3300 0 
+
+
+234375 162500 8.08528e-12 -1.1968e-13 1.31905e+08 1206.26 0 1613 1.2375e+08 3300 0 
+281250 162500 7.86108e-12 -7.33515e-13 1.31789e+08 1111.19 0 1613 1.2375e+08 3300 0 
+
+234375 168750 9.09578e-12 -1.43402e-13 1.11088e+08 1093.36 0 1613 1.03125e+08 3300 0 
+281250 168750 8.7328e-12 -6.51907e-13 1.10933e+08 1001.05 0 1613 1.03125e+08 3300 0 
+
+
+187500 168750 8.3607e-12 8.3783e-13 1.11257e+08 1231.11 0 1613 1.03125e+08 3300 0 
+234375 168750 9.09578e-12 -1.43402e-13 1.11088e+08 1093.36 0 1613 1.03125e+08 3300 0 
+
+187500 175000 9.38385e-12 6.71952e-13 9.0466e+07 1094.24 0 1613 8.25e+07 3300 0 
+234375 175000 9.99039e-12 -1.29527e-13 9.02441e+07 961.621 0 1613 8.25e+07 3300 0 
+
+
+234375 168750 9.09578e-12 -1.43402e-13 1.11088e+08 1093.36 0 1613 1.03125e+08 3300 0 
+281250 168750 8.7328e-12 -6.51907e-13 1.10933e+08 1001.05 0 1613 1.03125e+08 3300 0 
+
+234375 175000 9.99039e-12 -1.29527e-13 9.02441e+07 961.621 0 1613 8.25e+07 3300 0 
+281250 175000 9.49251e-12 -5.30969e-13 9.00522e+07 877.885 0 1613 8.25e+07 3300 0 
+
+
+281250 162500 7.86108e-12 -7.33515e-13 1.31789e+08 1111.19 0 1613 1.2375e+08 3300 0 
+328125 162500 7.08792e-12 -9.98232e-13 1.31681e+08 1041.08 0 1613 1.2375e+08 3300 0 
+
+281250 168750 8.7328e-12 -6.51907e-13 1.10933e+08 1001.05 0 1613 1.03125e+08 3300 0 
+328125 168750 7.81733e-12 -8.69778e-13 1.10797e+08 935.183 0 1613 1.03125e+08 3300 0 
+
+
+328125 162500 7.08792e-12 -9.98232e-13 1.31681e+08 1041.08 0 1613 1.2375e+08 3300 0 
+375000 162500 6.09218e-12 -1.0497e-12 1.31591e+08 988.183 0 1613 1.2375e+08 3300 0 
+
+328125 168750 7.81733e-12 -8.69778e-13 1.10797e+08 935.183 0 1613 1.03125e+08 3300 0 
+375000 168750 6.69105e-12 -9.08373e-13 1.10685e+08 886.298 0 1613 1.03125e+08 3300 0 
+
+
+281250 168750 8.7328e-12 -6.51907e-13 1.10933e+08 1001.05 0 1613 1.03125e+08 3300 0 
+328125 168750 7.81733e-12 -8.69778e-13 1.10797e+08 935.183 0 1613 1.03125e+08 3300 0 
+
+281250 175000 9.49251e-12 -5.30969e-13 9.00522e+07 877.885 0 1613 8.25e+07 3300 0 
+328125 175000 8.4474e-12 -7.03273e-13 8.98902e+07 819.786 0 1613 8.25e+07 3300 0 
+
+
+328125 168750 7.81733e-12 -8.69778e-13 1.10797e+08 935.183 0 1613 1.03125e+08 3300 0 
+375000 168750 6.69105e-12 -9.08373e-13 1.10685e+08 886.298 0 1613 1.03125e+08 3300 0 
+
+328125 175000 8.4474e-12 -7.03273e-13 8.98902e+07 819.786 0 1613 8.25e+07 3300 0 
+375000 175000 7.20611e-12 -7.30844e-13 8.97589e+07 777.282 0 1613 8.25e+07 3300 0 
+
+
+0 175000 0 -1.26429e-12 9.05992e+07 1051.72 0 1613 8.25e+07 3300 0 
+46875 175000 -2.64531e-13 4.76126e-13 9.06883e+07 1255.52 0 1613 8.25e+07 3300 0 
+
+0 181250 0 -1.11717e-12 6.96646e+07 889.721 0 1613 6.1875e+07 3300 0 
+46875 181250 -7.65238e-13 2.67362e-13 6.98217e+07 1082.18 0 1613 6.1875e+07 3300 0 
+
+
+46875 175000 -2.64531e-13 4.76126e-13 9.06883e+07 1255.52 0 1613 8.25e+07 3300 0 
+93750 175000 2.66264e-12 3.41909e-12 9.06548e+07 1582.24 0 1613 8.25e+07 3300 0 
+
+46875 181250 -7.65238e-13 2.67362e-13 6.98217e+07 1082.18 0 1613 6.1875e+07 3300 0 
+93750 181250 2.65744e-12 2.78552e-12 6.99039e+07 1554.29 0 1613 6.1875e+07 3300 0 
+
+
+0 181250 0 -1.11717e-12 6.96646e+07 889.721 0 1613 6.1875e+07 3300 0 
+46875 181250 -7.65238e-13 2.67362e-13 6.98217e+07 1082.18 0 1613 6.1875e+07 3300 0 
+
+0 187500 0 -5.99963e-13 4.89787e+07 705.183 0 1613 4.125e+07 3300 0 
+46875 187500 -1.20765e-12 3.85892e-13 4.91869e+07 857.385 0 1613 4.125e+07 3300 0 
+
+
+46875 181250 -7.65238e-13 2.67362e-13 6.98217e+07 1082.18 0 1613 6.1875e+07 3300 0 
+93750 181250 2.65744e-12 2.78552e-12 6.99039e+07 1554.29 0 1613 6.1875e+07 3300 0 
+
+46875 187500 -1.20765e-12 3.85892e-13 4.91869e+07 857.385 0 1613 4.125e+07 3300 0 
+93750 187500 2.61701e-12 2.276e-12 4.94448e+07 1471.32 0 1613 4.125e+07 3300 0 
+
+
+93750 175000 2.66264e-12 3.41909e-12 9.06548e+07 1582.24 0 1613 8.25e+07 3300 0 
+140625 175000 6.81751e-12 2.12357e-12 9.06464e+07 1336.95 0 1613 8.25e+07 3300 0 
+
+93750 181250 2.65744e-12 2.78552e-12 6.99039e+07 1554.29 0 1613 6.1875e+07 3300 0 
+140625 181250 7.67966e-12 1.5321e-12 6.9816e+07 1170.49 0 1613 6.1875e+07 3300 0 
+
+
+140625 175000 6.81751e-12 2.12357e-12 9.06464e+07 1336.95 0 1613 8.25e+07 3300 0 
+187500 175000 9.38385e-12 6.71952e-13 9.0466e+07 1094.24 0 1613 8.25e+07 3300 0 
+
+140625 181250 7.67966e-12 1.5321e-12 6.9816e+07 1170.49 0 1613 6.1875e+07 3300 0 
+187500 181250 1.02667e-11 4.37161e-13 6.95232e+07 927.534 0 1613 6.1875e+07 3300 0 
+
+
+93750 181250 2.65744e-12 2.78552e-12 6.99039e+07 1554.29 0 1613 6.1875e+07 3300 0 
+140625 181250 7.67966e-12 1.5321e-12 6.9816e+07 1170.49 0 1613 6.1875e+07 3300 0 
+
+93750 187500 2.61701e-12 2.276e-12 4.94448e+07 1471.32 0 1613 4.125e+07 3300 0 
+140625 187500 8.40953e-12 1.22517e-12 4.92308e+07 935.298 0 1613 4.125e+07 3300 0 
+
+
+140625 181250 7.67966e-12 1.5321e-12 6.9816e+07 1170.49 0 1613 6.1875e+07 3300 0 
+187500 181250 1.02667e-11 4.37161e-13 6.95232e+07 927.534 0 1613 6.1875e+07 3300 0 
+
+140625 187500 8.40953e-12 1.22517e-12 4.92308e+07 935.298 0 1613 4.125e+07 3300 0 
+187500 187500 1.0952e-11 4.99715e-13 4.88264e+07 733.708 0 1613 4.125e+07 3300 0 
+
+
+0 187500 0 -5.99963e-13 4.89787e+07 705.183 0 1613 4.125e+07 3300 0 
+46875 187500 -1.20765e-12 3.85892e-13 4.91869e+07 857.385 0 1613 4.125e+07 3300 0 
+
+0 193750 0 -5.25709e-13 2.52897e+07 503.715 1 1613 2.0625e+07 3300 0 
+46875 193750 -1.51165e-12 2.98586e-15 2.55104e+07 588.259 1 1613 2.0625e+07 3300 0 
+
+
+46875 187500 -1.20765e-12 3.85892e-13 4.91869e+07 857.385 0 1613 4.125e+07 3300 0 
+93750 187500 2.61701e-12 2.276e-12 4.94448e+07 1471.32 0 1613 4.125e+07 3300 0 
+
+46875 193750 -1.51165e-12 2.98586e-15 2.55104e+07 588.259 1 1613 2.0625e+07 3300 0 
+93750 193750 2.5692e-12 1.04668e-12 2.59887e+07 1187.7 1 1613 2.0625e+07 3300 0 
+
+
+0 193750 0 -5.25709e-13 2.52897e+07 503.715 1 1613 2.0625e+07 3300 0 
+46875 193750 -1.51165e-12 2.98586e-15 2.55104e+07 588.259 1 1613 2.0625e+07 3300 0 
+
+0 200000 0 0 846972 293.15 1 1613 0 3300 0 
+46875 200000 -1.61873e-12 0 1.05662e+06 293.15 1 1613 0 3300 0 
+
+
+46875 193750 -1.51165e-12 2.98586e-15 2.55104e+07 588.259 1 1613 2.0625e+07 3300 0 
+93750 193750 2.5692e-12 1.04668e-12 2.59887e+07 1187.7 1 1613 2.0625e+07 3300 0 
+
+46875 200000 -1.61873e-12 0 1.05662e+06 293.15 1 1613 0 3300 0 
+93750 200000 2.54781e-12 0 1.66788e+06 293.15 1 1613 0 3300 0 
+
+
+93750 187500 2.61701e-12 2.276e-12 4.94448e+07 1471.32 0 1613 4.125e+07 3300 0 
+140625 187500 8.40953e-12 1.22517e-12 4.92308e+07 935.298 0 1613 4.125e+07 3300 0 
+
+93750 193750 2.5692e-12 1.04668e-12 2.59887e+07 1187.7 1 1613 2.0625e+07 3300 0 
+140625 193750 8.90515e-12 4.13664e-13 2.56046e+07 634.711 1 1613 2.0625e+07 3300 0 
+
+
+140625 187500 8.40953e-12 1.22517e-12 4.92308e+07 935.298 0 1613 4.125e+07 3300 0 
+187500 187500 1.0952e-11 4.99715e-13 4.88264e+07 733.708 0 1613 4.125e+07 3300 0 
+
+140625 193750 8.90515e-12 4.13664e-13 2.56046e+07 634.711 1 1613 2.0625e+07 3300 0 
+187500 193750 1.13877e-11 4.98218e-14 2.51231e+07 519.088 1 1613 2.0625e+07 3300 0 
+
+
+93750 193750 2.5692e-12 1.04668e-12 2.59887e+07 1187.7 1 1613 2.0625e+07 3300 0 
+140625 193750 8.90515e-12 4.13664e-13 2.56046e+07 634.711 1 1613 2.0625e+07 3300 0 
+
+93750 200000 2.54781e-12 0 1.66788e+06 293.15 1 1613 0 3300 0 
+140625 200000 9.08059e-12 0 1.17388e+06 293.15 1 1613 0 3300 0 
+
+
+140625 193750 8.90515e-12 4.13664e-13 2.56046e+07 634.711 1 1613 2.0625e+07 3300 0 
+187500 193750 1.13877e-11 4.98218e-14 2.51231e+07 519.088 1 1613 2.0625e+07 3300 0 
+
+140625 200000 9.08059e-12 0 1.17388e+06 293.15 1 1613 0 3300 0 
+187500 200000 1.15371e-11 0 671658 293.15 1 1613 0 3300 0 
+
+
+187500 175000 9.38385e-12 6.71952e-13 9.0466e+07 1094.24 0 1613 8.25e+07 3300 0 
+234375 175000 9.99039e-12 -1.29527e-13 9.02441e+07 961.621 0 1613 8.25e+07 3300 0 
+
+187500 181250 1.02667e-11 4.37161e-13 6.95232e+07 927.534 0 1613 6.1875e+07 3300 0 
+234375 181250 1.07325e-11 -1.76174e-13 6.92558e+07 812.363 0 1613 6.1875e+07 3300 0 
+
+
+234375 175000 9.99039e-12 -1.29527e-13 9.02441e+07 961.621 0 1613 8.25e+07 3300 0 
+281250 175000 9.49251e-12 -5.30969e-13 9.00522e+07 877.885 0 1613 8.25e+07 3300 0 
+
+234375 181250 1.07325e-11 -1.76174e-13 6.92558e+07 812.363 0 1613 6.1875e+07 3300 0 
+281250 181250 1.01145e-11 -4.71843e-13 6.90307e+07 743.077 0 1613 6.1875e+07 3300 0 
+
+
+187500 181250 1.02667e-11 4.37161e-13 6.95232e+07 927.534 0 1613 6.1875e+07 3300 0 
+234375 181250 1.07325e-11 -1.76174e-13 6.92558e+07 812.363 0 1613 6.1875e+07 3300 0 
+
+187500 187500 1.0952e-11 4.99715e-13 4.88264e+07 733.708 0 1613 4.125e+07 3300 0 
+234375 187500 1.12893e-11 8.51353e-14 4.85254e+07 648.324 0 1613 4.125e+07 3300 0 
+
+
+234375 181250 1.07325e-11 -1.76174e-13 6.92558e+07 812.363 0 1613 6.1875e+07 3300 0 
+281250 181250 1.01145e-11 -4.71843e-13 6.90307e+07 743.077 0 1613 6.1875e+07 3300 0 
+
+234375 187500 1.12893e-11 8.51353e-14 4.85254e+07 648.324 0 1613 4.125e+07 3300 0 
+281250 187500 1.05764e-11 -1.08648e-13 4.82735e+07 598.76 0 1613 4.125e+07 3300 0 
+
+
+281250 175000 9.49251e-12 -5.30969e-13 9.00522e+07 877.885 0 1613 8.25e+07 3300 0 
+328125 175000 8.4474e-12 -7.03273e-13 8.98902e+07 819.786 0 1613 8.25e+07 3300 0 
+
+281250 181250 1.01145e-11 -4.71843e-13 6.90307e+07 743.077 0 1613 6.1875e+07 3300 0 
+328125 181250 8.9593e-12 -5.99929e-13 6.8847e+07 696.078 0 1613 6.1875e+07 3300 0 
+
+
+328125 175000 8.4474e-12 -7.03273e-13 8.98902e+07 819.786 0 1613 8.25e+07 3300 0 
+375000 175000 7.20611e-12 -7.30844e-13 8.97589e+07 777.282 0 1613 8.25e+07 3300 0 
+
+328125 181250 8.9593e-12 -5.99929e-13 6.8847e+07 696.078 0 1613 6.1875e+07 3300 0 
+375000 181250 7.62307e-12 -6.18394e-13 6.86993e+07 662.091 0 1613 6.1875e+07 3300 0 
+
+
+281250 181250 1.01145e-11 -4.71843e-13 6.90307e+07 743.077 0 1613 6.1875e+07 3300 0 
+328125 181250 8.9593e-12 -5.99929e-13 6.8847e+07 696.078 0 1613 6.1875e+07 3300 0 
+
+281250 187500 1.05764e-11 -1.08648e-13 4.82735e+07 598.76 0 1613 4.125e+07 3300 0 
+328125 187500 9.33713e-12 -1.93452e-13 4.80734e+07 565.69 0 1613 4.125e+07 3300 0 
+
+
+328125 181250 8.9593e-12 -5.99929e-13 6.8847e+07 696.078 0 1613 6.1875e+07 3300 0 
+375000 181250 7.62307e-12 -6.18394e-13 6.86993e+07 662.091 0 1613 6.1875e+07 3300 0 
+
+328125 187500 9.33713e-12 -1.93452e-13 4.80734e+07 565.69 0 1613 4.125e+07 3300 0 
+375000 187500 7.92998e-12 -2.04612e-13 4.79134e+07 541.98 0 1613 4.125e+07 3300 0 
+
+
+187500 187500 1.0952e-11 4.99715e-13 4.88264e+07 733.708 0 1613 4.125e+07 3300 0 
+234375 187500 1.12893e-11 8.51353e-14 4.85254e+07 648.324 0 1613 4.125e+07 3300 0 
+
+187500 193750 1.13877e-11 4.98218e-14 2.51231e+07 519.088 1 1613 2.0625e+07 3300 0 
+234375 193750 1.16347e-11 -1.57538e-13 2.48001e+07 473.559 1 1613 2.0625e+07 3300 0 
+
+
+234375 187500 1.12893e-11 8.51353e-14 4.85254e+07 648.324 0 1613 4.125e+07 3300 0 
+281250 187500 1.05764e-11 -1.08648e-13 4.82735e+07 598.76 0 1613 4.125e+07 3300 0 
+
+234375 193750 1.16347e-11 -1.57538e-13 2.48001e+07 473.559 1 1613 2.0625e+07 3300 0 
+281250 193750 1.08609e-11 -2.53615e-13 2.45312e+07 447.703 1 1613 2.0625e+07 3300 0 
+
+
+187500 193750 1.13877e-11 4.98218e-14 2.51231e+07 519.088 1 1613 2.0625e+07 3300 0 
+234375 193750 1.16347e-11 -1.57538e-13 2.48001e+07 473.559 1 1613 2.0625e+07 3300 0 
+
+187500 200000 1.15371e-11 0 671658 293.15 1 1613 0 3300 0 
+234375 200000 1.17519e-11 0 339290 293.15 1 1613 0 3300 0 
+
+
+234375 193750 1.16347e-11 -1.57538e-13 2.48001e+07 473.559 1 1613 2.0625e+07 3300 0 
+281250 193750 1.08609e-11 -2.53615e-13 2.45312e+07 447.703 1 1613 2.0625e+07 3300 0 
+
+234375 200000 1.17519e-11 0 339290 293.15 1 1613 0 3300 0 
+281250 200000 1.09569e-11 0 64987.8 293.15 1 1613 0 3300 0 
+
+
+281250 187500 1.05764e-11 -1.08648e-13 4.82735e+07 598.76 0 1613 4.125e+07 3300 0 
+328125 187500 9.33713e-12 -1.93452e-13 4.80734e+07 565.69 0 1613 4.125e+07 3300 0 
+
+281250 193750 1.08609e-11 -2.53615e-13 2.45312e+07 447.703 1 1613 2.0625e+07 3300 0 
+328125 193750 9.56886e-12 -2.95728e-13 2.4321e+07 430.625 1 1613 2.0625e+07 3300 0 
+
+
+328125 187500 9.33713e-12 -1.93452e-13 4.80734e+07 565.69 0 1613 4.125e+07 3300 0 
+375000 187500 7.92998e-12 -2.04612e-13 4.79134e+07 541.98 0 1613 4.125e+07 3300 0 
+
+328125 193750 9.56886e-12 -2.95728e-13 2.4321e+07 430.625 1 1613 2.0625e+07 3300 0 
+375000 193750 8.11786e-12 -3.00969e-13 2.41532e+07 418.443 1 1613 2.0625e+07 3300 0 
+
+
+281250 193750 1.08609e-11 -2.53615e-13 2.45312e+07 447.703 1 1613 2.0625e+07 3300 0 
+328125 193750 9.56886e-12 -2.95728e-13 2.4321e+07 430.625 1 1613 2.0625e+07 3300 0 
+
+281250 200000 1.09569e-11 0 64987.8 293.15 1 1613 0 3300 0 
+328125 200000 9.64696e-12 0 -148865 293.15 1 1613 0 3300 0 
+
+
+328125 193750 9.56886e-12 -2.95728e-13 2.4321e+07 430.625 1 1613 2.0625e+07 3300 0 
+375000 193750 8.11786e-12 -3.00969e-13 2.41532e+07 418.443 1 1613 2.0625e+07 3300 0 
+
+328125 200000 9.64696e-12 0 -148865 293.15 1 1613 0 3300 0 
+375000 200000 8.18112e-12 0 -319151 293.15 1 1613 0 3300 0 
+
+
+375000 150000 4.70772e-12 -1.28951e-12 1.73272e+08 1168.42 0 1613 1.65e+08 3300 0 
+421875 150000 3.94871e-12 -1.21639e-12 1.73234e+08 1126.6 0 1613 1.65e+08 3300 0 
+
+375000 156250 5.42544e-12 -1.17954e-12 1.5245e+08 1082.32 0 1613 1.44375e+08 3300 0 
+421875 156250 4.5328e-12 -1.10856e-12 1.52393e+08 1040.26 0 1613 1.44375e+08 3300 0 
+
+
+421875 150000 3.94871e-12 -1.21639e-12 1.73234e+08 1126.6 0 1613 1.65e+08 3300 0 
+468750 150000 3.23375e-12 -1.0707e-12 1.73203e+08 1094.07 0 1613 1.65e+08 3300 0 
+
+421875 156250 4.5328e-12 -1.10856e-12 1.52393e+08 1040.26 0 1613 1.44375e+08 3300 0 
+468750 156250 3.70264e-12 -9.73897e-13 1.52348e+08 1007.71 0 1613 1.44375e+08 3300 0 
+
+
+375000 156250 5.42544e-12 -1.17954e-12 1.5245e+08 1082.32 0 1613 1.44375e+08 3300 0 
+421875 156250 4.5328e-12 -1.10856e-12 1.52393e+08 1040.26 0 1613 1.44375e+08 3300 0 
+
+375000 162500 6.09218e-12 -1.0497e-12 1.31591e+08 988.183 0 1613 1.2375e+08 3300 0 
+421875 162500 5.07363e-12 -9.83166e-13 1.31517e+08 947.718 0 1613 1.2375e+08 3300 0 
+
+
+421875 156250 4.5328e-12 -1.10856e-12 1.52393e+08 1040.26 0 1613 1.44375e+08 3300 0 
+468750 156250 3.70264e-12 -9.73897e-13 1.52348e+08 1007.71 0 1613 1.44375e+08 3300 0 
+
+421875 162500 5.07363e-12 -9.83166e-13 1.31517e+08 947.718 0 1613 1.2375e+08 3300 0 
+468750 162500 4.13596e-12 -8.62045e-13 1.31458e+08 916.542 0 1613 1.2375e+08 3300 0 
+
+
+468750 150000 3.23375e-12 -1.0707e-12 1.73203e+08 1094.07 0 1613 1.65e+08 3300 0 
+515625 150000 2.6069e-12 -9.01585e-13 1.73178e+08 1068.78 0 1613 1.65e+08 3300 0 
+
+468750 156250 3.70264e-12 -9.73897e-13 1.52348e+08 1007.71 0 1613 1.44375e+08 3300 0 
+515625 156250 2.9798e-12 -8.19194e-13 1.52312e+08 982.471 0 1613 1.44375e+08 3300 0 
+
+
+515625 150000 2.6069e-12 -9.01585e-13 1.73178e+08 1068.78 0 1613 1.65e+08 3300 0 
+562500 150000 2.08202e-12 -7.3477e-13 1.73158e+08 1049.15 0 1613 1.65e+08 3300 0 
+
+515625 156250 2.9798e-12 -8.19194e-13 1.52312e+08 982.471 0 1613 1.44375e+08 3300 0 
+562500 156250 2.3769e-12 -6.67265e-13 1.52284e+08 962.894 0 1613 1.44375e+08 3300 0 
+
+
+468750 156250 3.70264e-12 -9.73897e-13 1.52348e+08 1007.71 0 1613 1.44375e+08 3300 0 
+515625 156250 2.9798e-12 -8.19194e-13 1.52312e+08 982.471 0 1613 1.44375e+08 3300 0 
+
+468750 162500 4.13596e-12 -8.62045e-13 1.31458e+08 916.542 0 1613 1.2375e+08 3300 0 
+515625 162500 3.32397e-12 -7.2419e-13 1.31412e+08 892.431 0 1613 1.2375e+08 3300 0 
+
+
+515625 156250 2.9798e-12 -8.19194e-13 1.52312e+08 982.471 0 1613 1.44375e+08 3300 0 
+562500 156250 2.3769e-12 -6.67265e-13 1.52284e+08 962.894 0 1613 1.44375e+08 3300 0 
+
+515625 162500 3.32397e-12 -7.2419e-13 1.31412e+08 892.431 0 1613 1.2375e+08 3300 0 
+562500 162500 2.64882e-12 -5.89335e-13 1.31375e+08 873.749 0 1613 1.2375e+08 3300 0 
+
+
+375000 162500 6.09218e-12 -1.0497e-12 1.31591e+08 988.183 0 1613 1.2375e+08 3300 0 
+421875 162500 5.07363e-12 -9.83166e-13 1.31517e+08 947.718 0 1613 1.2375e+08 3300 0 
+
+375000 168750 6.69105e-12 -9.08373e-13 1.10685e+08 886.298 0 1613 1.03125e+08 3300 0 
+421875 168750 5.55798e-12 -8.48592e-13 1.10595e+08 849.222 0 1613 1.03125e+08 3300 0 
+
+
+421875 162500 5.07363e-12 -9.83166e-13 1.31517e+08 947.718 0 1613 1.2375e+08 3300 0 
+468750 162500 4.13596e-12 -8.62045e-13 1.31458e+08 916.542 0 1613 1.2375e+08 3300 0 
+
+421875 168750 5.55798e-12 -8.48592e-13 1.10595e+08 849.222 0 1613 1.03125e+08 3300 0 
+468750 168750 4.52335e-12 -7.43401e-13 1.10523e+08 820.78 0 1613 1.03125e+08 3300 0 
+
+
+375000 168750 6.69105e-12 -9.08373e-13 1.10685e+08 886.298 0 1613 1.03125e+08 3300 0 
+421875 168750 5.55798e-12 -8.48592e-13 1.10595e+08 849.222 0 1613 1.03125e+08 3300 0 
+
+375000 175000 7.20611e-12 -7.30844e-13 8.97589e+07 777.282 0 1613 8.25e+07 3300 0 
+421875 175000 5.97347e-12 -6.80015e-13 8.96539e+07 745.284 0 1613 8.25e+07 3300 0 
+
+
+421875 168750 5.55798e-12 -8.48592e-13 1.10595e+08 849.222 0 1613 1.03125e+08 3300 0 
+468750 168750 4.52335e-12 -7.43401e-13 1.10523e+08 820.78 0 1613 1.03125e+08 3300 0 
+
+421875 175000 5.97347e-12 -6.80015e-13 8.96539e+07 745.284 0 1613 8.25e+07 3300 0 
+468750 175000 4.85517e-12 -5.92932e-13 8.95709e+07 720.831 0 1613 8.25e+07 3300 0 
+
+
+468750 162500 4.13596e-12 -8.62045e-13 1.31458e+08 916.542 0 1613 1.2375e+08 3300 0 
+515625 162500 3.32397e-12 -7.2419e-13 1.31412e+08 892.431 0 1613 1.2375e+08 3300 0 
+
+468750 168750 4.52335e-12 -7.43401e-13 1.10523e+08 820.78 0 1613 1.03125e+08 3300 0 
+515625 168750 3.63133e-12 -6.24654e-13 1.10467e+08 798.832 0 1613 1.03125e+08 3300 0 
+
+
+515625 162500 3.32397e-12 -7.2419e-13 1.31412e+08 892.431 0 1613 1.2375e+08 3300 0 
+562500 162500 2.64882e-12 -5.89335e-13 1.31375e+08 873.749 0 1613 1.2375e+08 3300 0 
+
+515625 168750 3.63133e-12 -6.24654e-13 1.10467e+08 798.832 0 1613 1.03125e+08 3300 0 
+562500 168750 2.89148e-12 -5.08884e-13 1.10423e+08 781.846 0 1613 1.03125e+08 3300 0 
+
+
+468750 168750 4.52335e-12 -7.43401e-13 1.10523e+08 820.78 0 1613 1.03125e+08 3300 0 
+515625 168750 3.63133e-12 -6.24654e-13 1.10467e+08 798.832 0 1613 1.03125e+08 3300 0 
+
+468750 175000 4.85517e-12 -5.92932e-13 8.95709e+07 720.831 0 1613 8.25e+07 3300 0 
+515625 175000 3.89437e-12 -4.95311e-13 8.95057e+07 701.997 0 1613 8.25e+07 3300 0 
+
+
+515625 168750 3.63133e-12 -6.24654e-13 1.10467e+08 798.832 0 1613 1.03125e+08 3300 0 
+562500 168750 2.89148e-12 -5.08884e-13 1.10423e+08 781.846 0 1613 1.03125e+08 3300 0 
+
+515625 175000 3.89437e-12 -4.95311e-13 8.95057e+07 701.997 0 1613 8.25e+07 3300 0 
+562500 175000 3.09902e-12 -4.00403e-13 8.94547e+07 687.435 0 1613 8.25e+07 3300 0 
+
+
+562500 150000 2.08202e-12 -7.3477e-13 1.73158e+08 1049.15 0 1613 1.65e+08 3300 0 
+609375 150000 1.65826e-12 -5.80371e-13 1.73143e+08 1033.9 0 1613 1.65e+08 3300 0 
+
+562500 156250 2.3769e-12 -6.67265e-13 1.52284e+08 962.894 0 1613 1.44375e+08 3300 0 
+609375 156250 1.89107e-12 -5.27e-13 1.52262e+08 947.702 0 1613 1.44375e+08 3300 0 
+
+
+609375 150000 1.65826e-12 -5.80371e-13 1.73143e+08 1033.9 0 1613 1.65e+08 3300 0 
+656250 150000 1.33008e-12 -4.37996e-13 1.73131e+08 1022.06 0 1613 1.65e+08 3300 0 
+
+609375 156250 1.89107e-12 -5.27e-13 1.52262e+08 947.702 0 1613 1.44375e+08 3300 0 
+656250 156250 1.51479e-12 -3.97919e-13 1.52245e+08 935.91 0 1613 1.44375e+08 3300 0 
+
+
+562500 156250 2.3769e-12 -6.67265e-13 1.52284e+08 962.894 0 1613 1.44375e+08 3300 0 
+609375 156250 1.89107e-12 -5.27e-13 1.52262e+08 947.702 0 1613 1.44375e+08 3300 0 
+
+562500 162500 2.64882e-12 -5.89335e-13 1.31375e+08 873.749 0 1613 1.2375e+08 3300 0 
+609375 162500 2.10561e-12 -4.65115e-13 1.31347e+08 859.26 0 1613 1.2375e+08 3300 0 
+
+
+609375 156250 1.89107e-12 -5.27e-13 1.52262e+08 947.702 0 1613 1.44375e+08 3300 0 
+656250 156250 1.51479e-12 -3.97919e-13 1.52245e+08 935.91 0 1613 1.44375e+08 3300 0 
+
+609375 162500 2.10561e-12 -4.65115e-13 1.31347e+08 859.26 0 1613 1.2375e+08 3300 0 
+656250 162500 1.68486e-12 -3.51006e-13 1.31324e+08 848.017 0 1613 1.2375e+08 3300 0 
+
+
+656250 150000 1.33008e-12 -4.37996e-13 1.73131e+08 1022.06 0 1613 1.65e+08 3300 0 
+703125 150000 1.09437e-12 -2.98878e-13 1.73121e+08 1012.87 0 1613 1.65e+08 3300 0 
+
+656250 156250 1.51479e-12 -3.97919e-13 1.52245e+08 935.91 0 1613 1.44375e+08 3300 0 
+703125 156250 1.24352e-12 -2.72063e-13 1.52231e+08 926.756 0 1613 1.44375e+08 3300 0 
+
+
+703125 150000 1.09437e-12 -2.98878e-13 1.73121e+08 1012.87 0 1613 1.65e+08 3300 0 
+750000 150000 9.57058e-13 -1.44989e-13 1.73113e+08 1005.73 0 1613 1.65e+08 3300 0 
+
+703125 156250 1.24352e-12 -2.72063e-13 1.52231e+08 926.756 0 1613 1.44375e+08 3300 0 
+750000 156250 1.08287e-12 -1.33188e-13 1.5222e+08 919.65 0 1613 1.44375e+08 3300 0 
+
+
+656250 156250 1.51479e-12 -3.97919e-13 1.52245e+08 935.91 0 1613 1.44375e+08 3300 0 
+703125 156250 1.24352e-12 -2.72063e-13 1.52231e+08 926.756 0 1613 1.44375e+08 3300 0 
+
+656250 162500 1.68486e-12 -3.51006e-13 1.31324e+08 848.017 0 1613 1.2375e+08 3300 0 
+703125 162500 1.38066e-12 -2.39962e-13 1.31307e+08 839.291 0 1613 1.2375e+08 3300 0 
+
+
+703125 156250 1.24352e-12 -2.72063e-13 1.52231e+08 926.756 0 1613 1.44375e+08 3300 0 
+750000 156250 1.08287e-12 -1.33188e-13 1.5222e+08 919.65 0 1613 1.44375e+08 3300 0 
+
+703125 162500 1.38066e-12 -2.39962e-13 1.31307e+08 839.291 0 1613 1.2375e+08 3300 0 
+750000 162500 1.19823e-12 -1.177e-13 1.31293e+08 832.518 0 1613 1.2375e+08 3300 0 
+
+
+562500 162500 2.64882e-12 -5.89335e-13 1.31375e+08 873.749 0 1613 1.2375e+08 3300 0 
+609375 162500 2.10561e-12 -4.65115e-13 1.31347e+08 859.26 0 1613 1.2375e+08 3300 0 
+
+562500 168750 2.89148e-12 -5.08884e-13 1.10423e+08 781.846 0 1613 1.03125e+08 3300 0 
+609375 168750 2.29695e-12 -4.02455e-13 1.10388e+08 768.678 0 1613 1.03125e+08 3300 0 
+
+
+609375 162500 2.10561e-12 -4.65115e-13 1.31347e+08 859.26 0 1613 1.2375e+08 3300 0 
+656250 162500 1.68486e-12 -3.51006e-13 1.31324e+08 848.017 0 1613 1.2375e+08 3300 0 
+
+609375 168750 2.29695e-12 -4.02455e-13 1.10388e+08 768.678 0 1613 1.03125e+08 3300 0 
+656250 168750 1.83643e-12 -3.0484e-13 1.10361e+08 758.464 0 1613 1.03125e+08 3300 0 
+
+
+562500 168750 2.89148e-12 -5.08884e-13 1.10423e+08 781.846 0 1613 1.03125e+08 3300 0 
+609375 168750 2.29695e-12 -4.02455e-13 1.10388e+08 768.678 0 1613 1.03125e+08 3300 0 
+
+562500 175000 3.09902e-12 -4.00403e-13 8.94547e+07 687.435 0 1613 8.25e+07 3300 0 
+609375 175000 2.46051e-12 -3.13298e-13 8.94149e+07 676.152 0 1613 8.25e+07 3300 0 
+
+
+609375 168750 2.29695e-12 -4.02455e-13 1.10388e+08 768.678 0 1613 1.03125e+08 3300 0 
+656250 168750 1.83643e-12 -3.0484e-13 1.10361e+08 758.464 0 1613 1.03125e+08 3300 0 
+
+609375 175000 2.46051e-12 -3.13298e-13 8.94149e+07 676.152 0 1613 8.25e+07 3300 0 
+656250 175000 1.96592e-12 -2.3351e-13 8.93838e+07 667.402 0 1613 8.25e+07 3300 0 
+
+
+656250 162500 1.68486e-12 -3.51006e-13 1.31324e+08 848.017 0 1613 1.2375e+08 3300 0 
+703125 162500 1.38066e-12 -2.39962e-13 1.31307e+08 839.291 0 1613 1.2375e+08 3300 0 
+
+656250 168750 1.83643e-12 -3.0484e-13 1.10361e+08 758.464 0 1613 1.03125e+08 3300 0 
+703125 168750 1.50273e-12 -2.10006e-13 1.1034e+08 750.537 0 1613 1.03125e+08 3300 0 
+
+
+703125 162500 1.38066e-12 -2.39962e-13 1.31307e+08 839.291 0 1613 1.2375e+08 3300 0 
+750000 162500 1.19823e-12 -1.177e-13 1.31293e+08 832.518 0 1613 1.2375e+08 3300 0 
+
+703125 168750 1.50273e-12 -2.10006e-13 1.1034e+08 750.537 0 1613 1.03125e+08 3300 0 
+750000 168750 1.30067e-12 -1.05789e-13 1.10323e+08 744.385 0 1613 1.03125e+08 3300 0 
+
+
+656250 168750 1.83643e-12 -3.0484e-13 1.10361e+08 758.464 0 1613 1.03125e+08 3300 0 
+703125 168750 1.50273e-12 -2.10006e-13 1.1034e+08 750.537 0 1613 1.03125e+08 3300 0 
+
+656250 175000 1.96592e-12 -2.3351e-13 8.93838e+07 667.402 0 1613 8.25e+07 3300 0 
+703125 175000 1.60692e-12 -1.56104e-13 8.93596e+07 660.612 0 1613 8.25e+07 3300 0 
+
+
+703125 168750 1.50273e-12 -2.10006e-13 1.1034e+08 750.537 0 1613 1.03125e+08 3300 0 
+750000 168750 1.30067e-12 -1.05789e-13 1.10323e+08 744.385 0 1613 1.03125e+08 3300 0 
+
+703125 175000 1.60692e-12 -1.56104e-13 8.93596e+07 660.612 0 1613 8.25e+07 3300 0 
+750000 175000 1.38794e-12 -7.11685e-14 8.93404e+07 655.343 0 1613 8.25e+07 3300 0 
+
+
+375000 175000 7.20611e-12 -7.30844e-13 8.97589e+07 777.282 0 1613 8.25e+07 3300 0 
+421875 175000 5.97347e-12 -6.80015e-13 8.96539e+07 745.284 0 1613 8.25e+07 3300 0 
+
+375000 181250 7.62307e-12 -6.18394e-13 6.86993e+07 662.091 0 1613 6.1875e+07 3300 0 
+421875 181250 6.3091e-12 -5.78446e-13 6.85821e+07 636.66 0 1613 6.1875e+07 3300 0 
+
+
+421875 175000 5.97347e-12 -6.80015e-13 8.96539e+07 745.284 0 1613 8.25e+07 3300 0 
+468750 175000 4.85517e-12 -5.92932e-13 8.95709e+07 720.831 0 1613 8.25e+07 3300 0 
+
+421875 181250 6.3091e-12 -5.78446e-13 6.85821e+07 636.66 0 1613 6.1875e+07 3300 0 
+468750 181250 5.12289e-12 -5.11351e-13 6.84897e+07 617.284 0 1613 6.1875e+07 3300 0 
+
+
+375000 181250 7.62307e-12 -6.18394e-13 6.86993e+07 662.091 0 1613 6.1875e+07 3300 0 
+421875 181250 6.3091e-12 -5.78446e-13 6.85821e+07 636.66 0 1613 6.1875e+07 3300 0 
+
+375000 187500 7.92998e-12 -2.04612e-13 4.79134e+07 541.98 0 1613 4.125e+07 3300 0 
+421875 187500 6.55573e-12 -1.77079e-13 4.77871e+07 524.316 0 1613 4.125e+07 3300 0 
+
+
+421875 181250 6.3091e-12 -5.78446e-13 6.85821e+07 636.66 0 1613 6.1875e+07 3300 0 
+468750 181250 5.12289e-12 -5.11351e-13 6.84897e+07 617.284 0 1613 6.1875e+07 3300 0 
+
+421875 187500 6.55573e-12 -1.77079e-13 4.77871e+07 524.316 0 1613 4.125e+07 3300 0 
+468750 187500 5.31945e-12 -1.31474e-13 4.76876e+07 510.89 0 1613 4.125e+07 3300 0 
+
+
+468750 175000 4.85517e-12 -5.92932e-13 8.95709e+07 720.831 0 1613 8.25e+07 3300 0 
+515625 175000 3.89437e-12 -4.95311e-13 8.95057e+07 701.997 0 1613 8.25e+07 3300 0 
+
+468750 181250 5.12289e-12 -5.11351e-13 6.84897e+07 617.284 0 1613 6.1875e+07 3300 0 
+515625 181250 4.10642e-12 -4.36561e-13 6.84173e+07 602.385 0 1613 6.1875e+07 3300 0 
+
+
+515625 175000 3.89437e-12 -4.95311e-13 8.95057e+07 701.997 0 1613 8.25e+07 3300 0 
+562500 175000 3.09902e-12 -4.00403e-13 8.94547e+07 687.435 0 1613 8.25e+07 3300 0 
+
+515625 181250 4.10642e-12 -4.36561e-13 6.84173e+07 602.385 0 1613 6.1875e+07 3300 0 
+562500 181250 3.26626e-12 -3.64008e-13 6.83606e+07 590.874 0 1613 6.1875e+07 3300 0 
+
+
+468750 181250 5.12289e-12 -5.11351e-13 6.84897e+07 617.284 0 1613 6.1875e+07 3300 0 
+515625 181250 4.10642e-12 -4.36561e-13 6.84173e+07 602.385 0 1613 6.1875e+07 3300 0 
+
+468750 187500 5.31945e-12 -1.31474e-13 4.76876e+07 510.89 0 1613 4.125e+07 3300 0 
+515625 187500 4.26202e-12 -8.08469e-14 4.76098e+07 500.578 0 1613 4.125e+07 3300 0 
+
+
+515625 181250 4.10642e-12 -4.36561e-13 6.84173e+07 602.385 0 1613 6.1875e+07 3300 0 
+562500 181250 3.26626e-12 -3.64008e-13 6.83606e+07 590.874 0 1613 6.1875e+07 3300 0 
+
+515625 187500 4.26202e-12 -8.08469e-14 4.76098e+07 500.578 0 1613 4.125e+07 3300 0 
+562500 187500 3.38892e-12 -3.18119e-14 4.7549e+07 492.616 0 1613 4.125e+07 3300 0 
+
+
+375000 187500 7.92998e-12 -2.04612e-13 4.79134e+07 541.98 0 1613 4.125e+07 3300 0 
+421875 187500 6.55573e-12 -1.77079e-13 4.77871e+07 524.316 0 1613 4.125e+07 3300 0 
+
+375000 193750 8.11786e-12 -3.00969e-13 2.41532e+07 418.443 1 1613 2.0625e+07 3300 0 
+421875 193750 6.70654e-12 -2.86919e-13 2.40212e+07 409.394 1 1613 2.0625e+07 3300 0 
+
+
+421875 187500 6.55573e-12 -1.77079e-13 4.77871e+07 524.316 0 1613 4.125e+07 3300 0 
+468750 187500 5.31945e-12 -1.31474e-13 4.76876e+07 510.89 0 1613 4.125e+07 3300 0 
+
+421875 193750 6.70654e-12 -2.86919e-13 2.40212e+07 409.394 1 1613 2.0625e+07 3300 0 
+468750 193750 5.43956e-12 -2.6385e-13 2.39174e+07 402.524 1 1613 2.0625e+07 3300 0 
+
+
+375000 193750 8.11786e-12 -3.00969e-13 2.41532e+07 418.443 1 1613 2.0625e+07 3300 0 
+421875 193750 6.70654e-12 -2.86919e-13 2.40212e+07 409.394 1 1613 2.0625e+07 3300 0 
+
+375000 200000 8.18112e-12 0 -319151 293.15 1 1613 0 3300 0 
+421875 200000 6.75729e-12 0 -453132 293.15 1 1613 0 3300 0 
+
+
+421875 193750 6.70654e-12 -2.86919e-13 2.40212e+07 409.394 1 1613 2.0625e+07 3300 0 
+468750 193750 5.43956e-12 -2.6385e-13 2.39174e+07 402.524 1 1613 2.0625e+07 3300 0 
+
+421875 200000 6.75729e-12 0 -453132 293.15 1 1613 0 3300 0 
+468750 200000 5.47997e-12 0 -558388 293.15 1 1613 0 3300 0 
+
+
+468750 187500 5.31945e-12 -1.31474e-13 4.76876e+07 510.89 0 1613 4.125e+07 3300 0 
+515625 187500 4.26202e-12 -8.08469e-14 4.76098e+07 500.578 0 1613 4.125e+07 3300 0 
+
+468750 193750 5.43956e-12 -2.6385e-13 2.39174e+07 402.524 1 1613 2.0625e+07 3300 0 
+515625 193750 4.35707e-12 -2.38303e-13 2.38362e+07 397.252 1 1613 2.0625e+07 3300 0 
+
+
+515625 187500 4.26202e-12 -8.08469e-14 4.76098e+07 500.578 0 1613 4.125e+07 3300 0 
+562500 187500 3.38892e-12 -3.18119e-14 4.7549e+07 492.616 0 1613 4.125e+07 3300 0 
+
+515625 193750 4.35707e-12 -2.38303e-13 2.38362e+07 397.252 1 1613 2.0625e+07 3300 0 
+562500 193750 3.46383e-12 -2.13583e-13 2.37728e+07 393.183 1 1613 2.0625e+07 3300 0 
+
+
+468750 193750 5.43956e-12 -2.6385e-13 2.39174e+07 402.524 1 1613 2.0625e+07 3300 0 
+515625 193750 4.35707e-12 -2.38303e-13 2.38362e+07 397.252 1 1613 2.0625e+07 3300 0 
+
+468750 200000 5.47997e-12 0 -558388 293.15 1 1613 0 3300 0 
+515625 200000 4.38904e-12 0 -640720 293.15 1 1613 0 3300 0 
+
+
+515625 193750 4.35707e-12 -2.38303e-13 2.38362e+07 397.252 1 1613 2.0625e+07 3300 0 
+562500 193750 3.46383e-12 -2.13583e-13 2.37728e+07 393.183 1 1613 2.0625e+07 3300 0 
+
+515625 200000 4.38904e-12 0 -640720 293.15 1 1613 0 3300 0 
+562500 200000 3.48903e-12 0 -704990 293.15 1 1613 0 3300 0 
+
+
+562500 175000 3.09902e-12 -4.00403e-13 8.94547e+07 687.435 0 1613 8.25e+07 3300 0 
+609375 175000 2.46051e-12 -3.13298e-13 8.94149e+07 676.152 0 1613 8.25e+07 3300 0 
+
+562500 181250 3.26626e-12 -3.64008e-13 6.83606e+07 590.874 0 1613 6.1875e+07 3300 0 
+609375 181250 2.59225e-12 -2.97508e-13 6.83165e+07 581.96 0 1613 6.1875e+07 3300 0 
+
+
+609375 175000 2.46051e-12 -3.13298e-13 8.94149e+07 676.152 0 1613 8.25e+07 3300 0 
+656250 175000 1.96592e-12 -2.3351e-13 8.93838e+07 667.402 0 1613 8.25e+07 3300 0 
+
+609375 181250 2.59225e-12 -2.97508e-13 6.83165e+07 581.96 0 1613 6.1875e+07 3300 0 
+656250 181250 2.07018e-12 -2.36656e-13 6.8282e+07 575.048 0 1613 6.1875e+07 3300 0 
+
+
+562500 181250 3.26626e-12 -3.64008e-13 6.83606e+07 590.874 0 1613 6.1875e+07 3300 0 
+609375 181250 2.59225e-12 -2.97508e-13 6.83165e+07 581.96 0 1613 6.1875e+07 3300 0 
+
+562500 187500 3.38892e-12 -3.18119e-14 4.7549e+07 492.616 0 1613 4.125e+07 3300 0 
+609375 187500 2.68886e-12 1.30885e-14 4.75016e+07 486.452 0 1613 4.125e+07 3300 0 
+
+
+609375 181250 2.59225e-12 -2.97508e-13 6.83165e+07 581.96 0 1613 6.1875e+07 3300 0 
+656250 181250 2.07018e-12 -2.36656e-13 6.8282e+07 575.048 0 1613 6.1875e+07 3300 0 
+
+609375 187500 2.68886e-12 1.30885e-14 4.75016e+07 486.452 0 1613 4.125e+07 3300 0 
+656250 187500 2.1466e-12 5.41447e-14 4.74646e+07 481.672 0 1613 4.125e+07 3300 0 
+
+
+656250 175000 1.96592e-12 -2.3351e-13 8.93838e+07 667.402 0 1613 8.25e+07 3300 0 
+703125 175000 1.60692e-12 -1.56104e-13 8.93596e+07 660.612 0 1613 8.25e+07 3300 0 
+
+656250 181250 2.07018e-12 -2.36656e-13 6.8282e+07 575.048 0 1613 6.1875e+07 3300 0 
+703125 181250 1.69074e-12 -1.77687e-13 6.82551e+07 569.685 0 1613 6.1875e+07 3300 0 
+
+
+703125 175000 1.60692e-12 -1.56104e-13 8.93596e+07 660.612 0 1613 8.25e+07 3300 0 
+750000 175000 1.38794e-12 -7.11685e-14 8.93404e+07 655.343 0 1613 8.25e+07 3300 0 
+
+703125 181250 1.69074e-12 -1.77687e-13 6.82551e+07 569.685 0 1613 6.1875e+07 3300 0 
+750000 181250 1.45803e-12 -1.1306e-13 6.8234e+07 565.523 0 1613 6.1875e+07 3300 0 
+
+
+656250 181250 2.07018e-12 -2.36656e-13 6.8282e+07 575.048 0 1613 6.1875e+07 3300 0 
+703125 181250 1.69074e-12 -1.77687e-13 6.82551e+07 569.685 0 1613 6.1875e+07 3300 0 
+
+656250 187500 2.1466e-12 5.41447e-14 4.74646e+07 481.672 0 1613 4.125e+07 3300 0 
+703125 187500 1.75215e-12 9.39014e-14 4.74357e+07 477.965 0 1613 4.125e+07 3300 0 
+
+
+703125 181250 1.69074e-12 -1.77687e-13 6.82551e+07 569.685 0 1613 6.1875e+07 3300 0 
+750000 181250 1.45803e-12 -1.1306e-13 6.8234e+07 565.523 0 1613 6.1875e+07 3300 0 
+
+703125 187500 1.75215e-12 9.39014e-14 4.74357e+07 477.965 0 1613 4.125e+07 3300 0 
+750000 187500 1.50933e-12 1.37426e-13 4.7413e+07 475.088 0 1613 4.125e+07 3300 0 
+
+
+562500 187500 3.38892e-12 -3.18119e-14 4.7549e+07 492.616 0 1613 4.125e+07 3300 0 
+609375 187500 2.68886e-12 1.30885e-14 4.75016e+07 486.452 0 1613 4.125e+07 3300 0 
+
+562500 193750 3.46383e-12 -2.13583e-13 2.37728e+07 393.183 1 1613 2.0625e+07 3300 0 
+609375 193750 2.74784e-12 -1.9096e-13 2.37234e+07 390.033 1 1613 2.0625e+07 3300 0 
+
+
+609375 187500 2.68886e-12 1.30885e-14 4.75016e+07 486.452 0 1613 4.125e+07 3300 0 
+656250 187500 2.1466e-12 5.41447e-14 4.74646e+07 481.672 0 1613 4.125e+07 3300 0 
+
+609375 193750 2.74784e-12 -1.9096e-13 2.37234e+07 390.033 1 1613 2.0625e+07 3300 0 
+656250 193750 2.19325e-12 -1.70284e-13 2.36849e+07 387.592 1 1613 2.0625e+07 3300 0 
+
+
+562500 193750 3.46383e-12 -2.13583e-13 2.37728e+07 393.183 1 1613 2.0625e+07 3300 0 
+609375 193750 2.74784e-12 -1.9096e-13 2.37234e+07 390.033 1 1613 2.0625e+07 3300 0 
+
+562500 200000 3.48903e-12 0 -704990 293.15 1 1613 0 3300 0 
+609375 200000 2.76768e-12 0 -755082 293.15 1 1613 0 3300 0 
+
+
+609375 193750 2.74784e-12 -1.9096e-13 2.37234e+07 390.033 1 1613 2.0625e+07 3300 0 
+656250 193750 2.19325e-12 -1.70284e-13 2.36849e+07 387.592 1 1613 2.0625e+07 3300 0 
+
+609375 200000 2.76768e-12 0 -755082 293.15 1 1613 0 3300 0 
+656250 200000 2.20894e-12 0 -794123 293.15 1 1613 0 3300 0 
+
+
+656250 187500 2.1466e-12 5.41447e-14 4.74646e+07 481.672 0 1613 4.125e+07 3300 0 
+703125 187500 1.75215e-12 9.39014e-14 4.74357e+07 477.965 0 1613 4.125e+07 3300 0 
+
+656250 193750 2.19325e-12 -1.70284e-13 2.36849e+07 387.592 1 1613 2.0625e+07 3300 0 
+703125 193750 1.78963e-12 -1.50272e-13 2.36548e+07 385.697 1 1613 2.0625e+07 3300 0 
+
+
+703125 187500 1.75215e-12 9.39014e-14 4.74357e+07 477.965 0 1613 4.125e+07 3300 0 
+750000 187500 1.50933e-12 1.37426e-13 4.7413e+07 475.088 0 1613 4.125e+07 3300 0 
+
+703125 193750 1.78963e-12 -1.50272e-13 2.36548e+07 385.697 1 1613 2.0625e+07 3300 0 
+750000 193750 1.54061e-12 -1.28374e-13 2.36312e+07 384.227 1 1613 2.0625e+07 3300 0 
+
+
+656250 193750 2.19325e-12 -1.70284e-13 2.36849e+07 387.592 1 1613 2.0625e+07 3300 0 
+703125 193750 1.78963e-12 -1.50272e-13 2.36548e+07 385.697 1 1613 2.0625e+07 3300 0 
+
+656250 200000 2.20894e-12 0 -794123 293.15 1 1613 0 3300 0 
+703125 200000 1.80222e-12 0 -824607 293.15 1 1613 0 3300 0 
+
+
+703125 193750 1.78963e-12 -1.50272e-13 2.36548e+07 385.697 1 1613 2.0625e+07 3300 0 
+750000 193750 1.54061e-12 -1.28374e-13 2.36312e+07 384.227 1 1613 2.0625e+07 3300 0 
+
+703125 200000 1.80222e-12 0 -824607 293.15 1 1613 0 3300 0 
+750000 200000 1.55112e-12 0 -848583 293.15 1 1613 0 3300 0 
+
+
+750000 100000 -1.45711e-13 -1.64066e-13 3.39023e+08 1601.95 0 1613 3.3e+08 3300 0 
+796875 100000 -1.13287e-13 1.09699e-13 3.39029e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+750000 106250 -1.57948e-14 -1.6732e-13 3.18395e+08 1583.83 0 1613 3.09375e+08 3300 0 
+796875 106250 1.50757e-14 1.06281e-13 3.184e+08 1583.6 0 1613 3.09375e+08 3300 0 
+
+
+796875 100000 -1.13287e-13 1.09699e-13 3.39029e+08 1601.95 0 1613 3.3e+08 3300 0 
+843750 100000 -8.85867e-14 5.26627e-13 3.39033e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+796875 106250 1.50757e-14 1.06281e-13 3.184e+08 1583.6 0 1613 3.09375e+08 3300 0 
+843750 106250 6.23645e-14 5.22184e-13 3.18404e+08 1583.42 0 1613 3.09375e+08 3300 0 
+
+
+750000 106250 -1.57948e-14 -1.6732e-13 3.18395e+08 1583.83 0 1613 3.09375e+08 3300 0 
+796875 106250 1.50757e-14 1.06281e-13 3.184e+08 1583.6 0 1613 3.09375e+08 3300 0 
+
+750000 112500 1.18934e-13 -1.71017e-13 2.97743e+08 1502.93 0 1613 2.8875e+08 3300 0 
+796875 112500 1.46917e-13 9.97714e-14 2.97747e+08 1501.56 0 1613 2.8875e+08 3300 0 
+
+
+796875 106250 1.50757e-14 1.06281e-13 3.184e+08 1583.6 0 1613 3.09375e+08 3300 0 
+843750 106250 6.23645e-14 5.22184e-13 3.18404e+08 1583.42 0 1613 3.09375e+08 3300 0 
+
+796875 112500 1.46917e-13 9.97714e-14 2.97747e+08 1501.56 0 1613 2.8875e+08 3300 0 
+843750 112500 2.15545e-13 5.10631e-13 2.97751e+08 1500.5 0 1613 2.8875e+08 3300 0 
+
+
+843750 100000 -8.85867e-14 5.26627e-13 3.39033e+08 1601.95 0 1613 3.3e+08 3300 0 
+890625 100000 -7.11857e-14 1.21224e-12 3.39036e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+843750 106250 6.23645e-14 5.22184e-13 3.18404e+08 1583.42 0 1613 3.09375e+08 3300 0 
+890625 106250 1.41087e-13 1.20555e-12 3.18407e+08 1583.29 0 1613 3.09375e+08 3300 0 
+
+
+890625 100000 -7.11857e-14 1.21224e-12 3.39036e+08 1601.95 0 1613 3.3e+08 3300 0 
+937500 100000 -6.4245e-14 2.36817e-12 3.39039e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+890625 106250 1.41087e-13 1.20555e-12 3.18407e+08 1583.29 0 1613 3.09375e+08 3300 0 
+937500 106250 2.74261e-13 2.35791e-12 3.18408e+08 1583.18 0 1613 3.09375e+08 3300 0 
+
+
+843750 106250 6.23645e-14 5.22184e-13 3.18404e+08 1583.42 0 1613 3.09375e+08 3300 0 
+890625 106250 1.41087e-13 1.20555e-12 3.18407e+08 1583.29 0 1613 3.09375e+08 3300 0 
+
+843750 112500 2.15545e-13 5.10631e-13 2.97751e+08 1500.5 0 1613 2.8875e+08 3300 0 
+890625 112500 3.54269e-13 1.18516e-12 2.97753e+08 1499.68 0 1613 2.8875e+08 3300 0 
+
+
+890625 106250 1.41087e-13 1.20555e-12 3.18407e+08 1583.29 0 1613 3.09375e+08 3300 0 
+937500 106250 2.74261e-13 2.35791e-12 3.18408e+08 1583.18 0 1613 3.09375e+08 3300 0 
+
+890625 112500 3.54269e-13 1.18516e-12 2.97753e+08 1499.68 0 1613 2.8875e+08 3300 0 
+937500 112500 6.12133e-13 2.32279e-12 2.97753e+08 1499.04 0 1613 2.8875e+08 3300 0 
+
+
+750000 112500 1.18934e-13 -1.71017e-13 2.97743e+08 1502.93 0 1613 2.8875e+08 3300 0 
+796875 112500 1.46917e-13 9.97714e-14 2.97747e+08 1501.56 0 1613 2.8875e+08 3300 0 
+
+750000 118750 2.57698e-13 -1.71647e-13 2.77056e+08 1421.76 0 1613 2.68125e+08 3300 0 
+796875 118750 2.81368e-13 9.37234e-14 2.77059e+08 1419.32 0 1613 2.68125e+08 3300 0 
+
+
+796875 112500 1.46917e-13 9.97714e-14 2.97747e+08 1501.56 0 1613 2.8875e+08 3300 0 
+843750 112500 2.15545e-13 5.10631e-13 2.97751e+08 1500.5 0 1613 2.8875e+08 3300 0 
+
+796875 118750 2.81368e-13 9.37234e-14 2.77059e+08 1419.32 0 1613 2.68125e+08 3300 0 
+843750 118750 3.69793e-13 4.95575e-13 2.77062e+08 1417.43 0 1613 2.68125e+08 3300 0 
+
+
+750000 118750 2.57698e-13 -1.71647e-13 2.77056e+08 1421.76 0 1613 2.68125e+08 3300 0 
+796875 118750 2.81368e-13 9.37234e-14 2.77059e+08 1419.32 0 1613 2.68125e+08 3300 0 
+
+750000 125000 3.99291e-13 -1.70735e-13 2.56335e+08 1340.14 0 1613 2.475e+08 3300 0 
+796875 125000 4.17237e-13 8.65996e-14 2.56338e+08 1336.72 0 1613 2.475e+08 3300 0 
+
+
+796875 118750 2.81368e-13 9.37234e-14 2.77059e+08 1419.32 0 1613 2.68125e+08 3300 0 
+843750 118750 3.69793e-13 4.95575e-13 2.77062e+08 1417.43 0 1613 2.68125e+08 3300 0 
+
+796875 125000 4.17237e-13 8.65996e-14 2.56338e+08 1336.72 0 1613 2.475e+08 3300 0 
+843750 125000 5.237e-13 4.75516e-13 2.56339e+08 1334.07 0 1613 2.475e+08 3300 0 
+
+
+843750 112500 2.15545e-13 5.10631e-13 2.97751e+08 1500.5 0 1613 2.8875e+08 3300 0 
+890625 112500 3.54269e-13 1.18516e-12 2.97753e+08 1499.68 0 1613 2.8875e+08 3300 0 
+
+843750 118750 3.69793e-13 4.95575e-13 2.77062e+08 1417.43 0 1613 2.68125e+08 3300 0 
+890625 118750 5.66541e-13 1.15476e-12 2.77063e+08 1415.96 0 1613 2.68125e+08 3300 0 
+
+
+890625 112500 3.54269e-13 1.18516e-12 2.97753e+08 1499.68 0 1613 2.8875e+08 3300 0 
+937500 112500 6.12133e-13 2.32279e-12 2.97753e+08 1499.04 0 1613 2.8875e+08 3300 0 
+
+890625 118750 5.66541e-13 1.15476e-12 2.77063e+08 1415.96 0 1613 2.68125e+08 3300 0 
+937500 118750 9.46302e-13 2.26657e-12 2.77062e+08 1414.82 0 1613 2.68125e+08 3300 0 
+
+
+843750 118750 3.69793e-13 4.95575e-13 2.77062e+08 1417.43 0 1613 2.68125e+08 3300 0 
+890625 118750 5.66541e-13 1.15476e-12 2.77063e+08 1415.96 0 1613 2.68125e+08 3300 0 
+
+843750 125000 5.237e-13 4.75516e-13 2.56339e+08 1334.07 0 1613 2.475e+08 3300 0 
+890625 125000 7.75909e-13 1.11294e-12 2.56339e+08 1332.02 0 1613 2.475e+08 3300 0 
+
+
+890625 118750 5.66541e-13 1.15476e-12 2.77063e+08 1415.96 0 1613 2.68125e+08 3300 0 
+937500 118750 9.46302e-13 2.26657e-12 2.77062e+08 1414.82 0 1613 2.68125e+08 3300 0 
+
+890625 125000 7.75909e-13 1.11294e-12 2.56339e+08 1332.02 0 1613 2.475e+08 3300 0 
+937500 125000 1.27358e-12 2.18809e-12 2.56337e+08 1330.42 0 1613 2.475e+08 3300 0 
+
+
+937500 100000 -6.4245e-14 2.36817e-12 3.39039e+08 1601.95 0 1613 3.3e+08 3300 0 
+984375 100000 -8.23374e-14 4.29284e-12 3.39041e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+937500 106250 2.74261e-13 2.35791e-12 3.18408e+08 1583.18 0 1613 3.09375e+08 3300 0 
+984375 106250 4.92042e-13 4.27854e-12 3.18409e+08 1583.09 0 1613 3.09375e+08 3300 0 
+
+
+984375 100000 -8.23374e-14 4.29284e-12 3.39041e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.03125e+06 100000 -1.77332e-13 7.36052e-12 3.39044e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+984375 106250 4.92042e-13 4.27854e-12 3.18409e+08 1583.09 0 1613 3.09375e+08 3300 0 
+1.03125e+06 106250 8.1088e-13 7.34919e-12 3.18408e+08 1583.03 0 1613 3.09375e+08 3300 0 
+
+
+937500 106250 2.74261e-13 2.35791e-12 3.18408e+08 1583.18 0 1613 3.09375e+08 3300 0 
+984375 106250 4.92042e-13 4.27854e-12 3.18409e+08 1583.09 0 1613 3.09375e+08 3300 0 
+
+937500 112500 6.12133e-13 2.32279e-12 2.97753e+08 1499.04 0 1613 2.8875e+08 3300 0 
+984375 112500 1.06419e-12 4.22083e-12 2.97752e+08 1498.55 0 1613 2.8875e+08 3300 0 
+
+
+984375 106250 4.92042e-13 4.27854e-12 3.18409e+08 1583.09 0 1613 3.09375e+08 3300 0 
+1.03125e+06 106250 8.1088e-13 7.34919e-12 3.18408e+08 1583.03 0 1613 3.09375e+08 3300 0 
+
+984375 112500 1.06419e-12 4.22083e-12 2.97752e+08 1498.55 0 1613 2.8875e+08 3300 0 
+1.03125e+06 112500 1.79638e-12 7.26429e-12 2.97747e+08 1498.16 0 1613 2.8875e+08 3300 0 
+
+
+1.03125e+06 100000 -1.77332e-13 7.36052e-12 3.39044e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.07812e+06 100000 -5.09486e-13 1.18211e-11 3.39048e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+1.03125e+06 106250 8.1088e-13 7.34919e-12 3.18408e+08 1583.03 0 1613 3.09375e+08 3300 0 
+1.07812e+06 106250 1.16863e-12 1.18373e-11 3.18405e+08 1582.98 0 1613 3.09375e+08 3300 0 
+
+
+1.07812e+06 100000 -5.09486e-13 1.18211e-11 3.39048e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.125e+06 100000 -1.49961e-12 1.71151e-11 3.3907e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+1.07812e+06 106250 1.16863e-12 1.18373e-11 3.18405e+08 1582.98 0 1613 3.09375e+08 3300 0 
+1.125e+06 106250 1.20965e-12 1.72452e-11 3.18409e+08 1582.94 0 1613 3.09375e+08 3300 0 
+
+
+1.03125e+06 106250 8.1088e-13 7.34919e-12 3.18408e+08 1583.03 0 1613 3.09375e+08 3300 0 
+1.07812e+06 106250 1.16863e-12 1.18373e-11 3.18405e+08 1582.98 0 1613 3.09375e+08 3300 0 
+
+1.03125e+06 112500 1.79638e-12 7.26429e-12 2.97747e+08 1498.16 0 1613 2.8875e+08 3300 0 
+1.07812e+06 112500 2.85063e-12 1.1737e-11 2.97738e+08 1497.86 0 1613 2.8875e+08 3300 0 
+
+
+1.07812e+06 106250 1.16863e-12 1.18373e-11 3.18405e+08 1582.98 0 1613 3.09375e+08 3300 0 
+1.125e+06 106250 1.20965e-12 1.72452e-11 3.18409e+08 1582.94 0 1613 3.09375e+08 3300 0 
+
+1.07812e+06 112500 2.85063e-12 1.1737e-11 2.97738e+08 1497.86 0 1613 2.8875e+08 3300 0 
+1.125e+06 112500 3.95068e-12 1.72054e-11 2.97719e+08 1497.63 0 1613 2.8875e+08 3300 0 
+
+
+937500 112500 6.12133e-13 2.32279e-12 2.97753e+08 1499.04 0 1613 2.8875e+08 3300 0 
+984375 112500 1.06419e-12 4.22083e-12 2.97752e+08 1498.55 0 1613 2.8875e+08 3300 0 
+
+937500 118750 9.46302e-13 2.26657e-12 2.77062e+08 1414.82 0 1613 2.68125e+08 3300 0 
+984375 118750 1.62865e-12 4.12369e-12 2.77059e+08 1413.93 0 1613 2.68125e+08 3300 0 
+
+
+984375 112500 1.06419e-12 4.22083e-12 2.97752e+08 1498.55 0 1613 2.8875e+08 3300 0 
+1.03125e+06 112500 1.79638e-12 7.26429e-12 2.97747e+08 1498.16 0 1613 2.8875e+08 3300 0 
+
+984375 118750 1.62865e-12 4.12369e-12 2.77059e+08 1413.93 0 1613 2.68125e+08 3300 0 
+1.03125e+06 118750 2.76978e-12 7.10908e-12 2.77049e+08 1413.24 0 1613 2.68125e+08 3300 0 
+
+
+937500 118750 9.46302e-13 2.26657e-12 2.77062e+08 1414.82 0 1613 2.68125e+08 3300 0 
+984375 118750 1.62865e-12 4.12369e-12 2.77059e+08 1413.93 0 1613 2.68125e+08 3300 0 
+
+937500 125000 1.27358e-12 2.18809e-12 2.56337e+08 1330.42 0 1613 2.475e+08 3300 0 
+984375 125000 2.17987e-12 3.98601e-12 2.56332e+08 1329.18 0 1613 2.475e+08 3300 0 
+
+
+984375 118750 1.62865e-12 4.12369e-12 2.77059e+08 1413.93 0 1613 2.68125e+08 3300 0 
+1.03125e+06 118750 2.76978e-12 7.10908e-12 2.77049e+08 1413.24 0 1613 2.68125e+08 3300 0 
+
+984375 125000 2.17987e-12 3.98601e-12 2.56332e+08 1329.18 0 1613 2.475e+08 3300 0 
+1.03125e+06 125000 3.72156e-12 6.88321e-12 2.56318e+08 1328.22 0 1613 2.475e+08 3300 0 
+
+
+1.03125e+06 112500 1.79638e-12 7.26429e-12 2.97747e+08 1498.16 0 1613 2.8875e+08 3300 0 
+1.07812e+06 112500 2.85063e-12 1.1737e-11 2.97738e+08 1497.86 0 1613 2.8875e+08 3300 0 
+
+1.03125e+06 118750 2.76978e-12 7.10908e-12 2.77049e+08 1413.24 0 1613 2.68125e+08 3300 0 
+1.07812e+06 118750 4.51936e-12 1.15241e-11 2.77034e+08 1412.71 0 1613 2.68125e+08 3300 0 
+
+
+1.07812e+06 112500 2.85063e-12 1.1737e-11 2.97738e+08 1497.86 0 1613 2.8875e+08 3300 0 
+1.125e+06 112500 3.95068e-12 1.72054e-11 2.97719e+08 1497.63 0 1613 2.8875e+08 3300 0 
+
+1.07812e+06 118750 4.51936e-12 1.15241e-11 2.77034e+08 1412.71 0 1613 2.68125e+08 3300 0 
+1.125e+06 118750 6.69926e-12 1.69878e-11 2.76992e+08 1412.29 0 1613 2.68125e+08 3300 0 
+
+
+1.03125e+06 118750 2.76978e-12 7.10908e-12 2.77049e+08 1413.24 0 1613 2.68125e+08 3300 0 
+1.07812e+06 118750 4.51936e-12 1.15241e-11 2.77034e+08 1412.71 0 1613 2.68125e+08 3300 0 
+
+1.03125e+06 125000 3.72156e-12 6.88321e-12 2.56318e+08 1328.22 0 1613 2.475e+08 3300 0 
+1.07812e+06 125000 6.15722e-12 1.11948e-11 2.56295e+08 1327.47 0 1613 2.475e+08 3300 0 
+
+
+1.07812e+06 118750 4.51936e-12 1.15241e-11 2.77034e+08 1412.71 0 1613 2.68125e+08 3300 0 
+1.125e+06 118750 6.69926e-12 1.69878e-11 2.76992e+08 1412.29 0 1613 2.68125e+08 3300 0 
+
+1.07812e+06 125000 6.15722e-12 1.11948e-11 2.56295e+08 1327.47 0 1613 2.475e+08 3300 0 
+1.125e+06 125000 9.42959e-12 1.65939e-11 2.56237e+08 1326.89 0 1613 2.475e+08 3300 0 
+
+
+750000 125000 3.99291e-13 -1.70735e-13 2.56335e+08 1340.14 0 1613 2.475e+08 3300 0 
+796875 125000 4.17237e-13 8.65996e-14 2.56338e+08 1336.72 0 1613 2.475e+08 3300 0 
+
+750000 131250 5.42107e-13 -1.67663e-13 2.35581e+08 1257.86 0 1613 2.26875e+08 3300 0 
+796875 131250 5.53025e-13 7.90603e-14 2.35582e+08 1253.62 0 1613 2.26875e+08 3300 0 
+
+
+796875 125000 4.17237e-13 8.65996e-14 2.56338e+08 1336.72 0 1613 2.475e+08 3300 0 
+843750 125000 5.237e-13 4.75516e-13 2.56339e+08 1334.07 0 1613 2.475e+08 3300 0 
+
+796875 131250 5.53025e-13 7.90603e-14 2.35582e+08 1253.62 0 1613 2.26875e+08 3300 0 
+843750 131250 6.75636e-13 4.51215e-13 2.35582e+08 1250.33 0 1613 2.26875e+08 3300 0 
+
+
+750000 131250 5.42107e-13 -1.67663e-13 2.35581e+08 1257.86 0 1613 2.26875e+08 3300 0 
+796875 131250 5.53025e-13 7.90603e-14 2.35582e+08 1253.62 0 1613 2.26875e+08 3300 0 
+
+750000 137500 6.84194e-13 -1.62415e-13 2.14793e+08 1174.78 0 1613 2.0625e+08 3300 0 
+796875 137500 6.86976e-13 7.11886e-14 2.14792e+08 1169.89 0 1613 2.0625e+08 3300 0 
+
+
+796875 131250 5.53025e-13 7.90603e-14 2.35582e+08 1253.62 0 1613 2.26875e+08 3300 0 
+843750 131250 6.75636e-13 4.51215e-13 2.35582e+08 1250.33 0 1613 2.26875e+08 3300 0 
+
+796875 137500 6.86976e-13 7.11886e-14 2.14792e+08 1169.89 0 1613 2.0625e+08 3300 0 
+843750 137500 8.23786e-13 4.2288e-13 2.1479e+08 1166.09 0 1613 2.0625e+08 3300 0 
+
+
+843750 125000 5.237e-13 4.75516e-13 2.56339e+08 1334.07 0 1613 2.475e+08 3300 0 
+890625 125000 7.75909e-13 1.11294e-12 2.56339e+08 1332.02 0 1613 2.475e+08 3300 0 
+
+843750 131250 6.75636e-13 4.51215e-13 2.35582e+08 1250.33 0 1613 2.26875e+08 3300 0 
+890625 131250 9.80232e-13 1.06064e-12 2.3558e+08 1247.77 0 1613 2.26875e+08 3300 0 
+
+
+890625 125000 7.75909e-13 1.11294e-12 2.56339e+08 1332.02 0 1613 2.475e+08 3300 0 
+937500 125000 1.27358e-12 2.18809e-12 2.56337e+08 1330.42 0 1613 2.475e+08 3300 0 
+
+890625 131250 9.80232e-13 1.06064e-12 2.3558e+08 1247.77 0 1613 2.26875e+08 3300 0 
+937500 131250 1.59069e-12 2.0886e-12 2.35577e+08 1245.78 0 1613 2.26875e+08 3300 0 
+
+
+843750 131250 6.75636e-13 4.51215e-13 2.35582e+08 1250.33 0 1613 2.26875e+08 3300 0 
+890625 131250 9.80232e-13 1.06064e-12 2.3558e+08 1247.77 0 1613 2.26875e+08 3300 0 
+
+843750 137500 8.23786e-13 4.2288e-13 2.1479e+08 1166.09 0 1613 2.0625e+08 3300 0 
+890625 137500 1.17726e-12 9.98328e-13 2.14787e+08 1163.15 0 1613 2.0625e+08 3300 0 
+
+
+890625 131250 9.80232e-13 1.06064e-12 2.3558e+08 1247.77 0 1613 2.26875e+08 3300 0 
+937500 131250 1.59069e-12 2.0886e-12 2.35577e+08 1245.78 0 1613 2.26875e+08 3300 0 
+
+890625 137500 1.17726e-12 9.98328e-13 2.14787e+08 1163.15 0 1613 2.0625e+08 3300 0 
+937500 137500 1.89433e-12 1.96891e-12 2.14782e+08 1160.86 0 1613 2.0625e+08 3300 0 
+
+
+750000 137500 6.84194e-13 -1.62415e-13 2.14793e+08 1174.78 0 1613 2.0625e+08 3300 0 
+796875 137500 6.86976e-13 7.11886e-14 2.14792e+08 1169.89 0 1613 2.0625e+08 3300 0 
+
+750000 143750 8.2332e-13 -1.5491e-13 1.93971e+08 1090.76 0 1613 1.85625e+08 3300 0 
+796875 143750 8.17129e-13 6.31638e-14 1.93967e+08 1085.43 0 1613 1.85625e+08 3300 0 
+
+
+796875 137500 6.86976e-13 7.11886e-14 2.14792e+08 1169.89 0 1613 2.0625e+08 3300 0 
+843750 137500 8.23786e-13 4.2288e-13 2.1479e+08 1166.09 0 1613 2.0625e+08 3300 0 
+
+796875 143750 8.17129e-13 6.31638e-14 1.93967e+08 1085.43 0 1613 1.85625e+08 3300 0 
+843750 143750 9.66201e-13 3.90852e-13 1.93963e+08 1081.3 0 1613 1.85625e+08 3300 0 
+
+
+750000 143750 8.2332e-13 -1.5491e-13 1.93971e+08 1090.76 0 1613 1.85625e+08 3300 0 
+796875 143750 8.17129e-13 6.31638e-14 1.93967e+08 1085.43 0 1613 1.85625e+08 3300 0 
+
+750000 150000 9.57058e-13 -1.44989e-13 1.73113e+08 1005.73 0 1613 1.65e+08 3300 0 
+796875 150000 9.41383e-13 5.52678e-14 1.73107e+08 1000.19 0 1613 1.65e+08 3300 0 
+
+
+796875 143750 8.17129e-13 6.31638e-14 1.93967e+08 1085.43 0 1613 1.85625e+08 3300 0 
+843750 143750 9.66201e-13 3.90852e-13 1.93963e+08 1081.3 0 1613 1.85625e+08 3300 0 
+
+796875 150000 9.41383e-13 5.52678e-14 1.73107e+08 1000.19 0 1613 1.65e+08 3300 0 
+843750 150000 1.10085e-12 3.5564e-13 1.73101e+08 995.892 0 1613 1.65e+08 3300 0 
+
+
+843750 137500 8.23786e-13 4.2288e-13 2.1479e+08 1166.09 0 1613 2.0625e+08 3300 0 
+890625 137500 1.17726e-12 9.98328e-13 2.14787e+08 1163.15 0 1613 2.0625e+08 3300 0 
+
+843750 143750 9.66201e-13 3.90852e-13 1.93963e+08 1081.3 0 1613 1.85625e+08 3300 0 
+890625 143750 1.36466e-12 9.26679e-13 1.93958e+08 1078.09 0 1613 1.85625e+08 3300 0 
+
+
+890625 137500 1.17726e-12 9.98328e-13 2.14787e+08 1163.15 0 1613 2.0625e+08 3300 0 
+937500 137500 1.89433e-12 1.96891e-12 2.14782e+08 1160.86 0 1613 2.0625e+08 3300 0 
+
+890625 143750 1.36466e-12 9.26679e-13 1.93958e+08 1078.09 0 1613 1.85625e+08 3300 0 
+937500 143750 2.18121e-12 1.83008e-12 1.93951e+08 1075.59 0 1613 1.85625e+08 3300 0 
+
+
+843750 143750 9.66201e-13 3.90852e-13 1.93963e+08 1081.3 0 1613 1.85625e+08 3300 0 
+890625 143750 1.36466e-12 9.26679e-13 1.93958e+08 1078.09 0 1613 1.85625e+08 3300 0 
+
+843750 150000 1.10085e-12 3.5564e-13 1.73101e+08 995.892 0 1613 1.65e+08 3300 0 
+890625 150000 1.54012e-12 8.4652e-13 1.73095e+08 992.554 0 1613 1.65e+08 3300 0 
+
+
+890625 143750 1.36466e-12 9.26679e-13 1.93958e+08 1078.09 0 1613 1.85625e+08 3300 0 
+937500 143750 2.18121e-12 1.83008e-12 1.93951e+08 1075.59 0 1613 1.85625e+08 3300 0 
+
+890625 150000 1.54012e-12 8.4652e-13 1.73095e+08 992.554 0 1613 1.65e+08 3300 0 
+937500 150000 2.44813e-12 1.67374e-12 1.73086e+08 989.962 0 1613 1.65e+08 3300 0 
+
+
+937500 125000 1.27358e-12 2.18809e-12 2.56337e+08 1330.42 0 1613 2.475e+08 3300 0 
+984375 125000 2.17987e-12 3.98601e-12 2.56332e+08 1329.18 0 1613 2.475e+08 3300 0 
+
+937500 131250 1.59069e-12 2.0886e-12 2.35577e+08 1245.78 0 1613 2.26875e+08 3300 0 
+984375 131250 2.7123e-12 3.80933e-12 2.35569e+08 1244.24 0 1613 2.26875e+08 3300 0 
+
+
+984375 125000 2.17987e-12 3.98601e-12 2.56332e+08 1329.18 0 1613 2.475e+08 3300 0 
+1.03125e+06 125000 3.72156e-12 6.88321e-12 2.56318e+08 1328.22 0 1613 2.475e+08 3300 0 
+
+984375 131250 2.7123e-12 3.80933e-12 2.35569e+08 1244.24 0 1613 2.26875e+08 3300 0 
+1.03125e+06 131250 4.64209e-12 6.58924e-12 2.35552e+08 1243.05 0 1613 2.26875e+08 3300 0 
+
+
+937500 131250 1.59069e-12 2.0886e-12 2.35577e+08 1245.78 0 1613 2.26875e+08 3300 0 
+984375 131250 2.7123e-12 3.80933e-12 2.35569e+08 1244.24 0 1613 2.26875e+08 3300 0 
+
+937500 137500 1.89433e-12 1.96891e-12 2.14782e+08 1160.86 0 1613 2.0625e+08 3300 0 
+984375 137500 3.22047e-12 3.59543e-12 2.14772e+08 1159.08 0 1613 2.0625e+08 3300 0 
+
+
+984375 131250 2.7123e-12 3.80933e-12 2.35569e+08 1244.24 0 1613 2.26875e+08 3300 0 
+1.03125e+06 131250 4.64209e-12 6.58924e-12 2.35552e+08 1243.05 0 1613 2.26875e+08 3300 0 
+
+984375 137500 3.22047e-12 3.59543e-12 2.14772e+08 1159.08 0 1613 2.0625e+08 3300 0 
+1.03125e+06 137500 5.52184e-12 6.22844e-12 2.1475e+08 1157.7 0 1613 2.0625e+08 3300 0 
+
+
+1.03125e+06 125000 3.72156e-12 6.88321e-12 2.56318e+08 1328.22 0 1613 2.475e+08 3300 0 
+1.07812e+06 125000 6.15722e-12 1.11948e-11 2.56295e+08 1327.47 0 1613 2.475e+08 3300 0 
+
+1.03125e+06 131250 4.64209e-12 6.58924e-12 2.35552e+08 1243.05 0 1613 2.26875e+08 3300 0 
+1.07812e+06 131250 7.74668e-12 1.07491e-11 2.3552e+08 1242.12 0 1613 2.26875e+08 3300 0 
+
+
+1.07812e+06 125000 6.15722e-12 1.11948e-11 2.56295e+08 1327.47 0 1613 2.475e+08 3300 0 
+1.125e+06 125000 9.42959e-12 1.65939e-11 2.56237e+08 1326.89 0 1613 2.475e+08 3300 0 
+
+1.07812e+06 131250 7.74668e-12 1.07491e-11 2.3552e+08 1242.12 0 1613 2.26875e+08 3300 0 
+1.125e+06 131250 1.21128e-11 1.60281e-11 2.35446e+08 1241.4 0 1613 2.26875e+08 3300 0 
+
+
+1.03125e+06 131250 4.64209e-12 6.58924e-12 2.35552e+08 1243.05 0 1613 2.26875e+08 3300 0 
+1.07812e+06 131250 7.74668e-12 1.07491e-11 2.3552e+08 1242.12 0 1613 2.26875e+08 3300 0 
+
+1.03125e+06 137500 5.52184e-12 6.22844e-12 2.1475e+08 1157.7 0 1613 2.0625e+08 3300 0 
+1.07812e+06 137500 9.27001e-12 1.01933e-11 2.14713e+08 1156.63 0 1613 2.0625e+08 3300 0 
+
+
+1.07812e+06 131250 7.74668e-12 1.07491e-11 2.3552e+08 1242.12 0 1613 2.26875e+08 3300 0 
+1.125e+06 131250 1.21128e-11 1.60281e-11 2.35446e+08 1241.4 0 1613 2.26875e+08 3300 0 
+
+1.07812e+06 137500 9.27001e-12 1.01933e-11 2.14713e+08 1156.63 0 1613 2.0625e+08 3300 0 
+1.125e+06 137500 1.4718e-11 1.52761e-11 2.14614e+08 1155.8 0 1613 2.0625e+08 3300 0 
+
+
+937500 137500 1.89433e-12 1.96891e-12 2.14782e+08 1160.86 0 1613 2.0625e+08 3300 0 
+984375 137500 3.22047e-12 3.59543e-12 2.14772e+08 1159.08 0 1613 2.0625e+08 3300 0 
+
+937500 143750 2.18121e-12 1.83008e-12 1.93951e+08 1075.59 0 1613 1.85625e+08 3300 0 
+984375 143750 3.69899e-12 3.34669e-12 1.93939e+08 1073.66 0 1613 1.85625e+08 3300 0 
+
+
+984375 137500 3.22047e-12 3.59543e-12 2.14772e+08 1159.08 0 1613 2.0625e+08 3300 0 
+1.03125e+06 137500 5.52184e-12 6.22844e-12 2.1475e+08 1157.7 0 1613 2.0625e+08 3300 0 
+
+984375 143750 3.69899e-12 3.34669e-12 1.93939e+08 1073.66 0 1613 1.85625e+08 3300 0 
+1.03125e+06 143750 6.35159e-12 5.80249e-12 1.93913e+08 1072.16 0 1613 1.85625e+08 3300 0 
+
+
+937500 143750 2.18121e-12 1.83008e-12 1.93951e+08 1075.59 0 1613 1.85625e+08 3300 0 
+984375 143750 3.69899e-12 3.34669e-12 1.93939e+08 1073.66 0 1613 1.85625e+08 3300 0 
+
+937500 150000 2.44813e-12 1.67374e-12 1.73086e+08 989.962 0 1613 1.65e+08 3300 0 
+984375 150000 4.14268e-12 3.06504e-12 1.73072e+08 987.95 0 1613 1.65e+08 3300 0 
+
+
+984375 143750 3.69899e-12 3.34669e-12 1.93939e+08 1073.66 0 1613 1.85625e+08 3300 0 
+1.03125e+06 143750 6.35159e-12 5.80249e-12 1.93913e+08 1072.16 0 1613 1.85625e+08 3300 0 
+
+984375 150000 4.14268e-12 3.06504e-12 1.73072e+08 987.95 0 1613 1.65e+08 3300 0 
+1.03125e+06 150000 7.12235e-12 5.31739e-12 1.73043e+08 986.387 0 1613 1.65e+08 3300 0 
+
+
+1.03125e+06 137500 5.52184e-12 6.22844e-12 2.1475e+08 1157.7 0 1613 2.0625e+08 3300 0 
+1.07812e+06 137500 9.27001e-12 1.01933e-11 2.14713e+08 1156.63 0 1613 2.0625e+08 3300 0 
+
+1.03125e+06 143750 6.35159e-12 5.80249e-12 1.93913e+08 1072.16 0 1613 1.85625e+08 3300 0 
+1.07812e+06 143750 1.07093e-11 9.53658e-12 1.93872e+08 1070.99 0 1613 1.85625e+08 3300 0 
+
+
+1.07812e+06 137500 9.27001e-12 1.01933e-11 2.14713e+08 1156.63 0 1613 2.0625e+08 3300 0 
+1.125e+06 137500 1.4718e-11 1.52761e-11 2.14614e+08 1155.8 0 1613 2.0625e+08 3300 0 
+
+1.07812e+06 143750 1.07093e-11 9.53658e-12 1.93872e+08 1070.99 0 1613 1.85625e+08 3300 0 
+1.125e+06 143750 1.72151e-11 1.43198e-11 1.93745e+08 1070.09 0 1613 1.85625e+08 3300 0 
+
+
+1.03125e+06 143750 6.35159e-12 5.80249e-12 1.93913e+08 1072.16 0 1613 1.85625e+08 3300 0 
+1.07812e+06 143750 1.07093e-11 9.53658e-12 1.93872e+08 1070.99 0 1613 1.85625e+08 3300 0 
+
+1.03125e+06 150000 7.12235e-12 5.31739e-12 1.73043e+08 986.387 0 1613 1.65e+08 3300 0 
+1.07812e+06 150000 1.20476e-11 8.77721e-12 1.72989e+08 985.175 0 1613 1.65e+08 3300 0 
+
+
+1.07812e+06 143750 1.07093e-11 9.53658e-12 1.93872e+08 1070.99 0 1613 1.85625e+08 3300 0 
+1.125e+06 143750 1.72151e-11 1.43198e-11 1.93745e+08 1070.09 0 1613 1.85625e+08 3300 0 
+
+1.07812e+06 150000 1.20476e-11 8.77721e-12 1.72989e+08 985.175 0 1613 1.65e+08 3300 0 
+1.125e+06 150000 1.95723e-11 1.31917e-11 1.7287e+08 984.233 0 1613 1.65e+08 3300 0 
+
+
+1.125e+06 100000 -1.49961e-12 1.71151e-11 3.3907e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.17188e+06 100000 -3.5973e-12 1.97384e-11 3.39136e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+1.125e+06 106250 1.20965e-12 1.72452e-11 3.18409e+08 1582.94 0 1613 3.09375e+08 3300 0 
+1.17188e+06 106250 4.55254e-13 1.99236e-11 3.1845e+08 1561.87 0 1613 3.09375e+08 3300 0 
+
+
+1.17188e+06 100000 -3.5973e-12 1.97384e-11 3.39136e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.21875e+06 100000 -4.57349e-12 1.20321e-11 3.395e+08 1466.02 0 1613 3.3e+08 3300 0 
+
+1.17188e+06 106250 4.55254e-13 1.99236e-11 3.1845e+08 1561.87 0 1613 3.09375e+08 3300 0 
+1.21875e+06 106250 5.38037e-13 1.19604e-11 3.18726e+08 1386.02 0 1613 3.09375e+08 3300 0 
+
+
+1.125e+06 106250 1.20965e-12 1.72452e-11 3.18409e+08 1582.94 0 1613 3.09375e+08 3300 0 
+1.17188e+06 106250 4.55254e-13 1.99236e-11 3.1845e+08 1561.87 0 1613 3.09375e+08 3300 0 
+
+1.125e+06 112500 3.95068e-12 1.72054e-11 2.97719e+08 1497.63 0 1613 2.8875e+08 3300 0 
+1.17188e+06 112500 4.61383e-12 1.99351e-11 2.97748e+08 1475.34 0 1613 2.8875e+08 3300 0 
+
+
+1.17188e+06 106250 4.55254e-13 1.99236e-11 3.1845e+08 1561.87 0 1613 3.09375e+08 3300 0 
+1.21875e+06 106250 5.38037e-13 1.19604e-11 3.18726e+08 1386.02 0 1613 3.09375e+08 3300 0 
+
+1.17188e+06 112500 4.61383e-12 1.99351e-11 2.97748e+08 1475.34 0 1613 2.8875e+08 3300 0 
+1.21875e+06 112500 5.70065e-12 1.1746e-11 2.97842e+08 1305.56 0 1613 2.8875e+08 3300 0 
+
+
+1.21875e+06 100000 -4.57349e-12 1.20321e-11 3.395e+08 1466.02 0 1613 3.3e+08 3300 0 
+1.26562e+06 100000 4.71955e-13 -1.25636e-11 3.39471e+08 1141.42 0 1613 3.3e+08 3300 0 
+
+1.21875e+06 106250 5.38037e-13 1.19604e-11 3.18726e+08 1386.02 0 1613 3.09375e+08 3300 0 
+1.26562e+06 106250 6.08285e-12 -1.44789e-11 3.18627e+08 1077.01 0 1613 3.09375e+08 3300 0 
+
+
+1.26562e+06 100000 4.71955e-13 -1.25636e-11 3.39471e+08 1141.42 0 1613 3.3e+08 3300 0 
+1.3125e+06 100000 1.536e-11 -4.33481e-11 3.406e+08 995.24 0 1613 3.3e+08 3300 0 
+
+1.26562e+06 106250 6.08285e-12 -1.44789e-11 3.18627e+08 1077.01 0 1613 3.09375e+08 3300 0 
+1.3125e+06 106250 2.01878e-11 -4.4238e-11 3.1966e+08 1025.25 0 1613 3.09375e+08 3300 0 
+
+
+1.21875e+06 106250 5.38037e-13 1.19604e-11 3.18726e+08 1386.02 0 1613 3.09375e+08 3300 0 
+1.26562e+06 106250 6.08285e-12 -1.44789e-11 3.18627e+08 1077.01 0 1613 3.09375e+08 3300 0 
+
+1.21875e+06 112500 5.70065e-12 1.1746e-11 2.97842e+08 1305.56 0 1613 2.8875e+08 3300 0 
+1.26562e+06 112500 1.17619e-11 -1.61063e-11 2.98037e+08 1015.85 0 1613 2.8875e+08 3300 0 
+
+
+1.26562e+06 106250 6.08285e-12 -1.44789e-11 3.18627e+08 1077.01 0 1613 3.09375e+08 3300 0 
+1.3125e+06 106250 2.01878e-11 -4.4238e-11 3.1966e+08 1025.25 0 1613 3.09375e+08 3300 0 
+
+1.26562e+06 112500 1.17619e-11 -1.61063e-11 2.98037e+08 1015.85 0 1613 2.8875e+08 3300 0 
+1.3125e+06 112500 2.54307e-11 -4.55768e-11 2.97691e+08 1075.15 0 1613 2.8875e+08 3300 0 
+
+
+1.125e+06 112500 3.95068e-12 1.72054e-11 2.97719e+08 1497.63 0 1613 2.8875e+08 3300 0 
+1.17188e+06 112500 4.61383e-12 1.99351e-11 2.97748e+08 1475.34 0 1613 2.8875e+08 3300 0 
+
+1.125e+06 118750 6.69926e-12 1.69878e-11 2.76992e+08 1412.29 0 1613 2.68125e+08 3300 0 
+1.17188e+06 118750 8.82404e-12 1.97951e-11 2.77009e+08 1388.76 0 1613 2.68125e+08 3300 0 
+
+
+1.17188e+06 112500 4.61383e-12 1.99351e-11 2.97748e+08 1475.34 0 1613 2.8875e+08 3300 0 
+1.21875e+06 112500 5.70065e-12 1.1746e-11 2.97842e+08 1305.56 0 1613 2.8875e+08 3300 0 
+
+1.17188e+06 118750 8.82404e-12 1.97951e-11 2.77009e+08 1388.76 0 1613 2.68125e+08 3300 0 
+1.21875e+06 118750 1.09009e-11 1.13145e-11 2.76926e+08 1224.73 0 1613 2.68125e+08 3300 0 
+
+
+1.125e+06 118750 6.69926e-12 1.69878e-11 2.76992e+08 1412.29 0 1613 2.68125e+08 3300 0 
+1.17188e+06 118750 8.82404e-12 1.97951e-11 2.77009e+08 1388.76 0 1613 2.68125e+08 3300 0 
+
+1.125e+06 125000 9.42959e-12 1.65939e-11 2.56237e+08 1326.89 0 1613 2.475e+08 3300 0 
+1.17188e+06 125000 1.30337e-11 1.94667e-11 2.56208e+08 1302.13 0 1613 2.475e+08 3300 0 
+
+
+1.17188e+06 118750 8.82404e-12 1.97951e-11 2.77009e+08 1388.76 0 1613 2.68125e+08 3300 0 
+1.21875e+06 118750 1.09009e-11 1.13145e-11 2.76926e+08 1224.73 0 1613 2.68125e+08 3300 0 
+
+1.17188e+06 125000 1.30337e-11 1.94667e-11 2.56208e+08 1302.13 0 1613 2.475e+08 3300 0 
+1.21875e+06 125000 1.61334e-11 1.07872e-11 2.56064e+08 1143.7 0 1613 2.475e+08 3300 0 
+
+
+1.21875e+06 112500 5.70065e-12 1.1746e-11 2.97842e+08 1305.56 0 1613 2.8875e+08 3300 0 
+1.26562e+06 112500 1.17619e-11 -1.61063e-11 2.98037e+08 1015.85 0 1613 2.8875e+08 3300 0 
+
+1.21875e+06 118750 1.09009e-11 1.13145e-11 2.76926e+08 1224.73 0 1613 2.68125e+08 3300 0 
+1.26562e+06 118750 1.73344e-11 -1.70463e-11 2.77413e+08 960.672 0 1613 2.68125e+08 3300 0 
+
+
+1.26562e+06 112500 1.17619e-11 -1.61063e-11 2.98037e+08 1015.85 0 1613 2.8875e+08 3300 0 
+1.3125e+06 112500 2.54307e-11 -4.55768e-11 2.97691e+08 1075.15 0 1613 2.8875e+08 3300 0 
+
+1.26562e+06 118750 1.73344e-11 -1.70463e-11 2.77413e+08 960.672 0 1613 2.68125e+08 3300 0 
+1.3125e+06 118750 2.99204e-11 -4.86255e-11 2.75812e+08 1148.16 0 1613 2.68125e+08 3300 0 
+
+
+1.21875e+06 118750 1.09009e-11 1.13145e-11 2.76926e+08 1224.73 0 1613 2.68125e+08 3300 0 
+1.26562e+06 118750 1.73344e-11 -1.70463e-11 2.77413e+08 960.672 0 1613 2.68125e+08 3300 0 
+
+1.21875e+06 125000 1.61334e-11 1.07872e-11 2.56064e+08 1143.7 0 1613 2.475e+08 3300 0 
+1.26562e+06 125000 2.2646e-11 -1.78216e-11 2.56439e+08 915.591 0 1613 2.475e+08 3300 0 
+
+
+1.26562e+06 118750 1.73344e-11 -1.70463e-11 2.77413e+08 960.672 0 1613 2.68125e+08 3300 0 
+1.3125e+06 118750 2.99204e-11 -4.86255e-11 2.75812e+08 1148.16 0 1613 2.68125e+08 3300 0 
+
+1.26562e+06 125000 2.2646e-11 -1.78216e-11 2.56439e+08 915.591 0 1613 2.475e+08 3300 0 
+1.3125e+06 125000 3.25054e-11 -5.18775e-11 2.55257e+08 1245.47 0 1613 2.475e+08 3300 0 
+
+
+1.3125e+06 100000 1.536e-11 -4.33481e-11 3.406e+08 995.24 0 1613 3.3e+08 3300 0 
+1.35938e+06 100000 2.31645e-11 -4.99526e-11 3.37782e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+1.3125e+06 106250 2.01878e-11 -4.4238e-11 3.1966e+08 1025.25 0 1613 3.09375e+08 3300 0 
+1.35938e+06 106250 2.03522e-11 -4.38173e-11 3.17357e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+
+1.35938e+06 100000 2.31645e-11 -4.99526e-11 3.37782e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.40625e+06 100000 -1.75774e-12 -2.09137e-12 3.37445e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+1.35938e+06 106250 2.03522e-11 -4.38173e-11 3.17357e+08 1582.8 0 1613 3.09375e+08 3300 0 
+1.40625e+06 106250 -4.33252e-12 -6.89299e-13 3.16653e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+
+1.3125e+06 106250 2.01878e-11 -4.4238e-11 3.1966e+08 1025.25 0 1613 3.09375e+08 3300 0 
+1.35938e+06 106250 2.03522e-11 -4.38173e-11 3.17357e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+1.3125e+06 112500 2.54307e-11 -4.55768e-11 2.97691e+08 1075.15 0 1613 2.8875e+08 3300 0 
+1.35938e+06 112500 1.58805e-11 -3.82794e-11 2.95581e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+
+1.35938e+06 106250 2.03522e-11 -4.38173e-11 3.17357e+08 1582.8 0 1613 3.09375e+08 3300 0 
+1.40625e+06 106250 -4.33252e-12 -6.89299e-13 3.16653e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+1.35938e+06 112500 1.58805e-11 -3.82794e-11 2.95581e+08 1496.83 0 1613 2.8875e+08 3300 0 
+1.40625e+06 112500 -6.86743e-12 4.75458e-13 2.96177e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+
+1.40625e+06 100000 -1.75774e-12 -2.09137e-12 3.37445e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.45312e+06 100000 -5.52784e-12 2.48735e-11 3.3845e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+1.40625e+06 106250 -4.33252e-12 -6.89299e-13 3.16653e+08 1582.8 0 1613 3.09375e+08 3300 0 
+1.45312e+06 106250 -6.11917e-12 2.40811e-11 3.1767e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+
+1.45312e+06 100000 -5.52784e-12 2.48735e-11 3.3845e+08 1601.95 0 1613 3.3e+08 3300 0 
+1.5e+06 100000 0 0 3.3826e+08 1601.95 0 1613 3.3e+08 3300 0 
+
+1.45312e+06 106250 -6.11917e-12 2.40811e-11 3.1767e+08 1582.8 0 1613 3.09375e+08 3300 0 
+1.5e+06 106250 0 0 3.17412e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+
+1.40625e+06 106250 -4.33252e-12 -6.89299e-13 3.16653e+08 1582.8 0 1613 3.09375e+08 3300 0 
+1.45312e+06 106250 -6.11917e-12 2.40811e-11 3.1767e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+1.40625e+06 112500 -6.86743e-12 4.75458e-13 2.96177e+08 1496.83 0 1613 2.8875e+08 3300 0 
+1.45312e+06 112500 -6.57742e-12 2.31385e-11 2.96773e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+
+1.45312e+06 106250 -6.11917e-12 2.40811e-11 3.1767e+08 1582.8 0 1613 3.09375e+08 3300 0 
+1.5e+06 106250 0 0 3.17412e+08 1582.8 0 1613 3.09375e+08 3300 0 
+
+1.45312e+06 112500 -6.57742e-12 2.31385e-11 2.96773e+08 1496.83 0 1613 2.8875e+08 3300 0 
+1.5e+06 112500 0 0 2.96634e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+
+1.3125e+06 112500 2.54307e-11 -4.55768e-11 2.97691e+08 1075.15 0 1613 2.8875e+08 3300 0 
+1.35938e+06 112500 1.58805e-11 -3.82794e-11 2.95581e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+1.3125e+06 118750 2.99204e-11 -4.86255e-11 2.75812e+08 1148.16 0 1613 2.68125e+08 3300 0 
+1.35938e+06 118750 1.09748e-11 -3.48433e-11 2.73738e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+
+1.35938e+06 112500 1.58805e-11 -3.82794e-11 2.95581e+08 1496.83 0 1613 2.8875e+08 3300 0 
+1.40625e+06 112500 -6.86743e-12 4.75458e-13 2.96177e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+1.35938e+06 118750 1.09748e-11 -3.48433e-11 2.73738e+08 1410.85 0 1613 2.68125e+08 3300 0 
+1.40625e+06 118750 -9.22418e-12 1.96425e-12 2.75667e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+
+1.3125e+06 118750 2.99204e-11 -4.86255e-11 2.75812e+08 1148.16 0 1613 2.68125e+08 3300 0 
+1.35938e+06 118750 1.09748e-11 -3.48433e-11 2.73738e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+1.3125e+06 125000 3.25054e-11 -5.18775e-11 2.55257e+08 1245.47 0 1613 2.475e+08 3300 0 
+1.35938e+06 125000 6.82225e-12 -3.22342e-11 2.52888e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+
+1.35938e+06 118750 1.09748e-11 -3.48433e-11 2.73738e+08 1410.85 0 1613 2.68125e+08 3300 0 
+1.40625e+06 118750 -9.22418e-12 1.96425e-12 2.75667e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+1.35938e+06 125000 6.82225e-12 -3.22342e-11 2.52888e+08 1324.87 0 1613 2.475e+08 3300 0 
+1.40625e+06 125000 -1.12669e-11 3.40467e-12 2.54851e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+
+1.40625e+06 112500 -6.86743e-12 4.75458e-13 2.96177e+08 1496.83 0 1613 2.8875e+08 3300 0 
+1.45312e+06 112500 -6.57742e-12 2.31385e-11 2.96773e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+1.40625e+06 118750 -9.22418e-12 1.96425e-12 2.75667e+08 1410.85 0 1613 2.68125e+08 3300 0 
+1.45312e+06 118750 -6.95584e-12 2.19106e-11 2.75852e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+
+1.45312e+06 112500 -6.57742e-12 2.31385e-11 2.96773e+08 1496.83 0 1613 2.8875e+08 3300 0 
+1.5e+06 112500 0 0 2.96634e+08 1496.83 0 1613 2.8875e+08 3300 0 
+
+1.45312e+06 118750 -6.95584e-12 2.19106e-11 2.75852e+08 1410.85 0 1613 2.68125e+08 3300 0 
+1.5e+06 118750 0 0 2.75833e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+
+1.40625e+06 118750 -9.22418e-12 1.96425e-12 2.75667e+08 1410.85 0 1613 2.68125e+08 3300 0 
+1.45312e+06 118750 -6.95584e-12 2.19106e-11 2.75852e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+1.40625e+06 125000 -1.12669e-11 3.40467e-12 2.54851e+08 1324.87 0 1613 2.475e+08 3300 0 
+1.45312e+06 125000 -7.30239e-12 2.05167e-11 2.54994e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+
+1.45312e+06 118750 -6.95584e-12 2.19106e-11 2.75852e+08 1410.85 0 1613 2.68125e+08 3300 0 
+1.5e+06 118750 0 0 2.75833e+08 1410.85 0 1613 2.68125e+08 3300 0 
+
+1.45312e+06 125000 -7.30239e-12 2.05167e-11 2.54994e+08 1324.87 0 1613 2.475e+08 3300 0 
+1.5e+06 125000 0 0 2.54946e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+
+1.125e+06 125000 9.42959e-12 1.65939e-11 2.56237e+08 1326.89 0 1613 2.475e+08 3300 0 
+1.17188e+06 125000 1.30337e-11 1.94667e-11 2.56208e+08 1302.13 0 1613 2.475e+08 3300 0 
+
+1.125e+06 131250 1.21128e-11 1.60281e-11 2.35446e+08 1241.4 0 1613 2.26875e+08 3300 0 
+1.17188e+06 131250 1.71959e-11 1.89193e-11 2.35373e+08 1215.46 0 1613 2.26875e+08 3300 0 
+
+
+1.17188e+06 125000 1.30337e-11 1.94667e-11 2.56208e+08 1302.13 0 1613 2.475e+08 3300 0 
+1.21875e+06 125000 1.61334e-11 1.07872e-11 2.56064e+08 1143.7 0 1613 2.475e+08 3300 0 
+
+1.17188e+06 131250 1.71959e-11 1.89193e-11 2.35373e+08 1215.46 0 1613 2.26875e+08 3300 0 
+1.21875e+06 131250 2.13673e-11 1.02415e-11 2.35166e+08 1062.82 0 1613 2.26875e+08 3300 0 
+
+
+1.125e+06 131250 1.21128e-11 1.60281e-11 2.35446e+08 1241.4 0 1613 2.26875e+08 3300 0 
+1.17188e+06 131250 1.71959e-11 1.89193e-11 2.35373e+08 1215.46 0 1613 2.26875e+08 3300 0 
+
+1.125e+06 137500 1.4718e-11 1.52761e-11 2.14614e+08 1155.8 0 1613 2.0625e+08 3300 0 
+1.17188e+06 137500 2.12584e-11 1.82008e-11 2.14528e+08 1128.74 0 1613 2.0625e+08 3300 0 
+
+
+1.17188e+06 131250 1.71959e-11 1.89193e-11 2.35373e+08 1215.46 0 1613 2.26875e+08 3300 0 
+1.21875e+06 131250 2.13673e-11 1.02415e-11 2.35166e+08 1062.82 0 1613 2.26875e+08 3300 0 
+
+1.17188e+06 137500 2.12584e-11 1.82008e-11 2.14528e+08 1128.74 0 1613 2.0625e+08 3300 0 
+1.21875e+06 137500 2.65508e-11 9.49969e-12 2.14135e+08 982.892 0 1613 2.0625e+08 3300 0 
+
+
+1.21875e+06 125000 1.61334e-11 1.07872e-11 2.56064e+08 1143.7 0 1613 2.475e+08 3300 0 
+1.26562e+06 125000 2.2646e-11 -1.78216e-11 2.56439e+08 915.591 0 1613 2.475e+08 3300 0 
+
+1.21875e+06 131250 2.13673e-11 1.02415e-11 2.35166e+08 1062.82 0 1613 2.26875e+08 3300 0 
+1.26562e+06 131250 2.76829e-11 -1.89937e-11 2.35446e+08 886.463 0 1613 2.26875e+08 3300 0 
+
+
+1.26562e+06 125000 2.2646e-11 -1.78216e-11 2.56439e+08 915.591 0 1613 2.475e+08 3300 0 
+1.3125e+06 125000 3.25054e-11 -5.18775e-11 2.55257e+08 1245.47 0 1613 2.475e+08 3300 0 
+
+1.26562e+06 131250 2.76829e-11 -1.89937e-11 2.35446e+08 886.463 0 1613 2.26875e+08 3300 0 
+1.3125e+06 131250 3.33734e-11 -5.41232e-11 2.34758e+08 1365.92 1 1613 2.26875e+08 3300 0 
+
+
+1.21875e+06 131250 2.13673e-11 1.02415e-11 2.35166e+08 1062.82 0 1613 2.26875e+08 3300 0 
+1.26562e+06 131250 2.76829e-11 -1.89937e-11 2.35446e+08 886.463 0 1613 2.26875e+08 3300 0 
+
+1.21875e+06 137500 2.65508e-11 9.49969e-12 2.14135e+08 982.892 0 1613 2.0625e+08 3300 0 
+1.26562e+06 137500 3.24545e-11 -1.98415e-11 2.14782e+08 881.014 0 1613 2.0625e+08 3300 0 
+
+
+1.26562e+06 131250 2.76829e-11 -1.89937e-11 2.35446e+08 886.463 0 1613 2.26875e+08 3300 0 
+1.3125e+06 131250 3.33734e-11 -5.41232e-11 2.34758e+08 1365.92 1 1613 2.26875e+08 3300 0 
+
+1.26562e+06 137500 3.24545e-11 -1.98415e-11 2.14782e+08 881.014 0 1613 2.0625e+08 3300 0 
+1.3125e+06 137500 3.292e-11 -5.26141e-11 2.12542e+08 1505.65 1 1613 2.0625e+08 3300 0 
+
+
+1.125e+06 137500 1.4718e-11 1.52761e-11 2.14614e+08 1155.8 0 1613 2.0625e+08 3300 0 
+1.17188e+06 137500 2.12584e-11 1.82008e-11 2.14528e+08 1128.74 0 1613 2.0625e+08 3300 0 
+
+1.125e+06 143750 1.72151e-11 1.43198e-11 1.93745e+08 1070.09 0 1613 1.85625e+08 3300 0 
+1.17188e+06 143750 2.51689e-11 1.7381e-11 1.93657e+08 1041.99 0 1613 1.85625e+08 3300 0 
+
+
+1.17188e+06 137500 2.12584e-11 1.82008e-11 2.14528e+08 1128.74 0 1613 2.0625e+08 3300 0 
+1.21875e+06 137500 2.65508e-11 9.49969e-12 2.14135e+08 982.892 0 1613 2.0625e+08 3300 0 
+
+1.17188e+06 143750 2.51689e-11 1.7381e-11 1.93657e+08 1041.99 0 1613 1.85625e+08 3300 0 
+1.21875e+06 143750 3.17172e-11 8.30288e-12 1.93034e+08 905.811 0 1613 1.85625e+08 3300 0 
+
+
+1.125e+06 143750 1.72151e-11 1.43198e-11 1.93745e+08 1070.09 0 1613 1.85625e+08 3300 0 
+1.17188e+06 143750 2.51689e-11 1.7381e-11 1.93657e+08 1041.99 0 1613 1.85625e+08 3300 0 
+
+1.125e+06 150000 1.95723e-11 1.31917e-11 1.7287e+08 984.233 0 1613 1.65e+08 3300 0 
+1.17188e+06 150000 2.88902e-11 1.63621e-11 1.72652e+08 955.22 0 1613 1.65e+08 3300 0 
+
+
+1.17188e+06 143750 2.51689e-11 1.7381e-11 1.93657e+08 1041.99 0 1613 1.85625e+08 3300 0 
+1.21875e+06 143750 3.17172e-11 8.30288e-12 1.93034e+08 905.811 0 1613 1.85625e+08 3300 0 
+
+1.17188e+06 150000 2.88902e-11 1.63621e-11 1.72652e+08 955.22 0 1613 1.65e+08 3300 0 
+1.21875e+06 150000 3.6941e-11 7.04024e-12 1.72263e+08 835.745 0 1613 1.65e+08 3300 0 
+
+
+1.21875e+06 137500 2.65508e-11 9.49969e-12 2.14135e+08 982.892 0 1613 2.0625e+08 3300 0 
+1.26562e+06 137500 3.24545e-11 -1.98415e-11 2.14782e+08 881.014 0 1613 2.0625e+08 3300 0 
+
+1.21875e+06 143750 3.17172e-11 8.30288e-12 1.93034e+08 905.811 0 1613 1.85625e+08 3300 0 
+1.26562e+06 143750 3.73204e-11 -1.93197e-11 1.94229e+08 908.405 0 1613 1.85625e+08 3300 0 
+
+
+1.26562e+06 137500 3.24545e-11 -1.98415e-11 2.14782e+08 881.014 0 1613 2.0625e+08 3300 0 
+1.3125e+06 137500 3.292e-11 -5.26141e-11 2.12542e+08 1505.65 1 1613 2.0625e+08 3300 0 
+
+1.26562e+06 143750 3.73204e-11 -1.93197e-11 1.94229e+08 908.405 0 1613 1.85625e+08 3300 0 
+1.3125e+06 143750 3.10502e-11 -4.61144e-11 1.90965e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+
+1.21875e+06 143750 3.17172e-11 8.30288e-12 1.93034e+08 905.811 0 1613 1.85625e+08 3300 0 
+1.26562e+06 143750 3.73204e-11 -1.93197e-11 1.94229e+08 908.405 0 1613 1.85625e+08 3300 0 
+
+1.21875e+06 150000 3.6941e-11 7.04024e-12 1.72263e+08 835.745 0 1613 1.65e+08 3300 0 
+1.26562e+06 150000 4.27184e-11 -1.90225e-11 1.72296e+08 977.844 0 1613 1.65e+08 3300 0 
+
+
+1.26562e+06 143750 3.73204e-11 -1.93197e-11 1.94229e+08 908.405 0 1613 1.85625e+08 3300 0 
+1.3125e+06 143750 3.10502e-11 -4.61144e-11 1.90965e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+1.26562e+06 150000 4.27184e-11 -1.90225e-11 1.72296e+08 977.844 0 1613 1.65e+08 3300 0 
+1.3125e+06 150000 2.73872e-11 -3.87333e-11 1.69551e+08 980.966 0 1613 1.65e+08 3300 0 
+
+
+1.3125e+06 125000 3.25054e-11 -5.18775e-11 2.55257e+08 1245.47 0 1613 2.475e+08 3300 0 
+1.35938e+06 125000 6.82225e-12 -3.22342e-11 2.52888e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+1.3125e+06 131250 3.33734e-11 -5.41232e-11 2.34758e+08 1365.92 1 1613 2.26875e+08 3300 0 
+1.35938e+06 131250 3.31241e-12 -2.93353e-11 2.32206e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+
+1.35938e+06 125000 6.82225e-12 -3.22342e-11 2.52888e+08 1324.87 0 1613 2.475e+08 3300 0 
+1.40625e+06 125000 -1.12669e-11 3.40467e-12 2.54851e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+1.35938e+06 131250 3.31241e-12 -2.93353e-11 2.32206e+08 1238.9 0 1613 2.26875e+08 3300 0 
+1.40625e+06 131250 -1.30223e-11 4.37536e-12 2.33956e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+
+1.3125e+06 131250 3.33734e-11 -5.41232e-11 2.34758e+08 1365.92 1 1613 2.26875e+08 3300 0 
+1.35938e+06 131250 3.31241e-12 -2.93353e-11 2.32206e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+1.3125e+06 137500 3.292e-11 -5.26141e-11 2.12542e+08 1505.65 1 1613 2.0625e+08 3300 0 
+1.35938e+06 137500 1.16982e-13 -2.60389e-11 2.11657e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+
+1.35938e+06 131250 3.31241e-12 -2.93353e-11 2.32206e+08 1238.9 0 1613 2.26875e+08 3300 0 
+1.40625e+06 131250 -1.30223e-11 4.37536e-12 2.33956e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+1.35938e+06 137500 1.16982e-13 -2.60389e-11 2.11657e+08 1152.92 0 1613 2.0625e+08 3300 0 
+1.40625e+06 137500 -1.45162e-11 4.87247e-12 2.12991e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+
+1.40625e+06 125000 -1.12669e-11 3.40467e-12 2.54851e+08 1324.87 0 1613 2.475e+08 3300 0 
+1.45312e+06 125000 -7.30239e-12 2.05167e-11 2.54994e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+1.40625e+06 131250 -1.30223e-11 4.37536e-12 2.33956e+08 1238.9 0 1613 2.26875e+08 3300 0 
+1.45312e+06 131250 -7.6345e-12 1.90747e-11 2.34127e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+
+1.45312e+06 125000 -7.30239e-12 2.05167e-11 2.54994e+08 1324.87 0 1613 2.475e+08 3300 0 
+1.5e+06 125000 0 0 2.54946e+08 1324.87 0 1613 2.475e+08 3300 0 
+
+1.45312e+06 131250 -7.6345e-12 1.90747e-11 2.34127e+08 1238.9 0 1613 2.26875e+08 3300 0 
+1.5e+06 131250 0 0 2.34029e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+
+1.40625e+06 131250 -1.30223e-11 4.37536e-12 2.33956e+08 1238.9 0 1613 2.26875e+08 3300 0 
+1.45312e+06 131250 -7.6345e-12 1.90747e-11 2.34127e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+1.40625e+06 137500 -1.45162e-11 4.87247e-12 2.12991e+08 1152.92 0 1613 2.0625e+08 3300 0 
+1.45312e+06 137500 -7.94686e-12 1.75985e-11 2.13247e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+
+1.45312e+06 131250 -7.6345e-12 1.90747e-11 2.34127e+08 1238.9 0 1613 2.26875e+08 3300 0 
+1.5e+06 131250 0 0 2.34029e+08 1238.9 0 1613 2.26875e+08 3300 0 
+
+1.45312e+06 137500 -7.94686e-12 1.75985e-11 2.13247e+08 1152.92 0 1613 2.0625e+08 3300 0 
+1.5e+06 137500 0 0 2.13084e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+
+1.3125e+06 137500 3.292e-11 -5.26141e-11 2.12542e+08 1505.65 1 1613 2.0625e+08 3300 0 
+1.35938e+06 137500 1.16982e-13 -2.60389e-11 2.11657e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+1.3125e+06 143750 3.10502e-11 -4.61144e-11 1.90965e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.35938e+06 143750 -3.00624e-12 -2.25915e-11 1.90903e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+
+1.35938e+06 137500 1.16982e-13 -2.60389e-11 2.11657e+08 1152.92 0 1613 2.0625e+08 3300 0 
+1.40625e+06 137500 -1.45162e-11 4.87247e-12 2.12991e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+1.35938e+06 143750 -3.00624e-12 -2.25915e-11 1.90903e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.40625e+06 143750 -1.57946e-11 5.01745e-12 1.92047e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+
+1.3125e+06 143750 3.10502e-11 -4.61144e-11 1.90965e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.35938e+06 143750 -3.00624e-12 -2.25915e-11 1.90903e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+1.3125e+06 150000 2.73872e-11 -3.87333e-11 1.69551e+08 980.966 0 1613 1.65e+08 3300 0 
+1.35938e+06 150000 -6.14707e-12 -1.94522e-11 1.70147e+08 980.966 0 1613 1.65e+08 3300 0 
+
+
+1.35938e+06 143750 -3.00624e-12 -2.25915e-11 1.90903e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.40625e+06 143750 -1.57946e-11 5.01745e-12 1.92047e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+1.35938e+06 150000 -6.14707e-12 -1.94522e-11 1.70147e+08 980.966 0 1613 1.65e+08 3300 0 
+1.40625e+06 150000 -1.68972e-11 4.92764e-12 1.71068e+08 980.966 0 1613 1.65e+08 3300 0 
+
+
+1.40625e+06 137500 -1.45162e-11 4.87247e-12 2.12991e+08 1152.92 0 1613 2.0625e+08 3300 0 
+1.45312e+06 137500 -7.94686e-12 1.75985e-11 2.13247e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+1.40625e+06 143750 -1.57946e-11 5.01745e-12 1.92047e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.45312e+06 143750 -8.23415e-12 1.60707e-11 1.92328e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+
+1.45312e+06 137500 -7.94686e-12 1.75985e-11 2.13247e+08 1152.92 0 1613 2.0625e+08 3300 0 
+1.5e+06 137500 0 0 2.13084e+08 1152.92 0 1613 2.0625e+08 3300 0 
+
+1.45312e+06 143750 -8.23415e-12 1.60707e-11 1.92328e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.5e+06 143750 0 0 1.9213e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+
+1.40625e+06 143750 -1.57946e-11 5.01745e-12 1.92047e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.45312e+06 143750 -8.23415e-12 1.60707e-11 1.92328e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+1.40625e+06 150000 -1.68972e-11 4.92764e-12 1.71068e+08 980.966 0 1613 1.65e+08 3300 0 
+1.45312e+06 150000 -8.49542e-12 1.44683e-11 1.71385e+08 980.966 0 1613 1.65e+08 3300 0 
+
+
+1.45312e+06 143750 -8.23415e-12 1.60707e-11 1.92328e+08 1066.94 0 1613 1.85625e+08 3300 0 
+1.5e+06 143750 0 0 1.9213e+08 1066.94 0 1613 1.85625e+08 3300 0 
+
+1.45312e+06 150000 -8.49542e-12 1.44683e-11 1.71385e+08 980.966 0 1613 1.65e+08 3300 0 
+1.5e+06 150000 0 0 1.71152e+08 980.966 0 1613 1.65e+08 3300 0 
+
+
+750000 150000 9.57058e-13 -1.44989e-13 1.73113e+08 1005.73 0 1613 1.65e+08 3300 0 
+796875 150000 9.41383e-13 5.52678e-14 1.73107e+08 1000.19 0 1613 1.65e+08 3300 0 
+
+750000 156250 1.08287e-12 -1.33188e-13 1.5222e+08 919.65 0 1613 1.44375e+08 3300 0 
+796875 156250 1.05758e-12 4.7116e-14 1.52211e+08 914.134 0 1613 1.44375e+08 3300 0 
+
+
+796875 150000 9.41383e-13 5.52678e-14 1.73107e+08 1000.19 0 1613 1.65e+08 3300 0 
+843750 150000 1.10085e-12 3.5564e-13 1.73101e+08 995.892 0 1613 1.65e+08 3300 0 
+
+796875 156250 1.05758e-12 4.7116e-14 1.52211e+08 914.134 0 1613 1.44375e+08 3300 0 
+843750 156250 1.22568e-12 3.17129e-13 1.52204e+08 909.852 0 1613 1.44375e+08 3300 0 
+
+
+750000 156250 1.08287e-12 -1.33188e-13 1.5222e+08 919.65 0 1613 1.44375e+08 3300 0 
+796875 156250 1.05758e-12 4.7116e-14 1.52211e+08 914.134 0 1613 1.44375e+08 3300 0 
+
+750000 162500 1.19823e-12 -1.177e-13 1.31293e+08 832.518 0 1613 1.2375e+08 3300 0 
+796875 162500 1.16356e-12 4.07054e-14 1.31282e+08 827.26 0 1613 1.2375e+08 3300 0 
+
+
+796875 156250 1.05758e-12 4.7116e-14 1.52211e+08 914.134 0 1613 1.44375e+08 3300 0 
+843750 156250 1.22568e-12 3.17129e-13 1.52204e+08 909.852 0 1613 1.44375e+08 3300 0 
+
+796875 162500 1.16356e-12 4.07054e-14 1.31282e+08 827.26 0 1613 1.2375e+08 3300 0 
+843750 162500 1.33867e-12 2.77593e-13 1.31272e+08 823.178 0 1613 1.2375e+08 3300 0 
+
+
+843750 150000 1.10085e-12 3.5564e-13 1.73101e+08 995.892 0 1613 1.65e+08 3300 0 
+890625 150000 1.54012e-12 8.4652e-13 1.73095e+08 992.554 0 1613 1.65e+08 3300 0 
+
+843750 156250 1.22568e-12 3.17129e-13 1.52204e+08 909.852 0 1613 1.44375e+08 3300 0 
+890625 156250 1.70135e-12 7.58087e-13 1.52196e+08 906.527 0 1613 1.44375e+08 3300 0 
+
+
+890625 150000 1.54012e-12 8.4652e-13 1.73095e+08 992.554 0 1613 1.65e+08 3300 0 
+937500 150000 2.44813e-12 1.67374e-12 1.73086e+08 989.962 0 1613 1.65e+08 3300 0 
+
+890625 156250 1.70135e-12 7.58087e-13 1.52196e+08 906.527 0 1613 1.44375e+08 3300 0 
+937500 156250 2.69194e-12 1.50112e-12 1.52185e+08 903.946 0 1613 1.44375e+08 3300 0 
+
+
+843750 156250 1.22568e-12 3.17129e-13 1.52204e+08 909.852 0 1613 1.44375e+08 3300 0 
+890625 156250 1.70135e-12 7.58087e-13 1.52196e+08 906.527 0 1613 1.44375e+08 3300 0 
+
+843750 162500 1.33867e-12 2.77593e-13 1.31272e+08 823.178 0 1613 1.2375e+08 3300 0 
+890625 162500 1.84617e-12 6.64178e-13 1.31262e+08 820.009 0 1613 1.2375e+08 3300 0 
+
+
+890625 156250 1.70135e-12 7.58087e-13 1.52196e+08 906.527 0 1613 1.44375e+08 3300 0 
+937500 156250 2.69194e-12 1.50112e-12 1.52185e+08 903.946 0 1613 1.44375e+08 3300 0 
+
+890625 162500 1.84617e-12 6.64178e-13 1.31262e+08 820.009 0 1613 1.2375e+08 3300 0 
+937500 162500 2.90973e-12 1.31565e-12 1.31251e+08 817.549 0 1613 1.2375e+08 3300 0 
+
+
+750000 162500 1.19823e-12 -1.177e-13 1.31293e+08 832.518 0 1613 1.2375e+08 3300 0 
+796875 162500 1.16356e-12 4.07054e-14 1.31282e+08 827.26 0 1613 1.2375e+08 3300 0 
+
+750000 168750 1.30067e-12 -1.05789e-13 1.10323e+08 744.385 0 1613 1.03125e+08 3300 0 
+796875 168750 1.25727e-12 2.89867e-14 1.1031e+08 739.609 0 1613 1.03125e+08 3300 0 
+
+
+796875 162500 1.16356e-12 4.07054e-14 1.31282e+08 827.26 0 1613 1.2375e+08 3300 0 
+843750 162500 1.33867e-12 2.77593e-13 1.31272e+08 823.178 0 1613 1.2375e+08 3300 0 
+
+796875 168750 1.25727e-12 2.89867e-14 1.1031e+08 739.609 0 1613 1.03125e+08 3300 0 
+843750 168750 1.43794e-12 2.30317e-13 1.10299e+08 735.902 0 1613 1.03125e+08 3300 0 
+
+
+750000 168750 1.30067e-12 -1.05789e-13 1.10323e+08 744.385 0 1613 1.03125e+08 3300 0 
+796875 168750 1.25727e-12 2.89867e-14 1.1031e+08 739.609 0 1613 1.03125e+08 3300 0 
+
+750000 175000 1.38794e-12 -7.11685e-14 8.93404e+07 655.343 0 1613 8.25e+07 3300 0 
+796875 175000 1.33682e-12 3.84825e-14 8.9325e+07 651.253 0 1613 8.25e+07 3300 0 
+
+
+796875 168750 1.25727e-12 2.89867e-14 1.1031e+08 739.609 0 1613 1.03125e+08 3300 0 
+843750 168750 1.43794e-12 2.30317e-13 1.10299e+08 735.902 0 1613 1.03125e+08 3300 0 
+
+796875 175000 1.33682e-12 3.84825e-14 8.9325e+07 651.253 0 1613 8.25e+07 3300 0 
+843750 175000 1.52173e-12 2.02202e-13 8.9312e+07 648.078 0 1613 8.25e+07 3300 0 
+
+
+843750 162500 1.33867e-12 2.77593e-13 1.31272e+08 823.178 0 1613 1.2375e+08 3300 0 
+890625 162500 1.84617e-12 6.64178e-13 1.31262e+08 820.009 0 1613 1.2375e+08 3300 0 
+
+843750 168750 1.43794e-12 2.30317e-13 1.10299e+08 735.902 0 1613 1.03125e+08 3300 0 
+890625 168750 1.97256e-12 5.58574e-13 1.10287e+08 733.024 0 1613 1.03125e+08 3300 0 
+
+
+890625 162500 1.84617e-12 6.64178e-13 1.31262e+08 820.009 0 1613 1.2375e+08 3300 0 
+937500 162500 2.90973e-12 1.31565e-12 1.31251e+08 817.549 0 1613 1.2375e+08 3300 0 
+
+890625 168750 1.97256e-12 5.58574e-13 1.10287e+08 733.024 0 1613 1.03125e+08 3300 0 
+937500 168750 3.09879e-12 1.11214e-12 1.10274e+08 730.789 0 1613 1.03125e+08 3300 0 
+
+
+843750 168750 1.43794e-12 2.30317e-13 1.10299e+08 735.902 0 1613 1.03125e+08 3300 0 
+890625 168750 1.97256e-12 5.58574e-13 1.10287e+08 733.024 0 1613 1.03125e+08 3300 0 
+
+843750 175000 1.52173e-12 2.02202e-13 8.9312e+07 648.078 0 1613 8.25e+07 3300 0 
+890625 175000 2.0787e-12 4.68661e-13 8.92993e+07 645.613 0 1613 8.25e+07 3300 0 
+
+
+890625 168750 1.97256e-12 5.58574e-13 1.10287e+08 733.024 0 1613 1.03125e+08 3300 0 
+937500 168750 3.09879e-12 1.11214e-12 1.10274e+08 730.789 0 1613 1.03125e+08 3300 0 
+
+890625 175000 2.0787e-12 4.68661e-13 8.92993e+07 645.613 0 1613 8.25e+07 3300 0 
+937500 175000 3.25674e-12 9.1929e-13 8.92851e+07 643.699 0 1613 8.25e+07 3300 0 
+
+
+937500 150000 2.44813e-12 1.67374e-12 1.73086e+08 989.962 0 1613 1.65e+08 3300 0 
+984375 150000 4.14268e-12 3.06504e-12 1.73072e+08 987.95 0 1613 1.65e+08 3300 0 
+
+937500 156250 2.69194e-12 1.50112e-12 1.52185e+08 903.946 0 1613 1.44375e+08 3300 0 
+984375 156250 4.54683e-12 2.75195e-12 1.52168e+08 901.943 0 1613 1.44375e+08 3300 0 
+
+
+984375 150000 4.14268e-12 3.06504e-12 1.73072e+08 987.95 0 1613 1.65e+08 3300 0 
+1.03125e+06 150000 7.12235e-12 5.31739e-12 1.73043e+08 986.387 0 1613 1.65e+08 3300 0 
+
+984375 156250 4.54683e-12 2.75195e-12 1.52168e+08 901.943 0 1613 1.44375e+08 3300 0 
+1.03125e+06 156250 7.82508e-12 4.78e-12 1.52139e+08 900.387 0 1613 1.44375e+08 3300 0 
+
+
+937500 156250 2.69194e-12 1.50112e-12 1.52185e+08 903.946 0 1613 1.44375e+08 3300 0 
+984375 156250 4.54683e-12 2.75195e-12 1.52168e+08 901.943 0 1613 1.44375e+08 3300 0 
+
+937500 162500 2.90973e-12 1.31565e-12 1.31251e+08 817.549 0 1613 1.2375e+08 3300 0 
+984375 162500 4.90712e-12 2.4128e-12 1.31231e+08 815.64 0 1613 1.2375e+08 3300 0 
+
+
+984375 156250 4.54683e-12 2.75195e-12 1.52168e+08 901.943 0 1613 1.44375e+08 3300 0 
+1.03125e+06 156250 7.82508e-12 4.78e-12 1.52139e+08 900.387 0 1613 1.44375e+08 3300 0 
+
+984375 162500 4.90712e-12 2.4128e-12 1.31231e+08 815.64 0 1613 1.2375e+08 3300 0 
+1.03125e+06 162500 8.45127e-12 4.1957e-12 1.31199e+08 814.157 0 1613 1.2375e+08 3300 0 
+
+
+1.03125e+06 150000 7.12235e-12 5.31739e-12 1.73043e+08 986.387 0 1613 1.65e+08 3300 0 
+1.07812e+06 150000 1.20476e-11 8.77721e-12 1.72989e+08 985.175 0 1613 1.65e+08 3300 0 
+
+1.03125e+06 156250 7.82508e-12 4.78e-12 1.52139e+08 900.387 0 1613 1.44375e+08 3300 0 
+1.07812e+06 156250 1.32709e-11 7.91171e-12 1.5207e+08 899.18 0 1613 1.44375e+08 3300 0 
+
+
+1.07812e+06 150000 1.20476e-11 8.77721e-12 1.72989e+08 985.175 0 1613 1.65e+08 3300 0 
+1.125e+06 150000 1.95723e-11 1.31917e-11 1.7287e+08 984.233 0 1613 1.65e+08 3300 0 
+
+1.07812e+06 156250 1.32709e-11 7.91171e-12 1.5207e+08 899.18 0 1613 1.44375e+08 3300 0 
+1.125e+06 156250 2.17507e-11 1.19384e-11 1.51964e+08 898.242 0 1613 1.44375e+08 3300 0 
+
+
+1.03125e+06 156250 7.82508e-12 4.78e-12 1.52139e+08 900.387 0 1613 1.44375e+08 3300 0 
+1.07812e+06 156250 1.32709e-11 7.91171e-12 1.5207e+08 899.18 0 1613 1.44375e+08 3300 0 
+
+1.03125e+06 162500 8.45127e-12 4.1957e-12 1.31199e+08 814.157 0 1613 1.2375e+08 3300 0 
+1.07812e+06 162500 1.43672e-11 6.95647e-12 1.31124e+08 813.006 0 1613 1.2375e+08 3300 0 
+
+
+1.07812e+06 156250 1.32709e-11 7.91171e-12 1.5207e+08 899.18 0 1613 1.44375e+08 3300 0 
+1.125e+06 156250 2.17507e-11 1.19384e-11 1.51964e+08 898.242 0 1613 1.44375e+08 3300 0 
+
+1.07812e+06 162500 1.43672e-11 6.95647e-12 1.31124e+08 813.006 0 1613 1.2375e+08 3300 0 
+1.125e+06 162500 2.37096e-11 1.05451e-11 1.31007e+08 812.113 0 1613 1.2375e+08 3300 0 
+
+
+937500 162500 2.90973e-12 1.31565e-12 1.31251e+08 817.549 0 1613 1.2375e+08 3300 0 
+984375 162500 4.90712e-12 2.4128e-12 1.31231e+08 815.64 0 1613 1.2375e+08 3300 0 
+
+937500 168750 3.09879e-12 1.11214e-12 1.10274e+08 730.789 0 1613 1.03125e+08 3300 0 
+984375 168750 5.2196e-12 2.04347e-12 1.10252e+08 729.055 0 1613 1.03125e+08 3300 0 
+
+
+984375 162500 4.90712e-12 2.4128e-12 1.31231e+08 815.64 0 1613 1.2375e+08 3300 0 
+1.03125e+06 162500 8.45127e-12 4.1957e-12 1.31199e+08 814.157 0 1613 1.2375e+08 3300 0 
+
+984375 168750 5.2196e-12 2.04347e-12 1.10252e+08 729.055 0 1613 1.03125e+08 3300 0 
+1.03125e+06 168750 8.99323e-12 3.56446e-12 1.1022e+08 727.708 0 1613 1.03125e+08 3300 0 
+
+
+937500 168750 3.09879e-12 1.11214e-12 1.10274e+08 730.789 0 1613 1.03125e+08 3300 0 
+984375 168750 5.2196e-12 2.04347e-12 1.10252e+08 729.055 0 1613 1.03125e+08 3300 0 
+
+937500 175000 3.25674e-12 9.1929e-13 8.92851e+07 643.699 0 1613 8.25e+07 3300 0 
+984375 175000 5.48085e-12 1.67306e-12 8.92614e+07 642.214 0 1613 8.25e+07 3300 0 
+
+
+984375 168750 5.2196e-12 2.04347e-12 1.10252e+08 729.055 0 1613 1.03125e+08 3300 0 
+1.03125e+06 168750 8.99323e-12 3.56446e-12 1.1022e+08 727.708 0 1613 1.03125e+08 3300 0 
+
+984375 175000 5.48085e-12 1.67306e-12 8.92614e+07 642.214 0 1613 8.25e+07 3300 0 
+1.03125e+06 175000 9.44412e-12 2.92291e-12 8.92289e+07 641.06 0 1613 8.25e+07 3300 0 
+
+
+1.03125e+06 162500 8.45127e-12 4.1957e-12 1.31199e+08 814.157 0 1613 1.2375e+08 3300 0 
+1.07812e+06 162500 1.43672e-11 6.95647e-12 1.31124e+08 813.006 0 1613 1.2375e+08 3300 0 
+
+1.03125e+06 168750 8.99323e-12 3.56446e-12 1.1022e+08 727.708 0 1613 1.03125e+08 3300 0 
+1.07812e+06 168750 1.53236e-11 5.90891e-12 1.1013e+08 726.663 0 1613 1.03125e+08 3300 0 
+
+
+1.07812e+06 162500 1.43672e-11 6.95647e-12 1.31124e+08 813.006 0 1613 1.2375e+08 3300 0 
+1.125e+06 162500 2.37096e-11 1.05451e-11 1.31007e+08 812.113 0 1613 1.2375e+08 3300 0 
+
+1.07812e+06 168750 1.53236e-11 5.90891e-12 1.1013e+08 726.663 0 1613 1.03125e+08 3300 0 
+1.125e+06 168750 2.54073e-11 9.03303e-12 1.10037e+08 725.851 0 1613 1.03125e+08 3300 0 
+
+
+1.03125e+06 168750 8.99323e-12 3.56446e-12 1.1022e+08 727.708 0 1613 1.03125e+08 3300 0 
+1.07812e+06 168750 1.53236e-11 5.90891e-12 1.1013e+08 726.663 0 1613 1.03125e+08 3300 0 
+
+1.03125e+06 175000 9.44412e-12 2.92291e-12 8.92289e+07 641.06 0 1613 8.25e+07 3300 0 
+1.07812e+06 175000 1.61308e-11 4.79159e-12 8.91266e+07 640.165 0 1613 8.25e+07 3300 0 
+
+
+1.07812e+06 168750 1.53236e-11 5.90891e-12 1.1013e+08 726.663 0 1613 1.03125e+08 3300 0 
+1.125e+06 168750 2.54073e-11 9.03303e-12 1.10037e+08 725.851 0 1613 1.03125e+08 3300 0 
+
+1.07812e+06 175000 1.61308e-11 4.79159e-12 8.91266e+07 640.165 0 1613 8.25e+07 3300 0 
+1.125e+06 175000 2.68119e-11 7.499e-12 8.90533e+07 639.47 0 1613 8.25e+07 3300 0 
+
+
+750000 175000 1.38794e-12 -7.11685e-14 8.93404e+07 655.343 0 1613 8.25e+07 3300 0 
+796875 175000 1.33682e-12 3.84825e-14 8.9325e+07 651.253 0 1613 8.25e+07 3300 0 
+
+750000 181250 1.45803e-12 -1.1306e-13 6.8234e+07 565.523 0 1613 6.1875e+07 3300 0 
+796875 181250 1.40054e-12 -2.97374e-14 6.8217e+07 562.292 0 1613 6.1875e+07 3300 0 
+
+
+796875 175000 1.33682e-12 3.84825e-14 8.9325e+07 651.253 0 1613 8.25e+07 3300 0 
+843750 175000 1.52173e-12 2.02202e-13 8.9312e+07 648.078 0 1613 8.25e+07 3300 0 
+
+796875 181250 1.40054e-12 -2.97374e-14 6.8217e+07 562.292 0 1613 6.1875e+07 3300 0 
+843750 181250 1.58856e-12 9.46114e-14 6.82025e+07 559.784 0 1613 6.1875e+07 3300 0 
+
+
+750000 181250 1.45803e-12 -1.1306e-13 6.8234e+07 565.523 0 1613 6.1875e+07 3300 0 
+796875 181250 1.40054e-12 -2.97374e-14 6.8217e+07 562.292 0 1613 6.1875e+07 3300 0 
+
+750000 187500 1.50933e-12 1.37426e-13 4.7413e+07 475.088 0 1613 4.125e+07 3300 0 
+796875 187500 1.44707e-12 1.93518e-13 4.73948e+07 472.854 0 1613 4.125e+07 3300 0 
+
+
+796875 181250 1.40054e-12 -2.97374e-14 6.8217e+07 562.292 0 1613 6.1875e+07 3300 0 
+843750 181250 1.58856e-12 9.46114e-14 6.82025e+07 559.784 0 1613 6.1875e+07 3300 0 
+
+796875 187500 1.44707e-12 1.93518e-13 4.73948e+07 472.854 0 1613 4.125e+07 3300 0 
+843750 187500 1.6372e-12 2.77086e-13 4.73794e+07 471.121 0 1613 4.125e+07 3300 0 
+
+
+843750 175000 1.52173e-12 2.02202e-13 8.9312e+07 648.078 0 1613 8.25e+07 3300 0 
+890625 175000 2.0787e-12 4.68661e-13 8.92993e+07 645.613 0 1613 8.25e+07 3300 0 
+
+843750 181250 1.58856e-12 9.46114e-14 6.82025e+07 559.784 0 1613 6.1875e+07 3300 0 
+890625 181250 2.16301e-12 2.9675e-13 6.8189e+07 557.837 0 1613 6.1875e+07 3300 0 
+
+
+890625 175000 2.0787e-12 4.68661e-13 8.92993e+07 645.613 0 1613 8.25e+07 3300 0 
+937500 175000 3.25674e-12 9.1929e-13 8.92851e+07 643.699 0 1613 8.25e+07 3300 0 
+
+890625 181250 2.16301e-12 2.9675e-13 6.8189e+07 557.837 0 1613 6.1875e+07 3300 0 
+937500 181250 3.38161e-12 6.39213e-13 6.8173e+07 556.326 0 1613 6.1875e+07 3300 0 
+
+
+843750 181250 1.58856e-12 9.46114e-14 6.82025e+07 559.784 0 1613 6.1875e+07 3300 0 
+890625 181250 2.16301e-12 2.9675e-13 6.8189e+07 557.837 0 1613 6.1875e+07 3300 0 
+
+843750 187500 1.6372e-12 2.77086e-13 4.73794e+07 471.121 0 1613 4.125e+07 3300 0 
+890625 187500 2.22417e-12 4.13239e-13 4.73651e+07 469.775 0 1613 4.125e+07 3300 0 
+
+
+890625 181250 2.16301e-12 2.9675e-13 6.8189e+07 557.837 0 1613 6.1875e+07 3300 0 
+937500 181250 3.38161e-12 6.39213e-13 6.8173e+07 556.326 0 1613 6.1875e+07 3300 0 
+
+890625 187500 2.22417e-12 4.13239e-13 4.73651e+07 469.775 0 1613 4.125e+07 3300 0 
+937500 187500 3.47197e-12 6.42611e-13 4.7348e+07 468.73 0 1613 4.125e+07 3300 0 
+
+
+750000 187500 1.50933e-12 1.37426e-13 4.7413e+07 475.088 0 1613 4.125e+07 3300 0 
+796875 187500 1.44707e-12 1.93518e-13 4.73948e+07 472.854 0 1613 4.125e+07 3300 0 
+
+750000 193750 1.54061e-12 -1.28374e-13 2.36312e+07 384.227 1 1613 2.0625e+07 3300 0 
+796875 193750 1.4754e-12 -1.00172e-13 2.36122e+07 383.086 1 1613 2.0625e+07 3300 0 
+
+
+796875 187500 1.44707e-12 1.93518e-13 4.73948e+07 472.854 0 1613 4.125e+07 3300 0 
+843750 187500 1.6372e-12 2.77086e-13 4.73794e+07 471.121 0 1613 4.125e+07 3300 0 
+
+796875 193750 1.4754e-12 -1.00172e-13 2.36122e+07 383.086 1 1613 2.0625e+07 3300 0 
+843750 193750 1.66677e-12 -5.81574e-14 2.35963e+07 382.201 1 1613 2.0625e+07 3300 0 
+
+
+750000 193750 1.54061e-12 -1.28374e-13 2.36312e+07 384.227 1 1613 2.0625e+07 3300 0 
+796875 193750 1.4754e-12 -1.00172e-13 2.36122e+07 383.086 1 1613 2.0625e+07 3300 0 
+
+750000 200000 1.55112e-12 0 -848583 293.15 1 1613 0 3300 0 
+796875 200000 1.48492e-12 0 -867774 293.15 1 1613 0 3300 0 
+
+
+796875 193750 1.4754e-12 -1.00172e-13 2.36122e+07 383.086 1 1613 2.0625e+07 3300 0 
+843750 193750 1.66677e-12 -5.81574e-14 2.35963e+07 382.201 1 1613 2.0625e+07 3300 0 
+
+796875 200000 1.48492e-12 0 -867774 293.15 1 1613 0 3300 0 
+843750 200000 1.67668e-12 0 -883984 293.15 1 1613 0 3300 0 
+
+
+843750 187500 1.6372e-12 2.77086e-13 4.73794e+07 471.121 0 1613 4.125e+07 3300 0 
+890625 187500 2.22417e-12 4.13239e-13 4.73651e+07 469.775 0 1613 4.125e+07 3300 0 
+
+843750 193750 1.66677e-12 -5.81574e-14 2.35963e+07 382.201 1 1613 2.0625e+07 3300 0 
+890625 193750 2.26123e-12 1.02336e-14 2.35812e+07 381.513 1 1613 2.0625e+07 3300 0 
+
+
+890625 187500 2.22417e-12 4.13239e-13 4.73651e+07 469.775 0 1613 4.125e+07 3300 0 
+937500 187500 3.47197e-12 6.42611e-13 4.7348e+07 468.73 0 1613 4.125e+07 3300 0 
+
+890625 193750 2.26123e-12 1.02336e-14 2.35812e+07 381.513 1 1613 2.0625e+07 3300 0 
+937500 193750 3.52672e-12 1.25637e-13 2.35648e+07 380.979 1 1613 2.0625e+07 3300 0 
+
+
+843750 193750 1.66677e-12 -5.81574e-14 2.35963e+07 382.201 1 1613 2.0625e+07 3300 0 
+890625 193750 2.26123e-12 1.02336e-14 2.35812e+07 381.513 1 1613 2.0625e+07 3300 0 
+
+843750 200000 1.67668e-12 0 -883984 293.15 1 1613 0 3300 0 
+890625 200000 2.27366e-12 0 -898872 293.15 1 1613 0 3300 0 
+
+
+890625 193750 2.26123e-12 1.02336e-14 2.35812e+07 381.513 1 1613 2.0625e+07 3300 0 
+937500 193750 3.52672e-12 1.25637e-13 2.35648e+07 380.979 1 1613 2.0625e+07 3300 0 
+
+890625 200000 2.27366e-12 0 -898872 293.15 1 1613 0 3300 0 
+937500 200000 3.545e-12 0 -916842 293.15 1 1613 0 3300 0 
+
+
+937500 175000 3.25674e-12 9.1929e-13 8.92851e+07 643.699 0 1613 8.25e+07 3300 0 
+984375 175000 5.48085e-12 1.67306e-12 8.92614e+07 642.214 0 1613 8.25e+07 3300 0 
+
+937500 181250 3.38161e-12 6.39213e-13 6.8173e+07 556.326 0 1613 6.1875e+07 3300 0 
+984375 181250 5.6878e-12 1.20998e-12 6.81509e+07 555.153 0 1613 6.1875e+07 3300 0 
+
+
+984375 175000 5.48085e-12 1.67306e-12 8.92614e+07 642.214 0 1613 8.25e+07 3300 0 
+1.03125e+06 175000 9.44412e-12 2.92291e-12 8.92289e+07 641.06 0 1613 8.25e+07 3300 0 
+
+984375 181250 5.6878e-12 1.20998e-12 6.81509e+07 555.153 0 1613 6.1875e+07 3300 0 
+1.03125e+06 181250 9.79875e-12 2.16552e-12 6.81063e+07 554.242 0 1613 6.1875e+07 3300 0 
+
+
+937500 181250 3.38161e-12 6.39213e-13 6.8173e+07 556.326 0 1613 6.1875e+07 3300 0 
+984375 181250 5.6878e-12 1.20998e-12 6.81509e+07 555.153 0 1613 6.1875e+07 3300 0 
+
+937500 187500 3.47197e-12 6.42611e-13 4.7348e+07 468.73 0 1613 4.125e+07 3300 0 
+984375 187500 5.83733e-12 1.02978e-12 4.73264e+07 467.919 0 1613 4.125e+07 3300 0 
+
+
+984375 181250 5.6878e-12 1.20998e-12 6.81509e+07 555.153 0 1613 6.1875e+07 3300 0 
+1.03125e+06 181250 9.79875e-12 2.16552e-12 6.81063e+07 554.242 0 1613 6.1875e+07 3300 0 
+
+984375 187500 5.83733e-12 1.02978e-12 4.73264e+07 467.919 0 1613 4.125e+07 3300 0 
+1.03125e+06 187500 1.00547e-11 1.66052e-12 4.72753e+07 467.289 0 1613 4.125e+07 3300 0 
+
+
+1.03125e+06 175000 9.44412e-12 2.92291e-12 8.92289e+07 641.06 0 1613 8.25e+07 3300 0 
+1.07812e+06 175000 1.61308e-11 4.79159e-12 8.91266e+07 640.165 0 1613 8.25e+07 3300 0 
+
+1.03125e+06 181250 9.79875e-12 2.16552e-12 6.81063e+07 554.242 0 1613 6.1875e+07 3300 0 
+1.07812e+06 181250 1.67762e-11 3.56548e-12 6.80387e+07 553.535 0 1613 6.1875e+07 3300 0 
+
+
+1.07812e+06 175000 1.61308e-11 4.79159e-12 8.91266e+07 640.165 0 1613 8.25e+07 3300 0 
+1.125e+06 175000 2.68119e-11 7.499e-12 8.90533e+07 639.47 0 1613 8.25e+07 3300 0 
+
+1.07812e+06 181250 1.67762e-11 3.56548e-12 6.80387e+07 553.535 0 1613 6.1875e+07 3300 0 
+1.125e+06 181250 2.78992e-11 5.67927e-12 6.78153e+07 552.986 0 1613 6.1875e+07 3300 0 
+
+
+1.03125e+06 181250 9.79875e-12 2.16552e-12 6.81063e+07 554.242 0 1613 6.1875e+07 3300 0 
+1.07812e+06 181250 1.67762e-11 3.56548e-12 6.80387e+07 553.535 0 1613 6.1875e+07 3300 0 
+
+1.03125e+06 187500 1.00547e-11 1.66052e-12 4.72753e+07 467.289 0 1613 4.125e+07 3300 0 
+1.07812e+06 187500 1.72408e-11 2.64868e-12 4.72246e+07 466.8 0 1613 4.125e+07 3300 0 
+
+
+1.07812e+06 181250 1.67762e-11 3.56548e-12 6.80387e+07 553.535 0 1613 6.1875e+07 3300 0 
+1.125e+06 181250 2.78992e-11 5.67927e-12 6.78153e+07 552.986 0 1613 6.1875e+07 3300 0 
+
+1.07812e+06 187500 1.72408e-11 2.64868e-12 4.72246e+07 466.8 0 1613 4.125e+07 3300 0 
+1.125e+06 187500 2.86781e-11 3.8872e-12 4.69225e+07 466.421 0 1613 4.125e+07 3300 0 
+
+
+937500 187500 3.47197e-12 6.42611e-13 4.7348e+07 468.73 0 1613 4.125e+07 3300 0 
+984375 187500 5.83733e-12 1.02978e-12 4.73264e+07 467.919 0 1613 4.125e+07 3300 0 
+
+937500 193750 3.52672e-12 1.25637e-13 2.35648e+07 380.979 1 1613 2.0625e+07 3300 0 
+984375 193750 5.9276e-12 3.19763e-13 2.3538e+07 380.565 1 1613 2.0625e+07 3300 0 
+
+
+984375 187500 5.83733e-12 1.02978e-12 4.73264e+07 467.919 0 1613 4.125e+07 3300 0 
+1.03125e+06 187500 1.00547e-11 1.66052e-12 4.72753e+07 467.289 0 1613 4.125e+07 3300 0 
+
+984375 193750 5.9276e-12 3.19763e-13 2.3538e+07 380.565 1 1613 2.0625e+07 3300 0 
+1.03125e+06 193750 1.02106e-11 6.38757e-13 2.35038e+07 380.243 1 1613 2.0625e+07 3300 0 
+
+
+937500 193750 3.52672e-12 1.25637e-13 2.35648e+07 380.979 1 1613 2.0625e+07 3300 0 
+984375 193750 5.9276e-12 3.19763e-13 2.3538e+07 380.565 1 1613 2.0625e+07 3300 0 
+
+937500 200000 3.545e-12 0 -916842 293.15 1 1613 0 3300 0 
+984375 200000 5.95792e-12 0 -938398 293.15 1 1613 0 3300 0 
+
+
+984375 193750 5.9276e-12 3.19763e-13 2.3538e+07 380.565 1 1613 2.0625e+07 3300 0 
+1.03125e+06 193750 1.02106e-11 6.38757e-13 2.35038e+07 380.243 1 1613 2.0625e+07 3300 0 
+
+984375 200000 5.95792e-12 0 -938398 293.15 1 1613 0 3300 0 
+1.03125e+06 200000 1.02618e-11 0 -993200 293.15 1 1613 0 3300 0 
+
+
+1.03125e+06 187500 1.00547e-11 1.66052e-12 4.72753e+07 467.289 0 1613 4.125e+07 3300 0 
+1.07812e+06 187500 1.72408e-11 2.64868e-12 4.72246e+07 466.8 0 1613 4.125e+07 3300 0 
+
+1.03125e+06 193750 1.02106e-11 6.38757e-13 2.35038e+07 380.243 1 1613 2.0625e+07 3300 0 
+1.07812e+06 193750 1.75209e-11 1.12868e-12 2.33855e+07 379.994 1 1613 2.0625e+07 3300 0 
+
+
+1.07812e+06 187500 1.72408e-11 2.64868e-12 4.72246e+07 466.8 0 1613 4.125e+07 3300 0 
+1.125e+06 187500 2.86781e-11 3.8872e-12 4.69225e+07 466.421 0 1613 4.125e+07 3300 0 
+
+1.07812e+06 193750 1.75209e-11 1.12868e-12 2.33855e+07 379.994 1 1613 2.0625e+07 3300 0 
+1.125e+06 193750 2.91729e-11 1.76779e-12 2.33245e+07 379.8 1 1613 2.0625e+07 3300 0 
+
+
+1.03125e+06 193750 1.02106e-11 6.38757e-13 2.35038e+07 380.243 1 1613 2.0625e+07 3300 0 
+1.07812e+06 193750 1.75209e-11 1.12868e-12 2.33855e+07 379.994 1 1613 2.0625e+07 3300 0 
+
+1.03125e+06 200000 1.02618e-11 0 -993200 293.15 1 1613 0 3300 0 
+1.07812e+06 200000 1.76134e-11 0 -1.03627e+06 293.15 1 1613 0 3300 0 
+
+
+1.07812e+06 193750 1.75209e-11 1.12868e-12 2.33855e+07 379.994 1 1613 2.0625e+07 3300 0 
+1.125e+06 193750 2.91729e-11 1.76779e-12 2.33245e+07 379.8 1 1613 2.0625e+07 3300 0 
+
+1.07812e+06 200000 1.76134e-11 0 -1.03627e+06 293.15 1 1613 0 3300 0 
+1.125e+06 200000 2.93055e-11 0 -1.38062e+06 293.15 1 1613 0 3300 0 
+
+
+1.125e+06 150000 1.95723e-11 1.31917e-11 1.7287e+08 984.233 0 1613 1.65e+08 3300 0 
+1.17188e+06 150000 2.88902e-11 1.63621e-11 1.72652e+08 955.22 0 1613 1.65e+08 3300 0 
+
+1.125e+06 156250 2.17507e-11 1.19384e-11 1.51964e+08 898.242 0 1613 1.44375e+08 3300 0 
+1.17188e+06 156250 3.24029e-11 1.5014e-11 1.51602e+08 868.46 0 1613 1.44375e+08 3300 0 
+
+
+1.17188e+06 150000 2.88902e-11 1.63621e-11 1.72652e+08 955.22 0 1613 1.65e+08 3300 0 
+1.21875e+06 150000 3.6941e-11 7.04024e-12 1.72263e+08 835.745 0 1613 1.65e+08 3300 0 
+
+1.17188e+06 156250 3.24029e-11 1.5014e-11 1.51602e+08 868.46 0 1613 1.44375e+08 3300 0 
+1.21875e+06 156250 4.20466e-11 6.23232e-12 1.51496e+08 781.181 0 1613 1.44375e+08 3300 0 
+
+
+1.125e+06 156250 2.17507e-11 1.19384e-11 1.51964e+08 898.242 0 1613 1.44375e+08 3300 0 
+1.17188e+06 156250 3.24029e-11 1.5014e-11 1.51602e+08 868.46 0 1613 1.44375e+08 3300 0 
+
+1.125e+06 162500 2.37096e-11 1.05451e-11 1.31007e+08 812.113 0 1613 1.2375e+08 3300 0 
+1.17188e+06 162500 3.56816e-11 1.34056e-11 1.30595e+08 781.923 0 1613 1.2375e+08 3300 0 
+
+
+1.17188e+06 156250 3.24029e-11 1.5014e-11 1.51602e+08 868.46 0 1613 1.44375e+08 3300 0 
+1.21875e+06 156250 4.20466e-11 6.23232e-12 1.51496e+08 781.181 0 1613 1.44375e+08 3300 0 
+
+1.17188e+06 162500 3.56816e-11 1.34056e-11 1.30595e+08 781.923 0 1613 1.2375e+08 3300 0 
+1.21875e+06 162500 4.67583e-11 5.31934e-12 1.30413e+08 757.482 0 1613 1.2375e+08 3300 0 
+
+
+1.21875e+06 150000 3.6941e-11 7.04024e-12 1.72263e+08 835.745 0 1613 1.65e+08 3300 0 
+1.26562e+06 150000 4.27184e-11 -1.90225e-11 1.72296e+08 977.844 0 1613 1.65e+08 3300 0 
+
+1.21875e+06 156250 4.20466e-11 6.23232e-12 1.51496e+08 781.181 0 1613 1.44375e+08 3300 0 
+1.26562e+06 156250 4.75322e-11 -2.08488e-11 1.50292e+08 1096.01 0 1613 1.44375e+08 3300 0 
+
+
+1.26562e+06 150000 4.27184e-11 -1.90225e-11 1.72296e+08 977.844 0 1613 1.65e+08 3300 0 
+1.3125e+06 150000 2.73872e-11 -3.87333e-11 1.69551e+08 980.966 0 1613 1.65e+08 3300 0 
+
+1.26562e+06 156250 4.75322e-11 -2.08488e-11 1.50292e+08 1096.01 0 1613 1.44375e+08 3300 0 
+1.3125e+06 156250 2.29286e-11 -3.34457e-11 1.47451e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+
+1.21875e+06 156250 4.20466e-11 6.23232e-12 1.51496e+08 781.181 0 1613 1.44375e+08 3300 0 
+1.26562e+06 156250 4.75322e-11 -2.08488e-11 1.50292e+08 1096.01 0 1613 1.44375e+08 3300 0 
+
+1.21875e+06 162500 4.67583e-11 5.31934e-12 1.30413e+08 757.482 0 1613 1.2375e+08 3300 0 
+1.26562e+06 162500 5.0385e-11 -2.3754e-11 1.29303e+08 1263.64 1 1613 1.2375e+08 3300 0 
+
+
+1.26562e+06 156250 4.75322e-11 -2.08488e-11 1.50292e+08 1096.01 0 1613 1.44375e+08 3300 0 
+1.3125e+06 156250 2.29286e-11 -3.34457e-11 1.47451e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+1.26562e+06 162500 5.0385e-11 -2.3754e-11 1.29303e+08 1263.64 1 1613 1.2375e+08 3300 0 
+1.3125e+06 162500 1.91511e-11 -2.95896e-11 1.26487e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+
+1.125e+06 162500 2.37096e-11 1.05451e-11 1.31007e+08 812.113 0 1613 1.2375e+08 3300 0 
+1.17188e+06 162500 3.56816e-11 1.34056e-11 1.30595e+08 781.923 0 1613 1.2375e+08 3300 0 
+
+1.125e+06 168750 2.54073e-11 9.03303e-12 1.10037e+08 725.851 0 1613 1.03125e+08 3300 0 
+1.17188e+06 168750 3.86748e-11 1.14631e-11 1.09459e+08 696.761 0 1613 1.03125e+08 3300 0 
+
+
+1.17188e+06 162500 3.56816e-11 1.34056e-11 1.30595e+08 781.923 0 1613 1.2375e+08 3300 0 
+1.21875e+06 162500 4.67583e-11 5.31934e-12 1.30413e+08 757.482 0 1613 1.2375e+08 3300 0 
+
+1.17188e+06 168750 3.86748e-11 1.14631e-11 1.09459e+08 696.761 0 1613 1.03125e+08 3300 0 
+1.21875e+06 168750 5.10001e-11 4.49115e-12 1.09661e+08 788.248 0 1613 1.03125e+08 3300 0 
+
+
+1.125e+06 168750 2.54073e-11 9.03303e-12 1.10037e+08 725.851 0 1613 1.03125e+08 3300 0 
+1.17188e+06 168750 3.86748e-11 1.14631e-11 1.09459e+08 696.761 0 1613 1.03125e+08 3300 0 
+
+1.125e+06 175000 2.68119e-11 7.499e-12 8.90533e+07 639.47 0 1613 8.25e+07 3300 0 
+1.17188e+06 175000 4.13996e-11 9.03056e-12 8.83302e+07 618.828 0 1613 8.25e+07 3300 0 
+
+
+1.17188e+06 168750 3.86748e-11 1.14631e-11 1.09459e+08 696.761 0 1613 1.03125e+08 3300 0 
+1.21875e+06 168750 5.10001e-11 4.49115e-12 1.09661e+08 788.248 0 1613 1.03125e+08 3300 0 
+
+1.17188e+06 175000 4.13996e-11 9.03056e-12 8.83302e+07 618.828 0 1613 8.25e+07 3300 0 
+1.21875e+06 175000 5.51087e-11 4.32485e-12 8.8769e+07 901.621 0 1613 8.25e+07 3300 0 
+
+
+1.21875e+06 162500 4.67583e-11 5.31934e-12 1.30413e+08 757.482 0 1613 1.2375e+08 3300 0 
+1.26562e+06 162500 5.0385e-11 -2.3754e-11 1.29303e+08 1263.64 1 1613 1.2375e+08 3300 0 
+
+1.21875e+06 168750 5.10001e-11 4.49115e-12 1.09661e+08 788.248 0 1613 1.03125e+08 3300 0 
+1.26562e+06 168750 5.13094e-11 -2.29831e-11 1.07008e+08 1472.3 1 1613 1.03125e+08 3300 0 
+
+
+1.26562e+06 162500 5.0385e-11 -2.3754e-11 1.29303e+08 1263.64 1 1613 1.2375e+08 3300 0 
+1.3125e+06 162500 1.91511e-11 -2.95896e-11 1.26487e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+1.26562e+06 168750 5.13094e-11 -2.29831e-11 1.07008e+08 1472.3 1 1613 1.03125e+08 3300 0 
+1.3125e+06 168750 1.61875e-11 -2.51814e-11 1.05889e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+
+1.21875e+06 168750 5.10001e-11 4.49115e-12 1.09661e+08 788.248 0 1613 1.03125e+08 3300 0 
+1.26562e+06 168750 5.13094e-11 -2.29831e-11 1.07008e+08 1472.3 1 1613 1.03125e+08 3300 0 
+
+1.21875e+06 175000 5.51087e-11 4.32485e-12 8.8769e+07 901.621 0 1613 8.25e+07 3300 0 
+1.26562e+06 175000 5.04734e-11 -1.77091e-11 8.48946e+07 637.058 0 1613 8.25e+07 3300 0 
+
+
+1.26562e+06 168750 5.13094e-11 -2.29831e-11 1.07008e+08 1472.3 1 1613 1.03125e+08 3300 0 
+1.3125e+06 168750 1.61875e-11 -2.51814e-11 1.05889e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+1.26562e+06 175000 5.04734e-11 -1.77091e-11 8.48946e+07 637.058 0 1613 8.25e+07 3300 0 
+1.3125e+06 175000 1.3617e-11 -2.01393e-11 8.51063e+07 637.058 0 1613 8.25e+07 3300 0 
+
+
+1.3125e+06 150000 2.73872e-11 -3.87333e-11 1.69551e+08 980.966 0 1613 1.65e+08 3300 0 
+1.35938e+06 150000 -6.14707e-12 -1.94522e-11 1.70147e+08 980.966 0 1613 1.65e+08 3300 0 
+
+1.3125e+06 156250 2.29286e-11 -3.34457e-11 1.47451e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.35938e+06 156250 -9.00717e-12 -1.62272e-11 1.49519e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+
+1.35938e+06 150000 -6.14707e-12 -1.94522e-11 1.70147e+08 980.966 0 1613 1.65e+08 3300 0 
+1.40625e+06 150000 -1.68972e-11 4.92764e-12 1.71068e+08 980.966 0 1613 1.65e+08 3300 0 
+
+1.35938e+06 156250 -9.00717e-12 -1.62272e-11 1.49519e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.40625e+06 156250 -1.78311e-11 4.58177e-12 1.50019e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+
+1.3125e+06 156250 2.29286e-11 -3.34457e-11 1.47451e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.35938e+06 156250 -9.00717e-12 -1.62272e-11 1.49519e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+1.3125e+06 162500 1.91511e-11 -2.95896e-11 1.26487e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.35938e+06 162500 -1.13547e-11 -1.29814e-11 1.28548e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+
+1.35938e+06 156250 -9.00717e-12 -1.62272e-11 1.49519e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.40625e+06 156250 -1.78311e-11 4.58177e-12 1.50019e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+1.35938e+06 162500 -1.13547e-11 -1.29814e-11 1.28548e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.40625e+06 162500 -1.86344e-11 4.04524e-12 1.29029e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+
+1.40625e+06 150000 -1.68972e-11 4.92764e-12 1.71068e+08 980.966 0 1613 1.65e+08 3300 0 
+1.45312e+06 150000 -8.49542e-12 1.44683e-11 1.71385e+08 980.966 0 1613 1.65e+08 3300 0 
+
+1.40625e+06 156250 -1.78311e-11 4.58177e-12 1.50019e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.45312e+06 156250 -8.72417e-12 1.28296e-11 1.50431e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+
+1.45312e+06 150000 -8.49542e-12 1.44683e-11 1.71385e+08 980.966 0 1613 1.65e+08 3300 0 
+1.5e+06 150000 0 0 1.71152e+08 980.966 0 1613 1.65e+08 3300 0 
+
+1.45312e+06 156250 -8.72417e-12 1.28296e-11 1.50431e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.5e+06 156250 0 0 1.50142e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+
+1.40625e+06 156250 -1.78311e-11 4.58177e-12 1.50019e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.45312e+06 156250 -8.72417e-12 1.28296e-11 1.50431e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+1.40625e+06 162500 -1.86344e-11 4.04524e-12 1.29029e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.45312e+06 162500 -8.91533e-12 1.11508e-11 1.29426e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+
+1.45312e+06 156250 -8.72417e-12 1.28296e-11 1.50431e+08 894.989 0 1613 1.44375e+08 3300 0 
+1.5e+06 156250 0 0 1.50142e+08 894.989 0 1613 1.44375e+08 3300 0 
+
+1.45312e+06 162500 -8.91533e-12 1.11508e-11 1.29426e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.5e+06 162500 0 0 1.29128e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+
+1.3125e+06 162500 1.91511e-11 -2.95896e-11 1.26487e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.35938e+06 162500 -1.13547e-11 -1.29814e-11 1.28548e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+1.3125e+06 168750 1.61875e-11 -2.51814e-11 1.05889e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.35938e+06 168750 -1.32033e-11 -1.01998e-11 1.0744e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+
+1.35938e+06 162500 -1.13547e-11 -1.29814e-11 1.28548e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.40625e+06 162500 -1.86344e-11 4.04524e-12 1.29029e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+1.35938e+06 168750 -1.32033e-11 -1.01998e-11 1.0744e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.40625e+06 168750 -1.93272e-11 3.46228e-12 1.0804e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+
+1.3125e+06 168750 1.61875e-11 -2.51814e-11 1.05889e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.35938e+06 168750 -1.32033e-11 -1.01998e-11 1.0744e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+1.3125e+06 175000 1.3617e-11 -2.01393e-11 8.51063e+07 637.058 0 1613 8.25e+07 3300 0 
+1.35938e+06 175000 -1.46536e-11 -7.83667e-12 8.63435e+07 637.058 0 1613 8.25e+07 3300 0 
+
+
+1.35938e+06 168750 -1.32033e-11 -1.01998e-11 1.0744e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.40625e+06 168750 -1.93272e-11 3.46228e-12 1.0804e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+1.35938e+06 175000 -1.46536e-11 -7.83667e-12 8.63435e+07 637.058 0 1613 8.25e+07 3300 0 
+1.40625e+06 175000 -1.99079e-11 2.8495e-12 8.70134e+07 637.058 0 1613 8.25e+07 3300 0 
+
+
+1.40625e+06 162500 -1.86344e-11 4.04524e-12 1.29029e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.45312e+06 162500 -8.91533e-12 1.11508e-11 1.29426e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+1.40625e+06 168750 -1.93272e-11 3.46228e-12 1.0804e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.45312e+06 168750 -9.06976e-12 9.39554e-12 1.08386e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+
+1.45312e+06 162500 -8.91533e-12 1.11508e-11 1.29426e+08 809.012 0 1613 1.2375e+08 3300 0 
+1.5e+06 162500 0 0 1.29128e+08 809.012 0 1613 1.2375e+08 3300 0 
+
+1.45312e+06 168750 -9.06976e-12 9.39554e-12 1.08386e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.5e+06 168750 0 0 1.08097e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+
+1.40625e+06 168750 -1.93272e-11 3.46228e-12 1.0804e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.45312e+06 168750 -9.06976e-12 9.39554e-12 1.08386e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+1.40625e+06 175000 -1.99079e-11 2.8495e-12 8.70134e+07 637.058 0 1613 8.25e+07 3300 0 
+1.45312e+06 175000 -9.19124e-12 7.57572e-12 8.73252e+07 637.058 0 1613 8.25e+07 3300 0 
+
+
+1.45312e+06 168750 -9.06976e-12 9.39554e-12 1.08386e+08 723.035 0 1613 1.03125e+08 3300 0 
+1.5e+06 168750 0 0 1.08097e+08 723.035 0 1613 1.03125e+08 3300 0 
+
+1.45312e+06 175000 -9.19124e-12 7.57572e-12 8.73252e+07 637.058 0 1613 8.25e+07 3300 0 
+1.5e+06 175000 0 0 8.70389e+07 637.058 0 1613 8.25e+07 3300 0 
+
+
+1.125e+06 175000 2.68119e-11 7.499e-12 8.90533e+07 639.47 0 1613 8.25e+07 3300 0 
+1.17188e+06 175000 4.13996e-11 9.03056e-12 8.83302e+07 618.828 0 1613 8.25e+07 3300 0 
+
+1.125e+06 181250 2.78992e-11 5.67927e-12 6.78153e+07 552.986 0 1613 6.1875e+07 3300 0 
+1.17188e+06 181250 4.37459e-11 6.67433e-12 6.75949e+07 573.992 0 1613 6.1875e+07 3300 0 
+
+
+1.17188e+06 175000 4.13996e-11 9.03056e-12 8.83302e+07 618.828 0 1613 8.25e+07 3300 0 
+1.21875e+06 175000 5.51087e-11 4.32485e-12 8.8769e+07 901.621 0 1613 8.25e+07 3300 0 
+
+1.17188e+06 181250 4.37459e-11 6.67433e-12 6.75949e+07 573.992 0 1613 6.1875e+07 3300 0 
+1.21875e+06 181250 5.88657e-11 2.27026e-12 6.62762e+07 1117.49 1 1613 6.1875e+07 3300 0 
+
+
+1.125e+06 181250 2.78992e-11 5.67927e-12 6.78153e+07 552.986 0 1613 6.1875e+07 3300 0 
+1.17188e+06 181250 4.37459e-11 6.67433e-12 6.75949e+07 573.992 0 1613 6.1875e+07 3300 0 
+
+1.125e+06 187500 2.86781e-11 3.8872e-12 4.69225e+07 466.421 0 1613 4.125e+07 3300 0 
+1.17188e+06 187500 4.54106e-11 5.47942e-12 4.6962e+07 649.672 0 1613 4.125e+07 3300 0 
+
+
+1.17188e+06 181250 4.37459e-11 6.67433e-12 6.75949e+07 573.992 0 1613 6.1875e+07 3300 0 
+1.21875e+06 181250 5.88657e-11 2.27026e-12 6.62762e+07 1117.49 1 1613 6.1875e+07 3300 0 
+
+1.17188e+06 187500 4.54106e-11 5.47942e-12 4.6962e+07 649.672 0 1613 4.125e+07 3300 0 
+1.21875e+06 187500 6.04745e-11 8.56748e-13 4.30877e+07 1427.8 1 1613 4.125e+07 3300 0 
+
+
+1.21875e+06 175000 5.51087e-11 4.32485e-12 8.8769e+07 901.621 0 1613 8.25e+07 3300 0 
+1.26562e+06 175000 5.04734e-11 -1.77091e-11 8.48946e+07 637.058 0 1613 8.25e+07 3300 0 
+
+1.21875e+06 181250 5.88657e-11 2.27026e-12 6.62762e+07 1117.49 1 1613 6.1875e+07 3300 0 
+1.26562e+06 181250 4.83347e-11 -1.30028e-11 6.28191e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+
+1.26562e+06 175000 5.04734e-11 -1.77091e-11 8.48946e+07 637.058 0 1613 8.25e+07 3300 0 
+1.3125e+06 175000 1.3617e-11 -2.01393e-11 8.51063e+07 637.058 0 1613 8.25e+07 3300 0 
+
+1.26562e+06 181250 4.83347e-11 -1.30028e-11 6.28191e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.3125e+06 181250 1.13666e-11 -1.47991e-11 6.43719e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+
+1.21875e+06 181250 5.88657e-11 2.27026e-12 6.62762e+07 1117.49 1 1613 6.1875e+07 3300 0 
+1.26562e+06 181250 4.83347e-11 -1.30028e-11 6.28191e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+1.21875e+06 187500 6.04745e-11 8.56748e-13 4.30877e+07 1427.8 1 1613 4.125e+07 3300 0 
+1.26562e+06 187500 4.65994e-11 -9.40739e-12 4.20652e+07 465.104 0 1613 4.125e+07 3300 0 
+
+
+1.26562e+06 181250 4.83347e-11 -1.30028e-11 6.28191e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.3125e+06 181250 1.13666e-11 -1.47991e-11 6.43719e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+1.26562e+06 187500 4.65994e-11 -9.40739e-12 4.20652e+07 465.104 0 1613 4.125e+07 3300 0 
+1.3125e+06 187500 9.80243e-12 -9.5254e-12 4.32137e+07 465.104 0 1613 4.125e+07 3300 0 
+
+
+1.125e+06 187500 2.86781e-11 3.8872e-12 4.69225e+07 466.421 0 1613 4.125e+07 3300 0 
+1.17188e+06 187500 4.54106e-11 5.47942e-12 4.6962e+07 649.672 0 1613 4.125e+07 3300 0 
+
+1.125e+06 193750 2.91729e-11 1.76779e-12 2.33245e+07 379.8 1 1613 2.0625e+07 3300 0 
+1.17188e+06 193750 4.62487e-11 2.77613e-12 2.24637e+07 1017.74 1 1613 2.0625e+07 3300 0 
+
+
+1.17188e+06 187500 4.54106e-11 5.47942e-12 4.6962e+07 649.672 0 1613 4.125e+07 3300 0 
+1.21875e+06 187500 6.04745e-11 8.56748e-13 4.30877e+07 1427.8 1 1613 4.125e+07 3300 0 
+
+1.17188e+06 193750 4.62487e-11 2.77613e-12 2.24637e+07 1017.74 1 1613 2.0625e+07 3300 0 
+1.21875e+06 193750 6.01477e-11 6.84305e-13 2.1031e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+
+1.125e+06 193750 2.91729e-11 1.76779e-12 2.33245e+07 379.8 1 1613 2.0625e+07 3300 0 
+1.17188e+06 193750 4.62487e-11 2.77613e-12 2.24637e+07 1017.74 1 1613 2.0625e+07 3300 0 
+
+1.125e+06 200000 2.93055e-11 0 -1.38062e+06 293.15 1 1613 0 3300 0 
+1.17188e+06 200000 4.61652e-11 0 -1.17277e+06 293.15 0 1613 0 3300 0 
+
+
+1.17188e+06 193750 4.62487e-11 2.77613e-12 2.24637e+07 1017.74 1 1613 2.0625e+07 3300 0 
+1.21875e+06 193750 6.01477e-11 6.84305e-13 2.1031e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+1.17188e+06 200000 4.61652e-11 0 -1.17277e+06 293.15 0 1613 0 3300 0 
+1.21875e+06 200000 5.98569e-11 0 276767 293.15 0 1613 0 3300 0 
+
+
+1.21875e+06 187500 6.04745e-11 8.56748e-13 4.30877e+07 1427.8 1 1613 4.125e+07 3300 0 
+1.26562e+06 187500 4.65994e-11 -9.40739e-12 4.20652e+07 465.104 0 1613 4.125e+07 3300 0 
+
+1.21875e+06 193750 6.01477e-11 6.84305e-13 2.1031e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.26562e+06 193750 4.54636e-11 -4.78506e-12 2.127e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+
+1.26562e+06 187500 4.65994e-11 -9.40739e-12 4.20652e+07 465.104 0 1613 4.125e+07 3300 0 
+1.3125e+06 187500 9.80243e-12 -9.5254e-12 4.32137e+07 465.104 0 1613 4.125e+07 3300 0 
+
+1.26562e+06 193750 4.54636e-11 -4.78506e-12 2.127e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.3125e+06 193750 8.88821e-12 -4.68015e-12 2.20194e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+
+1.21875e+06 193750 6.01477e-11 6.84305e-13 2.1031e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.26562e+06 193750 4.54636e-11 -4.78506e-12 2.127e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+1.21875e+06 200000 5.98569e-11 0 276767 293.15 0 1613 0 3300 0 
+1.26562e+06 200000 4.50759e-11 0 10867 293.15 0 1613 0 3300 0 
+
+
+1.26562e+06 193750 4.54636e-11 -4.78506e-12 2.127e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.3125e+06 193750 8.88821e-12 -4.68015e-12 2.20194e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+1.26562e+06 200000 4.50759e-11 0 10867 293.15 0 1613 0 3300 0 
+1.3125e+06 200000 8.58575e-12 0 898566 293.15 0 1613 0 3300 0 
+
+
+1.3125e+06 175000 1.3617e-11 -2.01393e-11 8.51063e+07 637.058 0 1613 8.25e+07 3300 0 
+1.35938e+06 175000 -1.46536e-11 -7.83667e-12 8.63435e+07 637.058 0 1613 8.25e+07 3300 0 
+
+1.3125e+06 181250 1.13666e-11 -1.47991e-11 6.43719e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.35938e+06 181250 -1.57651e-11 -5.78342e-12 6.5195e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+
+1.35938e+06 175000 -1.46536e-11 -7.83667e-12 8.63435e+07 637.058 0 1613 8.25e+07 3300 0 
+1.40625e+06 175000 -1.99079e-11 2.8495e-12 8.70134e+07 637.058 0 1613 8.25e+07 3300 0 
+
+1.35938e+06 181250 -1.57651e-11 -5.78342e-12 6.5195e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.40625e+06 181250 -2.03682e-11 2.20697e-12 6.59645e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+
+1.3125e+06 181250 1.13666e-11 -1.47991e-11 6.43719e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.35938e+06 181250 -1.57651e-11 -5.78342e-12 6.5195e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+1.3125e+06 187500 9.80243e-12 -9.5254e-12 4.32137e+07 465.104 0 1613 4.125e+07 3300 0 
+1.35938e+06 187500 -1.65383e-11 -3.87504e-12 4.41219e+07 465.104 0 1613 4.125e+07 3300 0 
+
+
+1.35938e+06 181250 -1.57651e-11 -5.78342e-12 6.5195e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.40625e+06 181250 -2.03682e-11 2.20697e-12 6.59645e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+1.35938e+06 187500 -1.65383e-11 -3.87504e-12 4.41219e+07 465.104 0 1613 4.125e+07 3300 0 
+1.40625e+06 187500 -2.06949e-11 1.52136e-12 4.4859e+07 465.104 0 1613 4.125e+07 3300 0 
+
+
+1.40625e+06 175000 -1.99079e-11 2.8495e-12 8.70134e+07 637.058 0 1613 8.25e+07 3300 0 
+1.45312e+06 175000 -9.19124e-12 7.57572e-12 8.73252e+07 637.058 0 1613 8.25e+07 3300 0 
+
+1.40625e+06 181250 -2.03682e-11 2.20697e-12 6.59645e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.45312e+06 181250 -9.28318e-12 5.70802e-12 6.62371e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+
+1.45312e+06 175000 -9.19124e-12 7.57572e-12 8.73252e+07 637.058 0 1613 8.25e+07 3300 0 
+1.5e+06 175000 0 0 8.70389e+07 637.058 0 1613 8.25e+07 3300 0 
+
+1.45312e+06 181250 -9.28318e-12 5.70802e-12 6.62371e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.5e+06 181250 0 0 6.59586e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+
+1.40625e+06 181250 -2.03682e-11 2.20697e-12 6.59645e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.45312e+06 181250 -9.28318e-12 5.70802e-12 6.62371e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+1.40625e+06 187500 -2.06949e-11 1.52136e-12 4.4859e+07 465.104 0 1613 4.125e+07 3300 0 
+1.45312e+06 187500 -9.34828e-12 3.8122e-12 4.51327e+07 465.104 0 1613 4.125e+07 3300 0 
+
+
+1.45312e+06 181250 -9.28318e-12 5.70802e-12 6.62371e+07 551.081 0 1613 6.1875e+07 3300 0 
+1.5e+06 181250 0 0 6.59586e+07 551.081 0 1613 6.1875e+07 3300 0 
+
+1.45312e+06 187500 -9.34828e-12 3.8122e-12 4.51327e+07 465.104 0 1613 4.125e+07 3300 0 
+1.5e+06 187500 0 0 4.48475e+07 465.104 0 1613 4.125e+07 3300 0 
+
+
+1.3125e+06 187500 9.80243e-12 -9.5254e-12 4.32137e+07 465.104 0 1613 4.125e+07 3300 0 
+1.35938e+06 187500 -1.65383e-11 -3.87504e-12 4.41219e+07 465.104 0 1613 4.125e+07 3300 0 
+
+1.3125e+06 193750 8.88821e-12 -4.68015e-12 2.20194e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.35938e+06 193750 -1.69998e-11 -1.93639e-12 2.30193e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+
+1.35938e+06 187500 -1.65383e-11 -3.87504e-12 4.41219e+07 465.104 0 1613 4.125e+07 3300 0 
+1.40625e+06 187500 -2.06949e-11 1.52136e-12 4.4859e+07 465.104 0 1613 4.125e+07 3300 0 
+
+1.35938e+06 193750 -1.69998e-11 -1.93639e-12 2.30193e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.40625e+06 193750 -2.08903e-11 7.74179e-13 2.37255e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+
+1.3125e+06 193750 8.88821e-12 -4.68015e-12 2.20194e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.35938e+06 193750 -1.69998e-11 -1.93639e-12 2.30193e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+1.3125e+06 200000 8.58575e-12 0 898566 293.15 0 1613 0 3300 0 
+1.35938e+06 200000 -1.71527e-11 0 1.85682e+06 293.15 0 1613 0 3300 0 
+
+
+1.35938e+06 193750 -1.69998e-11 -1.93639e-12 2.30193e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.40625e+06 193750 -2.08903e-11 7.74179e-13 2.37255e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+1.35938e+06 200000 -1.71527e-11 0 1.85682e+06 293.15 0 1613 0 3300 0 
+1.40625e+06 200000 -2.09553e-11 0 2.57216e+06 293.15 0 1613 0 3300 0 
+
+
+1.40625e+06 187500 -2.06949e-11 1.52136e-12 4.4859e+07 465.104 0 1613 4.125e+07 3300 0 
+1.45312e+06 187500 -9.34828e-12 3.8122e-12 4.51327e+07 465.104 0 1613 4.125e+07 3300 0 
+
+1.40625e+06 193750 -2.08903e-11 7.74179e-13 2.37255e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.45312e+06 193750 -9.38746e-12 1.90879e-12 2.4003e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+
+1.45312e+06 187500 -9.34828e-12 3.8122e-12 4.51327e+07 465.104 0 1613 4.125e+07 3300 0 
+1.5e+06 187500 0 0 4.48475e+07 465.104 0 1613 4.125e+07 3300 0 
+
+1.45312e+06 193750 -9.38746e-12 1.90879e-12 2.4003e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.5e+06 193750 0 0 2.37125e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+
+1.40625e+06 193750 -2.08903e-11 7.74179e-13 2.37255e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.45312e+06 193750 -9.38746e-12 1.90879e-12 2.4003e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+1.40625e+06 200000 -2.09553e-11 0 2.57216e+06 293.15 0 1613 0 3300 0 
+1.45312e+06 200000 -9.40043e-12 0 2.84559e+06 293.15 0 1613 0 3300 0 
+
+
+1.45312e+06 193750 -9.38746e-12 1.90879e-12 2.4003e+07 379.127 0 1613 2.0625e+07 3300 0 
+1.5e+06 193750 0 0 2.37125e+07 379.127 0 1613 2.0625e+07 3300 0 
+
+1.45312e+06 200000 -9.40043e-12 0 2.84559e+06 293.15 0 1613 0 3300 0 
+1.5e+06 200000 0 0 2.55557e+06 293.15 0 1613 0 3300 0 
+
+
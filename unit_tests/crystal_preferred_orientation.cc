@@ -300,6 +300,92 @@ TEST_CASE("CPO core: Store and Load")
 
 }
 
+TEST_CASE("CPO core: Store and Load grain contiguous")
+{
+  // test store and load functions with the grain contiguous layout.
+  // the first and last element should not be changed, because we start at
+  // data position = 1.
+  aspect::Particle::Property::CrystalPreferredOrientation<3> cpo;
+  aspect::ParameterHandler prm;
+  prm.enter_subsection("Particles");
+  {
+    cpo.declare_parameters(prm);
+    prm.enter_subsection("Crystal Preferred Orientation");
+    {
+      prm.set("Random number seed","1");
+      prm.set("Number of grains per particle","3");
+      prm.set("Grain data layout","grain contiguous");
+      prm.set("CPO derivatives algorithm","Spin tensor");
+      prm.set("Property advection method","Backward Euler");
+
+      prm.enter_subsection("Initial grains");
+      {
+        prm.set("Model name","Uniform grains and random uniform rotations");
+        prm.set("Minerals","Passive,Passive");
+        prm.set("Volume fractions minerals","0.7,0.3");
+      }
+      prm.leave_subsection();
+    }
+    prm.leave_subsection ();
+  }
+  prm.leave_subsection ();
+
+  prm.enter_subsection("Particles");
+  {
+    cpo.parse_parameters(prm);
+  }
+  prm.leave_subsection ();
+
+  cpo.initialize();
+
+  unsigned int cpo_data_position = 1;
+  std::vector<double> data_array(70,-1.);
+  dealii::ArrayView<double> data(&data_array[0],70);
+
+  data[0] = 20847932.2;
+  data[65] = 6541684.3;
+
+  using namespace dealii;
+  for (unsigned int mineral_i = 0; mineral_i < 2; ++mineral_i)
+    {
+      cpo.set_deformation_type(cpo_data_position,data,mineral_i,aspect::Particle::Property::DeformationType::passive);
+      cpo.set_volume_fraction_mineral(cpo_data_position,data,mineral_i,mineral_i == 0 ? 0.7 : 0.3);
+
+      for (unsigned int grain_i = 0; grain_i < 3; ++grain_i)
+        {
+          Tensor<2,3> rotation_matrix;
+          for (unsigned int i = 0; i < 9; ++i)
+            rotation_matrix[Tensor<2,3>::unrolled_to_component_indices(i)] = (100.*mineral_i + 10.*grain_i + i)/1000.;
+          cpo.set_rotation_matrix_grains(cpo_data_position,data,mineral_i,grain_i,rotation_matrix);
+          cpo.set_volume_fractions_grains(cpo_data_position,data,mineral_i,grain_i,0.1*(3*mineral_i+grain_i+1));
+        }
+    }
+
+  CHECK(data[0] == Approx(20847932.2)); // before data position
+  for (unsigned int mineral_i = 0; mineral_i < 2; ++mineral_i)
+    {
+      const unsigned int mineral_start = cpo_data_position + mineral_i * 32;
+      CHECK(data[mineral_start] ==  Approx(0.0)); // deformation type
+      CHECK(data[mineral_start+1] ==  Approx(mineral_i == 0 ? 0.7 : 0.3)); // mineral volume fraction
+
+      for (unsigned int grain_i = 0; grain_i < 3; ++grain_i)
+        {
+          // all grain volume fractions are stored first, followed by
+          // each component of the rotation matrix for all grains.
+          CHECK(data[mineral_start+2+grain_i] ==  Approx(0.1*(3*mineral_i+grain_i+1)));
+          for (unsigned int i = 0; i < 9; ++i)
+            CHECK(data[mineral_start+2+(i+1)*3+grain_i] == Approx((100.*mineral_i + 10.*grain_i + i)/1000.));
+
+          const Tensor<2,3> rotation_matrix = cpo.get_rotation_matrix_grains(cpo_data_position,data,mineral_i,grain_i);
+          for (unsigned int i = 0; i < 9; ++i)
+            CHECK(rotation_matrix[Tensor<2,3>::unrolled_to_component_indices(i)] == Approx((100.*mineral_i + 10.*grain_i + i)/1000.));
+          CHECK(cpo.get_volume_fractions_grains(cpo_data_position,data,mineral_i,grain_i) == Approx(0.1*(3*mineral_i+grain_i+1)));
+        }
+    }
+  CHECK(data[65] == Approx(6541684.3)); // after data position
+  CHECK(data[66] == Approx(-1.0)); // after data position
+}
+
 TEST_CASE("CPO core: Spin tensor")
 {
   using namespace dealii;
@@ -98,4 +98,56 @@ TEST_CASE("Utilities::load_netcdf-3d-column-names")
   REQUIRE(lookup.get_data(Point<3>(1000., 500., 0.), 0) == Approx(1.));
 }
 
+TEST_CASE("Utilities::load_netcdf-3d-region")
+{
+  using namespace dealii;
+
+  aspect::Utilities::StructuredDataLookup<3> full_lookup(1.0 /*scaling*/);
+  full_lookup.load_netcdf(ASPECT_SOURCE_DIR "/data/test/netcdf/test-3d-cartesian.nc");
+
+  // Only read the data points around the given region. The file has the
+  // coordinates x = {0,1000,2000}, y = {500,1000,1500,2000} and
+  // z = {0,300,600,700,800}, so without a halo the region is covered by
+  // two data points in each direction.
+  const BoundingBox<3> region(std::make_pair(Point<3>(100., 1100., 350.),
+                                             Point<3>(900., 1400., 550.)));
+
+  for (const unsigned int n_halo_points : {0u, 1u})
+    {
+      INFO("halo points: " << n_halo_points);
+
+      aspect::Utilities::StructuredDataLookup<3> lookup(1.0 /*scaling*/);
+      lookup.restrict_to_region(region, n_halo_points);
+      lookup.load_netcdf(ASPECT_SOURCE_DIR "/data/test/netcdf/test-3d-cartesian.nc");
+
+      REQUIRE(lookup.get_column_names() == full_lookup.get_column_names());
+
+      if (n_halo_points == 0)
+        {
+          REQUIRE(lookup.get_number_of_coordinates(0) == 2);
+          REQUIRE(lookup.get_number_of_coordinates(1) == 2);
+          REQUIRE(lookup.get_number_of_coordinates(2) == 2);
+          REQUIRE(lookup.get_interpolation_point_coordinates(1)[0] == Approx(1000.));
+          REQUIRE(lookup.get_interpolation_point_coordinates(2)[0] == Approx(300.));
+        }
+      else
+        {
+          REQUIRE(lookup.get_number_of_coordinates(0) == 3);
+          REQUIRE(lookup.get_number_of_coordinates(1) == 4);
+          REQUIRE(lookup.get_number_of_coordinates(2) == 4);
+        }
+
+      // Inside of the region, the values of the restricted read need to
+      // match the ones of the full read.
+      for (const Point<3> &p : {Point<3>(100., 1100., 350.), Point<3>(500., 1250., 450.),
+                                Point<3>(900., 1400., 550.), Point<3>(250., 1300., 500.)
+                               })
+        for (unsigned int c=0; c<2; ++c)
+          {
+            INFO("point " << p << ", column " << c);
+            REQUIRE(lookup.get_data(p, c) == Approx(full_lookup.get_data(p, c)));
+          }
+    }
+}
+
 #endif
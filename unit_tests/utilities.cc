@@ -152,6 +152,81 @@ TEST_CASE("Utilities::AsciiDataLookup manual dim=2 equid")
   REQUIRE(lookup.get_data(Point<2>(1.5,6.0),0) == Approx(5.5));
 }
 
+TEST_CASE("Utilities::AsciiDataLookup batched")
+{
+  using namespace dealii;
+
+  // Compare the batched lookups with the scalar ones, both for an
+  // equidistant and a non-equidistant grid, and for points inside and
+  // outside of the data range.
+  for (const bool equidistant : {true, false})
+    {
+      INFO("equidistant: " << equidistant);
+
+      aspect::Utilities::StructuredDataLookup<2> lookup(2 /*n_components*/, 1.0 /*scaling*/);
+
+      std::vector<std::string> column_names = {"a", "b"};
+      std::vector<Table<2,double>> raw_data(2, Table<2,double>(3,3));
+      std::vector<std::vector<double>> coordinate_values(2, std::vector<double>(3, 0.));
+
+      // x:
+      coordinate_values[0] = (equidistant ? std::vector<double>({0., 1., 2.}) : std::vector<double>({0., 1., 3.}));
+      // y:
+      coordinate_values[1] = {5., 6., 7.};
+      for (unsigned int i=0; i<3; ++i)
+        for (unsigned int j=0; j<3; ++j)
+          {
+            raw_data[0](i,j) = 1.0 + i + 3.0*j*j;
+            raw_data[1](i,j) = -2.0*i*i + j;
+          }
+
+      lookup.reinit(column_names, std::move(coordinate_values), std::move(raw_data),
+                    MPI_COMM_SELF, numbers::invalid_unsigned_int);
+
+      const std::vector<Point<2>> points = {Point<2>(0.5,5.5), Point<2>(1.0,6.0), Point<2>(1.7,6.9),
+                                            Point<2>(-1.0,5.2), Point<2>(4.0,8.0), Point<2>(2.5,4.0)
+                                           };
+
+      std::vector<std::vector<double>> values;
+      std::vector<std::vector<Tensor<1,2>>> gradients;
+      lookup.get_data(make_array_view(points), ComponentMask(), values);
+      lookup.get_gradients(make_array_view(points), ComponentMask(), gradients);
+
+      REQUIRE(values.size() == 2);
+      REQUIRE(gradients.size() == 2);
+      for (unsigned int c=0; c<2; ++c)
+        for (unsigned int q=0; q<points.size(); ++q)
+          {
+            INFO("component " << c << ", point " << points[q]);
+            REQUIRE(values[c][q] == Approx(lookup.get_data(points[q],c)));
+            const Tensor<1,2> gradient = lookup.get_gradients(points[q],c);
+            REQUIRE(gradients[c][q][0] == Approx(gradient[0]));
+            REQUIRE(gradients[c][q][1] == Approx(gradient[1]));
+          }
+
+      // Only compute the second component. The first one must stay untouched.
+      std::vector<std::vector<double>> masked_values(2, std::vector<double>(1, 42.));
+      lookup.get_data(make_array_view(points), ComponentMask(std::vector<bool>({false, true})), masked_values);
+      REQUIRE(masked_values[0].size() == 1);
+      REQUIRE(masked_values[0][0] == 42.);
+      for (unsigned int q=0; q<points.size(); ++q)
+        REQUIRE(masked_values[1][q] == Approx(lookup.get_data(points[q],1)));
+
+      // On an interior grid node the gradient is the one of the cell to the
+      // right of the node in every direction, as for the deal.II
+      // interpolation that was used before the batched lookups.
+      const double dx = (equidistant ? 1. : 2.);
+      const Tensor<1,2> gradient_a = lookup.get_gradients(Point<2>(1.0,6.0),0);
+      const Tensor<1,2> gradient_b = lookup.get_gradients(Point<2>(1.0,6.0),1);
+      REQUIRE(gradient_a[0] == Approx(1.0/dx));
+      REQUIRE(gradient_a[1] == Approx(9.0));
+      REQUIRE(gradient_b[0] == Approx(-6.0/dx));
+      REQUIRE(gradient_b[1] == Approx(1.0));
+      REQUIRE(gradients[0][1][0] == Approx(1.0/dx));
+      REQUIRE(gradients[0][1][1] == Approx(9.0));
+    }
+}
+
 TEST_CASE("Random draw volume weighted average rotation matrix")
 {
   std::vector<double> unsorted_volume_fractions = {2.,5.,1.,3.,6.,4.};